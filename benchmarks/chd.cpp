@@ -0,0 +1,121 @@
+#include "benchmark/benchmark_api.h"
+#include "chd.h"
+#include "chdcodec.h"
+#include "ioprocs.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <vector>
+
+// Decompresses hunks of a hard disk image with each of the codecs a CHD
+// can use for them.  The hunks are compressed once up front with the
+// codec's own compressor; the disk contents mix empty sectors, text and
+// tables of small numbers, and 16-bit PCM as a game's sample data would
+// be laid out.  Bytes processed are decompressed bytes.
+
+namespace {
+
+constexpr uint32_t HUNK_BYTES = 4096;
+constexpr uint32_t HUNKS = 64;
+
+constexpr chd_codec_type CODECS[] =
+{
+	CHD_CODEC_ZLIB,
+	CHD_CODEC_ZSTD,
+	CHD_CODEC_LZMA,
+	CHD_CODEC_HUFFMAN,
+	CHD_CODEC_FLAC
+};
+
+std::vector<uint8_t> make_disk()
+{
+	static char const text[] = "SYSTEM  DAT READ ERROR ON DRIVE C: RETRY? INSERT COIN PLAYER SELECT ";
+	std::vector<uint8_t> disk(HUNK_BYTES * HUNKS);
+	uint32_t state = 0x9d14abd7;
+	for (uint32_t hunk = 0; hunk < HUNKS; hunk++)
+	{
+		uint8_t *const dest = &disk[hunk * HUNK_BYTES];
+		switch (hunk % 4)
+		{
+		case 0: // mostly empty sectors
+			for (uint32_t i = 0; i < 64; i++)
+				dest[i] = uint8_t(i);
+			break;
+
+		case 1: // text
+			for (uint32_t i = 0; i < HUNK_BYTES; i++)
+				dest[i] = text[(i + hunk) % (std::size(text) - 1)];
+			break;
+
+		case 2: // tables of small values
+			for (uint32_t i = 0; i < HUNK_BYTES; i++)
+			{
+				state = state * 1103515245 + 12345;
+				dest[i] = uint8_t((state >> 28) & 7);
+			}
+			break;
+
+		case 3: // 16-bit stereo PCM, a pair of slow sine-like ramps plus noise
+			for (uint32_t i = 0; i < HUNK_BYTES / 4; i++)
+			{
+				state = state * 1103515245 + 12345;
+				uint32_t const phase = (hunk * HUNK_BYTES / 4 + i) & 0xff;
+				int16_t const left = int16_t(((phase < 0x80) ? phase : (0xff - phase)) * 128 - 8192 + ((state >> 24) & 0x3f));
+				int16_t const right = int16_t(left / 2);
+				dest[i * 4 + 0] = uint8_t(left >> 8);
+				dest[i * 4 + 1] = uint8_t(left);
+				dest[i * 4 + 2] = uint8_t(right >> 8);
+				dest[i * 4 + 3] = uint8_t(right);
+			}
+			break;
+		}
+	}
+	return disk;
+}
+
+void BM_chd_decompress(benchmark::State& state)
+{
+	chd_codec_type const codec = CODECS[state.range(0)];
+	state.SetLabel(chd_codec_list::codec_name(codec));
+
+	// the codecs take their hunk size from a CHD, so make a scratch one
+	chd_file chd;
+	chd_codec_type const compression[4] = { codec, CHD_CODEC_NONE, CHD_CODEC_NONE, CHD_CODEC_NONE };
+	if (chd.create(util::stdio_read_write(std::tmpfile()), uint64_t(HUNK_BYTES) * HUNKS, HUNK_BYTES, 512, compression))
+	{
+		state.SkipWithError("couldn't create a scratch CHD");
+		return;
+	}
+	chd_compressor::ptr const compressor = chd_codec_list::new_compressor(codec, chd);
+	chd_decompressor::ptr const decompressor = chd_codec_list::new_decompressor(codec, chd);
+
+	// compress each hunk; any the codec can't shrink are skipped, as a CHD
+	// would store them uncompressed
+	std::vector<uint8_t> const disk = make_disk();
+	std::vector<std::vector<uint8_t>> hunks;
+	for (uint32_t hunk = 0; hunk < HUNKS; hunk++)
+	{
+		std::vector<uint8_t> compressed(HUNK_BYTES * 2);
+		try
+		{
+			compressed.resize(compressor->compress(&disk[hunk * HUNK_BYTES], HUNK_BYTES, compressed.data()));
+			hunks.emplace_back(std::move(compressed));
+		}
+		catch (std::error_condition const &)
+		{
+		}
+	}
+
+	std::vector<uint8_t> dest(HUNK_BYTES);
+	while (state.KeepRunning()) {
+		for (std::vector<uint8_t> const &hunk : hunks)
+			decompressor->decompress(hunk.data(), hunk.size(), dest.data(), HUNK_BYTES);
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * hunks.size() * HUNK_BYTES);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_chd_decompress)->DenseRange(0, std::size(CODECS) - 1);
@@ -0,0 +1,139 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "drawgfxsimd.h"
+
+#include <cstdint>
+#include <vector>
+
+// Source data modelled on a set of 16x16 sprites: each 16-pixel sprite
+// row is either wholly transparent, wholly opaque, or an opaque core with
+// transparent edges.  Each benchmark draws the same sprite rows with the
+// scalar per-pixel loop used by drawgfx and with the row kernel, one call
+// per sprite row as drawgfx_core does.
+
+namespace {
+
+constexpr uint32_t SPRITE_WIDTH = 16;
+constexpr uint32_t SPRITE_ROWS = 16 * 64;
+constexpr uint32_t TRANS_PEN = 0;
+
+std::vector<uint8_t> make_source()
+{
+	std::vector<uint8_t> src(SPRITE_WIDTH * SPRITE_ROWS);
+	uint32_t state = 0x9d14abd7;
+	for (uint32_t y = 0; y < SPRITE_ROWS; y++)
+	{
+		state = state * 1103515245 + 12345;
+		uint32_t const kind = (state >> 8) % 8;
+		uint32_t const left = (kind < 2) ? SPRITE_WIDTH : (kind < 5) ? 0 : (1 + (state >> 12) % 5);
+		uint32_t const right = (kind < 2) ? SPRITE_WIDTH : (kind < 5) ? SPRITE_WIDTH : (SPRITE_WIDTH - 1 - (state >> 16) % 5);
+		for (uint32_t x = 0; x < SPRITE_WIDTH; x++)
+		{
+			state = state * 1103515245 + 12345;
+			bool const opaque = (x >= left) && (x < right);
+			src[y * SPRITE_WIDTH + x] = opaque ? (1 + ((state >> 8) % 15)) : TRANS_PEN;
+		}
+	}
+	return src;
+}
+
+std::vector<uint32_t> make_palette()
+{
+	std::vector<uint32_t> pal(256);
+	for (uint32_t i = 0; i < 256; i++)
+		pal[i] = i * 0x010203;
+	return pal;
+}
+
+void BM_rebase_transpen_scalar(benchmark::State& state)
+{
+	std::vector<uint8_t> const src = make_source();
+	std::vector<uint16_t> dest(src.size());
+	uint32_t const color = 0x100;
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < src.size(); i++)
+			if (src[i] != TRANS_PEN)
+				dest[i] = color + src[i];
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+void BM_rebase_transpen_row(benchmark::State& state)
+{
+	std::vector<uint8_t> const src = make_source();
+	std::vector<uint16_t> dest(src.size());
+	uint32_t const color = 0x100;
+	while (state.KeepRunning()) {
+		for (uint32_t y = 0; y < SPRITE_ROWS; y++)
+			drawgfx_row_rebase_transpen(&dest[y * SPRITE_WIDTH], &src[y * SPRITE_WIDTH], SPRITE_WIDTH, color, TRANS_PEN);
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+void BM_remap_transpen_scalar(benchmark::State& state)
+{
+	std::vector<uint8_t> const src = make_source();
+	std::vector<uint32_t> const pal = make_palette();
+	std::vector<uint32_t> dest(src.size());
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < src.size(); i++)
+			if (src[i] != TRANS_PEN)
+				dest[i] = pal[src[i]];
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+void BM_remap_transpen_row(benchmark::State& state)
+{
+	std::vector<uint8_t> const src = make_source();
+	std::vector<uint32_t> const pal = make_palette();
+	std::vector<uint32_t> dest(src.size());
+	while (state.KeepRunning()) {
+		for (uint32_t y = 0; y < SPRITE_ROWS; y++)
+			drawgfx_row_remap_transpen(&dest[y * SPRITE_WIDTH], &src[y * SPRITE_WIDTH], SPRITE_WIDTH, pal.data(), TRANS_PEN);
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+void BM_remap_transpen_priority_scalar(benchmark::State& state)
+{
+	std::vector<uint8_t> const src = make_source();
+	std::vector<uint32_t> const pal = make_palette();
+	std::vector<uint32_t> dest(src.size());
+	std::vector<uint8_t> pri(src.size());
+	uint32_t const pmask = 0x80000002;
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < src.size(); i++)
+			if (src[i] != TRANS_PEN)
+			{
+				if (((1 << (pri[i] & 0x1f)) & pmask) == 0)
+					dest[i] = pal[src[i]];
+				pri[i] = 31;
+			}
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+void BM_remap_transpen_priority_row(benchmark::State& state)
+{
+	std::vector<uint8_t> const src = make_source();
+	std::vector<uint32_t> const pal = make_palette();
+	std::vector<uint32_t> dest(src.size());
+	std::vector<uint8_t> pri(src.size());
+	uint32_t const pmask = 0x80000002;
+	uint32_t const *const paldata = pal.data();
+	while (state.KeepRunning()) {
+		for (uint32_t y = 0; y < SPRITE_ROWS; y++)
+			drawgfx_row_transpen_priority(&dest[y * SPRITE_WIDTH], &pri[y * SPRITE_WIDTH], &src[y * SPRITE_WIDTH], SPRITE_WIDTH, TRANS_PEN, pmask, [paldata] (uint32_t pen) { return paldata[pen]; });
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_rebase_transpen_scalar);
+BENCHMARK(BM_rebase_transpen_row);
+BENCHMARK(BM_remap_transpen_scalar);
+BENCHMARK(BM_remap_transpen_row);
+BENCHMARK(BM_remap_transpen_priority_scalar);
+BENCHMARK(BM_remap_transpen_priority_row);
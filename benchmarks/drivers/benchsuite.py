@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+# license:BSD-3-Clause
+# copyright-holders:MAMEdev Team
+#
+# Runs every system in drivers.lst headless for its fixed number of
+# emulated seconds with -bench and -bench_log, then reports the speed,
+# frame time percentiles and where the wall-clock time went.  With
+# --baseline, systems that got slower than the threshold are listed and
+# the exit status is non-zero.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+
+SUITE_DIR = os.path.dirname(os.path.abspath(__file__))
+PARTS = ('emulation_ms', 'sound_ms', 'screen_ms', 'osd_ms')
+
+
+def read_suite(path):
+    systems = []
+    with open(path) as suite:
+        for line in suite:
+            line = line.split('#', 1)[0].strip()
+            if line:
+                fields = line.split(None, 2)
+                systems.append((fields[0], int(fields[1])))
+    return systems
+
+
+def run_system(args, name, seconds):
+    log = os.path.join(args.output, name + '.json')
+    command = [
+            args.emulator, name,
+            '-bench', str(seconds),
+            '-bench_log', log,
+            '-rompath', args.rompath,
+            '-nvram_directory', os.path.join(args.output, 'nvram'),
+            '-cfg_directory', os.path.join(args.output, 'cfg'),
+            '-snapshot_directory', os.path.join(args.output, 'snap'),
+            '-skip_gameinfo',
+            '-noreadconfig']
+    inp = os.path.join(SUITE_DIR, 'inp', name + '.inp')
+    if os.path.isfile(inp):
+        command += ['-input_directory', os.path.dirname(inp), '-playback', os.path.basename(inp)]
+    command += args.extra
+
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if (result.returncode != 0) or not os.path.isfile(log):
+        sys.stderr.write('%s: failed (exit status %d)\n%s' % (name, result.returncode, result.stdout))
+        return None
+    with open(log) as f:
+        return json.load(f)
+
+
+def summarize(log):
+    total = log['total_ms']
+    wall = sum(total[part] for part in PARTS) + total.get('throttle_ms', 0.0)
+    summary = {
+            'speed': log['speed'],
+            'frames': log['frames'],
+            'p50_ms': log['frame_ms']['p50'],
+            'p99_ms': log['frame_ms']['p99'],
+            'drc_code_bytes': sum(v for k, v in log['counters'].items() if k.endswith(':drc_code_bytes'))}
+    for part in PARTS:
+        summary[part[:-3] + '_share'] = (total[part] / wall) if wall else 0.0
+    if 'profiler' in log:
+        summary['profiler'] = log['profiler']
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run the driver performance suite')
+    parser.add_argument('--emulator', required=True, help='emulator executable')
+    parser.add_argument('--rompath', default='roms', help='ROM search path')
+    parser.add_argument('--output', default='benchsuite', help='directory for logs and results')
+    parser.add_argument('--suite', default=os.path.join(SUITE_DIR, 'drivers.lst'), help='list of systems to run')
+    parser.add_argument('--only', action='append', default=[], help='run only this system (may be repeated)')
+    parser.add_argument('--baseline', help='results.json of an earlier run to compare against')
+    parser.add_argument('--threshold', type=float, default=5.0, help='slowdown in percent reported as a regression')
+    parser.add_argument('extra', nargs='*', help='extra options passed to the emulator')
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    results = {}
+    for name, seconds in read_suite(args.suite):
+        if args.only and (name not in args.only):
+            continue
+        log = run_system(args, name, seconds)
+        if log is not None:
+            results[name] = summarize(log)
+
+    print('%-10s %9s %8s %8s %6s %6s %6s %6s' % ('system', 'speed', 'p50 ms', 'p99 ms', 'emu', 'sound', 'screen', 'osd'))
+    for name, summary in results.items():
+        print('%-10s %8.2f%% %8.3f %8.3f %5.1f%% %5.1f%% %5.1f%% %5.1f%%' % (
+                name, summary['speed'] * 100.0, summary['p50_ms'], summary['p99_ms'],
+                summary['emulation_share'] * 100.0, summary['sound_share'] * 100.0,
+                summary['screen_share'] * 100.0, summary['osd_share'] * 100.0))
+
+    with open(os.path.join(args.output, 'results.json'), 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+
+    status = 0 if results else 1
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        for name, summary in results.items():
+            if name in baseline and baseline[name]['speed'] > 0:
+                change = (summary['speed'] / baseline[name]['speed'] - 1.0) * 100.0
+                if change < -args.threshold:
+                    print('REGRESSION: %s is %.1f%% slower than the baseline' % (name, -change))
+                    status = 1
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,166 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Memory reads on a 16-bit bus with a 24-bit address space, laid out like
+// a typical 68000 system: ROM, work RAM, and a 16K page of devices decoded
+// further by a second dispatch level.  The dispatch is modelled on
+// handler_entry_read_dispatch (a table indexed by the address bits above
+// 14, then a virtual read on the handler found, which may be another
+// dispatch level), the frozen path on memory_access_specific with
+// -frozenmap (one native pointer per 16K page, falling back to the
+// dispatch where the page isn't plain memory).  Nine reads in ten are
+// sequential from ROM, as instruction fetches would be; the rest go to
+// RAM or the devices.  Items processed are reads.
+
+namespace {
+
+constexpr uint32_t ADDR_BITS = 24;
+constexpr uint32_t LOW_BITS = 14;
+constexpr uint32_t DEVICE_LOW_BITS = 4;
+constexpr uint32_t ROM_BASE = 0x000000, ROM_SIZE = 0x100000;
+constexpr uint32_t RAM_BASE = 0xff0000, RAM_SIZE = 0x10000;
+constexpr uint32_t IO_BASE = 0x800000;
+constexpr uint32_t READS = 4096;
+
+class read_handler
+{
+public:
+	virtual ~read_handler() = default;
+	virtual uint16_t read(uint32_t offset, uint16_t mem_mask) const = 0;
+};
+
+class memory_handler : public read_handler
+{
+public:
+	memory_handler(const uint16_t *base, uint32_t start) : m_base(base), m_start(start) { }
+	virtual uint16_t read(uint32_t offset, uint16_t mem_mask) const override { return m_base[(offset - m_start) >> 1]; }
+	const uint16_t *pointer(uint32_t offset) const { return &m_base[(offset - m_start) >> 1]; }
+private:
+	const uint16_t *m_base;
+	uint32_t m_start;
+};
+
+class unmapped_handler : public read_handler
+{
+public:
+	virtual uint16_t read(uint32_t offset, uint16_t mem_mask) const override { return 0xffff; }
+};
+
+class device_handler : public read_handler
+{
+public:
+	device_handler(uint16_t &reg) : m_reg(reg) { }
+	virtual uint16_t read(uint32_t offset, uint16_t mem_mask) const override { return m_reg++ & mem_mask; }
+private:
+	uint16_t &m_reg;
+};
+
+template <uint32_t HighBits, uint32_t LowBits>
+class dispatch_handler : public read_handler
+{
+public:
+	dispatch_handler(const read_handler *fill) { for (auto &entry : m_dispatch) entry = fill; }
+	void set(uint32_t index, const read_handler *handler) { m_dispatch[index] = handler; }
+	virtual uint16_t read(uint32_t offset, uint16_t mem_mask) const override { return m_dispatch[(offset >> LowBits) & ((1 << (HighBits - LowBits)) - 1)]->read(offset, mem_mask); }
+private:
+	const read_handler *m_dispatch[1 << (HighBits - LowBits)];
+};
+
+struct space_model
+{
+	std::vector<uint16_t> rom, ram;
+	uint16_t regs[16];
+	unmapped_handler unmapped;
+	std::unique_ptr<memory_handler> rom_handler, ram_handler;
+	std::vector<std::unique_ptr<device_handler>> devices;
+	std::unique_ptr<dispatch_handler<LOW_BITS, DEVICE_LOW_BITS>> io;
+	std::unique_ptr<dispatch_handler<ADDR_BITS, LOW_BITS>> root;
+	std::vector<const void *> frozen;
+
+	space_model() : rom(ROM_SIZE / 2), ram(RAM_SIZE / 2), regs{ 0 }, frozen(1 << (ADDR_BITS - LOW_BITS), nullptr)
+	{
+		for (uint32_t i = 0; i < rom.size(); i++)
+			rom[i] = uint16_t(i * 0x9e37);
+		rom_handler = std::make_unique<memory_handler>(rom.data(), ROM_BASE);
+		ram_handler = std::make_unique<memory_handler>(ram.data(), RAM_BASE);
+		io = std::make_unique<dispatch_handler<LOW_BITS, DEVICE_LOW_BITS>>(&unmapped);
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			devices.emplace_back(std::make_unique<device_handler>(regs[i]));
+			io->set(i, devices.back().get());
+		}
+		root = std::make_unique<dispatch_handler<ADDR_BITS, LOW_BITS>>(&unmapped);
+		for (uint32_t addr = ROM_BASE; addr < ROM_BASE + ROM_SIZE; addr += 1 << LOW_BITS)
+		{
+			root->set(addr >> LOW_BITS, rom_handler.get());
+			frozen[addr >> LOW_BITS] = rom_handler->pointer(addr);
+		}
+		for (uint32_t addr = RAM_BASE; addr < RAM_BASE + RAM_SIZE; addr += 1 << LOW_BITS)
+		{
+			root->set(addr >> LOW_BITS, ram_handler.get());
+			frozen[addr >> LOW_BITS] = ram_handler->pointer(addr);
+		}
+		root->set(IO_BASE >> LOW_BITS, io.get());
+	}
+};
+
+std::vector<uint32_t> make_addresses()
+{
+	std::vector<uint32_t> addresses(READS);
+	uint32_t state = 0x9d14abd7;
+	uint32_t pc = 0x1000;
+	for (uint32_t i = 0; i < READS; i++)
+	{
+		state = state * 1103515245 + 12345;
+		uint32_t const kind = (state >> 8) % 10;
+		if (kind < 9)
+		{
+			addresses[i] = pc;
+			pc = (pc + 2) % ROM_SIZE;
+		}
+		else if ((state >> 16) & 1)
+			addresses[i] = RAM_BASE + ((state >> 12) & (RAM_SIZE - 2));
+		else
+			addresses[i] = IO_BASE + ((state >> 12) & 0xfe);
+	}
+	return addresses;
+}
+
+void BM_emumem_dispatch(benchmark::State& state)
+{
+	space_model space;
+	std::vector<uint32_t> const addresses = make_addresses();
+	while (state.KeepRunning()) {
+		uint32_t sum = 0;
+		for (uint32_t const address : addresses)
+			sum += space.root->read(address, 0xffff);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * READS);
+}
+
+void BM_emumem_frozen(benchmark::State& state)
+{
+	space_model space;
+	std::vector<uint32_t> const addresses = make_addresses();
+	const void *const *const pages = space.frozen.data();
+	while (state.KeepRunning()) {
+		uint32_t sum = 0;
+		for (uint32_t const address : addresses)
+		{
+			const uint16_t *const page = static_cast<const uint16_t *>(pages[address >> LOW_BITS]);
+			sum += page ? page[(address & ((1 << LOW_BITS) - 1)) >> 1] : space.root->read(address, 0xffff);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * READS);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_emumem_dispatch);
+BENCHMARK(BM_emumem_frozen);
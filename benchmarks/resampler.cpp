@@ -0,0 +1,99 @@
+#include "benchmark/benchmark_api.h"
+#include "soundfir.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Resamples a block of input at each of a few common chip output rates down
+// or up to 48kHz, with the box-averaging loop of the simple resampler and
+// with the polyphase filter.  Items processed are output samples, so the
+// reported rate is output samples per second.
+
+namespace {
+
+constexpr uint32_t OUTPUT_RATE = 48000;
+constexpr uint32_t OUTPUT_SAMPLES = 4800;
+
+std::vector<float> make_source(double step, uint32_t margin)
+{
+	std::vector<float> src(uint32_t(std::ceil(OUTPUT_SAMPLES * step)) + 2 * margin + 2);
+	uint32_t state = 0x9d14abd7;
+	for (uint32_t i = 0; i < src.size(); i++)
+	{
+		state = state * 1103515245 + 12345;
+		src[i] = float(int32_t(state >> 8) - 0x800000) / float(0x800000);
+	}
+	return src;
+}
+
+void BM_resample_simple(benchmark::State& state)
+{
+	double const step = double(state.range(0)) / double(OUTPUT_RATE);
+	float const stepinv = 1.0f / float(step);
+	std::vector<float> const src = make_source(step, 0);
+	std::vector<float> dest(OUTPUT_SAMPLES);
+	while (state.KeepRunning()) {
+		float srcpos = 0.0f;
+		uint32_t srcindex = 0;
+		float cursample = src[srcindex++];
+		if (step < 1.0)
+		{
+			for (uint32_t i = 0; i < OUTPUT_SAMPLES; i++)
+			{
+				srcpos += float(step);
+				if (srcpos <= 1.0f)
+					dest[i] = cursample;
+				else
+				{
+					srcpos -= 1.0f;
+					float const prevsample = cursample;
+					cursample = src[srcindex++];
+					dest[i] = stepinv * (prevsample * (float(step) - srcpos) + srcpos * cursample);
+				}
+			}
+		}
+		else
+		{
+			for (uint32_t i = 0; i < OUTPUT_SAMPLES; i++)
+			{
+				float const scale = 1.0f - srcpos;
+				float sample = cursample * scale;
+				float remaining = float(step) - scale;
+				while (remaining >= 1.0f)
+				{
+					sample += src[srcindex++];
+					remaining -= 1.0f;
+				}
+				cursample = src[srcindex++];
+				sample += cursample * remaining;
+				dest[i] = sample * stepinv;
+				srcpos = remaining;
+			}
+		}
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * OUTPUT_SAMPLES);
+}
+
+void BM_resample_polyphase(benchmark::State& state)
+{
+	double const step = double(state.range(0)) / double(OUTPUT_RATE);
+	sound_fir_filter filter;
+	filter.configure(step);
+	std::vector<float> const src = make_source(step, filter.lookbehind() + filter.lookahead());
+	std::vector<float> dest(OUTPUT_SAMPLES);
+	double const start = filter.lookbehind() + 1;
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < OUTPUT_SAMPLES; i++)
+			dest[i] = filter.filter(src.data(), start + double(i) * step);
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * OUTPUT_SAMPLES);
+}
+
+} // anonymous namespace
+
+// 8kHz samples, 44.1kHz, YM2151 output (3.579545MHz / 64), raw 3.579545MHz
+BENCHMARK(BM_resample_simple)->Arg(8000)->Arg(44100)->Arg(55930)->Arg(3579545);
+BENCHMARK(BM_resample_polyphase)->Arg(8000)->Arg(44100)->Arg(55930)->Arg(3579545);
@@ -0,0 +1,193 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// A 512x512 tilemap of 8x8 tiles, already rendered to its pixmap and
+// flags map, drawn scrolled onto a 320x224 screen the way
+// tilemap_t::draw_instance does it: consecutive tiles of the same kind
+// (wholly opaque, wholly transparent, masked) are merged into one run per
+// scanline, and runs are drawn with the scanline_draw helpers.  A quarter
+// of the tiles are transparent and a quarter masked, as on a typical
+// foreground layer.  Items processed are screen pixels.
+
+namespace {
+
+constexpr int TILE_SIZE = 8;
+constexpr int MAP_SIZE = 512;
+constexpr int COLS = MAP_SIZE / TILE_SIZE;
+constexpr int SCREEN_WIDTH = 320;
+constexpr int SCREEN_HEIGHT = 224;
+
+enum trans_t { WHOLLY_TRANSPARENT, WHOLLY_OPAQUE, MASKED };
+
+struct tilemap_model
+{
+	std::vector<uint16_t> pixmap;
+	std::vector<uint8_t> flagsmap;
+	std::vector<uint8_t> tileflags;
+
+	tilemap_model() : pixmap(MAP_SIZE * MAP_SIZE), flagsmap(MAP_SIZE * MAP_SIZE), tileflags(COLS * COLS)
+	{
+		uint32_t state = 0x9d14abd7;
+		for (int tile = 0; tile < COLS * COLS; tile++)
+		{
+			state = state * 1103515245 + 12345;
+			uint32_t const kind = (state >> 8) & 3;
+			int const tx = (tile % COLS) * TILE_SIZE;
+			int const ty = (tile / COLS) * TILE_SIZE;
+			tileflags[tile] = (kind == 3) ? 0x10 : 0;
+			for (int y = 0; y < TILE_SIZE; y++)
+				for (int x = 0; x < TILE_SIZE; x++)
+				{
+					state = state * 1103515245 + 12345;
+					bool const opaque = (kind == 0) ? false : (kind == 3) ? (((state >> 12) & 3) != 0) : true;
+					pixmap[(ty + y) * MAP_SIZE + tx + x] = (tile & 0x3f) * 16 + ((state >> 8) & 15);
+					flagsmap[(ty + y) * MAP_SIZE + tx + x] = opaque ? 0x10 : 0;
+				}
+		}
+	}
+};
+
+void draw_opaque(uint16_t *dest, const uint16_t *source, int count, uint8_t *pri, uint32_t pcode)
+{
+	int const pal = pcode >> 16;
+	if (pal == 0)
+	{
+		std::memcpy(dest, source, count * 2);
+		if (pcode == 0xff00)
+			return;
+		for (int i = 0; i < count; i++)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	}
+	else if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			dest[i] = source[i] + pal;
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		}
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+			dest[i] = source[i] + pal;
+	}
+}
+
+void draw_masked(uint16_t *dest, const uint16_t *source, const uint8_t *maskptr, int mask, int value, int count, uint8_t *pri, uint32_t pcode)
+{
+	int const pal = pcode >> 16;
+	if ((pcode & 0xffff) != 0xff00)
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+			{
+				dest[i] = source[i] + pal;
+				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+			}
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+			if ((maskptr[i] & mask) == value)
+				dest[i] = source[i] + pal;
+	}
+}
+
+// one tilemap-sized instance placed at xpos/ypos, clipped to the screen
+void draw_instance(const tilemap_model &map, uint16_t *screen, uint8_t *priority, int xpos, int ypos, uint32_t pcode)
+{
+	int const mask = 0x10, value = 0x10;
+	int x1 = std::max(xpos, 0) - xpos;
+	int x2 = std::min(xpos + MAP_SIZE, SCREEN_WIDTH) - xpos;
+	int y1 = std::max(ypos, 0) - ypos;
+	int y2 = std::min(ypos + MAP_SIZE, SCREEN_HEIGHT) - ypos;
+	if (x1 >= x2 || y1 >= y2)
+		return;
+
+	uint16_t *dest_base = screen + (y1 + ypos) * SCREEN_WIDTH + xpos;
+	uint8_t *prio_base = priority + (y1 + ypos) * SCREEN_WIDTH + xpos;
+	const uint16_t *source_base = &map.pixmap[y1 * MAP_SIZE];
+	const uint8_t *mask_base = &map.flagsmap[y1 * MAP_SIZE];
+	int const mincol = x1 / TILE_SIZE;
+	int const maxcol = (x2 + TILE_SIZE - 1) / TILE_SIZE;
+
+	int y = y1;
+	int nexty = std::min(TILE_SIZE * (y1 / TILE_SIZE) + TILE_SIZE, y2);
+	for (;;)
+	{
+		int const row = y / TILE_SIZE;
+		int x_start = x1;
+		trans_t prev_trans = WHOLLY_TRANSPARENT;
+		for (int column = mincol; column <= maxcol; column++)
+		{
+			trans_t cur_trans;
+			if (column == maxcol)
+				cur_trans = WHOLLY_TRANSPARENT;
+			else if (map.tileflags[row * COLS + column] & mask)
+				cur_trans = MASKED;
+			else
+				cur_trans = ((mask_base[column * TILE_SIZE] & mask) == value) ? WHOLLY_OPAQUE : WHOLLY_TRANSPARENT;
+			if (cur_trans == prev_trans)
+				continue;
+
+			int const x_end = std::min(std::max(column * TILE_SIZE, x1), x2);
+			if (prev_trans != WHOLLY_TRANSPARENT)
+			{
+				const uint16_t *source0 = source_base + x_start;
+				const uint8_t *mask0 = mask_base + x_start;
+				uint16_t *dest0 = dest_base + x_start;
+				uint8_t *pmap0 = prio_base + x_start;
+				for (int cury = y; cury < nexty; cury++)
+				{
+					if (prev_trans == WHOLLY_OPAQUE)
+						draw_opaque(dest0, source0, x_end - x_start, pmap0, pcode);
+					else
+						draw_masked(dest0, source0, mask0, mask, value, x_end - x_start, pmap0, pcode);
+					dest0 += SCREEN_WIDTH;
+					source0 += MAP_SIZE;
+					mask0 += MAP_SIZE;
+					pmap0 += SCREEN_WIDTH;
+				}
+			}
+			x_start = x_end;
+			prev_trans = cur_trans;
+		}
+
+		if (nexty == y2)
+			break;
+		dest_base += (nexty - y) * SCREEN_WIDTH;
+		prio_base += (nexty - y) * SCREEN_WIDTH;
+		source_base += (nexty - y) * MAP_SIZE;
+		mask_base += (nexty - y) * MAP_SIZE;
+		y = nexty;
+		nexty = std::min(nexty + TILE_SIZE, y2);
+	}
+}
+
+void BM_tilemap_draw(benchmark::State& state)
+{
+	tilemap_model const map;
+	std::vector<uint16_t> screen(SCREEN_WIDTH * SCREEN_HEIGHT);
+	std::vector<uint8_t> priority(SCREEN_WIDTH * SCREEN_HEIGHT);
+	uint32_t const pcode = state.range(0) ? 0x0002ff : 0xff00;
+	int scroll = 0;
+	while (state.KeepRunning()) {
+		// a wrapping scroll needs up to four instances to cover the screen
+		int const scrollx = scroll % MAP_SIZE, scrolly = (scroll / 2) % MAP_SIZE;
+		for (int ypos = -scrolly; ypos < SCREEN_HEIGHT; ypos += MAP_SIZE)
+			for (int xpos = -scrollx; xpos < SCREEN_WIDTH; xpos += MAP_SIZE)
+				draw_instance(map, screen.data(), priority.data(), xpos, ypos, pcode);
+		scroll += 3;
+		benchmark::DoNotOptimize(screen.data());
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * SCREEN_WIDTH * SCREEN_HEIGHT);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_tilemap_draw)->Arg(0)->Arg(1);
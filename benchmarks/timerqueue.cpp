@@ -0,0 +1,183 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+
+#include <cstdint>
+#include <vector>
+
+// Synthetic timer churn modelled on device_scheduler: a number of live
+// timers, with the earliest one repeatedly firing and being rescheduled,
+// and a random timer being adjusted in between (as a sound chip or serial
+// device would do from a memory handler).
+
+namespace {
+
+struct churn_timer
+{
+	churn_timer *next = nullptr;
+	churn_timer *prev = nullptr;
+	uint32_t heap_index = 0;
+	uint64_t sequence = 0;
+	uint64_t expire = 0;
+};
+
+class churn_random
+{
+public:
+	uint32_t next() { m_state = m_state * 1103515245 + 12345; return m_state >> 8; }
+private:
+	uint32_t m_state = 0x9d14abd7;
+};
+
+// sorted doubly-linked list, as used by the default scheduler queue
+class list_queue
+{
+public:
+	churn_timer *first() const { return m_head; }
+
+	void insert(churn_timer &timer)
+	{
+		churn_timer *prev = nullptr;
+		for (churn_timer *cur = m_head; cur; prev = cur, cur = cur->next)
+		{
+			if (cur->expire > timer.expire)
+			{
+				timer.prev = prev;
+				timer.next = cur;
+				if (prev)
+					prev->next = &timer;
+				else
+					m_head = &timer;
+				cur->prev = &timer;
+				return;
+			}
+		}
+		if (prev)
+			prev->next = &timer;
+		else
+			m_head = &timer;
+		timer.prev = prev;
+		timer.next = nullptr;
+	}
+
+	void remove(churn_timer &timer)
+	{
+		if (timer.prev)
+			timer.prev->next = timer.next;
+		else
+			m_head = timer.next;
+		if (timer.next)
+			timer.next->prev = timer.prev;
+	}
+
+private:
+	churn_timer *m_head = nullptr;
+};
+
+// binary min-heap with insertion sequence tie-break, as used by -timerqueue heap
+class heap_queue
+{
+public:
+	churn_timer *first() const { return m_heap.front(); }
+
+	void insert(churn_timer &timer)
+	{
+		timer.sequence = ++m_sequence;
+		m_heap.push_back(&timer);
+		sift_up(m_heap.size() - 1);
+	}
+
+	void remove(churn_timer &timer)
+	{
+		uint32_t const index = timer.heap_index;
+		churn_timer *const last = m_heap.back();
+		m_heap.pop_back();
+		if (last != &timer)
+		{
+			m_heap[index] = last;
+			last->heap_index = index;
+			if ((index > 0) && before(*last, *m_heap[(index - 1) >> 1]))
+				sift_up(index);
+			else
+				sift_down(index);
+		}
+	}
+
+private:
+	static bool before(churn_timer const &a, churn_timer const &b)
+	{
+		return (a.expire < b.expire) || ((a.expire == b.expire) && (a.sequence < b.sequence));
+	}
+
+	void sift_up(uint32_t index)
+	{
+		churn_timer *const timer = m_heap[index];
+		while (index > 0)
+		{
+			uint32_t const parent = (index - 1) >> 1;
+			if (!before(*timer, *m_heap[parent]))
+				break;
+			m_heap[index] = m_heap[parent];
+			m_heap[index]->heap_index = index;
+			index = parent;
+		}
+		m_heap[index] = timer;
+		timer->heap_index = index;
+	}
+
+	void sift_down(uint32_t index)
+	{
+		uint32_t const count = m_heap.size();
+		churn_timer *const timer = m_heap[index];
+		while (true)
+		{
+			uint32_t child = (index << 1) + 1;
+			if (child >= count)
+				break;
+			if (((child + 1) < count) && before(*m_heap[child + 1], *m_heap[child]))
+				child++;
+			if (!before(*m_heap[child], *timer))
+				break;
+			m_heap[index] = m_heap[child];
+			m_heap[index]->heap_index = index;
+			index = child;
+		}
+		m_heap[index] = timer;
+		timer->heap_index = index;
+	}
+
+	std::vector<churn_timer *> m_heap;
+	uint64_t m_sequence = 0;
+};
+
+template <typename Queue>
+void BM_timer_churn(benchmark::State& state)
+{
+	std::vector<churn_timer> timers(state.range(0));
+	churn_random rand;
+	Queue queue;
+	for (churn_timer &timer : timers)
+	{
+		timer.expire = rand.next() & 0xffff;
+		queue.insert(timer);
+	}
+
+	while (state.KeepRunning()) {
+		// fire the earliest timer and reschedule it one period later
+		churn_timer &fired = *queue.first();
+		queue.remove(fired);
+		uint64_t const now = fired.expire;
+		fired.expire = now + 1 + (rand.next() & 0xffff);
+		queue.insert(fired);
+
+		// adjust an arbitrary timer relative to the current time
+		churn_timer &adjusted = timers[rand.next() % timers.size()];
+		queue.remove(adjusted);
+		adjusted.expire = now + 1 + (rand.next() & 0xffff);
+		queue.insert(adjusted);
+	}
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_timer_churn, list_queue)->Range(8, 1024);
+BENCHMARK_TEMPLATE(BM_timer_churn, heap_queue)->Range(8, 1024);
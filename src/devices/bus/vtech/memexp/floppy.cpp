@@ -270,11 +270,14 @@ void vtech_floppy_controller_device::update_latching_inverter()
 	}
 
 	attotime when = m_last_latching_inverter_update_time;
+	attotime transitions[64];
 	for(;;) {
-		when = m_selected_floppy->get_next_transition(when);
-		if(when == attotime::never || when > now)
+		int const count = m_selected_floppy->get_transitions(when, now, transitions, int(std::size(transitions)));
+		if(count & 1)
+			m_latching_inverter = !m_latching_inverter;
+		if(count != int(std::size(transitions)))
 			break;
-		m_latching_inverter = !m_latching_inverter;
+		when = transitions[count - 1];
 	}
 	m_last_latching_inverter_update_time = now;
 }
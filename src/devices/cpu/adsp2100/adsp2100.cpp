@@ -1181,15 +1181,29 @@ void adsp21xx_device::execute_run()
 		return;
 	}
 
-	bool check_debugger = ((device_t::machine().debug_flags & DEBUG_FLAG_ENABLED) != 0);
-
 	check_irqs();
 
+	// pick the loop once per timeslice rather than checking for the debugger on every instruction
+	if ((device_t::machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+		execute_loop<true>();
+	else
+		execute_loop<false>();
+}
+
+
+//-------------------------------------------------
+//  execute_loop - execute instructions until the
+//  timeslice runs out
+//-------------------------------------------------
+
+template <bool Debugger>
+void adsp21xx_device::execute_loop()
+{
 	do
 	{
 		// debugging
 		m_ppc = m_pc;   // copy PC to previous PC
-		if (check_debugger)
+		if (Debugger)
 			debugger_instruction_hook(m_pc);
 
 #if ADSP_TRACK_HOTSPOTS
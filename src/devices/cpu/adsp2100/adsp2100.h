@@ -248,6 +248,7 @@ protected:
 	inline void stat_stack_push();
 	inline void stat_stack_pop();
 //  inline int condition(int c);
+	template <bool Debugger> void execute_loop();
 	int slow_condition();
 	inline void modify_address(uint32_t ireg, uint32_t mreg);
 	inline void data_write_dag1(uint32_t op, int32_t val);
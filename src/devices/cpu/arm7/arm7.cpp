@@ -39,6 +39,7 @@ TODO:
 #include "debug/debugcon.h"
 #include "debugger.h"
 
+#include <array>
 #include <cassert>
 
 #define LOG_MMU             (1U << 1)
@@ -57,6 +58,48 @@ TODO:
 #define PRINT_HAPYFSH2      (0)
 #define PRINT_CE_KERNEL     (0)
 
+namespace {
+
+// for each condition, bit n is set if it passes with NZCV (CPSR bits 31-28) equal to n
+constexpr std::array<uint16_t, 16> make_cond_table()
+{
+	std::array<uint16_t, 16> table{};
+	for (unsigned cond = 0; cond < 16; cond++)
+	{
+		for (unsigned flags = 0; flags < 16; flags++)
+		{
+			bool const n = BIT(flags, 3), z = BIT(flags, 2), c = BIT(flags, 1), v = BIT(flags, 0);
+			bool pass = false;
+			switch (cond)
+			{
+			case COND_EQ: pass = z; break;
+			case COND_NE: pass = !z; break;
+			case COND_CS: pass = c; break;
+			case COND_CC: pass = !c; break;
+			case COND_MI: pass = n; break;
+			case COND_PL: pass = !n; break;
+			case COND_VS: pass = v; break;
+			case COND_VC: pass = !v; break;
+			case COND_HI: pass = c && !z; break;
+			case COND_LS: pass = !c || z; break;
+			case COND_GE: pass = n == v; break;
+			case COND_LT: pass = n != v; break;
+			case COND_GT: pass = !z && (n == v); break;
+			case COND_LE: pass = z || (n != v); break;
+			case COND_AL: pass = true; break;
+			case COND_NV: pass = false; break;
+			}
+			if (pass)
+				table[cond] |= 1 << flags;
+		}
+	}
+	return table;
+}
+
+constexpr std::array<uint16_t, 16> s_cond_table = make_cond_table();
+
+} // anonymous namespace
+
 /* prototypes of coprocessor functions */
 void arm7_dt_r_callback(arm_state *arm, uint32_t insn, uint32_t *prn, uint32_t (*read32)(arm_state *arm, uint32_t addr));
 void arm7_dt_w_callback(arm_state *arm, uint32_t insn, uint32_t *prn, void (*write32)(arm_state *arm, uint32_t addr, uint32_t data));
@@ -1198,14 +1241,15 @@ void arm7_cpu_device::update_insn_prefetch(uint32_t curr_pc)
 	}
 
 	const uint32_t to_fetch = m_insn_prefetch_depth - m_insn_prefetch_count;
-	const uint32_t start_index = (m_insn_prefetch_depth + (m_insn_prefetch_index - to_fetch)) % m_insn_prefetch_depth;
-	//printf("need to prefetch %d instructions starting at index %d\n", to_fetch, start_index);
+	uint32_t index = m_insn_prefetch_depth + m_insn_prefetch_index - to_fetch;
+	if (index >= m_insn_prefetch_depth)
+		index -= m_insn_prefetch_depth;
+	//printf("need to prefetch %d instructions starting at index %d\n", to_fetch, index);
 
-	LOGMASKED(LOG_PREFETCH, "Need to fetch %d entries starting from index %d\n", to_fetch, start_index);
+	LOGMASKED(LOG_PREFETCH, "Need to fetch %d entries starting from index %d\n", to_fetch, index);
 	uint32_t pc = curr_pc + m_insn_prefetch_count * 4;
 	for (uint32_t i = 0; i < to_fetch; i++)
 	{
-		uint32_t index = (i + start_index) % m_insn_prefetch_depth;
 		LOGMASKED(LOG_PREFETCH, "About to get prefetch index %d from addr %08x\n", index, pc);
 		m_insn_prefetch_valid[index] = true;
 		offs_t physical_pc = pc;
@@ -1222,6 +1266,8 @@ void arm7_cpu_device::update_insn_prefetch(uint32_t curr_pc)
 		m_insn_prefetch_address[index] = pc;
 		m_insn_prefetch_count++;
 		pc += 4;
+		if (++index == m_insn_prefetch_depth)
+			index = 0;
 	}
 }
 
@@ -1231,7 +1277,8 @@ bool arm7_cpu_device::insn_fetch_thumb(uint32_t pc, uint32_t &out_insn)
 	{
 		out_insn = (uint16_t)(m_insn_prefetch_buffer[m_insn_prefetch_index] >> m_prefetch_word1_shift);
 		bool valid = m_insn_prefetch_valid[m_insn_prefetch_index];
-		m_insn_prefetch_index = (m_insn_prefetch_index + 1) % m_insn_prefetch_depth;
+		if (++m_insn_prefetch_index == m_insn_prefetch_depth)
+			m_insn_prefetch_index = 0;
 		m_insn_prefetch_count--;
 		return valid;
 	}
@@ -1245,7 +1292,8 @@ bool arm7_cpu_device::insn_fetch_arm(uint32_t pc, uint32_t &out_insn)
 	out_insn = m_insn_prefetch_buffer[m_insn_prefetch_index];
 	bool valid = m_insn_prefetch_valid[m_insn_prefetch_index];
 	LOGMASKED(LOG_PREFETCH, "Fetched op %08x for PC %08x with %s entry from %08x\n", out_insn, pc, valid ? "valid" : "invalid", m_insn_prefetch_address[m_insn_prefetch_index]);
-	m_insn_prefetch_index = (m_insn_prefetch_index + 1) % m_insn_prefetch_depth;
+	if (++m_insn_prefetch_index == m_insn_prefetch_depth)
+		m_insn_prefetch_index = 0;
 	m_insn_prefetch_count--;
 	return valid;
 }
@@ -1506,74 +1554,15 @@ void arm7_cpu_device::execute_run()
 
 			int op_offset = 0;
 			/* process condition codes for this instruction */
-			if ((insn >> INSN_COND_SHIFT) != COND_AL)
+			uint32_t const cond = insn >> INSN_COND_SHIFT;
+			if (cond == COND_NV)
 			{
-				switch (insn >> INSN_COND_SHIFT)
-				{
-					case COND_EQ:
-						if (Z_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_NE:
-						if (Z_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_CS:
-						if (C_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_CC:
-						if (C_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_MI:
-						if (N_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_PL:
-						if (N_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_VS:
-						if (V_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_VC:
-						if (V_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_HI:
-						if (C_IS_CLEAR(m_r[eCPSR]) || Z_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LS:
-						if (C_IS_SET(m_r[eCPSR]) && Z_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_GE:
-						if (!(m_r[eCPSR] & N_MASK) != !(m_r[eCPSR] & V_MASK)) /* Use x ^ (x >> ...) method */
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LT:
-						if (!(m_r[eCPSR] & N_MASK) == !(m_r[eCPSR] & V_MASK))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_GT:
-						if (Z_IS_SET(m_r[eCPSR]) || (!(m_r[eCPSR] & N_MASK) != !(m_r[eCPSR] & V_MASK)))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LE:
-						if (Z_IS_CLEAR(m_r[eCPSR]) && (!(m_r[eCPSR] & N_MASK) == !(m_r[eCPSR] & V_MASK)))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_NV:
-						if (m_archRev < 5)
-						  { UNEXECUTED();  goto skip_exec; }
-						else
-							op_offset = 0x10;
-						break;
-				}
+				if (m_archRev < 5)
+					{ UNEXECUTED();  goto skip_exec; }
+				op_offset = 0x10;
 			}
+			else if (!BIT(s_cond_table[cond], m_r[eCPSR] >> 28))
+				{ UNEXECUTED();  goto skip_exec; }
 			/*******************************************************************/
 			/* If we got here - condition satisfied, so decode the instruction */
 			/*******************************************************************/
@@ -17,6 +17,8 @@
 #include "clipper.h"
 #include "clipperd.h"
 
+#include "cpu/hostfp.h"
+
 #define LOG_EXCEPTION (1U << 1)
 #define LOG_SYSCALLS  (1U << 2)
 
@@ -531,22 +533,22 @@ void clipper_device::execute_instruction()
 
 	case 0x20:
 		// adds: add single floating
-		set_fp(R2, f32_add(get_fp32(R2), get_fp32(R1)), F_IVUX);
+		set_fp(R2, hostfp::f32_add(get_fp32(R2), get_fp32(R1)), F_IVUX);
 		// TRAPS: F_IVUX
 		break;
 	case 0x21:
 		// subs: subtract single floating
-		set_fp(R2, f32_sub(get_fp32(R2), get_fp32(R1)), F_IVUX);
+		set_fp(R2, hostfp::f32_sub(get_fp32(R2), get_fp32(R1)), F_IVUX);
 		// TRAPS: F_IVUX
 		break;
 	case 0x22:
 		// addd: add double floating
-		set_fp(R2, f64_add(get_fp64(R2), get_fp64(R1)), F_IVUX);
+		set_fp(R2, hostfp::f64_add(get_fp64(R2), get_fp64(R1)), F_IVUX);
 		// TRAPS: F_IVUX
 		break;
 	case 0x23:
 		// subd: subtract double floating
-		set_fp(R2, f64_sub(get_fp64(R2), get_fp64(R1)), F_IVUX);
+		set_fp(R2, hostfp::f64_sub(get_fp64(R2), get_fp64(R1)), F_IVUX);
 		// TRAPS: F_IVUX
 		break;
 	case 0x24:
@@ -575,22 +577,22 @@ void clipper_device::execute_instruction()
 		break;
 	case 0x28:
 		// muls: multiply single floating
-		set_fp(R2, f32_mul(get_fp32(R2), get_fp32(R1)), F_IVUX);
+		set_fp(R2, hostfp::f32_mul(get_fp32(R2), get_fp32(R1)), F_IVUX);
 		// TRAPS: F_IVUX
 		break;
 	case 0x29:
 		// divs: divide single floating
-		set_fp(R2, f32_div(get_fp32(R2), get_fp32(R1)), F_IVDUX);
+		set_fp(R2, hostfp::f32_div(get_fp32(R2), get_fp32(R1)), F_IVDUX);
 		// TRAPS: F_IVDUX
 		break;
 	case 0x2a:
 		// muld: multiply double floating
-		set_fp(R2, f64_mul(get_fp64(R2), get_fp64(R1)), F_IVUX);
+		set_fp(R2, hostfp::f64_mul(get_fp64(R2), get_fp64(R1)), F_IVUX);
 		// TRAPS: F_IVUX
 		break;
 	case 0x2b:
 		// divd: divide double floating
-		set_fp(R2, f64_div(get_fp64(R2), get_fp64(R1)), F_IVDUX);
+		set_fp(R2, hostfp::f64_div(get_fp64(R2), get_fp64(R1)), F_IVDUX);
 		// TRAPS: F_IVDUX
 		break;
 	case 0x2c:
@@ -1414,7 +1416,7 @@ void clipper_device::execute_instruction()
 			 * correct exception flags are set.
 			 */
 			// scalbs: scale by, single floating
-			set_fp(m_info.macro & 0xf, f32_mul(get_fp32(m_info.macro & 0xf),
+			set_fp(m_info.macro & 0xf, hostfp::f32_mul(get_fp32(m_info.macro & 0xf),
 				((s32(m_r[(m_info.macro >> 4) & 0xf]) > -127 && s32(m_r[(m_info.macro >> 4) & 0xf]) < 128)
 					? float32_t{ u32(s32(m_r[(m_info.macro >> 4) & 0xf]) + 127) << 23 }
 					: float32_t{ ~u32(0) })), F_IVUX);
@@ -1422,7 +1424,7 @@ void clipper_device::execute_instruction()
 			break;
 		case 0x3d:
 			// scalbd: scale by, double floating
-			set_fp(m_info.macro & 0xf, f64_mul(get_fp64(m_info.macro & 0xf),
+			set_fp(m_info.macro & 0xf, hostfp::f64_mul(get_fp64(m_info.macro & 0xf),
 				(s32(m_r[(m_info.macro >> 4) & 0xf]) > -1023 && s32(m_r[(m_info.macro >> 4) & 0xf]) < 1024)
 					? float64_t{ u64(s32(m_r[(m_info.macro >> 4) & 0xf]) + 1023) << 52 }
 					: float64_t{ ~u64(0) }), F_IVUX);
@@ -2361,7 +2361,13 @@ void drcbe_arm64::op_save(a64::Assembler &a, const uml::instruction &inst)
 	int regoffs = offsetof(drcuml_machine_state, r);
 	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
 	{
-		if (int_register_map[regnum] != 0)
+		if ((int_register_map[regnum] != 0) && ((regnum + 1) < std::size(m_state.r)) && (int_register_map[regnum + 1] != 0))
+		{
+			// store adjacent mapped registers as a pair
+			a.stp(a64::Gp::fromTypeAndId(RegType::kARM_GpX, int_register_map[regnum]), a64::Gp::fromTypeAndId(RegType::kARM_GpX, int_register_map[regnum + 1]), arm::Mem(membase, regoffs + (8 * regnum)));
+			regnum++;
+		}
+		else if (int_register_map[regnum] != 0)
 		{
 			a.str(a64::Gp::fromTypeAndId(RegType::kARM_GpX, int_register_map[regnum]), arm::Mem(membase, regoffs + (8 * regnum)));
 		}
@@ -2375,7 +2381,12 @@ void drcbe_arm64::op_save(a64::Assembler &a, const uml::instruction &inst)
 	regoffs = offsetof(drcuml_machine_state, f);
 	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
 	{
-		if (float_register_map[regnum] != 0)
+		if ((float_register_map[regnum] != 0) && ((regnum + 1) < std::size(m_state.f)) && (float_register_map[regnum + 1] != 0))
+		{
+			a.stp(a64::Vec::fromTypeAndId(RegType::kARM_VecD, float_register_map[regnum]), a64::Vec::fromTypeAndId(RegType::kARM_VecD, float_register_map[regnum + 1]), arm::Mem(membase, regoffs + (8 * regnum)));
+			regnum++;
+		}
+		else if (float_register_map[regnum] != 0)
 		{
 			a.str(a64::Vec::fromTypeAndId(RegType::kARM_VecD, float_register_map[regnum]), arm::Mem(membase, regoffs + (8 * regnum)));
 		}
@@ -2401,7 +2412,13 @@ void drcbe_arm64::op_restore(a64::Assembler &a, const uml::instruction &inst)
 	int regoffs = offsetof(drcuml_machine_state, r);
 	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
 	{
-		if (int_register_map[regnum] != 0)
+		if ((int_register_map[regnum] != 0) && ((regnum + 1) < std::size(m_state.r)) && (int_register_map[regnum + 1] != 0))
+		{
+			// load adjacent mapped registers as a pair
+			a.ldp(a64::Gp::fromTypeAndId(RegType::kARM_GpX, int_register_map[regnum]), a64::Gp::fromTypeAndId(RegType::kARM_GpX, int_register_map[regnum + 1]), arm::Mem(membase, regoffs + (8 * regnum)));
+			regnum++;
+		}
+		else if (int_register_map[regnum] != 0)
 		{
 			a.ldr(a64::Gp::fromTypeAndId(RegType::kARM_GpX, int_register_map[regnum]), arm::Mem(membase, regoffs + (8 * regnum)));
 		}
@@ -2415,7 +2432,12 @@ void drcbe_arm64::op_restore(a64::Assembler &a, const uml::instruction &inst)
 	regoffs = offsetof(drcuml_machine_state, f);
 	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
 	{
-		if (float_register_map[regnum] != 0)
+		if ((float_register_map[regnum] != 0) && ((regnum + 1) < std::size(m_state.f)) && (float_register_map[regnum + 1] != 0))
+		{
+			a.ldp(a64::Vec::fromTypeAndId(RegType::kARM_VecD, float_register_map[regnum]), a64::Vec::fromTypeAndId(RegType::kARM_VecD, float_register_map[regnum + 1]), arm::Mem(membase, regoffs + (8 * regnum)));
+			regnum++;
+		}
+		else if (float_register_map[regnum] != 0)
 		{
 			a.ldr(a64::Vec::fromTypeAndId(RegType::kARM_VecD, float_register_map[regnum]), arm::Mem(membase, regoffs + (8 * regnum)));
 		}
@@ -47,6 +47,7 @@ drc_hash_table::drc_hash_table(drc_cache &cache, uint32_t modes, uint8_t addrbit
 	m_emptyl1(nullptr),
 	m_emptyl2(nullptr)
 {
+	cache.set_evict_callback(drc_evict_delegate(&drc_hash_table::evict, this));
 	reset();
 }
 
@@ -80,6 +81,8 @@ bool drc_hash_table::reset()
 	for (int modenum = 0; modenum < m_modes; modenum++)
 		m_base[modenum] = m_emptyl1;
 
+	// all linked code is gone with the cache
+	m_links.clear();
 	return true;
 }
 
@@ -155,6 +158,40 @@ void drc_hash_table::set_default_codeptr(drccodeptr nocodeptr)
 }
 
 
+//-------------------------------------------------
+//  evict - point entries for code in the given
+//  range back at the default codeptr
+//-------------------------------------------------
+
+void drc_hash_table::evict(drccodeptr start, drccodeptr end)
+{
+	// forget direct jumps in the evicted code
+	for (auto it = m_links.begin(); it != m_links.end(); )
+	{
+		std::vector<link_site> &sites = it->second;
+		sites.erase(std::remove_if(sites.begin(), sites.end(), [start, end] (link_site const &link) { return (link.site >= start) && (link.site < end); }), sites.end());
+		if (sites.empty())
+			it = m_links.erase(it);
+		else
+			++it;
+	}
+
+	for (int modenum = 0; modenum < m_modes; modenum++)
+		if (m_base[modenum] != m_emptyl1)
+			for (int l1entry = 0; l1entry < (1 << m_l1bits); l1entry++)
+				if (m_base[modenum][l1entry] != m_emptyl2)
+					for (int l2entry = 0; l2entry < (1 << m_l2bits); l2entry++)
+					{
+						drccodeptr &code = m_base[modenum][l1entry][l2entry];
+						if ((code >= start) && (code < end))
+						{
+							code = m_nocodeptr;
+							relink(&code);
+						}
+					}
+}
+
+
 //-------------------------------------------------
 //  set_codeptr - set the codeptr for the given
 //  mode/pc
@@ -187,10 +224,53 @@ bool drc_hash_table::set_codeptr(uint32_t mode, uint32_t pc, drccodeptr code)
 	// set the new entry
 	uint32_t l2 = (pc >> m_l2shift) & m_l2mask;
 	m_base[mode][l1][l2] = code;
+	relink(&m_base[mode][l1][l2]);
 	return true;
 }
 
 
+//-------------------------------------------------
+//  add_link - register a patchable direct jump
+//  to the code for the given mode/pc; the slot
+//  must already be allocated
+//-------------------------------------------------
+
+void drc_hash_table::add_link(uint32_t mode, uint32_t pc, drccodeptr site, drccodeptr fallback)
+{
+	assert(mode < m_modes);
+	assert(m_patch);
+	drccodeptr const *const entry = slot(mode, pc);
+	assert((m_base[mode] != m_emptyl1) && (m_base[mode][(pc >> m_l1shift) & m_l1mask] != m_emptyl2));
+
+	m_links[entry].emplace_back(link_site{ site, fallback });
+	drccodeptr const code = *entry;
+	m_cache.codegen_init();
+	m_patch(site, ((code != nullptr) && (code != m_nocodeptr)) ? code : fallback);
+}
+
+
+//-------------------------------------------------
+//  relink - point the direct jumps for a hash
+//  table entry at its current code
+//-------------------------------------------------
+
+void drc_hash_table::relink(drccodeptr const *entry)
+{
+	if (m_links.empty())
+		return;
+	auto const found = m_links.find(entry);
+	if (found == m_links.end())
+		return;
+
+	// entries without code go back through the hash table lookup
+	drccodeptr const code = *entry;
+	bool const linked = (code != nullptr) && (code != m_nocodeptr);
+	m_cache.codegen_init();
+	for (link_site const &link : found->second)
+		m_patch(link.site, linked ? code : link.fallback);
+}
+
+
 
 //**************************************************************************
 //  DRC MAP VARIABLES
@@ -360,7 +440,7 @@ uint32_t drc_map_variables::get_value(drccodeptr codebase, uint32_t mapvar) cons
 
 	// get an aligned pointer to start scanning
 	auto curscan = reinterpret_cast<uint64_t const *>((uintptr_t(codebase) | 7) + 1);
-	auto const endscan = reinterpret_cast<uint64_t const *>(m_cache.top());
+	auto const endscan = reinterpret_cast<uint64_t const *>(m_cache.code_end(codebase));
 
 	// look for the signature
 	while ((curscan < endscan) && (*curscan++ != m_uniquevalue)) { }
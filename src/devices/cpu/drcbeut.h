@@ -17,6 +17,7 @@
 
 #include <cassert>
 #include <list>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,9 @@ namespace drc {
 
 // ======================> drc_hash_table
 
+// callback to point a direct jump at a new target
+typedef delegate<void (drccodeptr, drccodeptr)> drc_link_patch_delegate;
+
 // common hash table management
 class drc_hash_table
 {
@@ -49,6 +53,7 @@ public:
 	// set up and configuration
 	bool reset();
 	void set_default_codeptr(drccodeptr code);
+	void evict(drccodeptr start, drccodeptr end);
 
 	// block begin/end
 	void block_begin(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst);
@@ -59,7 +64,21 @@ public:
 	drccodeptr get_codeptr(uint32_t mode, uint32_t pc) const noexcept { assert(mode < m_modes); return m_base[mode][(pc >> m_l1shift) & m_l1mask][(pc >> m_l2shift) & m_l2mask]; }
 	bool code_exists(uint32_t mode, uint32_t pc) const noexcept { return get_codeptr(mode, pc) != m_nocodeptr; }
 
+	// direct block linking
+	void set_link_patcher(drc_link_patch_delegate &&patch) { m_patch = std::move(patch); }
+	void add_link(uint32_t mode, uint32_t pc, drccodeptr site, drccodeptr fallback);
+
 private:
+	struct link_site
+	{
+		drccodeptr      site;               // patchable jump
+		drccodeptr      fallback;           // hash table lookup used while unlinked
+	};
+	using link_map = std::unordered_map<drccodeptr const *, std::vector<link_site>>;
+
+	drccodeptr *slot(uint32_t mode, uint32_t pc) const noexcept { return &m_base[mode][(pc >> m_l1shift) & m_l1mask][(pc >> m_l2shift) & m_l2mask]; }
+	void relink(drccodeptr const *entry);
+
 	// internal state
 	drc_cache &     m_cache;                // cache where allocations come from
 	uint32_t        m_modes;                // number of modes supported
@@ -76,6 +95,9 @@ private:
 	drccodeptr ***  m_base;                 // pointer to the l1 table for each mode
 	drccodeptr **   m_emptyl1;              // pointer to empty l1 hash table
 	drccodeptr *    m_emptyl2;              // pointer to empty l2 hash table
+
+	drc_link_patch_delegate m_patch;        // backend callback to patch a direct jump
+	link_map        m_links;                // direct jumps for each hash table entry
 };
 
 
@@ -619,6 +619,15 @@ private:
 	void calculate_status_flags_mul_low(asmjit::x86::Assembler &a, uint32_t instsize, asmjit::x86::Gp const &lo);
 
 	size_t emit(asmjit::CodeHolder &ch);
+	void patch_link(drccodeptr site, drccodeptr target);
+
+	// direct jump emitted for a fixed HASHJMP, registered once the block is in the cache
+	struct link_request
+	{
+		uint32_t    mode;
+		uint32_t    pc;
+		size_t      offset;
+	};
 
 	// internal state
 	drc_hash_table          m_hash;                 // hash table state
@@ -636,10 +645,12 @@ private:
 	x86code *               m_endofblock;           // end of block handler
 
 	near_state &            m_near;
+	bool const              m_avx;                                                      // generate VEX-encoded scalar FP code
 
 	resolved_member_function m_debug_cpu_instruction_hook;
 	resolved_member_function m_drcmap_get_value;
 	std::vector<memory_accessors> m_memory_accessors;
+	std::vector<link_request> m_links;              // direct jumps in the block being generated
 
 	// globals
 	static const opcode_table_entry s_opcode_table_source[];
@@ -1032,6 +1043,7 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, u
 	, m_nocode(nullptr)
 	, m_endofblock(nullptr)
 	, m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
+	, m_avx(!device.machine().options().drc_baseline() && CpuInfo::host().features().x86().hasAVX())
 {
 	// build up necessary arrays
 	static const uint32_t sse_control[4] =
@@ -1080,6 +1092,9 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, u
 		m_near.flagsunmap[entry] = flags;
 	}
 
+	// let the hash table patch our direct jumps
+	m_hash.set_link_patcher(drc_link_patch_delegate(&drcbe_x64::patch_link, this));
+
 	// resolve the actual addresses of member functions we need to call
 	m_drcmap_get_value.set(m_map, &drc_map_variables::get_value);
 	if (!m_drcmap_get_value)
@@ -1287,6 +1302,7 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	// tell all of our utility objects that a block is beginning
 	m_hash.block_begin(block, instlist, numinst);
 	m_map.block_begin(block);
+	m_links.clear();
 
 	// compute the base by aligning the cache top to a cache line
 	auto [err, linesize] = osd_get_cache_line_size();
@@ -1367,6 +1383,10 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	if (!bytes)
 		block.abort();
 
+	// now that the code is in place, link the direct jumps to their targets
+	for (link_request const &link : m_links)
+		m_hash.add_link(link.mode, link.pc, dst + link.offset, dst + link.offset + 5);
+
 	// log it
 	if (m_log)
 		x86log_disasm_code_range(m_log, (blockname.empty()) ? "Unknown block" : blockname.c_str(), dst, dst + bytes);
@@ -1377,6 +1397,22 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 }
 
 
+//-------------------------------------------------
+//  patch_link - point a direct jump emitted for
+//  a fixed HASHJMP at a new target
+//-------------------------------------------------
+
+void drcbe_x64::patch_link(drccodeptr site, drccodeptr target)
+{
+	// the code cache is far smaller than the reach of a rel32 jump
+	assert(site[0] == 0xe9);
+	int64_t const delta = target - (site + 5);
+	assert(delta == int32_t(delta));
+	int32_t const rel = int32_t(delta);
+	memcpy(site + 1, &rel, sizeof(rel));
+}
+
+
 //-------------------------------------------------
 //  hash_exists - return true if the given mode/pc
 //  exists in the hash table
@@ -2088,10 +2124,15 @@ void drcbe_x64::op_hashjmp(Assembler &a, const instruction &inst)
 	{
 		if (pcp.is_immediate())
 		{
-			// a straight immediate jump is direct, though we need the PC in EAX in case of failure
+			// a straight immediate jump is direct, though we need the PC in EAX in case of failure;
+			// the hash table patches the rel32 jump to the target block while it exists
 			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
 			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			Label lookup = a.newLabel();
 			a.short_().lea(Gpq(REG_PARAM1), ptr(nocode));                               // lea   rcx,[rip+nocode]
+			m_links.emplace_back(link_request{ uint32_t(modep.immediate()), uint32_t(pcp.immediate()), a.offset() });
+			a.long_().jmp(lookup);                                                      // jmp   lookup (patched)
+			a.bind(lookup);
 			a.jmp(MABS(&m_hash.base()[modep.immediate()][l1val][l2val]));               // jmp   hash[modep][l1val][l2val]
 		}
 		else
@@ -5900,22 +5941,42 @@ void drcbe_x64::op_fadd(Assembler &a, const instruction &inst)
 	// 32-bit form
 	if (inst.size() == 4)
 	{
-		movss_r128_p32(a, dstreg, src1p);                                               // movss dstreg,src1p
-		if (src2p.is_memory())
-			a.addss(dstreg, MABS(src2p.memory()));                                      // addss dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.addss(dstreg, Xmm(src2p.freg()));                                         // addss dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vaddss(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vaddss dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vaddss(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vaddss dstreg,src1p,src2p
+		}
+		else
+		{
+			movss_r128_p32(a, dstreg, src1p);                                           // movss dstreg,src1p
+			if (src2p.is_memory())
+				a.addss(dstreg, MABS(src2p.memory()));                                  // addss dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.addss(dstreg, Xmm(src2p.freg()));                                     // addss dstreg,src2p
+		}
 		movss_p32_r128(a, dstp, dstreg);                                                // movss dstp,dstreg
 	}
 
 	// 64-bit form
 	else if (inst.size() == 8)
 	{
-		movsd_r128_p64(a, dstreg, src1p);                                               // movsd dstreg,src1p
-		if (src2p.is_memory())
-			a.addsd(dstreg, MABS(src2p.memory()));                                      // addsd dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.addsd(dstreg, Xmm(src2p.freg()));                                         // addsd dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vaddsd(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vaddsd dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vaddsd(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vaddsd dstreg,src1p,src2p
+		}
+		else
+		{
+			movsd_r128_p64(a, dstreg, src1p);                                           // movsd dstreg,src1p
+			if (src2p.is_memory())
+				a.addsd(dstreg, MABS(src2p.memory()));                                  // addsd dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.addsd(dstreg, Xmm(src2p.freg()));                                     // addsd dstreg,src2p
+		}
 		movsd_p64_r128(a, dstp, dstreg);                                                // movsd dstp,dstreg
 	}
 }
@@ -5943,22 +6004,42 @@ void drcbe_x64::op_fsub(Assembler &a, const instruction &inst)
 	// 32-bit form
 	if (inst.size() == 4)
 	{
-		movss_r128_p32(a, dstreg, src1p);                                               // movss dstreg,src1p
-		if (src2p.is_memory())
-			a.subss(dstreg, MABS(src2p.memory()));                                      // subss dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.subss(dstreg, Xmm(src2p.freg()));                                         // subss dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vsubss(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vsubss dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vsubss(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vsubss dstreg,src1p,src2p
+		}
+		else
+		{
+			movss_r128_p32(a, dstreg, src1p);                                           // movss dstreg,src1p
+			if (src2p.is_memory())
+				a.subss(dstreg, MABS(src2p.memory()));                                  // subss dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.subss(dstreg, Xmm(src2p.freg()));                                     // subss dstreg,src2p
+		}
 		movss_p32_r128(a, dstp, dstreg);                                                // movss dstp,dstreg
 	}
 
 	// 64-bit form
 	else if (inst.size() == 8)
 	{
-		movsd_r128_p64(a, dstreg, src1p);                                               // movsd dstreg,src1p
-		if (src2p.is_memory())
-			a.subsd(dstreg, MABS(src2p.memory()));                                      // subsd dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.subsd(dstreg, Xmm(src2p.freg()));                                         // subsd dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vsubsd(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vsubsd dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vsubsd(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vsubsd dstreg,src1p,src2p
+		}
+		else
+		{
+			movsd_r128_p64(a, dstreg, src1p);                                           // movsd dstreg,src1p
+			if (src2p.is_memory())
+				a.subsd(dstreg, MABS(src2p.memory()));                                  // subsd dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.subsd(dstreg, Xmm(src2p.freg()));                                     // subsd dstreg,src2p
+		}
 		movsd_p64_r128(a, dstp, dstreg);                                                // movsd dstp,dstreg
 	}
 }
@@ -6026,22 +6107,42 @@ void drcbe_x64::op_fmul(Assembler &a, const instruction &inst)
 	// 32-bit form
 	if (inst.size() == 4)
 	{
-		movss_r128_p32(a, dstreg, src1p);                                               // movss dstreg,src1p
-		if (src2p.is_memory())
-			a.mulss(dstreg, MABS(src2p.memory()));                                      // mulss dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.mulss(dstreg, Xmm(src2p.freg()));                                         // mulss dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vmulss(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vmulss dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vmulss(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vmulss dstreg,src1p,src2p
+		}
+		else
+		{
+			movss_r128_p32(a, dstreg, src1p);                                           // movss dstreg,src1p
+			if (src2p.is_memory())
+				a.mulss(dstreg, MABS(src2p.memory()));                                  // mulss dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.mulss(dstreg, Xmm(src2p.freg()));                                     // mulss dstreg,src2p
+		}
 		movss_p32_r128(a, dstp, dstreg);                                                // movss dstp,dstreg
 	}
 
 	// 64-bit form
 	else if (inst.size() == 8)
 	{
-		movsd_r128_p64(a, dstreg, src1p);                                               // movsd dstreg,src1p
-		if (src2p.is_memory())
-			a.mulsd(dstreg, MABS(src2p.memory()));                                      // mulsd dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.mulsd(dstreg, Xmm(src2p.freg()));                                         // mulsd dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vmulsd(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vmulsd dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vmulsd(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vmulsd dstreg,src1p,src2p
+		}
+		else
+		{
+			movsd_r128_p64(a, dstreg, src1p);                                           // movsd dstreg,src1p
+			if (src2p.is_memory())
+				a.mulsd(dstreg, MABS(src2p.memory()));                                  // mulsd dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.mulsd(dstreg, Xmm(src2p.freg()));                                     // mulsd dstreg,src2p
+		}
 		movsd_p64_r128(a, dstp, dstreg);                                                // movsd dstp,dstreg
 	}
 }
@@ -6069,22 +6170,42 @@ void drcbe_x64::op_fdiv(Assembler &a, const instruction &inst)
 	// 32-bit form
 	if (inst.size() == 4)
 	{
-		movss_r128_p32(a, dstreg, src1p);                                               // movss dstreg,src1p
-		if (src2p.is_memory())
-			a.divss(dstreg, MABS(src2p.memory()));                                      // divss dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.divss(dstreg, Xmm(src2p.freg()));                                         // divss dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vdivss(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vdivss dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vdivss(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vdivss dstreg,src1p,src2p
+		}
+		else
+		{
+			movss_r128_p32(a, dstreg, src1p);                                           // movss dstreg,src1p
+			if (src2p.is_memory())
+				a.divss(dstreg, MABS(src2p.memory()));                                  // divss dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.divss(dstreg, Xmm(src2p.freg()));                                     // divss dstreg,src2p
+		}
 		movss_p32_r128(a, dstp, dstreg);                                                // movss dstp,dstreg
 	}
 
 	// 64-bit form
 	else if (inst.size() == 8)
 	{
-		movsd_r128_p64(a, dstreg, src1p);                                               // movsd dstreg,src1p
-		if (src2p.is_memory())
-			a.divsd(dstreg, MABS(src2p.memory()));                                      // divsd dstreg,[src2p]
-		else if (src2p.is_float_register())
-			a.divsd(dstreg, Xmm(src2p.freg()));                                         // divsd dstreg,src2p
+		if (m_avx && src1p.is_float_register())
+		{
+			if (src2p.is_memory())
+				a.vdivsd(dstreg, Xmm(src1p.freg()), MABS(src2p.memory()));              // vdivsd dstreg,src1p,[src2p]
+			else if (src2p.is_float_register())
+				a.vdivsd(dstreg, Xmm(src1p.freg()), Xmm(src2p.freg()));                 // vdivsd dstreg,src1p,src2p
+		}
+		else
+		{
+			movsd_r128_p64(a, dstreg, src1p);                                           // movsd dstreg,src1p
+			if (src2p.is_memory())
+				a.divsd(dstreg, MABS(src2p.memory()));                                  // divsd dstreg,[src2p]
+			else if (src2p.is_float_register())
+				a.divsd(dstreg, Xmm(src2p.freg()));                                     // divsd dstreg,src2p
+		}
 		movsd_p64_r128(a, dstp, dstreg);                                                // movsd dstp,dstreg
 	}
 }
@@ -38,8 +38,8 @@ template <typename T, typename U> constexpr T *ALIGN_PTR_DOWN(T *p, U align)
 //  drc_cache - constructor
 //-------------------------------------------------
 
-drc_cache::drc_cache(size_t bytes) :
-	m_cache({ NEAR_CACHE_SIZE, bytes - NEAR_CACHE_SIZE }, osd::virtual_memory_allocation::READ_WRITE_EXECUTE),
+drc_cache::drc_cache(size_t bytes, bool large_pages) :
+	m_cache({ NEAR_CACHE_SIZE, bytes - NEAR_CACHE_SIZE }, osd::virtual_memory_allocation::READ_WRITE_EXECUTE | (large_pages ? osd::virtual_memory_allocation::LARGE_PAGES : 0U)),
 	m_near(reinterpret_cast<drccodeptr>(m_cache.get())),
 	m_neartop(m_near),
 	m_base(ALIGN_PTR_UP(m_near + NEAR_CACHE_SIZE, m_cache.page_size())),
@@ -49,7 +49,19 @@ drc_cache::drc_cache(size_t bytes) :
 	m_codegen(nullptr),
 	m_size(m_cache.size()),
 	m_executable(false),
-	m_rwx(false)
+	m_rwx(false),
+	m_segcount(0),
+	m_cursegment(0),
+	m_segsize(0),
+	m_pintop(nullptr),
+	m_pinend(nullptr),
+	m_segbase(nullptr),
+	m_segend(nullptr),
+	m_savedtop(nullptr),
+	m_pinned(false),
+	m_flushes(0),
+	m_evictions(0),
+	m_generated(0)
 {
 	// alignment and page size must be powers of two, cache must be page-aligned
 	assert(!(CACHE_ALIGNMENT & (CACHE_ALIGNMENT - 1)));
@@ -103,6 +115,11 @@ void drc_cache::flush()
 	// just reset the top back to the base and re-seed
 	m_top = m_base;
 	codegen_init();
+
+	// the next block with a HASH starts a new set of segments
+	m_segbase = nullptr;
+	m_pinned = false;
+	m_flushes++;
 }
 
 
@@ -130,7 +147,7 @@ void *drc_cache::alloc(size_t bytes)
 	// if no space, we just fail
 	drccodeptr const ptr = ALIGN_PTR_DOWN(m_end - bytes, CACHE_ALIGNMENT);
 	drccodeptr const limit = ALIGN_PTR_DOWN(ptr, m_cache.page_size());
-	if (m_top > limit)
+	if ((segmented() ? m_segend : m_top) > limit)
 		return nullptr;
 
 	// otherwise update the end of the cache
@@ -182,9 +199,21 @@ void *drc_cache::alloc_temporary(size_t bytes)
 	// can't allocate in the middle of codegen
 	assert(!m_codegen);
 
+	// hash tables must survive evictions, so they go in the pinned area
+	if (segmented() && !m_pinned)
+	{
+		drccodeptr const ptr = m_pintop;
+		if ((ptr + bytes) > m_pinend)
+			return nullptr;
+
+		codegen_init();
+		m_pintop = ALIGN_PTR_UP(ptr + bytes, CACHE_ALIGNMENT);
+		return ptr;
+	}
+
 	// if no space, we just fail
 	drccodeptr const ptr = m_top;
-	if ((ptr + bytes) > m_limit)
+	if ((ptr + bytes) > code_limit())
 		return nullptr;
 
 	// otherwise, update the cache top
@@ -231,7 +260,7 @@ void drc_cache::codegen_complete()
 	if (!m_executable)
 	{
 		if (!m_rwx)
-			m_cache.set_access(m_base - m_near, ALIGN_PTR_UP(m_top, m_cache.page_size()) - m_base, osd::virtual_memory_allocation::READ_EXECUTE);
+			m_cache.set_access(m_base - m_near, ALIGN_PTR_UP(segmented() ? m_segend : m_top, m_cache.page_size()) - m_base, osd::virtual_memory_allocation::READ_EXECUTE);
 		m_executable = true;
 	}
 }
@@ -248,7 +277,7 @@ drccodeptr *drc_cache::begin_codegen(uint32_t reserve_bytes)
 	assert(m_oob_list.empty());
 
 	// if no space, we just fail
-	if ((m_top + reserve_bytes) > m_limit)
+	if ((m_top + reserve_bytes) > code_limit())
 		return nullptr;
 
 	// otherwise, return a pointer to the cache top
@@ -279,6 +308,7 @@ drccodeptr drc_cache::end_codegen()
 
 	// update the cache top
 	osd::invalidate_instruction_cache(m_codegen, m_top - m_codegen);
+	m_generated += m_top - m_codegen;
 	m_top = ALIGN_PTR_UP(m_top, CACHE_ALIGNMENT);
 	m_codegen = nullptr;
 
@@ -312,3 +342,150 @@ void drc_cache::request_oob_codegen(drc_oob_delegate &&callback, void *param1, v
 	oob->m_param1 = param1;
 	oob->m_param2 = param2;
 }
+
+
+//-------------------------------------------------
+//  code_end - return the end of the code that
+//  was generated contiguously with the given
+//  pointer
+//-------------------------------------------------
+
+drccodeptr drc_cache::code_end(const void *ptr) const
+{
+	if (!segmented())
+		return m_top;
+
+	// static code is contiguous with the pinned area
+	drccodeptr const code = drccodeptr(ptr);
+	if (code < m_pinend)
+		return m_pinned ? m_top : m_pintop;
+
+	uint32_t const segment = (code - m_segbase) / m_segsize;
+	if (segment == m_cursegment)
+		return m_pinned ? m_savedtop : m_top;
+	return m_segtop[segment];
+}
+
+
+//-------------------------------------------------
+//  prepare_block - choose where the next block
+//  goes; pinned blocks (static code) survive
+//  evictions
+//-------------------------------------------------
+
+void drc_cache::prepare_block(bool pinned)
+{
+	assert(!m_codegen);
+	assert(!m_pinned);
+
+	if (!m_segcount)
+		return;
+
+	// the first block that can be evicted ends the static code
+	if (!segmented())
+	{
+		if (pinned)
+			return;
+		start_segments();
+		if (!segmented())
+			return;
+	}
+
+	if (pinned)
+	{
+		// generate into the pinned area until finish_block
+		m_savedtop = m_top;
+		m_top = m_pintop;
+		m_pinned = true;
+	}
+	else if ((code_limit() - m_top) < SEGMENT_SLACK)
+	{
+		next_segment();
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_block - return to the segments after
+//  generating a pinned block
+//-------------------------------------------------
+
+void drc_cache::finish_block()
+{
+	if (m_pinned)
+	{
+		m_pintop = m_top;
+		m_top = m_savedtop;
+		m_pinned = false;
+	}
+}
+
+
+//-------------------------------------------------
+//  code_limit - return the end of the area that
+//  code is currently generated into
+//-------------------------------------------------
+
+drccodeptr drc_cache::code_limit() const
+{
+	if (!segmented())
+		return m_limit;
+	else if (m_pinned)
+		return m_pinend;
+	else
+		return m_segbase + (m_cursegment + 1) * m_segsize;
+}
+
+
+//-------------------------------------------------
+//  start_segments - split the free part of the
+//  cache into the pinned area and the segments
+//-------------------------------------------------
+
+void drc_cache::start_segments()
+{
+	// keep some room for permanent allocations, and an eighth for the pinned area
+	drccodeptr const pinbase = ALIGN_PTR_UP(m_top, CACHE_ALIGNMENT);
+	size_t const space = (m_limit > pinbase) ? (m_limit - pinbase) : 0;
+	drccodeptr const pinend = ALIGN_PTR_UP(pinbase + space / 8, m_cache.page_size());
+	size_t const segsize = ((space - space / 8 - space / 16) / m_segcount) & ~size_t(m_cache.page_size() - 1);
+	if ((m_segcount < 2) || (segsize < (4 * SEGMENT_SLACK)))
+	{
+		osd_printf_verbose("drc_cache: Cache too small for %u segments, flushing when full\n", m_segcount);
+		m_segcount = 0;
+		return;
+	}
+
+	m_pintop = pinbase;
+	m_pinend = pinend;
+	m_segbase = pinend;
+	m_segsize = segsize;
+	m_segend = m_segbase + m_segcount * m_segsize;
+	m_segtop.resize(m_segcount);
+	for (uint32_t segment = 0; segment < m_segcount; segment++)
+		m_segtop[segment] = m_segbase + segment * m_segsize;
+	m_cursegment = 0;
+	m_top = m_segbase;
+}
+
+
+//-------------------------------------------------
+//  next_segment - move on to the next segment,
+//  evicting the code it holds
+//-------------------------------------------------
+
+void drc_cache::next_segment()
+{
+	m_segtop[m_cursegment] = m_top;
+	m_cursegment = (m_cursegment + 1) % m_segcount;
+
+	drccodeptr const start = m_segbase + m_cursegment * m_segsize;
+	if (m_segtop[m_cursegment] != start)
+	{
+		if (!m_evict.isnull())
+			m_evict(start, start + m_segsize);
+		m_segtop[m_cursegment] = start;
+		m_evictions++;
+	}
+	m_top = start;
+}
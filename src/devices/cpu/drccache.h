@@ -14,6 +14,8 @@
 
 #include "modules/lib/osdlib.h"
 
+#include <vector>
+
 
 //**************************************************************************
 //  MACROS
@@ -36,24 +38,34 @@ typedef uint8_t *drccodeptr;
 // helper template for oob codegen
 typedef delegate<void (drccodeptr *, void *, void *)> drc_oob_delegate;
 
+// called with the bounds of a code segment about to be reused
+typedef delegate<void (drccodeptr, drccodeptr)> drc_evict_delegate;
+
 
 // drc_cache
 class drc_cache
 {
 public:
 	// construction/destruction
-	drc_cache(size_t bytes);
+	drc_cache(size_t bytes, bool large_pages = false);
 	~drc_cache();
 
 	// getters
 	drccodeptr near() const { return m_near; }
 	drccodeptr base() const { return m_base; }
 	drccodeptr top() const { return m_top; }
+	size_t size() const { return m_size; }
 
 	// pointer checking
 	bool contains_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
 	bool contains_near_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_neartop); }
 	bool generating_code() const { return (m_codegen != nullptr); }
+	drccodeptr code_end(const void *ptr) const;
+
+	// statistics
+	uint32_t flushes() const { return m_flushes; }
+	uint32_t evictions() const { return m_evictions; }
+	uint64_t generated() const { return m_generated; }
 
 	// memory management
 	void flush();
@@ -69,7 +81,19 @@ public:
 	drccodeptr end_codegen();
 	void request_oob_codegen(drc_oob_delegate &&callback, void *param1 = nullptr, void *param2 = nullptr);
 
+	// segmented eviction
+	void set_segments(uint32_t count) { m_segcount = count; }
+	void set_evict_callback(drc_evict_delegate &&callback) { m_evict = std::move(callback); }
+	void prepare_block(bool pinned);
+	void finish_block();
+
 private:
+	// segmented eviction helpers
+	bool segmented() const { return m_segbase != nullptr; }
+	drccodeptr code_limit() const;
+	void start_segments();
+	void next_segment();
+
 	// largest block of code that can be generated at once
 	static constexpr size_t CODEGEN_MAX_BYTES = 131072;
 
@@ -82,6 +106,9 @@ private:
 	// size of "near" area at the base of the cache
 	static constexpr size_t NEAR_CACHE_SIZE = 131072;
 
+	// space left at the end of a segment for the block being generated, its map and its OOB code
+	static constexpr size_t SEGMENT_SLACK = 2 * CODEGEN_MAX_BYTES;
+
 	osd::virtual_memory_allocation m_cache;
 
 	// core parameters
@@ -96,6 +123,24 @@ private:
 	bool                m_executable;       // whether cached code is currently executable
 	bool                m_rwx;              // whether pages can be simultaneously writable and executable
 
+	// segmented eviction; after a flush, blocks without a HASH (static code) are generated
+	// as usual, then the space left is split into a pinned area for hash tables and static
+	// code generated later, and a ring of segments for everything else
+	uint32_t            m_segcount;         // number of segments requested, 0 to flush when full
+	uint32_t            m_cursegment;       // segment being filled
+	size_t              m_segsize;          // size of each segment
+	drccodeptr          m_pintop;           // unallocated area of the pinned area
+	drccodeptr          m_pinend;           // end of the pinned area
+	drccodeptr          m_segbase;          // start of the first segment, nullptr if not segmented
+	drccodeptr          m_segend;           // end of the last segment
+	drccodeptr          m_savedtop;         // segment top while generating pinned code
+	bool                m_pinned;           // generating pinned code
+	std::vector<drccodeptr> m_segtop;       // end of the code in each segment
+	drc_evict_delegate  m_evict;            // unlinks code from a segment about to be reused
+	uint32_t            m_flushes;          // number of flushes
+	uint32_t            m_evictions;        // number of segments evicted
+	uint64_t            m_generated;        // bytes of code generated
+
 	// oob management
 	struct oob_handler
 	{
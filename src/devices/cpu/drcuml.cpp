@@ -34,7 +34,10 @@
 #include "emu.h"
 #include "drcuml.h"
 
+#include "benchlog.h"
 #include "emuopts.h"
+#include "fileio.h"
+#include "footprint.h"
 #include "drcbec.h"
 #ifdef NATIVE_DRC
 #ifndef ASMJIT_NO_X86
@@ -44,6 +47,10 @@
 #include "drcbearm64.h"
 #endif
 
+#include "corestr.h"
+#include "hashing.h"
+
+#include <algorithm>
 #include <fstream>
 
 
@@ -57,6 +64,15 @@
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// most entry points kept in a -drc_warmcache list
+constexpr size_t WARM_MAX_ENTRIES = 65536;
+
+
+
 //**************************************************************************
 //  MACROS
 //**************************************************************************
@@ -146,7 +162,27 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_profile(device.machine().options().drc_profile() ? new profile_state : nullptr)
+	, m_warm(*device.machine().options().drc_warm_cache() ? new warm_state : nullptr)
+	, m_budget_limit(osd_ticks_t(device.machine().options().drc_compile_budget()) * osd_ticks_per_second() / 1'000'000)
+	, m_budget_used(0)
 {
+	cache.set_segments(device.machine().options().drc_cache_segments());
+	if (m_budget_limit)
+		device.machine().add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&drcuml_state::budget_frame, this));
+	if (m_warm)
+	{
+		warm_load();
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::warm_save, this));
+	}
+	device.machine().footprint().add(device.tag(), "drc", [&cache] () -> u64 { return cache.size(); });
+	if (bench_log_manager *const bench_log = device.machine().bench_log())
+	{
+		std::string const tag(device.tag());
+		bench_log->add_counter(tag + ":drc_code_bytes", [&cache] () -> u64 { return cache.generated(); });
+		bench_log->add_counter(tag + ":drc_flushes", [&cache] () -> u64 { return cache.flushes(); });
+		bench_log->add_counter(tag + ":drc_evictions", [&cache] () -> u64 { return cache.evictions(); });
+	}
 }
 
 
@@ -156,6 +192,10 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	if (m_profile)
+		profile_report();
+	if (m_cache.evictions())
+		osd_printf_verbose("%s: DRC cache flushed %u times, %u segments evicted\n", m_device.tag(), m_cache.flushes(), m_cache.evictions());
 }
 
 
@@ -171,6 +211,8 @@ void drcuml_state::reset()
 	{
 		// flush the cache
 		m_cache.flush();
+		if (m_profile)
+			m_profile->flushes++;
 
 		// reset all handle code pointers
 		for (uml::code_handle &handle : m_handlelist)
@@ -290,6 +332,275 @@ void drcuml_state::log_vprintf(util::format_argument_pack<char> const &args)
 
 
 
+//-------------------------------------------------
+//  execute_profiled - execute with the host time
+//  accounted for
+//-------------------------------------------------
+
+int drcuml_state::execute_profiled(uml::code_handle &entry)
+{
+	osd_ticks_t const start = osd_ticks();
+	int const result = m_beintf->execute(entry);
+	m_profile->execute_ticks += osd_ticks() - start;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  profile_counters - hand out an entry/exit
+//  counter pair; these have to live in the cache
+//  so the back-ends can address them, and they
+//  are permanent so they survive cache flushes
+//-------------------------------------------------
+
+u64 *drcuml_state::profile_counters()
+{
+	constexpr u32 POOL_COUNTERS = 512;
+	if (m_profile->pool_left < 2)
+	{
+		m_profile->pool = reinterpret_cast<u64 *>(m_cache.alloc(POOL_COUNTERS * sizeof(u64)));
+		if (!m_profile->pool)
+			return nullptr;
+		std::fill_n(m_profile->pool, POOL_COUNTERS, 0);
+		m_profile->pool_left = POOL_COUNTERS;
+	}
+	u64 *const result = m_profile->pool;
+	m_profile->pool += 2;
+	m_profile->pool_left -= 2;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  generate_profiled - add entry and exit
+//  counters to a block and generate it
+//-------------------------------------------------
+
+void drcuml_state::generate_profiled(drcuml_block &block, uml::instruction const *instructions, u32 count, osd_ticks_t begin_ticks)
+{
+	std::vector<uml::instruction> inst;
+	inst.reserve(count * 2);
+	block_profile *leader = nullptr;
+	u64 *counters = nullptr;
+	u32 histogram[uml::OP_MAX] = { 0 };
+	u32 uml_count = 0;
+	bool unprofiled = false;
+
+	for (u32 index = 0; index < count; index++)
+	{
+		uml::instruction const &source = instructions[index];
+		uml::opcode_t const opcode = source.opcode();
+		if (opcode != uml::OP_COMMENT && opcode != uml::OP_NOP)
+		{
+			histogram[opcode]++;
+			uml_count++;
+		}
+
+		// count unconditional exits; conditional ones would need the flags preserved
+		if (counters && (opcode == uml::OP_HASHJMP || (opcode == uml::OP_EXIT && source.condition() == uml::COND_ALWAYS)))
+			inst.emplace_back().dadd(uml::mem(&counters[1]), uml::mem(&counters[1]), 1);
+
+		inst.push_back(source);
+
+		// count entries right after each hash entry point
+		if (opcode == uml::OP_HASH)
+		{
+			u32 const mode = source.param(0).immediate();
+			u32 const pc = source.param(1).immediate();
+			block_profile &profile = m_profile->blocks[(u64(mode) << 32) | pc];
+			if (!profile.counters)
+			{
+				profile.mode = mode;
+				profile.pc = pc;
+				profile.counters = profile_counters();
+			}
+			profile.compiles++;
+			counters = profile.counters;
+			if (counters)
+				inst.emplace_back().dadd(uml::mem(&counters[0]), uml::mem(&counters[0]), 1);
+			else
+				unprofiled = true;
+			if (!leader)
+				leader = &profile;
+		}
+	}
+
+	// generate and account for the block
+	drccodeptr const top = m_cache.top();
+	m_beintf->generate(block, &inst[0], inst.size());
+	m_profile->compiles++;
+	if (unprofiled)
+		m_profile->unprofiled++;
+	m_profile->compile_ticks += osd_ticks() - begin_ticks;
+	if (leader)
+	{
+		leader->host_bytes = m_cache.top() - top;
+		leader->uml_count = uml_count;
+		leader->histogram.clear();
+		for (u32 opcode = 0; opcode < uml::OP_MAX; opcode++)
+			if (histogram[opcode])
+				leader->histogram.emplace_back(opcode, histogram[opcode]);
+		std::sort(leader->histogram.begin(), leader->histogram.end(), [] (auto const &a, auto const &b) { return a.second > b.second; });
+	}
+}
+
+
+//-------------------------------------------------
+//  profile_report - write the block profile,
+//  hottest entry points first
+//-------------------------------------------------
+
+void drcuml_state::profile_report()
+{
+	std::ofstream report(util::string_format("drcprof_%s.txt", m_device.shortname()));
+	if (!report)
+		return;
+
+	std::vector<block_profile const *> sorted;
+	for (auto const &entry : m_profile->blocks)
+		sorted.push_back(&entry.second);
+	std::sort(sorted.begin(), sorted.end(), [] (block_profile const *a, block_profile const *b)
+	{
+		u64 const ahits = a->counters ? a->counters[0] : 0;
+		u64 const bhits = b->counters ? b->counters[0] : 0;
+		return (ahits > bhits) || ((ahits == bhits) && (a->pc < b->pc));
+	});
+
+	double const ticks_per_ms = double(osd_ticks_per_second()) / 1000.0;
+	util::stream_format(report, "%s DRC profile\n", m_device.tag());
+	util::stream_format(report, "blocks compiled: %u (%u without counters), cache flushes: %u, segments evicted: %u\n", m_profile->compiles, m_profile->unprofiled, m_profile->flushes, m_cache.evictions());
+	util::stream_format(report, "host time: %.1f ms executing, %.1f ms compiling\n\n",
+			double(m_profile->execute_ticks - std::min(m_profile->execute_ticks, m_profile->compile_ticks)) / ticks_per_ms,
+			double(m_profile->compile_ticks) / ticks_per_ms);
+	util::stream_format(report, "%-4s %-8s %14s %14s %8s %8s %6s  %s\n", "mode", "pc", "entries", "exits", "compiles", "host", "uml", "histogram");
+	for (block_profile const *profile : sorted)
+	{
+		util::stream_format(report, "%4u %08X %14u %14u %8u %8u %6u ",
+				profile->mode, profile->pc,
+				profile->counters ? profile->counters[0] : 0, profile->counters ? profile->counters[1] : 0,
+				profile->compiles, profile->host_bytes, profile->uml_count);
+		for (auto const &entry : profile->histogram)
+		{
+			// strip the size placeholders from the mnemonic
+			std::string name(uml::instruction::mnemonic(uml::opcode_t(entry.first)));
+			name.erase(std::remove_if(name.begin(), name.end(), [] (char c) { return c == '!' || c == '#'; }), name.end());
+			util::stream_format(report, " %s:%u", name, entry.second);
+		}
+		report << '\n';
+	}
+}
+
+
+
+
+//-------------------------------------------------
+//  warm_note - remember the entry point of a
+//  block that was just generated
+//-------------------------------------------------
+
+void drcuml_state::warm_note(uml::instruction const *instructions, u32 count)
+{
+	// the leading HASH identifies the block; static handlers have none
+	for (u32 index = 0; index < count; index++)
+	{
+		uml::instruction const &inst = instructions[index];
+		if (inst.opcode() == uml::OP_HASH)
+		{
+			u32 const mode = inst.param(0).immediate();
+			u32 const pc = inst.param(1).immediate();
+			if ((m_warm->entries.size() < WARM_MAX_ENTRIES) && m_warm->seen.insert((u64(mode) << 32) | pc).second)
+				m_warm->entries.emplace_back(mode, pc);
+			return;
+		}
+		if (inst.opcode() != uml::OP_HANDLE && inst.opcode() != uml::OP_LABEL && inst.opcode() != uml::OP_COMMENT && inst.opcode() != uml::OP_NOP)
+			return;
+	}
+}
+
+
+//-------------------------------------------------
+//  take_warm_entries - return the entry points
+//  compiled during the last session, once; the
+//  front-end precompiles them after its first
+//  cache flush
+//-------------------------------------------------
+
+std::vector<std::pair<u32, u32> > drcuml_state::take_warm_entries()
+{
+	std::vector<std::pair<u32, u32> > result;
+	if (m_warm)
+		result.swap(m_warm->loaded);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  warm_load - build the cache key and read the
+//  entry point list if it matches
+//-------------------------------------------------
+
+void drcuml_state::warm_load()
+{
+	running_machine &machine = m_device.machine();
+
+	// anything that changes the generated code or the memory it was generated from invalidates the list
+	std::vector<std::pair<std::string, u32> > regions;
+	for (auto const &region : machine.memory().regions())
+		regions.emplace_back(region.first, util::crc32_creator::simple(region.second->base(), region.second->bytes()));
+	std::sort(regions.begin(), regions.end());
+	util::crc32_creator crc;
+	for (auto const &region : regions)
+	{
+		crc.append(region.first.c_str(), region.first.length() + 1);
+		crc.append(&region.second, sizeof(region.second));
+	}
+	m_warm->key = util::string_format("mame-drcwarm 1 %s %s %u %s %08x",
+			machine.system().name,
+			m_device.tag(),
+			m_device.clock(),
+			machine.options().drc_use_c() ? "c" : "native",
+			u32(crc.finish()));
+
+	// the device tag becomes the file name
+	std::string name(m_device.tag() + 1);
+	std::replace(name.begin(), name.end(), ':', '_');
+	m_warm->path = util::string_format("%s" PATH_SEPARATOR "%s.drcw", machine.system().name, name.empty() ? "root" : name);
+
+	emu_file file(machine.options().drc_warm_cache(), OPEN_FLAG_READ);
+	if (file.open(m_warm->path))
+		return;
+
+	char line[256];
+	if (!file.gets(line, sizeof(line)) || (strtrimspace(line) != m_warm->key))
+		return;
+	while (file.gets(line, sizeof(line)) && (m_warm->loaded.size() < WARM_MAX_ENTRIES))
+	{
+		unsigned mode, pc;
+		if (sscanf(line, "%x %x", &mode, &pc) == 2)
+			m_warm->loaded.emplace_back(mode, pc);
+	}
+}
+
+
+//-------------------------------------------------
+//  warm_save - write the entry points generated
+//  this session
+//-------------------------------------------------
+
+void drcuml_state::warm_save()
+{
+	if (m_warm->entries.empty())
+		return;
+
+	emu_file file(m_device.machine().options().drc_warm_cache(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_warm->path))
+		return;
+
+	file.printf("%s\n", m_warm->key);
+	for (auto const &entry : m_warm->entries)
+		file.printf("%x %x\n", entry.first, entry.second);
+}
+
 //**************************************************************************
 //  DRCUML BLOCK
 //**************************************************************************
@@ -304,6 +615,7 @@ drcuml_block::drcuml_block(drcuml_state &drcuml, u32 maxinst)
 	, m_maxinst(maxinst * 3/2)
 	, m_inst(m_maxinst)
 	, m_inuse(false)
+	, m_begin_ticks(0)
 {
 }
 
@@ -326,6 +638,8 @@ void drcuml_block::begin()
 	// set up the block information and return it
 	m_inuse = true;
 	m_nextinst = 0;
+	if (m_drcuml.profiling())
+		m_begin_ticks = osd_ticks();
 }
 
 
@@ -345,9 +659,19 @@ void drcuml_block::end()
 	if (m_drcuml.logging())
 		disassemble();
 
+	// static code without a HASH can't be evicted from a segmented cache
+	bool const pinned = std::none_of(&m_inst[0], &m_inst[0] + m_nextinst, [] (uml::instruction const &inst) { return inst.opcode() == uml::OP_HASH; });
+
 	// generate the code via the back-end
 	m_drcuml.cache().codegen_init();
-	m_drcuml.generate(*this, &m_inst[0], m_nextinst);
+	m_drcuml.cache().prepare_block(pinned);
+	if (m_drcuml.profiling())
+		m_drcuml.generate_profiled(*this, &m_inst[0], m_nextinst, m_begin_ticks);
+	else
+		m_drcuml.generate(*this, &m_inst[0], m_nextinst);
+	m_drcuml.cache().finish_block();
+	if (m_drcuml.warm_caching())
+		m_drcuml.warm_note(&m_inst[0], m_nextinst);
 
 	// block is no longer in use
 	m_inuse = false;
@@ -364,6 +688,7 @@ void drcuml_block::abort()
 
 	// block is no longer in use
 	m_inuse = false;
+	m_drcuml.cache().finish_block();
 
 	// unwind
 	throw abort_compilation();
@@ -429,6 +754,183 @@ void drcuml_block::optimize()
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
 	}
+
+	// then work across instructions
+	propagate_values();
+	eliminate_dead_writes();
+}
+
+
+//-------------------------------------------------
+//  is_region_boundary - returns true for
+//  instructions that other code can jump to or
+//  that hand control elsewhere; no register
+//  knowledge is carried across these
+//-------------------------------------------------
+
+static bool is_region_boundary(uml::opcode_t opcode)
+{
+	switch (opcode)
+	{
+	case uml::OP_HANDLE:
+	case uml::OP_HASH:
+	case uml::OP_LABEL:
+	case uml::OP_DEBUG:
+	case uml::OP_BREAK:
+	case uml::OP_EXIT:
+	case uml::OP_HASHJMP:
+	case uml::OP_JMP:
+	case uml::OP_EXH:
+	case uml::OP_CALLH:
+	case uml::OP_RET:
+	case uml::OP_CALLC:
+	case uml::OP_RECOVER:
+	case uml::OP_SAVE:
+	case uml::OP_RESTORE:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  propagate_values - forward integer register
+//  constants and copies into later instructions,
+//  folding them where possible
+//-------------------------------------------------
+
+void drcuml_block::propagate_values()
+{
+	struct reg_value
+	{
+		u8 size = 0;                // bytes known, 0 if nothing is known
+		bool is_copy = false;       // copy of another register rather than a constant
+		u64 value = 0;              // constant or source register
+	};
+	reg_value known[uml::REG_I_COUNT];
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		uml::opcode_t const opcode = inst.opcode();
+		if (opcode == uml::OP_COMMENT || opcode == uml::OP_NOP || opcode == uml::OP_MAPVAR)
+			continue;
+
+		// substitute what we know into pure inputs
+		bool changed = false;
+		if (opcode != uml::OP_RECOVER)
+		{
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			{
+				uml::parameter const &param(inst.param(pnum));
+				if (!param.is_int_register() || inst.is_param_out(pnum) || !inst.is_param_in(pnum))
+					continue;
+				reg_value const &value(known[param.ireg() - uml::REG_I0]);
+				int const size = inst.param_size(pnum);
+				if (!value.size || size > value.size)
+					continue;
+				if (value.is_copy)
+				{
+					inst.set_param(pnum, uml::parameter::make_ireg(value.value));
+					changed = true;
+				}
+				else if (inst.flags() == 0 && inst.param_allows(pnum, uml::parameter::PTYPE_IMMEDIATE))
+				{
+					inst.set_param(pnum, (size == 8) ? value.value : u32(value.value));
+					changed = true;
+				}
+			}
+		}
+		if (changed)
+			inst.simplify();
+
+		// nothing carries across jumps, calls or entry points
+		if (is_region_boundary(inst.opcode()))
+		{
+			std::fill(std::begin(known), std::end(known), reg_value());
+			continue;
+		}
+
+		// forget registers this instruction writes, and copies of them
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!inst.param(pnum).is_int_register() || !inst.is_param_out(pnum))
+				continue;
+			int const reg = inst.param(pnum).ireg();
+			known[reg - uml::REG_I0] = reg_value();
+			for (reg_value &value : known)
+				if (value.is_copy && value.value == reg)
+					value = reg_value();
+		}
+
+		// remember unconditional moves
+		if (inst.opcode() == uml::OP_MOV && inst.condition() == uml::COND_ALWAYS && inst.param(0).is_int_register())
+		{
+			reg_value &value(known[inst.param(0).ireg() - uml::REG_I0]);
+			if (inst.param(1).is_immediate())
+				value = reg_value{ inst.size(), false, inst.param(1).immediate() };
+			else if (inst.param(1).is_int_register() && (inst.param(1).ireg() != inst.param(0).ireg()))
+				value = reg_value{ inst.size(), true, u64(inst.param(1).ireg()) };
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  eliminate_dead_writes - remove pure integer
+//  register writes that are overwritten before
+//  anything can read them
+//-------------------------------------------------
+
+void drcuml_block::eliminate_dead_writes()
+{
+	// size of the next overwrite of each register with no read in between, 0 if live
+	u8 overwritten[uml::REG_I_COUNT] = { 0 };
+
+	for (int instnum = m_nextinst - 1; instnum >= 0; instnum--)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		uml::opcode_t const opcode = inst.opcode();
+		if (opcode == uml::OP_COMMENT || opcode == uml::OP_NOP || opcode == uml::OP_MAPVAR)
+			continue;
+
+		// everything is live at jumps, calls and entry points
+		if (is_region_boundary(opcode))
+		{
+			std::fill(std::begin(overwritten), std::end(overwritten), 0);
+			continue;
+		}
+
+		// drop pure register writes nobody will see
+		bool pure = false;
+		switch (opcode)
+		{
+		case uml::OP_LOAD:  case uml::OP_LOADS: case uml::OP_MOV:   case uml::OP_SEXT:  case uml::OP_ROLAND:
+		case uml::OP_ADD:   case uml::OP_SUB:   case uml::OP_AND:   case uml::OP_OR:    case uml::OP_XOR:
+		case uml::OP_LZCNT: case uml::OP_TZCNT: case uml::OP_BSWAP: case uml::OP_SHL:   case uml::OP_SHR:
+		case uml::OP_SAR:   case uml::OP_ROL:   case uml::OP_ROR:
+			pure = (inst.condition() == uml::COND_ALWAYS) && (inst.flags() == 0) && inst.param(0).is_int_register();
+			break;
+
+		default:
+			break;
+		}
+		if (pure && (overwritten[inst.param(0).ireg() - uml::REG_I0] >= inst.size()))
+		{
+			inst.nop();
+			continue;
+		}
+
+		// unconditional writes hide earlier values, then reads make them live again
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param(pnum).is_int_register() && inst.is_param_out(pnum) && !inst.is_param_in(pnum) && (inst.condition() == uml::COND_ALWAYS))
+				overwritten[inst.param(pnum).ireg() - uml::REG_I0] = inst.param_size(pnum);
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param(pnum).is_int_register() && inst.is_param_in(pnum))
+				overwritten[inst.param(pnum).ireg() - uml::REG_I0] = 0;
+	}
 }
 
 
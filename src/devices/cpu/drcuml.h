@@ -17,7 +17,10 @@
 
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 
@@ -113,6 +116,8 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void propagate_values();
+	void eliminate_dead_writes();
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -122,6 +127,7 @@ private:
 	u32                             m_maxinst;  // maximum number of instructions
 	std::vector<uml::instruction>   m_inst;     // pointer to the instruction list
 	bool                            m_inuse;    // this block is in use
+	osd_ticks_t                     m_begin_ticks; // when the block was begun, for profiling
 };
 
 
@@ -167,7 +173,7 @@ public:
 
 	// reset the state
 	void reset();
-	int execute(uml::code_handle &entry) { return m_beintf->execute(entry); }
+	int execute(uml::code_handle &entry) { return m_profile ? execute_profiled(entry) : m_beintf->execute(entry); }
 
 	// code generation
 	drcuml_block &begin_block(u32 maxinst);
@@ -177,6 +183,20 @@ public:
 	bool hash_exists(u32 mode, u32 pc) const { return m_beintf->hash_exists(mode, pc); }
 	void generate(drcuml_block &block, uml::instruction *instructions, u32 count) { m_beintf->generate(block, instructions, count); }
 
+	// block profiling (-drc_profile)
+	bool profiling() const { return bool(m_profile); }
+	void generate_profiled(drcuml_block &block, uml::instruction const *instructions, u32 count, osd_ticks_t begin_ticks);
+
+	// warm start entry points (-drc_warmcache)
+	bool warm_caching() const { return bool(m_warm); }
+	void warm_note(uml::instruction const *instructions, u32 count);
+	std::vector<std::pair<u32, u32> > take_warm_entries();
+
+	// compile time budget (-drc_compile_budget)
+	bool compile_budgeted() const { return m_budget_limit != 0; }
+	bool compile_budget_exhausted() const { return (m_budget_limit != 0) && (m_budget_used >= m_budget_limit); }
+	void charge_compile(osd_ticks_t ticks) { m_budget_used += ticks; }
+
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
 
@@ -219,6 +239,53 @@ private:
 		std::string m_name;     // name of the symbol
 	};
 
+	// profiling data for one entry point, keyed by mode and PC
+	struct block_profile
+	{
+		u32         mode = 0;                   // mode from the HASH instruction
+		u32         pc = 0;                     // PC from the HASH instruction
+		u64 *       counters = nullptr;         // entry and exit counters, in the cache
+		u32         compiles = 0;               // number of times code was generated
+		u32         host_bytes = 0;             // host code size of the last block started here
+		u32         uml_count = 0;              // UML instructions in the last block started here
+		std::vector<std::pair<u32, u32> > histogram; // UML opcode counts of the last block started here
+	};
+
+	// profiling state
+	struct profile_state
+	{
+		std::map<u64, block_profile> blocks;    // entry points seen so far
+		u64 *       pool = nullptr;             // counter storage being handed out
+		u32         pool_left = 0;              // counters left in the pool
+		u32         flushes = 0;                // cache flushes
+		u32         compiles = 0;               // blocks generated
+		u32         unprofiled = 0;             // blocks generated without counters
+		osd_ticks_t compile_ticks = 0;          // host time spent compiling blocks
+		osd_ticks_t execute_ticks = 0;          // host time spent in execute, including compiling
+	};
+
+	// entry points remembered across sessions
+	struct warm_state
+	{
+		std::string path;                       // list file, relative to the warm cache directory
+		std::string key;                        // identifies the system, device, back-end and ROM contents
+		std::vector<std::pair<u32, u32> > loaded; // entry points from the last session, not yet handed out
+		std::vector<std::pair<u32, u32> > entries; // mode and PC of each block generated, in order
+		std::unordered_set<u64> seen;           // entry points already in the list
+	};
+
+	// profiling helpers
+	int execute_profiled(uml::code_handle &entry);
+	u64 *profile_counters();
+	void profile_report();
+
+	// warm start helpers
+	void warm_load();
+	void warm_save();
+
+	// compile budget helpers
+	void budget_frame() { m_budget_used = 0; }
+
 	// internal state
 	device_t &                              m_device;           // CPU device we are associated with
 	drc_cache &                             m_cache;            // pointer to the codegen cache
@@ -227,6 +294,10 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	std::unique_ptr<profile_state>          m_profile;          // block profiling state
+	std::unique_ptr<warm_state>             m_warm;             // warm start state
+	osd_ticks_t                             m_budget_limit;     // host compile time allowed per frame, 0 for no limit
+	osd_ticks_t                             m_budget_used;      // host compile time used this frame
 };
 
 
@@ -79,6 +79,7 @@
 #include "dsp16.h"
 #include "dsp16core.ipp"
 #include "dsp16rc.h"
+#include "emuopts.h"
 
 #include <functional>
 #include <limits>
@@ -183,8 +184,8 @@ dsp16_device_base::dsp16_device_base(
 			{ "ram", ENDIANNESS_BIG, 16, yaau_bits, -1, std::move(data_map) },
 			{ "exm", ENDIANNESS_BIG, 16, 16, -1 } }
 	, m_yaau_bits(yaau_bits)
-	, m_workram(*this, "workram"), m_spaces{ nullptr, nullptr, nullptr }, m_workram_mask(0U)
-	, m_drc_cache(CACHE_SIZE), m_core(nullptr, [] (core_state *core) { core->~core_state(); }), m_recompiler()
+	, m_workram(*this, "workram"), m_spaces{ nullptr, nullptr, nullptr }, m_workram_mask(0U), m_internal_rom(nullptr), m_internal_rom_mask(0U), m_internal_rom_end(0U)
+	, m_drc_cache(CACHE_SIZE, mconfig.options().huge_pages()), m_core(nullptr, [] (core_state *core) { core->~core_state(); }), m_recompiler()
 	, m_cache_mode(cache::NONE), m_phase(phase::PURGE), m_int_enable{ 0U, 0U }, m_flags(FLAGS_NONE), m_cache_ptr(0U), m_cache_limit(0U), m_cache_iterations(0U)
 	, m_exm_in(1U), m_int_in(CLEAR_LINE), m_iack_out(1U)
 	, m_ick_in(1U), m_ild_in(CLEAR_LINE), m_do_out(1U), m_ock_in(1U), m_old_in(CLEAR_LINE), m_ose_out(1U)
@@ -1091,7 +1092,7 @@ template <bool Debugger, bool Caching> inline void dsp16_device_base::execute_so
 				m_cache_mode = cache::EXECUTE;
 				m_cache_ptr = 1U;
 				--m_cache_iterations;
-				overlap_rom_data_read();
+				overlap_rom_data_read<Debugger>();
 			}
 			else
 			{
@@ -1110,7 +1111,7 @@ template <bool Debugger, bool Caching> inline void dsp16_device_base::execute_so
 		set_predicate(predicate);
 
 		if (fetch_target)
-			*fetch_target = m_pcache.read_word(fetch_addr);
+			*fetch_target = program_read<Debugger>(fetch_addr);
 
 		if (phase::OP1 == m_phase)
 		{
@@ -1251,7 +1252,7 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 					m_core->op_dau_ad(op) = d;
 					if (last_instruction)
 					{
-						m_rom_data = m_pcache.read_word(m_core->xaau_pt);
+						m_rom_data = program_read<Debugger>(m_core->xaau_pt);
 						m_phase = phase::OP2;
 					}
 					else
@@ -1266,7 +1267,7 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 				m_core->op_dau_ad(op) = m_core->dau_f1(op);
 				m_core->dau_temp = s16(m_core->dau_y >> 16);
 				m_core->dau_set_y(yaau_read<Debugger>(op));
-				m_rom_data = m_pcache.read_word(m_core->xaau_pt);
+				m_rom_data = program_read<Debugger>(m_core->xaau_pt);
 				m_phase = phase::OP2;
 				break;
 
@@ -1275,7 +1276,7 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 				m_core->dau_set_y(yaau_read<Debugger>(op));
 				if (last_instruction)
 				{
-					m_rom_data = m_pcache.read_word(m_core->xaau_pt);
+					m_rom_data = program_read<Debugger>(m_core->xaau_pt);
 					m_phase = phase::OP2;
 				}
 				else
@@ -1351,7 +1352,7 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 		if (phase::PREFETCH == m_phase)
 		{
 			m_phase = phase::OP1;
-			overlap_rom_data_read();
+			overlap_rom_data_read<Debugger>();
 			m_st_pcbase = (m_cache_pcbase & 0xf000U) | ((m_cache_pcbase + m_cache_ptr) & 0x0fffU);
 		}
 		else if (phase::OP1 == m_phase)
@@ -1361,7 +1362,7 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 				// overlapped fetch of next instruction from ROM
 				mode_change = true;
 				m_cache_mode = cache::NONE;
-				m_cache[m_cache_ptr = 0] = m_pcache.read_word(m_core->xaau_pc);
+				m_cache[m_cache_ptr = 0] = program_read<Debugger>(m_core->xaau_pc);
 				m_st_pcbase = m_core->xaau_pc;
 			}
 			else
@@ -1377,7 +1378,7 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 					// move to next cached instruction
 					m_cache_ptr = (m_cache_ptr + 1) & 0x0fU;
 				}
-				overlap_rom_data_read();
+				overlap_rom_data_read<Debugger>();
 				m_st_pcbase = (m_cache_pcbase & 0xf000U) | ((m_cache_pcbase + m_cache_ptr) & 0x0fffU);
 			}
 		}
@@ -1387,7 +1388,16 @@ template <bool Debugger> inline void dsp16_device_base::execute_some_cache()
 	}
 }
 
-inline void dsp16_device_base::overlap_rom_data_read()
+template <bool Debugger> inline u16 dsp16_device_base::program_read(u16 addr)
+{
+	// the debugger needs to see fetches, and anything else goes through the memory system
+	if (!Debugger && m_internal_rom && (addr <= m_internal_rom_end))
+		return m_internal_rom[addr & m_internal_rom_mask];
+	else
+		return m_pcache.read_word(addr);
+}
+
+template <bool Debugger> inline void dsp16_device_base::overlap_rom_data_read()
 {
 	assert(cache::EXECUTE == m_cache_mode);
 	assert(phase::OP1 == m_phase);
@@ -1397,7 +1407,7 @@ inline void dsp16_device_base::overlap_rom_data_read()
 	case 0x19: // F1 ; y = a0 ; x = *pt++[i]
 	case 0x1b: // F1 ; y = a1 ; x = *pt++[i]
 	case 0x1f: // F1 ; y = Y ; x = *pt++[i]
-		m_rom_data = m_pcache.read_word(m_core->xaau_pt);
+		m_rom_data = program_read<Debugger>(m_core->xaau_pt);
 		break;
 	}
 }
@@ -2069,9 +2079,15 @@ void dsp16_device::external_memory_enable(address_space &space, bool enable)
 	// this assumes internal ROM is mirrored above 2KiB, but actual hardware behaviour is unknown
 	space.unmap_read(0x0000, 0xffff);
 	if (enable)
+	{
 		space.install_read_handler(0x0000, 0xffff, read16s_delegate(*this, FUNC(dsp16_device::external_memory_r<0x0000>)));
+		set_internal_rom(nullptr, 0U, 0U);
+	}
 	else
+	{
 		space.install_rom(0x0000, 0x07ff, 0xf800, &m_rom[0]);
+		set_internal_rom(&m_rom[0], 0x07ffU, 0xffffU);
+	}
 }
 
 void dsp16_device::data_map(address_map &map)
@@ -2101,11 +2117,13 @@ void dsp16a_device::external_memory_enable(address_space &space, bool enable)
 	if (enable)
 	{
 		space.install_read_handler(0x0000, 0xffff, read16s_delegate(*this, FUNC(dsp16a_device::external_memory_r<0x0000>)));
+		set_internal_rom(nullptr, 0U, 0U);
 	}
 	else
 	{
 		space.install_rom(0x0000, 0x0fff, &m_rom[0]);
 		space.install_read_handler(0x1000, 0xffff, read16s_delegate(*this, FUNC(dsp16a_device::external_memory_r<0x1000>)));
+		set_internal_rom(&m_rom[0], 0x0fffU, 0x0fffU);
 	}
 }
 
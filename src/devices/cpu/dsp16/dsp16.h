@@ -105,6 +105,9 @@ protected:
 
 	template <offs_t Base> u16 external_memory_r(offs_t offset, u16 mem_mask = ~0);
 
+	// lets instruction fetches read internal ROM directly, nullptr when external memory is enabled
+	void set_internal_rom(u16 const *rom, u16 mask, u16 end) { m_internal_rom = rom; m_internal_rom_mask = mask; m_internal_rom_end = end; }
+
 private:
 	// state registration indices
 	enum
@@ -184,7 +187,8 @@ private:
 	// instruction execution
 	template <bool Debugger, bool Caching> void execute_some_rom();
 	template <bool Debugger> void execute_some_cache();
-	void overlap_rom_data_read();
+	template <bool Debugger> void overlap_rom_data_read();
+	template <bool Debugger> u16 program_read(u16 addr);
 	void yaau_short_immediate_load(u16 op);
 	template <bool Debugger> s16 yaau_read(u16 op);
 	template <bool Debugger> void yaau_write(u16 op, s16 value);
@@ -275,6 +279,8 @@ private:
 	address_space               *m_spaces[3];
 	memory_access<16, 1, -1, ENDIANNESS_BIG>::cache m_pcache;
 	u16                         m_workram_mask;
+	u16 const                   *m_internal_rom;
+	u16                         m_internal_rom_mask, m_internal_rom_end;
 
 	// recompiler stuff
 	drc_cache                   m_drc_cache;
@@ -48,6 +48,7 @@
 #include "emu.h"
 #include "e132xs.h"
 #include "e132xsfe.h"
+#include "emuopts.h"
 
 #include "32xsdefs.h"
 
@@ -116,7 +117,7 @@ hyperstone_device::hyperstone_device(
 	: cpu_device(mconfig, type, tag, owner, clock)
 	, m_program_config("program", ENDIANNESS_BIG, prg_data_width, 32, 0, internal_map)
 	, m_io_config("io", ENDIANNESS_BIG, io_data_width, 15)
-	, m_cache(CACHE_SIZE + sizeof(hyperstone_device))
+	, m_cache(CACHE_SIZE + sizeof(hyperstone_device), mconfig.options().huge_pages())
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
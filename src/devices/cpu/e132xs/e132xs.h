@@ -487,6 +487,7 @@ private:
 	void generate_update_flags_addsubc(drcuml_block &block, compiler_state &compiler, uml::parameter sr);
 	void generate_update_flags_addsubs(drcuml_block &block, compiler_state &compiler, uml::parameter sr);
 	void generate_update_flags_cmp(drcuml_block &block, compiler_state &compiler, uml::parameter sr);
+	void generate_round_even_imm(drcuml_block &block, compiler_state &compiler);
 	void generate_update_nz(drcuml_block &block, compiler_state &compiler, uml::parameter sr);
 	void generate_update_nz_d(drcuml_block &block, compiler_state &compiler, uml::parameter sr);
 
@@ -549,6 +549,17 @@ void hyperstone_device::generate_update_flags_cmp(drcuml_block &block, compiler_
 	UML_OR(block, sr, sr, I3);
 }
 
+void hyperstone_device::generate_round_even_imm(drcuml_block &block, compiler_state &compiler)
+{
+	// expects Rd in I0 and SR in I2
+	// sets I1 to the ADDI/ADDSI round to even operand C & (~Z | Rd(0))
+
+	UML_AND(block, I1, I0, 1);                  // Rd(0)
+	UML_TEST(block, I2, Z_MASK);
+	UML_MOVc(block, uml::COND_Z, I1, 1);        // | ~Z
+	UML_AND(block, I1, I1, I2);                 // & C
+}
+
 void hyperstone_device::generate_update_nz(drcuml_block &block, compiler_state &compiler, uml::parameter sr)
 {
 	// expects result in I0 and UML Z flag to be set
@@ -1964,7 +1975,7 @@ void hyperstone_device::generate_addi(drcuml_block &block, compiler_state &compi
 		UML_ROLINS(block, I2, flags, 0, M_MASK | V_MASK | N_MASK | Z_MASK | C_MASK);
 		UML_MOV(block, DRC_SR, I2);
 
-		result = uint32_t(result) & uint32_t(1);
+		result = uint32_t(result) & ~uint32_t(1);
 		UML_MOV(block, DRC_PC, result);
 		generate_branch(block, compiler, compiler.mode(), result, desc);
 	}
@@ -1974,12 +1985,7 @@ void hyperstone_device::generate_addi(drcuml_block &block, compiler_state &compi
 
 		uml::parameter srcp = roundeven ? uml::I1 : src;
 		if (roundeven)
-		{
-			UML_AND(block, I1, I0, 1);              // Rd(0)
-			UML_AND(block, I1, I1, I2);             // & C
-			UML_TEST(block, I2, Z_MASK);
-			UML_MOVc(block, uml::COND_NZ, I1, 0);   // & ~Z
-		}
+			generate_round_even_imm(block, compiler);
 
 		UML_ADD(block, I0, I0, srcp);
 
@@ -1994,9 +2000,42 @@ void hyperstone_device::generate_addi(drcuml_block &block, compiler_state &compi
 template <hyperstone_device::reg_bank DstGlobal, hyperstone_device::imm_size ImmLong>
 void hyperstone_device::generate_addsi(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	osd_printf_error("Unimplemented: generate_addsi (%08x)\n", desc->pc);
-	fflush(stdout);
-	fatalerror(" ");
+	UML_MOV(block, I7, mem(&m_core->clock_cycles_1));
+
+	const uint16_t op = desc->opptr.w[0];
+	const uint32_t dst_code = (op & 0xf0) >> 4;
+	const bool roundeven = !(op & 0x10f);
+
+	uint32_t src;
+	if (ImmLong)
+		src = generate_get_immediate_s(desc);
+	else
+		src = op & 0x0f;
+
+	UML_MOV(block, I2, DRC_SR);
+	if (!DstGlobal)
+		UML_ROLAND(block, I3, I2, 32 - FP_SHIFT, 0x7f);
+
+	generate_load_operand(block, compiler, DstGlobal, dst_code, uml::I0, uml::I3);
+
+	uml::parameter srcp = roundeven ? uml::I1 : src;
+	if (roundeven)
+		generate_round_even_imm(block, compiler);
+
+	UML_ADD(block, I0, I0, srcp);
+
+	generate_update_flags_addsubs(block, compiler, uml::I2);
+	UML_MOV(block, DRC_SR, I2);
+
+	generate_set_register(block, compiler, desc, DstGlobal, dst_code, uml::I0, uml::I3, false);
+	generate_exception_on_overflow(block, compiler, desc, uml::I2);
+
+	if (DstGlobal && (dst_code == PC_REGISTER))
+	{
+		UML_AND(block, DRC_SR, DRC_SR, ~M_MASK);
+		UML_AND(block, I0, I0, ~uint32_t(1));
+		generate_branch(block, compiler, compiler.mode(), uml::I0, desc);
+	}
 }
 
 
@@ -4091,6 +4130,53 @@ void hyperstone_device::generate_extend(drcuml_block &block, compiler_state &com
 	UML_AND(block, I2, I2, 0x3f);
 	UML_LOAD(block, I1, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4); // I1: vald
 
+	// signed half-words: I2 = low(vald), I3 = high(vald), I4 = low(vals), I5 = high(vals)
+	auto const split_halves =
+			[&block] ()
+			{
+				UML_SEXT(block, I2, I1, SIZE_WORD);
+				UML_SAR(block, I3, I1, 16);
+				UML_SEXT(block, I4, I0, SIZE_WORD);
+				UML_SAR(block, I5, I0, 16);
+			};
+
+	// G14 = sum and G15 = difference of the half-words of vals and G14/G15,
+	// optionally taking bits 30..15 of G14/G15 and halving the results
+	auto const sum_difference =
+			[this, &block] (bool adjust, bool halve)
+			{
+				UML_MOV(block, I2, mem(&m_core->global_regs[14]));
+				UML_MOV(block, I3, mem(&m_core->global_regs[15]));
+				if (adjust)
+				{
+					UML_SHR(block, I2, I2, 15);
+					UML_SHR(block, I3, I3, 15);
+				}
+				for (int i = 0; i < 2; i++)
+				{
+					UML_SHR(block, I4, I0, 16);
+					UML_AND(block, I5, I0, 0x0000ffff);
+					if (!i)
+					{
+						UML_ADD(block, I4, I4, I2);
+						UML_ADD(block, I5, I5, I3);
+					}
+					else
+					{
+						UML_SUB(block, I4, I4, I2);
+						UML_SUB(block, I5, I5, I3);
+					}
+					if (halve)
+					{
+						UML_SHR(block, I4, I4, 1);
+						UML_SHR(block, I5, I5, 1);
+					}
+					UML_SHL(block, I4, I4, 16);
+					UML_AND(block, I5, I5, 0x0000ffff);
+					UML_OR(block, mem(&m_core->global_regs[14 + i]), I4, I5);
+				}
+			};
+
 	switch (func)
 	{
 		// signed or unsigned multiplication, single word product
@@ -4141,60 +4227,72 @@ void hyperstone_device::generate_extend(drcuml_block &block, compiler_state &com
 
 		// signed half-word multiply/add, single word product sum
 		case EHMAC:
-			UML_AND(block, I2, I0, 0x0000ffff);
-			UML_AND(block, I3, I1, 0x0000ffff);
-			UML_MULS(block, I2, I3, I2, I3);
-			UML_SHR(block, I0, I0, 16);
-			UML_SHR(block, I1, I1, 16);
-			UML_MULS(block, I0, I1, I0, I1);
-			UML_ADD(block, I0, I0, I2);
-			UML_MOV(block, I1, mem(&m_core->global_regs[15]));
-			UML_ADD(block, I0, I0, I1);
-			UML_MOV(block, mem(&m_core->global_regs[15]), I0);
+			split_halves();
+			UML_MULSLW(block, I2, I2, I4);
+			UML_MULSLW(block, I3, I3, I5);
+			UML_ADD(block, I2, I2, I3);
+			UML_ADD(block, mem(&m_core->global_regs[15]), mem(&m_core->global_regs[15]), I2);
 			break;
 
 		// signed half-word multiply/add, double word product sum
 		case EHMACD:
-			osd_printf_error("Unimplemented extended opcode, EHMACD, PC = %08x\n", desc->pc);
-			fatalerror(" ");
+			split_halves();
+			UML_MULSLW(block, I2, I2, I4);
+			UML_MULSLW(block, I3, I3, I5);
+			UML_DSEXT(block, I2, I2, SIZE_DWORD);
+			UML_DSEXT(block, I3, I3, SIZE_DWORD);
+			UML_DADD(block, I2, I2, I3);
+			UML_MOV(block, I4, mem(&m_core->global_regs[14]));
+			UML_MOV(block, I5, mem(&m_core->global_regs[15]));
+			UML_DSHL(block, I4, I4, 32);
+			UML_DOR(block, I4, I4, I5);
+			UML_DADD(block, I4, I4, I2);
+			UML_MOV(block, mem(&m_core->global_regs[15]), I4);
+			UML_DSHR(block, I4, I4, 32);
+			UML_MOV(block, mem(&m_core->global_regs[14]), I4);
 			break;
 
-		// half-word complex multiply
-		case EHCMULD:
-			osd_printf_error("Unimplemented extended opcode, EHCMULD, PC = %08x\n", desc->pc);
-			fatalerror(" ");
-			break;
-
-		// half-word complex multiply/add
-		case EHCMACD:
-			osd_printf_error("Unimplemented extended opcode, EHCMACD, PC = %08x\n", desc->pc);
-			fatalerror(" ");
+		case EHCMULD: // half-word complex multiply
+		case EHCMACD: // half-word complex multiply/add
+			split_halves();
+			UML_MULSLW(block, I6, I2, I4);
+			UML_MULSLW(block, I1, I3, I5);
+			UML_SUB(block, I6, I6, I1);                 // I6 = real part
+			UML_MULSLW(block, I2, I2, I5);
+			UML_MULSLW(block, I3, I3, I4);
+			UML_ADD(block, I2, I2, I3);                 // I2 = imaginary part
+			if (func == EHCMULD)
+			{
+				UML_MOV(block, mem(&m_core->global_regs[14]), I6);
+				UML_MOV(block, mem(&m_core->global_regs[15]), I2);
+			}
+			else
+			{
+				UML_ADD(block, mem(&m_core->global_regs[14]), mem(&m_core->global_regs[14]), I6);
+				UML_ADD(block, mem(&m_core->global_regs[15]), mem(&m_core->global_regs[15]), I2);
+			}
 			break;
 
 		// half-word (complex) add/subtract
 		// Ls is not used and should denote the same register as Ld
 		case EHCSUMD:
-			osd_printf_error("Unimplemented extended opcode, EHCSUMD, PC = %08x\n", desc->pc);
-			fatalerror(" ");
+			sum_difference(false, false);
 			break;
 
 		// half-word (complex) add/subtract with fixed point adjustment
 		// Ls is not used and should denote the same register as Ld
 		case EHCFFTD:
-			osd_printf_error("Unimplemented extended opcode, EHCFFTD, PC = %08x\n", desc->pc);
-			fatalerror(" ");
+			sum_difference(true, false);
 			break;
 
 		// half-word (complex) add/subtract with fixed point adjustment and shift
 		// Ls is not used and should denote the same register as Ld
 		case EHCFFTSD:
-			osd_printf_error("Unimplemented extended opcode, EHCFFTSD, PC = %08x\n", desc->pc);
-			fatalerror(" ");
+			sum_difference(true, true);
 			break;
 
 		default:
-			osd_printf_error("Unknown extended opcode (%04x), PC = %08x\n", func, desc->pc);
-			fatalerror(" ");
+			// the interpreter ignores illegal extended opcodes, so do the same
 			break;
 	}
 }
@@ -4202,16 +4300,14 @@ void hyperstone_device::generate_extend(drcuml_block &block, compiler_state &com
 
 void hyperstone_device::generate_reserved(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	osd_printf_error("Unimplemented: generate_reserved (%08x)\n", desc->pc);
-	fflush(stdout);
-	fatalerror(" ");
+	// executes as a no-op taking no cycles, like the interpreter
 }
 
 void hyperstone_device::generate_do(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	osd_printf_error("Unimplemented: generate_do (%08x)\n", desc->pc);
-	fflush(stdout);
-	fatalerror(" ");
+	// not emulated by the interpreter either; only stop if it's actually reached
+	UML_MOV(block, mem(&m_core->arg0), desc->opptr.w[0]);
+	UML_CALLC(block, &c_funcs::unimplemented, this);
 }
 
 #endif // MAME_CPU_E132XS_E132XSDRC_OPS_HXX
@@ -0,0 +1,232 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    hostfp.h
+
+    Host floating point fast paths for softfloat3 arithmetic.
+
+    Each function here takes and returns the same values as the softfloat3
+    function of the same name, and raises the same exception flags.  The
+    host's IEEE 754 arithmetic is used when the operands are zero or
+    normal, the guest rounds to nearest even and the result can't have
+    underflowed or overflowed; the only flag such an operation can raise
+    is inexact, which is worked out from the exact error of the host
+    result.  Everything else goes to softfloat.
+
+    The host is assumed to be rounding to nearest even, its default, and
+    to evaluate expressions at their declared precision.  Flushing
+    denormals to zero doesn't matter, as no denormal ever reaches the
+    host arithmetic.
+
+***************************************************************************/
+#ifndef MAME_CPU_HOSTFP_H
+#define MAME_CPU_HOSTFP_H
+
+#pragma once
+
+#include "softfloat3/source/include/softfloat.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+
+namespace hostfp {
+
+// host arithmetic only matches softfloat's when it's done at the declared precision
+constexpr bool usable = (FLT_EVAL_METHOD == 0) && std::numeric_limits<float>::is_iec559 && std::numeric_limits<double>::is_iec559;
+
+namespace detail {
+
+inline float to_host(float32_t v) { float f; std::memcpy(&f, &v.v, sizeof(f)); return f; }
+inline double to_host(float64_t v) { double d; std::memcpy(&d, &v.v, sizeof(d)); return d; }
+inline float32_t to_soft(float f) { float32_t v; std::memcpy(&v.v, &f, sizeof(f)); return v; }
+inline float64_t to_soft(double d) { float64_t v; std::memcpy(&v.v, &d, sizeof(d)); return v; }
+
+// zero, or normal finite
+inline bool plain(float32_t v) { uint32_t const e = (v.v >> 23) & 0xff; return (e != 0xff) && (e || !(v.v & 0x007fffff)); }
+inline bool plain(float64_t v) { uint64_t const e = (v.v >> 52) & 0x7ff; return (e != 0x7ff) && (e || !(v.v & 0x000fffff'ffffffffULL)); }
+
+// unbiased exponent of a zero or normal value, close enough to zero for the exact error of a product to stay normal
+inline bool moderate(float64_t v) { int const e = int((v.v >> 52) & 0x7ff) - 1023; return (e >= -400) && (e <= 400); }
+
+inline bool host_ready() { return usable && (softfloat_roundingMode == softfloat_round_near_even); }
+
+// error of a rounded sum, zero if the sum is exact
+inline double sum_error(double a, double b, double s)
+{
+	double const bb = s - a;
+	return (a - (s - bb)) + (b - bb);
+}
+
+// error of a rounded product of moderate values, zero if the product is exact
+inline double product_error(double a, double b, double p)
+{
+#if defined(FP_FAST_FMA)
+	return std::fma(a, b, -p);
+#else
+	double const ca = 134217729.0 * a, cb = 134217729.0 * b;
+	double const ah = ca - (ca - a), bh = cb - (cb - b);
+	double const al = a - ah, bl = b - bh;
+	return ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+}
+
+// round a double result to single, false if softfloat has to do it because the result is tiny or too big
+inline bool finish(double d, bool exact, float32_t &result)
+{
+	float const f = float(d);
+	if ((d != 0.0) && !((std::fabs(d) > double(FLT_MIN)) && (std::fabs(f) <= FLT_MAX)))
+		return false;
+	if (!exact || (double(f) != d))
+		softfloat_exceptionFlags |= softfloat_flag_inexact;
+	result = to_soft(f);
+	return true;
+}
+
+inline bool finish(double d, bool exact, float64_t &result)
+{
+	if ((d != 0.0) && !((std::fabs(d) > DBL_MIN) && (std::fabs(d) <= DBL_MAX)))
+		return false;
+	if (!exact)
+		softfloat_exceptionFlags |= softfloat_flag_inexact;
+	result = to_soft(d);
+	return true;
+}
+
+} // namespace detail
+
+
+// single precision is done in double: the products are exact there, and
+// rounding twice gives the correctly rounded result for all of these
+
+inline float32_t f32_add(float32_t a, float32_t b)
+{
+	float32_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b))
+	{
+		double const x = detail::to_host(a), y = detail::to_host(b), s = x + y;
+		if (detail::finish(s, detail::sum_error(x, y, s) == 0.0, result))
+			return result;
+	}
+	return ::f32_add(a, b);
+}
+
+inline float32_t f32_sub(float32_t a, float32_t b)
+{
+	float32_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b))
+	{
+		double const x = detail::to_host(a), y = -double(detail::to_host(b)), s = x + y;
+		if (detail::finish(s, detail::sum_error(x, y, s) == 0.0, result))
+			return result;
+	}
+	return ::f32_sub(a, b);
+}
+
+inline float32_t f32_mul(float32_t a, float32_t b)
+{
+	float32_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b))
+	{
+		double const p = double(detail::to_host(a)) * double(detail::to_host(b));
+		if (detail::finish(p, true, result))
+			return result;
+	}
+	return ::f32_mul(a, b);
+}
+
+inline float32_t f32_div(float32_t a, float32_t b)
+{
+	float32_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b) && (b.v & 0x7fffffff))
+	{
+		double const x = detail::to_host(a), y = detail::to_host(b);
+		double const d = x / y, q = double(float(d));
+		if (detail::finish(d, (q * y) == x, result))
+			return result;
+	}
+	return ::f32_div(a, b);
+}
+
+inline float32_t f32_sqrt(float32_t a)
+{
+	float32_t result;
+	if (detail::host_ready() && detail::plain(a) && (!(a.v & 0x80000000) || !(a.v & 0x7fffffff)))
+	{
+		double const x = detail::to_host(a);
+		double const d = std::sqrt(x), r = double(float(d));
+		if (detail::finish(d, (r * r) == x, result))
+			return result;
+	}
+	return ::f32_sqrt(a);
+}
+
+
+// double precision works out the exact error of the host operation
+
+inline float64_t f64_add(float64_t a, float64_t b)
+{
+	float64_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b))
+	{
+		double const x = detail::to_host(a), y = detail::to_host(b), s = x + y;
+		if (detail::finish(s, detail::sum_error(x, y, s) == 0.0, result))
+			return result;
+	}
+	return ::f64_add(a, b);
+}
+
+inline float64_t f64_sub(float64_t a, float64_t b)
+{
+	float64_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b))
+	{
+		double const x = detail::to_host(a), y = -detail::to_host(b), s = x + y;
+		if (detail::finish(s, detail::sum_error(x, y, s) == 0.0, result))
+			return result;
+	}
+	return ::f64_sub(a, b);
+}
+
+inline float64_t f64_mul(float64_t a, float64_t b)
+{
+	float64_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b) && detail::moderate(a) && detail::moderate(b))
+	{
+		double const x = detail::to_host(a), y = detail::to_host(b), p = x * y;
+		if (detail::finish(p, (p == 0.0) || (detail::product_error(x, y, p) == 0.0), result))
+			return result;
+	}
+	return ::f64_mul(a, b);
+}
+
+inline float64_t f64_div(float64_t a, float64_t b)
+{
+	float64_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::plain(b) && (b.v & 0x7fffffff'ffffffffULL) && detail::moderate(a) && detail::moderate(b))
+	{
+		double const x = detail::to_host(a), y = detail::to_host(b), q = x / y;
+		if (detail::finish(q, (q == 0.0) || (((q * y) == x) && (detail::product_error(q, y, q * y) == 0.0)), result))
+			return result;
+	}
+	return ::f64_div(a, b);
+}
+
+inline float64_t f64_sqrt(float64_t a)
+{
+	float64_t result;
+	if (detail::host_ready() && detail::plain(a) && detail::moderate(a) && (!(a.v & 0x80000000'00000000ULL) || !(a.v & 0x7fffffff'ffffffffULL)))
+	{
+		double const x = detail::to_host(a), r = std::sqrt(x);
+		if (detail::finish(r, (r == 0.0) || (((r * r) == x) && (detail::product_error(r, r, r * r) == 0.0)), result))
+			return result;
+	}
+	return ::f64_sqrt(a);
+}
+
+} // namespace hostfp
+
+#endif // MAME_CPU_HOSTFP_H
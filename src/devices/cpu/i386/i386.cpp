@@ -337,6 +337,17 @@ void i386_device::NEAR_BRANCH(int32_t offs)
 	m_pc += offs;
 }
 
+uint32_t i386_device::fetch_dword(uint32_t address)
+{
+	if (!m_fetch_valid || (m_fetch_address != address))
+	{
+		m_fetch_data = mem_pr32(address);
+		m_fetch_address = address;
+		m_fetch_valid = true;
+	}
+	return m_fetch_data;
+}
+
 uint8_t i386_device::FETCH()
 {
 	uint8_t value;
@@ -345,7 +356,8 @@ uint8_t i386_device::FETCH()
 	if(!translate_address(m_CPL,TR_FETCH,&address,&error))
 		PF_THROW(error);
 
-	value = mem_pr8(address & m_a20_mask);
+	address &= m_a20_mask;
+	value = fetch_dword(address & ~3) >> ((address & 3) * 8);
 #ifdef DEBUG_MISSING_OPCODE
 	m_opcode_bytes[m_opcode_bytes_length] = value;
 	m_opcode_bytes_length = (m_opcode_bytes_length + 1) & 15;
@@ -366,7 +378,7 @@ uint16_t i386_device::FETCH16()
 		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
 			PF_THROW(error);
 		address &= m_a20_mask;
-		value = mem_pr16(address);
+		value = fetch_dword(address & ~3) >> ((address & 2) * 8);
 		m_eip += 2;
 		m_pc += 2;
 	}
@@ -387,7 +399,7 @@ uint32_t i386_device::FETCH32()
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = mem_pr32(address);
+		value = fetch_dword(address);
 		m_eip += 4;
 		m_pc += 4;
 	}
@@ -1160,6 +1172,7 @@ uint8_t i386_device::READPORT8(offs_t port)
 
 void i386_device::WRITEPORT8(offs_t port, uint8_t value)
 {
+	m_fetch_valid = false;
 	check_ioperm(port, 1);
 	m_io->write_byte(port, value);
 }
@@ -1193,6 +1206,7 @@ uint16_t i386_device::READPORT16(offs_t port)
 
 void i386_device::WRITEPORT16(offs_t port, uint16_t value)
 {
+	m_fetch_valid = false;
 	switch (port & 3)
 	{
 	case 0:
@@ -1248,6 +1262,7 @@ uint32_t i386_device::READPORT32(offs_t port)
 
 void i386_device::WRITEPORT32(offs_t port, uint32_t value)
 {
+	m_fetch_valid = false;
 	switch (port & 3)
 	{
 	case 0:
@@ -1291,6 +1306,7 @@ uint16_t i386sx_device::READPORT16(offs_t port)
 
 void i386sx_device::WRITEPORT16(offs_t port, uint16_t value)
 {
+	m_fetch_valid = false;
 	if (port & 1)
 	{
 		WRITEPORT8(port, value & 0xff);
@@ -1322,6 +1338,7 @@ uint32_t i386sx_device::READPORT32(offs_t port)
 
 void i386sx_device::WRITEPORT32(offs_t port, uint32_t value)
 {
+	m_fetch_valid = false;
 	if (port & 1)
 	{
 		WRITEPORT8(port, value & 0xff);
@@ -1542,6 +1559,8 @@ void i386_device::i386_check_irq_line()
 	/* Check if the interrupts are enabled */
 	if ( (m_irq_state) && m_IF )
 	{
+		// the acknowledge can reach any device
+		m_fetch_valid = false;
 		m_cycles -= 2;
 		i386_trap(standard_irq_callback(0, m_pc), 1, 0);
 	}
@@ -1959,6 +1978,9 @@ void i386_device::i386_common_init()
 	} else {
 		m_program->cache(macache32);
 	}
+	m_fetch_address = 0;
+	m_fetch_data = 0;
+	m_fetch_valid = false;
 
 	m_io = &space(AS_IO);
 	m_smi = false;
@@ -2539,6 +2561,7 @@ void i386_device::device_reset()
 
 void i386_device::enter_smm()
 {
+	m_fetch_valid = false;
 	uint32_t smram_state = m_smbase + 0xfe00;
 	uint32_t old_cr0 = m_cr[0];
 	uint32_t old_flags = get_flags();
@@ -2625,6 +2648,7 @@ void i386_device::enter_smm()
 
 void i386_device::leave_smm()
 {
+	m_fetch_valid = false;
 	uint32_t smram_state = m_smbase + 0xfe00;
 
 	// load state, no sanity checks anywhere
@@ -2776,6 +2800,9 @@ void i386_device::execute_run()
 	m_base_cycles = cycles;
 	CHANGE_PC(m_eip);
 
+	// other devices may have written memory since the last slice
+	m_fetch_valid = false;
+
 	if (m_halted)
 	{
 		debugger_wait_hook();
@@ -2830,6 +2857,8 @@ void i386_device::execute_run()
 		m_prev_eip = m_eip;
 
 		debugger_instruction_hook(m_pc);
+		if (debugger_enabled())
+			m_fetch_valid = false;
 
 		if(m_delayed_interrupt_enable != 0)
 		{
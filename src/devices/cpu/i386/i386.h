@@ -282,6 +282,12 @@ protected:
 	uint32_t m_eip;
 	uint32_t m_pc;
 	uint32_t m_prev_eip;
+
+	// last aligned code dword fetched; dropped on stores, port writes and anything else
+	// that can change memory or the memory map between two fetches
+	uint32_t m_fetch_address;
+	uint32_t m_fetch_data;
+	bool m_fetch_valid;
 	uint32_t m_eflags;
 	uint32_t m_eflags_mask;
 	uint8_t m_CF;
@@ -440,6 +446,7 @@ protected:
 	bool translate_address(int pl, int type, uint32_t *address, uint32_t *error);
 	void CHANGE_PC(uint32_t pc);
 	inline void NEAR_BRANCH(int32_t offs);
+	inline uint32_t fetch_dword(uint32_t address);
 	inline uint8_t FETCH();
 	inline uint16_t FETCH16();
 	inline uint32_t FETCH32();
@@ -452,10 +459,10 @@ protected:
 	virtual uint32_t READ32PL(uint32_t ea, uint8_t privilege);
 	virtual uint64_t READ64PL(uint32_t ea, uint8_t privilege);
 	inline void WRITE_TEST(uint32_t ea);
-	inline void WRITE8(uint32_t ea, uint8_t value) { WRITE8PL(ea, m_CPL, value); }
-	inline void WRITE16(uint32_t ea, uint16_t value) { WRITE16PL(ea, m_CPL, value); }
-	inline void WRITE32(uint32_t ea, uint32_t value) { WRITE32PL(ea, m_CPL, value); }
-	inline void WRITE64(uint32_t ea, uint64_t value) { WRITE64PL(ea, m_CPL, value); }
+	inline void WRITE8(uint32_t ea, uint8_t value) { m_fetch_valid = false; WRITE8PL(ea, m_CPL, value); }
+	inline void WRITE16(uint32_t ea, uint16_t value) { m_fetch_valid = false; WRITE16PL(ea, m_CPL, value); }
+	inline void WRITE32(uint32_t ea, uint32_t value) { m_fetch_valid = false; WRITE32PL(ea, m_CPL, value); }
+	inline void WRITE64(uint32_t ea, uint64_t value) { m_fetch_valid = false; WRITE64PL(ea, m_CPL, value); }
 	virtual void WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value);
 	virtual void WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value);
 	virtual void WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value);
@@ -390,14 +390,25 @@ void m6502_device::execute_run()
 	if(inst_substate)
 		do_exec_partial();
 
-	while(icount > 0) {
-		if(inst_state < 0xff00) {
-			PPC = NPC;
-			inst_state = IR | inst_state_base;
-			if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+	// whole instructions from here on; the debugger can't be enabled
+	// while running, so without it the loop doesn't test for it
+	if(machine().debug_flags & DEBUG_FLAG_ENABLED) {
+		while(icount > 0) {
+			if(inst_state < 0xff00) {
+				PPC = NPC;
+				inst_state = IR | inst_state_base;
 				debugger_instruction_hook(pc_to_external(NPC));
+			}
+			do_exec_full();
+		}
+	} else {
+		while(icount > 0) {
+			if(inst_state < 0xff00) {
+				PPC = NPC;
+				inst_state = IR | inst_state_base;
+			}
+			do_exec_full();
 		}
-		do_exec_full();
 	}
 }
 
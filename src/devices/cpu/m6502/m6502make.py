@@ -91,9 +91,11 @@ def save_opcodes(f, device, opcodes):
                 emit(f, "\treturn;")
                 substate += 1
             elif line_type == "MEMORY":
+                # the full version is the one run with cycles to spare,
+                # running out in the middle of it is the rare case
                 emit(f, ins)
                 emit(f, "\ticount--;")
-                emit(f, "\tif(icount <= 0) {")
+                emit(f, "\tif(UNEXPECTED(icount <= 0)) {")
                 emit(f, "\t\tif(access_to_be_redone()) {")
                 emit(f, "\t\t\ticount++;")
                 emit(f, "\t\t\tinst_substate = %d;" % substate)
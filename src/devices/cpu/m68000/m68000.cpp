@@ -115,6 +115,8 @@ void m68000_device::execute_run()
 	} else
 		m_count_before_instruction_step = 0;
 
+	bool const debugging = machine().debug_flags & DEBUG_FLAG_ENABLED;
+
 	for(;;) {
 		if(m_icount > 0 && m_inst_substate)
 			(this->*(m_handlers_p[m_inst_state]))();
@@ -124,7 +126,7 @@ void m68000_device::execute_run()
 				m_ipc = m_pc - 2;
 				m_irdi = m_ird;
 
-				if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+				if(debugging)
 					debugger_instruction_hook(m_ipc);
 			}
 			(this->*(m_handlers_f[m_inst_state]))();
@@ -21,6 +21,8 @@ void m68000_mcu_device::execute_run()
 	} else
 		m_count_before_instruction_step = 0;
 
+	bool const debugging = machine().debug_flags & DEBUG_FLAG_ENABLED;
+
 	while(m_bcount && m_icount <= m_bcount)
 		internal_update(total_cycles() + m_icount - m_bcount);
 
@@ -34,7 +36,7 @@ void m68000_mcu_device::execute_run()
 					m_ipc = m_pc - 2;
 					m_irdi = m_ird;
 
-					if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+					if(debugging)
 						debugger_instruction_hook(m_ipc);
 				}
 				(this->*(m_handlers_f[m_inst_state]))();
@@ -24,6 +24,7 @@
 #include "mb86235.h"
 #include "mb86235fe.h"
 #include "mb86235d.h"
+#include "emuopts.h"
 
 
 #define ENABLE_DRC      0
@@ -266,7 +267,7 @@ mb86235_device::mb86235_device(const machine_config &mconfig, const char *tag, d
 	, m_fifoin(*this, finder_base::DUMMY_TAG)
 	, m_fifoout0(*this, finder_base::DUMMY_TAG)
 	, m_fifoout1(*this, finder_base::DUMMY_TAG)
-	, m_cache(CACHE_SIZE + sizeof(mb86235_internal_state))
+	, m_cache(CACHE_SIZE + sizeof(mb86235_internal_state), mconfig.options().huge_pages())
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 {
@@ -14,6 +14,8 @@
 #include "emu.h"
 #include "mips1.h"
 #include "mips1dsm.h"
+
+#include "cpu/hostfp.h"
 #include "softfloat3/source/include/softfloat.h"
 
 #define LOG_TLB     (1U << 1)
@@ -1581,16 +1583,16 @@ void mips1_device_base::handle_cop1(u32 const op)
 			switch (op & 0x3f)
 			{
 			case 0x00: // ADD.S
-				set_cop1_reg(FDREG >> 1, f32_add(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f32_add(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
 				break;
 			case 0x01: // SUB.S
-				set_cop1_reg(FDREG >> 1, f32_sub(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f32_sub(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
 				break;
 			case 0x02: // MUL.S
-				set_cop1_reg(FDREG >> 1, f32_mul(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f32_mul(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
 				break;
 			case 0x03: // DIV.S
-				set_cop1_reg(FDREG >> 1, f32_div(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f32_div(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ u32(m_f[FTREG >> 1]) }).v);
 				break;
 			case 0x05: // ABS.S
 				if (f32_lt(float32_t{ u32(m_f[FSREG >> 1]) }, float32_t{ 0 }))
@@ -1785,16 +1787,16 @@ void mips1_device_base::handle_cop1(u32 const op)
 			switch (op & 0x3f)
 			{
 			case 0x00: // ADD.D
-				set_cop1_reg(FDREG >> 1, f64_add(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f64_add(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
 				break;
 			case 0x01: // SUB.D
-				set_cop1_reg(FDREG >> 1, f64_sub(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f64_sub(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
 				break;
 			case 0x02: // MUL.D
-				set_cop1_reg(FDREG >> 1, f64_mul(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f64_mul(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
 				break;
 			case 0x03: // DIV.D
-				set_cop1_reg(FDREG >> 1, f64_div(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
+				set_cop1_reg(FDREG >> 1, hostfp::f64_div(float64_t{ m_f[FSREG >> 1] }, float64_t{ m_f[FTREG >> 1] }).v);
 				break;
 
 			case 0x05: // ABS.D
@@ -13,6 +13,7 @@
 #include "mips3com.h"
 #include "mips3dsm.h"
 #include "ps2vu.h"
+#include "emuopts.h"
 #include <cmath>
 
 #define ENABLE_OVERFLOWS            (0)
@@ -170,8 +171,9 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, c_dcache_size(0)
 	, c_secondary_cache_line_size(0)
 	, m_fastram_select(0)
+	, m_fastram_driver(0)
 	, m_debugger_temp(0)
-	, m_drc_cache(DRC_CACHE_SIZE + sizeof(internal_mips3_state) + 0x800000)
+	, m_drc_cache(DRC_CACHE_SIZE + sizeof(internal_mips3_state) + 0x800000, mconfig.options().huge_pages())
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -429,6 +431,9 @@ void mips3_device::device_start()
 		}
 	}
 
+	/* plain memory found in the program space is used as fast RAM; drop it when the map changes */
+	m_fastram_notifier = m_program->add_change_notifier([this] (read_or_write mode) { fastram_changed(mode); });
+
 	/* allocate a timer for the compare interrupt */
 	m_compare_int_timer = timer_alloc(FUNC(mips3_device::compare_int_callback), this);
 
@@ -5346,6 +5351,12 @@ void mips3_device::execute_run()
 			code_flush_cache();
 		m_drc_cache_dirty = false;
 
+		/* precompile the hot entry points from the last session; blocks for other modes would be built with the wrong state */
+		if (m_drcuml->warm_caching())
+			for (auto const &entry : m_drcuml->take_warm_entries())
+				if ((entry.first == m_core->mode) && !m_drcuml->hash_exists(entry.first, entry.second))
+					code_compile_block(entry.first, entry.second);
+
 		/* execute */
 		do
 		{
@@ -5355,7 +5366,23 @@ void mips3_device::execute_run()
 			/* if we need to recompile, do it */
 			if (execute_result == EXECUTE_MISSING_CODE)
 			{
-				code_compile_block(m_core->mode, m_core->pc);
+				/* over this frame's compile budget, interpret up to the next compiled block instead */
+				if (m_drcuml->compile_budget_exhausted())
+				{
+					run_interpreter(true);
+					if (m_core->icount <= 0)
+						break;
+				}
+				else if (m_drcuml->compile_budgeted())
+				{
+					const osd_ticks_t start = osd_ticks();
+					code_compile_block(m_core->mode, m_core->pc);
+					m_drcuml->charge_compile(osd_ticks() - start);
+				}
+				else
+				{
+					code_compile_block(m_core->mode, m_core->pc);
+				}
 			}
 			else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			{
@@ -5371,6 +5398,31 @@ void mips3_device::execute_run()
 		return;
 	}
 
+	run_interpreter(false);
+}
+
+
+/*-------------------------------------------------
+    sr_mode - the DRC mode for the current SR,
+    matching generate_update_mode
+-------------------------------------------------*/
+
+uint32_t mips3_device::sr_mode() const
+{
+	const uint32_t sr = m_core->cpr[0][COP0_Status];
+	return ((sr & (SR_EXL | SR_ERL)) ? 0 : ((sr >> 2) & 0x06)) | ((sr >> 26) & 0x01);
+}
+
+
+/*-------------------------------------------------
+    run_interpreter - run the interpreter until
+    out of cycles, or when falling back from the
+    DRC, until reaching code that has already
+    been compiled
+-------------------------------------------------*/
+
+void mips3_device::run_interpreter(bool until_compiled)
+{
 	/* count cycles and interrupt cycles */
 	m_core->icount -= m_interrupt_cycles;
 	m_interrupt_cycles = 0;
@@ -5599,10 +5651,14 @@ void mips3_device::execute_run()
 			elf_loaded = true;
 		}
 #endif
-	} while (m_core->icount > 0 || m_nextpc != ~0);
+	} while ((m_core->icount > 0 || m_nextpc != ~0) && !(until_compiled && m_nextpc == ~0 && m_drcuml->hash_exists(sr_mode(), m_core->pc)));
 
 	m_core->icount -= m_interrupt_cycles;
 	m_interrupt_cycles = 0;
+
+	/* the DRC keeps the mode up to date itself, but the interpreter doesn't */
+	if (until_compiled)
+		m_core->mode = sr_mode();
 }
 
 
@@ -235,7 +235,7 @@ enum {
 	MIPS3_R31H,
 };
 
-#define MIPS3_MAX_FASTRAM       3
+#define MIPS3_MAX_FASTRAM       8
 #define MIPS3_MAX_HOTSPOTS      16
 
 /* COP1 CCR register */
@@ -459,6 +459,8 @@ protected:
 
 	/* fast RAM */
 	uint32_t        m_fastram_select;
+	uint32_t        m_fastram_driver;           /* entries added by the driver, the rest are found in the program space */
+	util::notifier_subscription m_fastram_notifier;
 	struct {
 		offs_t      start;                      /* start of the RAM block */
 		offs_t      end;                        /* end of the RAM block */
@@ -601,6 +603,11 @@ private:
 	void save_fast_iregs(drcuml_block &block);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void set_fastram(uint32_t index, offs_t start, offs_t end, bool readonly, void *base);
+	void find_fastram(std::vector<address_space::direct_range> &ranges) const;
+	void fastram_changed(read_or_write mode);
+	uint32_t sr_mode() const;
+	void run_interpreter(bool until_compiled);
 public:
 	void func_get_cycles();
 	void func_printf_exception();
@@ -176,6 +176,7 @@ uint32_t mips3_device::mips3drc_get_options()
 void mips3_device::clear_fastram(uint32_t select_start)
 {
 	m_fastram_select=select_start;
+	m_fastram_driver=select_start;
 	// Set cache to dirty so that re-mapping occurs
 	m_drc_cache_dirty = true;
 }
@@ -187,21 +188,86 @@ void mips3_device::clear_fastram(uint32_t select_start)
 
 void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base)
 {
-	if (m_fastram_select < std::size(m_fastram))
+	if (m_fastram_driver < std::size(m_fastram))
 	{
-		m_fastram[m_fastram_select].start = start;
-		m_fastram[m_fastram_select].end = end;
-		m_fastram[m_fastram_select].readonly = readonly;
-		m_fastram[m_fastram_select].base = base;
-		m_fastram[m_fastram_select].offset_base8 = (uint8_t*)base - start;
-		m_fastram[m_fastram_select].offset_base16 = (uint16_t*)((uint8_t*)base - start);
-		m_fastram[m_fastram_select].offset_base32 = (uint32_t*)((uint8_t*)base - start);
-		m_fastram_select++;
+		set_fastram(m_fastram_driver++, start, end, readonly, base);
+		// drop any entries found in the program space, they are looked for again after the driver's
+		m_fastram_select = m_fastram_driver;
 		// Set cache to dirty so that re-mapping occurs
 		m_drc_cache_dirty = true;
 	}
 }
 
+/*-------------------------------------------------
+    set_fastram - fill in a fastram entry
+-------------------------------------------------*/
+
+void mips3_device::set_fastram(uint32_t index, offs_t start, offs_t end, bool readonly, void *base)
+{
+	m_fastram[index].start = start;
+	m_fastram[index].end = end;
+	m_fastram[index].readonly = readonly;
+	m_fastram[index].base = base;
+	m_fastram[index].offset_base8 = (uint8_t*)base - start;
+	m_fastram[index].offset_base16 = (uint16_t*)((uint8_t*)base - start);
+	m_fastram[index].offset_base32 = (uint32_t*)((uint8_t*)base - start);
+}
+
+/*-------------------------------------------------
+    find_fastram - plain memory in the program
+    space that can be used as fastram after the
+    driver's entries, largest first
+-------------------------------------------------*/
+
+void mips3_device::find_fastram(std::vector<address_space::direct_range> &ranges) const
+{
+	ranges.clear();
+
+	// the accessors assume memory laid out in 32-bit units
+	if (m_program->data_width() != 32)
+		return;
+
+	m_program->direct_ranges(ranges, 0, m_program->addrmask());
+	auto const overlaps_driver = [this] (const address_space::direct_range &range)
+	{
+		for (uint32_t ramnum = 0; ramnum < m_fastram_driver; ramnum++)
+			if (range.start <= m_fastram[ramnum].end && range.end >= m_fastram[ramnum].start)
+				return true;
+		return false;
+	};
+	ranges.erase(std::remove_if(ranges.begin(), ranges.end(), overlaps_driver), ranges.end());
+	std::stable_sort(ranges.begin(), ranges.end(), [] (const address_space::direct_range &a, const address_space::direct_range &b) { return (a.end - a.start) > (b.end - b.start); });
+	if (ranges.size() > std::size(m_fastram) - m_fastram_driver)
+		ranges.resize(std::size(m_fastram) - m_fastram_driver);
+}
+
+/*-------------------------------------------------
+    fastram_changed - the program space map has
+    changed, so the entries found in it may be
+    stale
+-------------------------------------------------*/
+
+void mips3_device::fastram_changed(read_or_write mode)
+{
+	if (m_fastram_select == m_fastram_driver)
+		return;
+
+	std::vector<address_space::direct_range> ranges;
+	find_fastram(ranges);
+	bool same = (ranges.size() == m_fastram_select - m_fastram_driver);
+	for (size_t index = 0; same && index < ranges.size(); index++)
+	{
+		auto const &entry = m_fastram[m_fastram_driver + index];
+		same = entry.start == ranges[index].start && entry.end == ranges[index].end && entry.base == ranges[index].base && entry.readonly == ranges[index].readonly;
+	}
+	if (!same)
+	{
+		m_fastram_select = m_fastram_driver;
+		m_drc_cache_dirty = true;
+		abort_timeslice();
+	}
+}
+
 
 /*-------------------------------------------------
     mips3drc_add_hotspot - add a new hotspot
@@ -237,6 +303,13 @@ void mips3_device::code_flush_cache()
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
+	/* add the plain memory currently in the program space after the driver's fast RAM */
+	std::vector<address_space::direct_range> ranges;
+	find_fastram(ranges);
+	m_fastram_select = m_fastram_driver;
+	for (const address_space::direct_range &range : ranges)
+		set_fastram(m_fastram_select++, range.start, range.end, range.readonly, range.base);
+
 	try
 	{
 		{
@@ -50,6 +50,7 @@ sonyvu_device::sonyvu_device(
 	, m_delay_pc(0)
 	, m_start_pc(0)
 	, m_running(false)
+	, m_end_pending(false)
 	, m_icount(0)
 {
 }
@@ -106,6 +107,7 @@ void sonyvu_device::device_start()
 	save_item(NAME(m_vcr));
 	save_item(NAME(m_acc));
 	save_item(NAME(m_running));
+	save_item(NAME(m_end_pending));
 	save_item(NAME(m_icount));
 
 	save_item(NAME(m_status_flag));
@@ -176,6 +178,7 @@ void sonyvu_device::device_reset()
 	m_v[3] = 1.0f;
 
 	m_running = false;
+	m_end_pending = false;
 }
 
 device_memory_interface::space_config_vector sonyvu_device::memory_space_config() const
@@ -368,6 +371,7 @@ void sonyvu_device::execute_run()
 
 		debugger_instruction_hook(m_pc);
 
+		const uint32_t pc = m_pc;
 		const uint64_t op = m_micro_mem[(m_pc & m_mem_mask) >> 3];
 		m_pc += 8;
 		if (m_delay_pc != ~0)
@@ -376,6 +380,10 @@ void sonyvu_device::execute_run()
 			m_delay_pc = ~0;
 		}
 
+		// the pair after one with the E bit set is the last one executed
+		const bool end = m_end_pending;
+		m_end_pending = (op & OP_UPPER_E) != 0;
+
 		execute_upper((uint32_t)(op >> 32));
 		if (op & OP_UPPER_I)
 		{
@@ -388,6 +396,17 @@ void sonyvu_device::execute_run()
 		}
 
 		m_icount--;
+
+		if (m_pc == pc)
+		{
+			// stalled (XGKICK with PATH1 busy), so this pair runs again
+			m_end_pending = end;
+		}
+		else if (end)
+		{
+			m_running = false;
+			m_end_pending = false;
+		}
 	}
 }
 
@@ -1050,6 +1069,7 @@ void sonyvu_device::start(uint32_t address)
 {
 	m_pc = address & m_mem_mask;
 	m_running = true;
+	m_end_pending = false;
 }
 
 int16_t sonyvu_device::immediate_s11(const uint32_t op)
@@ -169,6 +169,7 @@ protected:
 	uint32_t        m_start_pc;
 
 	bool            m_running;
+	bool            m_end_pending;
 
 	int             m_icount;
 };
@@ -31,6 +31,7 @@
 
 #include "mips3dsm.h"
 
+#include "cpu/hostfp.h"
 #include "divtlb.h"
 #include "debug/debugcpu.h"
 
@@ -2315,7 +2316,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float32_t const ft = float32_t{ u32(m_f[FTREG]) };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f32_add(fs, ft).v);
+						cp1_set(FDREG, hostfp::f32_add(fs, ft).v);
 				}
 				break;
 			case 0x01: // SUB.S
@@ -2325,7 +2326,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float32_t const ft = float32_t{ u32(m_f[FTREG]) };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f32_sub(fs, ft).v);
+						cp1_set(FDREG, hostfp::f32_sub(fs, ft).v);
 				}
 				break;
 			case 0x02: // MUL.S
@@ -2335,7 +2336,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float32_t const ft = float32_t{ u32(m_f[FTREG]) };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f32_mul(fs, ft).v);
+						cp1_set(FDREG, hostfp::f32_mul(fs, ft).v);
 				}
 				break;
 			case 0x03: // DIV.S
@@ -2345,7 +2346,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float32_t const ft = float32_t{ u32(m_f[FTREG]) };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f32_div(fs, ft).v);
+						cp1_set(FDREG, hostfp::f32_div(fs, ft).v);
 				}
 				break;
 			case 0x04: // SQRT.S
@@ -2354,7 +2355,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float32_t const fs = float32_t{ u32(m_f[FSREG]) };
 
 					if (cp1_op(fs))
-						cp1_set(FDREG, f32_sqrt(fs).v);
+						cp1_set(FDREG, hostfp::f32_sqrt(fs).v);
 				}
 				break;
 			case 0x05: // ABS.S
@@ -2695,7 +2696,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float64_t const ft = float64_t{ m_f[FTREG] };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f64_add(fs, ft).v);
+						cp1_set(FDREG, hostfp::f64_add(fs, ft).v);
 				}
 				break;
 			case 0x01: // SUB.D
@@ -2705,7 +2706,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float64_t const ft = float64_t{ m_f[FTREG] };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f64_sub(fs, ft).v);
+						cp1_set(FDREG, hostfp::f64_sub(fs, ft).v);
 				}
 				break;
 			case 0x02: // MUL.D
@@ -2715,7 +2716,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float64_t const ft = float64_t{ m_f[FTREG] };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f64_mul(fs, ft).v);
+						cp1_set(FDREG, hostfp::f64_mul(fs, ft).v);
 				}
 				break;
 			case 0x03: // DIV.D
@@ -2725,7 +2726,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float64_t const ft = float64_t{ m_f[FTREG] };
 
 					if (cp1_op(fs) && cp1_op(ft))
-						cp1_set(FDREG, f64_div(fs, ft).v);
+						cp1_set(FDREG, hostfp::f64_div(fs, ft).v);
 				}
 				break;
 			case 0x04: // SQRT.D
@@ -2734,7 +2735,7 @@ void r4000_base_device::cp1_execute(u32 const op)
 					float64_t const fs = float64_t{ m_f[FSREG] };
 
 					if (cp1_op(fs))
-						cp1_set(FDREG, f64_sqrt(fs).v);
+						cp1_set(FDREG, hostfp::f64_sqrt(fs).v);
 				}
 				break;
 			case 0x05: // ABS.D
@@ -3247,7 +3248,7 @@ void r5000_device::cp1x_execute(u32 const op)
 			float32_t const ft = float32_t{ u32(m_f[FTREG]) };
 
 			if (cp1_op(fr) && cp1_op(fs) && cp1_op(ft))
-				cp1_set(FDREG, f32_add(f32_mul(fs, ft), fr).v);
+				cp1_set(FDREG, hostfp::f32_add(hostfp::f32_mul(fs, ft), fr).v);
 		}
 		break;
 	case 0x21: // MADD.D
@@ -3258,7 +3259,7 @@ void r5000_device::cp1x_execute(u32 const op)
 			float64_t const ft = float64_t{ m_f[FTREG] };
 
 			if (cp1_op(fr) && cp1_op(fs) && cp1_op(ft))
-				cp1_set(FDREG, f64_add(f64_mul(fs, ft), fr).v);
+				cp1_set(FDREG, hostfp::f64_add(hostfp::f64_mul(fs, ft), fr).v);
 		}
 		break;
 	case 0x28: // MSUB.S
@@ -3269,7 +3270,7 @@ void r5000_device::cp1x_execute(u32 const op)
 			float32_t const ft = float32_t{ u32(m_f[FTREG]) };
 
 			if (cp1_op(fr) && cp1_op(fs) && cp1_op(ft))
-				cp1_set(FDREG, f32_sub(f32_mul(fs, ft), fr).v);
+				cp1_set(FDREG, hostfp::f32_sub(hostfp::f32_mul(fs, ft), fr).v);
 		}
 		break;
 	case 0x29: // MSUB.D
@@ -3280,7 +3281,7 @@ void r5000_device::cp1x_execute(u32 const op)
 			float64_t const ft = float64_t{ m_f[FTREG] };
 
 			if (cp1_op(fr) && cp1_op(fs) && cp1_op(ft))
-				cp1_set(FDREG, f64_sub(f64_mul(fs, ft), fr).v);
+				cp1_set(FDREG, hostfp::f64_sub(hostfp::f64_mul(fs, ft), fr).v);
 		}
 		break;
 	case 0x30: // NMADD.S
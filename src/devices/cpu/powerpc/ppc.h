@@ -29,7 +29,7 @@
 ***************************************************************************/
 
 /* general constants */
-#define PPC_MAX_FASTRAM         4
+#define PPC_MAX_FASTRAM         8
 #define PPC_MAX_HOTSPOTS        16
 
 
@@ -253,6 +253,7 @@ public:
 	void ppccom_execute_mfspr();
 	void ppccom_execute_mftb();
 	void ppccom_execute_mtspr();
+	void ppccom_execute_mtsr();
 	void ppccom_tlb_flush();
 	void ppccom_execute_mfdcr();
 	void ppccom_execute_mtdcr();
@@ -622,6 +623,7 @@ protected:
 
 	uint32_t              m_fastram_select;
 	fast_ram_info       m_fastram[PPC_MAX_FASTRAM];
+	util::notifier_subscription m_fastram_notifier;  /* entries after the driver's are found in the program space */
 
 	/* hotspots */
 	/* hotspot info */
@@ -674,6 +676,8 @@ protected:
 	uint32_t compute_spr(uint32_t spr);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void find_fastram(std::vector<address_space::direct_range> &ranges) const;
+	void fastram_changed(read_or_write mode);
 	void static_generate_entry_point();
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
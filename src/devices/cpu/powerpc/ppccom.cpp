@@ -12,6 +12,7 @@
 #include "ppccom.h"
 #include "ppcfe.h"
 #include "ppc_dasm.h"
+#include "emuopts.h"
 
 /***************************************************************************
     DEBUGGING
@@ -226,7 +227,7 @@ ppc_device::ppc_device(const machine_config &mconfig, device_type type, const ch
 	, m_dcstore_cb(*this)
 	, m_ext_dma_read_cb(*this)
 	, m_ext_dma_write_cb(*this)
-	, m_cache(CACHE_SIZE + sizeof(internal_ppc_state))
+	, m_cache(CACHE_SIZE + sizeof(internal_ppc_state), mconfig.options().huge_pages())
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -742,6 +743,7 @@ void ppc_device::device_start()
 	m_cache_line_size = 32;
 	m_cpu_clock = clock();
 	m_program = &space(AS_PROGRAM);
+	m_fastram_notifier = m_program->add_change_notifier([this] (read_or_write mode) { fastram_changed(mode); });
 	if(m_cap & PPCCAP_4XX)
 	{
 		m_program->cache(m_cache32);
@@ -1536,6 +1538,21 @@ void ppc_device::ppccom_execute_tlbie()
 }
 
 
+/*-------------------------------------------------
+    ppccom_execute_mtsr - execute an MTSR or
+    MTSRIN instruction
+-------------------------------------------------*/
+
+void ppc_device::ppccom_execute_mtsr()
+{
+	/* only the segment's translations depend on it, so set them aside under the old value */
+	uint32_t const segment = m_core->param0 & 0xf;
+	uint32_t const oldvalue = m_core->sr[segment];
+	m_core->sr[segment] = m_core->param1;
+	vtlb_retag_range(segment << 28, (segment << 28) | 0x0fffffff, oldvalue, m_core->param1);
+}
+
+
 /*-------------------------------------------------
     ppccom_execute_tlbia - execute a TLBIA
     instruction
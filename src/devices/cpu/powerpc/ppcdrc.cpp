@@ -231,6 +231,12 @@ void ppc_device::execute_run()
 		code_flush_cache();
 	m_cache_dirty = false;
 
+	/* precompile the hot entry points from the last session; blocks for other modes would be built with the wrong state */
+	if (m_drcuml->warm_caching())
+		for (auto const &entry : m_drcuml->take_warm_entries())
+			if ((entry.first == m_core->mode) && !m_drcuml->hash_exists(entry.first, entry.second))
+				code_compile_block(entry.first, entry.second);
+
 	/* execute */
 	do
 	{
@@ -277,6 +283,62 @@ void ppc_device::ppcdrc_add_fastram(offs_t start, offs_t end, uint8_t readonly,
 }
 
 
+/*-------------------------------------------------
+    find_fastram - plain memory in the program
+    space that can be used as fastram after the
+    driver's entries, largest first
+-------------------------------------------------*/
+
+void ppc_device::find_fastram(std::vector<address_space::direct_range> &ranges) const
+{
+	ranges.clear();
+	m_program->direct_ranges(ranges, 0, m_program->addrmask());
+	auto const overlaps_driver = [this] (const address_space::direct_range &range)
+	{
+		for (uint32_t ramnum = 0; ramnum < m_fastram_select; ramnum++)
+			if (range.start <= m_fastram[ramnum].end && range.end >= m_fastram[ramnum].start)
+				return true;
+		return false;
+	};
+	ranges.erase(std::remove_if(ranges.begin(), ranges.end(), overlaps_driver), ranges.end());
+	std::stable_sort(ranges.begin(), ranges.end(), [] (const address_space::direct_range &a, const address_space::direct_range &b) { return (a.end - a.start) > (b.end - b.start); });
+	if (ranges.size() > std::size(m_fastram) - m_fastram_select)
+		ranges.resize(std::size(m_fastram) - m_fastram_select);
+}
+
+
+/*-------------------------------------------------
+    fastram_changed - the program space map has
+    changed, so the entries found in it may be
+    stale
+-------------------------------------------------*/
+
+void ppc_device::fastram_changed(read_or_write mode)
+{
+	if (m_fastram_select >= std::size(m_fastram) || m_fastram[m_fastram_select].base == nullptr)
+		return;
+
+	std::vector<address_space::direct_range> ranges;
+	find_fastram(ranges);
+	bool same = true;
+	for (uint32_t ramnum = m_fastram_select; same && ramnum < std::size(m_fastram); ramnum++)
+	{
+		size_t const index = ramnum - m_fastram_select;
+		if (index < ranges.size())
+			same = m_fastram[ramnum].start == ranges[index].start && m_fastram[ramnum].end == ranges[index].end && m_fastram[ramnum].base == ranges[index].base && m_fastram[ramnum].readonly == ranges[index].readonly;
+		else
+			same = m_fastram[ramnum].base == nullptr;
+	}
+	if (!same)
+	{
+		for (uint32_t ramnum = m_fastram_select; ramnum < std::size(m_fastram); ramnum++)
+			m_fastram[ramnum].base = nullptr;
+		m_cache_dirty = true;
+		abort_timeslice();
+	}
+}
+
+
 /*-------------------------------------------------
     ppcdrc_add_hotspot - add a new hotspot
 -------------------------------------------------*/
@@ -308,6 +370,18 @@ void ppc_device::code_flush_cache()
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
+	/* fill the fastram entries after the driver's with the plain memory currently in the program space */
+	std::vector<address_space::direct_range> ranges;
+	find_fastram(ranges);
+	for (uint32_t ramnum = m_fastram_select; ramnum < std::size(m_fastram); ramnum++)
+	{
+		size_t const index = ramnum - m_fastram_select;
+		if (index < ranges.size())
+			m_fastram[ramnum] = fast_ram_info{ ranges[index].start, ranges[index].end, ranges[index].readonly, ranges[index].base };
+		else
+			m_fastram[ramnum].base = nullptr;
+	}
+
 	try
 	{
 		/* generate the entry point and out-of-cycles handlers */
@@ -632,6 +706,12 @@ static void cfunc_ppccom_execute_mtspr(void *param)
 	ppc->ppccom_execute_mtspr();
 }
 
+static void cfunc_ppccom_execute_mtsr(void *param)
+{
+	ppc_device *ppc = (ppc_device *)param;
+	ppc->ppccom_execute_mtsr();
+}
+
 static void cfunc_ppccom_tlb_flush(void *param)
 {
 	ppc_device *ppc = (ppc_device *)param;
@@ -3560,14 +3640,15 @@ bool ppc_device::generate_instruction_1f(drcuml_block &block, compiler_state *co
 		}
 
 		case 0x0d2: /* MTSR */
-			UML_MOV(block, SR32(G_SR(op)), R32(G_RS(op)));                                  // mov     sr[G_SR],rs
-			UML_CALLC(block, (c_function)cfunc_ppccom_tlb_flush, this);                                        // callc   ppccom_tlb_flush,ppc
+			UML_MOV(block, mem(&m_core->param0), G_SR(op));                                 // mov     [param0],G_SR
+			UML_MOV(block, mem(&m_core->param1), R32(G_RS(op)));                            // mov     [param1],rs
+			UML_CALLC(block, (c_function)cfunc_ppccom_execute_mtsr, this);                                     // callc   ppccom_execute_mtsr,ppc
 			return true;
 
 		case 0x0f2: /* MTSRIN */
-			UML_SHR(block, I0, R32(G_RB(op)), 28);                              // shr     i0,G_RB,28
-			UML_STORE(block, &m_core->sr[0], I0, R32(G_RS(op)), SIZE_DWORD, SCALE_x4); // store   sr,i0,rs,dword
-			UML_CALLC(block, (c_function)cfunc_ppccom_tlb_flush, this);                            // callc   ppccom_tlb_flush,ppc
+			UML_SHR(block, mem(&m_core->param0), R32(G_RB(op)), 28);                        // shr     [param0],G_RB,28
+			UML_MOV(block, mem(&m_core->param1), R32(G_RS(op)));                            // mov     [param1],rs
+			UML_CALLC(block, (c_function)cfunc_ppccom_execute_mtsr, this);                                     // callc   ppccom_execute_mtsr,ppc
 			return true;
 
 		case 0x200: /* MCRXR */
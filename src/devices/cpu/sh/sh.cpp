@@ -93,6 +93,7 @@ void sh_common_execution::drc_start()
 
 	m_fastram_select = 0;
 	memset(m_fastram, 0, sizeof(m_fastram));
+	m_fastram_notifier = m_program->add_change_notifier([this] (read_or_write mode) { fastram_changed(mode); });
 
 	/* reset per-driver pcflushes */
 	m_pcfsel = 0;
@@ -1953,6 +1954,60 @@ void sh_common_execution::sh2drc_add_fastram(offs_t start, offs_t end, uint8_t r
 	}
 }
 
+/*-------------------------------------------------
+    find_fastram - plain memory in the program
+    space that can be used as fastram after the
+    driver's entries, largest first
+-------------------------------------------------*/
+
+void sh_common_execution::find_fastram(std::vector<address_space::direct_range> &ranges) const
+{
+	ranges.clear();
+	direct_ranges(ranges);
+	auto const overlaps_driver = [this] (const address_space::direct_range &range)
+	{
+		for (uint32_t ramnum = 0; ramnum < m_fastram_select; ramnum++)
+			if (range.start <= m_fastram[ramnum].end && range.end >= m_fastram[ramnum].start)
+				return true;
+		return false;
+	};
+	ranges.erase(std::remove_if(ranges.begin(), ranges.end(), overlaps_driver), ranges.end());
+	std::stable_sort(ranges.begin(), ranges.end(), [] (const address_space::direct_range &a, const address_space::direct_range &b) { return (a.end - a.start) > (b.end - b.start); });
+	if (ranges.size() > std::size(m_fastram) - m_fastram_select)
+		ranges.resize(std::size(m_fastram) - m_fastram_select);
+}
+
+/*-------------------------------------------------
+    fastram_changed - the program space map has
+    changed, so the entries found in it may be
+    stale
+-------------------------------------------------*/
+
+void sh_common_execution::fastram_changed(read_or_write mode)
+{
+	if (m_fastram_select >= std::size(m_fastram) || m_fastram[m_fastram_select].base == nullptr)
+		return;
+
+	std::vector<address_space::direct_range> ranges;
+	find_fastram(ranges);
+	bool same = true;
+	for (uint32_t ramnum = m_fastram_select; same && ramnum < std::size(m_fastram); ramnum++)
+	{
+		size_t const index = ramnum - m_fastram_select;
+		if (index < ranges.size())
+			same = m_fastram[ramnum].start == ranges[index].start && m_fastram[ramnum].end == ranges[index].end && m_fastram[ramnum].base == ranges[index].base && m_fastram[ramnum].readonly == ranges[index].readonly;
+		else
+			same = m_fastram[ramnum].base == nullptr;
+	}
+	if (!same)
+	{
+		for (uint32_t ramnum = m_fastram_select; ramnum < std::size(m_fastram); ramnum++)
+			m_fastram[ramnum].base = nullptr;
+		m_cache_dirty = true;
+		abort_timeslice();
+	}
+}
+
 /***************************************************************************
     INLINE FUNCTIONS
 ***************************************************************************/
@@ -2210,6 +2265,18 @@ void sh_common_execution::code_flush_cache()
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
+	/* fill the fastram entries after the driver's with the plain memory currently in the program space */
+	std::vector<address_space::direct_range> ranges;
+	find_fastram(ranges);
+	for (uint32_t ramnum = m_fastram_select; ramnum < std::size(m_fastram); ramnum++)
+	{
+		size_t const index = ramnum - m_fastram_select;
+		m_fastram[ramnum].start = (index < ranges.size()) ? ranges[index].start : 0;
+		m_fastram[ramnum].end = (index < ranges.size()) ? ranges[index].end : 0;
+		m_fastram[ramnum].readonly = (index < ranges.size()) ? ranges[index].readonly : false;
+		m_fastram[ramnum].base = (index < ranges.size()) ? ranges[index].base : nullptr;
+	}
+
 	try
 	{
 		/* generate the entry point and out-of-cycles handlers */
@@ -2242,6 +2309,12 @@ void sh_common_execution::execute_run_drc()
 	if (m_cache_dirty)
 		code_flush_cache();
 
+	/* precompile the hot entry points from the last session */
+	if (m_drcuml->warm_caching())
+		for (auto const &entry : m_drcuml->take_warm_entries())
+			if ((entry.first == 0) && !m_drcuml->hash_exists(entry.first, entry.second))
+				code_compile_block(0, entry.second);
+
 	/* execute */
 	do
 	{
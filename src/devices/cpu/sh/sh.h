@@ -8,6 +8,7 @@
 
 #include "cpu/drcfe.h"
 #include "cpu/drcuml.h"
+#include "emuopts.h"
 
 /***************************************************************************
     DEBUGGING
@@ -38,7 +39,7 @@
 #define SH2DRC_COMPATIBLE_OPTIONS   (SH2DRC_STRICT_VERIFY | SH2DRC_FLUSH_PC | SH2DRC_STRICT_PCREL)
 #define SH2DRC_FASTEST_OPTIONS  (0)
 
-#define SH2_MAX_FASTRAM       4
+#define SH2_MAX_FASTRAM       8
 
 /* map variables */
 #define MAPVAR_PC                   M0
@@ -104,7 +105,7 @@ public:
 	sh_common_execution(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, endianness_t endianness, address_map_constructor internal)
 		: cpu_device(mconfig, type, tag, owner, clock)
 		, m_sh2_state(nullptr)
-		, m_cache(CACHE_SIZE + sizeof(internal_sh2_state))
+		, m_cache(CACHE_SIZE + sizeof(internal_sh2_state), mconfig.options().huge_pages())
 		, m_drcuml(nullptr)
 		, m_drcoptions(0)
 		, m_entry(nullptr)
@@ -373,6 +374,7 @@ public:
 		bool                readonly;                   /* true if read-only */
 		void *              base;                       /* base in memory where the RAM lives */
 	} m_fastram[SH2_MAX_FASTRAM];
+	util::notifier_subscription m_fastram_notifier;  /* entries after the driver's are found in the program space */
 
 	int m_pcfsel;                 // last pcflush entry set
 	uint32_t m_pcflushes[16];           // pcflush entries
@@ -458,6 +460,7 @@ public:
 
 	virtual void static_generate_entry_point() = 0;
 	virtual void static_generate_memory_accessor(int size, int iswrite, const char *name, uml::code_handle *&handleptr) = 0;
+	virtual void direct_ranges(std::vector<address_space::direct_range> &ranges) const = 0;
 	virtual const opcode_desc* get_desclist(offs_t pc) = 0;
 
 	uint32_t epc(const opcode_desc *desc);
@@ -474,6 +477,8 @@ public:
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
 	void code_flush_cache();
+	void find_fastram(std::vector<address_space::direct_range> &ranges) const;
+	void fastram_changed(read_or_write mode);
 	void execute_run_drc();
 	void code_compile_block(uint8_t mode, offs_t pc);
 
@@ -661,6 +661,18 @@ void sh2_device::generate_update_cycles(drcuml_block &block, compiler_state &com
 	compiler.cycles = 0;
 }
 
+/*------------------------------------------------------------------
+    direct_ranges - plain memory the accessors can reach: below
+    0x40000000 addresses are masked with AM first, which also folds
+    the cache-through mirror
+------------------------------------------------------------------*/
+
+void sh2_device::direct_ranges(std::vector<address_space::direct_range> &ranges) const
+{
+	m_program->direct_ranges(ranges, 0x00000000, m_am & 0x3fffffff);
+	m_program->direct_ranges(ranges, 0x40000000, 0xffffffff);
+}
+
 /*------------------------------------------------------------------
     static_generate_memory_accessor
 ------------------------------------------------------------------*/
@@ -90,6 +90,7 @@ private:
 	virtual void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param, bool allow_exception) override;
 	virtual void static_generate_entry_point() override;
 	virtual void static_generate_memory_accessor(int size, int iswrite, const char *name, uml::code_handle *&handleptr) override;
+	virtual void direct_ranges(std::vector<address_space::direct_range> &ranges) const override;
 
 	address_space_config m_program_config, m_decrypted_program_config;
 
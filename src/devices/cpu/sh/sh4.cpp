@@ -2771,6 +2771,18 @@ void sh34_base_device::static_generate_entry_point()
 }
 
 
+/*------------------------------------------------------------------
+    direct_ranges - plain memory the accessors can reach: below
+    0xe0000000 addresses are masked with AM first, which folds the
+    P1/P2 cached and uncached mirrors onto P0; the store queues are
+    handled separately
+------------------------------------------------------------------*/
+
+void sh34_base_device::direct_ranges(std::vector<address_space::direct_range> &ranges) const
+{
+	m_program->direct_ranges(ranges, 0x00000000, SH34_AM);
+}
+
 /*------------------------------------------------------------------
     static_generate_memory_accessor
 ------------------------------------------------------------------*/
@@ -2807,12 +2819,39 @@ void sh34_base_device::static_generate_memory_accessor(int size, int iswrite, co
 	}
 #endif
 
+	// the store queues are 64 bytes of RAM mirrored through 0xe0000000-0xe3ffffff
+	void *const sqbase = m_program->get_write_ptr(0xe0000000);
+	bool const fastsq = ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0) && sqbase && (m_program->get_read_ptr(0xe0000000) == sqbase);
+
+	int const masklabel = label++;
+	int const donelabel = label++;
 	UML_CMP(block, I0, 0xe0000000);
-	UML_JMPc(block, COND_AE, label);
+	UML_JMPc(block, COND_B, masklabel);
+
+	if (fastsq)
+	{
+		UML_CMP(block, I0, 0xe4000000);     // cmp     i0,0xe4000000
+		UML_JMPc(block, COND_AE, donelabel);    // jae     done
+		UML_AND(block, I0, I0, 0x3f);       // and     i0,i0,0x3f
+		if (size == 1)
+			UML_XOR(block, I0, I0, m_bigendian ? BYTE8_XOR_BE(0) : BYTE8_XOR_LE(0));
+		else if (size == 2)
+			UML_XOR(block, I0, I0, m_bigendian ? WORD2_XOR_BE(0) : WORD2_XOR_LE(0));
+		else if (size == 4)
+			UML_XOR(block, I0, I0, m_bigendian ? DWORD_XOR_BE(0) : DWORD_XOR_LE(0));
+		uml::operand_size const opsize = (size == 1) ? uml::SIZE_BYTE : (size == 2) ? uml::SIZE_WORD : uml::SIZE_DWORD;
+		if (iswrite)
+			UML_STORE(block, sqbase, I0, I1, opsize, SCALE_x1);     // store   sqbase,i0,i1,size
+		else
+			UML_LOAD(block, I0, sqbase, I0, opsize, SCALE_x1);      // load    i0,sqbase,i0,size
+		UML_RET(block);                         // ret
+	}
+	UML_JMP(block, donelabel);
 
+	UML_LABEL(block, masklabel);            // mask:
 	UML_AND(block, I0, I0, SH34_AM);     // and r0, r0, #AM (0x1fffffff)
 
-	UML_LABEL(block, label++);              // label:
+	UML_LABEL(block, donelabel);            // done:
 
 	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
 	{
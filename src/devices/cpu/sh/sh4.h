@@ -670,6 +670,7 @@ protected:
 
 	virtual void static_generate_entry_point() override;
 	virtual void static_generate_memory_accessor(int size, int iswrite, const char *name, uml::code_handle *&handleptr) override;
+	virtual void direct_ranges(std::vector<address_space::direct_range> &ranges) const override;
 
 private:
 	bool            m_bigendian;
@@ -9,6 +9,7 @@
 #include "sharc.h"
 #include "sharcfe.h"
 #include "sharcdsm.h"
+#include "emuopts.h"
 
 
 #define DISABLE_FAST_REGISTERS      1
@@ -80,7 +81,7 @@ adsp21062_device::adsp21062_device(const machine_config &mconfig, const char *ta
 	, m_program_config("program", ENDIANNESS_LITTLE, 64, 24, -3, address_map_constructor(FUNC(adsp21062_device::internal_pgm), this))
 	, m_data_config("data", ENDIANNESS_LITTLE, 32, 32, -2, address_map_constructor(FUNC(adsp21062_device::internal_data), this))
 	, m_boot_mode(BOOT_MODE_HOST)
-	, m_cache(CACHE_SIZE + sizeof(sharc_internal_state))
+	, m_cache(CACHE_SIZE + sizeof(sharc_internal_state), mconfig.options().huge_pages())
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_entry(nullptr)
@@ -24,6 +24,7 @@
 #include "sparc.h"
 #include "sparcdefs.h"
 
+#include "cpu/hostfp.h"
 #include "softfloat3/source/include/softfloat.h"
 
 #define LOG_BIU_CTRL            (1U << 1)
@@ -3915,7 +3916,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		if (get_fpr32(rs2, RS2)) return;
 		m_fpr_pending = 62;
 		const float32_t fs2 = float32_t{ rs2 };
-		set_fpr32(RD, f32_sqrt(fs2).v);
+		set_fpr32(RD, hostfp::f32_sqrt(fs2).v);
 		break;
 	}
 	case FPOP_FSQRTD:
@@ -3924,7 +3925,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		if (get_fpr64(rd2, RS2_D)) return;
 		m_fpr_pending = 120;
 		const float64_t fs2 = float64_t{ rd2 };
-		set_fpr64(RD_D, f64_sqrt(fs2).v);
+		set_fpr64(RD_D, hostfp::f64_sqrt(fs2).v);
 		break;
 	}
 	case FPOP_FADDS:
@@ -3934,7 +3935,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		m_fpr_pending = 8;
 		const float32_t fs1 = float32_t{ rs1 };
 		const float32_t fs2 = float32_t{ rs2 };
-		set_fpr32(RD, f32_add(fs1, fs2).v);
+		set_fpr32(RD, hostfp::f32_add(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FADDD:
@@ -3944,7 +3945,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		m_fpr_pending = 8;
 		const float64_t fs1 = float64_t{ rd1 };
 		const float64_t fs2 = float64_t{ rd2 };
-		set_fpr64(RD_D, f64_add(fs1, fs2).v);
+		set_fpr64(RD_D, hostfp::f64_add(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FSUBS:
@@ -3954,7 +3955,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		m_fpr_pending = 8;
 		const float32_t fs1 = float32_t{ rs1 };
 		const float32_t fs2 = float32_t{ rs2 };
-		set_fpr32(RD, f32_sub(fs1, fs2).v);
+		set_fpr32(RD, hostfp::f32_sub(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FSUBD:
@@ -3964,7 +3965,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		m_fpr_pending = 8;
 		const float64_t fs1 = float64_t{ rd1 };
 		const float64_t fs2 = float64_t{ rd2 };
-		set_fpr64(RD_D, f64_sub(fs1, fs2).v);
+		set_fpr64(RD_D, hostfp::f64_sub(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FMULS:
@@ -3974,7 +3975,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		m_fpr_pending = 8;
 		const float32_t fs1 = float32_t{ rs1 };
 		const float32_t fs2 = float32_t{ rs2 };
-		set_fpr32(RD, f32_mul(fs1, fs2).v);
+		set_fpr32(RD, hostfp::f32_mul(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FMULD:
@@ -3984,7 +3985,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		m_fpr_pending = 14;
 		const float64_t fs1 = float64_t{ rd1 };
 		const float64_t fs2 = float64_t{ rd2 };
-		set_fpr64(RD_D, f64_mul(fs1, fs2).v);
+		set_fpr64(RD_D, hostfp::f64_mul(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FDIVS:
@@ -4000,7 +4001,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		}
 		const float32_t fs1 = float32_t{ rs1 };
 		const float32_t fs2 = float32_t{ rs2 };
-		set_fpr32(RD, f32_div(fs1, fs2).v);
+		set_fpr32(RD, hostfp::f32_div(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FDIVD:
@@ -4016,7 +4017,7 @@ void sparc_base_device::complete_fp_execution(uint32_t op)
 		}
 		const float64_t fs1 = float64_t{ rd1 };
 		const float64_t fs2 = float64_t{ rd2 };
-		set_fpr64(RD_D, f64_div(fs1, fs2).v);
+		set_fpr64(RD_D, hostfp::f64_div(fs1, fs2).v);
 		break;
 	}
 	case FPOP_FITOS:
@@ -97,6 +97,34 @@ inline void tms3203x_device::execute_one()
 }
 
 
+// single-instruction repeat blocks (RPTS, or RPTB with RS == RE): the
+// opcode is fetched once, as the hardware does, and dispatched until the
+// count runs out; the end of the block is left to the main loop
+inline void tms3203x_device::execute_repeat_single()
+{
+	uint32_t const addr = m_pc;
+	uint32_t const op = ROPCODE(addr);
+	auto const handler = s_tms32031ops[op >> 21];
+	while (true)
+	{
+		burn_cycle(1);
+		m_pc++;
+#if (TMS_3203X_LOG_OPCODE_USAGE)
+		m_hits[op >> 21]++;
+#endif
+		(this->*handler)(op);
+
+		// bail if the instruction changed the block or we're out of cycles
+		if (m_icount <= 0 || m_pc != addr + 1 || !(IREG(TMR_ST) & RMFLAG) || IREG(TMR_RS) != addr || IREG(TMR_RE) != addr)
+			return;
+		if ((int32_t)IREG(TMR_RC) <= 0)
+			return;
+		IREG(TMR_RC)--;
+		m_pc = addr;
+	}
+}
+
+
 void tms3203x_device::update_special(int dreg)
 {
 	if (dreg == TMR_BK)
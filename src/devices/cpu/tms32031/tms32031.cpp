@@ -985,7 +985,10 @@ void tms3203x_device::execute_run()
 				continue;
 			}
 
-			execute_one();
+			if ((IREG(TMR_ST) & RMFLAG) && m_pc == IREG(TMR_RS) && m_pc == IREG(TMR_RE))
+				execute_repeat_single();
+			else
+				execute_one();
 		}
 	}
 
@@ -1863,6 +1863,19 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 		m_gfxcycles += 2;
 		m_st |= STBIT_P;
 
+		/* without a raster op the full words don't depend on the destination, so compute them once */
+		uint16_t fullword = 0, fullmask = 0;
+		if (!PIXEL_OP_REQUIRES_SOURCE)
+		{
+			for (x = 0; x < PIXELS_PER_WORD; x++)
+			{
+				uint16_t const mask = PIXEL_MASK << (x * BITS_PER_PIXEL);
+				if (!TRANSPARENCY || (COLOR1() & mask) != 0)
+					fullmask |= mask;
+			}
+			fullword = COLOR1() & fullmask;
+		}
+
 		/* loop over rows */
 		for (y = 0; y < dy; y++)
 		{
@@ -1900,30 +1913,45 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 			}
 
 			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			if (!PIXEL_OP_REQUIRES_SOURCE)
 			{
-				/* fetch the destination word (if necessary) */
-				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (this->*word_read)(dwordaddr << 4);
-				else
-					dstword = 0;
-				dstmask = PIXEL_MASK;
-
-				/* loop over partials */
-				for (x = 0; x < PIXELS_PER_WORD; x++)
+				for (words = 0; words < full_words; words++)
 				{
-					/* process the pixel */
-					pixel = COLOR1() & dstmask;
-					PIXEL_OP(dstword, dstmask, pixel);
-					if (!TRANSPARENCY || pixel != 0)
-						dstword = (dstword & ~dstmask) | pixel;
-
-					/* update the destination */
-					dstmask = dstmask << BITS_PER_PIXEL;
+					/* merge the precomputed word, reading the destination only if some pixels are transparent */
+					if (fullmask != 0xffff)
+						dstword = ((this->*word_read)(dwordaddr << 4) & ~fullmask) | fullword;
+					else
+						dstword = fullword;
+					(this->*word_write)(dwordaddr++ << 4, dstword);
 				}
+			}
+			else
+			{
+				for (words = 0; words < full_words; words++)
+				{
+					/* fetch the destination word (if necessary) */
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						dstword = (this->*word_read)(dwordaddr << 4);
+					else
+						dstword = 0;
+					dstmask = PIXEL_MASK;
 
-				/* write the result */
-				(this->*word_write)(dwordaddr++ << 4, dstword);
+					/* loop over partials */
+					for (x = 0; x < PIXELS_PER_WORD; x++)
+					{
+						/* process the pixel */
+						pixel = COLOR1() & dstmask;
+						PIXEL_OP(dstword, dstmask, pixel);
+						if (!TRANSPARENCY || pixel != 0)
+							dstword = (dstword & ~dstmask) | pixel;
+
+						/* update the destination */
+						dstmask = dstmask << BITS_PER_PIXEL;
+					}
+
+					/* write the result */
+					(this->*word_write)(dwordaddr++ << 4, dstword);
+				}
 			}
 
 			/* handle the right partial word */
@@ -364,6 +364,30 @@ void uml::instruction::configure(opcode_t op, u8 size, parameter p0, parameter p
 }
 
 
+//-------------------------------------------------
+//  param_size - return the size in bytes of the
+//  value a parameter reads or writes
+//-------------------------------------------------
+
+int uml::instruction::param_size(int paramnum) const
+{
+	assert(m_opcode != OP_INVALID && m_opcode < OP_MAX);
+	assert(paramnum < m_numparams);
+
+	switch (s_opcode_info_table[m_opcode].param[paramnum].size)
+	{
+		case PSIZE_4:   return 4;
+		case PSIZE_8:   return 8;
+		case PSIZE_P1:  return 1 << m_param[0].size();
+		case PSIZE_P2:  return 1 << m_param[1].size();
+		case PSIZE_P3:  return 1 << m_param[2].size();
+		case PSIZE_P4:  return 1 << m_param[3].size();
+		default:
+		case PSIZE_OP:  return m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  simplify - simplify instructions that have
 //  immediate values we can evaluate at compile
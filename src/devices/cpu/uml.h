@@ -387,7 +387,10 @@ namespace uml
 		// construction/destruction
 		constexpr instruction() : m_param{ } { }
 
+		bool is_param_in(int paramnum) const { assert(m_opcode < OP_MAX); assert(paramnum < m_numparams); return (s_opcode_info_table[m_opcode].param[paramnum].output & 0x01) != 0; }
 		bool is_param_out(int paramnum) const { assert(m_opcode < OP_MAX); assert(paramnum < m_numparams); return (s_opcode_info_table[m_opcode].param[paramnum].output & 0x02) != 0; }
+		bool param_allows(int paramnum, parameter::parameter_type type) const { assert(m_opcode < OP_MAX); assert(paramnum < m_numparams); return (s_opcode_info_table[m_opcode].param[paramnum].typemask & (1 << type)) != 0; }
+		int param_size(int paramnum) const;
 
 		// getters
 		constexpr opcode_t opcode() const { return m_opcode; }
@@ -396,10 +399,12 @@ namespace uml
 		constexpr u8 size() const { return m_size; }
 		constexpr u8 numparams() const { return m_numparams; }
 		const parameter &param(int index) const { assert(index < m_numparams); return m_param[index]; }
+		static char const *mnemonic(opcode_t opcode) { assert(opcode < OP_MAX); return s_opcode_info_table[opcode].mnemonic; }
 
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_param(int paramnum, parameter const &param) { assert(paramnum < m_numparams); m_param[paramnum] = param; }
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
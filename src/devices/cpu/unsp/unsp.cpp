@@ -21,6 +21,7 @@
 #include "unspfe.h"
 
 #include "unspdasm.h"
+#include "emuopts.h"
 
 #include <climits>
 
@@ -43,7 +44,7 @@ unsp_device::unsp_device(const machine_config &mconfig, device_type type, const
 #if UNSP_LOG_OPCODES || UNSP_LOG_REGS
 	, m_log_ops(0)
 #endif
-	, m_drccache(CACHE_SIZE + sizeof(unsp_device))
+	, m_drccache(CACHE_SIZE + sizeof(unsp_device), mconfig.options().huge_pages())
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
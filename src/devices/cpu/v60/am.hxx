@@ -13,6 +13,46 @@
 #include "am2.hxx" // ReadAMAddress
 #include "am3.hxx" // WriteAM
 
+
+v60_device::am_decode_table v60_device::make_am_decode_table(const am_func (&table)[2][8], const am_func (&g7)[32], const am_func (&g6)[8], const am_func (&g7a)[16], am_func group7, am_func group7a, am_func error4)
+{
+	am_decode_table result;
+	for (int m = 0; m < 2; m++)
+	{
+		for (int val = 0; val < 256; val++)
+		{
+			am_func func = table[m][val >> 5];
+			if (func == group7)
+				func = g7[val & 0x1f];
+			result.mode[m][val] = func;
+		}
+	}
+	for (int val2 = 0; val2 < 256; val2++)
+	{
+		am_func func = g6[val2 >> 5];
+		if (func == group7a)
+			func = (val2 & 0x10) ? g7a[val2 & 0x0f] : error4;
+		result.group6[val2] = func;
+	}
+	return result;
+}
+
+const v60_device::am_decode_table v60_device::s_AMDecode1 = make_am_decode_table(
+		s_AMTable1, s_AMTable1_G7, s_AMTable1_G6, s_AMTable1_G7a,
+		&v60_device::am1Group7, &v60_device::am1Group7a, &v60_device::am1Error4);
+const v60_device::am_decode_table v60_device::s_BAMDecode1 = make_am_decode_table(
+		s_BAMTable1, s_BAMTable1_G7, s_BAMTable1_G6, s_BAMTable1_G7a,
+		&v60_device::bam1Group7, &v60_device::bam1Group7a, &v60_device::bam1Error4);
+const v60_device::am_decode_table v60_device::s_AMDecode2 = make_am_decode_table(
+		s_AMTable2, s_AMTable2_G7, s_AMTable2_G6, s_AMTable2_G7a,
+		&v60_device::am2Group7, &v60_device::am2Group7a, &v60_device::am2Error4);
+const v60_device::am_decode_table v60_device::s_BAMDecode2 = make_am_decode_table(
+		s_BAMTable2, s_BAMTable2_G7, s_BAMTable2_G6, s_BAMTable2_G7a,
+		&v60_device::bam2Group7, &v60_device::bam2Group7a, &v60_device::bam2Error4);
+const v60_device::am_decode_table v60_device::s_AMDecode3 = make_am_decode_table(
+		s_AMTable3, s_AMTable3_G7, s_AMTable3_G6, s_AMTable3_G7a,
+		&v60_device::am3Group7, &v60_device::am3Group7a, &v60_device::am3Error4);
+
 /*
   Input:
   m_modadd
@@ -27,14 +67,14 @@ uint32_t v60_device::ReadAM()
 {
 	m_modm = m_modm?1:0;
 	m_modval = OpRead8(m_modadd);
-	return (this->*s_AMTable1[m_modm][m_modval >> 5])();
+	return (this->*s_AMDecode1.mode[m_modm][m_modval])();
 }
 
 uint32_t v60_device::BitReadAM()
 {
 	m_modm = m_modm?1:0;
 	m_modval = OpRead8(m_modadd);
-	return (this->*s_BAMTable1[m_modm][m_modval >> 5])();
+	return (this->*s_BAMDecode1.mode[m_modm][m_modval])();
 }
 
 
@@ -54,14 +94,14 @@ uint32_t v60_device::ReadAMAddress()
 {
 	m_modm = m_modm?1:0;
 	m_modval = OpRead8(m_modadd);
-	return (this->*s_AMTable2[m_modm][m_modval >> 5])();
+	return (this->*s_AMDecode2.mode[m_modm][m_modval])();
 }
 
 uint32_t v60_device::BitReadAMAddress()
 {
 	m_modm = m_modm?1:0;
 	m_modval = OpRead8(m_modadd);
-	return (this->*s_BAMTable2[m_modm][m_modval >> 5])();
+	return (this->*s_BAMDecode2.mode[m_modm][m_modval])();
 }
 
 /*
@@ -79,5 +119,5 @@ uint32_t v60_device::WriteAM()
 {
 	m_modm = m_modm?1:0;
 	m_modval = OpRead8(m_modadd);
-	return (this->*s_AMTable3[m_modm][m_modval >> 5])();
+	return (this->*s_AMDecode3.mode[m_modm][m_modval])();
 }
@@ -1300,13 +1300,13 @@ const v60_device::am_func v60_device::s_BAMTable1_G6[8] =
 uint32_t v60_device::am1Group6()
 {
 	m_modval2 = OpRead8(m_modadd + 1);
-	return (this->*s_AMTable1_G6[m_modval2 >> 5])();
+	return (this->*s_AMDecode1.group6[m_modval2])();
 }
 
 uint32_t v60_device::bam1Group6()
 {
 	m_modval2 = OpRead8(m_modadd + 1);
-	return (this->*s_BAMTable1_G6[m_modval2 >> 5])();
+	return (this->*s_BAMDecode1.group6[m_modval2])();
 }
 
 
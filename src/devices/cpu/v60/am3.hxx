@@ -839,7 +839,7 @@ const v60_device::am_func v60_device::s_AMTable3_G6[8] =
 uint32_t v60_device::am3Group6()
 {
 	m_modval2 = OpRead8(m_modadd + 1);
-	return (this->*s_AMTable3_G6[m_modval2 >> 5])();
+	return (this->*s_AMDecode3.group6[m_modval2])();
 }
 
 
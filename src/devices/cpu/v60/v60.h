@@ -137,6 +137,23 @@ private:
 	static const am_func s_AMTable3_G7[32];
 	static const am_func s_AMTable3_G6[8];
 	static const am_func s_AMTable3[2][8];
+
+	// the tables above flattened so that one lookup on the mode byte (and
+	// on the second byte for group 6) finds the final handler
+	struct am_decode_table
+	{
+		am_func mode[2][256];
+		am_func group6[256];
+	};
+
+	static am_decode_table make_am_decode_table(const am_func (&table)[2][8], const am_func (&g7)[32], const am_func (&g6)[8], const am_func (&g7a)[16], am_func group7, am_func group7a, am_func error4);
+
+	static const am_decode_table s_AMDecode1;
+	static const am_decode_table s_BAMDecode1;
+	static const am_decode_table s_AMDecode2;
+	static const am_decode_table s_BAMDecode2;
+	static const am_decode_table s_AMDecode3;
+
 	static const am_func s_Op5FTable[32];
 	static const am_func s_Op5CTable[32];
 	static const op6_func s_OpC6Table[8];
@@ -464,6 +464,19 @@ void z80_device::set_f(u8 f)
 	F = f;
 }
 
+/***************************************************************
+ * Digest of the registers for idle loop detection - the refresh
+ * register counts every fetch, so it's left out
+ ***************************************************************/
+u64 z80_device::idle_state() const
+{
+	u64 state = (u64(m_sp.w) << 48) | (u64(m_af.w) << 32) | (u64(m_bc.w) << 16) | m_de.w;
+	state = (state * 0x9e3779b97f4a7c15U) ^ ((u64(m_hl.w) << 48) | (u64(m_ix.w) << 32) | (u64(m_iy.w) << 16) | m_wz.w);
+	state = (state * 0x9e3779b97f4a7c15U) ^ ((u64(m_af2.w) << 48) | (u64(m_bc2.w) << 32) | (u64(m_de2.w) << 16) | m_hl2.w);
+	state = (state * 0x9e3779b97f4a7c15U) ^ ((u64(m_i) << 24) | (u64(m_im) << 16) | (u64(m_iff1) << 9) | (u64(m_iff2) << 8) | m_halt);
+	return state;
+}
+
 void z80_device::illegal_1()
 {
 	LOGMASKED(LOG_UNDOC, "ill. opcode $%02x $%02x ($%04x)\n",
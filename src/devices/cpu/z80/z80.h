@@ -120,6 +120,7 @@ protected:
 	void ei();
 	void set_f(u8 f);
 	void block_io_interrupted_flags();
+	u64 idle_state() const;
 
 	virtual void do_op();
 
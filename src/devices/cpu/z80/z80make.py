@@ -56,13 +56,53 @@ class Opcode:
     def add_source_lines(self, lines):
         self.source.extend(lines)
 
+    def max_cycles(self):
+        # Upper bound on the cycles taken by a whole instruction: the sum of
+        # every cycle count in it, whichever branches are taken
+        fixed = 0
+        counts = {}
+        for il in self.source:
+            tokens = il.line().split()
+            if tokens[0] == '+':
+                cycles = " ".join(tokens[1:])
+            elif (len(tokens) > 2 and tokens[1] == "!!"):
+                cycles = tokens[0]
+            else:
+                continue
+            if cycles.isdigit():
+                fixed += int(cycles)
+            else:
+                counts[cycles] = counts.get(cycles, 0) + 1
+        terms = []
+        for cycles in sorted(counts):
+            if counts[cycles] == 1:
+                terms.append("(%s)" % (cycles))
+            else:
+                terms.append("%d * (%s)" % (counts[cycles], cycles))
+        terms.append("%d" % (fixed))
+        return " + ".join(terms)
+
     def save_dasm(self, f):
         code = self.code
         has_steps = len(self.source) > 1
         if has_steps:
+            # Starting with more cycles than the instruction can take, it can
+            # only run out at a memory or I/O access (wait states, or an
+            # access to be redone), so the other steps in between needn't
+            # check m_icount or be resumable
+            print("\t\tif (u8(m_ref) == 0x00 && m_icount > %s) {" % (self.max_cycles()), file=f)
+            self.save_steps(f, True)
+            print("\t\t\tbreak;", file=f)
+            print("\t\t}", file=f)
             print("\t\tswitch (u8(m_ref))", file=f)
             print("\t\t{", file=f)
             print("\t\tcase 0x00:", file=f)
+        self.save_steps(f, False)
+        if has_steps:
+            print("\t\t\tbreak;\n", file=f)
+            print("\t\t}", file=f)
+
+    def save_steps(self, f, fast):
         step = 0
         for i in range(0, len(self.source)):
             il = self.source[i]
@@ -71,6 +111,8 @@ class Opcode:
             if tokens[0] == '+':
                 il.print("m_icount -= %s;" % (" ".join(tokens[1:])), f)
                 step += 1
+                if fast:
+                    continue
                 to_step = "0x%s" % (hex(256 + step)[3:])
                 il.print("if (m_icount <= 0) {", f)
                 il.print("	m_ref = (m_ref & 0xffff00) | %s;" % (to_step), f)
@@ -79,9 +121,10 @@ class Opcode:
                 il.print("[[fallthrough]];", f)
                 print("\t\tcase %s:" % (to_step), file=f)
             elif (len(tokens) > 2 and tokens[1] == "!!"):
-                il.print("[[fallthrough]];", f)
                 step += 1;
-                print("\t\tcase 0x%s:" % (hex(256 + step)[3:]), file=f)
+                if not fast:
+                    il.print("[[fallthrough]];", f)
+                    print("\t\tcase 0x%s:" % (hex(256 + step)[3:]), file=f)
                 il.print("%s" % " ".join(tokens[2:]), f)
                 il.print("m_icount -= %s;" % (tokens[0]), f)
                 il.print("if (m_icount <= 0) {", f)
@@ -94,13 +137,11 @@ class Opcode:
                 il.print("		m_ref = (m_ref & 0xffff00) | %s;" % (to_step), f)
                 il.print("	return;", f)
                 il.print("}", f)
-                il.print("[[fallthrough]];", f)
-                print("\t\tcase %s:" % (to_step), file=f)
+                if not fast:
+                    il.print("[[fallthrough]];", f)
+                    print("\t\tcase %s:" % (to_step), file=f)
             else:
                 il.print("%s" % line, f)
-        if has_steps:
-            print("\t\t\tbreak;\n", file=f)
-            print("\t\t}", file=f)
 
 class Macro:
     def __init__(self, name, arg_name = None):
@@ -220,6 +261,9 @@ class OpcodeList:
 
     def save_exec(self, f):
         prefix = None
+        # Instructions follow on from their fetch and any prefixes without
+        # returning: the source uses continue to move to the next state
+        print("do {", file=f)
         print("switch (u8(m_ref >> 16)) // prefix", file=f)
         print("{", file=f)
         for opc in self.opcode_info:
@@ -249,6 +293,7 @@ class OpcodeList:
         print("} // switch prefix", file=f)
         print("", file=f)
         print("m_ref = 0xffff00;", file=f)
+        print("} while (m_icount > 0);", file=f)
 
 def main(argv):
     if len(argv) != 3 and len(argv) != 4:
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "cassette.h"
+#include "emuopts.h"
 #include "softlist_dev.h"
 
 #include "formats/imageutl.h"
@@ -50,7 +51,9 @@ cassette_image_device::cassette_image_device(const machine_config &mconfig, cons
 	m_create_opts(nullptr),
 	m_default_state(CASSETTE_PLAY),
 	m_interface(nullptr),
-	m_stereo(false)
+	m_stereo(false),
+	m_turbo_allowed(false),
+	m_turbo(false)
 {
 }
 
@@ -97,7 +100,7 @@ void cassette_image_device::update()
 		case CASSETTE_PLAY:
 			if (m_cassette)
 			{
-				m_cassette->get_sample(m_channel, new_position, 0.0, &m_value);
+				m_value = m_cassette->sample_at(m_channel, new_position);
 				// See if reached end of tape
 				double length = get_length();
 				if (new_position > length)
@@ -130,6 +133,35 @@ void cassette_image_device::change_state(cassette_state state, cassette_state ma
 	{
 		update();
 		m_state = new_state;
+		update_turbo(false);
+	}
+}
+
+
+//-------------------------------------------------
+//  update_turbo - enter turbo mode when the
+//  system starts reading a playing tape, and
+//  leave it when the tape or its motor stops
+//-------------------------------------------------
+
+void cassette_image_device::update_turbo(bool reading)
+{
+	bool const active = m_turbo_allowed && m_cassette && is_playing() && motor_on();
+	if (active && reading && !m_turbo)
+	{
+		// don't take over turbo mode something else started
+		if (!machine().video().turbo())
+		{
+			LOGMASKED(LOG_DETAIL, "cassette: entering turbo mode at %g\n", m_position);
+			machine().video().set_turbo(true);
+			m_turbo = true;
+		}
+	}
+	else if (!active && m_turbo)
+	{
+		LOGMASKED(LOG_DETAIL, "cassette: leaving turbo mode at %g\n", m_position);
+		machine().video().set_turbo(false);
+		m_turbo = false;
 	}
 }
 
@@ -138,6 +170,7 @@ void cassette_image_device::change_state(cassette_state state, cassette_state ma
 double cassette_image_device::input()
 {
 	update();
+	update_turbo(true);
 	int32_t sample = m_value;
 	double double_value = sample / (double(0x7FFFFFFF));
 
@@ -241,6 +274,8 @@ void cassette_image_device::device_start()
 	m_cassette = nullptr;
 	m_state = m_default_state;
 	m_value = 0;
+	m_turbo_allowed = machine().options().cassette_turbo();
+	m_turbo = false;
 
 	stream_alloc(0, m_stereo? 2:1, machine().sample_rate());
 }
@@ -452,7 +487,8 @@ void cassette_image_device::sound_stream_update(sound_stream &stream, std::vecto
 {
 	cassette_state state = get_state() & (CASSETTE_MASK_UISTATE | CASSETTE_MASK_MOTOR | CASSETTE_MASK_SPEAKER);
 
-	if (exists() && (state == (CASSETTE_PLAY | CASSETTE_MOTOR_ENABLED | CASSETTE_SPEAKER_ENABLED)))
+	// nothing is heard in turbo mode, so don't bother fetching the waveform
+	if (exists() && (state == (CASSETTE_PLAY | CASSETTE_MOTOR_ENABLED | CASSETTE_SPEAKER_ENABLED)) && !machine().video().turbo())
 	{
 		cassette_image *cassette = get_image();
 		double time_index = get_position();
@@ -116,6 +116,7 @@ protected:
 	virtual const software_list_loader &get_software_list_loader() const override;
 
 	void update();
+	void update_turbo(bool reading);
 
 private:
 	cassette_image::ptr m_cassette;
@@ -136,6 +137,8 @@ private:
 	bool has_any_extension(std::string_view candidate_extensions) const;
 	bool            m_stereo;
 	std::vector<s16> m_samples;
+	bool            m_turbo_allowed; // run in turbo mode while the tape is being read
+	bool            m_turbo; // turbo mode was entered for this tape
 };
 
 // device type definition
@@ -30,11 +30,14 @@
 
 #include "formats/imageutl.h"
 
+#include "util/hashing.h"
 #include "util/ioprocs.h"
 #include "util/ioprocsfilter.h"
 #include "util/zippath.h"
 
 #include <algorithm>
+#include <list>
+#include <mutex>
 
 /*
     Debugging flags. Set to 0 or 1.
@@ -48,6 +51,105 @@
 
 #define FLOPSND_TAG "floppysound"
 
+namespace {
+
+// What a converted image depends on: the file contents, the format
+// used and the drive it's converted for
+struct converted_image_key
+{
+	std::string format;
+	uint32_t form_factor = 0;
+	std::vector<uint32_t> variants;
+	int tracks = 0, sides = 0;
+	uint64_t length = 0;
+	util::sha1_t hash;
+
+	bool operator==(const converted_image_key &that) const
+	{
+		return format == that.format && form_factor == that.form_factor && variants == that.variants &&
+				tracks == that.tracks && sides == that.sides && length == that.length && hash == that.hash;
+	}
+
+	static bool make(converted_image_key &key, util::random_read &io, const floppy_image_format_t &format, uint32_t form_factor, const std::vector<uint32_t> &variants, int tracks, int sides)
+	{
+		if(io.length(key.length))
+			return false;
+
+		util::sha1_creator sha1;
+		std::vector<uint8_t> buf(0x10000);
+		for(uint64_t offset = 0; offset < key.length; ) {
+			auto const [err, actual] = util::read_at(io, offset, buf.data(), size_t(std::min<uint64_t>(buf.size(), key.length - offset)));
+			if(err || !actual)
+				return false;
+			sha1.append(buf.data(), uint32_t(actual));
+			offset += actual;
+		}
+
+		key.format = format.name();
+		key.form_factor = form_factor;
+		key.variants = variants;
+		key.tracks = tracks;
+		key.sides = sides;
+		key.hash = sha1.finish();
+		return true;
+	}
+};
+
+// Images converted recently, so swapping back to a disk doesn't convert
+// it again.  A disk that has been written to since hashes differently,
+// so a stale entry is never found.
+class converted_image_cache
+{
+public:
+	std::unique_ptr<floppy_image> find(const converted_image_key &key)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for(auto it = m_entries.begin(); it != m_entries.end(); ++it)
+			if(it->key == key) {
+				m_entries.splice(m_entries.begin(), m_entries, it);
+				return std::make_unique<floppy_image>(*it->image);
+			}
+		return nullptr;
+	}
+
+	void add(converted_image_key &&key, const floppy_image &image)
+	{
+		size_t size = 0;
+		for(int track = 0; track != key.tracks; track++)
+			for(int head = 0; head != key.sides; head++)
+				for(int subtrack = 0; subtrack != 4; subtrack++)
+					size += image.get_buffer(track, head, subtrack).size() * sizeof(uint32_t);
+		if(size > MAX_SIZE)
+			return;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries.push_front(entry{ std::move(key), std::make_unique<floppy_image>(image), size });
+		m_size += size;
+		while(m_size > MAX_SIZE) {
+			m_size -= m_entries.back().size;
+			m_entries.pop_back();
+		}
+	}
+
+private:
+	static constexpr size_t MAX_SIZE = 64 << 20;
+
+	struct entry
+	{
+		converted_image_key key;
+		std::unique_ptr<floppy_image> image;
+		size_t size;
+	};
+
+	std::mutex m_mutex;
+	std::list<entry> m_entries;
+	size_t m_size = 0;
+};
+
+converted_image_cache s_converted_images;
+
+} // anonymous namespace
+
 // device type definition
 DEFINE_DEVICE_TYPE(FLOPPY_CONNECTOR, floppy_connector, "floppy_connector", "Floppy drive connector abstraction")
 
@@ -269,8 +371,12 @@ floppy_image_device::floppy_image_device(const machine_config &mconfig, device_t
 		m_cyl(0),
 		m_subcyl(0),
 		m_amplifier_freakout_time(attotime::from_usec(16)),
+		m_flux_track(nullptr),
 		m_image_dirty(false),
 		m_track_dirty(false),
+		m_commit_queue(nullptr),
+		m_commit_item(nullptr),
+		m_commit_format(nullptr),
 		m_ready_counter(0),
 		m_make_sound(false),
 		m_sound_out(nullptr)
@@ -284,6 +390,12 @@ floppy_image_device::floppy_image_device(const machine_config &mconfig, device_t
 
 floppy_image_device::~floppy_image_device()
 {
+	if(m_commit_queue) {
+		osd_work_queue_wait(m_commit_queue, osd_ticks_per_second() * 100);
+		if(m_commit_item)
+			osd_work_item_release(m_commit_item);
+		osd_work_queue_free(m_commit_queue);
+	}
 }
 
 void floppy_image_device::setup_load_cb(load_cb cb)
@@ -455,6 +567,7 @@ void floppy_image_device::set_rpm(float _rpm)
 	m_rpm = _rpm;
 	m_rev_time = attotime::from_double(60/m_rpm);
 	m_angular_speed = m_rpm/60.0*2e8;
+	cache_clear();
 }
 
 void floppy_image_device::set_sectoring_type(uint32_t sectoring_type)
@@ -476,22 +589,60 @@ void floppy_image_device::setup_write(const floppy_image_format_t *_output_forma
 
 void floppy_image_device::commit_image()
 {
+	commit_wait();
+
 	m_image_dirty = false;
 	if(!m_output_format || !m_output_format->supports_save())
 		return;
 
 	check_for_file();
+
+	// Encoding can take a while, so it's done from a snapshot of the
+	// image while emulation carries on; anything else that touches the
+	// file waits for it first
+	m_commit_image = std::make_unique<floppy_image>(*m_image);
+	m_commit_format = m_output_format;
+	if(m_commit_queue)
+		m_commit_item = osd_work_item_queue(m_commit_queue, &floppy_image_device::commit_callback, this, 0);
+	if(!m_commit_item) {
+		commit_run();
+		commit_wait();
+	}
+}
+
+void floppy_image_device::commit_wait()
+{
+	if(m_commit_item) {
+		osd_work_item_wait(m_commit_item, osd_ticks_per_second() * 100);
+		osd_work_item_release(m_commit_item);
+		m_commit_item = nullptr;
+	}
+	m_commit_image.reset();
+
+	if(m_commit_error == std::errc::not_enough_memory)
+		popmessage("Error, out of memory");
+	else if(m_commit_error)
+		popmessage("Error, unable to truncate image: %s", m_commit_error.message());
+	m_commit_error.clear();
+}
+
+void floppy_image_device::commit_run()
+{
 	auto io = util::random_read_write_fill(image_core_file(), 0xff);
 	if(!io) {
-		popmessage("Error, out of memory");
+		m_commit_error = std::errc::not_enough_memory;
 		return;
 	}
 
-	std::error_condition const err = image_core_file().truncate(0);
-	if (err)
-		popmessage("Error, unable to truncate image: %s", err.message());
+	m_commit_error = image_core_file().truncate(0);
 
-	m_output_format->save(*io, m_variants, *m_image);
+	m_commit_format->save(*io, m_variants, *m_commit_image);
+}
+
+void *floppy_image_device::commit_callback(void *param, int threadid)
+{
+	reinterpret_cast<floppy_image_device *>(param)->commit_run();
+	return nullptr;
 }
 
 void floppy_image_device::device_config_complete()
@@ -539,6 +690,9 @@ void floppy_image_device::device_start()
 	m_ready_counter = 0;
 	m_phases = 0;
 
+	if(!m_commit_queue)
+		m_commit_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
 
 	if (m_make_sound) m_sound_out = subdevice<floppy_sound_device>(FLOPSND_TAG);
 
@@ -563,6 +717,7 @@ void floppy_image_device::device_start()
 	save_item(NAME(m_subcyl));
 	save_item(NAME(m_cache_start_time));
 	save_item(NAME(m_cache_end_time));
+	save_item(NAME(m_cache_base));
 	save_item(NAME(m_cache_index));
 	save_item(NAME(m_cache_entry));
 	save_item(NAME(m_cache_weak));
@@ -646,6 +801,7 @@ void floppy_image_device::init_floppy_load(bool write_supported)
 
 std::pair<std::error_condition, std::string> floppy_image_device::call_load()
 {
+	commit_wait();
 	check_for_file();
 	auto io = util::random_read_fill(image_core_file(), 0xff);
 	if(!io)
@@ -666,10 +822,17 @@ std::pair<std::error_condition, std::string> floppy_image_device::call_load()
 	if (!best_format)
 		return std::make_pair(image_error::INVALIDIMAGE, "Unable to identify image file format");
 
-	m_image = std::make_unique<floppy_image>(m_tracks, m_sides, m_form_factor);
-	if (!best_format->load(*io, m_form_factor, m_variants, *m_image)) {
-		m_image.reset();
-		return std::make_pair(image_error::INVALIDIMAGE, "Incompatible image file format or corrupted data");
+	converted_image_key key;
+	bool const cacheable = converted_image_key::make(key, *io, *best_format, m_form_factor, m_variants, m_tracks, m_sides);
+	m_image = cacheable ? s_converted_images.find(key) : nullptr;
+	if (!m_image) {
+		m_image = std::make_unique<floppy_image>(m_tracks, m_sides, m_form_factor);
+		if (!best_format->load(*io, m_form_factor, m_variants, *m_image)) {
+			m_image.reset();
+			return std::make_pair(image_error::INVALIDIMAGE, "Incompatible image file format or corrupted data");
+		}
+		if (cacheable)
+			s_converted_images.add(std::move(key), *m_image);
 	}
 	m_output_format = is_readonly() ? nullptr : best_format;
 
@@ -691,6 +854,7 @@ void floppy_image_device::call_unload()
 	if (m_image) {
 		if(m_image_dirty)
 			commit_image();
+		commit_wait();
 		m_image.reset();
 	}
 
@@ -715,6 +879,7 @@ void floppy_image_device::call_unload()
 
 std::pair<std::error_condition, std::string> floppy_image_device::call_create(int format_type, util::option_resolution *format_options)
 {
+	commit_wait();
 	m_image = std::make_unique<floppy_image>(m_tracks, m_sides, m_form_factor);
 	m_output_format = nullptr;
 
@@ -1037,12 +1202,27 @@ attotime floppy_image_device::position_to_time(const attotime &base, int positio
 	return base + attotime::from_double(position/m_angular_speed);
 }
 
+bool floppy_image_device::flux_times_update(const std::vector<uint32_t> &buf)
+{
+	// The times are the same ones position_to_time gives, worked out
+	// once per track rather than once per transition
+	if(m_flux_track == &buf && m_flux_times.size() == buf.size())
+		return false;
+
+	m_flux_track = &buf;
+	m_flux_times.resize(buf.size());
+	for(size_t i = 0; i != buf.size(); i++)
+		m_flux_times[i] = attotime::from_double((buf[i] & floppy_image::TIME_MASK)/m_angular_speed);
+	return true;
+}
+
 void floppy_image_device::cache_fill_index(const std::vector<uint32_t> &buf, int &index, attotime &base)
 {
 	int cells = buf.size();
 
 	m_cache_index = index;
-	m_cache_start_time = position_to_time(base, buf[index] & floppy_image::TIME_MASK);
+	m_cache_base = base;
+	m_cache_start_time = base + m_flux_times[index];
 	m_cache_entry = buf[m_cache_index];
 
 	index ++;
@@ -1051,15 +1231,17 @@ void floppy_image_device::cache_fill_index(const std::vector<uint32_t> &buf, int
 		base += m_rev_time;
 	}
 
-	m_cache_end_time = position_to_time(base, buf[index] & floppy_image::TIME_MASK);
+	m_cache_end_time = base + m_flux_times[index];
 }
 
 void floppy_image_device::cache_clear()
 {
 	m_cache_start_time = m_cache_end_time = m_cache_weak_start = attotime::zero;
+	m_cache_base = attotime::zero;
 	m_cache_index = 0;
 	m_cache_entry = 0;
 	m_cache_weak = false;
+	m_flux_track = nullptr;
 }
 
 void floppy_image_device::cache_fill(const attotime &when)
@@ -1075,19 +1257,40 @@ void floppy_image_device::cache_fill(const attotime &when)
 		return;
 	}
 
+	bool const rebuilt = flux_times_update(buf);
+
+	// Controllers mostly read the track in order, so when the cached
+	// transition is still valid and the time asked for is just past it,
+	// step forward rather than searching
 	attotime base;
-	uint32_t position = find_position(base, when);
+	int index;
+	if(!rebuilt && !m_cache_start_time.is_zero() && when >= m_cache_end_time) {
+		index = m_cache_index;
+		base = m_cache_base;
+		for(int step = 0; step != 4; step++) {
+			if(++index >= int(cells)) {
+				index = 0;
+				base += m_rev_time;
+			}
+			int next = index;
+			attotime next_base = base;
+			cache_fill_index(buf, next, next_base);
+			if(m_cache_end_time > when) {
+				cache_weakness_setup();
+				return;
+			}
+		}
+	}
 
-	auto const it = std::upper_bound(
-			buf.begin(), buf.end(), position,
-			[] (uint32_t a, uint32_t b) { return a < (b & floppy_image::TIME_MASK); });
+	find_position(base, when);
 
-	int index;
-	if(buf.begin() == it) {
+	auto const it = std::upper_bound(m_flux_times.begin(), m_flux_times.end(), when - base);
+
+	if(m_flux_times.begin() == it) {
 		base -= m_rev_time;
 		index = buf.size() - 1;
 	} else {
-		index = int(it - buf.begin()) - 1;
+		index = int(it - m_flux_times.begin()) - 1;
 	}
 
 	for(;;) {
@@ -1143,6 +1346,21 @@ attotime floppy_image_device::get_next_transition(const attotime &from_when)
 	}
 }
 
+int floppy_image_device::get_transitions(const attotime &from_when, const attotime &limit, attotime *transitions, int count)
+{
+	// Fill in up to count transitions after from_when and no later than
+	// limit, returning how many there were
+	int found = 0;
+	attotime when = from_when;
+	while(found != count) {
+		when = get_next_transition(when);
+		if(when.is_never() || when > limit)
+			break;
+		transitions[found++] = when;
+	}
+	return found;
+}
+
 bool floppy_image_device::writing_disabled() const
 {
 	// Disable writing when write protect is on or when, in the diskii
@@ -147,6 +147,7 @@ public:
 
 	attotime time_next_index();
 	attotime get_next_transition(const attotime &from_when);
+	int get_transitions(const attotime &from_when, const attotime &limit, attotime *transitions, int count);
 	void write_flux(const attotime &start, const attotime &end, int transition_count, const attotime *transitions);
 	void set_write_splice(const attotime &when);
 	int get_sides() { return m_sides; }
@@ -230,12 +231,23 @@ protected:
 	int m_cyl, m_subcyl;
 	/* Current floppy zone cache */
 	attotime m_cache_start_time, m_cache_end_time, m_cache_weak_start;
+	attotime m_cache_base;
 	attotime m_amplifier_freakout_time;
 	int m_cache_index;
 	u32 m_cache_entry;
 	bool m_cache_weak;
+	/* Offset of each flux transition on the cached track from the start of a revolution */
+	std::vector<attotime> m_flux_times;
+	const std::vector<uint32_t> *m_flux_track;
 
 	bool m_image_dirty, m_track_dirty;
+
+	/* Write back to the image file, done on a worker thread from a copy of the image */
+	osd_work_queue *m_commit_queue;
+	osd_work_item *m_commit_item;
+	std::unique_ptr<floppy_image> m_commit_image;
+	const floppy_image_format_t *m_commit_format;
+	std::error_condition m_commit_error;
 	int m_ready_counter;
 
 	load_cb m_cur_load_cb;
@@ -265,10 +277,14 @@ protected:
 	attotime position_to_time(const attotime &base, int position) const;
 
 	void commit_image();
+	void commit_wait();
+	void commit_run();
+	static void *commit_callback(void *param, int threadid);
 
 	u32 hash32(u32 val) const;
 
 	void cache_clear();
+	bool flux_times_update(const std::vector<uint32_t> &buf);
 	void cache_fill_index(const std::vector<uint32_t> &buf, int &index, attotime &base);
 	void cache_fill(const attotime &when);
 	void cache_weakness_setup();
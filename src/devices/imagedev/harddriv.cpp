@@ -70,7 +70,13 @@ harddisk_image_device::harddisk_image_device(const machine_config &mconfig, devi
 	, m_device_image_load(*this)
 	, m_device_image_unload(*this)
 	, m_interface(nullptr)
+	, m_io_queue(nullptr)
+	, m_next_write(0)
+	, m_write_failed(false)
 {
+	m_prefetch.owner = this;
+	for (io_job &job : m_writes)
+		job.owner = this;
 }
 
 //-------------------------------------------------
@@ -79,6 +85,9 @@ harddisk_image_device::harddisk_image_device(const machine_config &mconfig, devi
 
 harddisk_image_device::~harddisk_image_device()
 {
+	wait_io();
+	if (m_io_queue)
+		osd_work_queue_free(m_io_queue);
 }
 
 //-------------------------------------------------
@@ -108,6 +117,9 @@ void harddisk_image_device::device_start()
 
 	m_chd = nullptr;
 
+	if (!m_io_queue)
+		m_io_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
 	if (has_preset_images())
 		setup_current_preset_image();
 	else
@@ -116,6 +128,8 @@ void harddisk_image_device::device_start()
 
 void harddisk_image_device::device_stop()
 {
+	wait_io();
+	m_prefetch.valid = false;
 	m_hard_disk_handle.reset();
 }
 
@@ -167,6 +181,8 @@ std::pair<std::error_condition, std::string> harddisk_image_device::call_create(
 
 void harddisk_image_device::setup_current_preset_image()
 {
+	wait_io();
+	m_prefetch.valid = false;
 	chd_file *chd = current_preset_image_chd();
 	m_hard_disk_handle.reset(new hard_disk_file(chd));
 }
@@ -177,6 +193,8 @@ void harddisk_image_device::call_unload()
 	if (!m_device_image_unload.isnull())
 		m_device_image_unload(*this);
 
+	wait_io();
+	m_prefetch.valid = false;
 	m_hard_disk_handle.reset();
 
 	if (m_chd)
@@ -242,6 +260,8 @@ std::error_condition harddisk_image_device::internal_load_hd()
 	m_chd = nullptr;
 	uint8_t header[64];
 
+	wait_io();
+	m_prefetch.valid = false;
 	m_hard_disk_handle.reset();
 
 	// open the CHD file
@@ -355,32 +375,140 @@ const hard_disk_file::info &harddisk_image_device::get_info() const
 
 bool harddisk_image_device::read(uint32_t lbasector, void *buffer)
 {
+	// use the sector read ahead if it's the one wanted; it was queued
+	// after any earlier writes, so it sees them
+	if (m_prefetch.valid && m_prefetch.lbasector == lbasector)
+	{
+		if (m_prefetch.item)
+		{
+			osd_work_item_wait(m_prefetch.item, osd_ticks_per_second() * 100);
+			osd_work_item_release(m_prefetch.item);
+			m_prefetch.item = nullptr;
+		}
+		m_prefetch.valid = false;
+		if (m_prefetch.result)
+			memcpy(buffer, &m_prefetch.data[0], m_prefetch.data.size());
+		return m_prefetch.result;
+	}
+
+	wait_io();
 	return m_hard_disk_handle->read(lbasector, buffer);
 }
 
 bool harddisk_image_device::write(uint32_t lbasector, const void *buffer)
 {
+	// a sector read ahead before this write is stale
+	if (m_prefetch.valid && m_prefetch.lbasector == lbasector)
+		m_prefetch.valid = false;
+
+	// report a write behind that failed on the next write
+	if (m_write_failed.exchange(false))
+		return false;
+
+	uint32_t const sectorbytes = m_hard_disk_handle->get_info().sectorbytes;
+	io_job &job = m_writes[m_next_write];
+	if (m_io_queue)
+	{
+		// claim the next slot, waiting for its last write if it's still going
+		m_next_write = (m_next_write + 1) % WRITE_BEHIND_DEPTH;
+		if (job.item)
+		{
+			osd_work_item_wait(job.item, osd_ticks_per_second() * 100);
+			osd_work_item_release(job.item);
+			job.item = nullptr;
+		}
+		job.lbasector = lbasector;
+		job.data.resize(sectorbytes);
+		memcpy(&job.data[0], buffer, sectorbytes);
+		job.item = osd_work_item_queue(m_io_queue, &harddisk_image_device::write_callback, &job, 0);
+		if (job.item)
+			return true;
+	}
+
+	wait_io();
 	return m_hard_disk_handle->write(lbasector, buffer);
 }
 
+void harddisk_image_device::prefetch(uint32_t lbasector)
+{
+	// start reading a sector the drive is about to need, so the host I/O
+	// overlaps the emulated seek or transfer time
+	if (!m_io_queue || !m_hard_disk_handle)
+		return;
+	if (m_prefetch.valid && m_prefetch.lbasector == lbasector)
+		return;
+
+	if (m_prefetch.item)
+	{
+		osd_work_item_wait(m_prefetch.item, osd_ticks_per_second() * 100);
+		osd_work_item_release(m_prefetch.item);
+		m_prefetch.item = nullptr;
+	}
+	m_prefetch.lbasector = lbasector;
+	m_prefetch.data.resize(m_hard_disk_handle->get_info().sectorbytes);
+	m_prefetch.item = osd_work_item_queue(m_io_queue, &harddisk_image_device::read_callback, &m_prefetch, 0);
+	m_prefetch.valid = m_prefetch.item != nullptr;
+}
+
+void *harddisk_image_device::read_callback(void *param, int threadid)
+{
+	io_job &job = *reinterpret_cast<io_job *>(param);
+	job.result = job.owner->m_hard_disk_handle->read(job.lbasector, &job.data[0]);
+	return nullptr;
+}
+
+void *harddisk_image_device::write_callback(void *param, int threadid)
+{
+	io_job &job = *reinterpret_cast<io_job *>(param);
+	if (!job.owner->m_hard_disk_handle->write(job.lbasector, &job.data[0]))
+		job.owner->m_write_failed = true;
+	return nullptr;
+}
+
+void harddisk_image_device::wait_io() const
+{
+	if (!m_io_queue)
+		return;
+
+	osd_work_queue_wait(m_io_queue, osd_ticks_per_second() * 100);
+	if (m_prefetch.item)
+	{
+		osd_work_item_release(m_prefetch.item);
+		m_prefetch.item = nullptr;
+	}
+	for (io_job &job : m_writes)
+	{
+		if (job.item)
+		{
+			osd_work_item_release(job.item);
+			job.item = nullptr;
+		}
+	}
+}
+
 
 bool harddisk_image_device::set_block_size(uint32_t blocksize)
 {
+	wait_io();
+	m_prefetch.valid = false;
 	return m_hard_disk_handle->set_block_size(blocksize);
 }
 
 std::error_condition harddisk_image_device::get_inquiry_data(std::vector<uint8_t> &data) const
 {
+	wait_io();
 	return m_hard_disk_handle->get_inquiry_data(data);
 }
 
 std::error_condition harddisk_image_device::get_cis_data(std::vector<uint8_t> &data) const
 {
+	wait_io();
 	return m_hard_disk_handle->get_cis_data(data);
 }
 
 std::error_condition harddisk_image_device::get_disk_key_data(std::vector<uint8_t> &data) const
 {
+	wait_io();
 	return m_hard_disk_handle->get_disk_key_data(data);
 }
 
@@ -16,10 +16,13 @@
 #include "chd.h"
 #include "harddisk.h"
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <system_error>
 #include <utility>
+#include <vector>
 
 
 /***************************************************************************
@@ -77,6 +80,7 @@ public:
 	const hard_disk_file::info &get_info() const;
 	bool read(uint32_t lbasector, void *buffer);
 	bool write(uint32_t lbasector, const void *buffer);
+	void prefetch(uint32_t lbasector);
 
 	bool set_block_size(uint32_t blocksize);
 
@@ -98,6 +102,21 @@ protected:
 	void setup_current_preset_image();
 	std::error_condition internal_load_hd();
 
+	// background I/O
+	static constexpr unsigned WRITE_BEHIND_DEPTH = 16;
+	struct io_job
+	{
+		harddisk_image_device *owner = nullptr;
+		osd_work_item *item = nullptr;
+		uint32_t lbasector = 0;
+		bool valid = false;
+		bool result = false;
+		std::vector<uint8_t> data;
+	};
+	static void *read_callback(void *param, int threadid);
+	static void *write_callback(void *param, int threadid);
+	void wait_io() const;
+
 	chd_file        *m_chd;
 	chd_file        m_origchd;              // handle to the original CHD
 	chd_file        m_diffchd;              // handle to the diff CHD
@@ -106,6 +125,14 @@ protected:
 	load_delegate   m_device_image_load;
 	unload_delegate m_device_image_unload;
 	const char *    m_interface;
+
+	// the disk is only touched from the worker while jobs are queued, so
+	// anything else, const or not, has to wait for them first
+	osd_work_queue *m_io_queue;
+	mutable io_job  m_prefetch;             // sector being read ahead
+	mutable std::array<io_job, WRITE_BEHIND_DEPTH> m_writes; // ring of writes being done
+	unsigned        m_next_write;
+	mutable std::atomic<bool> m_write_failed; // a write behind went wrong
 };
 
 // device type definition
@@ -90,14 +90,7 @@ ptm6840_device::ptm6840_device(const machine_config &mconfig, const char *tag, d
 
 void ptm6840_device::device_start()
 {
-	m_timer[0] = timer_alloc(FUNC(ptm6840_device::state_changed), this);
-	m_timer[1] = timer_alloc(FUNC(ptm6840_device::state_changed), this);
-	m_timer[2] = timer_alloc(FUNC(ptm6840_device::state_changed), this);
-
-	for (auto & elem : m_timer)
-	{
-		elem->enable(false);
-	}
+	m_timers.start(*this, 3, timer_expired_delegate(FUNC(ptm6840_device::state_changed), this));
 
 	// zerofill
 	m_t3_divisor = 1;
@@ -318,7 +311,7 @@ int ptm6840_device::compute_counter(int idx) const
 	LOGMASKED(LOG_COUNTERS, "Timer #%d %s clock freq %d\n", idx + 1, (m_control_reg[idx] & INTERNAL_CLK_EN) ? "internal" : "external", clk);
 
 	// See how many are left
-	attotime remaining_time = m_timer[idx]->remaining();
+	attotime remaining_time = m_timers.remaining(idx);
 	if (remaining_time.is_never())
 	{
 		if (m_disable_time[idx].is_never())
@@ -392,7 +385,7 @@ void ptm6840_device::reload_counter(int idx)
 	if (clk == 0.0)
 	{
 		m_enabled[idx] = false;
-		m_timer[idx]->adjust(attotime::never);
+		m_timers.disable(idx);
 	}
 	else
 	{
@@ -411,11 +404,11 @@ void ptm6840_device::reload_counter(int idx)
 		if (gated)
 		{
 			m_disable_time[idx] = duration;
-			m_timer[idx]->adjust(attotime::never);
+			m_timers.disable(idx);
 		}
 		else
 		{
-			m_timer[idx]->adjust(duration, idx);
+			m_timers.adjust(idx, duration);
 		}
 	}
 }
@@ -525,7 +518,7 @@ void ptm6840_device::write(offs_t offset, uint8_t data)
 					LOGMASKED(LOG_RESETS, "Timer reset\n");
 					for (int i = 0; i < 3; i++)
 					{
-						m_timer[i]->adjust(attotime::never);
+						m_timers.disable(i);
 						m_enabled[i] = false;
 						reload_counter(i);
 						m_output[i] = false;
@@ -539,9 +532,9 @@ void ptm6840_device::write(offs_t offset, uint8_t data)
 					{
 						m_single_fired[i] = false;
 						reload_counter(i);
-						if (!m_disable_time[i].is_never() && m_timer[i]->remaining().is_never() && ((m_control_reg[i] & INTERNAL_CLK_EN) || m_external_clock[i] != 0.0))
+						if (!m_disable_time[i].is_never() && m_timers.remaining(i).is_never() && ((m_control_reg[i] & INTERNAL_CLK_EN) || m_external_clock[i] != 0.0))
 						{
-							m_timer[i]->adjust(m_disable_time[i], i);
+							m_timers.adjust(i, m_disable_time[i]);
 							m_disable_time[i] = attotime::never;
 						}
 					}
@@ -676,14 +669,14 @@ void ptm6840_device::set_gate(int idx, int state)
 		}
 		if (!m_disable_time[idx].is_never() && ((m_control_reg[idx] & INTERNAL_CLK_EN) || m_external_clock[idx] != 0.0))
 		{
-			m_timer[idx]->adjust(m_disable_time[idx], idx);
+			m_timers.adjust(idx, m_disable_time[idx]);
 			m_disable_time[idx] = attotime::never;
 		}
 	}
 	else if (state == 1 && !m_gate[idx] && !one_shot_mode) // Gate disable is ignored in one-shot mode
 	{
-		m_disable_time[idx] = m_timer[idx]->remaining();
-		m_timer[idx]->adjust(attotime::never);
+		m_disable_time[idx] = m_timers.remaining(idx);
+		m_timers.disable(idx);
 	}
 	m_gate[idx] = state;
 }
@@ -776,7 +769,7 @@ void ptm6840_device::update_expiration_for_clock_source(int idx, bool changed_to
 			}
 
 			m_enabled[idx] = false;
-			m_timer[idx]->adjust(attotime::never);
+			m_timers.disable(idx);
 			return;
 		}
 		else
@@ -790,12 +783,12 @@ void ptm6840_device::update_expiration_for_clock_source(int idx, bool changed_to
 			const bool gated = !one_shot_mode && m_gate[idx];
 			if (gated)
 			{
-				m_timer[idx]->adjust(attotime::never);
+				m_timers.disable(idx);
 				m_disable_time[idx] = duration;
 			}
 			else
 			{
-				m_timer[idx]->adjust(duration, idx);
+				m_timers.adjust(idx, duration);
 			}
 		}
 	}
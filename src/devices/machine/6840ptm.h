@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include "timerdom.h"
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -123,7 +125,7 @@ private:
 	uint8_t m_msb_buffer;
 
 	// Each PTM has 3 timers
-	emu_timer *m_timer[3];
+	timer_domain m_timers;
 
 	uint16_t m_latch[3];
 	uint16_t m_counter[3];
@@ -465,8 +465,14 @@ void ata_mass_storage_device_base::finished_read()
 		/* advance the pointers, unless this is the last sector */
 		/* Gauntlet: Dark Legacy checks to make sure we stop on the last sector */
 		if (m_sector_count != 1)
+		{
 			next_sector();
 
+			/* start fetching the next sector while this one is transferred */
+			if (m_sector_count > 1 && m_command != IDE_COMMAND_READ_BUFFER)
+				prefetch_sector(lba_address());
+		}
+
 		/* signal an interrupt, IDE_COMMAND_READ_MULTIPLE sets the interrupt at the start the block */
 		if (--m_sectors_until_int == 0 || (m_sector_count == 1 && m_command != IDE_COMMAND_READ_MULTIPLE))
 		{
@@ -519,6 +525,7 @@ void ata_mass_storage_device_base::read_first_sector()
 		}
 		else
 		{
+			prefetch_sector(lba_address());
 			start_busy(seek_time(), PARAM_COMMAND);
 		}
 	}
@@ -86,6 +86,11 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 	, m_readresult()
 	, m_chdtracks(0)
 	, m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_read_item(nullptr)
+	, m_ahead_item(nullptr)
+	, m_ahead_slot(0)
+	, m_prevhunk{ ~uint32_t(0), ~uint32_t(0) }
+	, m_decodeindex(0)
 	, m_audiosquelch(0)
 	, m_videosquelch(0)
 	, m_fieldnum(0)
@@ -321,6 +326,11 @@ void laserdisc_device::device_stop()
 	// make sure all async operations have completed
 	if (m_disc)
 		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	if (m_read_item)
+		osd_work_item_release(m_read_item);
+	if (m_ahead_item)
+		osd_work_item_release(m_ahead_item);
+	m_read_item = m_ahead_item = nullptr;
 
 	// free any textures and palettes
 	if (m_videotex)
@@ -818,6 +828,15 @@ void laserdisc_device::init_video()
 		frame.m_visbitmap.set_palette(m_videopalette);
 	}
 
+	// allocate the fields to decode ahead into
+	for (auto &field : m_decoded)
+	{
+		if (m_disc)
+			field.m_bitmap.allocate(m_width, m_height);
+		field.m_samples = 0;
+		field.m_hunknum = ~uint32_t(0);
+	}
+
 	// allocate an empty frame of the same size
 	m_emptyframe.allocate(m_width, m_height * 2);
 	m_emptyframe.set_palette(m_videopalette);
@@ -868,6 +887,14 @@ void laserdisc_device::init_audio()
 	m_audiobufsize = m_audiomaxsamples * 4;
 	m_audiobuffer[0].resize(m_audiobufsize);
 	m_audiobuffer[1].resize(m_audiobufsize);
+	if (m_disc)
+	{
+		for (auto &field : m_decoded)
+		{
+			field.m_audio[0].resize(m_audiomaxsamples);
+			field.m_audio[1].resize(m_audiomaxsamples);
+		}
+	}
 }
 
 
@@ -980,6 +1007,10 @@ laserdisc_device::frame_data &laserdisc_device::current_frame()
 
 void laserdisc_device::read_track_data()
 {
+	// the codec is shared, so it has to be finished with any field being
+	// decoded ahead before it can be used here
+	decode_ahead_wait();
+
 	// compute the chdhunk number we are going to read
 	int32_t chdtrack = m_curtrack - 1 - VIRTUAL_LEAD_IN_TRACKS;
 	chdtrack = (std::max<int32_t>)(chdtrack, 0);
@@ -1053,17 +1084,127 @@ void laserdisc_device::read_track_data()
 		m_metadata[m_fieldnum].line17 = m_metadata[m_fieldnum].line18 = m_metadata[m_fieldnum].line1718 = VBI_CODE_LEADIN;
 	}
 
-	// configure the codec and then read
+	// use a field decoded ahead, or configure the codec and then read
 	m_readresult = std::errc::no_such_file_or_directory;
 	if (m_disc && !m_videosquelch)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (!m_readresult)
+		if (read_decoded_field(readhunk))
 		{
-			m_queued_hunknum = readhunk;
-			m_readresult = chd_file::error::OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+			m_readresult = std::error_condition();
+		}
+		else
+		{
+			m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
+			if (!m_readresult)
+			{
+				m_queued_hunknum = readhunk;
+				m_readresult = chd_file::error::OPERATION_PENDING;
+				m_read_item = osd_work_item_queue(m_work_queue, read_async_static, this, 0);
+				if (!m_read_item)
+					read_async_static(this, 0);
+			}
 		}
+
+		// the player is likely to repeat the step between the last two
+		// fields: one for playing, back and forth on a still frame, and a
+		// regular stride for scanning or playing in reverse
+		uint32_t predicted = readhunk + 1;
+		if (m_prevhunk[1] != ~uint32_t(0))
+			predicted = readhunk + (m_prevhunk[0] - m_prevhunk[1]);
+		m_prevhunk[1] = m_prevhunk[0];
+		m_prevhunk[0] = readhunk;
+		if (predicted != readhunk && predicted < m_chdtracks * 2)
+			decode_ahead(predicted);
+	}
+}
+
+
+//-------------------------------------------------
+//  read_decoded_field - take a field from the
+//  ring decoded ahead if it's there
+//-------------------------------------------------
+
+bool laserdisc_device::read_decoded_field(uint32_t hunknum)
+{
+	for (decoded_field &field : m_decoded)
+	{
+		if (field.m_hunknum != hunknum || field.m_result)
+			continue;
+
+		// copy the video into the field lines of the frame
+		for (int y = 0; y < field.m_bitmap.height(); y++)
+			memcpy(&m_avhuff_video.pix(y), &field.m_bitmap.pix(y), m_avhuff_video.width() * sizeof(uint16_t));
+
+		// and the audio to where it would have been decoded
+		m_audiocursamples = std::min(field.m_samples, m_audiomaxsamples);
+		for (int chnum = 0; chnum < 2; chnum++)
+			memcpy(m_avhuff_config.audio[chnum], &field.m_audio[chnum][0], m_audiocursamples * sizeof(int16_t));
+		return true;
+	}
+	return false;
+}
+
+
+//-------------------------------------------------
+//  decode_ahead - start decoding a field that's
+//  likely to be needed next
+//-------------------------------------------------
+
+void laserdisc_device::decode_ahead(uint32_t hunknum)
+{
+	for (decoded_field const &field : m_decoded)
+		if (field.m_hunknum == hunknum && !field.m_result)
+			return;
+
+	m_ahead_slot = m_decodeindex;
+	m_decodeindex = (m_decodeindex + 1) % DECODE_AHEAD_FIELDS;
+	decoded_field &field = m_decoded[m_ahead_slot];
+	field.m_hunknum = hunknum;
+	field.m_samples = 0;
+	field.m_result = chd_file::error::OPERATION_PENDING;
+
+	m_ahead_video.wrap(&field.m_bitmap.pix(0), field.m_bitmap.width(), field.m_bitmap.height(), field.m_bitmap.rowpixels());
+	m_ahead_config.video = &m_ahead_video;
+	m_ahead_config.maxsamples = m_audiomaxsamples;
+	m_ahead_config.actsamples = &field.m_samples;
+	m_ahead_config.audio[0] = &field.m_audio[0][0];
+	m_ahead_config.audio[1] = &field.m_audio[1][0];
+
+	// this runs after the read of the current field on the same thread
+	m_ahead_item = osd_work_item_queue(m_work_queue, decode_ahead_static, this, 0);
+	if (!m_ahead_item)
+		field.m_hunknum = ~uint32_t(0);
+}
+
+
+//-------------------------------------------------
+//  decode_ahead_static - work item callback for
+//  decoding ahead
+//-------------------------------------------------
+
+void *laserdisc_device::decode_ahead_static(void *param, int threadid)
+{
+	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
+	decoded_field &field = ld.m_decoded[ld.m_ahead_slot];
+	field.m_result = ld.m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &ld.m_ahead_config);
+	if (!field.m_result)
+		field.m_result = ld.m_disc->codec_process_hunk(field.m_hunknum);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  decode_ahead_wait - wait for any field being
+//  decoded ahead
+//-------------------------------------------------
+
+void laserdisc_device::decode_ahead_wait()
+{
+	if (m_ahead_item)
+	{
+		osd_work_item_wait(m_ahead_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(m_ahead_item);
+		m_ahead_item = nullptr;
 	}
 }
 
@@ -1088,9 +1229,14 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 
 void laserdisc_device::process_track_data()
 {
-	// wait for the async operation to complete
-	if (m_readresult == chd_file::error::OPERATION_PENDING)
-		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	// wait for the async operation to complete; anything being decoded
+	// ahead carries on
+	if (m_read_item)
+	{
+		osd_work_item_wait(m_read_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(m_read_item);
+		m_read_item = nullptr;
+	}
 	assert(m_readresult != chd_file::error::OPERATION_PENDING);
 
 	// remove the video if we had an error
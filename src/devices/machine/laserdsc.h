@@ -246,6 +246,17 @@ private:
 		int32_t             m_lastfield;            // last absolute field number
 	};
 
+	// a field decoded ahead of being needed
+	static constexpr int DECODE_AHEAD_FIELDS = 8;
+	struct decoded_field
+	{
+		bitmap_yuy16        m_bitmap;               // decoded video
+		std::vector<int16_t> m_audio[2];            // decoded audio
+		uint32_t            m_samples;              // number of audio samples decoded
+		uint32_t            m_hunknum;              // hunk decoded, or ~0 if none
+		std::error_condition m_result;              // result of decoding
+	};
+
 	// internal helpers
 	void init_disc();
 	void init_video();
@@ -257,6 +268,10 @@ private:
 	frame_data &current_frame();
 	void read_track_data();
 	static void *read_async_static(void *param, int threadid);
+	bool read_decoded_field(uint32_t hunknum);
+	void decode_ahead(uint32_t hunknum);
+	static void *decode_ahead_static(void *param, int threadid);
+	void decode_ahead_wait();
 	void process_track_data();
 	void config_load(config_type cfg_type, config_level cfg_level, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
@@ -286,6 +301,14 @@ private:
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
 	uint32_t            m_queued_hunknum;       // queued hunk
+	osd_work_item *     m_read_item;            // work item reading the current field
+	osd_work_item *     m_ahead_item;           // work item decoding a field ahead
+	int                 m_ahead_slot;           // slot being decoded ahead
+	uint32_t            m_prevhunk[2];          // last two hunks read, for predicting the next
+	decoded_field       m_decoded[DECODE_AHEAD_FIELDS]; // ring of fields decoded ahead
+	uint8_t             m_decodeindex;          // next slot to decode ahead into
+	bitmap_yuy16        m_ahead_video;          // decompression target for decoding ahead
+	avhuff_decoder::config m_ahead_config;      // decompression configuration for decoding ahead
 
 	// core states
 	uint8_t             m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
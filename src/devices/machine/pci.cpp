@@ -180,12 +180,17 @@ void pci_device::address_base_w(offs_t offset, uint32_t data)
 	}
 
 	int bid = bank_reg_infos[offset].bank;
+	uint64_t const old_mapping = bank_mapping(bid);
 	if(bank_reg_infos[offset].hi)
 		bank_infos[bid].adr = (bank_infos[bid].adr & 0xffffffff) | (uint64_t(data) << 32);
 	else {
 		bank_infos[bid].adr = (bank_infos[bid].adr & 0xffffffff00000000U) | data;
 	}
-	remap_cb();
+
+	// firmware sizes BARs by writing all ones with decoding turned off, and
+	// rewrites unchanged values a lot; neither changes the address map
+	if(bank_mapping(bid) != old_mapping)
+		remap_cb();
 }
 
 uint16_t pci_device::vendor_r()
@@ -267,6 +272,7 @@ uint32_t pci_device::expansion_base_r()
 
 void pci_device::expansion_base_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
+	uint32_t const old = expansion_rom_base;
 	COMBINE_DATA(&expansion_rom_base);
 	if(!expansion_rom_size)
 		expansion_rom_base = 0;
@@ -274,7 +280,10 @@ void pci_device::expansion_base_w(offs_t offset, uint32_t data, uint32_t mem_mas
 		// Trick to get an address resolution at expansion_rom_size with minimal granularity of 0x800, plus bit 1 set to keep the on/off information
 		expansion_rom_base &= 0xfffff801 & (1-expansion_rom_size);
 	}
-	remap_cb();
+
+	// the ROM is only mapped while it's enabled
+	if((old != expansion_rom_base) && ((old | expansion_rom_base) & 1))
+		remap_cb();
 }
 
 // if non-zero a CAPability PoinTeR marks an offset in PCI config space where a standard extension is located
@@ -326,6 +335,19 @@ void pci_device::reset_all_mappings()
 {
 }
 
+uint64_t pci_device::bank_mapping(int bid) const
+{
+	// the same tests map_device does
+	bank_info const &bi = bank_infos[bid];
+	if(uint32_t(bi.adr) >= 0xfffffffc)
+		return ~uint64_t(0);
+	if(~command & ((bi.flags & M_IO) ? 1 : 2))
+		return ~uint64_t(0);
+	if(!bi.size || (bi.flags & M_DISABLED))
+		return ~uint64_t(0);
+	return bi.adr & ~(bi.size - 1);
+}
+
 void pci_device::map_device(uint64_t memory_window_start, uint64_t memory_window_end, uint64_t memory_offset, address_space *memory_space,
 							uint64_t io_window_start, uint64_t io_window_end, uint64_t io_offset, address_space *io_space)
 {
@@ -99,6 +99,9 @@ protected:
 
 	bank_info bank_infos[6];
 	int bank_count, bank_reg_count;
+
+	// where map_device puts a bank, or ~0 if it doesn't map it
+	uint64_t bank_mapping(int bid) const;
 	bank_reg_info bank_reg_infos[6];
 
 	class pci_root_device *m_pci_root;
@@ -72,6 +72,69 @@ void AICADSP::init() noexcept
 
 	Stopped = true;
 	LastStep = 0;
+	ProgramSteps = 0;
+	Decoded = false;
+}
+
+void AICADSP::decode() noexcept
+{
+	// extract the fields of each step once, masking off the memory accesses
+	// that are only honoured on odd steps
+	STEP decoded[128];
+	for (int step = 0; step < LastStep; ++step)
+	{
+		const u16 *IPtr = MPRO + step * 8;
+		STEP &s = decoded[step];
+
+		s.TRA   = (IPtr[0] >>  9) & 0x7F;
+		s.TWT   = (IPtr[0] >>  8) & 0x01;
+		s.TWA   = (IPtr[0] >>  1) & 0x7F;
+
+		s.XSEL  = (IPtr[2] >> 15) & 0x01;
+		s.YSEL  = (IPtr[2] >> 13) & 0x03;
+		s.IRA   = (IPtr[2] >>  7) & 0x3F;
+		s.IWT   = (IPtr[2] >>  6) & 0x01;
+		s.IWA   = (IPtr[2] >>  1) & 0x1F;
+
+		s.TABLE = (IPtr[4] >> 15) & 0x01;
+		s.MWT   = (IPtr[4] >> 14) & (step & 1);
+		s.MRD   = (IPtr[4] >> 13) & (step & 1);
+		s.EWT   = (IPtr[4] >> 12) & 0x01;
+		s.EWA   = (IPtr[4] >>  8) & 0x0F;
+		s.ADRL  = (IPtr[4] >>  7) & 0x01;
+		s.FRCL  = (IPtr[4] >>  6) & 0x01;
+		s.SHIFT = (IPtr[4] >>  4) & 0x03;
+		s.YRL   = (IPtr[4] >>  3) & 0x01;
+		s.NEGB  = (IPtr[4] >>  2) & 0x01;
+		s.ZERO  = (IPtr[4] >>  1) & 0x01;
+		s.BSEL  = (IPtr[4] >>  0) & 0x01;
+
+		s.NOFL  = (IPtr[6] >> 15) & 1;
+		s.COEF  = step;
+
+		s.MASA  = (IPtr[6] >>  9) & 0x1f;
+		s.ADREB = (IPtr[6] >>  8) & 0x1;
+		s.NXADR = (IPtr[6] >>  7) & 0x1;
+	}
+
+	// walking backwards, drop each step that writes nothing and whose ACC
+	// is not read by the next step that is kept; programs are padded with
+	// such steps, so this usually leaves far fewer than 128
+	bool keep[128];
+	bool acc_read = false;
+	for (int step = LastStep - 1; step >= 0; --step)
+	{
+		const STEP &s = decoded[step];
+		keep[step] = acc_read || s.TWT || s.IWT || s.MWT || s.MRD || s.EWT || s.ADRL || s.FRCL || s.YRL;
+		if (keep[step])
+			acc_read = (!s.ZERO && s.BSEL) || s.TWT || s.MWT || s.EWT || s.FRCL || (s.ADRL && (s.SHIFT == 3));
+	}
+
+	ProgramSteps = 0;
+	for (int step = 0; step < LastStep; ++step)
+		if (keep[step])
+			Program[ProgramSteps++] = decoded[step];
+	Decoded = true;
 }
 
 void AICADSP::step()
@@ -85,116 +148,50 @@ void AICADSP::step()
 	if (Stopped)
 		return;
 
+	if (!Decoded)
+		decode();
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
-#if 0
-	int dump=0;
-	FILE *f=nullptr;
-	if (dump)
-		f=fopen("dsp.txt","wt");
-#endif
-	for (int step = 0; step < /*128*/LastStep; ++step)
+	for (int step = 0; step < ProgramSteps; ++step)
 	{
-		u16 *IPtr=MPRO+step*8;
-
-//      if (IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		const u32 TRA   = (IPtr[0] >>  9) & 0x7F;
-		const u32 TWT   = (IPtr[0] >>  8) & 0x01;
-		const u32 TWA   = (IPtr[0] >>  1) & 0x7F;
-
-		const u32 XSEL  = (IPtr[2] >> 15) & 0x01;
-		const u32 YSEL  = (IPtr[2] >> 13) & 0x03;
-		const u32 IRA   = (IPtr[2] >>  7) & 0x3F;
-		const u32 IWT   = (IPtr[2] >>  6) & 0x01;
-		const u32 IWA   = (IPtr[2] >>  1) & 0x1F;
-
-		const u32 TABLE = (IPtr[4] >> 15) & 0x01;
-		const u32 MWT   = (IPtr[4] >> 14) & 0x01;
-		const u32 MRD   = (IPtr[4] >> 13) & 0x01;
-		const u32 EWT   = (IPtr[4] >> 12) & 0x01;
-		const u32 EWA   = (IPtr[4] >>  8) & 0x0F;
-		const u32 ADRL  = (IPtr[4] >>  7) & 0x01;
-		const u32 FRCL  = (IPtr[4] >>  6) & 0x01;
-		const u32 SHIFT = (IPtr[4] >>  4) & 0x03;
-		const u32 YRL   = (IPtr[4] >>  3) & 0x01;
-		const u32 NEGB  = (IPtr[4] >>  2) & 0x01;
-		const u32 ZERO  = (IPtr[4] >>  1) & 0x01;
-		const u32 BSEL  = (IPtr[4] >>  0) & 0x01;
-
-		const u32 NOFL  = (IPtr[6] >> 15) & 1;        //????
-		const u32 COEF  = step;
-
-		const u32 MASA  = (IPtr[6] >>  9) & 0x1f;  //???
-		const u32 ADREB = (IPtr[6] >>  8) & 0x1;
-		const u32 NXADR = (IPtr[6] >>  7) & 0x1;
+		const STEP &s = Program[step];
 
 		//operations are done at 24 bit precision
-#if 0
-		if (MASA)
-			int a=1;
-		if (NOFL)
-			int a=1;
-
-//      int dump=0;
 
-		if (f)
-		{
-#define DUMP(v) fprintf(f," " #v ": %04X",v);
-
-			fprintf(f,"%d: ",step);
-			DUMP(ACC);
-			DUMP(SHIFTED);
-			DUMP(X);
-			DUMP(Y);
-			DUMP(B);
-			DUMP(INPUTS);
-			DUMP(MEMVAL);
-			DUMP(FRC_REG);
-			DUMP(Y_REG);
-			DUMP(ADDR);
-			DUMP(ADRS_REG);
-			fprintf(f,"\n");
-		}
-#endif
 		//INPUTS RW
-		assert(IRA<0x32);
+		assert(s.IRA<0x32);
 		s32 INPUTS=0; //24 bit
-		if (IRA <= 0x1f)
-			INPUTS = MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
+		if (s.IRA <= 0x1f)
+			INPUTS = MEMS[s.IRA];
+		else if (s.IRA <= 0x2F)
+			INPUTS = MIXS[s.IRA - 0x20] << 4;  //MIXS is 20 bit
+		else if (s.IRA <= 0x31)
+			INPUTS = EXTS[s.IRA - 0x30] << 8;  //EXTS is 16 bit
 
 		INPUTS <<= 8;
 		INPUTS >>= 8;
-		//if (INPUTS & 0x00800000)
-		//  INPUTS |= 0xFF000000;
 
-		if (IWT)
+		if (s.IWT)
 		{
-			MEMS[IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			MEMS[s.IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
+			if (s.IRA == s.IWA)
 				INPUTS = MEMVAL;
 		}
 
 		//Operand sel
 		//B
 		s32 B;  //26 bit
-		if (!ZERO)
+		if (!s.ZERO)
 		{
-			if (BSEL)
+			if (s.BSEL)
 				B = ACC;
 			else
 			{
-				B = TEMP[(TRA + DEC) & 0x7F];
+				B = TEMP[(s.TRA + DEC) & 0x7F];
 				B <<= 8;
 				B >>= 8;
-				//if (B & 0x00800000)
-				//  B |= 0xFF000000;  //Sign extend
 			}
-			if (NEGB)
+			if (s.NEGB)
 				B = 0 - B;
 		}
 		else
@@ -202,127 +199,109 @@ void AICADSP::step()
 
 		//X
 		s32 X;  //24 bit
-		if (XSEL)
+		if (s.XSEL)
 			X = INPUTS;
 		else
 		{
-			X = TEMP[(TRA + DEC) & 0x7F];
+			X = TEMP[(s.TRA + DEC) & 0x7F];
 			X <<= 8;
 			X >>= 8;
-			//if (X & 0x00800000)
-			//  X |= 0xFF000000;
 		}
 
 		//Y
 		s32 Y = 0;  //13 bit
-		if (YSEL == 0)
+		if (s.YSEL == 0)
 			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = this->COEF[COEF << 1] >> 3;    //COEF is 16 bits
-		else if (YSEL == 2)
+		else if (s.YSEL == 1)
+			Y = COEF[s.COEF << 1] >> 3;    //COEF is 16 bits
+		else if (s.YSEL == 2)
 			Y = (Y_REG >> 11) & 0x1FFF;
-		else if (YSEL == 3)
+		else if (s.YSEL == 3)
 			Y = (Y_REG >> 4) & 0x0FFF;
 
-		if (YRL)
+		if (s.YRL)
 			Y_REG = INPUTS;
 
 		//Shifter
 		s32 SHIFTED = 0;    //24 bit
-		if (SHIFT == 0)
+		if (s.SHIFT == 0)
 			SHIFTED = std::clamp<s32>(ACC, -0x00800000, 0x007FFFFF);
-		else if (SHIFT == 1)
+		else if (s.SHIFT == 1)
 			SHIFTED = std::clamp<s32>(ACC * 2, -0x00800000, 0x007FFFFF);
-		else if (SHIFT == 2)
+		else if (s.SHIFT == 2)
 		{
 			SHIFTED = ACC * 2;
 			SHIFTED <<= 8;
 			SHIFTED >>= 8;
-			//SHIFTED &= 0x00FFFFFF;
-			//if (SHIFTED & 0x00800000)
-			//  SHIFTED |= 0xFF000000;
 		}
-		else if (SHIFT == 3)
+		else if (s.SHIFT == 3)
 		{
 			SHIFTED = ACC;
 			SHIFTED <<= 8;
 			SHIFTED >>= 8;
-			//SHIFTED &= 0x00FFFFFF;
-			//if (SHIFTED & 0x00800000)
-			//  SHIFTED |= 0xFF000000;
 		}
 
 		//ACCUM
 		Y <<= 19;
 		Y >>= 19;
-		//if (Y & 0x1000)
-		//  Y |= 0xFFFFF000;
 
 		const s64 v = (((s64)X * (s64)Y) >> 12);
 		ACC = (int)v + B;
 
-		if (TWT)
-			TEMP[(TWA + DEC) & 0x7F] = SHIFTED;
+		if (s.TWT)
+			TEMP[(s.TWA + DEC) & 0x7F] = SHIFTED;
 
-		if (FRCL)
+		if (s.FRCL)
 		{
-			if (SHIFT == 3)
+			if (s.SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0FFF;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1FFF;
 		}
 
-		u32 ADDR;
-		if (MRD || MWT)
-		//if (0)
+		if (s.MRD || s.MWT) //memory only allowed on odd? DoA inserts NOPs on even
 		{
-			ADDR = MADRS[MASA << 1];
-			if (!TABLE)
+			u32 ADDR = MADRS[s.MASA << 1];
+			if (!s.TABLE)
 				ADDR += DEC;
-			if (ADREB)
+			if (s.ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (s.NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!s.TABLE)
 				ADDR &= RBL - 1;
 			else
 				ADDR &= 0xFFFF;
-			//ADDR <<= 1;
-			//ADDR += RBP << 13;
-			//MEMVAL = space.read_word(ADDR >> 1);
 			ADDR += RBP << 10;
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (s.MRD)
 			{
-				if (NOFL)
+				if (s.NOFL)
 					MEMVAL = cache.read_word(ADDR) << 8;
 				else
 					MEMVAL = UNPACK(cache.read_word(ADDR));
 			}
-			if (MWT && (step&1))
+			if (s.MWT)
 			{
-				if (NOFL)
+				if (s.NOFL)
 					space.write_word(ADDR, SHIFTED>>8);
 				else
 					space.write_word(ADDR, PACK(SHIFTED));
 			}
 		}
 
-		if (ADRL)
+		if (s.ADRL)
 		{
-			if (SHIFT == 3)
+			if (s.SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xFFF;
 			else
 				ADRS_REG = (INPUTS >> 16);
 		}
 
-		if (EWT)
-			EFREG[EWA] += SHIFTED >> 8;
-
+		if (s.EWT)
+			EFREG[s.EWA] += SHIFTED >> 8;
 	}
 	--DEC;
 	std::fill(std::begin(MIXS), std::end(MIXS), 0);
-//  if (f)
-//      fclose(f);
 }
 
 void AICADSP::setsample(s32 sample, u8 SEL, s32 MXL) noexcept
@@ -345,4 +324,5 @@ void AICADSP::start() noexcept
 			break;
 	}
 	LastStep = i + 1;
+	Decoded = false;
 }
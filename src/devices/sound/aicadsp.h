@@ -37,6 +37,21 @@ struct AICADSP
 
 	bool Stopped;
 	int LastStep;
+
+//decoded program, rebuilt by step() whenever Decoded is cleared
+	struct STEP
+	{
+		u8 TRA, TWT, TWA;
+		u8 XSEL, YSEL, IRA, IWT, IWA;
+		u8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+		u8 NOFL, COEF, MASA, ADREB, NXADR;
+	};
+	STEP Program[128]; //steps that can affect the output, in order
+	int ProgramSteps;
+	bool Decoded;     //cleared when MPRO or LastStep change
+
+private:
+	void decode() noexcept;
 };
 
 #endif // MAME_SOUND_AICADSP_H
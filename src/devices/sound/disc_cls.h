@@ -36,11 +36,17 @@
 	public:                                                             \
 		virtual ~ DISCRETE_CLASS_NAME(_name)() { }
 
+#define DISCRETE_CLASS_STEP_BLOCK(_name)                                \
+	public:                                                             \
+		virtual void step_block(int samples, const discrete_block_plan &plan) override \
+		{ discrete_step_block(samples, plan, [this] () { this->DISCRETE_CLASS_NAME(_name)::step(); }); }
+
 #define  DISCRETE_CLASS_STEP_RESET(_name, _maxout, _priv)               \
 class DISCRETE_CLASS_NAME(_name): public discrete_base_node, public discrete_step_interface         \
 {                                                                       \
 	DISCRETE_CLASS_CONSTRUCTOR(_name, base)                             \
 	DISCRETE_CLASS_DESTRUCTOR(_name)                                    \
+	DISCRETE_CLASS_STEP_BLOCK(_name)                                    \
 public:                                                                 \
 	virtual void step() override;                                       \
 	virtual void reset() override;                                      \
@@ -54,6 +60,7 @@ class DISCRETE_CLASS_NAME(_name): public discrete_base_node, public discrete_ste
 {                                                                       \
 	DISCRETE_CLASS_CONSTRUCTOR(_name, base)                             \
 	DISCRETE_CLASS_DESTRUCTOR(_name)                                    \
+	DISCRETE_CLASS_STEP_BLOCK(_name)                                    \
 public:                                                                 \
 	virtual void step() override;                                       \
 	virtual void reset() override  { this->step(); }                    \
@@ -77,6 +84,7 @@ class DISCRETE_CLASS_NAME(_name): public discrete_base_node, public discrete_ste
 {                                                                       \
 	DISCRETE_CLASS_DESTRUCTOR(_name)                                    \
 	DISCRETE_CLASS_CONSTRUCTOR(_name, base)                             \
+	DISCRETE_CLASS_STEP_BLOCK(_name)                                    \
 public:                                                                 \
 	virtual void step() override;                                       \
 	virtual void reset() override;                                      \
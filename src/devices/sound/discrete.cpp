@@ -40,6 +40,7 @@
 
 #include "wavwrite.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdarg>
 #include <iostream>
@@ -83,6 +84,16 @@ static constexpr int MAX_SAMPLES_PER_TASK_SLICE = 960 / 4;
 
 #define USE_DISCRETE_TASKS          (1)
 
+/*************************************
+ *
+ *  Step tasks without feedback a node
+ *  at a time rather than a sample at
+ *  a time ?
+ *
+ *************************************/
+
+#define USE_DISCRETE_BLOCKS         (1)
+
 /*************************************
  *
  *  Internal classes
@@ -123,6 +134,7 @@ public:
 	}
 
 	void check(discrete_task &dest_task);
+	void prepare_blocks();
 	void prepare_for_queue(int samples);
 
 	static void *task_callback(void *param, int threadid);
@@ -134,6 +146,7 @@ public:
 
 private:
 	void step_nodes();
+	void step_block(int samples);
 	bool process();
 
 	bool lock_threadid(int32_t threadid)
@@ -153,6 +166,13 @@ private:
 	std::vector<output_buffer>  m_buffers;
 	discrete_device &           m_device;
 
+	/* block evaluation, one plan per entry of step_list */
+	bool                        m_use_blocks = false;
+	std::vector<discrete_block_plan>    m_block_plans;
+	std::vector<std::pair<discrete_block_input *, input_buffer *> > m_block_sources;
+	std::vector<const double *> m_block_buffers;    /* history feeding each of m_buffers */
+	std::unique_ptr<double []>  m_block_history;
+
 	std::atomic<int32_t>        m_threadid;
 	int                         m_samples;
 };
@@ -217,6 +237,49 @@ inline void discrete_task::step_nodes()
 		outbuf.ptr.store(outbuf.ptr.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 }
 
+inline void discrete_task::step_block(int samples)
+{
+	// streamed inputs from other tasks start where the source buffer currently is
+	for (auto &source : m_block_sources)
+		source.first->base = source.second->ptr;
+
+	// step each node through the whole block before moving on to the next one
+	osd_ticks_t last = m_device.profiling() ? get_profile_ticks() : 0;
+	for (int nodenum = 0; nodenum < step_list.size(); nodenum++)
+	{
+		discrete_step_interface *const node = step_list[nodenum];
+		discrete_block_plan const &plan = m_block_plans[nodenum];
+
+		node->step_block(samples, plan);
+		for (const discrete_block_input &in : plan.inputs)
+			*in.slot = in.value;
+
+		if (UNEXPECTED(m_device.profiling()))
+		{
+			node->run_time -= last;
+			last = get_profile_ticks();
+			node->run_time += last;
+		}
+	}
+
+	// leave the sources as the sample loop would
+	for (input_buffer &sn : source_list)
+	{
+		sn.ptr += samples;
+		sn.buffer = sn.ptr[-1];
+	}
+
+	// buffer the outputs
+	for (int bufnum = 0; bufnum < m_buffers.size(); bufnum++)
+	{
+		output_buffer &outbuf = m_buffers[bufnum];
+		std::copy_n(m_block_buffers[bufnum], samples, outbuf.ptr.load(std::memory_order_relaxed));
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	for (output_buffer &outbuf : m_buffers)
+		outbuf.ptr.store(outbuf.ptr.load(std::memory_order_relaxed) + samples, std::memory_order_relaxed);
+}
+
 void *discrete_task::task_callback(void *param, int threadid)
 {
 	const auto &list = *reinterpret_cast<const discrete_sound_device::task_list_t *>(param);
@@ -255,11 +318,19 @@ inline bool discrete_task::process()
 	m_samples -= samples;
 	if (m_samples < 0)
 		throw emu_fatalerror("discrete_task::process: m_samples got negative");
-	while (samples > 0)
+	if (m_use_blocks)
 	{
-		// step
-		step_nodes();
-		samples--;
+		if (samples > 0)
+			step_block(samples);
+	}
+	else
+	{
+		while (samples > 0)
+		{
+			// step
+			step_nodes();
+			samples--;
+		}
 	}
 	if (m_samples == 0)
 	{
@@ -346,6 +417,121 @@ void discrete_task::check(discrete_task &dest_task)
 	}
 }
 
+void discrete_task::prepare_blocks()
+{
+	m_use_blocks = false;
+	m_block_plans.clear();
+	m_block_sources.clear();
+	m_block_buffers.clear();
+	m_block_history.reset();
+
+	if (!USE_DISCRETE_BLOCKS)
+		return;
+
+	// find the node of this task owning an output, or -1
+	auto const local_node = [this] (const double *ptr) -> int
+	{
+		for (int nodenum = 0; nodenum < step_list.size(); nodenum++)
+		{
+			const discrete_base_node *node = step_list[nodenum]->self;
+			if (ptr >= &node->m_output[0] && ptr < &node->m_output[DISCRETE_MAX_OUTPUTS])
+				return nodenum;
+		}
+		return -1;
+	};
+
+	// is this the output of a node stepped by another task?
+	auto const foreign_node = [this] (const double *ptr) -> bool
+	{
+		discrete_step_interface *step;
+		for (const auto &node : m_device.m_node_list)
+			if (node->interface(step) && ptr >= &node->m_output[0] && ptr < &node->m_output[DISCRETE_MAX_OUTPUTS])
+				return true;
+		return false;
+	};
+
+	auto const source_node = [this] (const double *ptr) -> input_buffer *
+	{
+		for (input_buffer &sn : source_list)
+			if (ptr == &sn.buffer)
+				return &sn;
+		return nullptr;
+	};
+
+	/* Reordering the loops is only possible if every node sees the same
+	 * values: inputs must come from earlier nodes of this task, from
+	 * other tasks through the source list, or be constant for the block.
+	 */
+	for (const double *shared : m_device.m_shared_outputs)
+		if (local_node(shared) >= 0)
+			return;
+
+	std::vector<const double *> streamed;
+	for (int nodenum = 0; nodenum < step_list.size(); nodenum++)
+	{
+		discrete_base_node *node = step_list[nodenum]->self;
+
+		for (int inputnum = 0; inputnum < node->active_inputs(); inputnum++)
+		{
+			const double *ptr = node->m_input[inputnum];
+			int const producer = local_node(ptr);
+			if (producer >= nodenum)
+				return;     // feedback from this or a later node needs the previous sample
+			if (producer >= 0)
+			{
+				if (std::find(streamed.begin(), streamed.end(), ptr) == streamed.end())
+					streamed.push_back(ptr);
+			}
+			else if (source_node(ptr) == nullptr && foreign_node(ptr))
+				return;
+		}
+	}
+	for (output_buffer &outbuf : m_buffers)
+	{
+		if (local_node(outbuf.source) < 0)
+			return;
+		if (std::find(streamed.begin(), streamed.end(), outbuf.source) == streamed.end())
+			streamed.push_back(outbuf.source);
+	}
+
+	// one history per streamed output
+	m_block_history = std::make_unique<double []>(std::max<size_t>(streamed.size(), 1) * MAX_SAMPLES_PER_TASK_SLICE);
+	auto const history = [this, &streamed] (const double *ptr) -> double *
+	{
+		return &m_block_history[(std::find(streamed.begin(), streamed.end(), ptr) - streamed.begin()) * MAX_SAMPLES_PER_TASK_SLICE];
+	};
+
+	m_block_plans.resize(step_list.size());
+	for (int nodenum = 0; nodenum < step_list.size(); nodenum++)
+	{
+		discrete_base_node *node = step_list[nodenum]->self;
+		discrete_block_plan &plan = m_block_plans[nodenum];
+
+		for (int inputnum = 0; inputnum < node->active_inputs(); inputnum++)
+		{
+			const double *ptr = node->m_input[inputnum];
+			if (local_node(ptr) >= 0)
+				plan.inputs.push_back(discrete_block_input{ &node->m_input[inputnum], history(ptr), ptr });
+			else if (source_node(ptr) != nullptr)
+				plan.inputs.push_back(discrete_block_input{ &node->m_input[inputnum], nullptr, ptr });
+		}
+		for (const double *ptr : streamed)
+			if (local_node(ptr) == nodenum)
+				plan.outputs.push_back(discrete_block_output{ ptr, history(ptr) });
+	}
+
+	// the plans are complete, so pointers into them stay valid
+	for (discrete_block_plan &plan : m_block_plans)
+		for (discrete_block_input &in : plan.inputs)
+			if (in.base == nullptr)
+				m_block_sources.emplace_back(&in, source_node(in.value));
+	for (output_buffer &outbuf : m_buffers)
+		m_block_buffers.push_back(history(outbuf.source));
+
+	m_use_blocks = true;
+	m_device.discrete_log("dso_task_start - task %p group %d steps %d nodes in blocks", this, task_group, int(step_list.size()));
+}
+
 /*************************************
  *
  *  Base node implementation
@@ -454,7 +640,10 @@ const double *discrete_device::node_output_ptr(int onode)
 
 	if (node != nullptr)
 	{
-		return &(node->m_output[NODE_CHILD_NODE_NUM(onode)]);
+		const double *ptr = &(node->m_output[NODE_CHILD_NODE_NUM(onode)]);
+		if (std::find(m_shared_outputs.begin(), m_shared_outputs.end(), ptr) == m_shared_outputs.end())
+			m_shared_outputs.push_back(ptr);
+		return ptr;
 	}
 	else
 		return nullptr;
@@ -884,6 +1073,7 @@ void discrete_device::device_start()
 
 	/* Start with empty lists */
 	m_node_list.clear();
+	m_shared_outputs.clear();
 
 	/* allocate memory to hold pointers to nodes by index */
 	m_indexed_node = make_unique_clear<discrete_base_node * []>(DISCRETE_MAX_NODES);
@@ -1004,6 +1194,10 @@ void discrete_device::device_reset()
 
 		node->reset();
 	}
+
+	/* the nodes have linked to each other, so decide how to step each task */
+	for (const auto &task : task_list)
+		task->prepare_blocks();
 }
 
 void discrete_sound_device::device_reset()
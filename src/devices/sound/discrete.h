@@ -4141,12 +4141,49 @@ struct discrete_block
  *
  *************************************/
 
+/* an input of a node stepped in block mode, advanced through a buffer of samples */
+struct discrete_block_input
+{
+	const double **         slot;               /* entry in the node's m_input[] */
+	const double *          base;               /* value of the first sample of the block */
+	const double *          value;              /* pointer restored after the block */
+};
+
+/* an output of a node stepped in block mode, recorded after every sample */
+struct discrete_block_output
+{
+	const double *          source;             /* entry in the node's m_output[] */
+	double *                history;            /* one value per sample of the block */
+};
+
+struct discrete_block_plan
+{
+	std::vector<discrete_block_input>   inputs;
+	std::vector<discrete_block_output>  outputs;
+};
+
+/* step a node 'samples' times, feeding it one sample of each streamed input at a time */
+template <typename Step>
+inline void discrete_step_block(int samples, const discrete_block_plan &plan, Step &&step)
+{
+	for (int sample = 0; sample < samples; sample++)
+	{
+		for (const discrete_block_input &in : plan.inputs)
+			*in.slot = in.base + sample;
+		step();
+		for (const discrete_block_output &out : plan.outputs)
+			out.history[sample] = *out.source;
+	}
+}
+
 class discrete_step_interface
 {
 public:
 	virtual ~discrete_step_interface() { }
 
 	virtual void step() = 0;
+	/* the node classes override this so that step() is called directly and can be inlined */
+	virtual void step_block(int samples, const discrete_block_plan &plan) { discrete_step_block(samples, plan, [this] () { step(); }); }
 	osd_ticks_t         run_time;
 	discrete_base_node *    self;
 };
@@ -4178,6 +4215,8 @@ class discrete_sound_output_interface;
 
 class discrete_device : public device_t
 {
+	friend class discrete_task;
+
 protected:
 	// construction/destruction
 	discrete_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
@@ -4267,6 +4306,9 @@ private:
 	/* parallel tasks */
 	osd_work_queue *        m_queue;
 
+	/* outputs handed out by node_output_ptr(), read by nodes behind the back of m_input[] */
+	std::vector<const double *> m_shared_outputs;
+
 	/* profiling */
 	int                     m_profiling;
 	uint64_t                  m_total_samples;
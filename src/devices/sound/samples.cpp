@@ -57,10 +57,24 @@ samples_device::samples_device(const machine_config &mconfig, device_type type,
 	, m_samples_start_cb(*this)
 	, m_channels(0)
 	, m_names(nullptr)
+	, m_decode_queue(nullptr)
+	, m_use_count(0)
+	, m_decoded_size(0)
 {
 }
 
 
+//-------------------------------------------------
+//  ~samples_device - destructor
+//-------------------------------------------------
+
+samples_device::~samples_device()
+{
+	if (m_decode_queue)
+		osd_work_queue_free(m_decode_queue);
+}
+
+
 //**************************************************************************
 //  PUBLIC INTERFACE
 //**************************************************************************
@@ -82,11 +96,14 @@ void samples_device::start(uint8_t channel, uint32_t samplenum, bool loop)
 	channel_t &chan = m_channel[channel];
 	chan.stream->update();
 
+	// get the rest of it decoding while the first block plays
+	start_decode(samplenum);
+
 	// update the parameters
 	sample_t &sample = m_sample[samplenum];
-	chan.source = (sample.data.size() > 0) ? &sample.data[0] : nullptr;
+	chan.source_len = sample_length(samplenum);
+	chan.source = (chan.source_len > 0) ? sample.data.data() : nullptr;
 	chan.source_num = (chan.source_len > 0) ? samplenum : -1;
-	chan.source_len = sample.data.size();
 	chan.pos = 0;
 	chan.basefreq = sample.frequency;
 	chan.curfreq = sample.frequency;
@@ -228,8 +245,10 @@ bool samples_device::playing(uint8_t channel) const
 
 void samples_device::device_start()
 {
-	// read audio samples
-	load_samples();
+	// read audio samples, leaving long FLAC samples to be decoded when played
+	load_samples(true);
+	if (!m_lazy.empty())
+		m_decode_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
 
 	// allocate channels
 	m_channel.resize(m_channels);
@@ -270,6 +289,24 @@ void samples_device::device_reset()
 }
 
 
+//-------------------------------------------------
+//  device_stop - wait for background decoding
+//-------------------------------------------------
+
+void samples_device::device_stop()
+{
+	for (lazy_t &lazy : m_lazy)
+	{
+		if (lazy.item)
+		{
+			while (!osd_work_item_wait(lazy.item, osd_ticks_per_second() * 100)) { }
+			osd_work_item_release(lazy.item);
+			lazy.item = nullptr;
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  device_post_load - handle updating after a
 //  restore
@@ -284,11 +321,15 @@ void samples_device::device_post_load()
 		channel_t &chan = m_channel[channel];
 		if (chan.source_num >= 0 && chan.source_num < m_sample.size())
 		{
+			start_decode(chan.source_num);
 			sample_t &sample = m_sample[chan.source_num];
-			chan.source = &sample.data[0];
-			chan.source_len = sample.data.size();
-			if (sample.data.empty())
+			chan.source = sample.data.data();
+			chan.source_len = sample_length(chan.source_num);
+			if (!chan.source_len)
+			{
+				chan.source = nullptr;
 				chan.source_num = -1;
+			}
 		}
 
 		// validate the position against the length in case the sample is smaller
@@ -331,6 +372,13 @@ void samples_device::sound_stream_update(sound_stream &stream, std::vector<read_
 				// load some info locally
 				double step = double(chan.curfreq) / double(buffer.sample_rate());
 				double endpos = chan.source_len;
+
+				// make sure everything this update can reach has been decoded
+				if (chan.source_num >= 0)
+				{
+					double const reach = chan.pos + step * buffer.samples() + 2;
+					chan.source = sample_data(chan.source_num, (chan.loop || (reach >= endpos)) ? chan.source_len : uint32_t(reach));
+				}
 				const int16_t *sample = chan.source;
 
 				for (int sampindex = 0; sampindex < buffer.samples(); sampindex++)
@@ -583,11 +631,12 @@ bool samples_device::read_flac_sample(emu_file &file, sample_t &sample)
 
 //-------------------------------------------------
 //  load_samples - load all the samples in our
-//  attached interface
+//  attached interface, optionally leaving long
+//  FLAC samples to be decoded when first played
 //  Returns true when all samples were successfully read, else false
 //-------------------------------------------------
 
-bool samples_device::load_samples()
+bool samples_device::load_samples(bool lazy)
 {
 	bool ok = true;
 	// if the user doesn't want to use samples, bail
@@ -601,6 +650,9 @@ bool samples_device::load_samples()
 
 	// pre-size the array
 	m_sample.resize(iter.count());
+	bool anylazy = false;
+	if (lazy)
+		m_lazy.resize(m_sample.size());
 
 	// load the samples
 	int index = 0;
@@ -608,20 +660,24 @@ bool samples_device::load_samples()
 	{
 		// attempt to open as FLAC first
 		emu_file file(machine().options().sample_path(), OPEN_FLAG_READ);
-		std::error_condition filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.flac", basename, samplename));
+		std::string filename = util::string_format("%s" PATH_SEPARATOR "%s.flac", basename, samplename);
+		std::error_condition filerr = file.open(filename);
 		if (filerr && altbasename)
-			filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.flac", altbasename, samplename));
+			filerr = file.open(filename = util::string_format("%s" PATH_SEPARATOR "%s.flac", altbasename, samplename));
 
 		// if not, try as WAV
 		if (filerr)
-			filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.wav", basename, samplename));
+			filerr = file.open(filename = util::string_format("%s" PATH_SEPARATOR "%s.wav", basename, samplename));
 		if (filerr && altbasename)
-			filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.wav", altbasename, samplename));
+			filerr = file.open(filename = util::string_format("%s" PATH_SEPARATOR "%s.wav", altbasename, samplename));
 
 		// if opened, read it
 		if (!filerr)
 		{
-			read_sample(file, m_sample[index]);
+			if (lazy && prime_flac_sample(file, index, std::move(filename)))
+				anylazy = true;
+			else
+				read_sample(file, m_sample[index]);
 		}
 		else
 		{
@@ -629,5 +685,197 @@ bool samples_device::load_samples()
 			ok = false;
 		}
 	}
+
+	// nothing to decode later
+	if (!anylazy)
+		m_lazy.clear();
 	return ok;
 }
+
+
+//-------------------------------------------------
+//  prime_flac_sample - decode just the first block
+//  of a long FLAC sample, returns false if it
+//  should be loaded in full instead
+//-------------------------------------------------
+
+bool samples_device::prime_flac_sample(emu_file &file, uint32_t samplenum, std::string &&filename)
+{
+	uint8_t buf[4];
+	bool const isflac = (file.read(buf, 4) == 4) && !memcmp(&buf[0], "fLaC", 4);
+	file.seek(0, SEEK_SET);
+	if (!isflac)
+		return false;
+
+	{
+		flac_decoder decoder((util::core_file &)file);
+		uint32_t const length = decoder.total_samples();
+		if ((decoder.channels() == 1) && (decoder.bits_per_sample() == 16) && (length > PRIME_SAMPLES))
+		{
+			sample_t &sample = m_sample[samplenum];
+			sample.frequency = decoder.sample_rate();
+			sample.data.resize(PRIME_SAMPLES);
+			if (decoder.decode_interleaved(&sample.data[0], PRIME_SAMPLES))
+			{
+				lazy_t &lazy = m_lazy[samplenum];
+				lazy.samplenum = samplenum;
+				lazy.filename = std::move(filename);
+				lazy.length = length;
+				return true;
+			}
+			sample.data.clear();
+		}
+	}
+
+	// short, odd or broken files go through the normal path
+	file.seek(0, SEEK_SET);
+	return false;
+}
+
+
+//-------------------------------------------------
+//  sample_length - full length of a sample,
+//  whether or not it's all been decoded
+//-------------------------------------------------
+
+uint32_t samples_device::sample_length(uint32_t samplenum) const
+{
+	if (!m_lazy.empty() && !m_lazy[samplenum].filename.empty())
+		return m_lazy[samplenum].length;
+	return m_sample[samplenum].data.size();
+}
+
+
+//-------------------------------------------------
+//  sample_data - get a sample's data with at least
+//  the first needed samples decoded
+//-------------------------------------------------
+
+const int16_t *samples_device::sample_data(uint32_t samplenum, uint32_t needed)
+{
+	sample_t &sample = m_sample[samplenum];
+	if (!m_lazy.empty() && m_lazy[samplenum].item)
+		finish_decode(m_lazy[samplenum], needed > sample.data.size());
+	return sample.data.data();
+}
+
+
+//-------------------------------------------------
+//  start_decode - start decoding the rest of a
+//  sample in the background if it's needed
+//-------------------------------------------------
+
+void samples_device::start_decode(uint32_t samplenum)
+{
+	if (m_lazy.empty())
+		return;
+
+	lazy_t &lazy = m_lazy[samplenum];
+	lazy.last_used = ++m_use_count;
+	if (lazy.filename.empty() || lazy.item || (m_sample[samplenum].data.size() == lazy.length))
+		return;
+
+	lazy.file = std::make_unique<emu_file>(machine().options().sample_path(), OPEN_FLAG_READ);
+	lazy.decoded.resize(lazy.length);
+	lazy.ok = false;
+	if (lazy.file->open(lazy.filename))
+	{
+		// it was there at startup; finish_decode will play silence after the first block
+		lazy.file.reset();
+		finish_decode(lazy, true);
+		return;
+	}
+	lazy.item = osd_work_item_queue(m_decode_queue, decode_callback, &lazy, 0);
+	if (!lazy.item)
+	{
+		decode_callback(&lazy, 0);
+		finish_decode(lazy, true);
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_decode - take over the decoded sample
+//  if the background decode is done, or wait for
+//  it
+//-------------------------------------------------
+
+void samples_device::finish_decode(lazy_t &lazy, bool wait)
+{
+	if (lazy.item)
+	{
+		if (!wait && !osd_work_item_wait(lazy.item, 0))
+			return;
+		while (!osd_work_item_wait(lazy.item, osd_ticks_per_second() * 100)) { }
+		osd_work_item_release(lazy.item);
+		lazy.item = nullptr;
+	}
+	lazy.file.reset();
+
+	// a failed decode keeps the first block and plays silence after it
+	sample_t &sample = m_sample[lazy.samplenum];
+	if (!lazy.ok)
+	{
+		logerror("Error decoding sample '%s'\n", lazy.filename);
+		std::fill(lazy.decoded.begin(), lazy.decoded.end(), 0);
+		std::copy(sample.data.begin(), sample.data.end(), lazy.decoded.begin());
+	}
+	sample.data.swap(lazy.decoded);
+	std::vector<int16_t>().swap(lazy.decoded);
+
+	m_decoded_size += lazy.length - PRIME_SAMPLES;
+	evict_decoded();
+}
+
+
+//-------------------------------------------------
+//  evict_decoded - drop the least recently used
+//  fully decoded samples that aren't playing
+//  until they fit the budget again
+//-------------------------------------------------
+
+void samples_device::evict_decoded()
+{
+	while (m_decoded_size > DECODED_BUDGET)
+	{
+		lazy_t *oldest = nullptr;
+		for (lazy_t &lazy : m_lazy)
+		{
+			if (lazy.filename.empty() || lazy.item || (m_sample[lazy.samplenum].data.size() != lazy.length))
+				continue;
+			if (oldest && (lazy.last_used >= oldest->last_used))
+				continue;
+			bool const playing = std::any_of(
+					m_channel.begin(),
+					m_channel.end(),
+					[&lazy] (channel_t const &chan) { return chan.source_num == int32_t(lazy.samplenum); });
+			if (!playing)
+				oldest = &lazy;
+		}
+		if (!oldest)
+			return;
+
+		std::vector<int16_t> &data = m_sample[oldest->samplenum].data;
+		data.resize(PRIME_SAMPLES);
+		data.shrink_to_fit();
+		m_decoded_size -= oldest->length - PRIME_SAMPLES;
+	}
+}
+
+
+//-------------------------------------------------
+//  decode_callback - decode a whole sample on a
+//  work queue thread
+//-------------------------------------------------
+
+void *samples_device::decode_callback(void *param, int threadid)
+{
+	lazy_t &lazy = *reinterpret_cast<lazy_t *>(param);
+	lazy.file->seek(0, SEEK_SET);
+	flac_decoder decoder((util::core_file &)*lazy.file);
+	lazy.ok = (decoder.channels() == 1) && (decoder.bits_per_sample() == 16) && (decoder.total_samples() == lazy.length);
+	if (lazy.ok)
+		lazy.ok = decoder.decode_interleaved(&lazy.decoded[0], lazy.length);
+	decoder.finish();
+	return nullptr;
+}
@@ -31,6 +31,7 @@ public:
 
 	// construction/destruction
 	samples_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock = 0);
+	virtual ~samples_device();
 
 	// configuration helpers
 	void set_channels(uint8_t channels) { m_channels = channels; }
@@ -75,6 +76,7 @@ protected:
 	// device-level overrides
 	virtual void device_start() override ATTR_COLD;
 	virtual void device_reset() override ATTR_COLD;
+	virtual void device_stop() override ATTR_COLD;
 	virtual void device_post_load() override;
 
 	// device_sound_interface overrides
@@ -94,10 +96,30 @@ protected:
 		bool            paused;
 	};
 
+	// FLAC sample decoded on demand; data holds only the first block until then
+	struct lazy_t
+	{
+		uint32_t                    samplenum = 0;
+		std::string                 filename;   // within the sample path, empty if loaded up front
+		uint32_t                    length = 0; // full length in samples
+		std::unique_ptr<emu_file>   file;       // open while decoding
+		std::vector<int16_t>        decoded;    // filled by the background decode
+		bool                        ok = false; // background decode succeeded
+		osd_work_item *             item = nullptr;
+		uint64_t                    last_used = 0;
+	};
+
 	// internal helpers
 	static bool read_wav_sample(emu_file &file, sample_t &sample);
 	static bool read_flac_sample(emu_file &file, sample_t &sample);
-	bool load_samples();
+	bool load_samples(bool lazy = false);
+	bool prime_flac_sample(emu_file &file, uint32_t samplenum, std::string &&filename);
+	uint32_t sample_length(uint32_t samplenum) const;
+	const int16_t *sample_data(uint32_t samplenum, uint32_t needed);
+	void start_decode(uint32_t samplenum);
+	void finish_decode(lazy_t &lazy, bool wait);
+	void evict_decoded();
+	static void *decode_callback(void *param, int threadid);
 
 	start_cb_delegate m_samples_start_cb; // optional callback
 
@@ -108,11 +130,17 @@ protected:
 	// internal state
 	std::vector<channel_t> m_channel;
 	std::vector<sample_t> m_sample;
+	std::vector<lazy_t> m_lazy;         // empty unless loaded lazily
+	osd_work_queue *m_decode_queue;
+	uint64_t m_use_count;               // samples started, to find the least recently used
+	size_t m_decoded_size;              // samples decoded past their first block
 
 	// internal constants
 	static constexpr uint8_t FRAC_BITS = 24;
 	static constexpr uint32_t FRAC_ONE = 1 << FRAC_BITS;
 	static constexpr uint32_t FRAC_MASK = FRAC_ONE - 1;
+	static constexpr uint32_t PRIME_SAMPLES = 8192;         // decoded at load so playback can start at once
+	static constexpr size_t DECODED_BUDGET = 16 * 1024 * 1024; // fully decoded samples to keep when idle
 };
 
 // iterator, since lots of people are interested in these devices
@@ -284,6 +284,8 @@ void scsp_device::device_start()
 
 void scsp_device::device_post_load()
 {
+	m_DSP.Decoded = false;
+
 	for (int slot = 0; slot < 32; slot++)
 		Compute_LFO(&m_Slots[slot]);
 
@@ -985,6 +987,7 @@ void scsp_device::w16(u32 addr, u16 val)
 		else if (addr < 0xC00)
 		{
 			*((uint16_t *) (m_DSP.MPRO + (addr - 0x800) / 2)) = val;
+			m_DSP.Decoded = false;
 
 			if (addr == 0xBF0)
 			{
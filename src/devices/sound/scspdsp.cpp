@@ -65,19 +65,76 @@ void SCSPDSP::Init()
 	Stopped = true;
 }
 
+void SCSPDSP::Decode()
+{
+	// extract the fields of each step once, masking off the memory accesses
+	// that are only honoured on odd steps
+	STEP decoded[128];
+	for (int step = 0; step < LastStep; ++step)
+	{
+		u16 const *const IPtr = MPRO + (step * 4);
+		STEP &s = decoded[step];
+
+		s.TRA   = (IPtr[0] >>  8) & 0x7f;
+		s.TWT   = (IPtr[0] >>  7) & 0x01;
+		s.TWA   = (IPtr[0] >>  0) & 0x7f;
+
+		s.XSEL  = (IPtr[1] >> 15) & 0x01;
+		s.YSEL  = (IPtr[1] >> 13) & 0x03;
+		s.IRA   = (IPtr[1] >>  6) & 0x3f;
+		s.IWT   = (IPtr[1] >>  5) & 0x01;
+		s.IWA   = (IPtr[1] >>  0) & 0x1f;
+
+		s.TABLE = (IPtr[2] >> 15) & 0x01;
+		s.MWT   = (IPtr[2] >> 14) & (step & 1);
+		s.MRD   = (IPtr[2] >> 13) & (step & 1);
+		s.EWT   = (IPtr[2] >> 12) & 0x01;
+		s.EWA   = (IPtr[2] >>  8) & 0x0f;
+		s.ADRL  = (IPtr[2] >>  7) & 0x01;
+		s.FRCL  = (IPtr[2] >>  6) & 0x01;
+		s.SHIFT = (IPtr[2] >>  4) & 0x03;
+		s.YRL   = (IPtr[2] >>  3) & 0x01;
+		s.NEGB  = (IPtr[2] >>  2) & 0x01;
+		s.ZERO  = (IPtr[2] >>  1) & 0x01;
+		s.BSEL  = (IPtr[2] >>  0) & 0x01;
+
+		s.NOFL  = (IPtr[3] >> 15) & 0x01;
+		s.COEF  = (IPtr[3] >>  9) & 0x3f;
+
+		s.MASA  = (IPtr[3] >>  2) & 0x1f;
+		s.ADREB = (IPtr[3] >>  1) & 0x01;
+		s.NXADR = (IPtr[3] >>  0) & 0x01;
+	}
+
+	// walking backwards, drop each step that writes nothing and whose ACC
+	// is not read by the next step that is kept; programs are padded with
+	// such steps, so this usually leaves far fewer than 128
+	bool keep[128];
+	bool acc_read = false;
+	for (int step = LastStep - 1; step >= 0; --step)
+	{
+		STEP const &s = decoded[step];
+		keep[step] = acc_read || s.TWT || s.IWT || s.MWT || s.MRD || s.EWT || s.ADRL || s.FRCL || s.YRL || (s.IRA > 0x31);
+		if (keep[step])
+			acc_read = (!s.ZERO && s.BSEL) || s.TWT || s.MWT || s.EWT || s.FRCL || (s.ADRL && (s.SHIFT == 3));
+	}
+
+	ProgramSteps = 0;
+	for (int step = 0; step < LastStep; ++step)
+		if (keep[step])
+			Program[ProgramSteps++] = decoded[step];
+	Decoded = true;
+}
+
 void SCSPDSP::Step()
 {
 	if (Stopped)
 		return;
 
-	std::fill(std::begin(EFREG), std::end(EFREG), 0);
+	if (!Decoded)
+		Decode();
 
-#if 0
-	int dump=0;
-	FILE *f=nullptr;
-	if(dump)
-		f=fopen("dsp.txt","wt");
-#endif
+	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 
 	s32 ACC = 0;    //26 bit
 	s32 MEMVAL = 0;
@@ -85,136 +142,76 @@ void SCSPDSP::Step()
 	s32 Y_REG = 0;      //24 bit
 	u32 ADRS_REG = 0;  //13 bit
 
-	for (int step = 0; step < /*128*/LastStep; ++step)
+	for (int step = 0; step < ProgramSteps; ++step)
 	{
-		u16 *const IPtr = MPRO + (step * 4);
-
-		//if (!IPtr[0] && !IPtr[1] && !IPtr[2] && !IPtr[3])
-			//break;
-
-		u32 const TRA   = (IPtr[0] >>  8) & 0x7f;
-		u32 const TWT   = (IPtr[0] >>  7) & 0x01;
-		u32 const TWA   = (IPtr[0] >>  0) & 0x7f;
-
-		u32 const XSEL  = (IPtr[1] >> 15) & 0x01;
-		u32 const YSEL  = (IPtr[1] >> 13) & 0x03;
-		u32 const IRA   = (IPtr[1] >>  6) & 0x3f;
-		u32 const IWT   = (IPtr[1] >>  5) & 0x01;
-		u32 const IWA   = (IPtr[1] >>  0) & 0x1f;
-
-		u32 const TABLE = (IPtr[2] >> 15) & 0x01;
-		u32 const MWT   = (IPtr[2] >> 14) & 0x01;
-		u32 const MRD   = (IPtr[2] >> 13) & 0x01;
-		u32 const EWT   = (IPtr[2] >> 12) & 0x01;
-		u32 const EWA   = (IPtr[2] >>  8) & 0x0f;
-		u32 const ADRL  = (IPtr[2] >>  7) & 0x01;
-		u32 const FRCL  = (IPtr[2] >>  6) & 0x01;
-		u32 const SHIFT = (IPtr[2] >>  4) & 0x03;
-		u32 const YRL   = (IPtr[2] >>  3) & 0x01;
-		u32 const NEGB  = (IPtr[2] >>  2) & 0x01;
-		u32 const ZERO  = (IPtr[2] >>  1) & 0x01;
-		u32 const BSEL  = (IPtr[2] >>  0) & 0x01;
-
-		u32 const NOFL  = (IPtr[3] >> 15) & 0x01;  //????
-		u32 const COEF  = (IPtr[3] >>  9) & 0x3f;
-
-		u32 const MASA  = (IPtr[3] >>  2) & 0x1f;  //???
-		u32 const ADREB = (IPtr[3] >>  1) & 0x01;
-		u32 const NXADR = (IPtr[3] >>  0) & 0x01;
+		STEP const &s = Program[step];
 
 		//operations are done at 24 bit precision
-#if 0
-		if (MASA)
-			int a=1;
-		if (NOFL)
-			int a=1;
-
-		//int dump=0;
-
-		if (f)
-		{
-#define DUMP(v) fprintf(f, " " #v ": %04X", v);
-			fprintf(f, "%d: ", step);
-			DUMP(ACC);
-			DUMP(SHIFTED);
-			DUMP(X);
-			DUMP(Y);
-			DUMP(B);
-			DUMP(INPUTS);
-			DUMP(MEMVAL);
-			DUMP(FRC_REG);
-			DUMP(Y_REG);
-			DUMP(ADDR);
-			DUMP(ADRS_REG);
-			fprintf(f, "\n");
-#undef DUMP
-		}
-#endif
 
 		//INPUTS RW
 		// colmns97 hits this
 		//assert(IRA < 0x32);
 		s32 INPUTS; // 24-bit
-		if (IRA <= 0x1f)
-			INPUTS = MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
+		if (s.IRA <= 0x1f)
+			INPUTS = MEMS[s.IRA];
+		else if (s.IRA <= 0x2F)
+			INPUTS = MIXS[s.IRA - 0x20] << 4;  //MIXS is 20 bit
+		else if (s.IRA <= 0x31)
+			INPUTS = EXTS[s.IRA - 0x30] << 8;  //EXTS is 16 bit
 		else
 			return;
 
 		INPUTS = util::sext(INPUTS, 24);
 
-		if (IWT)
+		if (s.IWT)
 		{
-			MEMS[IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			MEMS[s.IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
+			if (s.IRA == s.IWA)
 				INPUTS = MEMVAL;
 		}
 
 		//Operand sel
 		s32 B; // 26-bit
-		if (!ZERO)
+		if (!s.ZERO)
 		{
-			if (BSEL)
+			if (s.BSEL)
 				B = ACC;
 			else
-				B = util::sext(TEMP[(TRA + DEC) & 0x7f], 24);
-			if (NEGB)
+				B = util::sext(TEMP[(s.TRA + DEC) & 0x7f], 24);
+			if (s.NEGB)
 				B = 0 - B;
 		}
 		else
 			B = 0;
 
 		s32 X; // 24-bit
-		if (XSEL)
+		if (s.XSEL)
 			X = INPUTS;
 		else
-			X = util::sext(TEMP[(TRA + DEC) & 0x7f], 24);
+			X = util::sext(TEMP[(s.TRA + DEC) & 0x7f], 24);
 
 		s32 Y = 0;  //13 bit
-		if (YSEL == 0)
+		if (s.YSEL == 0)
 			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = this->COEF[COEF] >> 3;   //COEF is 16 bits
-		else if (YSEL == 2)
+		else if (s.YSEL == 1)
+			Y = COEF[s.COEF] >> 3;   //COEF is 16 bits
+		else if (s.YSEL == 2)
 			Y = (Y_REG >> 11) & 0x1fff;
-		else if (YSEL == 3)
+		else if (s.YSEL == 3)
 			Y = (Y_REG >> 4) & 0x0fff;
 
-		if (YRL)
+		if (s.YRL)
 			Y_REG = INPUTS;
 
 		//Shifter
 		s32 SHIFTED = 0;    //24 bit
-		if (SHIFT == 0)
+		if (s.SHIFT == 0)
 			SHIFTED = std::clamp<s32>(ACC, -0x00800000, 0x007fffff);
-		else if (SHIFT == 1)
+		else if (s.SHIFT == 1)
 			SHIFTED = std::clamp<s32>(ACC * 2, -0x00800000, 0x007fffff);
-		else if (SHIFT == 2)
+		else if (s.SHIFT == 2)
 			SHIFTED = util::sext(ACC * 2, 24);
-		else if (SHIFT == 3)
+		else if (s.SHIFT == 3)
 			SHIFTED = util::sext(ACC, 24);
 
 		//ACCUM
@@ -223,64 +220,61 @@ void SCSPDSP::Step()
 		s64 const v = (s64(X) * s64(Y)) >> 12;
 		ACC = int(v + B);
 
-		if (TWT)
-			TEMP[(TWA + DEC) & 0x7f] = SHIFTED;
+		if (s.TWT)
+			TEMP[(s.TWA + DEC) & 0x7f] = SHIFTED;
 
-		if (FRCL)
+		if (s.FRCL)
 		{
-			if (SHIFT == 3)
+			if (s.SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0fff;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1fff;
 		}
 
-		if (MRD || MWT)
-		//if (0)
+		if (s.MRD || s.MWT) //memory only allowed on odd? DoA inserts NOPs on even
 		{
-			u32 ADDR = MADRS[MASA];
-			if (!TABLE)
+			u32 ADDR = MADRS[s.MASA];
+			if (!s.TABLE)
 				ADDR += DEC;
-			if (ADREB)
+			if (s.ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (s.NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!s.TABLE)
 				ADDR &= RBL - 1;
 			else
 				ADDR &= 0xffff;
 			ADDR += RBP << 12;
 			ADDR <<= 1;
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (s.MRD)
 			{
-				if (NOFL)
+				if (s.NOFL)
 					MEMVAL = space->read_word(ADDR) << 8;
 				else
 					MEMVAL = UNPACK(space->read_word(ADDR));
 			}
-			if (MWT && (step & 1))
+			if (s.MWT)
 			{
-				if (NOFL)
+				if (s.NOFL)
 					space->write_word(ADDR, SHIFTED >> 8);
 				else
 					space->write_word(ADDR, PACK(SHIFTED));
 			}
 		}
 
-		if (ADRL)
+		if (s.ADRL)
 		{
-			if (SHIFT == 3)
+			if (s.SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xfff;
 			else
 				ADRS_REG = INPUTS >> 16;
 		}
 
-		if (EWT)
-			EFREG[EWA] += SHIFTED >> 8;
+		if (s.EWT)
+			EFREG[s.EWA] += SHIFTED >> 8;
 	}
 	--DEC;
 	std::fill(std::begin(MIXS), std::end(MIXS), 0);
-	//if (f)
-		//fclose(f);
 }
 
 void SCSPDSP::SetSample(s32 sample, int SEL, int MXL)
@@ -302,4 +296,5 @@ void SCSPDSP::Start()
 			break;
 	}
 	LastStep = i + 1;
+	Decoded = false;
 }
@@ -32,10 +32,25 @@ struct SCSPDSP
 	bool Stopped;
 	int LastStep;
 
+//decoded program, rebuilt by Step() whenever Decoded is cleared
+	struct STEP
+	{
+		u8 TRA, TWT, TWA;
+		u8 XSEL, YSEL, IRA, IWT, IWA;
+		u8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+		u8 NOFL, COEF, MASA, ADREB, NXADR;
+	};
+	STEP Program[128]; //steps that can affect the output, in order
+	int ProgramSteps;
+	bool Decoded;     //cleared when MPRO or LastStep change
+
 	void Init();
 	void SetSample(s32 sample, s32 SEL, s32 MXL);
 	void Step();
 	void Start();
+
+private:
+	void Decode();
 };
 
 #endif // MAME_SOUND_SCSPDSP_H
@@ -65,19 +65,33 @@ void SID6581_t::fill_buffer(write_stream_view &buffer)
 {
 //void* SID6581_t::fill16bitMono(void* buffer, uint32_t numberOfSamples)
 
+	// registers only change between calls (writes update the stream first),
+	// so whatever depends on them alone is worked out once per block
+	int const outputmask = optr3_outputmask;
+	uint16_t const digi = masterVolume << 2;
+	bool const sync = optr[0].sync || optr[1].sync || optr[2].sync;
+
 	for (int sampindex = 0; sampindex < buffer.samples(); sampindex++)
 	{
 		buffer.put(sampindex, mix_mono(
 								 (*optr[0].outProc)(&optr[0])
 								+(*optr[1].outProc)(&optr[1])
-								+((*optr[2].outProc)(&optr[2])&optr3_outputmask)
+								+((*optr[2].outProc)(&optr[2])&outputmask)
 /* hack for digi sounds
    does n't seam to come from a tone operator
    ghostbusters and goldrunner everything except volume zeroed */
-							+(masterVolume<<2)
+							+digi
 //                        +(*sampleEmuRout)()
 		));
-		syncEm();
+		if (sync)
+		{
+			syncEm();
+		}
+		else
+		{
+			for (int v = 0; v < max_voices; v++)
+				optr[v].cycleLenCount--;
+		}
 	}
 }
 
@@ -470,6 +470,29 @@ static const uint8_t reload_table[4] = { 0, 2, 4, 6 }; //sample count reload for
 
 #define NOCOMMAND 0xff
 
+/* The LFSR is clocked 20 times per sample.  Only bits 0, 2, 3 and 12 are tapped, and after 20
+ * shifts every bit of the 16-bit register was shifted in during that sample, so the result
+ * depends only on the low 13 bits beforehand; look it up rather than stepping it. */
+static const uint16_t *rng_step_table()
+{
+	static const auto table = [] ()
+	{
+		std::array<uint16_t, 0x2000> result;
+		for (unsigned i = 0; i < result.size(); i++)
+		{
+			uint16_t rng = i;
+			for (int j = 0; j < 20; j++)
+			{
+				int const bitout = ((rng >> 12) & 1) ^ ((rng >> 3) & 1) ^ ((rng >> 2) & 1) ^ ((rng >> 0) & 1);
+				rng = (rng << 1) | bitout;
+			}
+			result[i] = rng;
+		}
+		return result;
+	}();
+	return table.data();
+}
+
 // Pull in the ROM tables
 #include "tms5110r.hxx"
 
@@ -960,8 +983,9 @@ bool tms5220_device::int_read()
 void tms5220_device::process(int16_t *buffer, unsigned int size)
 {
 	int buf_count = 0;
-	int i, bitout;
+	int i;
 	int32_t this_sample;
+	uint16_t const *const rng_table = rng_step_table();
 
 	LOGMASKED(LOG_GENERATION, "process called with size of %d; IP=%d, PC=%d, subcycle=%d, m_SPEN=%d, m_TALK=%d, m_TALKD=%d\n", size, m_IP, m_PC, m_subcycle, m_SPEN, m_TALK, m_TALKD);
 
@@ -1115,15 +1139,7 @@ void tms5220_device::process(int16_t *buffer, unsigned int size)
 			}
 
 			// Update LFSR *20* times every sample (once per T cycle), like patent shows
-			for (i=0; i<20; i++)
-			{
-				bitout = ((m_RNG >> 12) & 1) ^
-						((m_RNG >>  3) & 1) ^
-						((m_RNG >>  2) & 1) ^
-						((m_RNG >>  0) & 1);
-				m_RNG <<= 1;
-				m_RNG |= bitout;
-			}
+			m_RNG = rng_table[m_RNG & 0x1FFF];
 			this_sample = lattice_filter(); /* execute lattice filter */
 
 			//LOGMASKED(LOG_GENERATION_VERBOSE, "C:%01d; ",m_subcycle);
@@ -1140,8 +1156,7 @@ void tms5220_device::process(int16_t *buffer, unsigned int size)
 			LOGMASKED(LOG_GENERATION_VERBOSE, "\n");
 
 			/* next, force result to 14 bits (since its possible that the addition at the final (k1) stage of the lattice overflowed) */
-			while (this_sample > 16383) this_sample -= 32768;
-			while (this_sample < -16384) this_sample += 32768;
+			this_sample = util::sext(this_sample, 15);
 			if (m_digital_select == 0) // analog SPK pin output is only 8 bits, with clipping
 				buffer[buf_count] = clip_analog(this_sample);
 			else // digital I/O pin output is 12 bits
@@ -1208,26 +1223,33 @@ void tms5220_device::process(int16_t *buffer, unsigned int size)
 		}
 		else // m_TALKD == 0
 		{
-			m_subcycle++;
-			if ((m_subcycle == 2) && (m_PC == 12)) // RESETF3
+			// only the counters run until RESETL4 latches TALK, so stay in a tight loop until then
+			do
 			{
-				if (m_IP == 7) // RESETL4
+				m_subcycle++;
+				if ((m_subcycle == 2) && (m_PC == 12)) // RESETF3
 				{
-					m_TALKD = m_TALK; // TALKD is latched from TALK
-					update_fifo_status_and_ints(); // probably not necessary
-					if ((!m_TALK) && m_SPEN) m_TALK = true; // TALK is only activated if it wasn't already active, if m_SPEN is active, and if we're in RESETL4 (which we are).
+					if (m_IP == 7) // RESETL4
+					{
+						m_TALKD = m_TALK; // TALKD is latched from TALK
+						update_fifo_status_and_ints(); // probably not necessary
+						if ((!m_TALK) && m_SPEN) m_TALK = true; // TALK is only activated if it wasn't already active, if m_SPEN is active, and if we're in RESETL4 (which we are).
+					}
+					m_subcycle = m_subc_reload;
+					m_PC = 0;
+					m_IP++;
+					m_IP&=0x7;
 				}
-				m_subcycle = m_subc_reload;
-				m_PC = 0;
-				m_IP++;
-				m_IP&=0x7;
-			}
-			else if (m_subcycle == 3)
-			{
-				m_subcycle = m_subc_reload;
-				m_PC++;
+				else if (m_subcycle == 3)
+				{
+					m_subcycle = m_subc_reload;
+					m_PC++;
+				}
+				buffer[buf_count++] = -1; /* should be just -1; actual chip outputs -1 every idle sample; (cf note in data sheet, p 10, table 4) */
+				size--;
 			}
-			buffer[buf_count] = -1; /* should be just -1; actual chip outputs -1 every idle sample; (cf note in data sheet, p 10, table 4) */
+			while (size && !m_TALKD);
+			continue;
 		}
 	buf_count++;
 	size--;
@@ -1287,10 +1309,8 @@ int16_t tms5220_device::clip_analog(int16_t cliptemp) const
 int32_t tms5220_device::matrix_multiply(int32_t a, int32_t b) const
 {
 	int32_t result;
-	while (a>511) { a-=1024; }
-	while (a<-512) { a+=1024; }
-	while (b>16383) { b-=32768; }
-	while (b<-16384) { b+=32768; }
+	a = util::sext(a, 10);
+	b = util::sext(b, 15);
 	result = ((a*b)>>9); /** TODO: this isn't technically right to the chip, which truncates the lowest result bit, but it causes glitches otherwise. **/
 	if (result>16383) LOGMASKED(LOG_MULTIPLY, "matrix multiplier overflowed! a: %x, b: %x, result: %x", a, b, result);
 	if (result<-16384) LOGMASKED(LOG_MULTIPLY, "matrix multiplier underflowed! a: %x, b: %x, result: %x", a, b, result);
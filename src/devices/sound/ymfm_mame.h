@@ -252,27 +252,35 @@ protected:
 		return m_chip;
 	}
 
-	// internal update helper
+	// internal update helper; every register access updates the stream first,
+	// so each call renders a run of samples with no register changes and the
+	// chip can generate it in as few blocks as possible
 	void update_internal(std::vector<write_stream_view> &outputs, int output_shift = 0)
 	{
 		// local buffer to hold samples
-		constexpr int MAX_SAMPLES = 256;
+		constexpr int MAX_SAMPLES = 1024;
 		typename ChipClass::output_data output[MAX_SAMPLES];
 
 		// parameters
 		int const outcount = std::min(outputs.size(), std::size(output[0].data));
 		int const numsamples = outputs[0].samples();
 
-		// generate the FM/ADPCM stream
+		// resolve the output rotation once rather than per block
+		write_stream_view *views[std::size(output[0].data)];
+		for (int outnum = 0; outnum < outcount; outnum++)
+			views[outnum] = &outputs[(outnum + output_shift) % OUTPUTS];
+
+		// generate the FM/ADPCM stream a block at a time, then convert each
+		// output of the block in one pass
 		for (int sampindex = 0; sampindex < numsamples; sampindex += MAX_SAMPLES)
 		{
-			int cursamples = std::min(numsamples - sampindex, MAX_SAMPLES);
+			int const cursamples = std::min(numsamples - sampindex, MAX_SAMPLES);
 			m_chip.generate(output, cursamples);
 			for (int outnum = 0; outnum < outcount; outnum++)
 			{
-				int eff_outnum = (outnum + output_shift) % OUTPUTS;
+				write_stream_view &view = *views[outnum];
 				for (int index = 0; index < cursamples; index++)
-					outputs[eff_outnum].put_int(sampindex + index, output[index].data[outnum], 32768);
+					view.put_int(sampindex + index, output[index].data[outnum], 32768);
 			}
 		}
 	}
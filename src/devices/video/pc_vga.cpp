@@ -55,6 +55,8 @@
 
 #include "screen.h"
 
+#include <array>
+
 #define LOG_WARN      (1U << 1)
 #define LOG_REGS      (1U << 2) // deprecated
 #define LOG_DSW       (1U << 3) // Input sense at $3c2
@@ -101,6 +103,21 @@
 #define TGA_COLUMNS (EGA_COLUMNS)
 #define TGA_LINE_LENGTH (vga.crtc.offset<<3)
 
+namespace {
+
+// spreads the bits of one bit plane byte over the nibbles of a word, the
+// leftmost pixel in the lowest nibble, so four planes combine with shifts
+constexpr auto s_planar_spread = [] ()
+{
+	std::array<uint32_t, 256> result{};
+	for (int data = 0; data < 256; data++)
+		for (int i = 0; i < 8; i++)
+			result[data] |= uint32_t(BIT(data, 7 - i)) << (i * 4);
+	return result;
+}();
+
+} // anonymous namespace
+
 
 /***************************************************************************
 
@@ -1290,6 +1307,7 @@ uint8_t vga_device::vga_latch_write(int offs, uint8_t data)
 
 void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int width=VGA_CH_WIDTH, height = (vga.crtc.maximum_scan_line) * (vga.crtc.scan_doubling + 1);
 
 	if(vga.crtc.cursor_enable)
@@ -1326,7 +1344,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!screen().visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 
@@ -1340,7 +1358,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!screen().visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 				}
@@ -1351,7 +1369,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 						(h<=vga.crtc.cursor_scan_end)&&(h<height)&&(line+h<TEXT_LINES);
 						h++)
 				{
-					if(!screen().visible_area().contains(column*width, line+h))
+					if(!visarea.contains(column*width, line+h))
 						continue;
 					bitmap.plot_box(column*width, line+h, width, 1, vga.pens[attr&0xf]);
 				}
@@ -1362,6 +1380,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	int pel_shift = (vga.attribute.pel_shift & 7);
 
@@ -1379,24 +1398,17 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 
 			for (int pos=addr, c=0, column=0; column<EGA_COLUMNS+1; column++, c+=8, pos=(pos+1)&0xffff)
 			{
-				int data[4] = {
-						vga.memory[(pos & 0xffff)],
-						vga.memory[(pos & 0xffff)+0x10000]<<1,
-						vga.memory[(pos & 0xffff)+0x20000]<<2,
-						vga.memory[(pos & 0xffff)+0x30000]<<3 };
+				uint32_t const chunky =
+						s_planar_spread[vga.memory[(pos & 0xffff)]] |
+						(s_planar_spread[vga.memory[(pos & 0xffff)+0x10000]] << 1) |
+						(s_planar_spread[vga.memory[(pos & 0xffff)+0x20000]] << 2) |
+						(s_planar_spread[vga.memory[(pos & 0xffff)+0x30000]] << 3);
 
-				for (int i = 7; i >= 0; i--)
+				for (int i = 0; i < 8; i++)
 				{
-					pen_t pen = vga.pens[(data[0]&1) | (data[1]&2) | (data[2]&4) | (data[3]&8)];
-
-					data[0]>>=1;
-					data[1]>>=1;
-					data[2]>>=1;
-					data[3]>>=1;
-
-					if(!screen().visible_area().contains(c+i-pel_shift, line + yi))
+					if(!visarea.contains(c+i-pel_shift, line + yi))
 						continue;
-					bitmapline[c+i-pel_shift] = pen;
+					bitmapline[c+i-pel_shift] = vga.pens[(chunky >> (i * 4)) & 0xf];
 				}
 			}
 		}
@@ -1407,6 +1419,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 // i.e. a 320x200 is really 640x400
 void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	int pel_shift = (vga.attribute.pel_shift & 6);
 	int addrmask = vga.crtc.no_wrap ? -1 : 0xffff;
@@ -1438,7 +1451,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(int xi=0;xi<8;xi++)
 					{
-						if (!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
+						if (!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-(pel_shift)] = pen(vga.memory[(pos & addrmask)+((xi >> 1)*0x10000)]);
 					}
@@ -1465,7 +1478,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for (int xi=0;xi<0x10;xi++)
 					{
-						if(!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-pel_shift] = pen(vga.memory[(pos+(xi >> 1)) & addrmask]);
 					}
@@ -1477,6 +1490,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = (vga.crtc.scan_doubling + 1);
 
 	int width = (vga.crtc.horz_disp_end + 1) * 8;
@@ -1494,7 +1508,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(int xi=0;xi<4;xi++)
 				{
 					pen_t pen = vga.pens[(vga.memory[addr] >> (6-xi*2)) & 3];
-					if(!screen().visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -1507,6 +1521,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = (vga.crtc.scan_doubling + 1);
 
 	int width = (vga.crtc.horz_disp_end + 1) * 8;
@@ -1524,7 +1539,7 @@ void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(int xi=0;xi<8;xi++)
 				{
 					pen_t pen = vga.pens[(vga.memory[addr] >> (7-xi)) & 1];
-					if(!screen().visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -1926,6 +1941,7 @@ u16 svga_device::line_compare_mask()
 
 void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 
 	uint16_t mask_comp = line_compare_mask();
@@ -1956,7 +1972,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 				for (int xi=0;xi<8;xi++)
 				{
-					if(!screen().visible_area().contains(c+xi, line + yi))
+					if(!visarea.contains(c+xi, line + yi))
 						continue;
 					bitmapline[c+xi] = pen(vga.memory[(pos+(xi))]);
 				}
@@ -1967,6 +1983,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	constexpr uint32_t IV = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -1985,12 +2002,13 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for(int xi=0,xm=0;xi<8;xi++,xm+=2)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				int r = (MV(pos+xm)&0x7c00)>>10;
-				int g = (MV(pos+xm)&0x03e0)>>5;
-				int b = (MV(pos+xm)&0x001f)>>0;
+				uint16_t const pix = MV(pos+xm);
+				int r = (pix&0x7c00)>>10;
+				int g = (pix&0x03e0)>>5;
+				int b = (pix&0x001f)>>0;
 				r = (r << 3) | (r & 0x7);
 				g = (g << 3) | (g & 0x7);
 				b = (b << 3) | (b & 0x7);
@@ -2002,6 +2020,7 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	constexpr uint32_t IV = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -2020,12 +2039,13 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=2)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				int r = (MV(pos+xm)&0xf800)>>11;
-				int g = (MV(pos+xm)&0x07e0)>>5;
-				int b = (MV(pos+xm)&0x001f)>>0;
+				uint16_t const pix = MV(pos+xm);
+				int r = (pix&0xf800)>>11;
+				int g = (pix&0x07e0)>>5;
+				int b = (pix&0x001f)>>0;
 				r = (r << 3) | (r & 0x7);
 				g = (g << 2) | (g & 0x3);
 				b = (b << 3) | (b & 0x7);
@@ -2037,6 +2057,7 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	constexpr uint32_t ID = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -2055,13 +2076,10 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=3)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				int r = (MD(pos+xm)&0xff0000)>>16;
-				int g = (MD(pos+xm)&0x00ff00)>>8;
-				int b = (MD(pos+xm)&0x0000ff)>>0;
-				bitmapline[c+xi] = ID|(r<<16)|(g<<8)|(b<<0);
+				bitmapline[c+xi] = ID|MD(pos+xm);
 			}
 		}
 	}
@@ -2069,6 +2087,7 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	constexpr uint32_t ID = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -2089,13 +2108,10 @@ void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=4)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				int r = (MD(pos+xm)&0xff0000)>>16;
-				int g = (MD(pos+xm)&0x00ff00)>>8;
-				int b = (MD(pos+xm)&0x0000ff)>>0;
-				bitmapline[c+xi] = ID|(r<<16)|(g<<8)|(b<<0);
+				bitmapline[c+xi] = ID|MD(pos+xm);
 			}
 		}
 	}
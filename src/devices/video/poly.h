@@ -30,6 +30,26 @@
         +---------------+---------------+---------------+
     (0.0,2.0)       (1.0,2.0)       (2.0,2.0)       (3.0,2.0)
 
+****************************************************************************
+
+    Work scheduling:
+
+    By default each primitive is split into units of up to 32 scanlines,
+    and every unit is queued as soon as it is created.  Units that land
+    in the same bucket of scanlines are serialized through an atomic
+    chain, which keeps rendering overlapped with emulation but costs one
+    work item per unit and some contention when many small primitives
+    pile up in a bucket.
+
+    With POLY_FLAG_BINNED, units are only collected while primitives are
+    submitted.  wait() then queues a single work item per non-empty
+    bucket, and that worker renders every unit of its bucket in
+    submission order without any synchronization.  This suits drivers
+    that build a whole scene and then wait for it.  Existing drivers opt
+    in by adding the flag to their poly_manager template arguments; the
+    render_* calls and render callbacks are unchanged, though callbacks
+    must still be safe to run on several threads at once.
+
 ***************************************************************************/
 
 #ifndef MAME_VIDEO_POLY_H
@@ -52,6 +72,7 @@
 
 static constexpr u8 POLY_FLAG_NO_WORK_QUEUE       = 0x01;
 static constexpr u8 POLY_FLAG_NO_CLIPPING         = 0x02;
+static constexpr u8 POLY_FLAG_BINNED              = 0x04;   // defer work to wait() and render each bucket of scanlines as one work item
 
 
 //**************************************************************************
@@ -359,6 +380,14 @@ private:
 		extent_t              extent[SCANLINES_PER_BUCKET]; // array of scanline extents
 	};
 
+	// one bucket's worth of work in binned mode
+	struct bucket_work
+	{
+		poly_manager *        m_owner;                // pointer back to the poly manager
+		uint32_t              m_last;                 // index of the last unit in the bucket
+		std::vector<uint32_t> m_units;                // units in submission order, reused between waits
+	};
+
 	// internal array types
 	using primitive_array = poly_array<primitive_info, 0>;
 	using unit_array = poly_array<work_unit, 0>;
@@ -386,8 +415,8 @@ private:
 	// enqueue work items in contiguous chunks
 	void queue_items(u32 start)
 	{
-		// do nothing if no queue; items will be processed on the next wait
-		if (m_queue == nullptr)
+		// do nothing if no queue or binned; items will be processed on the next wait
+		if (m_queue == nullptr || (Flags & POLY_FLAG_BINNED))
 			return;
 
 		// enqueue the items in contiguous chunks
@@ -401,6 +430,7 @@ private:
 	}
 
 	static void *work_item_callback(void *param, int threadid);
+	static void *bucket_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
 
 	// queue management
@@ -414,6 +444,7 @@ private:
 
 	// buckets
 	uint32_t m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	bucket_work m_bucket_work[TOTAL_BUCKETS]; // per-bucket work items in binned mode
 
 	// statistics
 	uint32_t m_tiles;                       // number of tiles queued
@@ -640,6 +671,37 @@ void *poly_manager<BaseType, ObjectType, MaxParams, Flags>::work_item_callback(v
 }
 
 
+//-------------------------------------------------
+//  bucket_callback - process every unit in one
+//  bucket in submission order; units in other
+//  buckets never touch the same scanlines, so no
+//  synchronization is needed
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectType, int MaxParams, u8 Flags>
+void *poly_manager<BaseType, ObjectType, MaxParams, Flags>::bucket_callback(void *param, int threadid)
+{
+	bucket_work &bucket = *(bucket_work *)param;
+	unit_array &units = bucket.m_owner->m_unit;
+
+	// the bucket is chained from its last unit backwards
+	bucket.m_units.clear();
+	for (uint32_t unitnum = bucket.m_last; unitnum != 0xffffffff; unitnum = units.byindex(unitnum).previtem)
+		bucket.m_units.push_back(unitnum);
+
+	for (auto it = bucket.m_units.rbegin(); it != bucket.m_units.rend(); ++it)
+	{
+		work_unit &unit = units.byindex(*it);
+		primitive_info &primitive = *unit.primitive;
+		int count = unit.count_next & 0xff;
+		for (int curscan = 0; curscan < count; curscan++)
+			primitive.m_callback(unit.scanline + curscan, unit.extent[curscan], *primitive.m_object, threadid);
+		unit.count_next = 0;
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  wait - stall until all work is complete
 //-------------------------------------------------
@@ -656,8 +718,30 @@ void poly_manager<BaseType, ObjectType, MaxParams, Flags>::wait(char const *debu
 	osd_ticks_t time = get_profile_ticks();
 #endif
 
+	// in binned mode, hand each non-empty bucket to the queue as a single item
+	if (Flags & POLY_FLAG_BINNED)
+	{
+		int count = 0;
+		for (int bucketnum = 0; bucketnum < TOTAL_BUCKETS; bucketnum++)
+			if (m_unit_bucket[bucketnum] != 0xffffffff)
+			{
+				bucket_work &bucket = m_bucket_work[count++];
+				bucket.m_owner = this;
+				bucket.m_last = m_unit_bucket[bucketnum];
+			}
+
+		if (m_queue != nullptr)
+		{
+			osd_work_item_queue_multiple(m_queue, bucket_callback, count, &m_bucket_work[0], sizeof(m_bucket_work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+			osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+		}
+		else
+			for (int bucketnum = 0; bucketnum < count; bucketnum++)
+				bucket_callback(&m_bucket_work[bucketnum], 0);
+	}
+
 	// wait for all pending work items to complete
-	if (m_queue != nullptr)
+	else if (m_queue != nullptr)
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
 
 	// if we don't have a queue, just run the whole list now
@@ -12,6 +12,12 @@
 #include "emu.h"
 #include "ps2gs.h"
 
+#define LOG_PRIV    (1U << 1)
+#define LOG_REGS    (1U << 2)
+
+#define VERBOSE     (0)
+#include "logmacro.h"
+
 DEFINE_DEVICE_TYPE(SONYPS2_GS, ps2_gs_device, "ps2gs", "Playstation 2 GS")
 
 /*static*/ size_t const ps2_gs_device::FORMAT_PIXEL_WIDTHS[] = {
@@ -262,39 +268,39 @@ uint64_t ps2_gs_device::priv_regs0_r(offs_t offset)
 	{
 		case 0x00:
 			ret = m_pmode;
-			logerror("%s: regs0_r: PMODE (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs0_r: PMODE (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 
 		case 0x04:
 			ret = m_smode2;
-			logerror("%s: regs0_r: SMODE2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs0_r: SMODE2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 
 		case 0x0e:
 		case 0x12:
 			ret = m_dispfb[(offset - 0x0e) / 4];
-			logerror("%s: regs0_r: DISPFB2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs0_r: DISPFB2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 
 		case 0x10:
 		case 0x14:
 			ret = m_display[(offset - 0x10) / 4];
-			logerror("%s: regs0_r: DISPLAY2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs0_r: DISPLAY2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 
 		case 0x1c:
 			ret = m_bgcolor;
-			logerror("%s: regs0_r: BGCOLOR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs0_r: BGCOLOR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 
-		case 0x02: logerror("%s: regs0_r: SMODE1 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x06: logerror("%s: regs0_r: SRFSH (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x08: logerror("%s: regs0_r: SYNCH1 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x0a: logerror("%s: regs0_r: SYNCH2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x0c: logerror("%s: regs0_r: SYNCV (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x16: logerror("%s: regs0_r: EXTBUF (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x18: logerror("%s: regs0_r: EXTDATA (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
-		case 0x1a: logerror("%s: regs0_r: EXTWRITE (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x02: LOGMASKED(LOG_PRIV, "%s: regs0_r: SMODE1 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x06: LOGMASKED(LOG_PRIV, "%s: regs0_r: SRFSH (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x08: LOGMASKED(LOG_PRIV, "%s: regs0_r: SYNCH1 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x0a: LOGMASKED(LOG_PRIV, "%s: regs0_r: SYNCH2 (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x0c: LOGMASKED(LOG_PRIV, "%s: regs0_r: SYNCV (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x16: LOGMASKED(LOG_PRIV, "%s: regs0_r: EXTBUF (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x18: LOGMASKED(LOG_PRIV, "%s: regs0_r: EXTDATA (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
+		case 0x1a: LOGMASKED(LOG_PRIV, "%s: regs0_r: EXTWRITE (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret); break;
 		default:   logerror("%s: regs0_r: Unknown (%08x)\n", machine().describe_context(), 0x12000000 + (offset << 3)); break;
 	}
 	return ret;
@@ -312,7 +318,7 @@ void ps2_gs_device::priv_regs0_w(offs_t offset, uint64_t data)
 			m_alpha_out_select = BIT(data, 6);
 			m_blend_to_background = BIT(data, 7);
 			m_fixed_alpha = (data >> 8) & 0xff;
-			logerror("%s: regs0_w: PMODE = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs0_w: PMODE = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			break;
 
 		case 0x04: // SMODE2
@@ -320,7 +326,7 @@ void ps2_gs_device::priv_regs0_w(offs_t offset, uint64_t data)
 			m_interlace = BIT(data, 0);
 			m_frame_interlace = BIT(data, 1);
 			m_dpms_mode = (data >> 2) & 3;
-			logerror("%s: regs0_w: SMODE2 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs0_w: SMODE2 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			break;
 
 		case 0x0e: // DISPFB1
@@ -333,7 +339,7 @@ void ps2_gs_device::priv_regs0_w(offs_t offset, uint64_t data)
 			m_dispfb_format[index] = (data >> 15) & 0x1f;
 			m_dispfb_x[index] = (data >> 32) & 0x7ff;
 			m_dispfb_y[index] = (data >> 42) & 0x7ff;
-			logerror("%s: regs0_w: DISPFB%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs0_w: DISPFB%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
 			break;
 		}
 
@@ -348,7 +354,7 @@ void ps2_gs_device::priv_regs0_w(offs_t offset, uint64_t data)
 			m_magv[index] = (data >> 27) & 3;
 			m_display_width[index] = (data >> 32) & 0xfff;
 			m_display_height[index] = (data >> 44) & 0x7ff;
-			logerror("%s: regs0_w: DISPLAY%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs0_w: DISPLAY%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
 			break;
 		}
 
@@ -357,17 +363,17 @@ void ps2_gs_device::priv_regs0_w(offs_t offset, uint64_t data)
 			m_bg_r = data & 0xff;
 			m_bg_g = (data >> 8) & 0xff;
 			m_bg_b = (data >> 16) & 0xff;
-			logerror("%s: regs0_w: BGCOLOR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs0_w: BGCOLOR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			break;
 
-		case 0x02: logerror("%s: regs0_w: SMODE1 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x06: logerror("%s: regs0_w: SRFSH = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x08: logerror("%s: regs0_w: SYNCH1 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x0a: logerror("%s: regs0_w: SYNCH2 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x0c: logerror("%s: regs0_w: SYNCV = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x16: logerror("%s: regs0_w: EXTBUF = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x18: logerror("%s: regs0_w: EXTDATA = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
-		case 0x1a: logerror("%s: regs0_w: EXTWRITE = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x02: LOGMASKED(LOG_PRIV, "%s: regs0_w: SMODE1 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x06: LOGMASKED(LOG_PRIV, "%s: regs0_w: SRFSH = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x08: LOGMASKED(LOG_PRIV, "%s: regs0_w: SYNCH1 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x0a: LOGMASKED(LOG_PRIV, "%s: regs0_w: SYNCH2 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x0c: LOGMASKED(LOG_PRIV, "%s: regs0_w: SYNCV = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x16: LOGMASKED(LOG_PRIV, "%s: regs0_w: EXTBUF = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x18: LOGMASKED(LOG_PRIV, "%s: regs0_w: EXTDATA = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
+		case 0x1a: LOGMASKED(LOG_PRIV, "%s: regs0_w: EXTWRITE = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data); break;
 		default:   logerror("%s: regs0_w: Unknown %08x = %08x%08x\n", machine().describe_context(), 0x12000000 + (offset << 3), (uint32_t)(data >> 32), (uint32_t)data); break;
 	}
 	m_base_regs[offset >> 1] = data;
@@ -380,19 +386,19 @@ uint64_t ps2_gs_device::priv_regs1_r(offs_t offset)
 	{
 		case 0x00:
 			ret = m_csr | (CSR_REV | CSR_ID | CSR_FIFO_EMPTY);
-			logerror("%s: regs1_r: CSR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs1_r: CSR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 		case 0x02:
 			ret = m_imr;
-			logerror("%s: regs1_r: IMR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs1_r: IMR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 		case 0x08:
 			ret = m_busdir;
-			logerror("%s: regs1_r: BUSDIR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs1_r: BUSDIR (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 		case 0x10:
 			ret = m_sig_label_id;
-			logerror("%s: regs1_r: SIGLBLID (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
+			LOGMASKED(LOG_PRIV, "%s: regs1_r: SIGLBLID (%08x%08x)\n", machine().describe_context(), (uint32_t)(ret >> 32), (uint32_t)ret);
 			break;
 		default:
 			logerror("%s: regs1_r: Unknown (%08x)\n", machine().describe_context(), 0x12000000 + (offset << 3));
@@ -406,20 +412,20 @@ void ps2_gs_device::priv_regs1_w(offs_t offset, uint64_t data)
 	switch (offset)
 	{
 		case 0x00:
-			logerror("%s: regs1_w: CSR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs1_w: CSR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			m_csr = data &~ (CSR_RESET | CSR_SIGNAL | CSR_HSINT | CSR_VSINT | CSR_EDWINT | CSR_FLUSH);
 			//m_csr |= (CSR_SIGNAL | CSR_HSINT | CSR_VSINT | CSR_EDWINT | CSR_FLUSH);
 			break;
 		case 0x02:
-			logerror("%s: regs1_w: IMR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs1_w: IMR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			m_imr = data;
 			break;
 		case 0x08:
-			logerror("%s: regs1_w: BUSDIR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs1_w: BUSDIR = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			m_busdir = data;
 			break;
 		case 0x10:
-			logerror("%s: regs1_w: SIGLBLID = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_PRIV, "%s: regs1_w: SIGLBLID = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			m_sig_label_id = data;
 			break;
 		default:
@@ -464,9 +470,9 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_curr_context = (data >> 9) & 1;
 			m_fix_fragments = BIT(data, 10);
 			m_kick_count = KICK_COUNTS[m_prim_type];
-			logerror("%s: regs_w: PRIM = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          TYPE=%s GOUR=%d TEX=%d FOG=%d BLEND=%d\n", machine().describe_context(), prim_strs[m_prim_type], BIT(data, 3), BIT(data, 4), BIT(data, 5), BIT(data, 6));
-			logerror("%s          AA=%d NOPERSP=%d CONTEXT=%d FIXFRAG=%d\n", machine().describe_context(), BIT(data, 7), BIT(data, 8), BIT(data, 9), BIT(data, 10));
+			LOGMASKED(LOG_REGS, "%s: regs_w: PRIM = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          TYPE=%s GOUR=%d TEX=%d FOG=%d BLEND=%d\n", machine().describe_context(), prim_strs[m_prim_type], BIT(data, 3), BIT(data, 4), BIT(data, 5), BIT(data, 6));
+			LOGMASKED(LOG_REGS, "%s          AA=%d NOPERSP=%d CONTEXT=%d FIXFRAG=%d\n", machine().describe_context(), BIT(data, 7), BIT(data, 8), BIT(data, 9), BIT(data, 10));
 			break;
 
 		case 0x01: // RGBAQ
@@ -478,8 +484,8 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_vc_a = (data >> 24) & 0xff;
 			uint32_t q = (uint32_t)(data >> 32);
 			m_q = *reinterpret_cast<float*>(&q);
-			logerror("%s: regs_w: RGBAQ = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          R=%02x G=%02x B=%02x A=%02x Q=%f\n", machine().describe_context(), m_vc_r, m_vc_g, m_vc_b, m_vc_a, m_q);
+			LOGMASKED(LOG_REGS, "%s: regs_w: RGBAQ = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          R=%02x G=%02x B=%02x A=%02x Q=%f\n", machine().describe_context(), m_vc_r, m_vc_g, m_vc_b, m_vc_a, m_q);
 			break;
 		}
 
@@ -497,11 +503,11 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 
 			m_vertex_count++;
 
-			logerror("%s: regs_w: XYZ2 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s:         X=%f Y=%f Z=%08x\n", machine().describe_context(), x / 16.0f, y / 16.0f, z);
+			LOGMASKED(LOG_REGS, "%s: regs_w: XYZ2 = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s:         X=%f Y=%f Z=%08x\n", machine().describe_context(), x / 16.0f, y / 16.0f, z);
 			if (m_vertex_count >= m_kick_count)
 			{
-				logerror("%s:         Should begin primitive drawing...\n", machine().describe_context());
+				LOGMASKED(LOG_REGS, "%s:         Should begin primitive drawing...\n", machine().describe_context());
 				switch (m_prim_type & 7)
 				{
 					case PRIM_TYPE_LINE_STRIP:
@@ -537,15 +543,15 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_context[index].m_xyoffset = data;
 			m_context[index].m_offset_x = data & 0xffff;
 			m_context[index].m_offset_y = (data >> 32) & 0xffff;
-			logerror("%s: regs_w: XYFOFFSET%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          X=%f Y=%f\n", machine().describe_context(), m_context[index].m_offset_x / 16.0f, m_context[index].m_offset_y / 16.0f);
+			LOGMASKED(LOG_REGS, "%s: regs_w: XYFOFFSET%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          X=%f Y=%f\n", machine().describe_context(), m_context[index].m_offset_x / 16.0f, m_context[index].m_offset_y / 16.0f);
 			break;
 		}
 
 		case 0x1a: // PRMODECONT
 			m_prmodecont = data;
 			m_use_prim_for_attrs = BIT(data, 0);
-			logerror("%s: regs_w: PRMODECONT = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_use_prim_for_attrs ? "Use PRIM" : "Use PRMODE");
+			LOGMASKED(LOG_REGS, "%s: regs_w: PRMODECONT = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_use_prim_for_attrs ? "Use PRIM" : "Use PRMODE");
 			break;
 
 		case 0x40: // SCISSOR1
@@ -557,21 +563,21 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_context[index].m_scissor_x1 = (data >> 16) & 0x7ff;
 			m_context[index].m_scissor_y0 = (data >> 32) & 0x7ff;
 			m_context[index].m_scissor_y1 = (data >> 48) & 0x7ff;
-			logerror("%s: regs_w: SCISSOR%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          X0=d Y0=%d X1=%d Y1=%d\n", machine().describe_context(), m_context[index].m_scissor_x0, m_context[index].m_scissor_y0, m_context[index].m_scissor_x1, m_context[index].m_scissor_y1);
+			LOGMASKED(LOG_REGS, "%s: regs_w: SCISSOR%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          X0=d Y0=%d X1=%d Y1=%d\n", machine().describe_context(), m_context[index].m_scissor_x0, m_context[index].m_scissor_y0, m_context[index].m_scissor_x1, m_context[index].m_scissor_y1);
 			break;
 		}
 
 		case 0x45: // DTHE
 			m_dthe = data;
 			m_dither = BIT(data, 0);
-			logerror("%s: regs_w: DTHE = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_clamp_color ? "Dither" : "No Dither");
+			LOGMASKED(LOG_REGS, "%s: regs_w: DTHE = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_clamp_color ? "Dither" : "No Dither");
 			break;
 
 		case 0x46: // COLCLAMP
 			m_colclamp = data;
 			m_clamp_color = BIT(data, 0);
-			logerror("%s: regs_w: COLCLAMP = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_clamp_color ? "Clamp Color" : "Wrap Color");
+			LOGMASKED(LOG_REGS, "%s: regs_w: COLCLAMP = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_clamp_color ? "Clamp Color" : "Wrap Color");
 			break;
 
 		case 0x47: // TEST1
@@ -587,8 +593,8 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_context[index].m_dstalpha_pass1 = BIT(data, 15);
 			m_context[index].m_depth_test = BIT(data, 16);
 			m_context[index].m_depth_func = (data >> 17) & 3;
-			logerror("%s: regs_w: SCISSOR%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          X0=d Y0=%d X1=%d Y1=%d\n", machine().describe_context(), m_context[index].m_scissor_x0, m_context[index].m_scissor_y0, m_context[index].m_scissor_x1, m_context[index].m_scissor_y1);
+			LOGMASKED(LOG_REGS, "%s: regs_w: SCISSOR%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          X0=d Y0=%d X1=%d Y1=%d\n", machine().describe_context(), m_context[index].m_scissor_x0, m_context[index].m_scissor_y0, m_context[index].m_scissor_x1, m_context[index].m_scissor_y1);
 			break;
 		}
 
@@ -601,8 +607,8 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_context[index].m_fb_width = (data >> 10) & 0xfc0;
 			m_context[index].m_fb_format = (data >> 24) & 0x3f;
 			m_context[index].m_fb_mask = (uint32_t)(data >> 32);
-			logerror("%s: regs_w: FRAME%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          BASE=%08x WIDTH=%d FORMAT=%d MASK=%08x\n", machine().describe_context(), m_context[index].m_fb_base, m_context[index].m_fb_width, m_context[index].m_fb_format, m_context[index].m_fb_mask);
+			LOGMASKED(LOG_REGS, "%s: regs_w: FRAME%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          BASE=%08x WIDTH=%d FORMAT=%d MASK=%08x\n", machine().describe_context(), m_context[index].m_fb_base, m_context[index].m_fb_width, m_context[index].m_fb_format, m_context[index].m_fb_mask);
 			break;
 		}
 
@@ -614,8 +620,8 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_context[index].m_z_base = (data & 0x1ff) << 11;
 			m_context[index].m_z_format = (data >> 24) & 0xf;
 			m_context[index].m_z_mask = BIT(data, 32);
-			logerror("%s: regs_w: ZBUF%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s          BASE=%08x FORMAT=%d MASK=%d\n", machine().describe_context(), m_context[index].m_z_base, m_context[index].m_z_format, BIT(data, 32));
+			LOGMASKED(LOG_REGS, "%s: regs_w: ZBUF%d = %08x%08x\n", machine().describe_context(), index + 1, (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s          BASE=%08x FORMAT=%d MASK=%d\n", machine().describe_context(), m_context[index].m_z_base, m_context[index].m_z_format, BIT(data, 32));
 			break;
 		}
 		case 0x50: // BITBLTBUF
@@ -626,9 +632,9 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_dst_buf_base  = ((uint32_t)(m_bitbltbuf >> 32) & 0x7fff) << 6;
 			m_dst_buf_width = ((uint32_t)(m_bitbltbuf >> 48) & 0x3f) << 6;
 			m_dst_buf_fmt   = (uint8_t)((m_bitbltbuf >> 56) & 0x3f);
-			logerror("%s: regs_w: BITBLTBUF = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
-			logerror("%s:         SRCBASE=%08x SRCWIDTH=%d SRCFMT=%s\n", machine().describe_context(), m_src_buf_base, m_src_buf_width, FORMAT_NAMES[m_src_buf_fmt]);
-			logerror("%s:         DSTBASE=%08x DSTWIDTH=%d DSTFMT=%s\n", machine().describe_context(), m_dst_buf_base, m_dst_buf_width, FORMAT_NAMES[m_dst_buf_fmt]);
+			LOGMASKED(LOG_REGS, "%s: regs_w: BITBLTBUF = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s:         SRCBASE=%08x SRCWIDTH=%d SRCFMT=%s\n", machine().describe_context(), m_src_buf_base, m_src_buf_width, FORMAT_NAMES[m_src_buf_fmt]);
+			LOGMASKED(LOG_REGS, "%s:         DSTBASE=%08x DSTWIDTH=%d DSTFMT=%s\n", machine().describe_context(), m_dst_buf_base, m_dst_buf_width, FORMAT_NAMES[m_dst_buf_fmt]);
 			break;
 		case 0x51: // TRXPOS
 			m_trx_pos = data;
@@ -637,20 +643,20 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			m_dst_ul_x = (uint32_t)(m_trx_pos >> 32) & 0x7ff;
 			m_dst_ul_y = (uint32_t)(m_trx_pos >> 48) & 0x7ff;
 			m_copy_dir = (uint8_t)(m_trx_pos >> 59) & 3;
-			logerror("%s: regs_w: TRXPOS = %08x%08x, SRCUL=%d,%d  DSTUL=%d,%d, DIR=%d\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_src_ul_x, m_src_ul_y, m_dst_ul_x, m_dst_ul_y, m_copy_dir);
+			LOGMASKED(LOG_REGS, "%s: regs_w: TRXPOS = %08x%08x, SRCUL=%d,%d  DSTUL=%d,%d, DIR=%d\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_src_ul_x, m_src_ul_y, m_dst_ul_x, m_dst_ul_y, m_copy_dir);
 			break;
 		case 0x52: // TRXREG
 			m_trx_reg = data;
 			m_trx_width = (uint32_t)m_trx_reg & 0xfff;
 			m_trx_height = (uint32_t)(m_trx_reg >> 32) & 0xfff;
-			logerror("%s: regs_w: TRXREG = %08x%08x, DIMS=%dx%d\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_trx_width, m_trx_height);
+			LOGMASKED(LOG_REGS, "%s: regs_w: TRXREG = %08x%08x, DIMS=%dx%d\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, m_trx_width, m_trx_height);
 			break;
 		case 0x53: // TRXDIR
 			m_trx_dir = data & 3;
-			logerror("%s: regs_w: TRXDIR = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, dir_strs[m_trx_dir]);
+			LOGMASKED(LOG_REGS, "%s: regs_w: TRXDIR = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, dir_strs[m_trx_dir]);
 			break;
 		case 0x54: // HWREG
-			logerror("%s: regs_w: HWREG = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
+			LOGMASKED(LOG_REGS, "%s: regs_w: HWREG = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
 			copy_dword_from_host(data);
 			break;
 		default:
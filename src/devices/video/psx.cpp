@@ -46,6 +46,8 @@ psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, co
 	: device_t(mconfig, type, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_gpu_queue(nullptr)
+	, m_gpu_item(nullptr)
 	, m_vblank_handler(*this)
 {
 }
@@ -67,10 +69,23 @@ void psxgpu_device::device_start()
 	{
 		psx_gpu_init( 2 );
 	}
+
+	// the debug viewer and logging want to run on the emulation thread
+	if (PSXGPU_THREADED && !PSXGPU_DEBUG_VIEWER && !VERBOSE)
+		m_gpu_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+}
+
+void psxgpu_device::device_stop()
+{
+	gpu_wait();
+	if (m_gpu_queue)
+		osd_work_queue_free(m_gpu_queue);
+	m_gpu_queue = nullptr;
 }
 
 void psxgpu_device::device_reset()
 {
+	gpu_wait();
 	gpu_reset();
 }
 
@@ -637,8 +652,14 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 	save_item(NAME(m_check_stp));
 }
 
+void psxgpu_device::device_pre_save()
+{
+	gpu_wait();
+}
+
 void psxgpu_device::device_post_load()
 {
+	gpu_wait();
 	updatevisiblearea();
 }
 
@@ -656,6 +677,8 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 	int n_overscantop;
 	int n_overscanleft;
 
+	gpu_wait();
+
 #if PSXGPU_DEBUG_VIEWER
 	if( DebugMeshDisplay( bitmap, cliprect ) )
 	{
@@ -2748,7 +2771,55 @@ void psxgpu_device::MoveImage()
 
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
-	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+	if( m_gpu_queue == nullptr )
+	{
+		gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+		return;
+	}
+
+	// the words are copied, as the CPU can overwrite the ordering table as soon as the DMA ends
+	m_gpu_pending.insert( m_gpu_pending.end(), &p_n_psxram[ n_address / 4 ], &p_n_psxram[ n_address / 4 ] + n_size );
+
+	// linked list DMA arrives a packet at a time, so words build up while the worker is busy and go together
+	if( m_gpu_item != nullptr && osd_work_item_wait( m_gpu_item, 0 ) )
+	{
+		osd_work_item_release( m_gpu_item );
+		m_gpu_item = nullptr;
+	}
+	if( m_gpu_item == nullptr )
+	{
+		std::swap( m_gpu_pending, m_gpu_working );
+		m_gpu_item = osd_work_item_queue( m_gpu_queue, gpu_work_callback, this, 0 );
+		if( m_gpu_item == nullptr )
+		{
+			std::swap( m_gpu_pending, m_gpu_working );
+			gpu_wait();
+		}
+	}
+}
+
+void *psxgpu_device::gpu_work_callback( void *param, int threadid )
+{
+	psxgpu_device *gpu = reinterpret_cast<psxgpu_device *>( param );
+	gpu->gpu_write( gpu->m_gpu_working.data(), gpu->m_gpu_working.size() );
+	gpu->m_gpu_working.clear();
+	return nullptr;
+}
+
+void psxgpu_device::gpu_wait()
+{
+	if( m_gpu_item != nullptr )
+	{
+		osd_work_item_wait( m_gpu_item, osd_ticks_per_second() * 100 );
+		osd_work_item_release( m_gpu_item );
+		m_gpu_item = nullptr;
+	}
+
+	if( !m_gpu_pending.empty() )
+	{
+		gpu_write( m_gpu_pending.data(), m_gpu_pending.size() );
+		m_gpu_pending.clear();
+	}
 }
 
 void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
@@ -3258,6 +3329,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 
 void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
+	gpu_wait();
+
 	switch( offset )
 	{
 	case 0x00:
@@ -3402,6 +3475,7 @@ void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 
 void psxgpu_device::dma_read( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
+	gpu_wait();
 	gpu_read( &p_n_psxram[ n_address / 4 ], n_size );
 }
 
@@ -3456,6 +3530,8 @@ uint32_t psxgpu_device::read(offs_t offset, uint32_t mem_mask)
 {
 	uint32_t data;
 
+	gpu_wait();
+
 	switch( offset )
 	{
 	case 0x00:
@@ -3482,6 +3558,8 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 {
 	if( vblank_state )
 	{
+		gpu_wait();
+
 #if PSXGPU_DEBUG_VIEWER
 		DebugCheckKeys();
 #endif
@@ -3524,6 +3602,7 @@ void psxgpu_device::gpu_reset()
 
 void psxgpu_device::lightgun_set( int n_x, int n_y )
 {
+	gpu_wait();
 	n_lightgun_x = n_x;
 	n_lightgun_y = n_y;
 }
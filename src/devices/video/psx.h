@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <vector>
+
 #define PSXGPU_DEBUG_VIEWER ( 0 )
+#define PSXGPU_THREADED ( 1 )
 
 DECLARE_DEVICE_TYPE(CXD8514Q,  cxd8514q_device)
 DECLARE_DEVICE_TYPE(CXD8538Q,  cxd8538q_device)
@@ -49,6 +52,8 @@ protected:
 	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override ATTR_COLD;
+	virtual void device_stop() override ATTR_COLD;
+	virtual void device_pre_save() override;
 	virtual void device_post_load() override;
 	virtual void device_reset() override ATTR_COLD;
 	virtual void device_config_complete() override;
@@ -218,6 +223,8 @@ private:
 	void gpu_reset();
 	void gpu_read( uint32_t *p_ram, int32_t n_size );
 	void gpu_write( uint32_t *p_ram, int32_t n_size );
+	void gpu_wait();
+	static void *gpu_work_callback( void *param, int threadid );
 
 	int32_t m_n_tx;
 	int32_t m_n_ty;
@@ -260,6 +267,12 @@ private:
 
 	PACKET m_packet;
 
+	// DMA'd command words are drawn by a worker; anything else that touches the GPU waits for it first
+	osd_work_queue *m_gpu_queue;
+	osd_work_item *m_gpu_item;
+	std::vector<uint32_t> m_gpu_pending;    // words not yet handed to the worker
+	std::vector<uint32_t> m_gpu_working;    // words the worker is drawing
+
 	uint16_t *p_p_vram[ 1024 ];
 
 	uint16_t p_n_redshade[ MAX_LEVEL * MAX_SHADE ];
@@ -75,6 +75,8 @@
 #include "emu.h"
 #include "snes_ppu.h"
 
+#include <array>
+
 #define SNES_MAINSCREEN    0
 #define SNES_SUBSCREEN     1
 #define SNES_CLIP_NEVER    0
@@ -173,6 +175,23 @@ enum
 #define PPU_REG(a) m_regs[a - 0x2100]
 
 
+namespace {
+
+// spreads the bits of one bitplane byte over the bytes of a word, the
+// leftmost pixel in the lowest byte, so the planes of a tile row combine
+// into one colour per byte with shifts
+constexpr auto s_planar_spread = [] ()
+{
+	std::array<uint64_t, 256> result{};
+	for (int data = 0; data < 256; data++)
+		for (int i = 0; i < 8; i++)
+			result[data] |= uint64_t(BIT(data, 7 - i)) << (i * 8);
+	return result;
+}();
+
+} // anonymous namespace
+
+
 
 //**************************************************************************
 //  DEVICE DEFINITIONS
@@ -707,38 +726,29 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 
 		uint16_t address = (((tile_number << color_shift) + ((voffset & 7) ^ mirrory)) & 0x7fff) << 1;
 
-		uint64_t data;
-		data  = (uint64_t)m_vram[address +   0] <<  0;
-		data |= (uint64_t)m_vram[address +   1] <<  8;
-		data |= (uint64_t)m_vram[address +  16] << 16;
-		data |= (uint64_t)m_vram[address +  17] << 24;
-		data |= (uint64_t)m_vram[address +  32] << 32;
-		data |= (uint64_t)m_vram[address +  33] << 40;
-		data |= (uint64_t)m_vram[address +  48] << 48;
-		data |= (uint64_t)m_vram[address +  49] << 56;
+		// decode the whole tile row up front, one colour per byte
+		uint64_t colors;
+		colors  = s_planar_spread[m_vram[address +   0]] << 0;
+		colors |= s_planar_spread[m_vram[address +   1]] << 1;
+		if (layer.tile_mode >= SNES_COLOR_DEPTH_4BPP)
+		{
+			colors |= s_planar_spread[m_vram[address +  16]] << 2;
+			colors |= s_planar_spread[m_vram[address +  17]] << 3;
+		}
+		if (layer.tile_mode >= SNES_COLOR_DEPTH_8BPP)
+		{
+			colors |= s_planar_spread[m_vram[address +  32]] << 4;
+			colors |= s_planar_spread[m_vram[address +  33]] << 5;
+			colors |= s_planar_spread[m_vram[address +  48]] << 6;
+			colors |= s_planar_spread[m_vram[address +  49]] << 7;
+		}
 
 		for (uint32_t tilex = 0; tilex < 8; tilex++, x++)
 		{
 			if (x & width) continue;
 			if (!layer.mosaic_enabled || --mosaic_counter == 0)
 			{
-				uint32_t color, shift = mirrorx ? tilex : 7 - tilex;
-				{
-					color  = data >> (shift +  0) & 0x01;
-					color |= data >> (shift +  7) & 0x02;
-				}
-				if (layer.tile_mode >= SNES_COLOR_DEPTH_4BPP)
-				{
-					color |= data >> (shift + 14) & 0x04;
-					color |= data >> (shift + 21) & 0x08;
-				}
-				if (layer.tile_mode >= SNES_COLOR_DEPTH_8BPP)
-				{
-					color |= data >> (shift + 28) & 0x10;
-					color |= data >> (shift + 35) & 0x20;
-					color |= data >> (shift + 42) & 0x40;
-					color |= data >> (shift + 49) & 0x80;
-				}
+				uint32_t color = uint8_t(colors >> ((mirrorx ? 7 - tilex : tilex) * 8));
 
 				mosaic_counter = 1 + m_mosaic_size;
 				mosaic_palette = color;
@@ -812,11 +822,17 @@ void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
 	render_window(layer_idx, self.main_window_enabled, window_above);
 	render_window(layer_idx, self.sub_window_enabled,  window_below);
 
-	for (int _x = 0; _x < 256; _x++)
+	// step the transform along the line rather than multiplying per pixel
+	int const x0 = !m_mode7.hflip ? 0 : 255;
+	int const dx = !m_mode7.hflip ? a : -a;
+	int const dy = !m_mode7.hflip ? c : -c;
+	int pos_x = origin_x + (a * x0);
+	int pos_y = origin_y + (c * x0);
+
+	for (int _x = 0; _x < 256; _x++, pos_x += dx, pos_y += dy)
 	{
-		int x = !m_mode7.hflip ? _x : 255 - _x;
-		int pixel_x = (origin_x + (a * x)) >> 8;
-		int pixel_y = (origin_y + (c * x)) >> 8;
+		int pixel_x = pos_x >> 8;
+		int pixel_y = pos_y >> 8;
 		int tile_x = (pixel_x >> 3) & 0x7f;
 		int tile_y = (pixel_y >> 3) & 0x7f;
 		bool out_of_bounds = (pixel_x | pixel_y) & ~0x03ff;
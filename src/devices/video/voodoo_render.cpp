@@ -1260,7 +1260,7 @@ voodoo_renderer::voodoo_renderer(running_machine &machine, u16 tmu_config, const
 
 	// create entries for the generic rasterizers as well
 	rasterizer_params dummy_params;
-	for (int index = 0; index < std::size(m_generic_rasterizer); index++)
+	for (u32 index = 0; index < std::size(m_generic_rasterizer); index++)
 		m_generic_rasterizer[index] = add_rasterizer(dummy_params, generic_rasterizer(index), true);
 }
 
@@ -1353,9 +1353,9 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 	{
 		// add a new one if we're logging usage
 		if (LOG_RASTERIZERS)
-			info = add_rasterizer(poly.raster, generic_rasterizer(poly.raster.generic()), true);
+			info = add_rasterizer(poly.raster, generic_rasterizer(generic_index(poly.raster)), true);
 		else
-			info = m_generic_rasterizer[poly.raster.generic()];
+			info = m_generic_rasterizer[generic_index(poly.raster)];
 	}
 
 	// set the info and render the triangle
@@ -2465,48 +2465,93 @@ void voodoo_renderer::rasterizer_fastfill(s32 y, const voodoo_renderer::extent_t
 
 
 //-------------------------------------------------
-//  generic_rasterizer - return a pointer to a
-//  generic rasterizer based on a texture enable
-//  mask
+//  generic_index - return the index of the
+//  generic rasterizer for a set of parameters:
+//  the low 4 bits are the texture enable mask,
+//  and the upper 2 bits flag disabled fog and
+//  alpha stages, which are compiled out
 //-------------------------------------------------
 
-voodoo_renderer::rasterizer_mfp voodoo_renderer::generic_rasterizer(u8 texmask)
+u32 voodoo_renderer::generic_index(rasterizer_params const &params)
 {
-	switch (texmask & 15)
+	u32 index = params.generic() & 15;
+	if (params.fogmode().raw() == 0)
+		index |= GENERIC_INDEX_NO_FOG;
+	if (params.alphamode().raw() == 0)
+		index |= GENERIC_INDEX_NO_ALPHA;
+	return index;
+}
+
+
+//-------------------------------------------------
+//  generic_rasterizer_tex - return a pointer to
+//  a generic rasterizer for a texture enable
+//  mask, with the fog and alpha stages either
+//  decoded live or disabled
+//-------------------------------------------------
+
+template<u32 GenericFlags>
+voodoo_renderer::rasterizer_mfp voodoo_renderer::generic_rasterizer_tex(u32 index)
+{
+	constexpr u32 TexMode0 = (GenericFlags & rasterizer_params::GENERIC_TEX0) ? reg_texture_mode::DECODE_LIVE : reg_texture_mode::NONE;
+	constexpr u32 TexMode1 = (GenericFlags & rasterizer_params::GENERIC_TEX1) ? reg_texture_mode::DECODE_LIVE : reg_texture_mode::NONE;
+	switch (index & (GENERIC_INDEX_NO_FOG | GENERIC_INDEX_NO_ALPHA))
+	{
+	default:
+	case 0:
+		return &voodoo_renderer::rasterizer<GenericFlags, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, TexMode0, TexMode1>;
+	case GENERIC_INDEX_NO_FOG:
+		return &voodoo_renderer::rasterizer<GenericFlags, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, 0, TexMode0, TexMode1>;
+	case GENERIC_INDEX_NO_ALPHA:
+		return &voodoo_renderer::rasterizer<GenericFlags, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, reg_fog_mode::DECODE_LIVE, TexMode0, TexMode1>;
+	case GENERIC_INDEX_NO_FOG | GENERIC_INDEX_NO_ALPHA:
+		return &voodoo_renderer::rasterizer<GenericFlags, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, 0, 0, TexMode0, TexMode1>;
+	}
+}
+
+
+//-------------------------------------------------
+//  generic_rasterizer - return a pointer to the
+//  generic rasterizer for a generic_index()
+//-------------------------------------------------
+
+voodoo_renderer::rasterizer_mfp voodoo_renderer::generic_rasterizer(u32 index)
+{
+	switch (index & 15)
 	{
 	default:
 	case 0:
-		return &voodoo_renderer::rasterizer<0, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<0>(index);
 	case 1:
-		return &voodoo_renderer::rasterizer<1, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<1>(index);
 	case 2:
-		return &voodoo_renderer::rasterizer<2, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<2>(index);
 	case 3:
-		return &voodoo_renderer::rasterizer<3, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<3>(index);
 	case 4:
-		return &voodoo_renderer::rasterizer<4, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<4>(index);
 	case 5:
-		return &voodoo_renderer::rasterizer<5, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<5>(index);
 	case 6:
-		return &voodoo_renderer::rasterizer<6, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<6>(index);
 	case 7:
-		return &voodoo_renderer::rasterizer<7, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<7>(index);
 	case 8:
-		return &voodoo_renderer::rasterizer<8, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<8>(index);
 	case 9:
-		return &voodoo_renderer::rasterizer<9, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<9>(index);
 	case 10:
-		return &voodoo_renderer::rasterizer<10, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<10>(index);
 	case 11:
-		return &voodoo_renderer::rasterizer<11, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<11>(index);
 	case 12:
-		return &voodoo_renderer::rasterizer<12, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<12>(index);
 	case 13:
-		return &voodoo_renderer::rasterizer<13, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::NONE>;
+		return generic_rasterizer_tex<13>(index);
 	case 14:
-		return &voodoo_renderer::rasterizer<14, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::NONE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<14>(index);
 	case 15:
-		return &voodoo_renderer::rasterizer<15, reg_fbz_colorpath::DECODE_LIVE, reg_fbz_mode::DECODE_LIVE, reg_alpha_mode::DECODE_LIVE, reg_fog_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE, reg_texture_mode::DECODE_LIVE>;
+		return generic_rasterizer_tex<15>(index);
 	}
 }
 
@@ -496,6 +496,10 @@ class voodoo_renderer : public voodoo_poly_manager
 {
 	static constexpr u32 RASTER_HASH_SIZE = 97; // size of the rasterizer hash table
 
+	// generic rasterizer index flags, above the 4 texture enable bits
+	static constexpr u32 GENERIC_INDEX_NO_FOG   = 0x10; // fog mode is 0
+	static constexpr u32 GENERIC_INDEX_NO_ALPHA = 0x20; // alpha mode is 0
+
 public:
 	using rasterizer_mfp = void (voodoo_renderer::*)(int32_t, const extent_t &, const poly_data &, int);
 
@@ -588,7 +592,9 @@ private:
 	void rasterizer_fastfill(s32 scanline, const voodoo::voodoo_renderer::extent_t &extent, const voodoo::poly_data &extradata, int threadid);
 
 	// helpers
-	static rasterizer_mfp generic_rasterizer(u8 texmask);
+	static u32 generic_index(voodoo::rasterizer_params const &params);
+	template<u32 GenericFlags> static rasterizer_mfp generic_rasterizer_tex(u32 index);
+	static rasterizer_mfp generic_rasterizer(u32 index);
 	voodoo::rasterizer_info *add_rasterizer(voodoo::rasterizer_params const &params, rasterizer_mfp rasterizer, bool is_generic);
 
 	// internal state
@@ -606,7 +612,7 @@ private:
 	poly_array<voodoo::rasterizer_texture, 2> m_textures;
 	poly_array<voodoo::rasterizer_palette, 8> m_palettes;
 	voodoo::rasterizer_info *m_raster_hash[RASTER_HASH_SIZE]; // hash table of rasterizers
-	voodoo::rasterizer_info *m_generic_rasterizer[16];
+	voodoo::rasterizer_info *m_generic_rasterizer[64]; // indexed by generic_index()
 	std::list<voodoo::rasterizer_info> m_rasterizer_list;
 	std::vector<thread_stats_block> m_thread_stats;
 };
@@ -12,6 +12,8 @@
 #include "eminline.h"
 #include "attotime.h"
 
+#include <limits>
+
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -38,6 +40,22 @@ attotime &attotime::operator*=(u32 factor)
 	if (factor == 0)
 		return *this = zero;
 
+	// if the scaled attoseconds fit in 64 bits, one multiply does it
+	if (m_seconds >= 0)
+	{
+		u64 hi;
+		u64 const attos = mulu_64x64(m_attoseconds, factor, hi);
+		if (!hi)
+		{
+			u64 const secs = mulu_32x32(m_seconds, factor) + (attos / ATTOSECONDS_PER_SECOND);
+			if (secs >= ATTOTIME_MAX_SECONDS)
+				return *this = never;
+			m_seconds = secs;
+			m_attoseconds = attos % ATTOSECONDS_PER_SECOND;
+			return *this;
+		}
+	}
+
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
@@ -78,6 +96,18 @@ attotime &attotime::operator/=(u32 factor)
 	if (factor == 0)
 		return *this;
 
+	// up to 18 seconds fit in 64 bits of attoseconds, which only needs one division
+	if ((m_seconds >= 0) && (u64(m_seconds) < (std::numeric_limits<u64>::max() / ATTOSECONDS_PER_SECOND)))
+	{
+		u64 const total = mulu_32x32(m_seconds, ATTOSECONDS_PER_SECOND_SQRT) * ATTOSECONDS_PER_SECOND_SQRT + m_attoseconds;
+		u64 quotient = total / factor;
+		if ((total % factor) >= (factor / 2))
+			quotient++;
+		m_seconds = quotient / ATTOSECONDS_PER_SECOND;
+		m_attoseconds = quotient % ATTOSECONDS_PER_SECOND;
+		return *this;
+	}
+
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
@@ -342,8 +342,12 @@ inline constexpr attoseconds_t attotime::as_attoseconds() const noexcept
 /** as_ticks - convert to ticks at @p frequency */
 inline u64 attotime::as_ticks(u32 frequency) const
 {
-	u32 fracticks = (attotime(0, m_attoseconds) * frequency).m_seconds;
-	return mulu_32x32(m_seconds, frequency) + fracticks;
+	// whole seconds of attoseconds * frequency, as operator*= would work them out;
+	// the divisions are by constants, so they don't need a divide instruction
+	u64 const attohi = u64(m_attoseconds) / ATTOSECONDS_PER_SECOND_SQRT;
+	u64 const attolo = u64(m_attoseconds) % ATTOSECONDS_PER_SECOND_SQRT;
+	u64 const fracticks = ((mulu_32x32(u32(attolo), frequency) / ATTOSECONDS_PER_SECOND_SQRT) + mulu_32x32(u32(attohi), frequency)) / ATTOSECONDS_PER_SECOND_SQRT;
+	return mulu_32x32(m_seconds, frequency) + u32(std::min<u64>(fracticks, ATTOTIME_MAX_SECONDS));
 }
 
 
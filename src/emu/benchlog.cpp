@@ -0,0 +1,437 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    benchlog.cpp
+
+    Per-frame timing log for benchmark runs.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "benchlog.h"
+
+#include "http.h"
+#include "main.h"
+
+#include "path.h"
+#include "strformat.h"
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <locale>
+#include <sstream>
+
+
+namespace {
+
+// column names for the timed parts of a frame
+char const *const s_part_names[bench_log_manager::PART_COUNT] =
+{
+	"sound_ms",
+	"screen_ms",
+	"osd_ms",
+	"throttle_ms"
+};
+
+// label values for the timed parts of a frame in the metrics
+char const *const s_metric_parts[bench_log_manager::PART_COUNT] =
+{
+	"sound",
+	"screen",
+	"osd",
+	"throttle"
+};
+
+// metrics are published this many times a second
+constexpr int PUBLISH_PER_SECOND = 4;
+
+
+// escape a Prometheus label value
+std::string label_value(std::string_view value)
+{
+	std::string result;
+	result.reserve(value.length());
+	for (char const ch : value)
+	{
+		if (ch == '\\' || ch == '"')
+			result.push_back('\\');
+		if (ch == '\n')
+			result.append("\\n");
+		else
+			result.push_back(ch);
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  BENCH LOG MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  bench_log_manager - constructor
+//-------------------------------------------------
+
+bench_log_manager::bench_log_manager(running_machine &machine, const char *filename)
+	: m_machine(machine)
+	, m_filename(filename)
+	, m_tps(osd_ticks_per_second())
+	, m_last_ticks(0)
+	, m_last_emutime(attotime::zero)
+	, m_frames(0)
+	, m_total_wall(0)
+	, m_last_wall(0)
+	, m_next_publish(0)
+	, m_publishing(machine.manager().http()->is_active())
+{
+	std::fill(std::begin(m_part_ticks), std::end(m_part_ticks), 0);
+	std::fill(std::begin(m_total_parts), std::end(m_total_parts), 0);
+
+	// the profiler categories only exist in builds with the profiler; this
+	// does nothing otherwise, and isn't wanted just for the metrics
+	if (!m_filename.empty())
+		g_profiler.enable(true);
+}
+
+
+//-------------------------------------------------
+//  add_counter - register a counter to sample
+//  at the end of every frame
+//-------------------------------------------------
+
+void bench_log_manager::add_counter(std::string &&name, std::function<u64 ()> &&sample)
+{
+	// counters can't be added once rows have been logged
+	if (!m_rows.empty())
+		return;
+
+	u64 const initial = sample();
+	m_counters.emplace_back(counter{ std::move(name), std::move(sample), initial });
+}
+
+
+//-------------------------------------------------
+//  frame - log the frame that just ended
+//-------------------------------------------------
+
+void bench_log_manager::frame(const attotime &emutime)
+{
+	osd_ticks_t const now = osd_ticks();
+
+	// the first frame only sets the starting point
+	bool const logging = !m_filename.empty();
+	if (m_last_ticks != 0)
+	{
+		if (logging)
+		{
+			frame_row &row = m_rows.emplace_back();
+			row.emutime = emutime;
+			row.emu_delta = (emutime - m_last_emutime).as_attoseconds();
+			row.wall = now - m_last_ticks;
+			std::copy(std::begin(m_part_ticks), std::end(m_part_ticks), std::begin(row.parts));
+		}
+
+		m_frames++;
+		m_last_wall = now - m_last_ticks;
+		m_total_wall += m_last_wall;
+		for (int part = 0; part < PART_COUNT; part++)
+			m_total_parts[part] += m_part_ticks[part];
+	}
+
+	for (counter &cnt : m_counters)
+	{
+		u64 const value = cnt.sample();
+		if (logging && (m_last_ticks != 0))
+			m_counter_rows.push_back(value - cnt.last);
+		cnt.last = value;
+	}
+
+	std::fill(std::begin(m_part_ticks), std::end(m_part_ticks), 0);
+	m_last_ticks = now;
+	m_last_emutime = emutime;
+
+	if (m_publishing && (now >= m_next_publish))
+		publish(now);
+}
+
+
+//-------------------------------------------------
+//  publish - make a snapshot of the metrics for
+//  the HTTP server
+//-------------------------------------------------
+
+void bench_log_manager::publish(osd_ticks_t now)
+{
+	std::ostringstream out;
+	out.imbue(std::locale::classic());
+
+	out << "# TYPE mame_frames_total counter\n";
+	util::stream_format(out, "mame_frames_total %u\n", m_frames);
+	out << "# TYPE mame_emulated_seconds_total counter\n";
+	util::stream_format(out, "mame_emulated_seconds_total %.9f\n", m_last_emutime.as_double());
+	out << "# TYPE mame_speed_ratio gauge\n";
+	util::stream_format(out, "mame_speed_ratio %.6f\n", machine().video().speed_percent());
+	out << "# TYPE mame_frame_seconds gauge\n";
+	util::stream_format(out, "mame_frame_seconds %.6f\n", seconds(m_last_wall));
+
+	// wall time by part of the frame, with emulation being the rest
+	osd_ticks_t timed = 0;
+	for (osd_ticks_t const part : m_total_parts)
+		timed += part;
+	out << "# TYPE mame_wall_seconds_total counter\n";
+	util::stream_format(out, "mame_wall_seconds_total{part=\"emulation\"} %.6f\n", seconds(m_total_wall - std::min(timed, m_total_wall)));
+	for (int part = 0; part < PART_COUNT; part++)
+		util::stream_format(out, "mame_wall_seconds_total{part=\"%s\"} %.6f\n", s_metric_parts[part], seconds(m_total_parts[part]));
+
+	out << "# TYPE mame_device_cycles_total counter\n";
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		util::stream_format(out, "mame_device_cycles_total{device=\"%s\"} %u\n", label_value(exec.device().tag()), exec.total_cycles());
+
+	// registered counters (DRC cache, CHD cache and so on) as they stood at the end of the frame
+	out << "# TYPE mame_counter_total counter\n";
+	for (counter const &cnt : m_counters)
+		util::stream_format(out, "mame_counter_total{counter=\"%s\"} %u\n", label_value(cnt.name), cnt.last);
+
+	// don't hold up the emulation if the server is copying the last snapshot; try again next frame
+	std::string text = out.str();
+	std::unique_lock<std::mutex> lock(m_published_lock, std::try_to_lock);
+	if (lock.owns_lock())
+	{
+		m_published.swap(text);
+		m_next_publish = now + (m_tps / PUBLISH_PER_SECOND);
+	}
+}
+
+
+//-------------------------------------------------
+//  metrics - get the last published snapshot
+//-------------------------------------------------
+
+std::string bench_log_manager::metrics() const
+{
+	std::lock_guard<std::mutex> lock(m_published_lock);
+	return m_published;
+}
+
+
+//-------------------------------------------------
+//  write - write the log to the file named by
+//  the option
+//-------------------------------------------------
+
+void bench_log_manager::write()
+{
+	// only keeping totals for the metrics
+	if (m_filename.empty())
+		return;
+
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(m_filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file);
+	if (filerr)
+	{
+		osd_printf_error("Error opening benchmark log file %s (%s)\n", m_filename, filerr.message());
+		return;
+	}
+
+	if (core_filename_ends_with(m_filename, ".json"))
+		write_json(*file);
+	else
+		write_csv(*file);
+
+	osd_printf_info("Wrote %u frames of benchmark timings to %s\n", unsigned(m_rows.size()), m_filename);
+}
+
+
+//-------------------------------------------------
+//  write_csv - write one line per frame
+//-------------------------------------------------
+
+void bench_log_manager::write_csv(util::core_file &file) const
+{
+	file.puts("frame,emulated_time,emulated_ms,wall_ms,emulation_ms");
+	for (char const *name : s_part_names)
+		file.printf(",%s", name);
+	for (counter const &cnt : m_counters)
+		file.printf(",%s", cnt.name);
+	file.puts("\n");
+
+	u64 const *counts = m_counter_rows.data();
+	for (size_t index = 0; index < m_rows.size(); index++)
+	{
+		frame_row const &row = m_rows[index];
+		osd_ticks_t timed = 0;
+		for (osd_ticks_t const part : row.parts)
+			timed += part;
+
+		file.printf("%u,%.9f,%.6f,%.6f,%.6f", unsigned(index), row.emutime.as_double(), ATTOSECONDS_TO_DOUBLE(row.emu_delta) * 1000.0, ms(row.wall), ms(row.wall - std::min(timed, row.wall)));
+		for (osd_ticks_t const part : row.parts)
+			file.printf(",%.6f", ms(part));
+		for (size_t cntnum = 0; cntnum < m_counters.size(); cntnum++)
+			file.printf(",%u", *counts++);
+		file.puts("\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  write_json - write a summary followed by one
+//  object per frame
+//-------------------------------------------------
+
+void bench_log_manager::write_json(util::core_file &file) const
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+	writer.StartObject();
+	writer.Key("system");
+	writer.String(machine().system().name);
+	writer.Key("frames");
+	writer.Uint64(m_rows.size());
+
+	// totals for the whole run
+	osd_ticks_t wall = 0;
+	osd_ticks_t parts[PART_COUNT] = { 0 };
+	attoseconds_t emulated = 0;
+	std::vector<osd_ticks_t> frame_ticks;
+	frame_ticks.reserve(m_rows.size());
+	for (frame_row const &row : m_rows)
+	{
+		wall += row.wall;
+		emulated += row.emu_delta;
+		for (int part = 0; part < PART_COUNT; part++)
+			parts[part] += row.parts[part];
+		frame_ticks.push_back(row.wall);
+	}
+	osd_ticks_t timed = 0;
+	for (osd_ticks_t const part : parts)
+		timed += part;
+
+	double const wall_seconds = double(wall) / double(m_tps);
+	double const emulated_seconds = ATTOSECONDS_TO_DOUBLE(emulated);
+	writer.Key("emulated_seconds");
+	writer.Double(emulated_seconds);
+	writer.Key("wall_seconds");
+	writer.Double(wall_seconds);
+	writer.Key("speed");
+	writer.Double(wall ? (emulated_seconds / wall_seconds) : 0.0);
+
+	// frame time distribution, nearest-rank percentiles
+	std::sort(frame_ticks.begin(), frame_ticks.end());
+	auto const percentile = [&frame_ticks] (double fraction) -> osd_ticks_t
+	{
+		if (frame_ticks.empty())
+			return 0;
+		size_t const rank = size_t(std::ceil(fraction * double(frame_ticks.size())));
+		return frame_ticks[std::clamp<size_t>(rank, 1, frame_ticks.size()) - 1];
+	};
+	writer.Key("frame_ms");
+	writer.StartObject();
+	writer.Key("mean");
+	writer.Double(m_rows.empty() ? 0.0 : (ms(wall) / double(m_rows.size())));
+	writer.Key("min");
+	writer.Double(ms(percentile(0.0)));
+	writer.Key("p50");
+	writer.Double(ms(percentile(0.50)));
+	writer.Key("p90");
+	writer.Double(ms(percentile(0.90)));
+	writer.Key("p99");
+	writer.Double(ms(percentile(0.99)));
+	writer.Key("max");
+	writer.Double(ms(percentile(1.0)));
+	writer.EndObject();
+
+	// wall time by part of the frame
+	writer.Key("total_ms");
+	writer.StartObject();
+	writer.Key("emulation_ms");
+	writer.Double(ms(wall - std::min(timed, wall)));
+	for (int part = 0; part < PART_COUNT; part++)
+	{
+		writer.Key(s_part_names[part]);
+		writer.Double(ms(parts[part]));
+	}
+	writer.EndObject();
+
+	// counter totals
+	writer.Key("counters");
+	writer.StartObject();
+	for (size_t cntnum = 0; cntnum < m_counters.size(); cntnum++)
+	{
+		u64 total = 0;
+		for (size_t index = cntnum; index < m_counter_rows.size(); index += m_counters.size())
+			total += m_counter_rows[index];
+		writer.Key(m_counters[cntnum].name.c_str());
+		writer.Uint64(total);
+	}
+	writer.EndObject();
+
+	// share of each profiler category, with the profiler and idle time left out
+	if (g_profiler.enabled())
+	{
+		osd_ticks_t normalize = 0;
+		for (profile_type type = PROFILER_DEVICE_FIRST; type < PROFILER_PROFILER; ++type)
+			normalize += g_profiler.ticks(type);
+
+		device_enumerator iter(machine().root_device());
+		writer.Key("profiler");
+		writer.StartObject();
+		for (profile_type type = PROFILER_DEVICE_FIRST; normalize && (type < PROFILER_PROFILER); ++type)
+		{
+			osd_ticks_t const ticks = g_profiler.ticks(type);
+			if (!ticks)
+				continue;
+
+			if (type <= PROFILER_DEVICE_MAX)
+				writer.Key(iter.byindex(type - PROFILER_DEVICE_FIRST)->tag());
+			else if (char const *const name = profiler_type_name(type))
+				writer.Key(name);
+			else
+				continue;
+			writer.Double(double(ticks) / double(normalize));
+		}
+		writer.EndObject();
+	}
+
+	// and finally the frames
+	writer.Key("per_frame");
+	writer.StartArray();
+	u64 const *counts = m_counter_rows.data();
+	for (frame_row const &row : m_rows)
+	{
+		osd_ticks_t rowtimed = 0;
+		for (osd_ticks_t const part : row.parts)
+			rowtimed += part;
+
+		writer.StartObject();
+		writer.Key("emulated_time");
+		writer.Double(row.emutime.as_double());
+		writer.Key("emulated_ms");
+		writer.Double(ATTOSECONDS_TO_DOUBLE(row.emu_delta) * 1000.0);
+		writer.Key("wall_ms");
+		writer.Double(ms(row.wall));
+		writer.Key("emulation_ms");
+		writer.Double(ms(row.wall - std::min(rowtimed, row.wall)));
+		for (int part = 0; part < PART_COUNT; part++)
+		{
+			writer.Key(s_part_names[part]);
+			writer.Double(ms(row.parts[part]));
+		}
+		for (counter const &cnt : m_counters)
+		{
+			writer.Key(cnt.name.c_str());
+			writer.Uint64(*counts++);
+		}
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	file.puts(buffer.GetString());
+}
@@ -0,0 +1,137 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    benchlog.h
+
+    Per-frame timing log for benchmark runs.
+
+****************************************************************************
+
+    Every frame the video manager presents adds a row holding the
+    emulated and wall-clock time it took, the wall-clock time spent in
+    the sound mix, finishing the screens, the OSD update and throttling,
+    and the change in every counter registered by the core or devices
+    (DRC cache statistics, for instance).  The rest of the frame is
+    reported as emulation.
+
+    On exit the rows go to a CSV file, or to a JSON file along with a
+    summary (frame time percentiles, totals per part of the frame and,
+    in builds with the profiler, the share of each profiler category)
+    when the file name ends in .json.  Combine with -bench and -playback
+    for repeatable runs.
+
+    With the HTTP server enabled, the same timings and counters are also
+    kept as running totals and published a few times a second in
+    Prometheus text format, for /metrics.  Publishing never waits: if
+    the server thread is reading the last snapshot, the emulation just
+    skips an update.  Without a file name, no rows are kept.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_BENCHLOG_H
+#define MAME_EMU_BENCHLOG_H
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+// ======================> bench_log_manager
+
+class bench_log_manager
+{
+public:
+	// parts of a frame timed separately from emulation
+	enum part
+	{
+		PART_SOUND,                                 // sound_manager::update
+		PART_SCREEN,                                // finishing the screen updates
+		PART_OSD,                                   // OSD update (rendering and blitting)
+		PART_THROTTLE,                              // waiting for real time
+		PART_COUNT
+	};
+
+	// times a part of the frame for as long as it's in scope
+	class scope
+	{
+	public:
+		scope(scope const &) = delete;
+		scope &operator=(scope const &) = delete;
+		scope(bench_log_manager *host, part which) : m_host(host), m_part(which), m_start(host ? osd_ticks() : 0) { }
+		~scope() { if (m_host) m_host->m_part_ticks[m_part] += osd_ticks() - m_start; }
+
+	private:
+		bench_log_manager *m_host;
+		part m_part;
+		osd_ticks_t m_start;
+	};
+
+	// construction/destruction
+	bench_log_manager(running_machine &machine, const char *filename);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// register a counter sampled at the end of every frame; only its
+	// change over each frame is logged
+	void add_counter(std::string &&name, std::function<u64 ()> &&sample);
+
+	// called by the video manager once per presented frame
+	void frame(const attotime &emutime);
+
+	// write the log
+	void write();
+
+	// most recently published metrics; safe to call from any thread
+	std::string metrics() const;
+
+private:
+	struct counter
+	{
+		std::string             name;               // column name
+		std::function<u64 ()>   sample;             // returns the current value
+		u64                     last;               // value at the end of the previous frame
+	};
+
+	struct frame_row
+	{
+		attotime                emutime;            // emulated time at the end of the frame
+		attoseconds_t           emu_delta;          // emulated time taken by the frame
+		osd_ticks_t             wall;               // wall-clock ticks for the whole frame
+		osd_ticks_t             parts[PART_COUNT];  // wall-clock ticks in each timed part
+	};
+
+	// internal helpers
+	void write_csv(util::core_file &file) const;
+	void write_json(util::core_file &file) const;
+	double ms(osd_ticks_t ticks) const { return double(ticks) * 1000.0 / double(m_tps); }
+	double seconds(osd_ticks_t ticks) const { return double(ticks) / double(m_tps); }
+	void publish(osd_ticks_t now);
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::string                 m_filename;         // where the log goes
+	osd_ticks_t const           m_tps;              // osd_ticks per second
+	osd_ticks_t                 m_part_ticks[PART_COUNT]; // ticks in each part this frame
+	osd_ticks_t                 m_last_ticks;       // wall clock at the end of the previous frame
+	attotime                    m_last_emutime;     // emulated time at the end of the previous frame
+	std::vector<counter>        m_counters;         // registered counters
+	std::vector<frame_row>      m_rows;             // one per frame
+	std::vector<u64>            m_counter_rows;     // counter changes, m_counters.size() per frame
+
+	// running totals for the metrics
+	u64                         m_frames;           // frames since the start
+	osd_ticks_t                 m_total_wall;       // wall-clock ticks over all frames
+	osd_ticks_t                 m_total_parts[PART_COUNT]; // wall-clock ticks in each timed part
+	osd_ticks_t                 m_last_wall;        // wall-clock ticks for the last frame
+	osd_ticks_t                 m_next_publish;     // when to next publish metrics
+	bool const                  m_publishing;       // whether there's an HTTP server to publish for
+	mutable std::mutex          m_published_lock;   // guards m_published
+	std::string                 m_published;        // last published metrics
+};
+
+#endif // MAME_EMU_BENCHLOG_H
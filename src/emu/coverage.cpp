@@ -0,0 +1,116 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    coverage.cpp
+
+    Execution coverage collected through the instruction hook.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "coverage.h"
+
+#include "emuopts.h"
+
+
+
+//**************************************************************************
+//  COVERAGE MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  coverage_manager - constructor
+//-------------------------------------------------
+
+coverage_manager::coverage_manager(running_machine &machine, const char *filename)
+	: m_machine(machine)
+	, m_filename(filename)
+{
+	for (device_execute_interface &exec : execute_interface_enumerator(machine.root_device()))
+		exec.enable_coverage();
+
+	// the instruction hook is only called once the flag is set
+	machine.debug_flags |= DEBUG_FLAG_COVERAGE;
+	if (machine.options().drc())
+		osd_printf_warning("Execution coverage is not recorded for recompiled code; use -nodrc for complete coverage\n");
+
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&coverage_manager::exit, this));
+}
+
+
+//-------------------------------------------------
+//  save - write the coverage of every executing
+//  device to a file
+//-------------------------------------------------
+
+bool coverage_manager::save(const char *filename) const
+{
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file);
+	if (filerr)
+	{
+		osd_printf_error("Error opening coverage file %s (%s)\n", filename, filerr.message());
+		return false;
+	}
+
+	using coverage_map = device_execute_interface::coverage_map;
+	std::vector<device_execute_interface *> devices;
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		if (exec.coverage())
+			devices.push_back(&exec);
+
+	u32 const version = 1;
+	u32 const count = devices.size();
+	util::write(*file, "MAMECOV", 8);
+	util::write(*file, &version, sizeof(version));
+	util::write(*file, &count, sizeof(count));
+	for (device_execute_interface *exec : devices)
+	{
+		coverage_map const &map = *exec->coverage();
+		std::string_view const tag = exec->device().tag();
+		u16 const length = tag.length();
+		u8 const desc[4] = { u8(coverage_map::PAGE_SHIFT), 0, 0, 0 };
+		u32 pages = 0;
+		for (offs_t index = 0; index < map.page_count(); index++)
+			if (map.page(index))
+				pages++;
+		util::write(*file, &length, sizeof(length));
+		util::write(*file, tag.data(), length);
+		util::write(*file, desc, sizeof(desc));
+		util::write(*file, &pages, sizeof(pages));
+		for (offs_t index = 0; index < map.page_count(); index++)
+		{
+			if (u64 const *const page = map.page(index))
+			{
+				u32 const pageindex = index;
+				util::write(*file, &pageindex, sizeof(pageindex));
+				util::write(*file, page, coverage_map::PAGE_WORDS * sizeof(u64));
+			}
+		}
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  clear - forget what has executed so far
+//-------------------------------------------------
+
+void coverage_manager::clear()
+{
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		if (exec.coverage())
+			exec.coverage()->clear();
+}
+
+
+//-------------------------------------------------
+//  exit - write the file named by the option
+//-------------------------------------------------
+
+void coverage_manager::exit()
+{
+	if (save(m_filename.c_str()))
+		osd_printf_info("Wrote execution coverage to %s\n", m_filename);
+}
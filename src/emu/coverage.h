@@ -0,0 +1,67 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    coverage.h
+
+    Execution coverage collected through the instruction hook.
+
+****************************************************************************
+
+    The coverage file starts with a header:
+
+        char[8]     "MAMECOV\0"
+        u32         format version (1)
+        u32         number of devices
+
+    followed by one block per executing device:
+
+        u16         length of the tag
+        char[]      device tag, not terminated
+        u8          page size as a power of 2 (16)
+        u8[3]       reserved (0)
+        u32         number of pages that follow
+
+    each of those pages being:
+
+        u32         page index (the PC shifted right by the page size)
+        u64[1024]   bitmap, bit n of word w set if PC (page << 16) |
+                    (w << 6) | n was executed
+
+    All values are in host byte order.  PCs are the values the core passes
+    to the instruction hook, so recompiling cores only report coverage when
+    run with -nodrc.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_COVERAGE_H
+#define MAME_EMU_COVERAGE_H
+
+#pragma once
+
+
+// ======================> coverage_manager
+
+class coverage_manager
+{
+public:
+	// construction/destruction
+	coverage_manager(running_machine &machine, const char *filename);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// operations
+	bool save(const char *filename) const;
+	void clear();
+
+private:
+	// internal helpers
+	void exit();
+
+	// internal state
+	running_machine &       m_machine;          // reference to our machine
+	std::string             m_filename;         // file written on exit
+};
+
+#endif // MAME_EMU_COVERAGE_H
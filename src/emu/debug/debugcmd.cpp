@@ -3480,6 +3480,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	std::string_view action;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
+	bool registers = false;
 	std::string filename(params[0]);
 
 	// replace macros
@@ -3502,6 +3504,10 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 				detect_loops = false;
 			else if (util::streqlower(flag, "logerror"sv))
 				logerror = true;
+			else if (util::streqlower(flag, "binary"sv))
+				binary = true;
+			else if (util::streqlower(flag, "registers"sv))
+				binary = registers = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag);
@@ -3518,6 +3524,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	if (!util::streqlower(filename, "off"sv))
 	{
 		std::ios_base::openmode mode = std::ios_base::out;
+		if (binary)
+			mode |= std::ios_base::binary;
 
 		// opening for append?
 		if ((filename[0] == '>') && (filename[1] == '>'))
@@ -3538,7 +3546,7 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 
 	// do it
 	bool const on(f);
-	cpu->debug()->trace(std::move(f), trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(std::move(f), trace_over, detect_loops, logerror, binary, registers, action);
 	if (on)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename);
 	else
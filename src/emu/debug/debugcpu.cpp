@@ -25,6 +25,8 @@
 #include "uiinput.h"
 
 #include "corestr.h"
+#include "ioprocs.h"
+#include "ioprocsfilter.h"
 #include "osdepend.h"
 #include "xmlfile.h"
 
@@ -516,6 +518,7 @@ device_debug::device_debug(device_t &device)
 	, m_track_mem(false)
 {
 	memset(m_pc_history, 0, sizeof(m_pc_history));
+	memset(m_bpfilter, 0, sizeof(m_bpfilter));
 
 	// find out which interfaces we have to work with
 	device.interface(m_exec);
@@ -1812,14 +1815,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action)
+void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, bool registers, std::string_view action)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, std::move(file), trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, std::move(file), trace_over, detect_loops, logerror, binary, registers, action);
 }
 
 
@@ -1833,8 +1836,8 @@ void device_debug::compute_debug_flags()
 	running_machine &machine = m_device.machine();
 	debugger_cpu &debugcpu = machine.debugger().cpu();
 
-	// clear out global flags by default, keep DEBUG_FLAG_OSD_ENABLED
-	machine.debug_flags &= DEBUG_FLAG_OSD_ENABLED;
+	// clear out global flags by default, keep DEBUG_FLAG_OSD_ENABLED and DEBUG_FLAG_COVERAGE
+	machine.debug_flags &= DEBUG_FLAG_OSD_ENABLED | DEBUG_FLAG_COVERAGE;
 	machine.debug_flags |= DEBUG_FLAG_ENABLED;
 
 	// if we are ignoring this CPU, or if events are pending, we're done
@@ -1949,6 +1952,14 @@ void device_debug::breakpoint_update_flags()
 			break;
 		}
 
+	// rebuild the filter - disabled breakpoints are included, as they can be enabled without coming through here
+	memset(m_bpfilter, 0, sizeof(m_bpfilter));
+	for (auto &bpp : m_bplist)
+	{
+		u32 const bit = breakpoint_filter_bit(bpp.first);
+		m_bpfilter[bit / 64] |= u64(1) << (bit % 64);
+	}
+
 	// see if there are any enabled registerpoints
 	for (debug_registerpoint &rp : m_rplist)
 	{
@@ -1972,6 +1983,11 @@ void device_debug::breakpoint_update_flags()
 
 void device_debug::breakpoint_check(offs_t pc)
 {
+	// most instructions aren't at a breakpoint, so avoid searching the list for them
+	u32 const bit = breakpoint_filter_bit(pc);
+	if (!BIT(m_bpfilter[bit / 64], bit % 64))
+		return;
+
 	// see if we match
 	auto bpitp = m_bplist.equal_range(pc);
 	for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
@@ -2039,11 +2055,73 @@ void device_debug::registerpoint_check()
 //  TRACER
 //**************************************************************************
 
+/*
+    With the 'binary' flag, the trace is a zstd-compressed stream (a new
+    frame starts after each flush) of data in host byte order.  It starts
+    with a header:
+
+        char[8]     "MAMEITR\0"
+        u32         format version (1)
+        u8          address width in bits
+        s8          address shift
+        u8          endianness (0 = little, 1 = big)
+        u8          number of registers logged
+        u16         length of the CPU shortname
+        char[]      CPU shortname, not terminated
+
+    followed by the names of the logged registers:
+
+        u16         length of the name
+        char[]      register name, not terminated
+
+    and then by records, each an 8-byte header followed by its data:
+
+        u8          record type (RECORD_*)
+        u8          length of the data following the header
+        u16         IRQ line for RECORD_IRQ, register number for RECORD_REG
+        u32         PC for RECORD_INSN and RECORD_IRQ, instruction count
+                    for RECORD_LOOP, zero otherwise
+
+    RECORD_INSN carries the opcode bytes as returned by data_get, RECORD_TEXT
+    up to 255 characters of trace log output, and RECORD_REG the u64 value
+    of a register that changed since the last instruction record.
+
+    src/tools/unidasm.cpp disassembles these files with -trace.
+*/
+
+namespace {
+
+// write stream adapter for the trace file, used by the writer thread
+class trace_ostream_write : public util::write_stream
+{
+public:
+	trace_ostream_write(std::ostream &file) noexcept : m_file(file) { }
+
+	virtual std::error_condition finalize() noexcept override { return std::error_condition(); }
+	virtual std::error_condition flush() noexcept override
+	{
+		m_file.flush();
+		return m_file.fail() ? std::errc::io_error : std::error_condition();
+	}
+	virtual std::error_condition write_some(void const *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		m_file.write(reinterpret_cast<char const *>(buffer), length);
+		actual = m_file.fail() ? 0 : length;
+		return m_file.fail() ? std::errc::io_error : std::error_condition();
+	}
+
+private:
+	std::ostream &m_file;
+};
+
+} // anonymous namespace
+
+
 //-------------------------------------------------
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action)
+device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, bool registers, std::string_view action)
 	: m_debug(debug)
 	, m_file(std::move(file))
 	, m_action(action)
@@ -2053,8 +2131,28 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_binary(binary)
+	, m_flush(false)
+	, m_busy(false)
+	, m_exit(false)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	if (m_binary)
+	{
+		// collect the registers to log on change
+		if (registers && m_debug.m_state)
+		{
+			for (auto const &entry : m_debug.m_state->state_entries())
+				if (entry->visible() && !entry->divider() && (m_registers.size() < 255))
+					m_registers.emplace_back(entry.get());
+			m_register_values.resize(m_registers.size(), 0);
+		}
+
+		m_chunk.reserve(TRACE_CHUNK + 512);
+		write_header();
+		m_writer = std::thread([this] () { writer_thread(); });
+	}
 }
 
 
@@ -2064,6 +2162,18 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 
 device_debug::tracer::~tracer()
 {
+	// hand off whatever is left and wait for the writer to finish
+	if (m_binary)
+	{
+		handoff(false);
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_exit = true;
+		}
+		m_cond.notify_all();
+		m_writer.join();
+	}
+
 	// make sure we close the file if we can
 	m_file.reset();
 }
@@ -2101,7 +2211,12 @@ void device_debug::tracer::update(offs_t pc)
 
 		// if we just finished looping, indicate as much
 		if (m_loops != 0)
-			util::stream_format(*m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		{
+			if (m_binary)
+				write_record(RECORD_LOOP, 0, m_loops, nullptr, 0);
+			else
+				util::stream_format(*m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		}
 		m_loops = 0;
 	}
 
@@ -2110,13 +2225,27 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_binary)
+	{
+		// registers first, so they show what the previous instructions did
+		if (!m_registers.empty())
+			write_registers();
+
+		// only the opcode bytes are logged, disassembly is left for later
+		dasmresult = buffer.disassemble_info(pc);
+		buffer.data_get(pc, dasmresult & util::disasm_interface::LENGTHMASK, true, m_opbuf);
+		write_record(RECORD_INSN, 0, pc, m_opbuf.data(), std::min<size_t>(m_opbuf.size(), 255));
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+		// output the result
+		util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -2134,7 +2263,8 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	m_file->flush();
+	if (!m_binary)
+		m_file->flush();
 }
 
 
@@ -2151,6 +2281,17 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 		m_trace_over_target = pc;
 	}
 
+	if (m_binary)
+	{
+		if (m_detect_loops && m_loops != 0)
+		{
+			write_record(RECORD_LOOP, 0, m_loops, nullptr, 0);
+			m_loops = 0;
+		}
+		write_record(RECORD_IRQ, u16(irqline), pc, nullptr, 0);
+		return;
+	}
+
 	// if we just finished looping, indicate as much
 	*m_file << "\n";
 	if (m_detect_loops && m_loops != 0)
@@ -2170,6 +2311,15 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 
 void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 {
+	if (m_binary)
+	{
+		// split into as many records as it takes
+		std::string const text = util::string_format(args);
+		for (size_t offset = 0; offset < text.length(); offset += 255)
+			write_record(RECORD_TEXT, 0, 0, &text[offset], std::min<size_t>(text.length() - offset, 255));
+		return;
+	}
+
 	// pass through to the file
 	util::stream_format(*m_file, args);
 	m_file->flush();
@@ -2183,7 +2333,164 @@ void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 
 void device_debug::tracer::flush()
 {
-	m_file->flush();
+	if (m_binary)
+		handoff(true);
+	else
+		m_file->flush();
+}
+
+
+//-------------------------------------------------
+//  write_header - start a binary trace with a
+//  description of the CPU
+//-------------------------------------------------
+
+void device_debug::tracer::write_header()
+{
+	auto const put = [this] (void const *data, size_t length) { m_chunk.insert(m_chunk.end(), (u8 const *)data, (u8 const *)data + length); };
+
+	u8 addr_width = 32, endian = 0;
+	s8 addr_shift = 0;
+	if (m_debug.m_memory && m_debug.m_memory->has_space(AS_PROGRAM))
+	{
+		address_space &space = m_debug.m_memory->space(AS_PROGRAM);
+		addr_width = space.logaddr_width();
+		addr_shift = space.addr_shift();
+		endian = (space.endianness() == ENDIANNESS_BIG) ? 1 : 0;
+	}
+
+	u32 const version = 1;
+	std::string_view const name = m_debug.device().shortname();
+	u8 const desc[4] = { addr_width, u8(addr_shift), endian, u8(m_registers.size()) };
+	u16 const length = name.length();
+	put("MAMEITR", 8);
+	put(&version, sizeof(version));
+	put(desc, sizeof(desc));
+	put(&length, sizeof(length));
+	put(name.data(), length);
+	for (device_state_entry const *entry : m_registers)
+	{
+		std::string_view const symbol = entry->symbol();
+		u16 const symlen = symbol.length();
+		put(&symlen, sizeof(symlen));
+		put(symbol.data(), symlen);
+	}
+}
+
+
+//-------------------------------------------------
+//  write_record - append a record to the current
+//  chunk, handing it to the writer when full
+//-------------------------------------------------
+
+void device_debug::tracer::write_record(u8 type, u16 extra, u32 value, void const *data, size_t size)
+{
+	size_t const pos = m_chunk.size();
+	m_chunk.resize(pos + 8 + size);
+	u8 *const dest = &m_chunk[pos];
+	dest[0] = type;
+	dest[1] = u8(size);
+	memcpy(&dest[2], &extra, sizeof(extra));
+	memcpy(&dest[4], &value, sizeof(value));
+	if (size)
+		memcpy(&dest[8], data, size);
+
+	if (m_chunk.size() >= TRACE_CHUNK)
+		handoff(false);
+}
+
+
+//-------------------------------------------------
+//  write_registers - log the registers that
+//  changed since the last instruction
+//-------------------------------------------------
+
+void device_debug::tracer::write_registers()
+{
+	for (size_t index = 0; index < m_registers.size(); index++)
+	{
+		u64 const value = m_registers[index]->value();
+		if (value != m_register_values[index])
+		{
+			m_register_values[index] = value;
+			write_record(RECORD_REG, u16(index), 0, &value, sizeof(value));
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  handoff - pass the current chunk to the writer
+//  thread, optionally waiting until everything
+//  has reached the file
+//-------------------------------------------------
+
+void device_debug::tracer::handoff(bool wait)
+{
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		// don't let a slow disk build up an unbounded backlog
+		m_cond.wait(lock, [this] () { return m_pending.size() < 16; });
+		if (!m_chunk.empty())
+			m_pending.emplace_back(std::move(m_chunk));
+		if (wait)
+			m_flush = true;
+		m_cond.notify_all();
+		if (wait)
+			m_cond.wait(lock, [this] () { return m_pending.empty() && !m_busy && !m_flush; });
+	}
+
+	m_chunk = std::vector<u8>();
+	m_chunk.reserve(TRACE_CHUNK + 512);
+}
+
+
+//-------------------------------------------------
+//  writer_thread - compress and write chunks as
+//  they are handed off
+//-------------------------------------------------
+
+void device_debug::tracer::writer_thread()
+{
+	trace_ostream_write file(*m_file);
+	util::write_stream::ptr const compressor = util::zstd_write(file, 1, 65536);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;)
+	{
+		m_cond.wait(lock, [this] () { return !m_pending.empty() || m_flush || m_exit; });
+		m_busy = true;
+		if (!m_pending.empty())
+		{
+			std::vector<u8> const chunk(std::move(m_pending.front()));
+			m_pending.erase(m_pending.begin());
+			m_cond.notify_all();
+			lock.unlock();
+			if (compressor)
+				util::write(*compressor, chunk.data(), chunk.size());
+			lock.lock();
+		}
+		else
+		{
+			// end the frame so everything so far can be read back
+			bool const exit = m_exit;
+			lock.unlock();
+			if (compressor)
+				compressor->finalize();
+			m_file->flush();
+			lock.lock();
+			m_flush = false;
+			if (exit)
+			{
+				m_busy = false;
+				m_cond.notify_all();
+				return;
+			}
+		}
+		m_busy = false;
+		m_cond.notify_all();
+	}
 }
 
 
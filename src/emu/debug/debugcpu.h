@@ -13,7 +13,10 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <utility>
 
 
@@ -150,7 +153,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, bool registers, std::string_view action);
 	template <typename Format, typename... Params> void trace_printf(Format &&fmt, Params &&...args)
 	{
 		if (m_trace != nullptr)
@@ -161,6 +164,7 @@ public:
 	void reset_transient_flag() { m_flags &= ~DEBUG_FLAG_TRANSIENT; }
 
 	static const int HISTORY_SIZE = 256;
+	static const int BREAKPOINT_FILTER_BITS = 4096;
 
 	// debugger_cpu helpers
 	void compute_debug_flags();
@@ -175,6 +179,7 @@ private:
 	// breakpoint and watchpoint helpers
 	void breakpoint_update_flags();
 	void breakpoint_check(offs_t pc);
+	static u32 breakpoint_filter_bit(offs_t pc) { return (pc ^ (pc >> 12)) & (BREAKPOINT_FILTER_BITS - 1); }
 	void registerpoint_check();
 	void reinstall_all(read_or_write mode);
 	void reinstall(address_space &space, read_or_write mode);
@@ -218,6 +223,7 @@ private:
 	std::vector<std::vector<std::unique_ptr<debug_watchpoint>>> m_wplist;  // watchpoint lists for each address space
 	std::forward_list<debug_registerpoint> m_rplist;                       // list of registerpoints
 	std::multimap<offs_t, std::unique_ptr<debug_exceptionpoint>> m_eplist; // list of exception points
+	u64                     m_bpfilter[BREAKPOINT_FILTER_BITS / 64];     // set of hashed breakpoint addresses, checked before the list
 
 	debug_breakpoint *      m_triggered_breakpoint;     // latest breakpoint that was triggered
 	debug_watchpoint *      m_triggered_watchpoint;     // latest watchpoint that was triggered
@@ -226,7 +232,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, bool registers, std::string_view action);
 		~tracer();
 
 		void update(offs_t pc);
@@ -237,6 +243,23 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static const size_t TRACE_CHUNK = 1 << 20;
+
+		// binary trace records, see debugcpu.cpp for the format
+		enum : u8
+		{
+			RECORD_INSN = 1,
+			RECORD_IRQ,
+			RECORD_LOOP,
+			RECORD_TEXT,
+			RECORD_REG
+		};
+
+		void write_header();
+		void write_record(u8 type, u16 extra, u32 value, void const *data, size_t size);
+		void write_registers();
+		void handoff(bool wait);
+		void writer_thread();
 
 		device_debug &      m_debug;                    // reference to our owner
 		std::unique_ptr<std::ostream> m_file;           // tracing file for this CPU
@@ -250,6 +273,20 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+
+		// binary tracing
+		bool                m_binary;                   // write binary records rather than text
+		std::vector<u8>     m_chunk;                    // records not yet handed to the writer
+		std::vector<u8>     m_opbuf;                    // scratch buffer for opcode bytes
+		std::vector<device_state_entry const *> m_registers; // registers logged on change
+		std::vector<u64>    m_register_values;          // last logged register values
+		std::vector<std::vector<u8>> m_pending;         // chunks waiting for the writer
+		std::thread         m_writer;                   // thread compressing and writing chunks
+		std::mutex          m_mutex;                    // protects the members below
+		std::condition_variable m_cond;                 // signals pending work or an idle writer
+		bool                m_flush;                    // writer should end the frame and flush
+		bool                m_busy;                     // writer is working on a chunk
+		bool                m_exit;                     // writer should finish and stop
 	};
 	std::unique_ptr<tracer>                m_trace;     // tracer state
 
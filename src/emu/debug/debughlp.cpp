@@ -1169,7 +1169,7 @@ const help_item f_static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror|binary|registers][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>, or the currently visible "
 		"CPU if no CPU is specified.  To enable tracing, specify the trace log file name in the "
@@ -1177,11 +1177,16 @@ const help_item f_static_help_list[] =
 		"parameter.  If the **<filename>** begins with two right angle brackets (>>), it is treated "
 		"as a directive to open the file for appending rather than overwriting.\n"
 		"\n"
-		"The optional third parameter is a flags field.  The supported flags are 'noloop' and "
-		"'logerror'.  Multiple flags must be separated by | (pipe) characters.  By default, loops "
-		"are detected and condensed to a single line.  If the 'noloop' flag is specified, loops "
-		"will not be detected and every instruction will be logged as executed.  If the 'logerror' "
-		"flag is specified, error log output will be included in the trace log.\n"
+		"The optional third parameter is a flags field.  The supported flags are 'noloop', "
+		"'logerror', 'binary' and 'registers'.  Multiple flags must be separated by | (pipe) "
+		"characters.  By default, loops are detected and condensed to a single line.  If the "
+		"'noloop' flag is specified, loops will not be detected and every instruction will be "
+		"logged as executed.  If the 'logerror' flag is specified, error log output will be "
+		"included in the trace log.  If the 'binary' flag is specified, the opcode bytes of each "
+		"instruction are written to a compressed binary log on a background thread instead of "
+		"disassembling as the CPU runs; use unidasm -trace to disassemble it afterwards.  The "
+		"'registers' flag implies 'binary' and also logs registers whenever their values "
+		"change.\n"
 		"\n"
 		"The optional <action> parameter is a debugger command to execute before each trace message "
 		"is logged.  Generally, this will include a 'tracelog' or 'tracesym' command to include "
@@ -1209,6 +1214,10 @@ const help_item f_static_help_list[] =
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to "
 		"starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace galaga.trb,,binary|noloop\n"
+		"  Begin tracing the execution of the currently visible CPU, logging binary output to "
+		"galaga.trb, with loop detection disabled.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing execution of the currently visible CPU, appending log output to "
 		"pigskin.tr.\n"
@@ -1223,7 +1232,7 @@ const help_item f_static_help_list[] =
 	{
 		"traceover",
 		"\n"
-		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror|binary|registers][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing for execution of the specified **<CPU>**, or the currently visible "
 		"CPU if no CPU is specified.  When a subroutine call is encountered, tracing will skip over "
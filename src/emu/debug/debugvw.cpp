@@ -82,6 +82,7 @@ debug_view::debug_view(running_machine &machine, debug_view_type type, debug_vie
 		m_update_level(0),
 		m_update_pending(true),
 		m_osd_update_pending(true),
+		m_osd_update_was_pending(false),
 		m_viewdata(m_visible.y * m_visible.x),
 		m_machine(machine)
 {
@@ -111,6 +112,7 @@ void debug_view::end_update()
 		{
 			// no longer pending, but flag for the OSD
 			m_update_pending = false;
+			m_osd_update_was_pending = m_osd_update_pending;
 			m_osd_update_pending = true;
 
 			// resize the viewdata if needed
@@ -218,6 +218,7 @@ protected:
 	u8                      m_update_level;     // update level; updates when this hits 0
 	bool                    m_update_pending;   // true if there is a pending update
 	bool                    m_osd_update_pending; // true if there is a pending update
+	bool                    m_osd_update_was_pending; // whether an earlier update was still pending when view_update was called
 	std::vector<debug_view_char> m_viewdata;  // current array of view data
 
 private:
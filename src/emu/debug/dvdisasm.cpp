@@ -223,17 +223,44 @@ void debug_view_disasm::view_click(const int button, const debug_view_xy& pos)
 	end_update();
 }
 
+//-------------------------------------------------
+//  disassemble - disassemble an instruction, or
+//  reuse an earlier disassembly if the memory it
+//  came from hasn't changed
+//-------------------------------------------------
+
+const debug_view_disasm::cached_insn &debug_view_disasm::disassemble(debug_disasm_buffer &buffer, offs_t address)
+{
+	auto found = m_cache.find(address);
+	if(found == m_cache.end()) {
+		if(m_cache.size() >= MAX_CACHED_INSNS)
+			m_cache.clear();
+		found = m_cache.emplace(address, cached_insn()).first;
+	} else {
+		cached_insn &insn = found->second;
+		buffer.data_get(address, insn.m_size, true, m_cache_check);
+		if(m_cache_check == insn.m_opcodes) {
+			buffer.data_get(address, insn.m_size, false, m_cache_check);
+			if(m_cache_check == insn.m_params)
+				return insn;
+		}
+	}
+
+	cached_insn &insn = found->second;
+	u32 info;
+	buffer.disassemble(address, insn.m_dasm, insn.m_next_address, insn.m_size, info);
+	buffer.data_get(address, insn.m_size, true, insn.m_opcodes);
+	buffer.data_get(address, insn.m_size, false, insn.m_params);
+	return insn;
+}
+
 void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_t address)
 {
 	m_dasm.clear();
 	for(int i=0; i != m_total.y; i++) {
-		std::string dasm;
-		offs_t size;
-		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
-		m_dasm.emplace_back(address, size, dasm);
-		address = next_address;
+		const cached_insn &insn = disassemble(buffer, address);
+		m_dasm.emplace_back(address, insn.m_size, insn.m_dasm);
+		address = insn.m_next_address;
 	}
 	m_recompute = false;
 }
@@ -263,28 +290,20 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 	if(intf.interface_flags() & util::disasm_interface::NONLINEAR_PC) {
 		offs_t lpc = intf.pc_real_to_linear(pc);
 		while(intf.pc_real_to_linear(address) < lpc) {
-			std::string dasm;
-			offs_t size;
-			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
-			m_dasm.emplace_back(address, size, dasm);
-			if(intf.pc_real_to_linear(address) > intf.pc_real_to_linear(next_address))
+			const cached_insn &insn = disassemble(buffer, address);
+			m_dasm.emplace_back(address, insn.m_size, insn.m_dasm);
+			if(intf.pc_real_to_linear(address) > intf.pc_real_to_linear(insn.m_next_address))
 				return false;
-			address = next_address;
+			address = insn.m_next_address;
 		}
 
 	} else {
 		while(address < pc) {
-			std::string dasm;
-			offs_t size;
-			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
-			m_dasm.emplace_back(address, size, dasm);
-			if(address > next_address)
+			const cached_insn &insn = disassemble(buffer, address);
+			m_dasm.emplace_back(address, insn.m_size, insn.m_dasm);
+			if(address > insn.m_next_address)
 				return false;
-			address = next_address;
+			address = insn.m_next_address;
 		}
 	}
 
@@ -295,13 +314,9 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 		m_dasm.erase(m_dasm.begin(), m_dasm.begin() + (m_dasm.size() - m_backwards_steps));
 
 	while(m_dasm.size() < m_total.y) {
-		std::string dasm;
-		offs_t size;
-		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
-		m_dasm.emplace_back(address, size, dasm);
-		address = next_address;
+		const cached_insn &insn = disassemble(buffer, address);
+		m_dasm.emplace_back(address, insn.m_size, insn.m_dasm);
+		address = insn.m_next_address;
 	}
 	return true;
 }
@@ -355,7 +370,12 @@ void debug_view_disasm::generate_dasm(debug_disasm_buffer &buffer, offs_t pc)
 
 void debug_view_disasm::complete_information(const debug_view_disasm_source &source, debug_disasm_buffer &buffer, offs_t pc)
 {
-	for(auto &dasm : m_dasm) {
+	// only the rows on show need filling in, plus the first for the column widths
+	for(u32 line = 0; line < m_dasm.size(); line++) {
+		if(line && ((s32(line) < m_topleft.y) || (s32(line) >= (m_topleft.y + m_visible.y))))
+			continue;
+
+		dasm_line &dasm = m_dasm[line];
 		offs_t adr = dasm.m_address;
 
 		dasm.m_tadr = buffer.pc_to_string(adr);
@@ -384,6 +404,19 @@ void debug_view_disasm::view_update()
 	debug_disasm_buffer buffer(*source.device());
 	offs_t pc = source.pcbase();
 
+	// what a disassembler produces can depend on CPU modes as well as
+	// memory, so start afresh if the instruction at the PC has changed
+	auto const cached = m_cache.find(pc);
+	if(cached != m_cache.end()) {
+		std::string dasm;
+		offs_t size;
+		offs_t next_address;
+		u32 info;
+		buffer.disassemble(pc, dasm, next_address, size, info);
+		if((size != cached->second.m_size) || (dasm != cached->second.m_dasm))
+			m_cache.clear();
+	}
+
 	generate_dasm(buffer, pc);
 
 	complete_information(source, buffer, pc);
@@ -577,6 +610,7 @@ void debug_view_disasm::set_source(const debug_view_source &source)
 {
 	if(&source != m_source) {
 		m_recompute = true;
+		m_cache.clear();
 		debug_view::set_source(source);
 	}
 }
@@ -15,6 +15,8 @@
 
 #include "debugvw.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -111,7 +113,18 @@ private:
 		dasm_line(offs_t address, offs_t size, std::string dasm) : m_address(address), m_size(size), m_dasm(dasm), m_is_pc(false), m_is_bp(false), m_is_visited(false) {}
 	};
 
+	// A disassembled instruction, kept with the bytes it was disassembled
+	// from so it can be reused for as long as they stay the same
+	struct cached_insn {
+		offs_t m_size;                          // size of the instruction
+		offs_t m_next_address;                  // address of the following instruction
+		std::string m_dasm;                     // disassembly
+		std::vector<u8> m_opcodes;              // opcode bytes it was disassembled from
+		std::vector<u8> m_params;               // parameter bytes it was disassembled from
+	};
+
 	// internal helpers
+	const cached_insn &disassemble(debug_disasm_buffer &buffer, offs_t address);
 	void generate_from_address(debug_disasm_buffer &buffer, offs_t address);
 	bool generate_with_pc(debug_disasm_buffer &buffer, offs_t pc);
 	int address_position(offs_t pc) const;
@@ -129,11 +142,14 @@ private:
 	offs_t                 m_previous_pc;          // previous pc, to detect whether it changed
 	debug_view_expression  m_expression;           // expression-related information
 	std::vector<dasm_line> m_dasm;                 // disassembled instructions
+	std::unordered_map<offs_t, cached_insn> m_cache; // instructions disassembled by earlier updates
+	std::vector<u8>        m_cache_check;          // scratch for comparing cached bytes
 
 	// constants
 	static constexpr int DEFAULT_DASM_LINES = 1000;
 	static constexpr int DEFAULT_DASM_WIDTH = 50;
 	static constexpr int DASM_MAX_BYTES = 16;
+	static constexpr size_t MAX_CACHED_INSNS = 0x10000;
 };
 
 #endif // MAME_EMU_DEBUG_DVDISASM_H
@@ -132,7 +132,11 @@ debug_view_memory::debug_view_memory(running_machine &machine, debug_view_osd_up
 		m_address_radix(16),
 		m_maxaddr(0),
 		m_bytes_per_row(16),
-		m_byte_offset(0)
+		m_byte_offset(0),
+		m_row_space(nullptr),
+		m_row_start(0),
+		m_row_end(0),
+		m_row_delta(0)
 {
 	// hack: define some sane init values
 	// that don't hurt the initial computation of top_left
@@ -451,9 +455,62 @@ void debug_view_memory::view_update()
 		{
 			offs_t addrbyte = m_byte_offset + effrow * m_bytes_per_row;
 			offs_t address = (source.m_space != nullptr) ? source.m_space->byte_to_address(addrbyte) : addrbyte;
+			if (source.m_space != nullptr)
+				translate_row(address, source.m_space->byte_to_address_end(addrbyte + m_bytes_per_row - 1));
 			generate_row(destmin, destmax, destrow, address);
 		}
 	}
+	m_row_space = nullptr;
+
+	// a periodic refresh of memory that hasn't changed needn't be redrawn,
+	// unless the OSD hasn't seen an earlier update yet
+	bool const unchanged = !m_osd_update_was_pending
+			&& (m_topleft.x == m_lasttopleft.x) && (m_topleft.y == m_lasttopleft.y)
+			&& (m_total.x == m_lasttotal.x) && (m_total.y == m_lasttotal.y)
+			&& (m_lastdata.size() == m_viewdata.size())
+			&& !memcmp(m_lastdata.data(), m_viewdata.data(), m_viewdata.size() * sizeof(debug_view_char));
+	if (unchanged)
+	{
+		m_osd_update_pending = false;
+	}
+	else
+	{
+		m_lastdata = m_viewdata;
+		m_lasttopleft = m_topleft;
+		m_lasttotal = m_total;
+	}
+}
+
+
+//-------------------------------------------------
+//  translate_row - translate the row about to be
+//  generated once, so its chunks don't each go
+//  through the translation hook
+//-------------------------------------------------
+
+void debug_view_memory::translate_row(offs_t start, offs_t end)
+{
+	const debug_view_memory_source &source = downcast<const debug_view_memory_source &>(*m_source);
+
+	// only rows well within an MMU page can be assumed to map linearly
+	m_row_space = nullptr;
+	if (m_no_translation || (end < start) || (end > m_maxaddr) || (m_bytes_per_row > 256))
+		return;
+
+	offs_t tstart = start & source.m_space->logaddrmask();
+	offs_t tend = end & source.m_space->logaddrmask();
+	address_space *startspace, *endspace;
+	if (!source.m_memintf->translate(source.m_space->spacenum(), device_memory_interface::TR_READ, tstart, startspace))
+		return;
+	if (!source.m_memintf->translate(source.m_space->spacenum(), device_memory_interface::TR_READ, tend, endspace))
+		return;
+	if ((startspace != endspace) || ((tend - tstart) != (end - start)))
+		return;
+
+	m_row_space = startspace;
+	m_row_start = start;
+	m_row_end = end;
+	m_row_delta = tstart - start;
 }
 
 
@@ -862,7 +919,13 @@ bool debug_view_memory::read(u8 size, offs_t offs, u64 &data)
 
 		bool ismapped = offs <= m_maxaddr;
 		address_space *tspace;
-		if (ismapped && !m_no_translation)
+		if (ismapped && m_row_space && (offs >= m_row_start) && (offs <= m_row_end))
+		{
+			// already translated with the rest of the row
+			data = m_expression.context().read_memory(*m_row_space, offs + m_row_delta, size, false);
+			return true;
+		}
+		else if (ismapped && !m_no_translation)
 		{
 			offs_t dummyaddr = offs;
 			ismapped = source.m_memintf->translate(source.m_space->spacenum(), device_memory_interface::TR_READ, dummyaddr, tspace);
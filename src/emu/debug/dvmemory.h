@@ -130,6 +130,7 @@ private:
 	bool write_digit(offs_t offs, u8 pos, u8 digit);
 	bool read(u8 size, offs_t offs, extFloat80_t &data);
 	bool read_chunk(offs_t address, int chunknum, u64 &chunkdata);
+	void translate_row(offs_t start, offs_t end);
 	void generate_row(debug_view_char *destmin, debug_view_char *destmax, debug_view_char *destrow, offs_t address);
 
 	// internal state
@@ -157,6 +158,17 @@ private:
 	};
 	section             m_section[3];           // (derived) 3 sections to manage
 
+	// translation of the row being generated, when it maps linearly
+	address_space *     m_row_space;            // translated space, or nullptr to translate each read
+	offs_t              m_row_start;            // first logical address of the row
+	offs_t              m_row_end;              // last logical address of the row
+	offs_t              m_row_delta;            // translated address minus logical address
+
+	// what was last handed to the OSD, to skip redrawing when nothing changed
+	std::vector<debug_view_char> m_lastdata;
+	debug_view_xy       m_lasttopleft;
+	debug_view_xy       m_lasttotal;
+
 	struct memory_view_pos
 	{
 		u8           m_bytes;                // bytes per entry
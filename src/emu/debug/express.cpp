@@ -630,9 +630,56 @@ void symbol_table::notify_memory_modified()
 
 u64 symbol_table::memory_value(const char *name, expression_space spacenum, u32 address, int size, bool disable_se)
 {
-	device_memory_interface *memory = m_memintf;
+	if (spacenum == EXPSPACE_REGION)
+		return name ? read_memory_region(name, address, size) : 0;
+
+	address_space *const space = memory_space(name, spacenum);
+	return space ? memory_value(*space, spacenum, address, size, disable_se) : 0;
+}
+
+
+//-------------------------------------------------
+//  memory_value - read 1,2,4 or 8 bytes at the
+//  given offset in an address space found with
+//  memory_space
+//-------------------------------------------------
+
+u64 symbol_table::memory_value(address_space &space, expression_space spacenum, u32 address, int size, bool disable_se)
+{
+	auto dis = m_machine.disable_side_effects(disable_se);
+	switch (spacenum)
+	{
+	case EXPSPACE_PROGRAM_LOGICAL:
+	case EXPSPACE_DATA_LOGICAL:
+	case EXPSPACE_IO_LOGICAL:
+	case EXPSPACE_OPCODE_LOGICAL:
+		return read_memory(space, address, size, true);
+
+	case EXPSPACE_PROGRAM_PHYSICAL:
+	case EXPSPACE_DATA_PHYSICAL:
+	case EXPSPACE_IO_PHYSICAL:
+	case EXPSPACE_OPCODE_PHYSICAL:
+		return read_memory(space, address, size, false);
+
+	case EXPSPACE_PRGDIRECT:
+	case EXPSPACE_OPDIRECT:
+		return read_program_direct(space, (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size);
+
+	default:
+		return 0;
+	}
+}
 
-	bool logical = true;
+
+//-------------------------------------------------
+//  memory_space - look up the address space an
+//  expression memory access refers to, or return
+//  nullptr for regions and missing spaces
+//-------------------------------------------------
+
+address_space *symbol_table::memory_space(const char *name, expression_space spacenum)
+{
+	device_memory_interface *memory = m_memintf;
 	int space = -1;
 	switch (spacenum)
 	{
@@ -640,43 +687,27 @@ u64 symbol_table::memory_value(const char *name, expression_space spacenum, u32
 	case EXPSPACE_DATA_PHYSICAL:
 	case EXPSPACE_IO_PHYSICAL:
 	case EXPSPACE_OPCODE_PHYSICAL:
-		spacenum = expression_space(spacenum - (EXPSPACE_PROGRAM_PHYSICAL - EXPSPACE_PROGRAM_LOGICAL));
-		logical = false;
-		[[fallthrough]];
+		space = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_PHYSICAL);
+		break;
+
 	case EXPSPACE_PROGRAM_LOGICAL:
 	case EXPSPACE_DATA_LOGICAL:
 	case EXPSPACE_IO_LOGICAL:
 	case EXPSPACE_OPCODE_LOGICAL:
 		space = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_LOGICAL);
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			return read_memory(memory->space(space), address, size, logical);
-		}
 		break;
 
 	case EXPSPACE_PRGDIRECT:
 	case EXPSPACE_OPDIRECT:
 		space = (spacenum == EXPSPACE_OPDIRECT) ? AS_OPCODES : AS_PROGRAM;
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			return read_program_direct(memory->space(space), (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size);
-		}
-		break;
-
-	case EXPSPACE_REGION:
-		if (name)
-			return read_memory_region(name, address, size);
 		break;
 
 	default:
-		break;
+		return nullptr;
 	}
 
-	return 0;
+	expression_get_space(name, space, memory);
+	return memory ? &memory->space(space) : nullptr;
 }
 
 
@@ -788,46 +819,47 @@ u64 symbol_table::read_memory_region(const char *rgntag, offs_t address, int siz
 
 void symbol_table::set_memory_value(const char *name, expression_space spacenum, u32 address, int size, u64 data, bool disable_se)
 {
-	device_memory_interface *memory = m_memintf;
+	if (spacenum == EXPSPACE_REGION)
+	{
+		if (name)
+			write_memory_region(name, address, size, data);
+		return;
+	}
 
-	bool logical = true;
-	int space = -1;
+	address_space *const space = memory_space(name, spacenum);
+	if (space)
+		set_memory_value(*space, spacenum, address, size, data, disable_se);
+}
+
+
+//-------------------------------------------------
+//  set_memory_value - write 1,2,4 or 8 bytes at
+//  the given offset in an address space found
+//  with memory_space
+//-------------------------------------------------
+
+void symbol_table::set_memory_value(address_space &space, expression_space spacenum, u32 address, int size, u64 data, bool disable_se)
+{
+	auto dis = m_machine.disable_side_effects(disable_se);
 	switch (spacenum)
 	{
-	case EXPSPACE_PROGRAM_PHYSICAL:
-	case EXPSPACE_DATA_PHYSICAL:
-	case EXPSPACE_IO_PHYSICAL:
-	case EXPSPACE_OPCODE_PHYSICAL:
-		spacenum = expression_space(spacenum - (EXPSPACE_PROGRAM_PHYSICAL - EXPSPACE_PROGRAM_LOGICAL));
-		logical = false;
-		[[fallthrough]];
 	case EXPSPACE_PROGRAM_LOGICAL:
 	case EXPSPACE_DATA_LOGICAL:
 	case EXPSPACE_IO_LOGICAL:
 	case EXPSPACE_OPCODE_LOGICAL:
-		space = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_LOGICAL);
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			write_memory(memory->space(space), address, data, size, logical);
-		}
+		write_memory(space, address, data, size, true);
 		break;
 
-	case EXPSPACE_PRGDIRECT:
-	case EXPSPACE_OPDIRECT:
-		space = (spacenum == EXPSPACE_OPDIRECT) ? AS_OPCODES : AS_PROGRAM;
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			write_program_direct(memory->space(space), (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size, data);
-		}
+	case EXPSPACE_PROGRAM_PHYSICAL:
+	case EXPSPACE_DATA_PHYSICAL:
+	case EXPSPACE_IO_PHYSICAL:
+	case EXPSPACE_OPCODE_PHYSICAL:
+		write_memory(space, address, data, size, false);
 		break;
 
-	case EXPSPACE_REGION:
-		if (name)
-			write_memory_region(name, address, size, data);
+	case EXPSPACE_PRGDIRECT:
+	case EXPSPACE_OPDIRECT:
+		write_program_direct(space, (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size, data);
 		break;
 
 	default:
@@ -1041,6 +1073,7 @@ parsed_expression::parsed_expression(const parsed_expression &src)
 {
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
+	compile();
 }
 
 
@@ -1054,12 +1087,16 @@ void parsed_expression::parse(std::string_view expression)
 	m_original_string.assign(expression);
 	m_tokenlist.clear();
 	m_stringlist.clear();
+	m_program.clear();
 
 	// first parse the tokens into the token array in order
 	parse_string_into_tokens();
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// and lay it out for execution
+	compile();
 }
 
 
@@ -1072,8 +1109,25 @@ void parsed_expression::copy(const parsed_expression &src)
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
 	m_original_string.assign(src.m_original_string);
+	m_tokenlist.clear();
+	m_stringlist.clear();
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
+	compile();
+}
+
+
+//-------------------------------------------------
+//  compile - copy the postfix token list into
+//  contiguous storage for execution, and size the
+//  stack so executing doesn't allocate
+//-------------------------------------------------
+
+void parsed_expression::compile()
+{
+	m_program.assign(m_tokenlist.begin(), m_tokenlist.end());
+	m_token_stack.clear();
+	m_token_stack.reserve(m_program.size());
 }
 
 
@@ -1892,7 +1946,7 @@ u64 parsed_expression::execute_tokens()
 
 	// loop over the entire sequence
 	parse_token t1, t2, result;
-	for (parse_token &token : m_tokenlist)
+	for (parse_token &token : m_program)
 	{
 		// symbols/numbers/strings just get pushed
 		if (!token.is_operator())
@@ -2122,6 +2176,7 @@ u64 parsed_expression::execute_tokens()
 
 			case TVL_MEMORYAT:
 				pop_token_rval(t1);
+				token.resolve_memory_space(m_symtable);
 				push_token(result.configure_memory(t1.value(), token));
 				break;
 
@@ -2160,11 +2215,30 @@ parsed_expression::parse_token::parse_token(int offset)
 		m_value(0),
 		m_flags(0),
 		m_string(nullptr),
-		m_symbol(nullptr)
+		m_symbol(nullptr),
+		m_space(nullptr),
+		m_space_table(nullptr)
 {
 }
 
 
+//-------------------------------------------------
+//  resolve_memory_space - look up the address
+//  space for a memory operator the first time
+//  it's executed with a given symbol table, so
+//  the tag search isn't repeated for every access
+//-------------------------------------------------
+
+inline void parsed_expression::parse_token::resolve_memory_space(symbol_table &table)
+{
+	if (m_space_table != &table)
+	{
+		m_space = table.memory_space(m_string, memory_space());
+		m_space_table = &table;
+	}
+}
+
+
 //-------------------------------------------------
 //  get_lval_value - call the getter function
 //  for a SYMBOL token
@@ -2177,6 +2251,8 @@ u64 parsed_expression::parse_token::get_lval_value(symbol_table &table)
 		return m_symbol->value();
 
 	// or get the value from the memory callbacks
+	else if (is_memory() && m_space && (m_space_table == &table))
+		return table.memory_value(*m_space, memory_space(), address(), 1 << memory_size(), memory_side_effects());
 	else if (is_memory())
 		return table.memory_value(m_string, memory_space(), address(), 1 << memory_size(), memory_side_effects());
 
@@ -2196,6 +2272,8 @@ inline void parsed_expression::parse_token::set_lval_value(symbol_table &table,
 		m_symbol->set_value(value);
 
 	// or set the value via the memory callbacks
+	else if (is_memory() && m_space && (m_space_table == &table))
+		table.set_memory_value(*m_space, memory_space(), address(), 1 << memory_size(), value, memory_side_effects());
 	else if (is_memory())
 		table.set_memory_value(m_string, memory_space(), address(), 1 << memory_size(), value, memory_side_effects());
 }
@@ -15,11 +15,11 @@
 
 #include "emucore.h"
 
-#include <deque>
 #include <functional>
 #include <list>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -198,6 +198,9 @@ public:
 	expression_error::error_code memory_valid(const char *name, expression_space space);
 	u64 memory_value(const char *name, expression_space space, u32 offset, int size, bool disable_se);
 	void set_memory_value(const char *name, expression_space space, u32 offset, int size, u64 value, bool disable_se);
+	address_space *memory_space(const char *name, expression_space space);
+	u64 memory_value(address_space &space, expression_space spacenum, u32 offset, int size, bool disable_se);
+	void set_memory_value(address_space &space, expression_space spacenum, u32 offset, int size, u64 value, bool disable_se);
 	u64 read_memory(address_space &space, offs_t address, int size, bool apply_translation);
 	void write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation);
 
@@ -316,7 +319,7 @@ private:
 		parse_token &set_offset(const parse_token &src1, const parse_token &src2) { m_offset = std::min(src1.m_offset, src2.m_offset); return *this; }
 		parse_token &configure_number(u64 value) { m_type = NUMBER; m_value = value; return *this; }
 		parse_token &configure_string(const char *string) { m_type = STRING; m_string = string; return *this; }
-		parse_token &configure_memory(u32 address, parse_token &memoryat) { m_type = MEMORY; m_value = address; m_flags = memoryat.m_flags; m_string = memoryat.m_string; return *this; }
+		parse_token &configure_memory(u32 address, parse_token &memoryat) { m_type = MEMORY; m_value = address; m_flags = memoryat.m_flags; m_string = memoryat.m_string; m_space = memoryat.m_space; m_space_table = memoryat.m_space_table; return *this; }
 		parse_token &configure_symbol(symbol_entry &symbol) { m_type = SYMBOL; m_symbol = &symbol; return *this; }
 		parse_token &configure_operator(u8 optype, u8 precedence)
 			{ m_type = OPERATOR; m_flags = ((optype << TIN_OPTYPE_SHIFT) & TIN_OPTYPE_MASK) | ((precedence << TIN_PRECEDENCE_SHIFT) & TIN_PRECEDENCE_MASK); return *this; }
@@ -329,6 +332,7 @@ private:
 		parse_token &set_memory_source(const char *string) { assert(m_type == OPERATOR || m_type == MEMORY); m_string = string; return *this; }
 
 		// access
+		void resolve_memory_space(symbol_table &symtable);
 		u64 get_lval_value(symbol_table &symtable);
 		void set_lval_value(symbol_table &symtable, u64 value);
 
@@ -340,10 +344,13 @@ private:
 		u32                     m_flags;            // additional flags/info
 		const char *            m_string;           // associated string
 		symbol_entry *          m_symbol;           // symbol pointer
+		address_space *         m_space;            // address space for memory, once resolved
+		symbol_table *          m_space_table;      // symbol table the space was resolved with
 	};
 
 	// internal helpers
 	void copy(const parsed_expression &src);
+	void compile();
 	void print_tokens();
 
 	// parsing helpers
@@ -373,7 +380,8 @@ private:
 	std::string         m_original_string;              // original string (prior to parsing)
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
-	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<parse_token> m_program;                 // postfix tokens in execution order
+	std::vector<parse_token> m_token_stack;             // token stack (used during execution)
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <functional>
@@ -323,7 +324,53 @@ template <typename Result, std::make_unsigned_t<Result> DefaultMask = std::make_
 class devcb_read : public devcb_read_base
 {
 private:
-	using func_t = std::function<Result (offs_t, std::make_unsigned_t<Result>)>;
+	/// \brief Resolved callback
+	///
+	/// Holds a built callback chain and calls it through a plain
+	/// function pointer, so the whole chain is a single call.
+	class func_t
+	{
+	public:
+		using ptr = std::unique_ptr<func_t>;
+
+		virtual ~func_t() { }
+
+		Result operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask) const { return m_thunk(*this, offset, mem_mask); }
+
+	protected:
+		using thunk_t = Result (*)(func_t const &, offs_t, std::make_unsigned_t<Result>);
+
+		func_t(thunk_t thunk) : m_thunk(thunk) { }
+
+	private:
+		thunk_t const m_thunk;
+	};
+
+	template <typename T, typename InputMask>
+	class func_impl : public func_t
+	{
+	public:
+		func_impl(T &&cb) : func_t(&func_impl::call), m_cb(std::move(cb)) { }
+
+	private:
+		static Result call(func_t const &f, offs_t offset, std::make_unsigned_t<Result> mem_mask)
+		{
+			InputMask m(mem_mask);
+			return static_cast<func_impl const &>(f).m_cb(offset, m);
+		}
+
+		T const m_cb;
+	};
+
+	/// \brief Constant-valued functoid
+	///
+	/// Used by set_constant so a callback that always reads the same
+	/// value can be folded when it's resolved.
+	struct constant_func
+	{
+		Result value;
+		Result operator()() const { return value; }
+	};
 
 	class creator
 	{
@@ -332,7 +379,8 @@ private:
 
 		virtual ~creator() { }
 		virtual bool validity_check(validity_checker &valid) const = 0;
-		virtual func_t create() = 0;
+		virtual typename func_t::ptr create() = 0;
+		virtual bool constant() const = 0;
 
 		std::make_unsigned_t<Result> mask() const { return m_mask; }
 
@@ -350,13 +398,19 @@ private:
 
 		virtual bool validity_check(validity_checker &valid) const override { return m_builder.validity_check(valid); }
 
-		virtual func_t create() override
+		virtual typename func_t::ptr create() override
 		{
-			func_t result;
-			m_builder.build([&result] (auto &&f) { result = [cb = std::move(f)] (offs_t offset, typename T::input_mask_t mem_mask) { return cb(offset, mem_mask); }; });
+			typename func_t::ptr result;
+			m_builder.build(
+					[&result] (auto &&f)
+					{
+						result = std::make_unique<func_impl<std::remove_reference_t<decltype(f)>, typename T::input_mask_t> >(std::move(f));
+					});
 			return result;
 		}
 
+		virtual bool constant() const override { return T::constant; }
+
 	private:
 		T m_builder;
 	};
@@ -365,6 +419,9 @@ private:
 
 	class builder_base
 	{
+	public:
+		static constexpr bool constant = false;
+
 	protected:
 		template <typename T, typename U> friend class transform_builder; // workaround for MSVC
 
@@ -483,6 +540,9 @@ private:
 		using output_t = mask_t<read_result_t<Result, Func>, Result>;
 		using input_mask_t = std::make_unsigned_t<Result>;
 
+		// the mask and exclusive-or don't depend on the offset or memory mask, so the result is constant too
+		static constexpr bool constant = std::is_same_v<Func, constant_func>;
+
 		template <typename T>
 		functoid_builder(devcb_read &target, bool append, T &&cb)
 			: builder_base(target, append)
@@ -753,8 +813,8 @@ private:
 			return set_ioport(std::forward<Params>(args)...);
 		}
 
-		auto set_constant(Result val) { return set([val] () { return val; }); }
-		auto append_constant(Result val) { return append([val] () { return val; }); }
+		auto set_constant(Result val) { return set(constant_func{ val }); }
+		auto append_constant(Result val) { return append(constant_func{ val }); }
 
 	private:
 		void set_used() { assert(!m_used); m_used = true; }
@@ -764,9 +824,11 @@ private:
 		bool m_used = false;
 	};
 
-	std::vector<func_t> m_functions;
+	std::vector<typename func_t::ptr> m_functions;
 	std::vector<typename creator::ptr> m_creators;
 	Result const m_default;
+	std::make_unsigned_t<Result> m_constant_value = 0;
+	bool m_constant = false;
 	bool m_unset = false;
 
 protected:
@@ -792,7 +854,7 @@ public:
 	Result operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask = DefaultMask);
 	Result operator()();
 
-	bool isunset() const noexcept { return m_unset || (m_functions.empty() && m_creators.empty()); }
+	bool isunset() const noexcept { return m_unset || (!m_constant && m_functions.empty() && m_creators.empty()); }
 };
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
@@ -823,15 +885,26 @@ bool devcb_read<Result, DefaultMask>::findit(validity_checker *valid)
 	if (!valid)
 	{
 		// FIXME: report errors by returning false rather than throwing fatal errors
+		bool const constant(std::all_of(m_creators.begin(), m_creators.end(), [] (typename creator::ptr const &c) { return c->constant(); }));
 		m_functions.reserve(m_creators.size());
 		for (typename creator::ptr const &c : m_creators)
 			m_functions.emplace_back(c->create());
 		m_creators.clear();
 		if (m_functions.empty())
 		{
-			m_functions.emplace_back([dflt = m_default] (offs_t offset, std::make_unsigned_t<Result> mem_mask) { return dflt; });
+			m_constant_value = m_default;
+			m_constant = true;
 			m_unset = true;
 		}
+		else if (constant)
+		{
+			// fold callbacks that always read the same value
+			m_constant_value = 0;
+			for (typename func_t::ptr const &f : m_functions)
+				m_constant_value |= (*f)(0U, DefaultMask);
+			m_functions.clear();
+			m_constant = true;
+		}
 		return true;
 	}
 	else
@@ -864,11 +937,13 @@ void devcb_read<Result, DefaultMask>::end_configuration()
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 Result devcb_read<Result, DefaultMask>::operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask)
 {
-	assert(m_creators.empty() && !m_functions.empty());
-	typename std::vector<func_t>::const_iterator it(m_functions.begin());
-	std::make_unsigned_t<Result> result((*it)(offset, mem_mask));
+	assert(m_creators.empty() && (m_constant || !m_functions.empty()));
+	if (m_constant)
+		return m_constant_value;
+	typename std::vector<typename func_t::ptr>::const_iterator it(m_functions.begin());
+	std::make_unsigned_t<Result> result((**it)(offset, mem_mask));
 	while (m_functions.end() != ++it)
-		result |= (*it)(offset, mem_mask);
+		result |= (**it)(offset, mem_mask);
 	return result;
 }
 
@@ -888,7 +963,42 @@ template <typename Input, std::make_unsigned_t<Input> DefaultMask = std::make_un
 class devcb_write : public devcb_write_base
 {
 private:
-	using func_t = std::function<void (offs_t, Input, std::make_unsigned_t<Input>)>;
+	/// \brief Resolved callback
+	///
+	/// Holds a built callback chain and calls it through a plain
+	/// function pointer, so the whole chain is a single call.
+	class func_t
+	{
+	public:
+		using ptr = std::unique_ptr<func_t>;
+
+		virtual ~func_t() { }
+
+		void operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) const { m_thunk(*this, offset, data, mem_mask); }
+
+	protected:
+		using thunk_t = void (*)(func_t const &, offs_t, Input, std::make_unsigned_t<Input>);
+
+		func_t(thunk_t thunk) : m_thunk(thunk) { }
+
+	private:
+		thunk_t const m_thunk;
+	};
+
+	template <typename T>
+	class func_impl : public func_t
+	{
+	public:
+		func_impl(T &&cb) : func_t(&func_impl::call), m_cb(std::move(cb)) { }
+
+	private:
+		static void call(func_t const &f, offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
+		{
+			static_cast<func_impl const &>(f).m_cb(offset, data, mem_mask);
+		}
+
+		T const m_cb;
+	};
 
 	class creator
 	{
@@ -897,7 +1007,7 @@ private:
 
 		virtual ~creator() { }
 		virtual bool validity_check(validity_checker &valid) const = 0;
-		virtual func_t create() = 0;
+		virtual typename func_t::ptr create() = 0;
 	};
 
 	template <typename T>
@@ -908,9 +1018,10 @@ private:
 
 		virtual bool validity_check(validity_checker &valid) const override { return m_builder.validity_check(valid); }
 
-		virtual func_t create() override
+		virtual typename func_t::ptr create() override
 		{
-			return [cb = m_builder.build()] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { cb(offset, data, mem_mask); };
+			auto cb(m_builder.build());
+			return std::make_unique<func_impl<decltype(cb)> >(std::move(cb));
 		}
 
 	private:
@@ -921,7 +1032,7 @@ private:
 	{
 	public:
 		virtual bool validity_check(validity_checker &valid) const override { return true; }
-		virtual func_t create() override { return [] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { }; }
+		virtual typename func_t::ptr create() override { return nullptr; } // nothing to call
 	};
 
 	template <typename Source, typename Func> class transform_builder; // workaround for MSVC
@@ -2160,9 +2271,10 @@ private:
 		bool m_used = false;
 	};
 
-	std::vector<func_t> m_functions;
+	std::vector<typename func_t::ptr> m_functions;
 	std::vector<typename creator::ptr> m_creators;
 	bool m_unset = false;
+	bool m_resolved = false;
 
 protected:
 	virtual bool findit(validity_checker *valid) override;
@@ -2187,7 +2299,7 @@ public:
 	void operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask = DefaultMask);
 	void operator()(Input data);
 
-	bool isunset() const noexcept { return m_unset || (m_functions.empty() && m_creators.empty()); }
+	bool isunset() const noexcept { return m_unset || (!m_resolved && m_functions.empty() && m_creators.empty()); }
 };
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
@@ -2217,15 +2329,16 @@ bool devcb_write<Input, DefaultMask>::findit(validity_checker *valid)
 	if (!valid)
 	{
 		// FIXME: report errors by returning false rather than throwing fatal errors
+		m_unset = m_creators.empty();
 		m_functions.reserve(m_creators.size());
 		for (typename creator::ptr const &c : m_creators)
-			m_functions.emplace_back(c->create());
-		m_creators.clear();
-		if (m_functions.empty())
 		{
-			m_functions.emplace_back([] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { });
-			m_unset = true;
+			typename func_t::ptr f(c->create());
+			if (f)
+				m_functions.emplace_back(std::move(f));
 		}
+		m_creators.clear();
+		m_resolved = true;
 		return true;
 	}
 	else
@@ -2248,11 +2361,9 @@ void devcb_write<Input, DefaultMask>::end_configuration()
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
 {
-	assert(m_creators.empty() && !m_functions.empty());
-	typename std::vector<func_t>::const_iterator it(m_functions.begin());
-	(*it)(offset, data, mem_mask);
-	while (m_functions.end() != ++it)
-		(*it)(offset, data, mem_mask);
+	assert(m_creators.empty() && m_resolved);
+	for (typename func_t::ptr const &f : m_functions)
+		(*f)(offset, data, mem_mask);
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
@@ -840,35 +840,47 @@ void device_t::device_debug_setup()
 
 
 //-------------------------------------------------
-//  subdevice_slow - perform a slow name lookup,
-//  caching the results
+//  subdevice_slow - look up a path that isn't a
+//  direct child, walking the tree from here
 //-------------------------------------------------
 
 device_t *device_t::subdevice_slow(std::string_view tag) const
 {
-	// resolve the full path
-	std::string fulltag = subtag(tag);
+	// this resolves the path the same way subtag does, but moves through the
+	// tree as it goes rather than building the full tag and walking from the
+	// root; finders on slot cards and the like hit this a lot during startup
+	device_t *curdevice = const_cast<device_t *>(this);
+	if (!tag.empty() && (tag[0] == ':'))
+	{
+		// a plain absolute tag is exactly a device's full tag, so it can be
+		// looked up directly
+		if ((tag.find('^') == std::string_view::npos) && (tag.find("::") == std::string_view::npos) && ((tag.length() == 1) || (tag.back() != ':')))
+			return mconfig().device_by_tag(tag);
 
-	// we presume the result is a rooted path; also doubled colons mess up our
-	// tree walk, so catch them early
-	assert(fulltag[0] == ':');
-	assert(fulltag.find("::") == std::string::npos);
+		curdevice = &mconfig().root_device();
+		tag.remove_prefix(1);
+	}
 
-	// walk the device list to the final path
-	device_t *curdevice = &mconfig().root_device();
-	std::string_view part(std::string_view(fulltag).substr(1));
-	while (!part.empty() && curdevice != nullptr)
+	while (!tag.empty())
 	{
-		std::string_view::size_type end = part.find_first_of(':');
-		if (end == std::string::npos)
+		std::string_view::size_type const delimiter = tag.find_first_of("^:");
+		std::string_view const part = tag.substr(0, delimiter);
+		bool const parent = (delimiter != std::string_view::npos) && (tag[delimiter] == '^');
+		tag.remove_prefix((delimiter != std::string_view::npos) ? (delimiter + 1) : tag.length());
+
+		if (parent)
 		{
-			curdevice = curdevice->subdevices().find(part);
-			part = std::string_view();
+			// a name followed by a caret cancels out; otherwise go up a level,
+			// staying put at the root
+			if (part.empty() && curdevice->owner())
+				curdevice = curdevice->owner();
 		}
-		else
+		else if (!part.empty())
 		{
-			curdevice = curdevice->subdevices().find(part.substr(0, end));
-			part.remove_prefix(end + 1);
+			// successive colons collapse to one
+			curdevice = curdevice->subdevices().find(part);
+			if (!curdevice)
+				return nullptr;
 		}
 	}
 
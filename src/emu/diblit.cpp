@@ -0,0 +1,193 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    diblit.cpp
+
+    Device interface for running blitter work on a worker thread.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "diblit.h"
+
+#include "screen.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  DEVICE BLITTER OFFLOAD INTERFACE
+//**************************************************************************
+
+//-------------------------------------------------
+//  device_blitter_offload_interface - constructor
+//-------------------------------------------------
+
+device_blitter_offload_interface::device_blitter_offload_interface(const machine_config &mconfig, device_t &device)
+	: device_interface(device, "blitter")
+	, m_threaded(true)
+	, m_vblank_sync(true)
+	, m_page_bits(0)
+	, m_vram_size(0)
+	, m_queue(nullptr)
+	, m_running(false)
+	, m_submitted(0)
+	, m_completed(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~device_blitter_offload_interface - destructor
+//-------------------------------------------------
+
+device_blitter_offload_interface::~device_blitter_offload_interface()
+{
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  interface_post_start - allocate the worker
+//  and hook vblank
+//-------------------------------------------------
+
+void device_blitter_offload_interface::interface_post_start()
+{
+	if (m_threaded)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+
+	if (m_vram_size)
+		m_page_writes.resize(((m_vram_size - 1) >> m_page_bits) + 1, 0);
+
+	device_video_interface *video;
+	if (m_vblank_sync && device().interface(video) && video->has_screen())
+		video->screen().register_vblank_callback(vblank_state_delegate(&device_blitter_offload_interface::vblank_sync, this));
+}
+
+
+//-------------------------------------------------
+//  interface_pre_save - settle everything the
+//  worker is writing before it's saved
+//-------------------------------------------------
+
+void device_blitter_offload_interface::interface_pre_save()
+{
+	blitter_sync();
+}
+
+
+//-------------------------------------------------
+//  interface_pre_stop - don't leave the worker
+//  running on state that's going away
+//-------------------------------------------------
+
+void device_blitter_offload_interface::interface_pre_stop()
+{
+	blitter_sync();
+}
+
+
+//-------------------------------------------------
+//  blitter_submit - queue a command for the
+//  worker
+//-------------------------------------------------
+
+void device_blitter_offload_interface::blitter_submit(blitter_command &&command)
+{
+	u64 const seq = ++m_submitted;
+	if (!m_queue)
+	{
+		command();
+		m_completed.store(seq, std::memory_order_release);
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_fifo.emplace_back(std::move(command), seq);
+	if (!m_running)
+	{
+		m_running = true;
+		osd_work_item_queue(m_queue, worker_callback, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+	}
+}
+
+void device_blitter_offload_interface::blitter_submit(blitter_command &&command, offs_t start, offs_t end)
+{
+	// note which pages this command writes before it can start
+	if (!m_page_writes.empty())
+	{
+		offs_t const last = std::min<offs_t>(end >> m_page_bits, m_page_writes.size() - 1);
+		for (offs_t page = start >> m_page_bits; page <= last; page++)
+			m_page_writes[page] = m_submitted + 1;
+	}
+	blitter_submit(std::move(command));
+}
+
+
+//-------------------------------------------------
+//  blitter_sync - wait for queued commands to
+//  finish
+//-------------------------------------------------
+
+void device_blitter_offload_interface::blitter_sync()
+{
+	while (!blitter_idle())
+		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+}
+
+void device_blitter_offload_interface::blitter_sync(offs_t start, offs_t end)
+{
+	// without page tracking, anything might be writing the range
+	if (m_page_writes.empty())
+	{
+		blitter_sync();
+		return;
+	}
+
+	u64 needed = 0;
+	offs_t const last = std::min<offs_t>(end >> m_page_bits, m_page_writes.size() - 1);
+	for (offs_t page = start >> m_page_bits; page <= last; page++)
+		needed = std::max(needed, m_page_writes[page]);
+	if (m_completed.load(std::memory_order_acquire) < needed)
+		blitter_sync();
+}
+
+
+//-------------------------------------------------
+//  vblank_sync - finish drawing at the start of
+//  vblank
+//-------------------------------------------------
+
+void device_blitter_offload_interface::vblank_sync(screen_device &screen, bool vblank_state)
+{
+	if (vblank_state)
+		blitter_sync();
+}
+
+
+//-------------------------------------------------
+//  worker_callback - run commands until the FIFO
+//  is empty
+//-------------------------------------------------
+
+void *device_blitter_offload_interface::worker_callback(void *param, int threadid)
+{
+	device_blitter_offload_interface &blitter = *reinterpret_cast<device_blitter_offload_interface *>(param);
+	std::unique_lock<std::mutex> lock(blitter.m_mutex);
+	while (!blitter.m_fifo.empty())
+	{
+		std::pair<blitter_command, u64> item(std::move(blitter.m_fifo.front()));
+		blitter.m_fifo.pop_front();
+		lock.unlock();
+
+		item.first();
+		blitter.m_completed.store(item.second, std::memory_order_release);
+
+		lock.lock();
+	}
+	blitter.m_running = false;
+	return nullptr;
+}
@@ -0,0 +1,87 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    diblit.h
+
+    Device interface for running blitter work on a worker thread.
+
+    Commands run one at a time, in the order they were submitted.  A
+    command can give the range of VRAM it writes, so a CPU read only
+    waits for the commands that touch what it reads.  Everything still
+    queued is waited for at the start of vblank (if the device has a
+    screen), before saving state, and when the machine stops.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_DIBLIT_H
+#define MAME_EMU_DIBLIT_H
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+// ======================> device_blitter_offload_interface
+
+class device_blitter_offload_interface : public device_interface
+{
+public:
+	using blitter_command = std::function<void ()>;
+
+	// construction/destruction
+	device_blitter_offload_interface(const machine_config &mconfig, device_t &device);
+	virtual ~device_blitter_offload_interface();
+
+	// configuration
+	void set_blitter_threaded(bool threaded) { assert(!device().started()); m_threaded = threaded; }
+	void set_blitter_vblank_sync(bool sync) { assert(!device().started()); m_vblank_sync = sync; }
+	void set_blitter_vram(offs_t size, u8 page_bits) { assert(!device().started()); m_vram_size = size; m_page_bits = page_bits; }
+
+protected:
+	// queue a command, optionally with the range of VRAM it writes
+	void blitter_submit(blitter_command &&command);
+	void blitter_submit(blitter_command &&command, offs_t start, offs_t end);
+
+	// wait for everything queued, or just for what writes start-end
+	void blitter_sync();
+	void blitter_sync(offs_t start, offs_t end);
+	bool blitter_idle() const { return m_completed.load(std::memory_order_acquire) == m_submitted; }
+
+	// device_interface implementation
+	virtual void interface_post_start() override ATTR_COLD;
+	virtual void interface_pre_save() override ATTR_COLD;
+	virtual void interface_pre_stop() override ATTR_COLD;
+
+private:
+	static void *worker_callback(void *param, int threadid);
+	void vblank_sync(screen_device &screen, bool vblank_state);
+
+	// configuration
+	bool                    m_threaded;
+	bool                    m_vblank_sync;
+	u8                      m_page_bits;
+	offs_t                  m_vram_size;
+
+	// command FIFO, shared with the worker
+	osd_work_queue *        m_queue;
+	std::mutex              m_mutex;
+	std::deque<std::pair<blitter_command, u64> > m_fifo;
+	bool                    m_running;      // a worker item is queued or running
+
+	// sequence numbers - commands submitted, commands finished, and the last command to write each VRAM page
+	u64                     m_submitted;
+	std::atomic<u64>        m_completed;
+	std::vector<u64>        m_page_writes;
+};
+
+// iterator
+typedef device_interface_enumerator<device_blitter_offload_interface> blitter_offload_interface_enumerator;
+
+
+#endif // MAME_EMU_DIBLIT_H
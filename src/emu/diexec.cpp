@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 #include "screen.h"
 
 
@@ -46,6 +47,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	: device_interface(device, "execute")
 	, m_scheduler(nullptr)
 	, m_disabled(false)
+	, m_execution_group(0)
 	, m_vblank_interrupt(device)
 	, m_vblank_interrupt_screen(nullptr)
 	, m_timed_interrupt(device)
@@ -53,6 +55,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_nextexec(nullptr)
 	, m_driver_irq(device)
 	, m_timedint_timer(nullptr)
+	, m_deferred_inputs(0)
 	, m_profiler(PROFILER_IDLE)
 	, m_icountptr(nullptr)
 	, m_cycles_running(0)
@@ -68,6 +71,10 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_divshift(0)
 	, m_cycles_per_second(0)
 	, m_attoseconds_per_cycle(0)
+	, m_idle_detect(false)
+	, m_idle_clean(false)
+	, m_idle_pc(0)
+	, m_idle_state(0)
 	, m_spin_end_timer(nullptr)
 {
 	// configure the fast accessor
@@ -100,6 +107,7 @@ void device_execute_interface::abort_timeslice() noexcept
 	// swallow the remaining cycles
 	if (m_icountptr != nullptr && *m_icountptr > 0)
 	{
+		m_stats.aborted++;
 		m_cycles_stolen += *m_icountptr;
 		m_cycles_running -= *m_icountptr;
 		*m_icountptr = 0;
@@ -237,6 +245,25 @@ u64 device_execute_interface::total_cycles() const noexcept
 }
 
 
+//-------------------------------------------------
+//  enable_coverage - start recording the PCs
+//  passed to the instruction hook
+//-------------------------------------------------
+
+void device_execute_interface::enable_coverage()
+{
+	if (m_coverage)
+		return;
+
+	// size the page table from the program space where there is one
+	offs_t addrmask = ~offs_t(0);
+	device_memory_interface *memory;
+	if (device().interface(memory) && memory->has_space(AS_PROGRAM))
+		addrmask = memory->space(AS_PROGRAM).logaddrmask();
+	m_coverage = std::make_unique<coverage_map>(addrmask);
+}
+
+
 //-------------------------------------------------
 //  execute_clocks_to_cycles - convert the number
 //  of clocks to cycles, rounding down if necessary
@@ -341,6 +368,21 @@ void device_execute_interface::interface_validity_check(validity_checker &valid)
 }
 
 
+//-------------------------------------------------
+//  idle_loop_found - a reported loop has gone
+//  round without changing anything, so eat the
+//  rest of the timeslice as if it had kept going
+//-------------------------------------------------
+
+void device_execute_interface::idle_loop_found() noexcept
+{
+	if (!executing() || (*m_icountptr <= 0))
+		return;
+
+	m_stats.idle_skips++;
+	*m_icountptr = 0;
+}
+
 //-------------------------------------------------
 //  interface_pre_start - work to be done prior to
 //  actually starting a device
@@ -360,6 +402,7 @@ void device_execute_interface::interface_pre_start()
 	m_suspend = SUSPEND_REASON_RESET;
 	m_profiler = profile_type(index + PROFILER_DEVICE_FIRST);
 	m_inttrigger = index + TRIGGER_INT;
+	m_idle_detect = device().machine().options().idle_skip();
 
 	// allocate a timed-interrupt timer if we need it
 	if (m_timed_interrupt_period != attotime::zero)
@@ -423,6 +466,18 @@ void device_execute_interface::interface_pre_reset()
 }
 
 
+//-------------------------------------------------
+//  interface_pre_save - deliver input line changes
+//  that haven't been reached yet, since they
+//  aren't saved
+//-------------------------------------------------
+
+void device_execute_interface::interface_pre_save()
+{
+	deliver_deferred_inputs(attotime::never);
+}
+
+
 //-------------------------------------------------
 //  interface_post_reset - work to be done after a
 //  device is reset
@@ -603,6 +658,56 @@ void device_execute_interface::pulse_input_line(int irqline, const attotime &dur
 }
 
 
+//-------------------------------------------------
+//  defer_input - hold an input line change for
+//  the scheduler to deliver when this device
+//  reaches the time it was made, rather than
+//  synchronising everything to it
+//-------------------------------------------------
+
+bool device_execute_interface::defer_input(int linenum, s32 event) noexcept
+{
+	// reset and halt change whether the device runs at all, so they have to go through a timer
+	if ((linenum == INPUT_LINE_RESET) || (linenum == INPUT_LINE_HALT) || (m_deferred_inputs >= std::size(m_deferred_input)))
+		return false;
+
+	// the scheduler has to be certain to run this device before the timeslice ends
+	if (!m_scheduler->will_execute(*this))
+		return false;
+
+	// devices that ran earlier in the timeslice can be ahead of later ones, so keep them in time order
+	attotime const curtime = m_scheduler->time();
+	unsigned index = m_deferred_inputs++;
+	for ( ; index && (m_deferred_input[index - 1].m_time > curtime); index--)
+		m_deferred_input[index] = m_deferred_input[index - 1];
+	m_deferred_input[index].m_time = curtime;
+	m_deferred_input[index].m_linenum = linenum;
+	m_deferred_input[index].m_event = event;
+
+	// if this device made the change itself, it needs to stop to see it
+	abort_timeslice();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  deliver_deferred_inputs - apply held input
+//  line changes made up to the given time
+//-------------------------------------------------
+
+void device_execute_interface::deliver_deferred_inputs(const attotime &until)
+{
+	// applying a change may hold another one, so take them off the front one at a time
+	while (m_deferred_inputs && (m_deferred_input[0].m_time <= until))
+	{
+		deferred_input const input = m_deferred_input[0];
+		std::copy(&m_deferred_input[1], &m_deferred_input[m_deferred_inputs], &m_deferred_input[0]);
+		m_deferred_inputs--;
+		m_input[input.m_linenum].apply_event(input.m_event);
+	}
+}
+
+
 
 //**************************************************************************
 //  DEVICE INPUT
@@ -660,6 +765,10 @@ void device_execute_interface::device_input::set_state_synced(int state, int vec
 	if (TEMPLOG) printf("setline(%s,%d,%d,%d)\n", m_execute->device().tag(), m_linenum, state, (vector == USE_STORED_VECTOR) ? 0 : vector);
 	assert(state == ASSERT_LINE || state == HOLD_LINE || state == CLEAR_LINE);
 
+	// if nothing is queued and the device hasn't reached this time yet, it can pick the change up as it gets here
+	if (!m_qindex && m_execute->defer_input(m_linenum, (state & 0xff) | (((vector == USE_STORED_VECTOR) ? m_stored_vector : vector) << 8)))
+		return;
+
 	// if we're full of events, flush the queue and log a message
 	int event_index = m_qindex++;
 	if (event_index >= std::size(m_queue))
@@ -694,72 +803,79 @@ TIMER_CALLBACK_MEMBER(device_execute_interface::device_input::empty_event_queue)
 
 	// loop over all events
 	for (int curevent = 0; curevent < m_qindex; curevent++)
-	{
-		s32 input_event = m_queue[curevent];
+		apply_event(m_queue[curevent]);
 
-		// set the input line state and vector
-		m_curstate = input_event & 0xff;
-		m_curvector = input_event >> 8;
-		if (TEMPLOG) printf(" (%d,%d)\n", m_curstate, m_curvector);
+	// reset counter
+	m_qindex = 0;
+}
 
-		assert(m_curstate == ASSERT_LINE || m_curstate == HOLD_LINE || m_curstate == CLEAR_LINE);
 
-		// special case: RESET
-		if (m_linenum == INPUT_LINE_RESET)
+//-------------------------------------------------
+//  apply_event - make a queued change to the
+//  input line
+//-------------------------------------------------
+
+void device_execute_interface::device_input::apply_event(s32 input_event)
+{
+	// set the input line state and vector
+	m_curstate = input_event & 0xff;
+	m_curvector = input_event >> 8;
+	if (TEMPLOG) printf(" (%d,%d)\n", m_curstate, m_curvector);
+
+	assert(m_curstate == ASSERT_LINE || m_curstate == HOLD_LINE || m_curstate == CLEAR_LINE);
+
+	// special case: RESET
+	if (m_linenum == INPUT_LINE_RESET)
+	{
+		// if we're asserting the line, just halt the device
+		// FIXME: outputs of onboard peripherals also need to be deactivated at this time
+		if (m_curstate == ASSERT_LINE)
+			m_execute->suspend(SUSPEND_REASON_RESET, true);
+
+		// if we're clearing the line that was previously asserted, reset the device
+		else if (m_execute->suspended(SUSPEND_REASON_RESET))
 		{
-			// if we're asserting the line, just halt the device
-			// FIXME: outputs of onboard peripherals also need to be deactivated at this time
-			if (m_curstate == ASSERT_LINE)
-				m_execute->suspend(SUSPEND_REASON_RESET, true);
-
-			// if we're clearing the line that was previously asserted, reset the device
-			else if (m_execute->suspended(SUSPEND_REASON_RESET))
-			{
-				m_execute->device().reset();
-				m_execute->resume(SUSPEND_REASON_RESET);
-			}
+			m_execute->device().reset();
+			m_execute->resume(SUSPEND_REASON_RESET);
 		}
+	}
 
-		// special case: HALT
-		else if (m_linenum == INPUT_LINE_HALT)
-		{
-			// if asserting, halt the device
-			if (m_curstate == ASSERT_LINE)
-				m_execute->suspend(SUSPEND_REASON_HALT, true);
+	// special case: HALT
+	else if (m_linenum == INPUT_LINE_HALT)
+	{
+		// if asserting, halt the device
+		if (m_curstate == ASSERT_LINE)
+			m_execute->suspend(SUSPEND_REASON_HALT, true);
 
-			// if clearing, unhalt the device
-			else if (m_curstate == CLEAR_LINE)
-				m_execute->resume(SUSPEND_REASON_HALT);
-		}
+		// if clearing, unhalt the device
+		else if (m_curstate == CLEAR_LINE)
+			m_execute->resume(SUSPEND_REASON_HALT);
+	}
 
-		// all other cases
-		else
+	// all other cases
+	else
+	{
+		// switch off the requested state
+		switch (m_curstate)
 		{
-			// switch off the requested state
-			switch (m_curstate)
-			{
-				case HOLD_LINE:
-				case ASSERT_LINE:
-					m_execute->execute_set_input(m_linenum, ASSERT_LINE);
-					break;
-
-				case CLEAR_LINE:
-					m_execute->execute_set_input(m_linenum, CLEAR_LINE);
-					break;
-
-				default:
-					m_execute->device().logerror("empty_event_queue device '%s', line %d, unknown state %d\n", m_execute->device().tag(), m_linenum, m_curstate);
-					break;
-			}
-
-			// generate a trigger to unsuspend any devices waiting on the interrupt
-			if (m_curstate != CLEAR_LINE)
-				m_execute->signal_interrupt_trigger();
+			case HOLD_LINE:
+			case ASSERT_LINE:
+				m_execute->execute_set_input(m_linenum, ASSERT_LINE);
+				break;
+
+			case CLEAR_LINE:
+				m_execute->execute_set_input(m_linenum, CLEAR_LINE);
+				break;
+
+			default:
+				m_execute->device().logerror("empty_event_queue device '%s', line %d, unknown state %d\n", m_execute->device().tag(), m_linenum, m_curstate);
+				break;
 		}
-	}
 
-	// reset counter
-	m_qindex = 0;
+		// generate a trigger to unsuspend any devices waiting on the interrupt
+		if (m_curstate != CLEAR_LINE)
+			m_execute->signal_interrupt_trigger();
+	}
 }
 
 
@@ -781,3 +897,59 @@ int device_execute_interface::device_input::default_irq_callback()
 	}
 	return vector;
 }
+
+
+
+//**************************************************************************
+//  COVERAGE MAP
+//**************************************************************************
+
+//-------------------------------------------------
+//  coverage_map - constructor
+//-------------------------------------------------
+
+device_execute_interface::coverage_map::coverage_map(offs_t addrmask)
+	: m_pages((addrmask >> PAGE_SHIFT) + 1)
+	, m_pagemask(addrmask >> PAGE_SHIFT)
+{
+}
+
+
+//-------------------------------------------------
+//  mark_new_page - allocate the page for a PC
+//  seen for the first time and mark it
+//-------------------------------------------------
+
+void device_execute_interface::coverage_map::mark_new_page(offs_t pc)
+{
+	std::unique_ptr<u64 []> &page = m_pages[(pc >> PAGE_SHIFT) & m_pagemask];
+	page = std::make_unique<u64 []>(PAGE_WORDS);
+	std::fill_n(page.get(), PAGE_WORDS, 0);
+	mark(pc);
+}
+
+
+//-------------------------------------------------
+//  count - number of distinct PCs executed
+//-------------------------------------------------
+
+u64 device_execute_interface::coverage_map::count() const
+{
+	u64 result = 0;
+	for (auto const &page : m_pages)
+		if (page)
+			for (unsigned word = 0; word < PAGE_WORDS; word++)
+				result += population_count_64(page[word]);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  clear - forget everything executed so far
+//-------------------------------------------------
+
+void device_execute_interface::coverage_map::clear()
+{
+	for (auto &page : m_pages)
+		page.reset();
+}
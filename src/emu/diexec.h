@@ -97,12 +97,54 @@ class device_execute_interface : public device_interface
 	friend class testcpu_state;
 
 public:
+	// execution statistics, always collected by the scheduler
+	struct execute_stats
+	{
+		u64 cycles = 0;             // cycles actually executed
+		u64 timeslices = 0;         // number of times the device was run
+		u64 aborted = 0;            // timeslices cut short by abort_timeslice
+		u64 wall_ticks = 0;         // host osd_ticks spent executing (only if enabled in the scheduler)
+		u64 quantum_boosts = 0;     // add_quantum/perfect_quantum requests made while executing
+		u64 idle_skips = 0;         // timeslices given up in a detected idle loop
+	};
+
+	// sparse bitmap of executed PCs, one bit per address, in pages allocated on first use
+	class coverage_map
+	{
+	public:
+		static constexpr unsigned PAGE_SHIFT = 16;                  // addresses covered by a page, as a power of 2
+		static constexpr unsigned PAGE_WORDS = (1 << PAGE_SHIFT) / 64;
+
+		coverage_map(offs_t addrmask);
+
+		void mark(offs_t pc)
+		{
+			u64 *const page = m_pages[(pc >> PAGE_SHIFT) & m_pagemask].get();
+			if (page)
+				page[(pc >> 6) & (PAGE_WORDS - 1)] |= u64(1) << (pc & 63);
+			else
+				mark_new_page(pc);
+		}
+
+		offs_t page_count() const { return m_pages.size(); }
+		const u64 *page(offs_t index) const { return m_pages[index].get(); }
+		u64 count() const;
+		void clear();
+
+	private:
+		void mark_new_page(offs_t pc);
+
+		std::vector<std::unique_ptr<u64 []>> m_pages;   // bitmap pages, null until an address in them executes
+		offs_t                  m_pagemask;             // mask applied to page indices
+	};
+
 	// construction/destruction
 	device_execute_interface(const machine_config &mconfig, device_t &device);
 	virtual ~device_execute_interface();
 
 	// configuration access
 	bool disabled() const { return m_disabled; }
+	u32 execution_group() const { return m_execution_group; }
 	u64 clocks_to_cycles(u64 clocks) const { return execute_clocks_to_cycles(clocks); }
 	u64 cycles_to_clocks(u64 cycles) const { return execute_cycles_to_clocks(cycles); }
 	u32 min_cycles() const { return execute_min_cycles(); }
@@ -114,6 +156,7 @@ public:
 
 	// inline configuration helpers
 	void set_disable() { m_disabled = true; }
+	void set_execution_group(u32 group) { m_execution_group = group; }
 
 	template <typename... T> void set_vblank_int(const char *tag, T &&... args)
 	{
@@ -184,6 +227,28 @@ public:
 	// time and cycle accounting
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
+	const execute_stats &stats() const noexcept { return m_stats; }
+
+	// execution coverage, only collected once enabled
+	void enable_coverage();
+	coverage_map *coverage() const noexcept { return m_coverage.get(); }
+
+	// idle loop detection (-idleskip): cores report taken short backward
+	// branches with a digest of their registers, and anything with an
+	// effect outside the core (memory or I/O writes, taking interrupts);
+	// a loop iteration that leaves the registers as they were and has no
+	// such effect will repeat until something else changes memory, so the
+	// rest of the timeslice is skipped
+	bool idle_detection() const noexcept { return m_idle_detect; }
+	void idle_loop_branch(offs_t pc, u64 state) noexcept
+	{
+		if (m_idle_clean && (pc == m_idle_pc) && (state == m_idle_state))
+			idle_loop_found();
+		m_idle_pc = pc;
+		m_idle_state = state;
+		m_idle_clean = true;
+	}
+	void idle_loop_side_effect() noexcept { m_idle_clean = false; }
 
 	// required operation overrides
 	void run() { execute_run(); }
@@ -213,6 +278,7 @@ protected:
 	virtual void interface_post_start() override;
 	virtual void interface_pre_reset() override;
 	virtual void interface_post_reset() override;
+	virtual void interface_pre_save() override;
 	virtual void interface_clock_changed(bool sync_on_new_clock_domain) override;
 
 	// for use by devcpu for now...
@@ -224,8 +290,14 @@ protected:
 	bool debugger_enabled() const { return bool(device().machine().debug_flags & DEBUG_FLAG_ENABLED); }
 	void debugger_instruction_hook(offs_t curpc)
 	{
-		if (device().machine().debug_flags & DEBUG_FLAG_CALL_HOOK)
-			device().debug()->instruction_hook(curpc);
+		int const flags = device().machine().debug_flags;
+		if (flags & (DEBUG_FLAG_CALL_HOOK | DEBUG_FLAG_COVERAGE))
+		{
+			if (m_coverage)
+				m_coverage->mark(curpc);
+			if (flags & DEBUG_FLAG_CALL_HOOK)
+				device().debug()->instruction_hook(curpc);
+		}
 	}
 	void debugger_exception_hook(int exception)
 	{
@@ -260,6 +332,7 @@ private:
 		void set_state_synced(int state, int vector = USE_STORED_VECTOR);
 		void set_vector(int vector) { m_stored_vector = vector; }
 		int default_irq_callback();
+		void apply_event(s32 input_event);
 
 		device_execute_interface *m_execute;// pointer to the execute interface
 		int             m_linenum;          // which input line we are
@@ -291,6 +364,7 @@ private:
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	u32                     m_execution_group;          // group for parallel execution (0 = main thread)
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -304,6 +378,16 @@ private:
 	device_input            m_input[MAX_INPUT_LINES];   // data about inputs
 	emu_timer *             m_timedint_timer;           // reference to this device's periodic interrupt timer
 
+	// input line changes made ahead of this device's local time, in time order
+	struct deferred_input
+	{
+		attotime    m_time;                                 // time the change was made
+		int         m_linenum;                              // line it was made to
+		s32         m_event;                                // state and vector, as queued by device_input
+	};
+	deferred_input          m_deferred_input[16];
+	u8                      m_deferred_inputs;          // number of entries in use
+
 	// cycle counting and executing
 	profile_type            m_profiler;                 // profiler tag
 protected:  // TODO: decide whether to bring up the wait-state methods
@@ -327,6 +411,14 @@ private:
 	u8                      m_divshift;                 // right shift amount to fit the divisor into 32 bits
 	u32                     m_cycles_per_second;        // cycles per second, adjusted for multipliers
 	attoseconds_t           m_attoseconds_per_cycle;    // attoseconds per adjusted clock cycle
+	execute_stats           m_stats;                    // execution statistics
+	std::unique_ptr<coverage_map> m_coverage;           // executed PCs, if collecting coverage
+
+	// idle loop detection
+	bool                    m_idle_detect;              // true if -idleskip is on
+	bool                    m_idle_clean;               // no side effects since the last reported branch
+	offs_t                  m_idle_pc;                  // PC of the last reported branch
+	u64                     m_idle_state;               // register digest at the last reported branch
 
 	emu_timer *             m_spin_end_timer;           // timer for triggering the end of spin_until_time
 	emu_timer *             m_pulse_end_timers[MAX_INPUT_LINES]; // timer for ending input-line pulses
@@ -339,6 +431,9 @@ private:
 	TIMER_CALLBACK_MEMBER(trigger_periodic_interrupt);
 	TIMER_CALLBACK_MEMBER(irq_pulse_clear) { set_input_line(int(param), CLEAR_LINE); }
 	void suspend_resume_changed();
+	void idle_loop_found() noexcept;
+	bool defer_input(int linenum, s32 event) noexcept;
+	void deliver_deferred_inputs(const attotime &until);
 
 	attoseconds_t minimum_quantum() const;
 
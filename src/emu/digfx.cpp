@@ -9,8 +9,11 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "fileio.h"
 #include "validity.h"
 
+#include "corestr.h"
+
 
 //**************************************************************************
 //  DEVICE GFX INTERFACE
@@ -32,7 +35,10 @@ device_gfx_interface::device_gfx_interface(
 	m_palette(*this, palette_tag),
 	m_gfxdecodeinfo(gfxinfo),
 	m_palette_is_disabled(false),
-	m_decoded(false)
+	m_decoded(false),
+	m_cache_mask(0),
+	m_cache_checked(false),
+	m_cache_current(false)
 {
 }
 
@@ -95,6 +101,8 @@ void device_gfx_interface::interface_post_start()
 {
 	if (!m_decoded)
 		decode_gfx(m_gfxdecodeinfo);
+
+	device().machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_gfx_interface::cache_exit, this));
 }
 
 
@@ -116,6 +124,135 @@ void device_gfx_interface::interface_post_load()
 }
 
 
+//-------------------------------------------------
+//  interface_post_reset - pick up the decoded
+//  cache on the first reset, once the driver has
+//  finished preparing its ROMs
+//-------------------------------------------------
+
+void device_gfx_interface::interface_post_reset()
+{
+	if (!m_cache_checked)
+	{
+		m_cache_checked = true;
+		if (m_cache_mask != 0 && device().machine().options().gfx_cache())
+			cache_load();
+	}
+}
+
+
+//-------------------------------------------------
+//  cache_filename - name of the decoded cache,
+//  stored beside the system's NVRAM files
+//-------------------------------------------------
+
+std::string device_gfx_interface::cache_filename() const
+{
+	std::string tag(device().tag());
+	tag.erase(0, 1);
+	strreplacechr(tag, ':', '_');
+	if (tag.empty())
+		tag = "root";
+	return util::string_format("%s" PATH_SEPARATOR "%s.gfx", device().machine().basename(), tag);
+}
+
+
+//-------------------------------------------------
+//  cache_load - load previously decoded ROM
+//  graphics; entries that no longer match the
+//  layout or the ROM contents are ignored
+//-------------------------------------------------
+
+void device_gfx_interface::cache_load()
+{
+	emu_file file(device().machine().options().nvram_directory(), OPEN_FLAG_READ);
+	if (file.open(cache_filename()))
+		return;
+
+	char magic[8];
+	u32 header[2];
+	if (file.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, "MAMEGFX", 8) != 0)
+		return;
+	if (file.read(header, sizeof(header)) != sizeof(header) || header[0] != CACHE_VERSION)
+		return;
+
+	// each entry is an index and a length followed by the element's own data
+	u32 loaded = 0;
+	for (u32 entry = 0; entry < header[1]; entry++)
+	{
+		u32 position[2];
+		if (file.read(position, sizeof(position)) != sizeof(position))
+			break;
+		u64 const next = file.tell() + position[1];
+
+		u32 key;
+		gfx_element *const gfx = (position[0] < MAX_GFX_ELEMENTS) ? m_gfx[position[0]].get() : nullptr;
+		if (gfx && BIT(m_cache_mask, position[0]) && gfx->cache_key(key) && gfx->read_decoded(file, key))
+			loaded |= u32(1) << position[0];
+		if (file.seek(next, SEEK_SET))
+			break;
+	}
+	m_cache_current = (loaded == m_cache_mask);
+}
+
+
+//-------------------------------------------------
+//  cache_exit - report decoding statistics, and
+//  write the decoded cache if it's incomplete or
+//  out of date
+//-------------------------------------------------
+
+void device_gfx_interface::cache_exit()
+{
+	for (int curgfx = 0; curgfx < MAX_GFX_ELEMENTS; curgfx++)
+	{
+		gfx_element *const gfx = m_gfx[curgfx].get();
+		if (gfx && (gfx->decode_count() != 0 || gfx->cached_count() != 0))
+			osd_printf_verbose("%s: gfx %d: %u elements decoded, %u loaded from cache\n", device().tag(), curgfx, gfx->decode_count(), gfx->cached_count());
+	}
+
+	if (m_cache_current || m_cache_mask == 0 || !device().machine().options().gfx_cache())
+		return;
+
+	emu_file file(device().machine().options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(cache_filename()))
+		return;
+
+	// write the header with a placeholder count
+	u32 header[2] = { CACHE_VERSION, 0 };
+	bool error = (file.write("MAMEGFX", 8) != 8) || (file.write(header, sizeof(header)) != sizeof(header));
+
+	// write each cacheable element, going back to fill in its length afterwards
+	for (int curgfx = 0; curgfx < MAX_GFX_ELEMENTS && !error; curgfx++)
+	{
+		u32 key;
+		gfx_element *const gfx = m_gfx[curgfx].get();
+		if (!gfx || !BIT(m_cache_mask, curgfx) || !gfx->cache_key(key))
+			continue;
+
+		u64 const start = file.tell();
+		u32 position[2] = { u32(curgfx), 0 };
+		error = (file.write(position, sizeof(position)) != sizeof(position)) || !gfx->write_decoded(file, key);
+		if (!error)
+		{
+			u64 const end = file.tell();
+			position[1] = u32(end - start - sizeof(position));
+			error = file.seek(start, SEEK_SET) || (file.write(position, sizeof(position)) != sizeof(position)) || file.seek(end, SEEK_SET);
+			header[1]++;
+		}
+	}
+
+	// fill in the count
+	if (!error)
+		error = file.seek(8, SEEK_SET) || (file.write(header, sizeof(header)) != sizeof(header));
+	if (error)
+	{
+		osd_printf_error("Error writing decoded graphics cache %s\n", file.filename());
+		file.remove_on_close();
+	}
+}
+
+
 //-------------------------------------------------
 //  decode_gfx - parse gfx decode info and
 //  create gfx elements
@@ -280,6 +417,10 @@ void device_gfx_interface::decode_gfx(const gfx_decode_entry *gfxdecodeinfo)
 			}
 		}
 
+		// only graphics decoded from ROM regions can be cached
+		if (gfx.memory_region != nullptr && !GFXENTRY_ISRAM(gfx.flags))
+			m_cache_mask |= u32(1) << curgfx;
+
 		// allocate the graphics
 		m_gfx[curgfx] = std::make_unique<gfx_element>(m_palette, glcopy, (region_base != nullptr) ? region_base + gfx.start : nullptr, xormask, gfx.total_color_codes, gfx.color_codes_start);
 	}
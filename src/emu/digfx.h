@@ -187,8 +187,16 @@ protected:
 	virtual void interface_pre_start() override;
 	virtual void interface_post_start() override;
 	virtual void interface_post_load() override;
+	virtual void interface_post_reset() override;
 
 private:
+	// decoded data cache
+	static constexpr u32 CACHE_VERSION = 1;
+
+	std::string cache_filename() const;
+	void cache_load();
+	void cache_exit();
+
 	optional_device<device_palette_interface> m_palette;   // configured tag for palette device
 	std::unique_ptr<gfx_element>  m_gfx[MAX_GFX_ELEMENTS]; // array of pointers to graphic sets
 
@@ -198,6 +206,9 @@ private:
 
 	// internal state
 	bool                        m_decoded;                 // have we processed our decode info yet?
+	u32                         m_cache_mask;              // gfx decoded from ROM regions
+	bool                        m_cache_checked;           // have we looked for a decoded cache yet?
+	bool                        m_cache_current;           // did the decoded cache cover every gfx?
 };
 
 // iterator
@@ -31,7 +31,8 @@ device_palette_interface::device_palette_interface(const machine_config &mconfig
 		m_shadow_group(0),
 		m_hilight_group(0),
 		m_white_pen(0),
-		m_black_pen(0)
+		m_black_pen(0),
+		m_pending(false)
 {
 }
 
@@ -161,6 +162,7 @@ void device_palette_interface::set_indirect_color(int index, rgb_t rgb)
 {
 	// make sure we are in range
 	assert(index < m_indirect_colors.size());
+	update_pending();
 
 	// alpha doesn't matter
 	rgb.set_a(255);
@@ -186,6 +188,7 @@ void device_palette_interface::set_pen_indirect(pen_t pen, indirect_pen_t index)
 {
 	// make sure we are in range
 	assert(pen < entries() && index < indirect_entries());
+	update_pending();
 
 	m_indirect_pens[pen] = index;
 
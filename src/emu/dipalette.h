@@ -45,31 +45,34 @@ public:
 	// getters
 	u32 entries() const noexcept { return palette_entries(); }
 	u32 indirect_entries() const noexcept { return palette_indirect_entries(); }
-	palette_t *palette() const { return m_palette; }
-	const pen_t &pen(int index) const { return m_pens[index]; }
-	const pen_t *pens() const { return m_pens; }
+	palette_t *palette() const { update_pending(); return m_palette; }
+	const pen_t &pen(int index) const { update_pending(); return m_pens[index]; }
+	const pen_t *pens() const { update_pending(); return m_pens; }
 	pen_t *shadow_table() const { return m_shadow_table; }
-	rgb_t pen_color(pen_t pen) const { return m_palette->entry_color(pen); }
-	double pen_contrast(pen_t pen) const { return m_palette->entry_contrast(pen); }
+	rgb_t pen_color(pen_t pen) const { update_pending(); return m_palette->entry_color(pen); }
+	double pen_contrast(pen_t pen) const { update_pending(); return m_palette->entry_contrast(pen); }
 	pen_t black_pen() const { return m_black_pen; }
 	pen_t white_pen() const { return m_white_pen; }
 	bool shadows_enabled() const noexcept { return palette_shadows_enabled(); }
 	bool hilights_enabled() const noexcept { return palette_hilights_enabled(); }
 
 	// setters
-	void set_pen_color(pen_t pen, rgb_t rgb) { m_palette->entry_set_color(pen, rgb); }
-	void set_pen_red_level(pen_t pen, u8 level) { m_palette->entry_set_red_level(pen, level); }
-	void set_pen_green_level(pen_t pen, u8 level) { m_palette->entry_set_green_level(pen, level); }
-	void set_pen_blue_level(pen_t pen, u8 level) { m_palette->entry_set_blue_level(pen, level); }
-	void set_pen_color(pen_t pen, u8 r, u8 g, u8 b) { m_palette->entry_set_color(pen, rgb_t(r, g, b)); }
+	void set_pen_color(pen_t pen, rgb_t rgb) { update_pending(); m_palette->entry_set_color(pen, rgb); }
+	void set_pen_red_level(pen_t pen, u8 level) { update_pending(); m_palette->entry_set_red_level(pen, level); }
+	void set_pen_green_level(pen_t pen, u8 level) { update_pending(); m_palette->entry_set_green_level(pen, level); }
+	void set_pen_blue_level(pen_t pen, u8 level) { update_pending(); m_palette->entry_set_blue_level(pen, level); }
+	void set_pen_color(pen_t pen, u8 r, u8 g, u8 b) { set_pen_color(pen, rgb_t(r, g, b)); }
 	void set_pen_colors(pen_t color_base, const rgb_t *colors, int color_count) { while (color_count--) set_pen_color(color_base++, *colors++); }
 	template <size_t N> void set_pen_colors(pen_t color_base, const rgb_t (&colors)[N]) { set_pen_colors(color_base, colors, N); }
 	void set_pen_colors(pen_t color_base, const std::vector<rgb_t> &colors) { for (unsigned int i=0; i != colors.size(); i++) set_pen_color(color_base+i, colors[i]); }
-	void set_pen_contrast(pen_t pen, double bright) { m_palette->entry_set_contrast(pen, bright); }
+	void set_pen_contrast(pen_t pen, double bright) { update_pending(); m_palette->entry_set_contrast(pen, bright); }
+
+	// deferred changes
+	void update_pending() const { if (UNEXPECTED(m_pending)) { m_pending = false; const_cast<device_palette_interface *>(this)->palette_update_pending(); } }
 
 	// indirection (aka colortables)
 	indirect_pen_t pen_indirect(int index) const { return m_indirect_pens[index]; }
-	rgb_t indirect_color(int index) const { return m_indirect_colors[index]; }
+	rgb_t indirect_color(int index) const { update_pending(); return m_indirect_colors[index]; }
 	void set_indirect_color(int index, rgb_t rgb);
 	void set_pen_indirect(pen_t pen, indirect_pen_t index);
 	u32 transpen_mask(gfx_element &gfx, u32 color, indirect_pen_t transcolor) const;
@@ -97,6 +100,11 @@ protected:
 	virtual bool palette_shadows_enabled() const noexcept { return false; }
 	virtual bool palette_hilights_enabled() const noexcept { return false; }
 
+	// deferred changes: set_pending() asks for palette_update_pending() to be
+	// called before the colors are next looked at or changed
+	void set_pending() noexcept { m_pending = true; }
+	virtual void palette_update_pending() { }
+
 private:
 	// internal helpers
 	void allocate_palette(u32 numentries);
@@ -116,6 +124,7 @@ private:
 	u32                 m_hilight_group;        // index of the hilight group, or 0 if none
 	pen_t               m_white_pen;            // precomputed white pen value
 	pen_t               m_black_pen;            // precomputed black pen value
+	mutable bool        m_pending;              // true if palette_update_pending() has work to do
 
 	// indirection state
 	std::vector<rgb_t> m_indirect_colors;          // actual colors set for indirection
@@ -11,6 +11,8 @@
 #include "emu.h"
 #include "divtlb.h"
 
+#include <algorithm>
+
 
 
 //**************************************************************************
@@ -37,7 +39,8 @@ device_vtlb_interface::device_vtlb_interface(const machine_config &mconfig, devi
 		m_dynindex(0),
 		m_pageshift(0),
 		m_addrwidth(0),
-		m_table_base(nullptr)
+		m_table_base(nullptr),
+		m_tagclock(0)
 {
 }
 
@@ -104,6 +107,8 @@ void device_vtlb_interface::interface_pre_start()
 		m_fixedpages.resize(m_fixed);
 		memset(&m_fixedpages[0], 0, m_fixed*sizeof(m_fixedpages[0]));
 	}
+
+	m_tagged.resize(m_dynamic ? TAGGED_SETS : 0);
 }
 
 
@@ -133,6 +138,17 @@ void device_vtlb_interface::interface_pre_reset()
 }
 
 
+//-------------------------------------------------
+//  interface_post_load - the entries set aside
+//  aren't saved, so drop them
+//-------------------------------------------------
+
+void device_vtlb_interface::interface_post_load()
+{
+	flush_tagged();
+}
+
+
 //**************************************************************************
 //  FILLING
 //**************************************************************************
@@ -166,22 +182,7 @@ bool device_vtlb_interface::vtlb_fill(offs_t address, offs_t taddress, int inten
 	// if this is the first successful translation for this address, allocate a new entry
 	if ((entry & FLAGS_MASK) == 0)
 	{
-		int liveindex = m_dynindex;
-
-		m_dynindex = (m_dynindex + 1) % m_dynamic;
-
-		// if an entry already exists at this index, free it
-		if (m_live[liveindex] != 0)
-		{
-			if (m_refcnt[m_live[liveindex] - 1] <= 1)
-				m_table[m_live[liveindex] - 1] = 0;
-			else
-				m_refcnt[m_live[liveindex] - 1]--;
-		}
-
-
-		// claim this new entry
-		m_live[liveindex] = tableindex + 1;
+		dynamic_claim(tableindex);
 
 		// form a new blank entry
 		entry = (taddress >> m_pageshift) << m_pageshift;
@@ -210,6 +211,32 @@ bool device_vtlb_interface::vtlb_fill(offs_t address, offs_t taddress, int inten
 }
 
 
+//-------------------------------------------------
+//  dynamic_claim - take the next dynamic entry
+//  for a table index, freeing what it held
+//-------------------------------------------------
+
+int device_vtlb_interface::dynamic_claim(offs_t tableindex)
+{
+	int liveindex = m_dynindex;
+
+	m_dynindex = (m_dynindex + 1) % m_dynamic;
+
+	// if an entry already exists at this index, free it
+	if (m_live[liveindex] != 0)
+	{
+		if (m_refcnt[m_live[liveindex] - 1] <= 1)
+			m_table[m_live[liveindex] - 1] = 0;
+		else
+			m_refcnt[m_live[liveindex] - 1]--;
+	}
+
+	// claim this new entry
+	m_live[liveindex] = tableindex + 1;
+	return liveindex;
+}
+
+
 //-------------------------------------------------
 //  vtlb_load - load a fixed VTLB entry
 //-------------------------------------------------
@@ -314,6 +341,9 @@ void device_vtlb_interface::vtlb_flush_dynamic()
 			m_table[tableindex] = 0;
 			m_live[liveindex] = 0;
 		}
+
+	// nothing set aside is valid any more either
+	flush_tagged();
 }
 
 
@@ -332,6 +362,115 @@ void device_vtlb_interface::vtlb_flush_address(offs_t address)
 
 	// free the entry in the table; for speed, we leave the entry in the live array
 	m_table[tableindex] = 0;
+
+	// the address may be set aside under another tag too
+	for (tagged_set &set : m_tagged)
+	{
+		if (set.used && (tableindex >= set.start) && (tableindex <= set.end))
+		{
+			auto const found = std::find_if(set.entries.begin(), set.entries.end(), [tableindex] (auto const &e) { return e.first == tableindex; });
+			if (found != set.entries.end())
+			{
+				*found = set.entries.back();
+				set.entries.pop_back();
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  vtlb_retag_range - the translation of a range
+//  of addresses now depends on a different tag;
+//  set aside the dynamic entries filled under
+//  the old tag, and bring back any kept for the
+//  new one
+//-------------------------------------------------
+
+void device_vtlb_interface::vtlb_retag_range(offs_t start, offs_t end, u32 oldtag, u32 newtag)
+{
+	offs_t const first = start >> m_pageshift;
+	offs_t const last = end >> m_pageshift;
+
+#if PRINTF_TLB
+	osd_printf_debug("vtlb_retag_range %08X-%08X %X->%X\n", start, end, oldtag, newtag);
+#endif
+
+	if ((m_dynamic == 0) || (oldtag == newtag))
+		return;
+
+	// find the entries kept for the new tag, and a set to keep the old entries in - the one
+	// already holding the old tag, or the least recently used
+	tagged_set *restore = nullptr;
+	tagged_set *store = nullptr;
+	for (tagged_set &set : m_tagged)
+	{
+		if (set.used && (set.start == first) && (set.end == last) && (set.tag == newtag))
+			restore = &set;
+	}
+	for (tagged_set &set : m_tagged)
+	{
+		if (&set == restore)
+			continue;
+		if (set.used && (set.start == first) && (set.end == last) && (set.tag == oldtag))
+		{
+			store = &set;
+			break;
+		}
+		if (!store || (set.used < store->used))
+			store = &set;
+	}
+	store->start = first;
+	store->end = last;
+	store->tag = oldtag;
+	store->used = ++m_tagclock;
+	store->entries.clear();
+
+	// move the live dynamic entries in the range to it
+	for (int liveindex = 0; liveindex < m_dynamic; liveindex++)
+	{
+		offs_t const live = m_live[liveindex];
+		if ((live != 0) && ((live - 1) >= first) && ((live - 1) <= last))
+		{
+			vtlb_entry const entry = m_table[live - 1];
+			if ((entry & (FLAG_VALID | FLAG_FIXED)) == FLAG_VALID)
+			{
+				store->entries.emplace_back(live - 1, entry);
+				m_table[live - 1] = 0;
+			}
+			m_live[liveindex] = 0;
+		}
+	}
+
+	// bring back the entries kept for the new tag, unless something's been loaded over them
+	if (restore)
+	{
+		for (auto const &e : restore->entries)
+		{
+			if ((m_table[e.first] & FLAGS_MASK) == 0)
+			{
+				dynamic_claim(e.first);
+				m_table[e.first] = e.second;
+			}
+		}
+		restore->used = 0;
+		restore->entries.clear();
+	}
+}
+
+
+//-------------------------------------------------
+//  flush_tagged - forget all the entries set
+//  aside
+//-------------------------------------------------
+
+void device_vtlb_interface::flush_tagged()
+{
+	for (tagged_set &set : m_tagged)
+	{
+		set.used = 0;
+		set.entries.clear();
+	}
 }
 
 
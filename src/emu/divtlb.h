@@ -6,6 +6,12 @@
 
     Generic virtual TLB implementation.
 
+    Lookups go through a flat table indexed by page, which recompiled
+    code reads directly.  Where translation of an address range depends
+    on a tag the CPU can switch (such as a segment register), the
+    dynamic entries for the range can be set aside when the tag changes
+    and brought back when it changes back, rather than refilled.
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_DIVTLB_H
@@ -13,6 +19,10 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
+
 class device_vtlb_interface : public device_interface
 {
 public:
@@ -58,6 +68,7 @@ public:
 	// flushing
 	void vtlb_flush_dynamic();
 	void vtlb_flush_address(offs_t address);
+	void vtlb_retag_range(offs_t start, offs_t end, u32 oldtag, u32 newtag);
 
 	// accessors
 	const vtlb_entry *vtlb_table() const;
@@ -68,8 +79,24 @@ protected:
 	virtual void interface_pre_start() override;
 	virtual void interface_post_start() override;
 	virtual void interface_pre_reset() override;
+	virtual void interface_post_load() override;
 
 private:
+	// number of address range/tag pairs whose dynamic entries are kept
+	static constexpr unsigned TAGGED_SETS = 32;
+
+	// dynamic entries set aside while their range had another tag
+	struct tagged_set
+	{
+		offs_t  start = 0, end = 0;     // table index range
+		u32     tag = 0;
+		u64     used = 0;               // when last stored, 0 if free
+		std::vector<std::pair<offs_t, vtlb_entry> > entries;
+	};
+
+	int dynamic_claim(offs_t tableindex);
+	void flush_tagged();
+
 	// private state
 	int    m_space;            // address space
 	int                 m_dynamic;          // number of dynamic entries
@@ -82,6 +109,8 @@ private:
 	std::vector<vtlb_entry> m_table;        // table of entries by address
 	std::vector<offs_t> m_refcnt;           // table of entry reference counts by address
 	vtlb_entry          *m_table_base;      // pointer to m_table[0]
+	std::vector<tagged_set> m_tagged;       // entries kept for other tags
+	u64                 m_tagclock;         // stamp for picking a set to reuse
 };
 
 
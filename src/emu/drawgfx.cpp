@@ -11,6 +11,8 @@
 #include "emu.h"
 #include "drawgfxt.ipp"
 
+#include "fileio.h"
+
 
 /***************************************************************************
     INLINE FUNCTIONS
@@ -95,7 +97,9 @@ gfx_element::gfx_element(device_palette_interface *palette, u8 *base, u16 width,
 	m_layout_is_raw(true),
 	m_layout_planes(0),
 	m_layout_xormask(0),
-	m_layout_charincrement(0)
+	m_layout_charincrement(0),
+	m_decode_count(0),
+	m_cached_count(0)
 {
 }
 
@@ -120,7 +124,9 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 	m_layout_is_raw(false),
 	m_layout_planes(0),
 	m_layout_xormask(xormask),
-	m_layout_charincrement(0)
+	m_layout_charincrement(0),
+	m_decode_count(0),
+	m_cached_count(0)
 {
 	// set the layout
 	set_layout(gl, srcdata);
@@ -334,6 +340,93 @@ void gfx_element::decode(u32 code)
 
 	// no longer dirty
 	m_dirty[code] = 0;
+	m_decode_count++;
+	g_profiler.count(PROFILER_COUNTER_GFX_DECODED);
+}
+
+
+//-------------------------------------------------
+//  cache_key - compute a key identifying the
+//  decoded data from the layout and the source
+//  bytes it reads; returns false for elements
+//  that can't be cached
+//-------------------------------------------------
+
+bool gfx_element::cache_key(u32 &key) const
+{
+	// raw layouts aren't decoded, and there has to be something to decode
+	if (m_layout_is_raw || !m_srcdata || !m_total_elements || !m_origwidth || !m_origheight)
+		return false;
+
+	// find the last source bit the layout can reach
+	u64 const lastbit =
+			(u64(m_total_elements - 1) * m_layout_charincrement +
+			*std::max_element(m_layout_planeoffset.begin(), m_layout_planeoffset.end()) +
+			*std::max_element(m_layout_yoffset.begin(), m_layout_yoffset.end()) +
+			*std::max_element(m_layout_xoffset.begin(), m_layout_xoffset.end())) | m_layout_xormask;
+	if (lastbit >= (u64(1) << 35))
+		return false;
+
+	util::crc32_creator crc;
+	u32 const geometry[] = { m_origwidth, m_origheight, m_total_elements, m_layout_planes, m_layout_charincrement, m_layout_xormask, m_char_modulo, u32(m_pen_usage.size()) };
+	crc.append(geometry, sizeof(geometry));
+	crc.append(&m_layout_planeoffset[0], m_layout_planeoffset.size() * sizeof(u32));
+	crc.append(&m_layout_xoffset[0], m_layout_xoffset.size() * sizeof(u32));
+	crc.append(&m_layout_yoffset[0], m_layout_yoffset.size() * sizeof(u32));
+	crc.append(m_srcdata, u32(lastbit / 8 + 1));
+	key = crc.finish();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  read_decoded - load decoded data written by
+//  write_decoded, if it was made from the same
+//  layout and source data
+//-------------------------------------------------
+
+bool gfx_element::read_decoded(emu_file &file, u32 key)
+{
+	u32 header[4];
+	if (file.read(header, sizeof(header)) != sizeof(header))
+		return false;
+	if (header[0] != key || header[1] != m_total_elements || header[2] != m_char_modulo || header[3] != m_pen_usage.size())
+		return false;
+
+	// elements stay dirty unless everything was read
+	u32 const datalength = m_total_elements * m_char_modulo;
+	u32 const usagelength = m_pen_usage.size() * sizeof(u32);
+	if (file.read(m_gfxdata, datalength) != datalength)
+		return false;
+	if (usagelength != 0 && file.read(&m_pen_usage[0], usagelength) != usagelength)
+		return false;
+	memset(&m_dirty[0], 0, m_total_elements);
+	m_cached_count += m_total_elements;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  write_decoded - decode everything and write
+//  it out for read_decoded
+//-------------------------------------------------
+
+bool gfx_element::write_decoded(emu_file &file, u32 key)
+{
+	for (u32 code = 0; code < m_total_elements; code++)
+		if (m_dirty[code])
+			decode(code);
+
+	u32 const header[4] = { key, m_total_elements, m_char_modulo, u32(m_pen_usage.size()) };
+	u32 const datalength = m_total_elements * m_char_modulo;
+	u32 const usagelength = m_pen_usage.size() * sizeof(u32);
+	if (file.write(header, sizeof(header)) != sizeof(header))
+		return false;
+	if (file.write(m_gfxdata, datalength) != datalength)
+		return false;
+	if (usagelength != 0 && file.write(&m_pen_usage[0], usagelength) != usagelength)
+		return false;
+	return true;
 }
 
 
@@ -393,7 +486,7 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_rebase_transpen_op{ trans_pen, color });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -420,7 +513,7 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_remap_transpen_op{ trans_pen, paldata });
 }
 
 
@@ -440,7 +533,7 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_rebase_transpen_op{ trans_pen, color });
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -934,7 +1027,7 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, drawgfx_rebase_transpen_priority_op{ pmask, trans_pen, color });
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -964,7 +1057,7 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, drawgfx_remap_transpen_priority_op{ pmask, trans_pen, paldata });
 }
 
 
@@ -987,7 +1080,7 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, drawgfx_rebase_transpen_priority_op{ pmask, trans_pen, color });
 }
 
 void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1931,12 +2024,12 @@ void primask_draw_scanline32(bitmap_rgb32 &bitmap, s32 destx, s32 desty, s32 len
 
 void copybitmap(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
 {
-	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [](u16 &destp, const u16 &srcp) { PIXEL_OP_COPY_OPAQUE(destp, srcp); });
+	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, copybitmap_opaque_op<u16>());
 }
 
 void copybitmap(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
 {
-	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [](u32 &destp, const u32 &srcp) { PIXEL_OP_COPY_OPAQUE(destp, srcp); });
+	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, copybitmap_opaque_op<u32>());
 }
 
 void prio_copybitmap(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, bitmap_ind8 &priority, u32 pmask)
@@ -1983,7 +2076,7 @@ void copybitmap_trans(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, in
 	if (trans_pen > 0xffff)
 		copybitmap(dest, src, flipx, flipy, destx, desty, cliprect);
 	else
-		copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [trans_pen](u16 &destp, const u16 &srcp) { PIXEL_OP_COPY_TRANSPEN(destp, srcp); });
+		copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, copybitmap_transpen_op<u16>{ trans_pen });
 }
 
 void copybitmap_trans(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, u32 trans_pen)
@@ -1991,7 +2084,7 @@ void copybitmap_trans(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, in
 	if (trans_pen == 0xffffffff)
 		copybitmap(dest, src, flipx, flipy, destx, desty, cliprect);
 	else
-		copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [trans_pen](u32 &destp, const u32 &srcp) { PIXEL_OP_COPY_TRANSPEN(destp, srcp); });
+		copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, copybitmap_transpen_op<u32>{ trans_pen });
 }
 
 void prio_copybitmap_trans(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, bitmap_ind8 &priority, u32 pmask, u32 trans_pen)
@@ -167,6 +167,7 @@ public:
 	u32 rowbytes() const { return m_line_modulo; }
 	bool has_pen_usage() const { return !m_pen_usage.empty(); }
 	bool has_palette() const { return m_palette; }
+	size_t decoded_bytes() const { return m_gfxdata_allocated.size() + m_dirty.size() + (m_pen_usage.size() * sizeof(u32)); }
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
@@ -201,6 +202,13 @@ public:
 		return m_pen_usage[code];
 	}
 
+	// decoded data caching
+	u32 decode_count() const { return m_decode_count; }
+	u32 cached_count() const { return m_cached_count; }
+	bool cache_key(u32 &key) const;
+	bool read_decoded(emu_file &file, u32 key);
+	bool write_decoded(emu_file &file, u32 key);
+
 	// ----- core graphics drawing -----
 
 	// core drawgfx implementation
@@ -317,6 +325,9 @@ private:
 	std::vector<u32>  m_layout_planeoffset;// plane offsets
 	std::vector<u32>  m_layout_xoffset; // X offsets
 	std::vector<u32>  m_layout_yoffset; // Y offsets
+
+	u32             m_decode_count;         // number of elements decoded
+	u32             m_cached_count;         // number of elements loaded from a decoded cache
 };
 
 
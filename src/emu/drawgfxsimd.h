@@ -0,0 +1,304 @@
+// license:BSD-3-Clause
+// copyright-holders:Nicola Salmoria, Aaron Giles
+/*********************************************************************
+
+    drawgfxsimd.h
+
+    Vectorized row kernels for the most common drawgfx operations.
+    Every kernel produces exactly the same result as the matching
+    PIXEL_OP_* macro in drawgfxt.ipp applied to each pixel in turn.
+
+*********************************************************************/
+
+#ifndef MAME_EMU_DRAWGFXSIMD_H
+#define MAME_EMU_DRAWGFXSIMD_H
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_DRAWGFX_SSE2 1
+#include <emmintrin.h>
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__)
+#define MAME_DRAWGFX_NEON 1
+#include <arm_neon.h>
+#endif
+
+
+/***************************************************************************
+    BLOCK CLASSIFICATION
+***************************************************************************/
+
+enum drawgfx_block_type
+{
+	DRAWGFX_BLOCK_MIXED,            // some pixels are transparent
+	DRAWGFX_BLOCK_OPAQUE,           // no pixel is transparent
+	DRAWGFX_BLOCK_TRANSPARENT       // every pixel is transparent
+};
+
+// number of source pixels classified at once
+constexpr uint32_t DRAWGFX_BLOCK_PIXELS = 16;
+
+
+/*-------------------------------------------------
+    drawgfx_classify_block - determine whether a
+    block of 16 source pixels is wholly opaque,
+    wholly transparent or mixed with respect to
+    'trans_pen'
+-------------------------------------------------*/
+
+inline drawgfx_block_type drawgfx_classify_block(const uint8_t *src, uint32_t trans_pen)
+{
+	// no 8-bit pen can match
+	if (trans_pen > 0xff)
+		return DRAWGFX_BLOCK_OPAQUE;
+
+#if defined(MAME_DRAWGFX_SSE2)
+	int const mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)), _mm_set1_epi8(char(trans_pen))));
+	if (mask == 0)
+		return DRAWGFX_BLOCK_OPAQUE;
+	if (mask == 0xffff)
+		return DRAWGFX_BLOCK_TRANSPARENT;
+	return DRAWGFX_BLOCK_MIXED;
+#elif defined(MAME_DRAWGFX_NEON)
+	uint8x16_t const transparent = vceqq_u8(vld1q_u8(src), vdupq_n_u8(uint8_t(trans_pen)));
+	if (vmaxvq_u8(transparent) == 0)
+		return DRAWGFX_BLOCK_OPAQUE;
+	if (vminvq_u8(transparent) != 0)
+		return DRAWGFX_BLOCK_TRANSPARENT;
+	return DRAWGFX_BLOCK_MIXED;
+#else
+	uint32_t count = 0;
+	for (uint32_t x = 0; x < DRAWGFX_BLOCK_PIXELS; x++)
+		count += (src[x] == trans_pen) ? 1 : 0;
+	if (count == 0)
+		return DRAWGFX_BLOCK_OPAQUE;
+	if (count == DRAWGFX_BLOCK_PIXELS)
+		return DRAWGFX_BLOCK_TRANSPARENT;
+	return DRAWGFX_BLOCK_MIXED;
+#endif
+}
+
+
+
+/***************************************************************************
+    ROW KERNELS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drawgfx_row_rebase_transpen - equivalent of
+    PIXEL_OP_REBASE_TRANSPEN for a row of 16-bit
+    destination pixels
+-------------------------------------------------*/
+
+inline void drawgfx_row_rebase_transpen(uint16_t *dest, const uint8_t *src, uint32_t count, uint32_t color, uint32_t trans_pen)
+{
+#if defined(MAME_DRAWGFX_SSE2)
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const trans = _mm_set1_epi16(int16_t(std::min<uint32_t>(trans_pen, 0xffff)));
+	__m128i const base = _mm_set1_epi16(int16_t(color));
+	for ( ; count >= 8; count -= 8, src += 8, dest += 8)
+	{
+		__m128i const pens = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src)), zero);
+		__m128i const transparent = _mm_cmpeq_epi16(pens, trans);
+		__m128i const old = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest));
+		__m128i const pixels = _mm_add_epi16(pens, base);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_or_si128(_mm_and_si128(transparent, old), _mm_andnot_si128(transparent, pixels)));
+	}
+#elif defined(MAME_DRAWGFX_NEON)
+	uint16x8_t const trans = vdupq_n_u16(uint16_t(std::min<uint32_t>(trans_pen, 0xffff)));
+	uint16x8_t const base = vdupq_n_u16(uint16_t(color));
+	for ( ; count >= 8; count -= 8, src += 8, dest += 8)
+	{
+		uint16x8_t const pens = vmovl_u8(vld1_u8(src));
+		uint16x8_t const transparent = vceqq_u16(pens, trans);
+		vst1q_u16(dest, vbslq_u16(transparent, vld1q_u16(dest), vaddq_u16(pens, base)));
+	}
+#endif
+	for ( ; count != 0; count--, src++, dest++)
+		if (*src != trans_pen)
+			*dest = color + *src;
+}
+
+
+/*-------------------------------------------------
+    drawgfx_row_remap_transpen - equivalent of
+    PIXEL_OP_REMAP_TRANSPEN for a row of 32-bit
+    destination pixels; wholly transparent blocks
+    are skipped and wholly opaque blocks are
+    copied without testing each pixel
+-------------------------------------------------*/
+
+inline void drawgfx_row_remap_transpen(uint32_t *dest, const uint8_t *src, uint32_t count, const uint32_t *paldata, uint32_t trans_pen)
+{
+	for ( ; count >= DRAWGFX_BLOCK_PIXELS; count -= DRAWGFX_BLOCK_PIXELS, src += DRAWGFX_BLOCK_PIXELS, dest += DRAWGFX_BLOCK_PIXELS)
+	{
+		switch (drawgfx_classify_block(src, trans_pen))
+		{
+		case DRAWGFX_BLOCK_TRANSPARENT:
+			break;
+
+		case DRAWGFX_BLOCK_OPAQUE:
+			for (uint32_t x = 0; x < DRAWGFX_BLOCK_PIXELS; x++)
+				dest[x] = paldata[src[x]];
+			break;
+
+		default:
+			// select rather than branch, since the edges of sprites are hard to predict
+			for (uint32_t x = 0; x < DRAWGFX_BLOCK_PIXELS; x++)
+			{
+				uint32_t const pen = src[x];
+				uint32_t const old = dest[x];
+				dest[x] = (pen != trans_pen) ? paldata[pen] : old;
+			}
+			break;
+		}
+	}
+	for ( ; count != 0; count--, src++, dest++)
+		if (*src != trans_pen)
+			*dest = paldata[*src];
+}
+
+
+/*-------------------------------------------------
+    drawgfx_row_transpen_priority - equivalent of
+    PIXEL_OP_REBASE_TRANSPEN_PRIORITY or
+    PIXEL_OP_REMAP_TRANSPEN_PRIORITY depending on
+    the supplied pixel function; wholly
+    transparent blocks leave both the destination
+    and the priority untouched and are skipped
+-------------------------------------------------*/
+
+template <typename DestType, typename PixelFunction>
+inline void drawgfx_row_transpen_priority(DestType *dest, uint8_t *pri, const uint8_t *src, uint32_t count, uint32_t trans_pen, uint32_t pmask, PixelFunction pixel)
+{
+	for ( ; count != 0; )
+	{
+		if (count >= DRAWGFX_BLOCK_PIXELS && drawgfx_classify_block(src, trans_pen) == DRAWGFX_BLOCK_TRANSPARENT)
+		{
+			count -= DRAWGFX_BLOCK_PIXELS;
+			src += DRAWGFX_BLOCK_PIXELS;
+			dest += DRAWGFX_BLOCK_PIXELS;
+			pri += DRAWGFX_BLOCK_PIXELS;
+			continue;
+		}
+
+		uint32_t const pixels = std::min(count, DRAWGFX_BLOCK_PIXELS);
+		for (uint32_t x = 0; x < pixels; x++)
+			if (src[x] != trans_pen)
+			{
+				if (((1 << (pri[x] & 0x1f)) & pmask) == 0)
+					dest[x] = pixel(src[x]);
+				pri[x] = 31;
+			}
+		count -= pixels;
+		src += pixels;
+		dest += pixels;
+		pri += pixels;
+	}
+}
+
+
+
+/*-------------------------------------------------
+    drawgfx_row_copy_opaque - equivalent of
+    PIXEL_OP_COPY_OPAQUE for a row of pixels
+-------------------------------------------------*/
+
+template <typename PixelType>
+inline void drawgfx_row_copy_opaque(PixelType *dest, const PixelType *src, uint32_t count)
+{
+	// a bitmap may be copied onto itself; like the other row copies, an
+	// overlapping row behaves as if it was all read before being written
+	std::memmove(dest, src, count * sizeof(PixelType));
+}
+
+
+/*-------------------------------------------------
+    drawgfx_row_copy_transpen - equivalent of
+    PIXEL_OP_COPY_TRANSPEN for a row of 16-bit or
+    32-bit pixels
+-------------------------------------------------*/
+
+inline void drawgfx_row_copy_transpen(uint16_t *dest, const uint16_t *src, uint32_t count, uint32_t trans_pen)
+{
+	// no 16-bit pixel can match
+	if (trans_pen > 0xffff)
+		return drawgfx_row_copy_opaque(dest, src, count);
+
+#if defined(MAME_DRAWGFX_SSE2)
+	__m128i const trans = _mm_set1_epi16(int16_t(uint16_t(trans_pen)));
+	for ( ; count >= 8; count -= 8, src += 8, dest += 8)
+	{
+		__m128i const pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+		__m128i const transparent = _mm_cmpeq_epi16(pixels, trans);
+		int const mask = _mm_movemask_epi8(transparent);
+		if (mask == 0xffff)
+			continue;
+		if (mask != 0)
+		{
+			__m128i const old = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_or_si128(_mm_and_si128(transparent, old), _mm_andnot_si128(transparent, pixels)));
+		}
+		else
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), pixels);
+		}
+	}
+#elif defined(MAME_DRAWGFX_NEON)
+	uint16x8_t const trans = vdupq_n_u16(uint16_t(trans_pen));
+	for ( ; count >= 8; count -= 8, src += 8, dest += 8)
+	{
+		uint16x8_t const pixels = vld1q_u16(src);
+		uint16x8_t const transparent = vceqq_u16(pixels, trans);
+		if (vminvq_u16(transparent) != 0)
+			continue;
+		vst1q_u16(dest, vbslq_u16(transparent, vld1q_u16(dest), pixels));
+	}
+#endif
+	for ( ; count != 0; count--, src++, dest++)
+		if (*src != trans_pen)
+			*dest = *src;
+}
+
+inline void drawgfx_row_copy_transpen(uint32_t *dest, const uint32_t *src, uint32_t count, uint32_t trans_pen)
+{
+#if defined(MAME_DRAWGFX_SSE2)
+	__m128i const trans = _mm_set1_epi32(int32_t(trans_pen));
+	for ( ; count >= 4; count -= 4, src += 4, dest += 4)
+	{
+		__m128i const pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+		__m128i const transparent = _mm_cmpeq_epi32(pixels, trans);
+		int const mask = _mm_movemask_epi8(transparent);
+		if (mask == 0xffff)
+			continue;
+		if (mask != 0)
+		{
+			__m128i const old = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_or_si128(_mm_and_si128(transparent, old), _mm_andnot_si128(transparent, pixels)));
+		}
+		else
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), pixels);
+		}
+	}
+#elif defined(MAME_DRAWGFX_NEON)
+	uint32x4_t const trans = vdupq_n_u32(trans_pen);
+	for ( ; count >= 4; count -= 4, src += 4, dest += 4)
+	{
+		uint32x4_t const pixels = vld1q_u32(src);
+		uint32x4_t const transparent = vceqq_u32(pixels, trans);
+		if (vminvq_u32(transparent) != 0)
+			continue;
+		vst1q_u32(dest, vbslq_u32(transparent, vld1q_u32(dest), pixels));
+	}
+#endif
+	for ( ; count != 0; count--, src++, dest++)
+		if (*src != trans_pen)
+			*dest = *src;
+}
+
+#endif // MAME_EMU_DRAWGFXSIMD_H
@@ -15,6 +15,10 @@
 
 #pragma once
 
+#include "drawgfxsimd.h"
+
+#include <type_traits>
+
 
 /***************************************************************************
     PIXEL OPERATIONS
@@ -399,6 +403,77 @@ do
 while (0)
 
 
+
+/***************************************************************************
+    ROW OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    pixel operations with a row() member are
+    handed whole unflipped rows by drawgfx_core,
+    letting them use the vectorized kernels in
+    drawgfxsimd.h
+-------------------------------------------------*/
+
+template <typename T, typename = void> struct drawgfx_has_row_op : std::false_type { };
+template <typename T> struct drawgfx_has_row_op<T, std::void_t<decltype(&T::row)> > : std::true_type { };
+
+struct drawgfx_rebase_transpen_op
+{
+	u32 trans_pen;
+	u32 color;
+
+	void operator()(u16 &destp, const u8 &srcp) const { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); }
+	void row(u16 *dest, const u8 *src, u32 count) const { drawgfx_row_rebase_transpen(dest, src, count, color, trans_pen); }
+};
+
+struct drawgfx_remap_transpen_op
+{
+	u32 trans_pen;
+	const pen_t *paldata;
+
+	void operator()(u32 &destp, const u8 &srcp) const { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); }
+	void row(u32 *dest, const u8 *src, u32 count) const { drawgfx_row_remap_transpen(dest, src, count, paldata, trans_pen); }
+};
+
+template <typename PixelType>
+struct copybitmap_opaque_op
+{
+	void operator()(PixelType &destp, const PixelType &srcp) const { PIXEL_OP_COPY_OPAQUE(destp, srcp); }
+	void row(PixelType *dest, const PixelType *src, u32 count) const { drawgfx_row_copy_opaque(dest, src, count); }
+};
+
+template <typename PixelType>
+struct copybitmap_transpen_op
+{
+	u32 trans_pen;
+
+	void operator()(PixelType &destp, const PixelType &srcp) const { PIXEL_OP_COPY_TRANSPEN(destp, srcp); }
+	void row(PixelType *dest, const PixelType *src, u32 count) const { drawgfx_row_copy_transpen(dest, src, count, trans_pen); }
+};
+
+struct drawgfx_rebase_transpen_priority_op
+{
+	u32 pmask;
+	u32 trans_pen;
+	u32 color;
+
+	void operator()(u16 &destp, u8 &pri, const u8 &srcp) const { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); }
+	void row(u16 *dest, u8 *pri, const u8 *src, u32 count) const { drawgfx_row_transpen_priority(dest, pri, src, count, trans_pen, pmask, [this] (u32 pen) { return u16(color + pen); }); }
+};
+
+struct drawgfx_remap_transpen_priority_op
+{
+	u32 pmask;
+	u32 trans_pen;
+	const pen_t *paldata;
+
+	void operator()(u32 &destp, u8 &pri, const u8 &srcp) const { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); }
+	void row(u32 *dest, u8 *pri, const u8 *src, u32 count) const { drawgfx_row_transpen_priority(dest, pri, src, count, trans_pen, pmask, [this] (u32 pen) { return paldata[pen]; }); }
+};
+
+
+
 /***************************************************************************
     BASIC DRAWGFX CORE
 ***************************************************************************/
@@ -497,6 +572,13 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
+				// hand the whole row to the operation if it can take it
+				if constexpr (drawgfx_has_row_op<FunctionClass>::value)
+				{
+					pixel_op.row(destptr, srcptr, 4 * numblocks + leftovers);
+					continue;
+				}
+
 				// iterate over unrolled blocks of 4
 				for (s32 curx = 0; curx < numblocks; curx++)
 				{
@@ -635,6 +717,13 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
+				// hand the whole row to the operation if it can take it
+				if constexpr (drawgfx_has_row_op<FunctionClass>::value)
+				{
+					pixel_op.row(destptr, priptr, srcptr, 4 * numblocks + leftovers);
+					continue;
+				}
+
 				// iterate over unrolled blocks of 4
 				for (s32 curx = 0; curx < numblocks; curx++)
 				{
@@ -1047,6 +1136,13 @@ inline void copybitmap_core(BitmapType &dest, const BitmapType &src, int flipx,
 				const auto *srcptr = srcdata;
 				srcdata += dy;
 
+				// hand the whole row to the operation if it can take it
+				if constexpr (drawgfx_has_row_op<FunctionClass>::value)
+				{
+					pixel_op.row(destptr, srcptr, 4 * numblocks + leftovers);
+					continue;
+				}
+
 				// iterate over unrolled blocks of 4
 				for (s32 curx = 0; curx < numblocks; curx++)
 				{
@@ -18,6 +18,7 @@
 #include <algorithm>
 
 #include <cctype>
+#include <cstring>
 
 
 
@@ -53,6 +54,51 @@ int driver_list::find(const char *name)
 }
 
 
+//-------------------------------------------------
+//  parents - get the index of each driver's
+//  parent, looking them all up on first use
+//-------------------------------------------------
+
+std::vector<int> const &driver_list::parents()
+{
+	static std::vector<int> const s_parents = [] ()
+	{
+		std::vector<int> result(s_driver_count);
+		for (std::size_t index = 0; index < s_driver_count; index++)
+			result[index] = find(s_drivers_sorted[index]->parent);
+		return result;
+	}();
+	return s_parents;
+}
+
+
+//-------------------------------------------------
+//  search_index - get the normalised text used
+//  for approximate matching, building it on
+//  first use
+//-------------------------------------------------
+
+std::vector<driver_list::search_entry> const &driver_list::search_index()
+{
+	static std::vector<search_entry> const s_index = [] ()
+	{
+		std::vector<search_entry> result(s_driver_count);
+		std::string composed;
+		for (std::size_t index = 0; index < s_driver_count; index++)
+		{
+			game_driver const &drv(*s_drivers_sorted[index]);
+			composed.assign(drv.manufacturer);
+			composed.append(1, ' ');
+			composed.append(drv.type.fullname());
+			result[index].description = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
+			result[index].composed = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
+		}
+		return result;
+	}();
+	return s_index;
+}
+
+
 //-------------------------------------------------
 //  matches - true if we match, taking into
 //  account wildcards in the wildstring
@@ -141,6 +187,15 @@ std::size_t driver_enumerator::filter(const char *filterstring)
 	// reset the count
 	exclude_all();
 
+	// a name without wildcards can only match one driver
+	if (filterstring && !std::strpbrk(filterstring, "*?"))
+	{
+		int const index = find(filterstring);
+		if ((index >= 0) && matches(filterstring, s_drivers_sorted[index]->name))
+			include(index);
+		return m_filtered_count;
+	}
+
 	// match name against each driver in the list
 	for (std::size_t index = 0; index < s_driver_count; index++)
 		if (matches(filterstring, s_drivers_sorted[index]->name))
@@ -160,10 +215,10 @@ std::size_t driver_enumerator::filter(const game_driver &driver)
 	// reset the count
 	exclude_all();
 
-	// match name against each driver in the list
-	for (std::size_t index = 0; index < s_driver_count; index++)
-		if (s_drivers_sorted[index] == &driver)
-			include(index);
+	// names are unique, so look it up directly
+	int const index = find(driver);
+	if ((index >= 0) && (s_drivers_sorted[index] == &driver))
+		include(index);
 
 	return m_filtered_count;
 }
@@ -262,7 +317,7 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 		std::vector<std::pair<double, int> > penalty;
 		penalty.reserve(count + 1);
 		std::u32string const search(ustr_from_utf8(normalize_unicode(string, unicode_normalization_form::D, true)));
-		std::string composed;
+		std::vector<search_entry> const &index_text(search_index());
 		std::u32string candidate;
 
 		// scan the entire drivers array
@@ -281,8 +336,7 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 				// if it's not a perfect match, try the description
 				if (curpenalty)
 				{
-					candidate = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, index_text[index].description));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -290,11 +344,7 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 				// also check "<manufacturer> <description>"
 				if (curpenalty)
 				{
-					composed.assign(drv.manufacturer);
-					composed.append(1, ' ');
-					composed.append(drv.type.fullname());
-					candidate = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, index_text[index].composed));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <string>
+#include <vector>
 
 
 //**************************************************************************
@@ -48,8 +50,8 @@ public:
 
 	// any item by index
 	static const game_driver &driver(std::size_t index) { assert(index < total()); return *s_drivers_sorted[index]; }
-	static int clone(std::size_t index) { return find(driver(index).parent); }
-	static int non_bios_clone(std::size_t index) { int const result = find(driver(index).parent); return ((result >= 0) && !(driver(result).flags & MACHINE_IS_BIOS_ROOT)) ? result : -1; }
+	static int clone(std::size_t index) { assert(index < total()); return parents()[index]; }
+	static int non_bios_clone(std::size_t index) { int const result = clone(index); return ((result >= 0) && !(driver(result).flags & MACHINE_IS_BIOS_ROOT)) ? result : -1; }
 	static int compatible_with(std::size_t index) { return find(driver(index).compatible_with); }
 
 	// any item by driver
@@ -65,6 +67,17 @@ public:
 	static bool matches(const char *wildstring, const char *string);
 
 protected:
+	// normalised text searched for approximate matches
+	struct search_entry
+	{
+		std::u32string  description;    // description
+		std::u32string  composed;       // "<manufacturer> <description>"
+	};
+
+	// tables built the first time they're needed
+	static std::vector<int> const &parents();
+	static std::vector<search_entry> const &search_index();
+
 	static std::size_t const            s_driver_count;
 	static game_driver const * const    s_drivers_sorted[];
 };
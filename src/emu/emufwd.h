@@ -49,6 +49,9 @@ class osd_interface;
 class address_map;
 class address_map_entry;
 
+// declared in benchlog.h
+class bench_log_manager;
+
 // declared in bookkeeping.h
 class bookkeeping_manager;
 
@@ -57,6 +60,9 @@ enum class config_type : int;
 enum class config_level : int;
 class configuration_manager;
 
+// declared in coverage.h
+class coverage_manager;
+
 // declared in crsshair.h
 class crosshair_manager;
 
@@ -144,6 +150,12 @@ class emu_options;
 // declared in fileio.h
 class emu_file;
 
+// declared in footprint.h
+class footprint_manager;
+
+// declared in hashcache.h
+class hash_cache;
+
 // declared in http.h
 class http_manager;
 
@@ -182,9 +194,15 @@ class machine_config;
 // declared in main.h
 class machine_manager;
 
+// declared in memtrace.h
+class memory_trace_manager;
+
 // declared in natkeyboard.h
 class natural_keyboard;
 
+// declared in netplay.h
+class netplay_manager;
+
 // declared in network.h
 class network_manager;
 
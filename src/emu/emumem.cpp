@@ -14,6 +14,8 @@
 #include "emuopts.h"
 #include "debug/debugcpu.h"
 
+#include "../osd/modules/lib/osdlib.h"
+
 #include "emumem_mud.h"
 #include "emumem_hea.h"
 #include "emumem_hem.h"
@@ -43,6 +45,17 @@ template <typename Format, typename... Params> static void VPRINTF(Format &&, Pa
 
 #define VALIDATE_REFCOUNTS 0
 
+// smallest block worth backing with huge pages
+static constexpr size_t LARGE_PAGE_MIN_SIZE = 0x200000;
+
+static std::unique_ptr<osd::virtual_memory_allocation> alloc_large_pages(size_t bytes)
+{
+	auto memory = std::make_unique<osd::virtual_memory_allocation>(std::initializer_list<std::size_t>{ bytes }, osd::virtual_memory_allocation::READ_WRITE | osd::virtual_memory_allocation::LARGE_PAGES);
+	if (!*memory || !memory->set_access(0, memory->size(), osd::virtual_memory_allocation::READ_WRITE))
+		return nullptr;
+	return memory;
+}
+
 offs_t handler_entry::dispatch_entry(offs_t address) const
 {
 	fatalerror("dispatch_entry called on non-dispatching class\n");
@@ -309,6 +322,34 @@ void memory_manager::initialize()
 
 void *memory_manager::allocate_memory(device_t &dev, int spacenum, std::string name, u8 width, size_t bytes)
 {
+	// big blocks can go in copy-on-write memory, so run-ahead doesn't have to copy them every frame
+	if ((bytes >= SNAPSHOT_MIN_SIZE) && machine().options().runahead() && machine().options().runahead_snapshot())
+	{
+		auto memory = std::make_unique<osd::snapshot_memory>(bytes);
+		if (*memory)
+		{
+			// it starts out zero-filled, and writing it would only make private copies of every page
+			void *const ptr = memory->get();
+			machine().save().save_memory(&dev, "memory", dev.tag(), spacenum, name.c_str(), ptr, width/8, u32(bytes) / (width/8));
+			machine().save().use_snapshot(ptr, *memory);
+			m_snapshotblocks.emplace_back(std::move(memory));
+			return ptr;
+		}
+	}
+
+	// big RAMs cause lots of TLB misses with normal pages; fresh pages are already zero-filled
+	if ((bytes >= LARGE_PAGE_MIN_SIZE) && machine().options().huge_pages())
+	{
+		auto memory = alloc_large_pages(bytes);
+		if (memory)
+		{
+			void *const ptr = memory->get();
+			machine().save().save_memory(&dev, "memory", dev.tag(), spacenum, name.c_str(), ptr, width/8, u32(bytes) / (width/8));
+			m_largeblocks.emplace_back(std::move(memory));
+			return ptr;
+		}
+	}
+
 	void *const ptr = m_datablocks.emplace_back(malloc(bytes)).get();
 	memset(ptr, 0, bytes);
 	machine().save().save_memory(&dev, "memory", dev.tag(), spacenum, name.c_str(), ptr, width/8, u32(bytes) / (width/8));
@@ -1069,12 +1110,69 @@ void memory_bank::configure_entries(int startentry, int numentries, void *base,
 memory_region::memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian)
 	: m_machine(machine),
 		m_name(std::move(name)),
-		m_buffer(length),
+		m_base(nullptr),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
 {
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
+
+	// regions that may be shared with other instances live in a mapping a
+	// file can replace later; small ones aren't worth a file each
+	constexpr u32 SHARED_REGION_MIN_SIZE = 64 * 1024;
+	if (*machine.options().region_cache() && (length >= SHARED_REGION_MIN_SIZE))
+	{
+		auto mapping = std::make_unique<osd::file_mapping>(length);
+		if (*mapping)
+		{
+			m_mapping = std::move(mapping);
+			m_base = reinterpret_cast<u8 *>(m_mapping->get());
+		}
+	}
+	if (!m_base && (length >= LARGE_PAGE_MIN_SIZE) && machine.options().huge_pages())
+	{
+		m_pages = alloc_large_pages(length);
+		if (m_pages)
+			m_base = reinterpret_cast<u8 *>(m_pages->get());
+	}
+	if (!m_base && length)
+	{
+		m_buffer.resize(length);
+		m_base = &m_buffer[0];
+	}
+}
+
+memory_region::~memory_region()
+{
+}
+
+bool memory_region::map_file(const std::string &path)
+{
+	auto mapping = std::make_unique<osd::file_mapping>(path, m_length);
+	if (!*mapping)
+		return false;
+
+	// the mapping takes the place of the buffer, which can go
+	m_mapping = std::move(mapping);
+	m_base = reinterpret_cast<u8 *>(m_mapping->get());
+	std::vector<u8>().swap(m_buffer);
+	m_pages.reset();
+	return true;
+}
+
+bool memory_region::share_file(const std::string &path)
+{
+	if (!m_mapping)
+		return false;
+
+	// only take the file if it really does hold what's in the region now
+	{
+		osd::file_mapping const published(path, m_length);
+		if (!published || memcmp(published.get(), m_base, m_length))
+			return false;
+	}
+	return m_mapping->remap(path);
 }
 
 std::string memory_share::compare(u8 width, size_t bytes, endianness_t endianness) const
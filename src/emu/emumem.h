@@ -19,6 +19,7 @@
 
 #include "notifier.h"
 
+#include <array>
 #include <optional>
 #include <set>
 #include <type_traits>
@@ -56,6 +57,8 @@ enum class read_or_write
 //  FORWARD DECLARATIONS
 //**************************************************************************
 
+namespace osd { class file_mapping; class snapshot_memory; class virtual_memory_allocation; }
+
 class handler_entry;
 template<int Width, int AddrShift> class handler_entry_read_passthrough;
 template<int Width, int AddrShift> class handler_entry_write_passthrough;
@@ -1688,6 +1691,8 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> class memory_
 	using NativeType = emu::detail::handler_entry_size_t<Width>;
 	static constexpr u32 NATIVE_BYTES = 1 << Width;
 	static constexpr u32 NATIVE_MASK = (Width + AddrShift >= 0) ? ((1 << (Width + AddrShift)) - 1) : 0;
+	static constexpr u32 FROZEN_PAGE_BITS = 14;
+	static constexpr offs_t FROZEN_PAGE_MASK = (1 << FROZEN_PAGE_BITS) - 1;
 
 public:
 	// construction/destruction
@@ -1695,7 +1700,9 @@ public:
 		m_space(nullptr),
 		m_addrmask(0),
 		m_dispatch_read(nullptr),
-		m_dispatch_write(nullptr)
+		m_dispatch_write(nullptr),
+		m_frozen_read(nullptr),
+		m_frozen_write(nullptr)
 	{
 	}
 
@@ -1817,12 +1824,34 @@ private:
 	const handler_entry_read<Width, AddrShift> *const *m_dispatch_read;
 	const handler_entry_write<Width, AddrShift> *const *m_dispatch_write;
 
+	void *const *               m_frozen_read;             // frozen map read pages, nullptr when not frozen
+	void *const *               m_frozen_write;            // frozen map write pages, nullptr when not frozen
+
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0)) {
-		return dispatch_read<Level, Width, AddrShift>(~offs_t(0), address & m_addrmask, mask, m_dispatch_read);
+		address &= m_addrmask;
+		if constexpr(Level == 1) {
+			if(m_frozen_read) {
+				const NativeType *page = static_cast<const NativeType *>(m_frozen_read[address >> FROZEN_PAGE_BITS]);
+				if(page || (refreeze(read_or_write::READ) && (page = static_cast<const NativeType *>(m_frozen_read[address >> FROZEN_PAGE_BITS]))))
+					return page[(address & FROZEN_PAGE_MASK) >> (Width + AddrShift)];
+			}
+		}
+		return dispatch_read<Level, Width, AddrShift>(~offs_t(0), address, mask, m_dispatch_read);
 	}
 
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0)) {
-		dispatch_write<Level, Width, AddrShift>(~offs_t(0), address & m_addrmask, data, mask, m_dispatch_write);
+		address &= m_addrmask;
+		if constexpr(Level == 1) {
+			if(m_frozen_write) {
+				NativeType *page = static_cast<NativeType *>(m_frozen_write[address >> FROZEN_PAGE_BITS]);
+				if(page || (refreeze(read_or_write::WRITE) && (page = static_cast<NativeType *>(m_frozen_write[address >> FROZEN_PAGE_BITS])))) {
+					NativeType &target = page[(address & FROZEN_PAGE_MASK) >> (Width + AddrShift)];
+					target = (target & ~mask) | (data & mask);
+					return;
+				}
+			}
+		}
+		dispatch_write<Level, Width, AddrShift>(~offs_t(0), address, data, mask, m_dispatch_write);
 	}
 
 	std::pair<NativeType, u16> read_native_flags(offs_t address, NativeType mask = ~NativeType(0)) {
@@ -1841,6 +1870,7 @@ private:
 		return dispatch_lookup_write_flags<Level, Width, AddrShift>(~offs_t(0), address & m_addrmask, mask, m_dispatch_write);
 	}
 
+	bool refreeze(read_or_write mode);
 	void set(address_space *space, std::pair<const void *, const void *> rw);
 };
 
@@ -1857,6 +1887,15 @@ template<int Width, int AddrShift, endianness_t Endian> class memory_access_cach
 	static constexpr u32 NATIVE_BYTES = 1 << Width;
 	static constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
 
+	// number of recently used handler ranges kept behind the current one
+	static constexpr unsigned TLB_ENTRIES = 8;
+
+	template<typename HandlerEntry> struct tlb_entry {
+		offs_t        start = 1;
+		offs_t        end = 0;
+		HandlerEntry *handler = nullptr;
+	};
+
 public:
 	// construction/destruction
 	memory_access_cache()
@@ -1868,6 +1907,8 @@ public:
 		  m_addrend_w(0),
 		  m_cache_r(nullptr),
 		  m_cache_w(nullptr),
+		  m_tlb_next_r(0),
+		  m_tlb_next_w(0),
 		  m_root_read(nullptr),
 		  m_root_write(nullptr)
 	{
@@ -1879,13 +1920,13 @@ public:
 	void check_address_r(offs_t address) {
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
-		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		refill(address, m_addrstart_r, m_addrend_r, m_cache_r, m_tlb_r, m_tlb_next_r, m_root_read);
 	}
 
 	void check_address_w(offs_t address) {
 		if(address >= m_addrstart_w && address <= m_addrend_w)
 			return;
-		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		refill(address, m_addrstart_w, m_addrend_w, m_cache_w, m_tlb_w, m_tlb_next_w, m_root_write);
 	}
 
 	// accessor methods
@@ -2010,11 +2051,55 @@ private:
 	handler_entry_read <Width, AddrShift> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift> *m_cache_w;  // write cache
 
+	std::array<tlb_entry<handler_entry_read <Width, AddrShift>>, TLB_ENTRIES> m_tlb_r; // recently used read ranges
+	std::array<tlb_entry<handler_entry_write<Width, AddrShift>>, TLB_ENTRIES> m_tlb_w; // recently used write ranges
+	unsigned                    m_tlb_next_r;              // next read entry to replace
+	unsigned                    m_tlb_next_w;              // next write entry to replace
+
 	handler_entry_read <Width, AddrShift> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift> *m_root_write;
 
 	util::notifier_subscription m_subscription;
 
+	// swap a recently used range back in, or evict the current range and walk the decode tree
+	template<typename HandlerEntry>
+	static void refill(offs_t address, offs_t &start, offs_t &end, HandlerEntry *&handler, std::array<tlb_entry<HandlerEntry>, TLB_ENTRIES> &tlb, unsigned &next, HandlerEntry *root) {
+		for(tlb_entry<HandlerEntry> &entry : tlb) {
+			if(address >= entry.start && address <= entry.end) {
+				std::swap(entry.start, start);
+				std::swap(entry.end, end);
+				std::swap(entry.handler, handler);
+				return;
+			}
+		}
+		if(handler) {
+			tlb[next] = tlb_entry<HandlerEntry>{ start, end, handler };
+			next = (next + 1) & (TLB_ENTRIES - 1);
+		}
+		root->lookup(address, start, end, handler);
+	}
+
+	// forget the current and recently used ranges that overlap start-end
+	template<typename HandlerEntry>
+	static void invalidate(offs_t start, offs_t end, offs_t &curstart, offs_t &curend, HandlerEntry *&handler, std::array<tlb_entry<HandlerEntry>, TLB_ENTRIES> &tlb) {
+		if(curstart <= end && curend >= start) {
+			curstart = 1;
+			curend = 0;
+			handler = nullptr;
+		}
+		for(tlb_entry<HandlerEntry> &entry : tlb)
+			if(entry.start <= end && entry.end >= start)
+				entry = tlb_entry<HandlerEntry>();
+	}
+
+	void invalidate_r(offs_t start = 0, offs_t end = ~offs_t(0)) {
+		invalidate(start, end, m_addrstart_r, m_addrend_r, m_cache_r, m_tlb_r);
+	}
+
+	void invalidate_w(offs_t start = 0, offs_t end = ~offs_t(0)) {
+		invalidate(start, end, m_addrstart_w, m_addrend_w, m_cache_w, m_tlb_w);
+	}
+
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0));
 	std::pair<NativeType, u16> read_native_flags(offs_t address, NativeType mask = ~NativeType(0));
@@ -2390,15 +2475,36 @@ public:
 	util::notifier_subscription add_change_notifier(delegate<void (read_or_write)> &&n);
 	template <typename T> util::notifier_subscription add_change_notifier(T &&n) { return add_change_notifier(delegate<void (read_or_write)>(std::forward<T>(n))); }
 
-	void invalidate_caches(read_or_write mode) {
+	// frozen map (-frozenmap): one native pointer per 16K page when the page is plain memory, nullptr otherwise
+	static constexpr int FROZEN_PAGE_BITS = 14;
+	void *const *frozen_read_pages() const { return m_frozen_read.empty() ? nullptr : m_frozen_read.data(); }
+	void *const *frozen_write_pages() const { return m_frozen_write.empty() ? nullptr : m_frozen_write.data(); }
+	bool refreeze(read_or_write mode);
+
+	void invalidate_caches(read_or_write mode) { invalidate_caches(mode, 0, ~offs_t(0)); }
+
+	// same, for a change confined to addrstart-addrend (e.g. a view switch)
+	void invalidate_caches(read_or_write mode, offs_t addrstart, offs_t addrend) {
+		if(!m_frozen_read.empty())
+			thaw(mode);
 		if(u32(mode) & ~m_in_notification) {
 			u32 old = m_in_notification;
+			offs_t const oldstart = m_changed_start;
+			offs_t const oldend = m_changed_end;
 			m_in_notification |= u32(mode);
+			m_changed_start = addrstart;
+			m_changed_end = addrend;
 			m_notifiers(mode);
 			m_in_notification = old;
+			m_changed_start = oldstart;
+			m_changed_end = oldend;
 		}
 	}
 
+	// range affected by the change being notified, the whole space unless narrowed
+	offs_t changed_start() const { return m_changed_start; }
+	offs_t changed_end() const { return m_changed_end; }
+
 	virtual void validate_reference_counts() const = 0;
 
 	virtual void remove_passthrough(std::unordered_set<handler_entry *> &handlers) = 0;
@@ -2420,6 +2526,16 @@ public:
 	virtual void *get_read_ptr(offs_t address) const = 0;
 	virtual void *get_write_ptr(offs_t address) const = 0;
 
+	// plain memory currently mapped for reading between addrstart and addrend, appended in address order, for recompilers to access directly
+	struct direct_range
+	{
+		offs_t                  start;              // first address
+		offs_t                  end;                // last address
+		void *                  base;               // host pointer to the data at start
+		bool                    readonly;           // writes don't go to the same memory
+	};
+	virtual void direct_ranges(std::vector<direct_range> &ranges, offs_t addrstart, offs_t addrend) const = 0;
+
 	// read accessors
 	virtual u8 read_byte(offs_t address) = 0;
 	virtual u8 read_byte(offs_t address, u8 mask) = 0;
@@ -2471,6 +2587,7 @@ protected:
 	virtual std::pair<const void *, const void *> get_specific_info() = 0;
 
 	void prepare_map_generic(address_map &map, bool allow_alloc) ATTR_COLD;
+	void install_dirty_tap(const address_map_entry &entry) ATTR_COLD;
 
 	// private state
 	device_t &              m_device;           // reference to the owning device
@@ -2490,6 +2607,16 @@ protected:
 
 	util::notifier<read_or_write> m_notifiers;  // notifier list for address map change
 	u32                     m_in_notification;  // notification(s) currently being done
+	offs_t                  m_changed_start;    // range of the change being notified
+	offs_t                  m_changed_end;
+
+	std::vector<void *>     m_frozen_read;      // frozen map read pages, empty when disabled
+	std::vector<void *>     m_frozen_write;     // frozen map write pages, empty when disabled
+	bool                    m_frozen_dirty_r;   // read pages need rebuilding before use
+	bool                    m_frozen_dirty_w;   // write pages need rebuilding before use
+
+	void thaw(read_or_write mode);
+	virtual void build_frozen_pages(read_or_write mode) = 0;
 
 	// passthrough handler used for wait states
 	std::shared_ptr<emu::detail::memory_passthrough_handler_impl> m_default_mpl;
@@ -2578,13 +2705,21 @@ class memory_region
 public:
 	// construction/destruction
 	memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian);
+	~memory_region();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return m_base + m_length; }
+	u32 bytes() const { return m_length; }
 	const std::string &name() const { return m_name; }
+	bool mapped() const { return bool(m_mapping); }
+
+	// replace the contents with a copy-on-write mapping of a file at least as long as the region
+	bool map_file(const std::string &path);
+
+	// replace the pages in place with a file holding identical contents
+	bool share_file(const std::string &path);
 
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
@@ -2592,7 +2727,7 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -2602,6 +2737,10 @@ private:
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	std::unique_ptr<osd::file_mapping> m_mapping;
+	std::unique_ptr<osd::virtual_memory_allocation> m_pages; // huge page backing
+	u8 *                    m_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -2671,6 +2810,7 @@ private:
 	const address_space_config *                    m_config;
 	offs_t                                          m_addrstart;
 	offs_t                                          m_addrend;
+	offs_t                                          m_addrmirror;
 	address_space *                                 m_space;
 	handler_entry *                                 m_handler_read;
 	handler_entry *                                 m_handler_write;
@@ -2679,7 +2819,7 @@ private:
 	std::string                                     m_context;
 
 	void initialize_from_address_map(offs_t addrstart, offs_t addrend, const address_space_config &config);
-	std::pair<handler_entry *, handler_entry *> make_handlers(address_space &space, offs_t addrstart, offs_t addrend);
+	std::pair<handler_entry *, handler_entry *> make_handlers(address_space &space, offs_t addrstart, offs_t addrend, offs_t addrmirror);
 	void make_subdispatch(std::string context);
 	int id_to_slot(int id) const;
 	void register_state();
@@ -2728,12 +2868,17 @@ public:
 	void region_free(std::string name);
 
 private:
+	// smallest block worth putting in copy-on-write memory
+	static constexpr size_t SNAPSHOT_MIN_SIZE = 0x100000;
+
 	struct stdlib_deleter { void operator()(void *p) const { free(p); } };
 
 	// internal state
 	running_machine &           m_machine;              // reference to the machine
 
 	std::vector<std::unique_ptr<void, stdlib_deleter>>               m_datablocks;           // list of memory blocks to free on exit
+	std::vector<std::unique_ptr<osd::snapshot_memory>>               m_snapshotblocks;       // blocks in copy-on-write memory, for run-ahead
+	std::vector<std::unique_ptr<osd::virtual_memory_allocation>>     m_largeblocks;          // blocks backed by huge pages
 	std::unordered_map<std::string, std::unique_ptr<memory_bank>>    m_banklist;             // map of banks
 	std::unordered_map<std::string, std::unique_ptr<memory_share>>   m_sharelist;            // map of shares
 	std::unordered_map<std::string, std::unique_ptr<memory_region>>  m_regionlist;           // map of memory regions
@@ -2812,6 +2957,15 @@ set(address_space *space, std::pair<const void *, const void *> rw)
 	m_addrmask = space->addrmask();
 	m_dispatch_read  = (const handler_entry_read <Width, AddrShift> *const *)(rw.first);
 	m_dispatch_write = (const handler_entry_write<Width, AddrShift> *const *)(rw.second);
+	m_frozen_read  = space->frozen_read_pages();
+	m_frozen_write = space->frozen_write_pages();
+}
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+bool emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+refreeze(read_or_write mode)
+{
+	return m_space->refreeze(mode);
 }
 
 
@@ -2824,27 +2978,19 @@ set(address_space *space, std::pair<void *, void *> rw)
 
 	m_subscription = space->add_change_notifier(
 			[this] (read_or_write mode) {
-			   if(u32(mode) & u32(read_or_write::READ)) {
-				   m_addrend_r = 0;
-				   m_addrstart_r = 1;
-				   m_cache_r = nullptr;
-			   }
-			   if(u32(mode) & u32(read_or_write::WRITE)) {
-				   m_addrend_w = 0;
-				   m_addrstart_w = 1;
-				   m_cache_w = nullptr;
-			   }
+			   offs_t const start = m_space->changed_start();
+			   offs_t const end = m_space->changed_end();
+			   if(u32(mode) & u32(read_or_write::READ))
+				   invalidate_r(start, end);
+			   if(u32(mode) & u32(read_or_write::WRITE))
+				   invalidate_w(start, end);
 		   });
 	m_root_read  = (handler_entry_read <Width, AddrShift> *)(rw.first);
 	m_root_write = (handler_entry_write<Width, AddrShift> *)(rw.second);
 
 	// Protect against a wandering memset
-	m_addrstart_r = 1;
-	m_addrend_r = 0;
-	m_cache_r = nullptr;
-	m_addrstart_w = 1;
-	m_addrend_w = 0;
-	m_cache_w = nullptr;
+	invalidate_r();
+	invalidate_w();
 }
 
 template<int Width, int AddrShift, endianness_t Endian>
@@ -78,6 +78,10 @@ class address_space_specific : public address_space
 
 	static constexpr offs_t offset_to_byte(offs_t offset) { return AddrShift < 0 ? offset << iabs(AddrShift) : offset >> iabs(AddrShift); }
 
+	// frozen map page geometry
+	static constexpr int FROZEN_MAX_BITS = 26;
+	static constexpr offs_t FROZEN_PAGE_MASK = (1 << FROZEN_PAGE_BITS) - 1;
+
 public:
 	const handler_entry_read<Width, AddrShift> *const *m_dispatch_read;
 	const handler_entry_write<Width, AddrShift> *const *m_dispatch_write;
@@ -263,6 +267,12 @@ public:
 
 		m_dispatch_read  = m_root_read ->get_dispatch();
 		m_dispatch_write = m_root_write->get_dispatch();
+
+		// the frozen map only pays off where the dispatch has a second level, and is capped to keep the tables small
+		if(Level == 1 && address_width <= FROZEN_MAX_BITS && manager.machine().options().frozen_map()) {
+			m_frozen_read.resize(1 << (address_width - FROZEN_PAGE_BITS), nullptr);
+			m_frozen_write.resize(1 << (address_width - FROZEN_PAGE_BITS), nullptr);
+		}
 	}
 
 	virtual ~address_space_specific() {
@@ -346,28 +356,133 @@ public:
 		return m_root_write->get_ptr(address);
 	}
 
+	// plain memory ranges, each one backed by a single contiguous block
+	virtual void direct_ranges(std::vector<direct_range> &ranges, offs_t addrstart, offs_t addrend) const override
+	{
+		addrend = std::min(addrend, m_addrmask);
+		offs_t address = addrstart & m_addrmask;
+		while(address <= addrend) {
+			offs_t start, end;
+			handler_entry_read<Width, AddrShift> *handler;
+			m_root_read->lookup(address, start, end, handler);
+			auto const mem = dynamic_cast<handler_entry_read_memory<Width, AddrShift> *>(handler);
+			void *const base = mem ? direct_base(*mem, start, end) : nullptr;
+			if(base) {
+				offs_t wstart, wend;
+				handler_entry_write<Width, AddrShift> *whandler;
+				m_root_write->lookup(start, wstart, wend, whandler);
+				auto const wmem = dynamic_cast<handler_entry_write_memory<Width, AddrShift> *>(whandler);
+				bool const writable = wmem && wstart <= start && wend >= end && wmem->get_ptr(start) == base;
+				ranges.emplace_back(direct_range{ std::max(start, addrstart), std::min(end, addrend), static_cast<NativeType *>(base) + offset_to_units(std::max(start, addrstart) - start), !writable });
+			}
+			if(end >= addrend)
+				break;
+			address = end + 1;
+		}
+	}
+
+	// the host pointer for a memory handler's range, nullptr if the range wraps (mirrors)
+	template<typename HandlerEntry> static void *direct_base(const HandlerEntry &handler, offs_t start, offs_t end)
+	{
+		offs_t const last = end & ~NATIVE_MASK;
+		NativeType *const first = static_cast<NativeType *>(handler.get_ptr(start));
+		if(static_cast<NativeType *>(handler.get_ptr(last)) != first + offset_to_units(last - start))
+			return nullptr;
+		return first;
+	}
+
+	// number of native units in a span of addresses
+	static offs_t offset_to_units(offs_t span)
+	{
+		return (Width + AddrShift >= 0) ? (span >> std::max(Width + AddrShift, 0)) : (span << std::max(-(Width + AddrShift), 0));
+	}
+
+	// frozen map page lookup, nullptr if the access has to go through the dispatch
+	const NativeType *frozen_read_page(offs_t offset)
+	{
+		const NativeType *page = static_cast<const NativeType *>(m_frozen_read[offset >> FROZEN_PAGE_BITS]);
+		if(!page && refreeze(read_or_write::READ))
+			page = static_cast<const NativeType *>(m_frozen_read[offset >> FROZEN_PAGE_BITS]);
+		return page;
+	}
+
+	NativeType *frozen_write_page(offs_t offset)
+	{
+		NativeType *page = static_cast<NativeType *>(m_frozen_write[offset >> FROZEN_PAGE_BITS]);
+		if(!page && refreeze(read_or_write::WRITE))
+			page = static_cast<NativeType *>(m_frozen_write[offset >> FROZEN_PAGE_BITS]);
+		return page;
+	}
+
 	// native read
 	NativeType read_native(offs_t offset, NativeType mask)
 	{
-		return dispatch_read<Level, Width, AddrShift>(offs_t(-1), offset & m_addrmask, mask, m_dispatch_read);
+		offset &= m_addrmask;
+		if(Level == 1 && !m_frozen_read.empty())
+			if(const NativeType *page = frozen_read_page(offset))
+				return page[(offset & FROZEN_PAGE_MASK) >> (Width + AddrShift)];
+		return dispatch_read<Level, Width, AddrShift>(offs_t(-1), offset, mask, m_dispatch_read);
 	}
 
 	// mask-less native read
 	NativeType read_native(offs_t offset)
 	{
-		return dispatch_read<Level, Width, AddrShift>(offs_t(-1), offset & m_addrmask, uX(0xffffffffffffffffU), m_dispatch_read);
+		return read_native(offset, uX(0xffffffffffffffffU));
 	}
 
 	// native write
 	void write_native(offs_t offset, NativeType data, NativeType mask)
 	{
-		dispatch_write<Level, Width, AddrShift>(offs_t(-1), offset & m_addrmask, data, mask, m_dispatch_write);
+		offset &= m_addrmask;
+		if(Level == 1 && !m_frozen_write.empty())
+			if(NativeType *page = frozen_write_page(offset)) {
+				NativeType &target = page[(offset & FROZEN_PAGE_MASK) >> (Width + AddrShift)];
+				target = (target & ~mask) | (data & mask);
+				return;
+			}
+		dispatch_write<Level, Width, AddrShift>(offs_t(-1), offset, data, mask, m_dispatch_write);
 	}
 
 	// mask-less native write
 	void write_native(offs_t offset, NativeType data)
 	{
-		dispatch_write<Level, Width, AddrShift>(offs_t(-1), offset & m_addrmask, data, uX(0xffffffffffffffffU), m_dispatch_write);
+		write_native(offset, data, uX(0xffffffffffffffffU));
+	}
+
+	// rebuild the frozen map pages from the current dispatch
+	void build_frozen_pages(read_or_write mode) override
+	{
+		if(u32(mode) & u32(read_or_write::READ))
+			for(offs_t page = 0; page != m_frozen_read.size(); page++) {
+				offs_t const base = page << FROZEN_PAGE_BITS;
+				offs_t start, end;
+				handler_entry_read<Width, AddrShift> *handler;
+				m_root_read->lookup(base, start, end, handler);
+				auto const mem = dynamic_cast<handler_entry_read_memory<Width, AddrShift> *>(handler);
+				m_frozen_read[page] = mem ? frozen_page_base(*mem, base, start, end) : nullptr;
+			}
+
+		if(u32(mode) & u32(read_or_write::WRITE))
+			for(offs_t page = 0; page != m_frozen_write.size(); page++) {
+				offs_t const base = page << FROZEN_PAGE_BITS;
+				offs_t start, end;
+				handler_entry_write<Width, AddrShift> *handler;
+				m_root_write->lookup(base, start, end, handler);
+				auto const mem = dynamic_cast<handler_entry_write_memory<Width, AddrShift> *>(handler);
+				m_frozen_write[page] = mem ? frozen_page_base(*mem, base, start, end) : nullptr;
+			}
+	}
+
+	// a page can be accessed directly when one memory handler covers it without wrapping
+	template<typename HandlerEntry> static void *frozen_page_base(const HandlerEntry &handler, offs_t base, offs_t start, offs_t end)
+	{
+		offs_t const last = base + (FROZEN_PAGE_MASK & ~NATIVE_MASK);
+		if(start > base || end < last)
+			return nullptr;
+		NativeType *const first = static_cast<NativeType *>(handler.get_ptr(base));
+		if(static_cast<NativeType *>(handler.get_ptr(last)) != first + (FROZEN_PAGE_MASK >> (Width + AddrShift)))
+			return nullptr;
+		return first;
 	}
 
 	auto rop()   { return [this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }; }
@@ -604,6 +719,10 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_log_unmap(true),
 		m_name(memory.space_config(spacenum)->name()),
 		m_in_notification(0),
+		m_changed_start(0),
+		m_changed_end(~offs_t(0)),
+		m_frozen_dirty_r(true),
+		m_frozen_dirty_w(true),
 		m_default_mpl(make_mph(nullptr))
 {
 }
@@ -786,10 +905,41 @@ void address_space::populate_from_map(address_map *map)
 		populate_map_entry(entry, read_or_write::WRITE);
 	}
 
+	// let the rewinder know which pages of RAM get written
+	if (m_manager.machine().options().rewind() && m_manager.machine().options().rewind_dirty())
+		for (const address_map_entry &entry : map->m_entrylist)
+			if (entry.m_write.m_type == AMH_RAM && entry.m_memory)
+				install_dirty_tap(entry);
+
 	if (VALIDATE_REFCOUNTS)
 		validate_reference_counts();
 }
 
+
+//-------------------------------------------------
+//  install_dirty_tap - mark the pages of a RAM
+//  entry's backing block as they're written
+//-------------------------------------------------
+
+void address_space::install_dirty_tap(const address_map_entry &entry)
+{
+	// blocks the save system doesn't know about or deem too small are left alone
+	save_manager::dirty_block *const block = m_manager.machine().save().track_dirty(entry.m_memory);
+	if (!block)
+		return;
+
+	const offs_t start = entry.m_addrstart;
+	const offs_t mirror = entry.m_addrmirror;
+	auto const mark = [this, block, start, mirror] (offs_t offset) { block->mark(address_to_byte((offset & ~mirror) - start)); };
+	switch (data_width())
+	{
+	case  8: install_write_tap(entry.m_addrstart, entry.m_addrend, entry.m_addrmirror, "dirty", [mark] (offs_t offset, u8  &data, u8  mem_mask) { mark(offset); }); break;
+	case 16: install_write_tap(entry.m_addrstart, entry.m_addrend, entry.m_addrmirror, "dirty", [mark] (offs_t offset, u16 &data, u16 mem_mask) { mark(offset); }); break;
+	case 32: install_write_tap(entry.m_addrstart, entry.m_addrend, entry.m_addrmirror, "dirty", [mark] (offs_t offset, u32 &data, u32 mem_mask) { mark(offset); }); break;
+	case 64: install_write_tap(entry.m_addrstart, entry.m_addrend, entry.m_addrmirror, "dirty", [mark] (offs_t offset, u64 &data, u64 mem_mask) { mark(offset); }); break;
+	}
+}
+
 //-------------------------------------------------
 //  get_handler_string - return a string
 //  describing the handler at a particular offset
@@ -871,7 +1021,7 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("install_view", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
 
-	auto handlers = view.make_handlers(*this, addrstart, addrend);
+	auto handlers = view.make_handlers(*this, addrstart, addrend, addrmirror);
 	m_root_read ->populate(nstart, nend, nmirror, static_cast<handler_entry_read <Width, AddrShift> *>(handlers.first));
 	m_root_write->populate(nstart, nend, nmirror, static_cast<handler_entry_write<Width, AddrShift> *>(handlers.second));
 	view.make_subdispatch(""); // Must be called after populate
@@ -1281,3 +1431,43 @@ util::notifier_subscription address_space::add_change_notifier(delegate<void (re
 {
 	return m_notifiers.subscribe(std::move(n));
 }
+
+
+//-------------------------------------------------
+//  thaw - drop the frozen map pages after a
+//  change to the address map
+//-------------------------------------------------
+
+void address_space::thaw(read_or_write mode)
+{
+	if((u32(mode) & u32(read_or_write::READ)) && !m_frozen_dirty_r) {
+		std::fill(m_frozen_read.begin(), m_frozen_read.end(), nullptr);
+		m_frozen_dirty_r = true;
+	}
+	if((u32(mode) & u32(read_or_write::WRITE)) && !m_frozen_dirty_w) {
+		std::fill(m_frozen_write.begin(), m_frozen_write.end(), nullptr);
+		m_frozen_dirty_w = true;
+	}
+}
+
+
+//-------------------------------------------------
+//  refreeze - rebuild the frozen map pages if the
+//  address map changed since they were built,
+//  returns true if anything was rebuilt
+//-------------------------------------------------
+
+bool address_space::refreeze(read_or_write mode)
+{
+	bool const read = (u32(mode) & u32(read_or_write::READ)) && m_frozen_dirty_r && !m_frozen_read.empty();
+	bool const write = (u32(mode) & u32(read_or_write::WRITE)) && m_frozen_dirty_w && !m_frozen_write.empty();
+	if(!read && !write)
+		return false;
+
+	build_frozen_pages(read ? write ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
+	if(read)
+		m_frozen_dirty_r = false;
+	if(write)
+		m_frozen_dirty_w = false;
+	return true;
+}
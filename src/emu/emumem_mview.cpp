@@ -488,7 +488,7 @@ std::string memory_view::memory_view_entry::key() const
 }
 
 
-memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1)
+memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_addrmirror(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1)
 {
 	device.view_register(this);
 }
@@ -515,12 +515,20 @@ void memory_view::refresh_id()
 		m_handler_write->select_a(m_cur_id);
 	}
 
-	if (m_space)
-		m_space->invalidate_caches(read_or_write::READWRITE);
+	// only what's decoded through the view can have changed, unless it's mirrored elsewhere
+	if (m_space) {
+		if (m_addrmirror)
+			m_space->invalidate_caches(read_or_write::READWRITE);
+		else
+			m_space->invalidate_caches(read_or_write::READWRITE, m_addrstart, m_addrend);
+	}
 }
 
 void memory_view::disable()
 {
+	if (m_cur_id == -1)
+		return;
+
 	m_cur_slot = -1;
 	m_cur_id = -1;
 	refresh_id();
@@ -532,6 +540,10 @@ void memory_view::select(int slot)
 	if (i == m_entry_mapping.end())
 		fatalerror("memory_view %s: select of unknown slot %d", m_name, slot);
 
+	// reselecting the current slot changes nothing, so leave the caches alone
+	if (i->second == m_cur_id)
+		return;
+
 	m_cur_slot = slot;
 	m_cur_id = i->second;
 	refresh_id();
@@ -615,7 +627,7 @@ namespace {
 	}
 }
 
-std::pair<handler_entry *, handler_entry *> memory_view::make_handlers(address_space &space, offs_t addrstart, offs_t addrend)
+std::pair<handler_entry *, handler_entry *> memory_view::make_handlers(address_space &space, offs_t addrstart, offs_t addrend, offs_t addrmirror)
 {
 	if (m_space != &space || m_addrstart != addrstart || m_addrend != addrend) {
 		if (m_space)
@@ -631,6 +643,7 @@ std::pair<handler_entry *, handler_entry *> memory_view::make_handlers(address_s
 		}
 
 		m_space = &space;
+		m_addrmirror = addrmirror;
 
 		offs_t span = addrstart ^ addrend;
 		u32 awidth = 32 - count_leading_zeros_32(span);
@@ -753,7 +766,7 @@ template<int Level, int Width, int AddrShift> void memory_view_entry_specific<Le
 	r()->select_u(m_id);
 	w()->select_u(m_id);
 
-	auto handlers = view.make_handlers(*m_view.m_space, addrstart, addrend);
+	auto handlers = view.make_handlers(*m_view.m_space, addrstart, addrend, addrmirror | m_view.m_addrmirror);
 	r()->populate(nstart, nend, nmirror, static_cast<handler_entry_read <Width, AddrShift> *>(handlers.first));
 	w()->populate(nstart, nend, nmirror, static_cast<handler_entry_write<Width, AddrShift> *>(handlers.second));
 	view.make_subdispatch(key()); // Must be called after populate
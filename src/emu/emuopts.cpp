@@ -64,6 +64,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      core_options::option_type::PATH,       "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  core_options::option_type::PATH,       "directory to save debugger comments" },
 	{ OPTION_SHARE_DIRECTORY,                            "share",     core_options::option_type::PATH,       "directory to share with emulated machines" },
+	{ OPTION_HASH_CACHE,                                 "",          core_options::option_type::PATH,       "file to keep the hashes of ROM files in, so files that haven't changed aren't hashed again" },
+	{ OPTION_REGION_CACHE,                               "",          core_options::option_type::PATH,       "directory to publish ROM regions in once the system has started, so other instances with identical regions share their memory" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -71,6 +73,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         core_options::option_type::BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
 	{ OPTION_REWIND,                                     "0",         core_options::option_type::BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       core_options::option_type::INTEGER,    "rewind buffer size in megabytes" },
+	{ OPTION_REWIND_DIRTY,                               "0",         core_options::option_type::BOOLEAN,    "only copy pages of mapped RAM written since the last rewind state" },
+	{ OPTION_STATE_CODEC,                                "zlib",      core_options::option_type::STRING,     "compression for saved state files (none, zlib or zstd)" },
+	{ OPTION_STATE_BACKGROUND,                           "0",         core_options::option_type::BOOLEAN,    "compress and write saved state files on a worker thread" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     core_options::option_type::STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              nullptr,     core_options::option_type::STRING,     "record an input file" },
 	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",         core_options::option_type::BOOLEAN,    "close the program at the end of playback" },
@@ -82,6 +87,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSIZE,                                   "auto",      core_options::option_type::STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "auto",      core_options::option_type::STRING,     "snapshot/movie view - 'auto' for default, or 'native' for per-screen pixel-aspect views" },
 	{ OPTION_SNAPBILINEAR,                               "1",         core_options::option_type::BOOLEAN,    "specify if the snapshot/movie should have bilinear filtering applied" },
+	{ OPTION_SNAPBANDS "(0-16)",                         "0",         core_options::option_type::INTEGER,    "render snapshot/movie frames in this many horizontal bands on worker threads (0 or 1 = disabled)" },
+	{ OPTION_SNAPCOMPRESSION "(-1-9)",                   "-1",        core_options::option_type::INTEGER,    "zlib compression level for PNG snapshots and MNG movies (0 = none, 1 = fastest, 9 = smallest, -1 = default)" },
 	{ OPTION_STATENAME,                                  "%g",        core_options::option_type::STRING,     "override of the default state subfolder naming; %g == gamename" },
 	{ OPTION_BURNIN,                                     "0",         core_options::option_type::BOOLEAN,    "create burn-in snapshots for each screen" },
 
@@ -95,6 +102,30 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       core_options::option_type::FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         core_options::option_type::BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         core_options::option_type::BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_FRAME_DELAY ";fd(0-9)",                     "0",         core_options::option_type::INTEGER,    "hold back the start of each frame by this many tenths of a frame, so input is read closer to the frame being shown (upper limit with autoframedelay, 0 = 9)" },
+	{ OPTION_AUTO_FRAME_DELAY ";afd",                    "0",         core_options::option_type::BOOLEAN,    "hold back the start of each frame by as much as measured emulation times allow" },
+	{ OPTION_PARALLEL_EXEC ";pexec",                     "0",         core_options::option_type::BOOLEAN,    "execute independent device groups declared by the system on multiple threads" },
+	{ OPTION_TIMER_QUEUE,                                "list",      core_options::option_type::STRING,     "active timer queue implementation: list (sorted list) or heap (binary heap, for systems with many live timers)" },
+	{ OPTION_EXEC_STATS,                                 nullptr,     core_options::option_type::PATH,       "write per-device execution statistics (including host time) to this JSON file on exit" },
+	{ OPTION_BENCH_LOG,                                  nullptr,     core_options::option_type::PATH,       "write per-frame emulated and wall-clock timings to this CSV file on exit, or to a JSON file with a summary if it ends in .json" },
+	{ OPTION_ADAPTIVE_QUANTUM ";aq",                     "0",         core_options::option_type::BOOLEAN,    "relax the system's perfect interleave while devices are not synchronizing with each other" },
+	{ OPTION_FROZEN_MAP,                                 "0",         core_options::option_type::BOOLEAN,    "access plain RAM/ROM pages directly, bypassing the handler dispatch, until the address map changes" },
+	{ OPTION_MEM_TRACE,                                  nullptr,     core_options::option_type::PATH,       "record every memory access of every address space to this binary trace file (see memtracesum)" },
+	{ OPTION_COVERAGE,                                   nullptr,     core_options::option_type::PATH,       "record the PCs executed by every CPU and write them to this binary bitmap file on exit (interpreters only; use with -nodrc)" },
+	{ OPTION_IDLE_SKIP,                                  "0",         core_options::option_type::BOOLEAN,    "skip the rest of a CPU's timeslice when it goes round a short loop without changing registers or writing anything (cores that report their loops only)" },
+	{ OPTION_TILEMAP_BANDS "(0-16)",                     "0",         core_options::option_type::INTEGER,    "split tall tilemap draws into this many horizontal bands drawn on worker threads (0 or 1 = disabled)" },
+	{ OPTION_GFX_CACHE,                                  "0",         core_options::option_type::BOOLEAN,    "keep decoded ROM graphics in the NVRAM directory and reuse them while the ROMs are unchanged" },
+	{ OPTION_MAP_ROMS,                                   "0",         core_options::option_type::BOOLEAN,    "map uncompressed ROM files that make up a whole region copy-on-write instead of reading them, sharing their memory with other instances" },
+	{ OPTION_HUGE_PAGES,                                 "0",         core_options::option_type::BOOLEAN,    "back recompiler caches and large RAM and ROM regions with huge pages where the host allows it, to reduce TLB misses" },
+	{ OPTION_CHD_CACHE "(0-4096)",                       "0",         core_options::option_type::INTEGER,    "megabytes of decompressed hunks to keep for each compressed CHD, besides the few read ahead of sequential access" },
+	{ OPTION_PRIM_CACHE,                                 "0",         core_options::option_type::BOOLEAN,    "redisplay the previous render primitive list while the view, layout item states and containers are unchanged" },
+	{ OPTION_PARALLEL_SOUND,                             "0",         core_options::option_type::BOOLEAN,    "update independent groups of sound streams on multiple threads before mixing the speakers" },
+	{ OPTION_RESAMPLER,                                  "simple",    core_options::option_type::STRING,     "sample rate converter between sound streams: simple (point sampling or box averaging) or polyphase (windowed-sinc FIR, less aliasing)" },
+	{ OPTION_AUDIO_SYNC,                                 "0",         core_options::option_type::BOOLEAN,    "adjust emulation speed very slightly to hold the OSD sound buffer at its target fill, for small audio buffers" },
+	{ OPTION_RUNAHEAD,                                   "0",         core_options::option_type::INTEGER,    "number of frames to emulate ahead of the one shown and roll back, hiding the system's own input lag" },
+	{ OPTION_RUNAHEAD_SNAPSHOT,                          "0",         core_options::option_type::BOOLEAN,    "keep large blocks of mapped RAM in copy-on-write memory, so running ahead only copies the pages each frame writes (Linux only)" },
+	{ OPTION_TURBO_SECONDS,                              "0",         core_options::option_type::INTEGER,    "number of emulated seconds to run in turbo mode (no screen updates, rendering or final sound mix) before carrying on normally" },
+	{ OPTION_CASSETTE_TURBO,                             "0",         core_options::option_type::BOOLEAN,    "run in turbo mode while a cassette is being read, until its motor stops or the tape is stopped" },
 
 	// render options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE RENDER OPTIONS" },
@@ -164,8 +195,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_JOYSTICK_SATURATION ";joy_saturation;jsat(0.00-1)",  "0.85", core_options::option_type::FLOAT,  "end of axis saturation range for joystick where change is ignored (0.0 center, 1.0 end)" },
 	{ OPTION_JOYSTICK_THRESHOLD ";joy_threshold;jthresh(0.00-1)", "0.3",  core_options::option_type::FLOAT,  "threshold for joystick to be considered active as a switch (0.0 center, 1.0 end)" },
 	{ OPTION_NATURAL_KEYBOARD ";nat",                    "0",         core_options::option_type::BOOLEAN,    "specifies whether to use a natural keyboard or not" },
+	{ OPTION_NATURAL_FAST ";natfast",                    "0",         core_options::option_type::BOOLEAN,    "type pasted text as soon as the emulated keyboard has been scanned, running unthrottled until it's done" },
 	{ OPTION_JOYSTICK_CONTRADICTORY ";joy_contradictory","0",         core_options::option_type::BOOLEAN,    "enable contradictory direction digital joystick input at the same time" },
 	{ OPTION_COIN_IMPULSE,                               "0",         core_options::option_type::INTEGER,    "set coin impulse time (n<0 disable impulse, n==0 obey driver, 0<n set time n)" },
+	{ OPTION_INPUT_LATCH "(0-100000)",                  "0",         core_options::option_type::INTEGER,    "poll host inputs again when emulated code reads an input port, at most once per this many emulated microseconds (0 = once per frame)" },
 
 	// input autoenable options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE INPUT AUTOMATIC ENABLE OPTIONS" },
@@ -202,6 +235,11 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         core_options::option_type::BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         core_options::option_type::BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         core_options::option_type::BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_PROFILE,                                "0",         core_options::option_type::BOOLEAN,    "count DRC block entries and exits and write a hot block report on exit" },
+	{ OPTION_DRC_WARM_CACHE,                             "",          core_options::option_type::PATH,       "directory for DRC entry point lists used to precompile hot code at startup (empty to disable)" },
+	{ OPTION_DRC_COMPILE_BUDGET "(0-1000000)",           "0",         core_options::option_type::INTEGER,    "host microseconds of DRC compilation per emulated frame before CPUs with an interpreter fall back to it (0 = unlimited)" },
+	{ OPTION_DRC_CACHE_SEGMENTS "(0-64)",                "0",         core_options::option_type::INTEGER,    "split the DRC code cache into segments and evict the oldest one when full instead of flushing everything (0 = disabled)" },
+	{ OPTION_DRC_BASELINE,                                "0",         core_options::option_type::BOOLEAN,    "restrict native DRC code generation to the baseline host instruction set" },
 	{ OPTION_BIOS,                                       nullptr,     core_options::option_type::STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         core_options::option_type::BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         core_options::option_type::BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -221,12 +259,19 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_PLUGINS,                                    "1",         core_options::option_type::BOOLEAN,    "enable Lua plugin support" },
 	{ OPTION_PLUGIN,                                     nullptr,     core_options::option_type::STRING,     "list of plugins to enable" },
 	{ OPTION_NO_PLUGIN,                                  nullptr,     core_options::option_type::STRING,     "list of plugins to disable" },
+	{ OPTION_LUA_FRAME_BUDGET,                           "0",         core_options::option_type::FLOAT,      "warn when Lua frame callbacks take longer than this many milliseconds in a frame (0 = no limit)" },
 
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "HTTP SERVER OPTIONS" },
 	{ OPTION_HTTP,                                       "0",         core_options::option_type::BOOLEAN,    "enable HTTP server" },
 	{ OPTION_HTTP_PORT,                                  "8080",      core_options::option_type::INTEGER,    "HTTP server port" },
 	{ OPTION_HTTP_ROOT,                                  "web",       core_options::option_type::PATH,       "HTTP server document root" },
 
+	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "NETPLAY OPTIONS" },
+	{ OPTION_NETPLAY_LISTEN,                             "0",         core_options::option_type::INTEGER,    "host a two player session on this UDP port" },
+	{ OPTION_NETPLAY_CONNECT,                            nullptr,     core_options::option_type::STRING,     "join the two player session at host:port as player 2" },
+	{ OPTION_NETPLAY_DELAY "(0-16)",                     "1",         core_options::option_type::INTEGER,    "frames of delay added to local inputs" },
+	{ OPTION_NETPLAY_ROLLBACK "(1-32)",                  "8",         core_options::option_type::INTEGER,    "frames that can be rolled back to correct predicted inputs" },
+
 	{ nullptr }
 };
 
@@ -48,12 +48,17 @@
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
 #define OPTION_SHARE_DIRECTORY      "share_directory"
+#define OPTION_HASH_CACHE           "hashcache"
+#define OPTION_REGION_CACHE         "regioncache"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
+#define OPTION_REWIND_DIRTY         "rewind_dirty"
+#define OPTION_STATE_CODEC          "state_codec"
+#define OPTION_STATE_BACKGROUND     "state_background"
 #define OPTION_PLAYBACK             "playback"
 #define OPTION_RECORD               "record"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
@@ -64,6 +69,8 @@
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
 #define OPTION_SNAPBILINEAR         "snapbilinear"
+#define OPTION_SNAPBANDS            "snapbands"
+#define OPTION_SNAPCOMPRESSION      "snapcompression"
 #define OPTION_STATENAME            "statename"
 #define OPTION_BURNIN               "burnin"
 
@@ -76,6 +83,30 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_FRAME_DELAY          "framedelay"
+#define OPTION_AUTO_FRAME_DELAY     "autoframedelay"
+#define OPTION_PARALLEL_EXEC        "parallelexec"
+#define OPTION_TIMER_QUEUE          "timerqueue"
+#define OPTION_EXEC_STATS           "execstats"
+#define OPTION_BENCH_LOG            "bench_log"
+#define OPTION_ADAPTIVE_QUANTUM     "adaptive_quantum"
+#define OPTION_FROZEN_MAP           "frozenmap"
+#define OPTION_MEM_TRACE            "memtrace"
+#define OPTION_COVERAGE             "coverage"
+#define OPTION_IDLE_SKIP            "idleskip"
+#define OPTION_TILEMAP_BANDS        "tilemapbands"
+#define OPTION_GFX_CACHE            "gfxcache"
+#define OPTION_MAP_ROMS             "maproms"
+#define OPTION_HUGE_PAGES           "hugepages"
+#define OPTION_CHD_CACHE            "chdcache"
+#define OPTION_PRIM_CACHE           "primcache"
+#define OPTION_PARALLEL_SOUND       "parallelsound"
+#define OPTION_RESAMPLER            "resampler"
+#define OPTION_AUDIO_SYNC           "audiosync"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_RUNAHEAD_SNAPSHOT    "runahead_snapshot"
+#define OPTION_TURBO_SECONDS        "turbo_seconds"
+#define OPTION_CASSETTE_TURBO       "cassette_turbo"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -138,8 +169,10 @@
 #define OPTION_JOYSTICK_SATURATION  "joystick_saturation"
 #define OPTION_JOYSTICK_THRESHOLD   "joystick_threshold"
 #define OPTION_NATURAL_KEYBOARD     "natural"
+#define OPTION_NATURAL_FAST         "natural_fast"
 #define OPTION_JOYSTICK_CONTRADICTORY   "joystick_contradictory"
 #define OPTION_COIN_IMPULSE         "coin_impulse"
+#define OPTION_INPUT_LATCH          "input_latch"
 
 // input autoenable options
 #define OPTION_PADDLE_DEVICE        "paddle_device"
@@ -165,6 +198,11 @@
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_PROFILE          "drc_profile"
+#define OPTION_DRC_WARM_CACHE       "drc_warmcache"
+#define OPTION_DRC_COMPILE_BUDGET   "drc_compile_budget"
+#define OPTION_DRC_CACHE_SEGMENTS   "drc_cache_segments"
+#define OPTION_DRC_BASELINE         "drc_baseline"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -191,6 +229,7 @@
 #define OPTION_PLUGINS              "plugins"
 #define OPTION_PLUGIN               "plugin"
 #define OPTION_NO_PLUGIN            "noplugin"
+#define OPTION_LUA_FRAME_BUDGET     "lua_frame_budget"
 
 #define OPTION_LANGUAGE             "language"
 
@@ -198,6 +237,11 @@
 #define OPTION_HTTP_PORT            "http_port"
 #define OPTION_HTTP_ROOT            "http_root"
 
+#define OPTION_NETPLAY_LISTEN       "netplay_listen"
+#define OPTION_NETPLAY_CONNECT      "netplay_connect"
+#define OPTION_NETPLAY_DELAY        "netplay_delay"
+#define OPTION_NETPLAY_ROLLBACK     "netplay_rollback"
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -334,12 +378,17 @@ public:
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
 	const char *share_directory() const { return value(OPTION_SHARE_DIRECTORY); }
+	const char *hash_cache() const { return value(OPTION_HASH_CACHE); }
+	const char *region_cache() const { return value(OPTION_REGION_CACHE); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
+	bool rewind_dirty() const { return bool_value(OPTION_REWIND_DIRTY); }
+	const char *state_codec() const { return value(OPTION_STATE_CODEC); }
+	bool state_background() const { return bool_value(OPTION_STATE_BACKGROUND); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
@@ -350,6 +399,8 @@ public:
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
 	bool snap_bilinear() const { return bool_value(OPTION_SNAPBILINEAR); }
+	int snap_bands() const { return int_value(OPTION_SNAPBANDS); }
+	int snap_compression() const { return int_value(OPTION_SNAPCOMPRESSION); }
 	const char *state_name() const { return value(OPTION_STATENAME); }
 	bool burnin() const { return bool_value(OPTION_BURNIN); }
 
@@ -362,6 +413,30 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	int frame_delay() const { return int_value(OPTION_FRAME_DELAY); }
+	bool auto_frame_delay() const { return bool_value(OPTION_AUTO_FRAME_DELAY); }
+	bool parallel_exec() const { return bool_value(OPTION_PARALLEL_EXEC); }
+	const char *timer_queue() const { return value(OPTION_TIMER_QUEUE); }
+	const char *exec_stats() const { return value(OPTION_EXEC_STATS); }
+	const char *bench_log() const { return value(OPTION_BENCH_LOG); }
+	bool adaptive_quantum() const { return bool_value(OPTION_ADAPTIVE_QUANTUM); }
+	bool frozen_map() const { return bool_value(OPTION_FROZEN_MAP); }
+	const char *mem_trace() const { return value(OPTION_MEM_TRACE); }
+	const char *coverage() const { return value(OPTION_COVERAGE); }
+	bool idle_skip() const { return bool_value(OPTION_IDLE_SKIP); }
+	int tilemap_bands() const { return int_value(OPTION_TILEMAP_BANDS); }
+	bool gfx_cache() const { return bool_value(OPTION_GFX_CACHE); }
+	bool map_roms() const { return bool_value(OPTION_MAP_ROMS); }
+	bool huge_pages() const { return bool_value(OPTION_HUGE_PAGES); }
+	int chd_cache() const { return int_value(OPTION_CHD_CACHE); }
+	bool prim_cache() const { return bool_value(OPTION_PRIM_CACHE); }
+	bool parallel_sound() const { return bool_value(OPTION_PARALLEL_SOUND); }
+	const char *resampler() const { return value(OPTION_RESAMPLER); }
+	bool audio_sync() const { return bool_value(OPTION_AUDIO_SYNC); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	bool runahead_snapshot() const { return bool_value(OPTION_RUNAHEAD_SNAPSHOT); }
+	int turbo_seconds() const { return int_value(OPTION_TURBO_SECONDS); }
+	bool cassette_turbo() const { return bool_value(OPTION_CASSETTE_TURBO); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -432,8 +507,10 @@ public:
 	bool ui_active() const { return bool_value(OPTION_UI_ACTIVE); }
 	bool offscreen_reload() const { return bool_value(OPTION_OFFSCREEN_RELOAD); }
 	bool natural_keyboard() const { return bool_value(OPTION_NATURAL_KEYBOARD); }
+	bool natural_fast() const { return bool_value(OPTION_NATURAL_FAST); }
 	bool joystick_contradictory() const { return m_joystick_contradictory; }
 	int coin_impulse() const { return m_coin_impulse; }
+	int input_latch() const { return int_value(OPTION_INPUT_LATCH); }
 
 	// core debugging options
 	bool log() const { return bool_value(OPTION_LOG); }
@@ -449,6 +526,11 @@ public:
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_profile() const { return bool_value(OPTION_DRC_PROFILE); }
+	const char *drc_warm_cache() const { return value(OPTION_DRC_WARM_CACHE); }
+	int drc_compile_budget() const { return int_value(OPTION_DRC_COMPILE_BUDGET); }
+	int drc_cache_segments() const { return int_value(OPTION_DRC_CACHE_SEGMENTS); }
+	bool drc_baseline() const { return bool_value(OPTION_DRC_BASELINE); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -478,6 +560,7 @@ public:
 
 	const char *plugin() const { return value(OPTION_PLUGIN); }
 	const char *no_plugin() const { return value(OPTION_NO_PLUGIN); }
+	float lua_frame_budget() const { return float_value(OPTION_LUA_FRAME_BUDGET); }
 
 	const char *language() const { return value(OPTION_LANGUAGE); }
 
@@ -486,6 +569,12 @@ public:
 	short http_port() const { return int_value(OPTION_HTTP_PORT); }
 	const char *http_root() const { return value(OPTION_HTTP_ROOT); }
 
+	// Netplay options
+	int netplay_listen() const { return int_value(OPTION_NETPLAY_LISTEN); }
+	const char *netplay_connect() const { return value(OPTION_NETPLAY_CONNECT); }
+	int netplay_delay() const { return int_value(OPTION_NETPLAY_DELAY); }
+	int netplay_rollback() const { return int_value(OPTION_NETPLAY_ROLLBACK); }
+
 	// slots and devices - the values for these are stored outside of the core_options
 	// structure
 	const ::slot_option &slot_option(const std::string &device_name) const;
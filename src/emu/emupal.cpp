@@ -115,6 +115,8 @@ palette_device::palette_device(const machine_config &mconfig, const char *tag, d
 	, m_prom_region(*this, finder_base::DUMMY_TAG)
 	, m_init(*this)
 	, m_raw_to_rgb()
+	, m_dirty_first(~u32(0))
+	, m_dirty_last(0)
 {
 }
 
@@ -379,8 +381,9 @@ palette_device &palette_device::set_format(xbgrbbbbggggrrrr_bit0_t, u32 entries)
 
 //-------------------------------------------------
 //  update_for_write - given a write of a given
-//  length to a given byte offset, update all
-//  potentially modified palette entries
+//  length to a given byte offset, mark all
+//  potentially modified palette entries to be
+//  updated when the colors are next used
 //-------------------------------------------------
 
 inline void palette_device::update_for_write(offs_t byte_offset, int bytes_modified, bool indirect)
@@ -392,15 +395,42 @@ inline void palette_device::update_for_write(offs_t byte_offset, int bytes_modif
 	assert(bpe != 0);
 	int count = (bytes_modified + bpe - 1) / bpe;
 
-	// for each entry modified, fetch the palette data and set the pen color or indirect color
+	// mark each entry modified; the memory may be bigger than the palette, so grow as needed
 	offs_t base = byte_offset / bpe;
+	u32 const last = (base + count - 1) / 32;
+	if (UNEXPECTED(last >= m_dirty.size()))
+		m_dirty.resize(last + 1, 0);
 	for (int index = 0; index < count; index++)
+		m_dirty[(base + index) / 32] |= u32(1) << ((base + index) % 32);
+	m_dirty_first = std::min<u32>(m_dirty_first, base / 32);
+	m_dirty_last = std::max<u32>(m_dirty_last, last);
+	set_pending();
+}
+
+
+//-------------------------------------------------
+//  palette_update_pending - fetch the palette data
+//  for every entry written since the last time
+//  and set the pen color or indirect color
+//-------------------------------------------------
+
+void palette_device::palette_update_pending()
+{
+	bool const indirect = m_indirect_entries != 0;
+	for (u32 word = m_dirty_first; word <= m_dirty_last; word++)
 	{
-		if (indirect)
-			set_indirect_color(base + index, m_raw_to_rgb(read_entry(base + index)));
-		else
-			set_pen_color(base + index, m_raw_to_rgb(read_entry(base + index)));
+		for (u32 bits = m_dirty[word]; bits; bits &= bits - 1)
+		{
+			pen_t const index = word * 32 + (31 - count_leading_zeros_32(bits & -bits));
+			if (indirect)
+				set_indirect_color(index, m_raw_to_rgb(read_entry(index)));
+			else
+				set_pen_color(index, m_raw_to_rgb(read_entry(index)));
+		}
+		m_dirty[word] = 0;
 	}
+	m_dirty_first = ~u32(0);
+	m_dirty_last = 0;
 }
 
 
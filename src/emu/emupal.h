@@ -383,6 +383,7 @@ protected:
 	virtual u32 palette_indirect_entries() const noexcept override { return m_indirect_entries; }
 	virtual bool palette_shadows_enabled() const noexcept override { return m_enable_shadows; }
 	virtual bool palette_hilights_enabled() const noexcept override { return m_enable_hilights; }
+	virtual void palette_update_pending() override;
 
 	// generic palette init routines
 	void palette_init_all_black(palette_device &palette);
@@ -421,6 +422,11 @@ private:
 	raw_to_rgb_converter m_raw_to_rgb;          // format of palette RAM
 	memory_array        m_paletteram;           // base memory
 	memory_array        m_paletteram_ext;       // extended memory
+
+	// entries written since the colors were last brought up to date
+	std::vector<u32>    m_dirty;                // one bit per entry
+	u32                 m_dirty_first;          // first word of m_dirty with a bit set
+	u32                 m_dirty_last;           // last word of m_dirty with a bit set
 };
 
 
@@ -146,6 +146,7 @@ public:
 	// getters
 	operator util::core_file &();
 	bool is_open() const { return bool(m_file); }
+	bool is_archived() const { return m_zipfile || !m_zipdata.empty(); }
 	const char *filename() const { return m_filename.c_str(); }
 	const char *fullpath() const { return m_fullpath.c_str(); }
 	u32 openflags() const { return m_openflags; }
@@ -0,0 +1,223 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    footprint.cpp
+
+    Host memory used by a running machine, by owner.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "footprint.h"
+
+#include "render.h"
+#include "screen.h"
+#include "tilemap.h"
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+
+//**************************************************************************
+//  FOOTPRINT MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  footprint_manager - constructor
+//-------------------------------------------------
+
+footprint_manager::footprint_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_next_publish(0)
+{
+}
+
+
+//-------------------------------------------------
+//  add - register an allocation by its owner
+//-------------------------------------------------
+
+void footprint_manager::add(std::string &&owner, std::string &&kind, std::function<u64 ()> &&bytes)
+{
+	m_sources.emplace_back(source{ std::move(owner), std::move(kind), std::move(bytes) });
+}
+
+
+//-------------------------------------------------
+//  collect - find everything the machine has
+//  allocated, combining like entries
+//-------------------------------------------------
+
+std::vector<footprint_manager::usage> footprint_manager::collect() const
+{
+	std::map<std::pair<std::string, std::string>, u64> totals;
+	auto const tally =
+			[&totals] (std::string_view owner, std::string_view kind, u64 bytes)
+			{
+				if (bytes)
+					totals[std::make_pair(std::string(owner), std::string(kind))] += bytes;
+			};
+
+	// memory regions and shares
+	for (auto const &region : m_machine.memory().regions())
+		tally(region.first, "region", region.second->bytes());
+	for (auto const &share : m_machine.memory().shares())
+		tally(share.first, "share", share.second->bytes());
+
+	// decoded graphics
+	for (device_gfx_interface &gfx : gfx_interface_enumerator(m_machine.root_device()))
+	{
+		for (int index = 0; index < MAX_GFX_ELEMENTS; index++)
+		{
+			if (gfx.gfx(index))
+				tally(gfx.device().tag(), "gfx", gfx.gfx(index)->decoded_bytes());
+		}
+	}
+
+	// tilemap pixmaps and tables
+	for (tilemap_t *tilemap = m_machine.tilemap().first(); tilemap; tilemap = tilemap->next())
+		tally(tilemap->device().tag(), "tilemap", tilemap->allocated_bytes());
+
+	// screen bitmaps
+	for (screen_device &screen : screen_device_enumerator(m_machine.root_device()))
+		tally(screen.tag(), "screen", screen.bitmap_bytes());
+
+	// sound stream buffers
+	for (auto const &stream : m_machine.sound().streams())
+		tally(stream->device().tag(), "sound", stream->buffer_bytes());
+
+	// textures scaled for the OSD
+	tally("render", "texture", m_machine.render().scaled_texture_bytes());
+
+	// rewind states, and what each device registers for saving
+	if (m_machine.save().rewind())
+		tally("save", "rewind", m_machine.save().rewind()->stored_size());
+	for (auto const &registered : m_machine.save().registered_bytes())
+		tally(registered.first, "state", registered.second);
+
+	// registered allocations
+	for (source const &src : m_sources)
+		tally(src.owner, src.kind, src.bytes());
+
+	std::vector<usage> result;
+	result.reserve(totals.size());
+	for (auto &total : totals)
+		result.emplace_back(usage{ total.first.first, total.first.second, total.second, total.first.second != "state" });
+	std::stable_sort(
+			result.begin(),
+			result.end(),
+			[] (usage const &a, usage const &b) { return a.bytes > b.bytes; });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  report - print the footprint as verbose output
+//-------------------------------------------------
+
+void footprint_manager::report() const
+{
+	std::vector<usage> const usages = collect();
+
+	u64 total = 0;
+	std::map<std::string, u64> kinds;
+	for (usage const &u : usages)
+	{
+		if (u.counted)
+			total += u.bytes;
+		kinds[u.kind] += u.bytes;
+	}
+
+	osd_printf_verbose("Memory footprint: %.1f MiB\n", double(total) / double(1 << 20));
+	for (auto const &kind : kinds)
+		osd_printf_verbose("  %-10s %12u KiB\n", kind.first, unsigned((kind.second + 1023) >> 10));
+	osd_printf_verbose("By owner:\n");
+	for (usage const &u : usages)
+		osd_printf_verbose("  %-32s %-10s %12u KiB%s\n", u.owner, u.kind, unsigned((u.bytes + 1023) >> 10), u.counted ? "" : " (not counted)");
+}
+
+
+//-------------------------------------------------
+//  start_publishing - take snapshots for the
+//  HTTP server from now on
+//-------------------------------------------------
+
+void footprint_manager::start_publishing()
+{
+	m_machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&footprint_manager::frame, this));
+}
+
+
+//-------------------------------------------------
+//  published - return the last snapshot
+//-------------------------------------------------
+
+std::string footprint_manager::published() const
+{
+	std::lock_guard<std::mutex> lock(m_published_lock);
+	return m_published;
+}
+
+
+//-------------------------------------------------
+//  frame - take a snapshot if it's time, without
+//  waiting for the server to finish reading
+//-------------------------------------------------
+
+void footprint_manager::frame()
+{
+	osd_ticks_t const now = osd_ticks();
+	if (now < m_next_publish)
+		return;
+	m_next_publish = now + osd_ticks_per_second();
+
+	std::string snapshot = json();
+	std::unique_lock<std::mutex> lock(m_published_lock, std::try_to_lock);
+	if (lock.owns_lock())
+		m_published = std::move(snapshot);
+}
+
+
+//-------------------------------------------------
+//  json - format the footprint as JSON
+//-------------------------------------------------
+
+std::string footprint_manager::json() const
+{
+	std::vector<usage> const usages = collect();
+	u64 total = 0;
+	for (usage const &u : usages)
+	{
+		if (u.counted)
+			total += u.bytes;
+	}
+
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("total");
+	writer.Uint64(total);
+	writer.Key("usage");
+	writer.StartArray();
+	for (usage const &u : usages)
+	{
+		writer.StartObject();
+		writer.Key("owner");
+		writer.String(u.owner.c_str());
+		writer.Key("kind");
+		writer.String(u.kind.c_str());
+		writer.Key("bytes");
+		writer.Uint64(u.bytes);
+		writer.Key("counted");
+		writer.Bool(u.counted);
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+	return s.GetString();
+}
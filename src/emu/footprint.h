@@ -0,0 +1,95 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    footprint.h
+
+    Host memory used by a running machine, by owner.
+
+****************************************************************************
+
+    The big allocations a machine makes are spread across the core:
+    memory regions and shares, decoded graphics, tilemap pixmaps, screen
+    bitmaps, sound stream buffers, scaled render textures and rewind
+    states.  The footprint manager finds all of these when asked and
+    attributes each to the device (or region, share or subsystem) that
+    owns it.  Anything else - DRC caches, for instance - can be added by
+    whatever allocates it, as a function returning its current size.
+
+    Registered save state is listed too, as it shows what each device
+    keeps.  Most of it lives inside the allocations above or inside the
+    devices themselves, so it isn't counted in the total.
+
+    With -verbose the footprint is printed on exit.  It's also available
+    to Lua as manager.machine.memory_footprint, and from the HTTP server
+    as JSON at /memory.  The server gets a snapshot the emulation takes
+    once a second, as it can't walk the machine from its own thread.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_FOOTPRINT_H
+#define MAME_EMU_FOOTPRINT_H
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+// ======================> footprint_manager
+
+class footprint_manager
+{
+public:
+	// one owner's use of memory for one purpose
+	struct usage
+	{
+		std::string             owner;              // device tag, region or share name, or subsystem
+		std::string             kind;               // what the memory is for
+		u64                     bytes;              // how much of it there is
+		bool                    counted;            // whether it's included in the total
+	};
+
+	// construction/destruction
+	footprint_manager(running_machine &machine);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// register an allocation the core can't find for itself
+	void add(std::string &&owner, std::string &&kind, std::function<u64 ()> &&bytes);
+
+	// everything, largest first, with like entries for the same owner combined
+	std::vector<usage> collect() const;
+
+	// print the footprint as verbose output
+	void report() const;
+
+	// take a JSON snapshot once a second for the HTTP server
+	void start_publishing();
+
+	// most recently published snapshot; safe to call from any thread
+	std::string published() const;
+
+private:
+	void frame();
+	std::string json() const;
+
+	struct source
+	{
+		std::string             owner;
+		std::string             kind;
+		std::function<u64 ()>   bytes;
+	};
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::vector<source>         m_sources;          // registered allocations
+	osd_ticks_t                 m_next_publish;     // when to next publish a snapshot
+	mutable std::mutex          m_published_lock;   // guards m_published
+	std::string                 m_published;        // last published snapshot
+};
+
+#endif // MAME_EMU_FOOTPRINT_H
@@ -0,0 +1,159 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    hashcache.cpp
+
+    Persistent cache of ROM file hashes.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "hashcache.h"
+
+#include "fileio.h"
+
+#include "corestr.h"
+
+#include <chrono>
+
+
+//**************************************************************************
+//  HASH CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  hash_cache - constructor, reading the entries
+//  saved last time if there are any
+//-------------------------------------------------
+
+hash_cache::hash_cache(std::string_view filename)
+	: m_filename(filename)
+	, m_dirty(false)
+{
+	util::core_file::ptr file;
+	if (util::core_file::open(m_filename, OPEN_FLAG_READ, file))
+		return;
+
+	char buffer[4096];
+	while (file->gets(buffer, std::size(buffer)))
+	{
+		// the hashes follow the last tab, the identity is everything before it
+		std::string_view const line = strtrimrightspace(std::string_view(buffer));
+		std::string_view::size_type const split = line.rfind('\t');
+		if ((line.empty()) || (line[0] == '#') || (split == std::string_view::npos))
+			continue;
+		m_entries.emplace(line.substr(0, split), line.substr(split + 1));
+	}
+}
+
+
+//-------------------------------------------------
+//  key - build the identity of an open file
+//-------------------------------------------------
+
+std::string hash_cache::key(emu_file &file)
+{
+	// archive members come with the CRC from the archive directory
+	u32 crc;
+	if (file.hashes("").crc(crc))
+		return util::string_format("%s\t%u\tcrc:%08x", file.fullpath(), file.size(), crc);
+
+	// loose files are trusted as long as they haven't been modified
+	std::unique_ptr<osd::directory::entry> const stat = osd_stat(file.fullpath());
+	if (!stat)
+		return std::string();
+	return util::string_format("%s\t%u\tmtime:%d", file.fullpath(), file.size(), stat->last_modified.time_since_epoch().count());
+}
+
+
+//-------------------------------------------------
+//  find - fill in the hashes cached for a file if
+//  they cover all the types asked for
+//-------------------------------------------------
+
+bool hash_cache::find(std::string const &key, std::string_view types, util::hash_collection &hashes) const
+{
+	if (key.empty())
+		return false;
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	auto const found = m_entries.find(key);
+	if (found == m_entries.end())
+		return false;
+
+	util::hash_collection const cached(found->second);
+	std::string const have = cached.hash_types();
+	for (char const type : types)
+		if (have.find(type) == std::string::npos)
+			return false;
+
+	hashes = cached;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  add - remember the hashes computed for a file
+//-------------------------------------------------
+
+void hash_cache::add(std::string &&key, util::hash_collection const &hashes)
+{
+	if (key.empty() || hashes.hash_types().empty())
+		return;
+
+	std::string value = hashes.internal_string();
+	std::lock_guard<std::mutex> guard(m_mutex);
+	auto const found = m_entries.find(key);
+	if (found == m_entries.end())
+	{
+		m_entries.emplace(std::move(key), std::move(value));
+		m_dirty = true;
+	}
+	else if (found->second != value)
+	{
+		found->second = std::move(value);
+		m_dirty = true;
+	}
+}
+
+
+//-------------------------------------------------
+//  hashes - get the requested hashes of an open
+//  file, from the cache if possible
+//-------------------------------------------------
+
+util::hash_collection &hash_cache::hashes(emu_file &file, std::string_view types)
+{
+	std::string identity = key(file);
+	util::hash_collection &result = file.hashes("");
+	if (!find(identity, types, result))
+		add(std::move(identity), file.hashes(types));
+	return result;
+}
+
+
+//-------------------------------------------------
+//  save - write the cache back to its file if any
+//  entries were added
+//-------------------------------------------------
+
+void hash_cache::save()
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+	if (!m_dirty)
+		return;
+
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(m_filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file);
+	if (filerr)
+	{
+		osd_printf_error("Error opening hash cache file %s (%s)\n", m_filename, filerr.message());
+		return;
+	}
+
+	file->puts("# path\tlength\tidentity\thashes\n");
+	for (auto const &entry : m_entries)
+		file->printf("%s\t%s\n", entry.first, entry.second);
+	m_dirty = false;
+}
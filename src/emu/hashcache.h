@@ -0,0 +1,67 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    hashcache.h
+
+    Persistent cache of ROM file hashes.
+
+****************************************************************************
+
+    Maps the identity of a file to the hashes computed from its contents
+    the last time it was read, so ROM loading and auditing don't hash
+    files that haven't changed.  Files are identified by their full path
+    and length, plus the CRC from the archive directory for members of an
+    archive (which also means only the SHA-1 is ever computed for them) or
+    the modification time for loose files.
+
+    The cache is a text file with one tab-separated entry per line, read
+    when the cache is created and written back by save() if anything was
+    added.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_HASHCACHE_H
+#define MAME_EMU_HASHCACHE_H
+
+#pragma once
+
+#include "hash.h"
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+// ======================> hash_cache
+
+class hash_cache
+{
+public:
+	// construction/destruction
+	hash_cache(std::string_view filename);
+
+	// identity of an open file; empty if it can't be cached
+	static std::string key(emu_file &file);
+
+	// lookups and additions
+	bool find(std::string const &key, std::string_view types, util::hash_collection &hashes) const;
+	void add(std::string &&key, util::hash_collection const &hashes);
+
+	// the requested hashes of an open file, computed only if they aren't cached
+	util::hash_collection &hashes(emu_file &file, std::string_view types);
+
+	// write the cache back if it changed
+	void save();
+
+private:
+	// internal state
+	std::string                                     m_filename; // file the cache lives in
+	std::unordered_map<std::string, std::string>    m_entries;  // identity to internal hash string
+	bool                                            m_dirty;    // entries were added since loading
+	mutable std::mutex                              m_mutex;    // auditing threads share a cache
+};
+
+
+#endif // MAME_EMU_HASHCACHE_H
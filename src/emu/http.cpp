@@ -383,8 +383,8 @@ void http_manager::on_open(http_manager::websocket_endpoint_ptr endpoint, std::s
 }
 
 void http_manager::on_message(http_manager::websocket_endpoint_ptr endpoint, std::shared_ptr<webpp::Connection> connection, const std::string &payload, int opcode) {
+	std::lock_guard<std::mutex> lock(m_connections_mutex);
 	if (endpoint->on_message) {
-		std::lock_guard<std::mutex> lock(m_connections_mutex);
 		auto i = m_connections.find(connection.get());
 		if (i != m_connections.end()) {
 			http_manager::websocket_connection_ptr websocket_connection_impl = (*i).second;
@@ -529,8 +529,20 @@ void http_manager::clear() {
 
 	m_server->clear();
 
-	std::lock_guard<std::mutex> lock(m_handlers_mutex);
-	m_handlers.clear();
+	{
+		std::lock_guard<std::mutex> lock(m_handlers_mutex);
+		m_handlers.clear();
+	}
+
+	// endpoints stay registered with the server, but their handlers belong to the machine that's going away
+	std::lock_guard<std::mutex> lock(m_connections_mutex);
+	for (auto &endpoint : m_endpoints)
+	{
+		endpoint.second->on_open = nullptr;
+		endpoint.second->on_message = nullptr;
+		endpoint.second->on_close = nullptr;
+		endpoint.second->on_error = nullptr;
+	}
 }
 
 http_manager::websocket_endpoint_ptr http_manager::add_endpoint(const std::string &path,
@@ -569,6 +581,14 @@ http_manager::websocket_endpoint_ptr http_manager::add_endpoint(const std::strin
 		m_endpoints[path] = endpoint_impl;
 		return endpoint_impl;
 	} else {
+		// take over an endpoint left by a previous machine
+		std::lock_guard<std::mutex> lock(m_connections_mutex);
+		if (!i->second->on_open && !i->second->on_message && !i->second->on_close && !i->second->on_error) {
+			i->second->on_open = std::move(on_open);
+			i->second->on_message = std::move(on_message);
+			i->second->on_close = std::move(on_close);
+			i->second->on_error = std::move(on_error);
+		}
 		return (*i).second;
 	}
 }
@@ -408,7 +408,9 @@ inline void accumulate_axis_value(
 //  input_manager - constructor
 //-------------------------------------------------
 
-input_manager::input_manager(running_machine &machine) : m_machine(machine)
+input_manager::input_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_change_count(0)
 {
 	// reset code memory
 	reset_memory();
@@ -903,6 +905,39 @@ bool input_manager::seq_pressed(const input_seq &seq)
 }
 
 
+//-------------------------------------------------
+//  seq_changed_since - return true if any device
+//  read by the given sequence may have changed
+//  state since the given change count
+//-------------------------------------------------
+
+bool input_manager::seq_changed_since(const input_seq &seq, u64 changes) const
+{
+	for (int codenum = 0; ; codenum++)
+	{
+		input_code const code = seq[codenum];
+		if (code == input_seq::end_code)
+			return false;
+		if (code == input_seq::not_code || code == input_seq::or_code)
+			continue;
+
+		// codes for a class that isn't multi read all of its devices
+		input_device_class const devclass = code.device_class();
+		if (devclass < DEVICE_CLASS_FIRST_VALID || devclass > DEVICE_CLASS_LAST_VALID)
+			continue;
+		input_class const &cls = *m_class[devclass];
+		int const startindex = cls.multi() ? code.device_index() : 0;
+		int const stopindex = cls.multi() ? code.device_index() : cls.maxindex();
+		for (int curindex = startindex; curindex <= stopindex; curindex++)
+		{
+			input_device const *const device = cls.device(curindex);
+			if (device && device->changed_since(changes))
+				return true;
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  seq_axis_value - return the value of an axis
 //  defined in an input sequence
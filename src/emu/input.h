@@ -83,6 +83,11 @@ public:
 	std::string seq_to_tokens(const input_seq &seq) const;
 	void seq_from_tokens(input_seq &seq, std::string_view _token);
 
+	// change tracking for devices that report their changes
+	u64 change_count() const { return m_change_count; }
+	u64 note_change() { return ++m_change_count; }
+	bool seq_changed_since(const input_seq &seq, u64 changes) const;
+
 	// misc
 	bool map_device_to_controller(const devicemap_table &table);
 
@@ -93,6 +98,7 @@ private:
 	// internal state
 	running_machine &   m_machine;
 	input_code          m_switch_memory[64];
+	u64                 m_change_count;
 
 	// classes
 	std::array<std::unique_ptr<input_class>, DEVICE_CLASS_MAXIMUM> m_class;
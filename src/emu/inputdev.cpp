@@ -282,6 +282,8 @@ input_device::input_device(input_manager &manager, std::string_view name, std::s
 	, m_devindex(-1)
 	, m_maxitem(input_item_id(0))
 	, m_internal(internal)
+	, m_reports_changes(false)
+	, m_changed(0)
 	, m_threshold(std::max<s32>(s32(manager.machine().options().joystick_threshold() * osd::input_device::ABSOLUTE_MAX), 1))
 	, m_steadykey_enabled(manager.machine().options().steadykey())
 	, m_lightgun_reload_button(manager.machine().options().offscreen_reload())
@@ -362,6 +364,17 @@ void input_device::set_default_assignments(assignment_vector &&assignments)
 }
 
 
+//-------------------------------------------------
+//  set_changed - note that items may have changed
+//  state since the last poll
+//-------------------------------------------------
+
+void input_device::set_changed()
+{
+	m_changed = m_manager.note_change();
+}
+
+
 //-------------------------------------------------
 //  match_device_id - match device id via
 //  substring search
@@ -161,10 +161,13 @@ public:
 			item_get_state_func getstate,
 			void *internal) override;
 	virtual void set_default_assignments(assignment_vector &&assignments) override;
+	virtual void set_reports_changes() override { m_reports_changes = true; }
+	virtual void set_changed() override;
 
 	// helpers
 	s32 adjust_absolute(s32 value) const { return adjust_absolute_value(value); }
 	bool match_device_id(std::string_view deviceid) const;
+	bool changed_since(u64 changes) const { return !m_reports_changes || m_steadykey_enabled || (m_changed > changes); }
 
 protected:
 	// specific overrides
@@ -181,6 +184,8 @@ private:
 	assignment_vector       m_default_assignments;  // additional assignments
 	input_item_id           m_maxitem;              // maximum item index
 	void *const             m_internal;             // internal callback pointer
+	bool                    m_reports_changes;      // host module calls set_changed when items change
+	u64                     m_changed;              // input manager change count at the last change
 
 	s32 const               m_threshold;            // threshold for treating absolute axis as active
 	bool const              m_steadykey_enabled;    // steadykey enabled for keyboards
@@ -16,6 +16,7 @@
 #include "inputdev.h"
 #include "main.h"
 #include "natkeyboard.h"
+#include "netplay.h"
 #include "profiler.h"
 
 #include "ui/uimain.h"
@@ -1245,7 +1246,7 @@ void ioport_field::frame_update(ioport_value &result)
 	}
 
 	// if the state changed, look for switch down/switch up
-	bool curstate = m_digital_value || machine().input().seq_pressed(seq());
+	bool curstate = m_digital_value || seq_pressed();
 	bool changed = false;
 	if (curstate != m_live->last)
 	{
@@ -1326,6 +1327,56 @@ void ioport_field::frame_update(ioport_value &result)
 }
 
 
+//-------------------------------------------------
+//  latch - refresh the state of a plain digital
+//  field between frames
+//-------------------------------------------------
+
+void ioport_field::latch(ioport_value &result)
+{
+	// anything counted in frames (impulse, toggle, coins) waits for the next frame
+	if (!enabled() || m_live->analog || m_live->lockout || m_live->toggle || m_impulse || (m_type >= IPT_COIN1 && m_type <= IPT_COIN12))
+		return;
+	if (machine().ui().is_menu_active())
+		return;
+
+	bool curstate = m_digital_value || seq_pressed();
+
+	// the same digital joystick restriction as frame_update
+	if (curstate && !m_digital_value && m_live->joystick != nullptr && m_way != 16 && !machine().options().joystick_contradictory())
+	{
+		u8 mask = (m_way == 4) ? m_live->joystick->current4way() : m_live->joystick->current();
+		if (!(mask & (1 << m_live->joydir)))
+			curstate = false;
+	}
+
+	if (curstate)
+		result |= m_mask;
+	else
+		result &= ~m_mask;
+}
+
+
+//-------------------------------------------------
+//  seq_pressed - return whether the standard
+//  sequence is pressed, only evaluating it again
+//  if it or the devices it reads have changed
+//-------------------------------------------------
+
+bool ioport_field::seq_pressed()
+{
+	input_manager &input = machine().input();
+	input_seq const &curseq = seq();
+	if ((curseq != m_live->lastseq) || input.seq_changed_since(curseq, m_live->lastseq_changes))
+	{
+		m_live->lastseq = curseq;
+		m_live->lastseq_changes = input.change_count();
+		m_live->lastseq_pressed = input.seq_pressed(curseq);
+	}
+	return m_live->lastseq_pressed;
+}
+
+
 //-------------------------------------------------
 //  crosshair_read - compute the crosshair
 //  position
@@ -1476,7 +1527,9 @@ ioport_field_live::ioport_field_live(ioport_field &field, analog_field *analog)
 	last(0),
 	toggle(field.toggle()),
 	joydir(digital_joystick::JOYDIR_COUNT),
-	lockout(false)
+	lockout(false),
+	lastseq_changes(0),
+	lastseq_pressed(false)
 {
 	// fill in the basic values
 	for (input_seq_type seqtype = SEQ_TYPE_STANDARD; seqtype < SEQ_TYPE_TOTAL; ++seqtype)
@@ -1589,7 +1642,12 @@ ioport_value ioport_port::read()
 	if (!manager().safe_to_read())
 		throw emu_fatalerror("Input ports cannot be read at init time!");
 
+	// pick up host input that changed since the frame started
+	if (manager().latching())
+		manager().latch_inputs();
+
 	// start with the digital state
+	m_live->reads++;
 	ioport_value result = m_live->digital;
 
 	// insert dynamic read values
@@ -1636,6 +1694,18 @@ void ioport_port::frame_update()
 }
 
 
+//-------------------------------------------------
+//  latch - refresh the plain digital fields
+//  between frames
+//-------------------------------------------------
+
+void ioport_port::latch()
+{
+	for (ioport_field &field : m_fieldlist)
+		field.latch(m_live->digital);
+}
+
+
 //-------------------------------------------------
 //  collapse_fields - remove any fields that are
 //  wholly overlapped by other fields
@@ -1751,7 +1821,8 @@ void ioport_port::update_defvalue(bool flush_defaults)
 ioport_port_live::ioport_port_live(ioport_port &port) :
 	defvalue(0),
 	digital(0),
-	outputvalue(0)
+	outputvalue(0),
+	reads(0)
 {
 	// iterate over fields
 	for (ioport_field &field : port.fields())
@@ -1789,6 +1860,8 @@ ioport_manager::ioport_manager(running_machine &machine) :
 	m_safe_to_read(false),
 	m_last_frame_time(attotime::zero),
 	m_last_delta_nsec(0),
+	m_latch_interval(attotime::zero),
+	m_last_latch_time(attotime::zero),
 	m_playback_accumulated_speed(0),
 	m_playback_accumulated_frames(0),
 	m_deselected_card_config(),
@@ -1886,6 +1959,10 @@ time_t ioport_manager::initialize()
 	// open playback and record files if specified
 	time_t basetime = playback_init();
 	record_init();
+
+	// polling between frames would make recordings depend on host timing
+	if (machine().options().input_latch() && !m_playback_file && !m_record_file)
+		m_latch_interval = attotime::from_usec(machine().options().input_latch());
 	return basetime;
 }
 
@@ -2198,10 +2275,17 @@ void ioport_manager::frame_update()
 	for (auto &port : m_portlist)
 		port.second->update_defvalue(false);
 
+	// during netplay, the digital inputs are whatever both sides agreed on
+	netplay_manager *const netplay = (machine().netplay() && machine().netplay()->running()) ? machine().netplay() : nullptr;
+	if (netplay)
+		netplay->frame_start();
+
 	// loop over all input ports
 	for (auto &port : m_portlist)
 	{
 		port.second->frame_update();
+		if (netplay)
+			netplay->port_update(*port.second.get());
 
 		// handle playback/record
 		playback_port(*port.second.get());
@@ -2216,6 +2300,34 @@ void ioport_manager::frame_update()
 }
 
 
+//-------------------------------------------------
+//  latch_inputs - poll the host when emulated
+//  code reads a port part way through a frame,
+//  at most once per latch interval
+//-------------------------------------------------
+
+void ioport_manager::latch_inputs()
+{
+	// only reads from an executing device count, and never while other
+	// groups are running in parallel or during netplay
+	device_execute_interface *const exec = machine().scheduler().currently_executing();
+	if (!exec || machine().scheduler().parallel_active() || machine().paused() || (machine().netplay() && machine().netplay()->running()))
+		return;
+
+	attotime const curtime = exec->local_time();
+	if ((curtime >= m_last_latch_time) && (curtime < m_last_latch_time + m_latch_interval))
+		return;
+	m_last_latch_time = curtime;
+
+	// the OSD modules rate-limit their own polling, so this doesn't block
+	machine().osd().input_update(false);
+	for (digital_joystick &joystick : m_joystick_list)
+		joystick.frame_update();
+	for (auto &port : m_portlist)
+		port.second->latch();
+}
+
+
 //-------------------------------------------------
 //  frame_interpolate - interpolate between two
 //  values based on the time between frames
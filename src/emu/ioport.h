@@ -650,6 +650,8 @@ public:
 	float crosshair_read() const;
 	void init_live_state(analog_field *analog);
 	void frame_update(ioport_value &result);
+	void latch(ioport_value &result);
+	bool seq_pressed();
 	void reduce_mask(ioport_value bits_to_remove) { m_mask &= ~bits_to_remove; }
 
 	// user-controllable settings for a field
@@ -733,6 +735,9 @@ struct ioport_field_live
 	bool                    toggle;             // current toggle setting
 	digital_joystick::direction_t joydir;       // digital joystick direction index
 	bool                    lockout;            // user lockout
+	input_seq               lastseq;            // sequence last evaluated for the digital state
+	u64                     lastseq_changes;    // input change count when it was evaluated
+	bool                    lastseq_pressed;    // whether it was pressed then
 	std::string             name;               // overridden name
 	std::string             cfg[SEQ_TYPE_TOTAL];// configuration strings
 };
@@ -785,6 +790,7 @@ public:
 	ioport_field *field(ioport_value mask) const;
 	void collapse_fields(std::ostream &errorbuf);
 	void frame_update();
+	void latch();
 	void init_live_state();
 	void update_defvalue(bool flush_defaults);
 
@@ -923,6 +929,7 @@ struct ioport_port_live
 	ioport_value            defvalue;           // combined default value across the port
 	ioport_value            digital;            // current value from all digital inputs
 	ioport_value            outputvalue;        // current value for outputs
+	u32                     reads;              // number of times the port has been read
 };
 
 
@@ -945,6 +952,7 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	const ioport_list &ports() const noexcept { return m_portlist; }
 	bool safe_to_read() const noexcept { return m_safe_to_read; }
+	bool latching() const noexcept { return m_latch_interval != attotime::zero; }
 
 	// type helpers
 	const std::vector<input_type_entry> &types() const noexcept { return m_typelist; }
@@ -960,6 +968,7 @@ public:
 	digital_joystick &digjoystick(int player, int joysticknum);
 	int count_players() const noexcept;
 	s32 frame_interpolate(s32 oldval, s32 newval);
+	void latch_inputs();
 	ioport_type token_to_input_type(const char *string, int &player) const;
 	std::string input_type_to_token(ioport_type type, int player);
 
@@ -1016,6 +1025,10 @@ private:
 	attotime                m_last_frame_time;      // time of the last frame callback
 	attoseconds_t           m_last_delta_nsec;      // nanoseconds that passed since the previous callback
 
+	// polling between frames
+	attotime                m_latch_interval;       // minimum emulated time between polls, zero if disabled
+	attotime                m_last_latch_time;      // local time of the device that last caused a poll
+
 	// playback/record information
 	std::unique_ptr<emu_file> m_record_file;        // recording file (nullptr if not recording)
 	std::unique_ptr<emu_file> m_playback_file;      // playback file (nullptr if not recording)
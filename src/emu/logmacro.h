@@ -21,6 +21,7 @@
 #define LOG_GENERAL (1U << 0)
 #endif
 
-#define LOGMASKED(mask, ...) do { if (VERBOSE & (mask)) (LOG_OUTPUT_FUNC)(__VA_ARGS__); } while (false)
+// with logging disabled, the arguments aren't even instantiated, let alone evaluated
+#define LOGMASKED(mask, ...) do { if constexpr ((VERBOSE) != 0) { if (VERBOSE & (mask)) (LOG_OUTPUT_FUNC)(__VA_ARGS__); } } while (false)
 
 #define LOG(...) LOGMASKED(LOG_GENERAL, __VA_ARGS__)
@@ -10,7 +10,9 @@
 
 #include "emu.h"
 
+#include "benchlog.h"
 #include "config.h"
+#include "coverage.h"
 #include "crsshair.h"
 #include "debug/debugcpu.h"
 #include "debug/debugvw.h"
@@ -18,10 +20,13 @@
 #include "dirtc.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "footprint.h"
 #include "http.h"
 #include "image.h"
 #include "main.h"
+#include "memtrace.h"
 #include "natkeyboard.h"
+#include "netplay.h"
 #include "network.h"
 #include "render.h"
 #include "romload.h"
@@ -76,6 +81,10 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 	, m_saveload_schedule(saveload_schedule::NONE)
 	, m_saveload_schedule_time(attotime::zero)
 	, m_saveload_searchpath(nullptr)
+	, m_save_queue(nullptr)
+	, m_save_item(nullptr)
+	, m_save_result(STATERR_NONE)
+	, m_runahead(0)
 
 	, m_save(*this)
 	, m_memory(*this)
@@ -102,6 +111,10 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 
 running_machine::~running_machine()
 {
+	if (m_save_item)
+		osd_work_item_release(m_save_item);
+	if (m_save_queue)
+		osd_work_queue_free(m_save_queue);
 }
 
 
@@ -143,6 +156,7 @@ void running_machine::start()
 	m_output = std::make_unique<output_manager>(*this);
 	m_render = std::make_unique<render_manager>(*this);
 	m_bookkeeping = std::make_unique<bookkeeping_manager>(*this);
+	m_footprint = std::make_unique<footprint_manager>(*this);
 
 	// allocate a soft_reset timer
 	m_soft_reset_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::soft_reset), this));
@@ -155,6 +169,8 @@ void running_machine::start()
 
 	// create the video manager and UI manager
 	m_video = std::make_unique<video_manager>(*this);
+	if (*options().bench_log() || m_manager.http()->is_active())
+		m_bench_log = std::make_unique<bench_log_manager>(*this, options().bench_log());
 	m_ui = manager().create_ui(*this);
 	m_ui->set_startup_text("Initializing...", true);
 
@@ -213,6 +229,7 @@ void running_machine::start()
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
+	m_rom_load->share_regions();
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
 	// save outputs created before start time
@@ -232,6 +249,20 @@ void running_machine::start()
 	if (filename[0] != 0 && !m_video->is_recording())
 		m_video->begin_recording(filename, movie_recording::format::AVI);
 
+	// start tracing memory accesses if requested
+	filename = options().mem_trace();
+	if (filename[0] != 0)
+		m_memtrace = std::make_unique<memory_trace_manager>(*this, filename);
+
+	// record executed PCs if requested
+	filename = options().coverage();
+	if (filename[0] != 0)
+		m_coverage = std::make_unique<coverage_manager>(*this, filename);
+
+	// set up a network session if asked to; the other side decides what state we start from
+	if (options().netplay_listen() || *options().netplay_connect())
+		m_netplay = std::make_unique<netplay_manager>(*this);
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
@@ -316,6 +347,11 @@ int running_machine::run(bool quiet)
 		if (m_saveload_schedule != saveload_schedule::NONE)
 			handle_saveload();
 
+		// run-ahead relies on rolling back every frame, which the debugger would trip over
+		m_runahead = ((debug_flags & DEBUG_FLAG_ENABLED) || m_netplay) ? 0 : std::max(options().runahead(), 0);
+		if ((m_runahead || m_netplay) && !(system().flags & MACHINE_SUPPORTS_SAVE))
+			osd_printf_warning("Warning: %s requires save states, which are not officially supported for this system\n", m_netplay ? "netplay" : "run-ahead");
+
 		export_http_api();
 
 #if defined(__EMSCRIPTEN__)
@@ -330,7 +366,14 @@ int running_machine::run(bool quiet)
 
 			// execute CPUs if not paused
 			if (!m_paused)
-				m_scheduler.timeslice();
+			{
+				if (m_netplay)
+					m_netplay->timeslice();
+				else if (m_runahead)
+					run_ahead_timeslice();
+				else
+					m_scheduler.timeslice();
+			}
 			// otherwise, just pump video updates through
 			else
 				m_video->frame_update();
@@ -338,7 +381,9 @@ int running_machine::run(bool quiet)
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
+			finish_background_save(false);
 		}
+		finish_background_save(true);
 		m_manager.http()->clear();
 
 		// and out via the exit phase
@@ -349,6 +394,14 @@ int running_machine::run(bool quiet)
 		if (options().nvram_save())
 			nvram_save();
 		m_configuration->save_settings();
+
+		// write execution statistics if requested
+		if (*options().exec_stats())
+			m_scheduler.write_execution_stats(options().exec_stats());
+		if (m_bench_log)
+			m_bench_log->write();
+		if (options().verbose())
+			m_footprint->report();
 	}
 	catch (emu_fatalerror const &fatal)
 	{
@@ -646,6 +699,55 @@ void running_machine::immediate_load(std::string_view filename)
 }
 
 
+//-------------------------------------------------
+//  run_ahead_timeslice - run a timeslice of the
+//  real timeline without showing it; once it
+//  completes a frame, emulate the next few frames
+//  silently, present the last one and roll back
+//-------------------------------------------------
+
+void running_machine::run_ahead_timeslice()
+{
+	m_video->frame_completed();
+	m_video->set_output_suppressed(true);
+	m_scheduler.timeslice();
+	m_video->set_output_suppressed(false);
+	if (!m_video->frame_completed())
+		return;
+
+	// remember the present; it's the only state that uses the copy-on-write snapshots
+	if (!m_runahead_state)
+		m_runahead_state = std::make_unique<ram_state>(m_save, options().runahead_snapshot());
+	if (m_runahead_state->save() != STATERR_NONE)
+	{
+		logerror("Run-ahead disabled: unable to save state\n");
+		m_runahead = 0;
+		return;
+	}
+
+	// run into the future, showing only its last frame
+	m_sound->suppress_output(true);
+	for (int frame = 1; (frame <= m_runahead) && !m_hard_reset_pending && !m_exit_pending; frame++)
+	{
+		m_video->set_output_suppressed(frame < m_runahead);
+		while (!m_video->frame_completed() && !m_hard_reset_pending && !m_exit_pending)
+			m_scheduler.timeslice();
+	}
+	m_video->set_output_suppressed(false);
+
+	// and go back
+	m_video->set_rolling_back(true);
+	const save_error err = m_runahead_state->load();
+	m_video->set_rolling_back(false);
+	m_sound->suppress_output(false);
+	if (err != STATERR_NONE)
+	{
+		logerror("Run-ahead disabled: unable to restore state\n");
+		m_runahead = 0;
+	}
+}
+
+
 //-------------------------------------------------
 //  rewind_capture - capture and append a new
 //  state to the rewind list
@@ -862,8 +964,9 @@ void running_machine::handle_saveload()
 	// if no name, bail
 	if (!m_saveload_pending_file.empty())
 	{
-		const char *const opname = (m_saveload_schedule == saveload_schedule::LOAD) ? "load" : "save";
-		const char *const preposname = (m_saveload_schedule == saveload_schedule::LOAD) ? "from" : "to";
+		const bool load = m_saveload_schedule == saveload_schedule::LOAD;
+		const char *const opname = load ? "load" : "save";
+		const char *const preposname = load ? "from" : "to";
 
 		// if there are anonymous timers, we can't save just yet, and we can't load yet either
 		// because the timers might overwrite data we have loaded
@@ -875,51 +978,63 @@ void running_machine::handle_saveload()
 			else
 				return; // return without cancelling the operation
 		}
+		else if (load && m_netplay && m_netplay->running())
+		{
+			// the other side would carry on from where we were
+			popmessage("Error: Unable to load state %s %s during netplay.", preposname, m_saveload_pending_file);
+		}
 		else
 		{
-			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+			u32 const openflags = load ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+
+			// a write still in flight may be to the same file
+			finish_background_save(true);
 
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (!filerr)
 			{
 				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
-
-				// handle the result
-				switch (saverr)
+				save_error saverr;
+				if (load)
+					saverr = m_save.read_file(*file);
+				else if (!options().state_background())
+					saverr = m_save.write_file(*file);
+				else
 				{
-				case STATERR_INVALID_HEADER:
-					popmessage("Error: Unable to %s state %s %s due to an invalid header. Make sure the save state is correct for this system.", opname, preposname, m_saveload_pending_file);
-					break;
-
-				case STATERR_READ_ERROR:
-					popmessage("Error: Unable to %s state %s %s due to a read error (file is likely corrupt).", opname, preposname, m_saveload_pending_file);
-					break;
-
-				case STATERR_WRITE_ERROR:
-					popmessage("Error: Unable to %s state %s %s due to a write error. Verify there is enough disk space.", opname, preposname, m_saveload_pending_file);
-					break;
+					// capture the state now, and leave compressing and writing it to a worker
+					saverr = m_save.snapshot_file(m_save_data);
+					if (saverr == STATERR_NONE)
+					{
+						if (!m_save_queue)
+							m_save_queue = osd_work_queue_alloc(0);
+						if (m_save_queue)
+						{
+							m_save_file = std::move(file);
+							m_save_filename = m_saveload_pending_file;
+							m_save_item = osd_work_item_queue(m_save_queue, &running_machine::background_save_callback, this, 0);
+						}
+
+						// fall back to writing it here if there's no worker
+						if (!m_save_item)
+						{
+							if (m_save_file)
+								file = std::move(m_save_file);
+							saverr = save_manager::write_snapshot(*file, m_save_data);
+						}
+					}
+				}
 
-				case STATERR_NONE:
+				// the worker reports when it completes
+				if (!m_save_item)
 				{
-					const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "Loaded" : "Saved";
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
-						popmessage("%s state %s %s.\nWarning: Save states are not officially supported for this system.", opnamed, preposname, m_saveload_pending_file);
-					else
-						popmessage("%s state %s %s.", opnamed, preposname, m_saveload_pending_file);
-					break;
-				}
+					report_saveload(load, saverr, m_saveload_pending_file);
 
-				default:
-					popmessage("Error: Unknown error during %s state %s %s.", opname, preposname, m_saveload_pending_file);
-					break;
+					// close and perhaps delete the file
+					if (saverr != STATERR_NONE && !load)
+						file->remove_on_close();
 				}
-
-				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
 			}
 			else if ((openflags == OPEN_FLAG_READ) && (std::errc::no_such_file_or_directory == filerr))
 			{
@@ -940,6 +1055,81 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  report_saveload - tell the user how a save or
+//  load went
+//-------------------------------------------------
+
+void running_machine::report_saveload(bool load, save_error saverr, const std::string &filename)
+{
+	const char *const opname = load ? "load" : "save";
+	const char *const preposname = load ? "from" : "to";
+
+	switch (saverr)
+	{
+	case STATERR_INVALID_HEADER:
+		popmessage("Error: Unable to %s state %s %s due to an invalid header. Make sure the save state is correct for this system.", opname, preposname, filename);
+		break;
+
+	case STATERR_READ_ERROR:
+		popmessage("Error: Unable to %s state %s %s due to a read error (file is likely corrupt).", opname, preposname, filename);
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to %s state %s %s due to a write error. Verify there is enough disk space.", opname, preposname, filename);
+		break;
+
+	case STATERR_NONE:
+	{
+		const char *const opnamed = load ? "Loaded" : "Saved";
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("%s state %s %s.\nWarning: Save states are not officially supported for this system.", opnamed, preposname, filename);
+		else
+			popmessage("%s state %s %s.", opnamed, preposname, filename);
+		break;
+	}
+
+	default:
+		popmessage("Error: Unknown error during %s state %s %s.", opname, preposname, filename);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_background_save - report a background
+//  state write once it completes, or block until
+//  it does
+//-------------------------------------------------
+
+void running_machine::finish_background_save(bool wait)
+{
+	if (!m_save_item || !osd_work_item_wait(m_save_item, wait ? (osd_ticks_per_second() * 100) : 0))
+		return;
+	osd_work_item_release(m_save_item);
+	m_save_item = nullptr;
+
+	// the snapshot buffer is kept for the next save
+	if (m_save_result != STATERR_NONE)
+		m_save_file->remove_on_close();
+	m_save_file.reset();
+	report_saveload(false, m_save_result, m_save_filename);
+}
+
+
+//-------------------------------------------------
+//  background_save_callback - compress and write
+//  a state snapshot on the save worker
+//-------------------------------------------------
+
+void *running_machine::background_save_callback(void *param, int threadid)
+{
+	running_machine &machine = *reinterpret_cast<running_machine *>(param);
+	machine.m_save_result = save_manager::write_snapshot(*machine.m_save_file, machine.m_save_data);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -1240,6 +1430,30 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		// memory footprint by owner, from the last snapshot the emulation took
+		m_footprint->start_publishing();
+		m_manager.http()->add_http_handler("/memory", [this](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+		{
+			response->set_status(200);
+			response->set_content_type("application/json");
+			response->set_body(m_footprint->published());
+		});
+
+		// performance counters, from the last snapshot the emulation published
+		m_manager.http()->add_http_handler("/metrics", [this](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+		{
+			response->set_status(200);
+			response->set_content_type("text/plain; version=0.0.4");
+			response->set_body(m_bench_log->metrics());
+		});
+
+		// the same over a websocket: sent on connecting, and again for every message received
+		m_manager.http()->add_endpoint("/metrics",
+				[this](http_manager::websocket_connection_ptr connection) { connection->send_message(m_bench_log->metrics(), 1); },
+				[this](http_manager::websocket_connection_ptr connection, const std::string &payload, int opcode) { connection->send_message(m_bench_log->metrics(), 1); },
+				[](http_manager::websocket_connection_ptr connection, int status, const std::string &reason) { },
+				[](http_manager::websocket_connection_ptr connection, const std::error_code &error_code) { });
 	}
 }
 
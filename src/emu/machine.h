@@ -51,6 +51,7 @@ enum machine_notification
 // debug flags
 constexpr int DEBUG_FLAG_ENABLED        = 0x00000001;       // debugging is enabled
 constexpr int DEBUG_FLAG_CALL_HOOK      = 0x00000002;       // CPU cores must call instruction hook
+constexpr int DEBUG_FLAG_COVERAGE       = 0x00000004;       // instruction hook records execution coverage
 constexpr int DEBUG_FLAG_OSD_ENABLED    = 0x00001000;       // The OSD debugger is enabled
 
 
@@ -128,6 +129,10 @@ public:
 	sound_manager &sound() const { assert(m_sound != nullptr); return *m_sound; }
 	video_manager &video() const { assert(m_video != nullptr); return *m_video; }
 	network_manager &network() const { assert(m_network != nullptr); return *m_network; }
+	netplay_manager *netplay() const { return m_netplay.get(); }
+	bench_log_manager *bench_log() const { return m_bench_log.get(); }
+	footprint_manager &footprint() const { assert(m_footprint != nullptr); return *m_footprint; }
+	coverage_manager *coverage() const { return m_coverage.get(); }
 	bookkeeping_manager &bookkeeping() const { assert(m_bookkeeping != nullptr); return *m_bookkeeping; }
 	configuration_manager  &configuration() const { assert(m_configuration != nullptr); return *m_configuration; }
 	output_manager  &output() const { assert(m_output != nullptr); return *m_output; }
@@ -246,6 +251,10 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void report_saveload(bool load, save_error saverr, const std::string &filename);
+	void finish_background_save(bool wait);
+	static void *background_save_callback(void *param, int threadid);
+	void run_ahead_timeslice();
 	void soft_reset(s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
@@ -285,6 +294,11 @@ private:
 	std::unique_ptr<rom_load_manager> m_rom_load;      // internal data from romload.cpp
 	std::unique_ptr<debugger_manager> m_debugger;      // internal data from debugger.cpp
 	std::unique_ptr<natural_keyboard> m_natkeyboard;   // internal data from natkeyboard.cpp
+	std::unique_ptr<memory_trace_manager> m_memtrace;  // internal data from memtrace.cpp
+	std::unique_ptr<coverage_manager> m_coverage;      // internal data from coverage.cpp, if collecting coverage
+	std::unique_ptr<netplay_manager> m_netplay;        // internal data from netplay.cpp, if playing over the network
+	std::unique_ptr<bench_log_manager> m_bench_log;    // internal data from benchlog.cpp, if logging frame timings
+	std::unique_ptr<footprint_manager> m_footprint;    // internal data from footprint.cpp
 
 	// system state
 	machine_phase           m_current_phase;        // current execution phase
@@ -313,6 +327,18 @@ private:
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
 
+	// background state saving
+	osd_work_queue *        m_save_queue;           // worker for compressing and writing states
+	osd_work_item *         m_save_item;            // write in flight, if any
+	std::unique_ptr<emu_file> m_save_file;          // file being written
+	std::vector<u8>         m_save_data;            // uncompressed state being written
+	std::string             m_save_filename;        // name to report once written
+	save_error              m_save_result;          // outcome of the write
+
+	// run-ahead
+	int                     m_runahead;             // frames to emulate ahead, 0 if disabled
+	std::unique_ptr<ram_state> m_runahead_state;    // the present, while running ahead
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
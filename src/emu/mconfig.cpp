@@ -237,6 +237,7 @@ device_t *machine_config::device_remove(const char *tag)
 
 		// remove references to the old device
 		remove_references(*device);
+		unindex_devices(*device);
 
 		// let the device's owner do the work
 		owner->subdevices().remove(*device);
@@ -313,6 +314,7 @@ device_t &machine_config::add_device(std::unique_ptr<device_t> &&device, device_
 	{
 		// allocate the new device and append it to the owner's list
 		device_t &result(owner->subdevices().append(std::move(device)));
+		m_device_index.emplace(result.tag(), &result);
 		result.add_machine_configuration(*this);
 		return result;
 	}
@@ -321,6 +323,7 @@ device_t &machine_config::add_device(std::unique_ptr<device_t> &&device, device_
 		// allocate the root device directly
 		assert(!m_root_device);
 		m_root_device = std::move(device);
+		m_device_index.emplace(m_root_device->tag(), m_root_device.get());
 		m_root_device->add_machine_configuration(*this);
 		return *m_root_device;
 	}
@@ -335,14 +338,29 @@ device_t &machine_config::add_device(std::unique_ptr<device_t> &&device, device_
 device_t &machine_config::replace_device(std::unique_ptr<device_t> &&device, device_t &owner, device_t *existing)
 {
 	current_device_stack const context(*this);
+	if (existing)
+		unindex_devices(*existing);
 	device_t &result(existing
 			? owner.subdevices().replace_and_remove(std::move(device), *existing)
 			: owner.subdevices().append(std::move(device)));
+	m_device_index.emplace(result.tag(), &result);
 	result.add_machine_configuration(*this);
 	return result;
 }
 
 
+//-------------------------------------------------
+//  unindex_devices - forget a device and its
+//  subdevices before they're destroyed
+//-------------------------------------------------
+
+void machine_config::unindex_devices(device_t &device)
+{
+	for (device_t &dev : device_enumerator(device))
+		m_device_index.erase(dev.tag());
+}
+
+
 //-------------------------------------------------
 //  remove_references - globally remove references
 //  to a device about to be removed from the tree
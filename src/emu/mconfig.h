@@ -14,9 +14,11 @@
 #include <cassert>
 #include <map>
 #include <memory>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 
 
@@ -111,6 +113,11 @@ public:
 	emu_options &options() const { return m_options; }
 	device_t *device(const char *tag) const { return root_device().subdevice(tag); }
 	template <class DeviceClass> DeviceClass *device(const char *tag) const { return downcast<DeviceClass *>(device(tag)); }
+	device_t *device_by_tag(std::string_view fulltag) const
+	{
+		auto const found = m_device_index.find(fulltag);
+		return (found != m_device_index.end()) ? found->second : nullptr;
+	}
 	attotime maximum_quantum(attotime const &default_quantum) const;
 	device_execute_interface *perfect_quantum_device() const;
 
@@ -237,6 +244,7 @@ private:
 	device_t &add_device(std::unique_ptr<device_t> &&device, device_t *owner);
 	device_t &replace_device(std::unique_ptr<device_t> &&device, device_t &owner, device_t *existing);
 	void remove_references(device_t &device);
+	void unindex_devices(device_t &device);
 	void set_perfect_quantum(device_t &device, std::string tag);
 
 	// internal state
@@ -247,6 +255,7 @@ private:
 	device_t *                          m_current_device;
 	maximum_quantum_map                 m_maximum_quantums;
 	std::pair<device_t *, std::string>  m_perfect_quantum_device;
+	std::unordered_map<std::string_view, device_t *> m_device_index;   // every device by full tag
 };
 
 #endif // MAME_EMU_MCONFIG_H
@@ -0,0 +1,235 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    memtrace.cpp
+
+    Memory access tracing through address space taps.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "memtrace.h"
+
+
+//**************************************************************************
+//  SPACE TAP
+//**************************************************************************
+
+// ======================> space_tap
+
+// full-range read and write taps on one address space, reinstalled when the map changes
+class memory_trace_manager::space_tap
+{
+public:
+	space_tap(memory_trace_manager &host, address_space &space, u16 index)
+		: m_host(host)
+		, m_space(space)
+		, m_index(index)
+		, m_installing(false)
+	{
+		m_notifier = m_space.add_change_notifier(
+				[this] (read_or_write mode)
+				{
+					install(mode);
+				});
+		install(read_or_write::READWRITE);
+	}
+
+	~space_tap()
+	{
+		m_notifier.reset();
+		m_phr.remove();
+		m_phw.remove();
+	}
+
+private:
+	void install(read_or_write mode)
+	{
+		if (m_installing)
+			return;
+		m_installing = true;
+		switch (m_space.data_width())
+		{
+		case  8: install<u8>(mode);  break;
+		case 16: install<u16>(mode); break;
+		case 32: install<u32>(mode); break;
+		case 64: install<u64>(mode); break;
+		}
+		m_installing = false;
+	}
+
+	template<typename T> void install(read_or_write mode)
+	{
+		if (u32(mode) & u32(read_or_write::READ))
+		{
+			m_phr.remove();
+			m_phr = m_space.install_read_tap(
+					0, m_space.addrmask(), "memtrace",
+					[this] (offs_t offset, T &data, T mem_mask) { m_host.log<T>(m_index, 0, offset, data, mem_mask); },
+					&m_phr);
+		}
+		if (u32(mode) & u32(read_or_write::WRITE))
+		{
+			m_phw.remove();
+			m_phw = m_space.install_write_tap(
+					0, m_space.addrmask(), "memtrace",
+					[this] (offs_t offset, T &data, T mem_mask) { m_host.log<T>(m_index, RECORD_WRITE, offset, data, mem_mask); },
+					&m_phw);
+		}
+	}
+
+	memory_trace_manager &      m_host;         // owning trace manager
+	address_space &             m_space;        // traced space
+	u16 const                   m_index;        // space index in the trace file
+	memory_passthrough_handler  m_phr;          // read tap
+	memory_passthrough_handler  m_phw;          // write tap
+	util::notifier_subscription m_notifier;     // address map change notifier
+	bool                        m_installing;   // prevent recursive installs
+};
+
+
+
+//**************************************************************************
+//  MEMORY TRACE MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_trace_manager - constructor
+//-------------------------------------------------
+
+memory_trace_manager::memory_trace_manager(running_machine &machine, const char *filename)
+	: m_machine(machine)
+	, m_ring(std::make_unique<record []>(RING_SIZE))
+	, m_head(0)
+	, m_tail(0)
+	, m_frame(0)
+{
+	std::error_condition const filerr = util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, m_file);
+	if (filerr)
+	{
+		osd_printf_error("Error opening memory trace file %s (%s)\n", filename, filerr.message());
+		return;
+	}
+
+	// collect the spaces to trace
+	std::vector<address_space *> spaces;
+	for (device_memory_interface &memory : memory_interface_enumerator(machine.root_device()))
+		for (int spacenum = 0; spacenum < memory.max_space_count(); spacenum++)
+			if (memory.has_space(spacenum))
+				spaces.push_back(&memory.space(spacenum));
+
+	// write the header and the space descriptors
+	std::vector<u8> header;
+	auto const put = [&header] (const void *data, size_t length) { header.insert(header.end(), (const u8 *)data, (const u8 *)data + length); };
+	u32 const version = 1;
+	u32 const count = spaces.size();
+	put("MAMEMTR", 8);
+	put(&version, sizeof(version));
+	put(&count, sizeof(count));
+	for (address_space *space : spaces)
+	{
+		std::string const name = util::string_format("%s:%s", space->device().tag(), space->name());
+		u8 const desc[4] = { u8(space->data_width()), u8(space->addr_width()), u8(s8(space->addr_shift())), 0 };
+		u16 const length = name.length();
+		put(desc, sizeof(desc));
+		put(&length, sizeof(length));
+		put(name.data(), length);
+	}
+	util::write(*m_file, header.data(), header.size());
+
+	// tap everything
+	for (address_space *space : spaces)
+		m_taps.emplace_back(std::make_unique<space_tap>(*this, *space, m_taps.size()));
+
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&memory_trace_manager::frame_update, this));
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&memory_trace_manager::exit, this));
+}
+
+
+//-------------------------------------------------
+//  ~memory_trace_manager - destructor
+//-------------------------------------------------
+
+memory_trace_manager::~memory_trace_manager()
+{
+}
+
+
+//-------------------------------------------------
+//  log - record a tapped access
+//-------------------------------------------------
+
+template<typename T> void memory_trace_manager::log(u16 space, u8 flags, offs_t address, T data, T mem_mask)
+{
+	u8 lanes = 0;
+	for (unsigned byte = 0; byte < sizeof(T); byte++)
+		if (u8(mem_mask >> (8 * byte)))
+			lanes |= 1 << byte;
+	append(space, flags, address, data & mem_mask, lanes);
+}
+
+
+//-------------------------------------------------
+//  append - claim a ring slot and fill it; this
+//  can run on several threads when devices
+//  execute in parallel
+//-------------------------------------------------
+
+void memory_trace_manager::append(u16 space, u8 flags, offs_t address, u64 data, u8 lanes)
+{
+	u64 const slot = m_head.fetch_add(1, std::memory_order_relaxed);
+	m_ring[slot & (RING_SIZE - 1)] = record{ data, u32(address), space, flags, lanes };
+}
+
+
+//-------------------------------------------------
+//  drain - write the pending records to the file;
+//  only called while no device is executing
+//-------------------------------------------------
+
+void memory_trace_manager::drain()
+{
+	u64 const head = m_head.load(std::memory_order_acquire);
+
+	// older records have been overwritten if the taps lapped the ring
+	if ((head - m_tail) > RING_SIZE)
+	{
+		record const lost{ head - m_tail - RING_SIZE, 0, 0, RECORD_OVERFLOW, 0 };
+		util::write(*m_file, &lost, sizeof(lost));
+		m_tail = head - RING_SIZE;
+	}
+
+	// write the contiguous runs
+	while (m_tail != head)
+	{
+		u32 const start = m_tail & (RING_SIZE - 1);
+		u32 const count = std::min<u64>(head - m_tail, RING_SIZE - start);
+		util::write(*m_file, &m_ring[start], count * sizeof(record));
+		m_tail += count;
+	}
+}
+
+
+//-------------------------------------------------
+//  frame_update - mark the end of a frame and
+//  flush the ring
+//-------------------------------------------------
+
+void memory_trace_manager::frame_update()
+{
+	append(0, RECORD_FRAME, 0, m_frame++, 0);
+	drain();
+}
+
+
+//-------------------------------------------------
+//  exit - flush what's left and stop tracing
+//-------------------------------------------------
+
+void memory_trace_manager::exit()
+{
+	m_taps.clear();
+	drain();
+	m_file.reset();
+}
@@ -0,0 +1,99 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    memtrace.h
+
+    Memory access tracing through address space taps.
+
+****************************************************************************
+
+    The trace file starts with a header:
+
+        char[8]     "MAMEMTR\0"
+        u32         format version (1)
+        u32         number of address spaces
+
+    followed by one descriptor per address space:
+
+        u8          data width in bits
+        u8          address width in bits
+        s8          address shift
+        u8          reserved (0)
+        u16         length of the name
+        char[]      name as "<device tag>:<space name>", not terminated
+
+    and then by 16-byte records until the end of the file, all in host
+    byte order:
+
+        u64         data (frame number for frame markers, number of lost
+                    records for overflow markers)
+        u32         address
+        u16         address space index
+        u8          flags (RECORD_*)
+        u8          byte lanes accessed (bit n set for byte n of the bus)
+
+    src/tools/memtracesum.cpp summarizes these files.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_MEMTRACE_H
+#define MAME_EMU_MEMTRACE_H
+
+#pragma once
+
+#include <atomic>
+
+
+// ======================> memory_trace_manager
+
+class memory_trace_manager
+{
+public:
+	// record flags
+	static constexpr u8 RECORD_WRITE    = 0x01;     // write access (read otherwise)
+	static constexpr u8 RECORD_FRAME    = 0x40;     // end of frame marker
+	static constexpr u8 RECORD_OVERFLOW = 0x80;     // records were lost to a full ring
+
+	// construction/destruction
+	memory_trace_manager(running_machine &machine, const char *filename);
+	~memory_trace_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+private:
+	struct record
+	{
+		u64     data;
+		u32     address;
+		u16     space;
+		u8      flags;
+		u8      lanes;
+	};
+
+	static_assert(sizeof(record) == 16, "trace records must stay 16 bytes");
+
+	// number of records the ring can hold between drains, must be a power of 2
+	static constexpr u32 RING_SIZE = 1 << 20;
+
+	class space_tap;
+
+	// internal helpers
+	template<typename T> void log(u16 space, u8 flags, offs_t address, T data, T mem_mask);
+	void append(u16 space, u8 flags, offs_t address, u64 data, u8 lanes);
+	void drain();
+	void frame_update();
+	void exit();
+
+	// internal state
+	running_machine &       m_machine;          // reference to our machine
+	util::core_file::ptr    m_file;             // output file
+	std::unique_ptr<record []> m_ring;          // record ring
+	std::atomic<u64>        m_head;             // next record to be written by the taps
+	u64                     m_tail;             // next record to be written to the file
+	u64                     m_frame;            // current frame number
+	std::vector<std::unique_ptr<space_tap>> m_taps; // one tap pair per traced space
+};
+
+#endif // MAME_EMU_MEMTRACE_H
@@ -37,6 +37,13 @@
 const int KEY_BUFFER_SIZE = 4096;
 const char32_t INVALID_CHAR = '?';
 
+// with fast typing, a key stays put until its port has been read this many
+// times, and for at least this long for code that debounces by reading again
+// later; the timer checks this often
+const u32 FAST_SCAN_READS = 2;
+const int FAST_MIN_HOLD_USEC = 5000;
+const int FAST_POLL_USEC = 500;
+
 
 
 //**************************************************************************
@@ -339,6 +346,10 @@ natural_keyboard::natural_keyboard(running_machine &machine)
 	, m_queue_chars()
 	, m_accept_char()
 	, m_charqueue_empty()
+	, m_fast(machine.options().natural_fast())
+	, m_unthrottled(false)
+	, m_changed(attotime::zero)
+	, m_fallback(attotime::zero)
 {
 	// try building a list of keycodes; if none are available, don't bother
 	build_codes();
@@ -817,6 +828,80 @@ attotime natural_keyboard::choose_delay(char32_t ch)
 }
 
 
+//-------------------------------------------------
+//  poll_delay - determine when the timer should
+//  next run, which is sooner with fast typing
+//-------------------------------------------------
+
+attotime natural_keyboard::poll_delay(char32_t ch)
+{
+	if (m_fast && (m_current_rate == attotime::zero))
+		return attotime::from_usec(FAST_POLL_USEC);
+	else
+		return choose_delay(ch);
+}
+
+
+//-------------------------------------------------
+//  watch - note a field's port so we can tell
+//  when the change has been scanned
+//-------------------------------------------------
+
+void natural_keyboard::watch(ioport_field &field)
+{
+	ioport_port &port(field.port());
+	for (auto const &watched : m_watched)
+	{
+		if (watched.first == &port)
+			return;
+	}
+	m_watched.emplace_back(&port, port.live().reads);
+}
+
+
+//-------------------------------------------------
+//  scanned - have the watched ports been read
+//  enough times since the keys changed, or have
+//  we waited as long as we would have anyway?
+//-------------------------------------------------
+
+bool natural_keyboard::scanned() const
+{
+	attotime const held = machine().time() - m_changed;
+	if (held >= m_fallback)
+		return true;
+	if (held < attotime::from_usec(FAST_MIN_HOLD_USEC))
+		return false;
+	for (auto const &watched : m_watched)
+	{
+		if ((watched.first->live().reads - watched.second) < FAST_SCAN_READS)
+			return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  update_throttle - run unthrottled while fast
+//  typing, and put things back afterwards
+//-------------------------------------------------
+
+void natural_keyboard::update_throttle()
+{
+	bool const typing = m_fast && !empty() && (m_current_rate == attotime::zero);
+	if (typing && !m_unthrottled && machine().video().throttled())
+	{
+		machine().video().set_throttled(false);
+		m_unthrottled = true;
+	}
+	else if (!typing && m_unthrottled)
+	{
+		machine().video().set_throttled(true);
+		m_unthrottled = false;
+	}
+}
+
+
 //-------------------------------------------------
 //  internal_post - post a keyboard event
 //-------------------------------------------------
@@ -826,7 +911,7 @@ void natural_keyboard::internal_post(char32_t ch)
 	// need to start up the timer?
 	if (empty())
 	{
-		m_timer->adjust(choose_delay(ch));
+		m_timer->adjust(poll_delay(ch));
 		m_fieldnum = 0;
 		m_status_keydown = false;
 	}
@@ -836,6 +921,7 @@ void natural_keyboard::internal_post(char32_t ch)
 	if ((m_bufend + 1) % m_buffer.size() == m_bufbegin)
 		m_buffer.resize(m_buffer.size() + KEY_BUFFER_SIZE);
 	m_bufend %= m_buffer.size();
+	update_throttle();
 }
 
 
@@ -846,6 +932,17 @@ void natural_keyboard::internal_post(char32_t ch)
 
 void natural_keyboard::timer(s32 param)
 {
+	// with fast typing, hold the last change until it's been scanned
+	if (!m_watched.empty())
+	{
+		if (!scanned())
+		{
+			m_timer->adjust(attotime::from_usec(FAST_POLL_USEC));
+			return;
+		}
+		m_watched.clear();
+	}
+
 	if (!m_queue_chars.isnull())
 	{
 		// the driver has a queue_chars handler
@@ -861,8 +958,10 @@ void natural_keyboard::timer(s32 param)
 		// the driver does not have a queue_chars handler
 
 		// loop through this character's component codes
+		char32_t const ch(m_buffer[m_bufbegin]);
+		bool const fast(m_fast && (m_current_rate == attotime::zero));
 		if (!m_fieldnum)
-			m_current_code = find_code(m_buffer[m_bufbegin]);
+			m_current_code = find_code(ch);
 		bool advance;
 		if (m_current_code)
 		{
@@ -877,10 +976,17 @@ void natural_keyboard::timer(s32 param)
 						field->set_value(!m_status_keydown);
 					else if (!m_status_keydown)
 						field->set_value(!field->digital_value());
+					if (fast)
+						watch(*field);
 				}
 			}
 			while (code.field[m_fieldnum] && (++m_fieldnum < code.field.size()) && m_status_keydown);
 			advance = (m_fieldnum >= code.field.size()) || !code.field[m_fieldnum];
+			if (!m_watched.empty())
+			{
+				m_changed = machine().time();
+				m_fallback = choose_delay(ch);
+			}
 		}
 		else
 		{
@@ -900,7 +1006,8 @@ void natural_keyboard::timer(s32 param)
 
 	// need to make sure timerproc is called again if buffer not empty
 	if (!empty())
-		m_timer->adjust(choose_delay(m_buffer[m_bufbegin]));
+		m_timer->adjust(poll_delay(m_buffer[m_bufbegin]));
+	update_throttle();
 }
 
 
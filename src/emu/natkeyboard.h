@@ -18,6 +18,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -108,6 +109,10 @@ private:
 	bool can_post_alternate(char32_t ch);
 	attotime choose_delay(char32_t ch);
 	void internal_post(char32_t ch);
+	attotime poll_delay(char32_t ch);
+	void watch(ioport_field &field);
+	bool scanned() const;
+	void update_throttle();
 	void timer(s32 param);
 	std::string unicode_to_string(char32_t ch) const;
 	const keycode_map_entry *find_code(char32_t ch) const;
@@ -129,6 +134,13 @@ private:
 	ioport_queue_chars_delegate     m_queue_chars;      // queue characters callback
 	ioport_accept_char_delegate     m_accept_char;      // accept character callback
 	ioport_charqueue_empty_delegate m_charqueue_empty;  // character queue empty callback
+
+	// typing as fast as the keyboard is scanned
+	bool                            m_fast;             // is fast typing enabled?
+	bool                            m_unthrottled;      // did we turn throttling off?
+	attotime                        m_changed;          // when the watched keys last changed
+	attotime                        m_fallback;         // how long to wait for a scan before carrying on anyway
+	std::vector<std::pair<ioport_port *, u32> > m_watched; // ports of the keys just changed, with their read counts then
 };
 
 
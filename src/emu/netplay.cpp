@@ -0,0 +1,675 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    netplay.cpp
+
+    Two player rollback network play.
+
+****************************************************************************
+
+    Packets are UDP datagrams starting with 'MNP1' and a type byte; all
+    values are little-endian.
+
+    HELLO       client->host   delay (u8), ports (u32), system name
+    WELCOME     host->client   delay (u8), state size (u32)
+    STATE       host->client   offset (u32), state bytes
+    STATE_ACK   client->host   bytes received in order (u32)
+    INPUT       both ways      remote frames received (u32), first frame
+                               (u32), frame count (u16), then one u32 per
+                               port per frame
+
+    Input packets carry every frame the other side hasn't acknowledged
+    yet, so a lost packet only costs a little latency.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "netplay.h"
+
+#include "emuopts.h"
+
+#include "asio.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+namespace {
+
+const u8 PACKET_MAGIC[4] = { 'M', 'N', 'P', '1' };
+
+enum : u8
+{
+	PACKET_HELLO = 1,
+	PACKET_WELCOME,
+	PACKET_STATE,
+	PACKET_STATE_ACK,
+	PACKET_INPUT
+};
+
+// keep datagrams under a typical MTU
+const size_t PACKET_PAYLOAD = 1200;
+
+// state chunks sent each time round while transferring
+const u32 TRANSFER_WINDOW = 64;
+
+// give up on the other side after this long without hearing from it
+const int TIMEOUT_SECONDS = 10;
+
+
+//-------------------------------------------------
+//  packet helpers
+//-------------------------------------------------
+
+void start_packet(std::vector<u8> &packet, u8 type)
+{
+	packet.assign(std::begin(PACKET_MAGIC), std::end(PACKET_MAGIC));
+	packet.push_back(type);
+}
+
+void put_u32(std::vector<u8> &packet, u32 value)
+{
+	for (int shift = 0; shift < 32; shift += 8)
+		packet.push_back(u8(value >> shift));
+}
+
+u32 get_u32(const u8 *data)
+{
+	return data[0] | (data[1] << 8) | (data[2] << 16) | (u32(data[3]) << 24);
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  SOCKET
+//**************************************************************************
+
+// a UDP socket talking to one other side, never blocking
+class netplay_manager::socket
+{
+public:
+	socket() : m_socket(m_context), m_have_peer(false)
+	{
+	}
+
+	// wait for the other side to get in touch on a local port
+	std::error_code listen(u16 port)
+	{
+		std::error_code err;
+		m_socket.open(asio::ip::udp::v4(), err);
+		if (!err)
+			m_socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), port), err);
+		if (!err)
+			m_socket.non_blocking(true, err);
+		return err;
+	}
+
+	// talk to a given host and port
+	std::error_code connect(const std::string &host, const std::string &port)
+	{
+		std::error_code err;
+		asio::ip::udp::resolver resolver(m_context);
+		auto const results = resolver.resolve(asio::ip::udp::v4(), host, port, err);
+		if (err)
+			return err;
+		if (results.empty())
+			return asio::error::host_not_found;
+		m_peer = *results.begin();
+		m_have_peer = true;
+		m_socket.open(asio::ip::udp::v4(), err);
+		if (!err)
+			m_socket.non_blocking(true, err);
+		return err;
+	}
+
+	// take the sender of the last datagram as the other side
+	void adopt_sender()
+	{
+		m_peer = m_sender;
+		m_have_peer = true;
+	}
+
+	// fetch one datagram from the other side, if there is one
+	bool receive(u8 *buffer, size_t size, size_t &length)
+	{
+		for (;;)
+		{
+			std::error_code err;
+			length = m_socket.receive_from(asio::buffer(buffer, size), m_sender, 0, err);
+			if (err == asio::error::would_block)
+				return false;
+
+			// a refused send shows up here on some systems; it says nothing about new data
+			if (!err && (!m_have_peer || (m_sender == m_peer)))
+				return true;
+			if (err && (err != asio::error::connection_refused) && (err != asio::error::connection_reset))
+				return false;
+		}
+	}
+
+	void send(const std::vector<u8> &packet)
+	{
+		if (m_have_peer)
+		{
+			std::error_code err;
+			m_socket.send_to(asio::buffer(packet), m_peer, 0, err);
+		}
+	}
+
+private:
+	asio::io_context            m_context;
+	asio::ip::udp::socket       m_socket;
+	asio::ip::udp::endpoint     m_peer;
+	asio::ip::udp::endpoint     m_sender;
+	bool                        m_have_peer;
+};
+
+
+
+//**************************************************************************
+//  NETPLAY MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  netplay_manager - constructor
+//-------------------------------------------------
+
+netplay_manager::netplay_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_socket(std::make_unique<socket>())
+	, m_phase(phase::CONNECTING)
+	, m_host(!*machine.options().netplay_connect())
+	, m_delay(std::clamp(machine.options().netplay_delay(), 0, 16))
+	, m_remote_delay(0)
+	, m_max_rollback(std::clamp(machine.options().netplay_rollback(), 1, 32))
+	, m_last_receive(osd_ticks())
+	, m_transfer_done(0)
+	, m_ports(0)
+	, m_port_index(0)
+	, m_frame(0)
+	, m_remote_frames(0)
+	, m_peer_frames(0)
+	, m_rollback_frame(~u32(0))
+	, m_resimulating(false)
+{
+	std::error_code err;
+	if (m_host)
+	{
+		err = m_socket->listen(machine.options().netplay_listen());
+	}
+	else
+	{
+		std::string const target = machine.options().netplay_connect();
+		std::string::size_type const colon = target.rfind(':');
+		if ((colon == std::string::npos) || !colon || ((colon + 1) == target.length()))
+			throw emu_fatalerror("netplay_manager: -%s needs a host:port, not %s", OPTION_NETPLAY_CONNECT, target);
+		err = m_socket->connect(target.substr(0, colon), target.substr(colon + 1));
+	}
+	if (err)
+		throw emu_fatalerror("netplay_manager: unable to open the network connection (%s)", err.message());
+
+	for (auto &port : machine.ioport().ports())
+	{
+		m_ports++;
+		ioport_value masks[2] = { 0, 0 };
+		for (ioport_field &field : port.second->fields())
+			masks[(field.player() == 1) ? 1 : 0] |= field.mask();
+		m_mask[0].push_back(masks[0]);
+		m_mask[1].push_back(masks[1] & ~masks[0]);
+	}
+	m_local.resize(HISTORY * m_ports);
+	m_remote.resize(HISTORY * m_ports);
+	m_used.resize(HISTORY * m_ports);
+
+	m_states.resize(m_max_rollback + 2);
+	for (saved_frame &saved : m_states)
+	{
+		saved.frame = ~u32(0);
+		saved.state = std::make_unique<ram_state>(machine.save());
+	}
+
+	osd_printf_info(m_host ? "Netplay: waiting for the other player\n" : "Netplay: connecting\n");
+}
+
+
+//-------------------------------------------------
+//  ~netplay_manager - destructor
+//-------------------------------------------------
+
+netplay_manager::~netplay_manager()
+{
+}
+
+
+//-------------------------------------------------
+//  timeslice - run a timeslice of the session,
+//  rolling back first if an earlier frame ran
+//  with the wrong inputs
+//-------------------------------------------------
+
+void netplay_manager::timeslice()
+{
+	if (m_phase == phase::STOPPED)
+	{
+		machine().scheduler().timeslice();
+		return;
+	}
+
+	// a host can wait for its player indefinitely
+	receive();
+	const bool waiting = m_host && (m_phase == phase::CONNECTING);
+	if (!waiting && ((osd_ticks() - m_last_receive) > (osd_ticks_per_second() * TIMEOUT_SECONDS)))
+	{
+		stop((m_phase == phase::RUNNING) ? "Netplay: connection lost" : "Netplay: nobody answered");
+		return;
+	}
+
+	// nothing runs until both sides start from the same state
+	if (m_phase != phase::RUNNING)
+	{
+		if (m_host)
+			send_transfer();
+		else
+			send_hello();
+		idle();
+		return;
+	}
+
+	if (m_rollback_frame < m_frame)
+		rollback();
+
+	// wait rather than run further ahead of the other side than we can roll back
+	if ((m_frame > m_remote_frames) && ((m_frame - m_remote_frames) >= m_max_rollback))
+	{
+		send_inputs();
+		idle();
+		return;
+	}
+
+	const u32 frame = m_frame;
+	machine().scheduler().timeslice();
+	if (m_frame != frame)
+	{
+		save_frame();
+		send_inputs();
+	}
+}
+
+
+//-------------------------------------------------
+//  frame_start - note the start of a frame's
+//  input processing
+//-------------------------------------------------
+
+void netplay_manager::frame_start()
+{
+	m_port_index = 0;
+	m_frame++;
+}
+
+
+//-------------------------------------------------
+//  port_update - replace a port's digital inputs
+//  with the ones agreed for this frame
+//-------------------------------------------------
+
+void netplay_manager::port_update(ioport_port &port)
+{
+	const u32 index = m_port_index++;
+	if (index >= m_ports)
+		return;
+
+	// sample our own controls, to be used a few frames from now
+	const u32 frame = m_frame - 1;
+	const ioport_value localmask = m_mask[m_host ? 0 : 1][index];
+	if (!m_resimulating)
+		local_input(frame + m_delay)[index] = port.live().digital & localmask;
+
+	// the other side's inputs for this frame, or our best guess at them
+	ioport_value remote;
+	if (frame < m_remote_frames)
+		remote = remote_input(frame)[index];
+	else if (m_remote_frames)
+		remote = remote_input(m_remote_frames - 1)[index];
+	else
+		remote = 0;
+	used_input(frame)[index] = remote;
+
+	port.live().digital = local_input(frame)[index] | remote;
+}
+
+
+//-------------------------------------------------
+//  stop - end the session and carry on alone
+//-------------------------------------------------
+
+void netplay_manager::stop(const char *message)
+{
+	m_phase = phase::STOPPED;
+	machine().popmessage("%s", message);
+	osd_printf_warning("%s\n", message);
+}
+
+
+//-------------------------------------------------
+//  start_running - both sides have the same state;
+//  start exchanging inputs from frame zero
+//-------------------------------------------------
+
+void netplay_manager::start_running()
+{
+	m_phase = phase::RUNNING;
+	m_transfer.clear();
+	m_frame = 0;
+
+	// inputs for the frames before either side's delay are all idle
+	std::fill(m_local.begin(), m_local.end(), 0);
+	std::fill(m_remote.begin(), m_remote.end(), 0);
+	m_remote_frames = m_remote_delay;
+	m_peer_frames = m_delay;
+	m_rollback_frame = ~u32(0);
+
+	for (saved_frame &saved : m_states)
+		saved.frame = ~u32(0);
+	save_frame();
+
+	machine().popmessage("Netplay: connected as player %d", m_host ? 1 : 2);
+}
+
+
+//-------------------------------------------------
+//  idle - keep the user interface alive while
+//  emulation waits on the other side
+//-------------------------------------------------
+
+void netplay_manager::idle()
+{
+	machine().video().frame_update(true);
+	osd_sleep(osd_ticks_per_second() / 1000);
+}
+
+
+//-------------------------------------------------
+//  receive - handle everything that has arrived
+//-------------------------------------------------
+
+void netplay_manager::receive()
+{
+	u8 buffer[2048];
+	size_t length;
+	while ((m_phase != phase::STOPPED) && m_socket->receive(buffer, sizeof(buffer), length))
+	{
+		if ((length > sizeof(PACKET_MAGIC)) && !memcmp(buffer, PACKET_MAGIC, sizeof(PACKET_MAGIC)))
+			handle_packet(buffer + sizeof(PACKET_MAGIC), length - sizeof(PACKET_MAGIC));
+	}
+}
+
+
+//-------------------------------------------------
+//  handle_packet - act on one packet, minus its
+//  magic number
+//-------------------------------------------------
+
+void netplay_manager::handle_packet(const u8 *data, size_t length)
+{
+	const u8 type = data[0];
+	data++;
+	length--;
+
+	switch (type)
+	{
+	case PACKET_HELLO:
+		if (m_host && (length >= 5))
+		{
+			const std::string_view name(reinterpret_cast<const char *>(data + 5), length - 5);
+			if ((get_u32(data + 1) != m_ports) || (name != machine().system().name))
+			{
+				osd_printf_warning("Netplay: ignoring a player running %s\n", name);
+				break;
+			}
+			m_last_receive = osd_ticks();
+			if (m_phase == phase::CONNECTING)
+			{
+				// capture the state the client will start from
+				m_socket->adopt_sender();
+				m_remote_delay = std::min<u32>(data[0], 16);
+				if (machine().save().snapshot_file(m_transfer) != STATERR_NONE)
+				{
+					stop("Netplay: unable to save the starting state");
+					break;
+				}
+				m_transfer_done = 0;
+				m_phase = phase::TRANSFER;
+			}
+
+			// the client will keep asking until it hears back
+			std::vector<u8> packet;
+			start_packet(packet, PACKET_WELCOME);
+			packet.push_back(u8(m_delay));
+			put_u32(packet, m_transfer.size());
+			m_socket->send(packet);
+		}
+		break;
+
+	case PACKET_WELCOME:
+		if (!m_host && (m_phase == phase::CONNECTING) && (length >= 5))
+		{
+			m_last_receive = osd_ticks();
+			m_remote_delay = std::min<u32>(data[0], 16);
+			m_transfer.resize(get_u32(data + 1));
+			m_transfer_done = 0;
+			m_phase = phase::TRANSFER;
+		}
+		break;
+
+	case PACKET_STATE:
+		if (!m_host && (m_phase != phase::CONNECTING) && (length >= 4))
+		{
+			m_last_receive = osd_ticks();
+			const u32 offset = get_u32(data);
+			const size_t size = std::min<size_t>(length - 4, m_transfer.size() - std::min<size_t>(offset, m_transfer.size()));
+			if ((m_phase == phase::TRANSFER) && (offset == m_transfer_done))
+			{
+				std::copy_n(data + 4, size, m_transfer.begin() + offset);
+				m_transfer_done += size;
+			}
+
+			// acknowledge even once running, in case the final acknowledgement got lost
+			std::vector<u8> packet;
+			start_packet(packet, PACKET_STATE_ACK);
+			put_u32(packet, m_transfer_done);
+			m_socket->send(packet);
+
+			if ((m_phase == phase::TRANSFER) && (m_transfer_done == m_transfer.size()))
+			{
+				if (machine().save().read_buffer(m_transfer.data(), m_transfer.size()) != STATERR_NONE)
+					stop("Netplay: unable to load the host's state");
+				else
+					start_running();
+			}
+		}
+		break;
+
+	case PACKET_STATE_ACK:
+		if (m_host && (m_phase == phase::TRANSFER) && (length >= 4))
+		{
+			m_last_receive = osd_ticks();
+			m_transfer_done = std::max(m_transfer_done, std::min<u32>(get_u32(data), m_transfer.size()));
+			if (m_transfer_done == m_transfer.size())
+				start_running();
+		}
+		break;
+
+	case PACKET_INPUT:
+		if ((m_phase == phase::RUNNING) && (length >= 10))
+		{
+			m_last_receive = osd_ticks();
+			m_peer_frames = std::max(m_peer_frames, get_u32(data));
+			const u32 first = get_u32(data + 4);
+			const u32 count = data[8] | (data[9] << 8);
+			if ((length - 10) < (size_t(count) * m_ports * 4))
+				break;
+
+			// only take frames in order; anything past a gap comes round again
+			const ioport_value *remotemask = &m_mask[m_host ? 1 : 0][0];
+			const u8 *src = data + 10;
+			for (u32 frame = first; frame < (first + count); frame++, src += m_ports * 4)
+			{
+				if (frame != m_remote_frames)
+					continue;
+				ioport_value *const dest = remote_input(frame);
+				for (u32 port = 0; port < m_ports; port++)
+					dest[port] = get_u32(src + port * 4) & remotemask[port];
+				m_remote_frames++;
+
+				// a frame already run with something else has to be run again
+				if ((frame < m_frame) && !std::equal(dest, dest + m_ports, used_input(frame)))
+					m_rollback_frame = std::min(m_rollback_frame, frame);
+			}
+		}
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  send_hello - ask the host to let us join
+//-------------------------------------------------
+
+void netplay_manager::send_hello()
+{
+	if (m_phase != phase::CONNECTING)
+		return;
+
+	std::vector<u8> packet;
+	start_packet(packet, PACKET_HELLO);
+	packet.push_back(u8(m_delay));
+	put_u32(packet, m_ports);
+	const char *const name = machine().system().name;
+	packet.insert(packet.end(), name, name + strlen(name));
+	m_socket->send(packet);
+}
+
+
+//-------------------------------------------------
+//  send_transfer - send the next window of the
+//  starting state the client hasn't confirmed
+//-------------------------------------------------
+
+void netplay_manager::send_transfer()
+{
+	if (m_phase != phase::TRANSFER)
+		return;
+
+	std::vector<u8> packet;
+	u32 offset = m_transfer_done;
+	for (u32 chunk = 0; (chunk < TRANSFER_WINDOW) && (offset < m_transfer.size()); chunk++)
+	{
+		const u32 size = std::min<u32>(PACKET_PAYLOAD, m_transfer.size() - offset);
+		start_packet(packet, PACKET_STATE);
+		put_u32(packet, offset);
+		packet.insert(packet.end(), m_transfer.begin() + offset, m_transfer.begin() + offset + size);
+		m_socket->send(packet);
+		offset += size;
+	}
+}
+
+
+//-------------------------------------------------
+//  send_inputs - send every frame of our inputs
+//  the other side hasn't confirmed
+//-------------------------------------------------
+
+void netplay_manager::send_inputs()
+{
+	// frames we've sampled, and the oldest one still in the history
+	const u32 known = m_frame + m_delay;
+	const u32 first = std::max(m_peer_frames, (known > HISTORY) ? (known - HISTORY) : 0);
+	const u32 count = std::min<u32>(known - std::min(first, known), std::max<u32>(PACKET_PAYLOAD / (m_ports * 4), 1));
+
+	std::vector<u8> packet;
+	start_packet(packet, PACKET_INPUT);
+	put_u32(packet, m_remote_frames);
+	put_u32(packet, first);
+	packet.push_back(u8(count));
+	packet.push_back(u8(count >> 8));
+	for (u32 frame = first; frame < (first + count); frame++)
+	{
+		const ioport_value *const src = local_input(frame);
+		for (u32 port = 0; port < m_ports; port++)
+			put_u32(packet, src[port]);
+	}
+	m_socket->send(packet);
+}
+
+
+//-------------------------------------------------
+//  save_frame - remember the machine as it is
+//  now, before the next frame's inputs
+//-------------------------------------------------
+
+void netplay_manager::save_frame()
+{
+	saved_frame &saved = m_states[m_frame % m_states.size()];
+	if (saved.state->save() != STATERR_NONE)
+	{
+		stop("Netplay: unable to save state, session ended");
+		return;
+	}
+	saved.frame = m_frame;
+}
+
+
+//-------------------------------------------------
+//  rollback - go back to before the earliest
+//  mispredicted frame and silently run forward
+//  to where we were with the right inputs
+//-------------------------------------------------
+
+void netplay_manager::rollback()
+{
+	// the newest state from no later than the mispredicted frame
+	saved_frame *best = nullptr;
+	for (saved_frame &saved : m_states)
+		if ((saved.frame <= m_rollback_frame) && (!best || (saved.frame > best->frame)))
+			best = &saved;
+	m_rollback_frame = ~u32(0);
+	if (!best)
+	{
+		stop("Netplay: fell too far behind the other player, session ended");
+		return;
+	}
+
+	const u32 target = m_frame;
+	machine().video().set_rolling_back(true);
+	const save_error err = best->state->load();
+	machine().video().set_rolling_back(false);
+	if (err != STATERR_NONE)
+	{
+		stop("Netplay: unable to load state, session ended");
+		return;
+	}
+	m_frame = best->frame;
+
+	// catch up again without showing or playing any of it
+	m_resimulating = true;
+	machine().sound().suppress_output(true);
+	machine().video().set_output_suppressed(true);
+	while ((m_frame < target) && (m_phase == phase::RUNNING) && !machine().hard_reset_pending() && !machine().exit_pending())
+	{
+		const u32 frame = m_frame;
+		machine().scheduler().timeslice();
+		if (m_frame != frame)
+			save_frame();
+	}
+	machine().video().set_output_suppressed(false);
+	machine().sound().suppress_output(false);
+	m_resimulating = false;
+}
@@ -0,0 +1,113 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    netplay.h
+
+    Two player rollback network play.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_NETPLAY_H
+#define MAME_EMU_NETPLAY_H
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+// ======================> netplay_manager
+
+// Both peers run the same machine from the same state and exchange their
+// digital inputs over UDP, one record of every input port per frame.  The
+// host owns player 2's inputs for the client; everything else stays with
+// the host.  A frame whose remote inputs haven't arrived yet is run with
+// the last ones received, and when the real ones differ the machine is
+// rolled back to the state saved before that frame and run forward again
+// silently.
+class netplay_manager
+{
+public:
+	// construction/destruction
+	netplay_manager(running_machine &machine);
+	~netplay_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	bool running() const { return m_phase == phase::RUNNING; }
+
+	// run loop hook, in place of the scheduler's timeslice
+	void timeslice();
+
+	// called by the input port manager every frame
+	void frame_start();
+	void port_update(ioport_port &port);
+
+private:
+	class socket;
+
+	enum class phase
+	{
+		CONNECTING,                                 // waiting for the other side to get in touch
+		TRANSFER,                                   // host sending the starting state to the client
+		RUNNING,                                    // exchanging inputs
+		STOPPED                                     // given up, emulation carries on locally
+	};
+
+	// frames of input history kept; a power of two well beyond the rollback window
+	static constexpr u32 HISTORY = 256;
+
+	// internal helpers
+	void stop(const char *message);
+	void start_running();
+	void idle();
+	void receive();
+	void handle_packet(const u8 *data, size_t length);
+	void send_hello();
+	void send_transfer();
+	void send_inputs();
+	void save_frame();
+	void rollback();
+	ioport_value *local_input(u32 frame) { return &m_local[(frame & (HISTORY - 1)) * m_ports]; }
+	ioport_value *remote_input(u32 frame) { return &m_remote[(frame & (HISTORY - 1)) * m_ports]; }
+	ioport_value *used_input(u32 frame) { return &m_used[(frame & (HISTORY - 1)) * m_ports]; }
+
+	// a state captured before a frame's inputs were applied
+	struct saved_frame
+	{
+		u32                         frame;          // frames run before it was saved
+		std::unique_ptr<ram_state>  state;          // the machine at that point
+	};
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::unique_ptr<socket>     m_socket;           // connection to the other side
+	phase                       m_phase;            // where we are in the session
+	bool                        m_host;             // are we the host?
+	u32                         m_delay;            // frames between sampling our inputs and using them
+	u32                         m_remote_delay;     // the same on the other side
+	u32                         m_max_rollback;     // frames we're allowed to run ahead of the other side
+	osd_ticks_t                 m_last_receive;     // when the other side last got through
+
+	// starting state
+	std::vector<u8>             m_transfer;         // the host's state, serialized
+	u32                         m_transfer_done;    // bytes the client has confirmed
+
+	// input exchange
+	u32                         m_ports;            // input ports, each sent as one value per frame
+	u32                         m_port_index;       // port handled next during a frame
+	std::vector<ioport_value>   m_mask[2];          // digital bits owned by the host and the client
+	std::vector<ioport_value>   m_local;            // our inputs by frame
+	std::vector<ioport_value>   m_remote;           // the other side's inputs by frame
+	std::vector<ioport_value>   m_used;             // remote inputs actually run with, predicted or not
+	u32                         m_frame;            // frames started
+	u32                         m_remote_frames;    // frames of remote input received
+	u32                         m_peer_frames;      // frames of our input the other side has
+	u32                         m_rollback_frame;   // earliest mispredicted frame, or ~0
+	bool                        m_resimulating;     // running frames again after a rollback
+	std::vector<saved_frame>    m_states;           // ring of recent states
+};
+
+#endif // MAME_EMU_NETPLAY_H
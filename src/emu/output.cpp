@@ -31,16 +31,18 @@ output_manager::output_item::output_item(
 	, m_name(std::move(name))
 	, m_id(id)
 	, m_value(value)
+	, m_dirty(false)
 	, m_notifylist()
 {
 }
 
 
-void output_manager::output_item::notify(s32 value)
+void output_manager::output_item::notify()
 {
+	s32 const value = m_value;
 	if (OUTPUT_VERBOSE)
-		m_manager.machine().logerror("Output %s = %d (was %d)\n", m_name, value, m_value);
-	m_value = value;
+		m_manager.machine().logerror("Output %s = %d\n", m_name, value);
+	m_dirty = false;
 
 	// call the local notifiers first
 	for (auto const &notify : m_notifylist)
@@ -197,7 +199,7 @@ void output_manager::set_value(std::string_view outname, s32 value)
 
 	// if no item of that name, create a new one and force notification
 	if (!item)
-		create_new_item(outname, value).notify(value);
+		create_new_item(outname, value).mark_dirty();
 	else
 		item->set(value); // set the new value (notifies on change)
 }
@@ -241,6 +243,43 @@ void output_manager::set_global_notifier(notifier_func callback, void *param)
 }
 
 
+//-------------------------------------------------
+//  set_batch_notifier - sets a callback for the
+//  end of each batch of notifications
+//-------------------------------------------------
+
+void output_manager::set_batch_notifier(batch_notifier_func callback, void *param)
+{
+	m_batch_notifylist.emplace_back(callback, param);
+}
+
+
+//-------------------------------------------------
+//  flush - notify every output that's changed
+//  since the last flush, with its latest value
+//-------------------------------------------------
+
+void output_manager::flush()
+{
+	// outputs changing many times between frames (multiplexed lamps, for
+	// instance) are only notified once
+	if (m_dirty.empty())
+		return;
+
+	// a notifier may set outputs itself; those go in the next batch
+	std::vector<output_item *> dirty;
+	dirty.swap(m_dirty);
+	for (output_item *const item : dirty)
+		item->notify();
+	dirty.clear();
+	if (m_dirty.empty())
+		m_dirty.swap(dirty); // keep the allocation
+
+	for (auto const &notify : m_batch_notifylist)
+		notify.first(notify.second);
+}
+
+
 /*-------------------------------------------------
     output_name_to_id - returns a unique ID for
     a given name
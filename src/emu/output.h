@@ -33,6 +33,7 @@ private:
 	template <typename Input, std::make_unsigned_t<Input> DefaultMask> friend class devcb_write;
 
 	typedef void (*notifier_func)(const char *outname, s32 value, void *param);
+	typedef void (*batch_notifier_func)(void *param);
 
 	class output_notify
 	{
@@ -68,8 +69,9 @@ private:
 		std::string const &name() const { return m_name; }
 		u32 id() const { return m_id; }
 		s32 get() const { return m_value; }
-		void set(s32 value) { if (m_value != value) { notify(value); } }
-		void notify(s32 value);
+		void set(s32 value) { if (m_value != value) { m_value = value; mark_dirty(); } }
+		void mark_dirty() { if (!m_dirty) { m_dirty = true; m_manager.m_dirty.push_back(this); } }
+		void notify();
 
 		void set_notifier(notifier_func callback, void *param) { m_notifylist.emplace_back(callback, param); }
 
@@ -78,6 +80,7 @@ private:
 		std::string const   m_name;         // string name of the item
 		u32 const           m_id;           // unique ID for this item
 		s32                 m_value;        // current value
+		bool                m_dirty;        // changed since the last flush
 		notify_vector       m_notifylist;   // list of notifier callbacks
 	};
 
@@ -181,6 +184,12 @@ public:
 	// set a notifier globally
 	void set_global_notifier(notifier_func callback, void *param);
 
+	// set a notifier called after each batch of changes has been notified
+	void set_batch_notifier(batch_notifier_func callback, void *param);
+
+	// notify everything that's changed since the last flush; called once a frame
+	void flush();
+
 	// immdediately call a notifier for all outputs
 	template <typename T> void notify_all(T &&notifier) const
 	{
@@ -209,6 +218,8 @@ private:
 	running_machine &m_machine;                  // reference to our machine
 	std::unordered_map<std::string, output_item> m_itemtable;
 	notify_vector m_global_notifylist;
+	std::vector<std::pair<batch_notifier_func, void *> > m_batch_notifylist;
+	std::vector<output_item *> m_dirty;
 	std::vector<std::reference_wrapper<output_item> > m_save_order;
 	std::unique_ptr<s32 []> m_save_data;
 	u32 m_uniqueid;
@@ -44,6 +44,38 @@ struct profile_string
 
 profiler_state g_profiler;
 
+static const profile_string s_names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_LUA,              "LUA" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
 
 
 //**************************************************************************
@@ -54,6 +86,25 @@ profiler_state g_profiler;
 
 
 
+//**************************************************************************
+//  CATEGORY NAMES
+//**************************************************************************
+
+//-------------------------------------------------
+//  profiler_type_name - return the name of a
+//  category that isn't a device
+//-------------------------------------------------
+
+const char *profiler_type_name(profile_type type)
+{
+	for (auto &name : s_names)
+		if (name.type == type)
+			return name.string;
+	return nullptr;
+}
+
+
+
 //**************************************************************************
 //  DUMMY PROFILER STATE
 //**************************************************************************
@@ -80,6 +131,7 @@ real_profiler_state::real_profiler_state()
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_counters, 0, sizeof(m_counters));
 	reset(false);
 }
 
@@ -143,38 +195,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_LUA,              "LUA" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	u64 computed = 0;
 	profile_type curtype;
@@ -215,20 +235,28 @@ void real_profiler_state::update_text(running_machine &machine)
 			// and then the text
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
 				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
-			else
-				for (auto & name : names)
-					if (name.type == curtype)
-					{
-						stream << name.string;
-						break;
-					}
+			else if (char const *const name = profiler_type_name(curtype))
+				stream << name;
 
 			// followed by a carriage return
 			stream << '\n';
 		}
 	}
 
+	// append the event counts, averaged over the frames since the last update
+	static const profile_string counter_names[] =
+	{
+		{ PROFILER_COUNTER_TILES_DECODED, "Tiles Decoded" },
+		{ PROFILER_COUNTER_TILES_REUSED,  "Tiles Reused" },
+		{ PROFILER_COUNTER_GFX_DECODED,   "Gfx Elements Decoded" }
+	};
+	u64 const frames = std::max<u64>(m_counters[PROFILER_COUNTER_FRAMES], 1);
+	for (auto &name : counter_names)
+		if (m_counters[name.type] != 0)
+			util::stream_format(stream, "%u/frame %s\n", unsigned((m_counters[name.type] + frames / 2) / frames), name.string);
+
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_counters, 0, sizeof(m_counters));
 	m_text = stream.str();
 }
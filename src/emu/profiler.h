@@ -83,6 +83,17 @@ enum profile_type
 DECLARE_ENUM_INCDEC_OPERATORS(profile_type)
 
 
+// event counters shown per frame alongside the timings
+enum profile_counter
+{
+	PROFILER_COUNTER_FRAMES,
+	PROFILER_COUNTER_TILES_DECODED,
+	PROFILER_COUNTER_TILES_REUSED,
+	PROFILER_COUNTER_GFX_DECODED,
+	PROFILER_COUNTER_TOTAL
+};
+
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -142,6 +153,7 @@ public:
 		return m_filoptr != nullptr;
 	}
 	const char *text(running_machine &machine);
+	osd_ticks_t ticks(profile_type type) const noexcept { return m_data[type]; }
 
 	// enable/disable
 	void enable(bool state = true) noexcept
@@ -155,6 +167,13 @@ public:
 	// start/stop
 	[[nodiscard]] auto start(profile_type type) noexcept { return scope(*this, type); }
 
+	// event counting
+	void count(profile_counter type, u32 amount = 1) noexcept
+	{
+		if (enabled())
+			m_counters[type] += amount;
+	}
+
 private:
 	// an entry in the FILO
 	struct filo_entry
@@ -221,6 +240,7 @@ private:
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	u64                 m_counters[PROFILER_COUNTER_TOTAL]; // array of event counts
 };
 
 
@@ -249,6 +269,7 @@ public:
 	// getters
 	bool enabled() const noexcept { return false; }
 	const char *text(running_machine &machine) { return ""; }
+	osd_ticks_t ticks(profile_type type) const noexcept { return 0; }
 
 	// enable/disable
 	void enable(bool state = true) noexcept { }
@@ -256,6 +277,9 @@ public:
 	// start/stop
 	[[nodiscard]] auto start(profile_type type) noexcept { return scope(*this, type); }
 
+	// event counting
+	void count(profile_counter type, u32 amount = 1) noexcept { }
+
 private:
 	void real_stop() noexcept { }
 };
@@ -278,4 +302,13 @@ typedef dummy_profiler_state profiler_state;
 extern profiler_state g_profiler;
 
 
+
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+// name of a profiler category other than a device, or nullptr
+const char *profiler_type_name(profile_type type);
+
+
 #endif // MAME_EMU_PROFILER_H
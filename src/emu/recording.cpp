@@ -10,6 +10,7 @@
 
 #include "emu.h"
 
+#include "emuopts.h"
 #include "fileio.h"
 #include "main.h"
 #include "screen.h"
@@ -28,11 +29,13 @@ namespace
 		{
 		}
 
+		~avi_movie_recording();
+
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -42,18 +45,19 @@ namespace
 	class mng_movie_recording : public movie_recording
 	{
 	public:
-		mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields);
+		mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields, int compression_level);
 		~mng_movie_recording();
 
 		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
+		int m_compression_level; // zlib level for each frame
 	};
 };
 
@@ -71,7 +75,12 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_next_job(0)
+	, m_failed(false)
 {
+	for (pending_job &job : m_jobs)
+		job.owner = this;
 }
 
 
@@ -81,6 +90,9 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	finish();
+	if (m_queue)
+		osd_work_queue_free(m_queue);
 }
 
 
@@ -90,23 +102,138 @@ movie_recording::~movie_recording()
 
 bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 {
-	// identify the palette
-	bool has_palette = screen() && screen()->has_palette();
-	const rgb_t *palette = has_palette ? screen()->palette().palette()->entry_list_adjusted() : nullptr;
-	int palette_entries = has_palette ? screen()->palette().entries() : 0;
-
-	// keep appending frames until we're at curtime
+	// work out how many frames this bitmap covers to reach curtime
+	int repeat = 0;
 	while (next_frame_time() <= curtime)
 	{
-		// append this bitmap as a single frame
-		if (!append_single_video_frame(bitmap, palette, palette_entries))
-			return false;
-		m_frame++;
-
-		// advance time
+		repeat++;
 		set_next_frame_time(next_frame_time() + frame_period());
 	}
-	return true;
+	if (!repeat)
+		return !m_failed;
+
+	// the snapshot bitmap and palette change under us, so the encoder gets copies
+	pending_job &job = next_job();
+	job.video = true;
+	job.repeat = repeat;
+	if ((job.bitmap.width() != bitmap.width()) || (job.bitmap.height() != bitmap.height()))
+		job.bitmap.allocate(bitmap.width(), bitmap.height());
+	copybitmap(job.bitmap, bitmap, 0, 0, 0, 0, bitmap.cliprect());
+
+	bool const has_palette = screen() && screen()->has_palette();
+	if (has_palette)
+	{
+		const rgb_t *const palette = screen()->palette().palette()->entry_list_adjusted();
+		job.palette.assign(palette, palette + screen()->palette().entries());
+	}
+	else
+	{
+		job.palette.clear();
+	}
+	return submit(job);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
+
+	// interleaved stereo
+	pending_job &job = next_job();
+	job.video = false;
+	job.sound.assign(sound, sound + numsamples * 2);
+	return submit(job);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::finish - wait for everything
+//  submitted so far to be written
+//-------------------------------------------------
+
+void movie_recording::finish()
+{
+	for (unsigned index = 0; index < QUEUE_DEPTH; index++)
+		next_job();
+}
+
+
+//-------------------------------------------------
+//  movie_recording::next_job - claim the next job
+//  slot, waiting for its previous use to finish
+//-------------------------------------------------
+
+movie_recording::pending_job &movie_recording::next_job()
+{
+	pending_job &job = m_jobs[m_next_job];
+	m_next_job = (m_next_job + 1) % QUEUE_DEPTH;
+	if (job.item)
+	{
+		osd_work_item_wait(job.item, osd_ticks_per_second() * 100);
+		osd_work_item_release(job.item);
+		job.item = nullptr;
+	}
+	return job;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::submit - hand a job to the
+//  encoding thread, or run it here if there isn't
+//  one
+//-------------------------------------------------
+
+bool movie_recording::submit(pending_job &job)
+{
+	if (m_queue)
+		job.item = osd_work_item_queue(m_queue, &movie_recording::job_callback, &job, 0);
+	if (!job.item)
+		run_job(job);
+	return !m_failed;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::run_job - write out a frame or
+//  a block of sound
+//-------------------------------------------------
+
+void movie_recording::run_job(pending_job &job)
+{
+	// once something fails the recording is going away; don't pile on
+	if (m_failed)
+		return;
+
+	bool ok = true;
+	if (job.video)
+	{
+		const rgb_t *const palette = job.palette.empty() ? nullptr : job.palette.data();
+		for (int frame = 0; ok && (frame < job.repeat); frame++, m_frame++)
+			ok = append_single_video_frame(job.bitmap, palette, job.palette.size());
+	}
+	else
+	{
+		ok = append_sound_samples(job.sound.data(), job.sound.size() / 2);
+	}
+	if (!ok)
+		m_failed = true;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::job_callback - encoding thread
+//  entry point
+//-------------------------------------------------
+
+void *movie_recording::job_callback(void *param, int threadid)
+{
+	pending_job &job = *reinterpret_cast<pending_job *>(param);
+	job.owner->run_job(job);
+	return nullptr;
 }
 
 
@@ -134,7 +261,7 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 			info_fields["Software"] = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
 			info_fields["System"] = std::string(machine.system().manufacturer).append(" ").append(machine.system().type.fullname());
 
-			auto mng_recording = std::make_unique<mng_movie_recording>(screen, std::move(info_fields));
+			auto mng_recording = std::make_unique<mng_movie_recording>(screen, std::move(info_fields), machine.options().snap_compression());
 			if (mng_recording->initialize(std::move(file), snap_bitmap))
 				result = std::move(mng_recording);
 		}
@@ -166,6 +293,16 @@ const char *movie_recording::format_file_extension(movie_recording::format fmt)
 }
 
 
+//-------------------------------------------------
+//  avi_movie_recording - destructor
+//-------------------------------------------------
+
+avi_movie_recording::~avi_movie_recording()
+{
+	finish();
+}
+
+
 //-------------------------------------------------
 //  avi_movie_recording::initialize
 //-------------------------------------------------
@@ -217,13 +354,11 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
-	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
-
 	// write the next frame
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
@@ -237,9 +372,10 @@ bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsample
 //  mng_movie_recording - constructor
 //-------------------------------------------------
 
-mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields)
+mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields, int compression_level)
 	: movie_recording(screen)
 	, m_info_fields(std::move(info_fields))
+	, m_compression_level(compression_level)
 {
 }
 
@@ -250,6 +386,7 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	finish();
 	if (m_mng_file)
 		util::mng_capture_stop(*m_mng_file);
 }
@@ -282,6 +419,7 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 {
 	// set up the text fields in the movie info
 	util::png_info pnginfo;
+	pnginfo.compression_level = m_compression_level;
 	if (current_frame() == 0)
 	{
 		for (auto &ent : m_info_fields)
@@ -294,10 +432,10 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool mng_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
@@ -17,7 +17,10 @@
 #ifndef MAME_EMU_RECORDING_H
 #define MAME_EMU_RECORDING_H
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "attotime.h"
 #include "palette.h"
@@ -54,9 +57,7 @@ public:
 
 	// methods
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
@@ -68,18 +69,48 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals, called on the encoding thread in submission order
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool append_sound_samples(const s16 *sound, int numsamples) = 0;
 
 	// accessors
 	int current_frame() const { return m_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
+	// wait for everything submitted to be written; derived destructors
+	// must call this before closing their files
+	void finish();
+
 private:
+	// frames and sound waiting for the encoding thread; once every slot is
+	// busy, submitting waits for the oldest so memory use stays bounded
+	static constexpr unsigned QUEUE_DEPTH = 4;
+
+	struct pending_job
+	{
+		movie_recording *   owner = nullptr;    // recording this belongs to
+		osd_work_item *     item = nullptr;     // queued work, if any
+		bool                video = false;      // a frame rather than sound?
+		int                 repeat = 0;         // times to append the frame
+		bitmap_rgb32        bitmap;             // copy of the frame
+		std::vector<rgb_t>  palette;            // copy of the palette, if any
+		std::vector<s16>    sound;              // copy of the samples
+	};
+
+	pending_job &next_job();
+	bool submit(pending_job &job);
+	void run_job(pending_job &job);
+	static void *job_callback(void *param, int threadid);
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
-	int             m_frame;                // current movie frame number
+	int             m_frame;                // current movie frame number, as written
+
+	osd_work_queue *                    m_queue;        // encoding thread, nullptr to work synchronously
+	std::array<pending_job, QUEUE_DEPTH> m_jobs;        // ring of jobs
+	unsigned                            m_next_job;     // slot to use next
+	std::atomic<bool>                   m_failed;       // has a write failed?
 };
 
 
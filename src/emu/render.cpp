@@ -133,6 +133,15 @@ struct render_target::hit_test
 };
 
 
+struct render_target::deferred_scale
+{
+	render_primitive *prim;
+	render_texture *texture;
+	s32 width;
+	s32 height;
+};
+
+
 
 
 //**************************************************************************
@@ -202,6 +211,17 @@ inline void normalize_bounds(render_bounds &bounds)
 }
 
 
+//-------------------------------------------------
+//  scaled_bitmap_bytes - memory held by a scaled
+//  texture bitmap
+//-------------------------------------------------
+
+inline s64 scaled_bitmap_bytes(bitmap_argb32 const &bitmap)
+{
+	return s64(bitmap.rowbytes()) * bitmap.height();
+}
+
+
 //**************************************************************************
 //  RENDER PRIMITIVE
 //**************************************************************************
@@ -331,13 +351,24 @@ render_texture::render_texture()
 		m_format(TEXFORMAT_ARGB32),
 		m_id(~0ULL),
 		m_old_id(~0ULL),
+		m_persistent(false),
+		m_dirty_tracking(false),
+		m_dirty_seqid(0),
+		m_lookup_serial(0),
 		m_scaler(nullptr),
 		m_param(nullptr),
+		m_background_scaling(false),
 		m_curseq(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
+	m_dirty.set(0, -1, 0, -1);
+	m_last_dirty.set(0, -1, 0, -1);
 	for (auto &elem : m_scaled)
+	{
 		elem.seqid = 0;
+		elem.pending = nullptr;
+		elem.owner = nullptr;
+	}
 }
 
 
@@ -379,7 +410,10 @@ void render_texture::release()
 	// free all scaled versions
 	for (auto &elem : m_scaled)
 	{
+		finish_scaling(elem);
 		m_manager->invalidate_all(elem.bitmap.get());
+		if (elem.bitmap)
+			m_manager->scaled_bytes_changed(-scaled_bitmap_bytes(*elem.bitmap));
 		elem.bitmap.reset();
 		elem.seqid = 0;
 	}
@@ -389,7 +423,13 @@ void render_texture::release()
 	m_bitmap = nullptr;
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
+	m_persistent = false;
+	m_dirty_tracking = false;
+	m_dirty.set(0, -1, 0, -1);
+	m_last_dirty.set(0, -1, 0, -1);
+	m_dirty_seqid = 0;
 	m_scaler = nullptr;
+	m_background_scaling = false;
 	m_curseq = 0;
 }
 
@@ -409,6 +449,11 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	// invalidate references to the old bitmap
 	if (&bitmap != m_bitmap && m_bitmap != nullptr)
 		m_manager->invalidate_all(m_bitmap);
+	m_manager->texture_changed();
+
+	// without tracking, or with a different layout, assume everything changed
+	if (!m_dirty_tracking || &bitmap != m_bitmap || sbounds != m_sbounds || format != m_format)
+		mark_dirty(sbounds);
 
 	// set the new bitmap/palette
 	m_bitmap = &bitmap;
@@ -418,14 +463,63 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
 	{
+		finish_scaling(elem);
 		if (elem.bitmap)
+		{
 			m_manager->invalidate_all(elem.bitmap.get());
+			m_manager->scaled_bytes_changed(-scaled_bitmap_bytes(*elem.bitmap));
+		}
 		elem.bitmap.reset();
 		elem.seqid = 0;
 	}
 }
 
 
+//-------------------------------------------------
+//  mark_dirty - note that part of the bitmap has
+//  changed since the texture was last fetched
+//-------------------------------------------------
+
+void render_texture::mark_dirty(const rectangle &area)
+{
+	if (m_dirty.empty())
+		m_dirty = area;
+	else if (!area.empty())
+		m_dirty |= area;
+}
+
+
+//-------------------------------------------------
+//  scale_callback - draw a scaled bitmap on the
+//  work queue
+//-------------------------------------------------
+
+void *render_texture::scale_callback(void *param, int threadid)
+{
+	scaled_texture &scaled(*reinterpret_cast<scaled_texture *>(param));
+	render_texture &texture(*scaled.owner);
+	bitmap_argb32 dummy;
+	(*texture.m_scaler)(*scaled.bitmap, dummy, texture.m_sbounds, texture.m_param);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  finish_scaling - wait for a scaled bitmap
+//  that's being drawn in the background
+//-------------------------------------------------
+
+void render_texture::finish_scaling(scaled_texture &scaled)
+{
+	if (scaled.pending)
+	{
+		while (!osd_work_item_wait(scaled.pending, osd_ticks_per_second() * 100)) { }
+		osd_work_item_release(scaled.pending);
+		scaled.pending = nullptr;
+	}
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -440,10 +534,13 @@ void render_texture::hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const
 
 
 //-------------------------------------------------
-//  get_scaled - get a scaled bitmap (if we can)
+//  get_scaled - get a scaled bitmap (if we can);
+//  returns false if a new size is being drawn in
+//  the background and there's nothing to show in
+//  the meantime, unless asked to block
 //-------------------------------------------------
 
-void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags)
+bool render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags, bool block)
 {
 	// source width/height come from the source bounds
 	int swidth = m_sbounds.width();
@@ -461,7 +558,7 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 	// are we scaler-free? if so, just return the source bitmap
 	if (m_scaler == nullptr || (m_bitmap != nullptr && swidth == dwidth && sheight == dheight))
 	{
-		if (m_bitmap == nullptr) return;
+		if (m_bitmap == nullptr) return true;
 
 		// add a reference and set up the source bitmap
 		primlist.add_reference(m_bitmap);
@@ -470,8 +567,31 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.width = swidth;
 		texinfo.width_margin = m_sbounds.left();
 		texinfo.height = sheight;
+		texinfo.persistent = m_persistent;
 		// palette will be set later
-		texinfo.seqid = ++m_curseq;
+
+		// without tracking, every fetch is a new sequence; with it, only
+		// fetches after something was marked dirty are, so other targets
+		// showing the same frame see the same sequence and dirty area
+		if (!m_dirty_tracking)
+		{
+			texinfo.seqid = ++m_curseq;
+			texinfo.dirty_seqid = 0;
+		}
+		else
+		{
+			if (!m_dirty.empty() || m_curseq == 0)
+			{
+				m_last_dirty = m_dirty & m_sbounds;
+				m_last_dirty.offset(-m_sbounds.left(), -m_sbounds.top());
+				m_dirty_seqid = m_curseq;
+				m_dirty.set(0, -1, 0, -1);
+				++m_curseq;
+			}
+			texinfo.seqid = m_curseq;
+			texinfo.dirty_seqid = m_dirty_seqid;
+			texinfo.dirty = m_last_dirty;
+		}
 	}
 	else
 	{
@@ -498,7 +618,7 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 
 			// didn't find one -- take the entry with the lowest seqnum
 			for (scalenum = 0; scalenum < std::size(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap.get()))
+				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !m_scaled[scalenum].pending && !primlist.has_reference(m_scaled[scalenum].bitmap.get()))
 					lowest = scalenum;
 			if (-1 == lowest)
 				throw emu_fatalerror("render_texture::get_scaled: Too many live texture instances!");
@@ -508,15 +628,55 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 			if (scaled->bitmap)
 			{
 				m_manager->invalidate_all(scaled->bitmap.get());
+				m_manager->scaled_bytes_changed(-scaled_bitmap_bytes(*scaled->bitmap));
 				scaled->bitmap.reset();
 			}
 
 			// allocate a new bitmap
 			scaled->bitmap = std::make_unique<bitmap_argb32>(dwidth, dheight);
+			m_manager->scaled_bytes_changed(scaled_bitmap_bytes(*scaled->bitmap));
 			scaled->seqid = ++m_curseq;
 
-			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+			// let the scaler do the work, on the work queue if it can run there
+			osd_work_queue *const queue = (m_background_scaling && !m_bitmap) ? m_manager->scale_queue() : nullptr;
+			if (queue)
+			{
+				scaled->owner = this;
+				scaled->pending = osd_work_item_queue(queue, &render_texture::scale_callback, scaled, 0);
+			}
+			if (!scaled->pending)
+				(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+		}
+
+		// if it isn't ready yet, keep showing the newest size that is
+		if (scaled->pending)
+		{
+			if (block)
+			{
+				finish_scaling(*scaled);
+			}
+			else if (osd_work_item_wait(scaled->pending, 0))
+			{
+				osd_work_item_release(scaled->pending);
+				scaled->pending = nullptr;
+			}
+			else
+			{
+				scaled_texture *standin = nullptr;
+				for (scaled_texture &elem : m_scaled)
+				{
+					if (elem.bitmap && !elem.pending && (!standin || (elem.seqid > standin->seqid)))
+						standin = &elem;
+				}
+				if (!standin)
+					return false;
+
+				// make sure the target builds its list again once the real one is done
+				m_manager->texture_changed();
+				scaled = standin;
+				dwidth = standin->bitmap->width();
+				dheight = standin->bitmap->height();
+			}
 		}
 
 		// finally fill out the new info
@@ -525,9 +685,12 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.rowpixels = scaled->bitmap->rowpixels();
 		texinfo.width = dwidth;
 		texinfo.height = dheight;
+		texinfo.persistent = false;
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
+		texinfo.dirty_seqid = 0;
 	}
+	return true;
 }
 
 
@@ -579,6 +742,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_lookup_serial(0)
 {
 	// make sure it is empty
 	empty();
@@ -685,6 +849,8 @@ void render_container::add_char(float x0, float y0, float height, float aspect,
 	newitem.m_texture = texture;
 	newitem.m_flags = PRIMFLAG_TEXORIENT(ROT0) | PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_PACKABLE;
 	newitem.m_internal = INTERNAL_FLAG_CHAR;
+	newitem.m_font = &font;
+	newitem.m_char = ch;
 }
 
 
@@ -811,6 +977,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	m_lookup_serial++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -847,14 +1015,14 @@ void render_container::recompute_lookups()
 
 //-------------------------------------------------
 //  update_palette - update any dirty palette
-//  entries
+//  entries; returns true if anything changed
 //-------------------------------------------------
 
-void render_container::update_palette()
+bool render_container::update_palette()
 {
 	// skip if no client
 	if (m_palclient == nullptr)
-		return;
+		return false;
 
 	// get the dirty list
 	u32 mindirty, maxdirty;
@@ -889,7 +1057,9 @@ void render_container::update_palette()
 		}
 		else
 			memcpy(&m_bcglookup[mindirty], &adjusted_palette[mindirty], (maxdirty - mindirty + 1) * sizeof(rgb_t));
+		m_lookup_serial++;
 	}
+	return dirty != nullptr;
 }
 
 
@@ -952,6 +1122,8 @@ render_target::render_target(render_manager &manager, render_container *ui, T &&
 	, m_maxtexheight(65536)
 	, m_transform_container(true)
 	, m_external_artwork(false)
+	, m_primcache(manager.machine().options().prim_cache())
+	, m_primcache_valid(false)
 {
 	// determine the base layer configuration based on options
 	m_base_layerconfig.set_zoom_to_screen(manager.machine().options().artwork_crop());
@@ -1645,6 +1817,16 @@ void render_target::compute_minimum_size(s32 &minwidth, s32 &minheight)
 
 render_primitive_list &render_target::get_primitives()
 {
+	// bring the view's items up to date for this frame
+	bool const running = m_manager.machine().phase() >= machine_phase::RESET;
+	if (running)
+		current_view().prepare_items();
+
+	// if nothing the last list was built from has changed, show it again
+	if (m_primcache && running && primitives_unchanged())
+		return m_primlist[(m_listindex + NUM_PRIMLISTS - 1) % NUM_PRIMLISTS];
+	m_primcache_valid = false;
+
 	// switch to the next primitive list
 	render_primitive_list &list = m_primlist[m_listindex];
 	m_listindex = (m_listindex + 1) % std::size(m_primlist);
@@ -1667,10 +1849,9 @@ render_primitive_list &render_target::get_primitives()
 	root_xform.orientation = m_orientation;
 	root_xform.no_center = false;
 
-	if (m_manager.machine().phase() >= machine_phase::RESET)
+	if (running)
 	{
 		// we're running - iterate over items in the view
-		current_view().prepare_items();
 		for (layout_view_item &curitem : current_view().visible_items())
 		{
 			// first apply orientation to the bounds
@@ -1735,13 +1916,142 @@ render_primitive_list &render_target::get_primitives()
 		add_container_primitives(list, root_xform, ui_xform, *m_ui_container, BLENDMODE_ALPHA);
 	}
 
+	// wait for element textures that were drawn in parallel with nothing to show meanwhile
+	for (deferred_scale const &deferred : m_deferred_scales)
+		deferred.texture->get_scaled(deferred.width, deferred.height, deferred.prim->texture, list, deferred.prim->flags, true);
+	m_deferred_scales.clear();
+
 	// optimize the list before handing it off
 	add_clear_and_optimize_primitive_list(list);
 	list.release_lock();
+	m_primcache_valid = m_primcache && running;
 	return list;
 }
 
 
+//-------------------------------------------------
+//  add_key - append the bits of a value to a
+//  primitive list key
+//-------------------------------------------------
+
+template <typename T>
+static inline void add_key(std::vector<u32> &key, T value)
+{
+	static_assert((sizeof(T) == sizeof(u32)) || (sizeof(T) == sizeof(u64)), "key values must be 32 or 64 bits");
+	if constexpr (sizeof(T) == sizeof(u64))
+	{
+		u64 bits;
+		memcpy(&bits, &value, sizeof(bits));
+		key.push_back(u32(bits));
+		key.push_back(u32(bits >> 32));
+	}
+	else
+	{
+		u32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+		key.push_back(bits);
+	}
+}
+
+
+//-------------------------------------------------
+//  primitives_unchanged - gather everything the
+//  primitive list is built from and compare it
+//  with what the last list was built from
+//-------------------------------------------------
+
+bool render_target::primitives_unchanged()
+{
+	std::vector<u32> &key = m_primcache_newkey;
+	auto const add_bounds = [&key] (render_bounds const &bounds) { add_key(key, bounds.x0); add_key(key, bounds.y0); add_key(key, bounds.x1); add_key(key, bounds.y1); };
+
+	// target geometry and global texture state
+	key.clear();
+	add_key(key, m_width);
+	add_key(key, m_height);
+	add_key(key, m_pixel_aspect);
+	add_key(key, m_orientation);
+	add_key(key, m_maxtexwidth);
+	add_key(key, m_maxtexheight);
+	add_key(key, u32(m_transform_container));
+	add_key(key, m_manager.texture_changes());
+	add_key(key, u64(uintptr_t(&current_view())));
+
+	// every visible item, with its element state or its container contents
+	bool dirty = false;
+	for (layout_view_item &curitem : current_view().visible_items())
+	{
+		render_color const color = curitem.color();
+		add_key(key, u64(uintptr_t(&curitem)));
+		add_bounds(curitem.bounds());
+		add_key(key, color.a);
+		add_key(key, color.r);
+		add_key(key, color.g);
+		add_key(key, color.b);
+		add_key(key, curitem.orientation());
+		add_key(key, curitem.blend_mode());
+		if (curitem.screen())
+		{
+			dirty = add_container_key(curitem.screen()->container()) || dirty;
+		}
+		else
+		{
+			add_key(key, curitem.element_state());
+			add_key(key, curitem.scroll_size_x());
+			add_key(key, curitem.scroll_size_y());
+			add_key(key, curitem.scroll_pos_x());
+			add_key(key, curitem.scroll_pos_y());
+			add_key(key, u32(curitem.scroll_wrap_x()) | (u32(curitem.scroll_wrap_y()) << 1));
+		}
+	}
+	if (m_ui_container)
+		dirty = add_container_key(*m_ui_container) || dirty;
+
+	// compare and keep the new key for next time
+	bool const unchanged = !dirty && m_primcache_valid && (m_primcache_newkey == m_primcache_key);
+	std::swap(m_primcache_key, m_primcache_newkey);
+	return unchanged;
+}
+
+
+//-------------------------------------------------
+//  add_container_key - add the contents of a
+//  container to the primitive list key; returns
+//  true if its palette changed
+//-------------------------------------------------
+
+bool render_target::add_container_key(render_container &container)
+{
+	std::vector<u32> &key = m_primcache_newkey;
+	render_container::user_settings const &user = container.get_user_settings();
+	add_key(key, user.m_orientation);
+	add_key(key, user.m_brightness);
+	add_key(key, user.m_contrast);
+	add_key(key, user.m_gamma);
+	add_key(key, user.m_xscale);
+	add_key(key, user.m_yscale);
+	add_key(key, user.m_xoffset);
+	add_key(key, user.m_yoffset);
+	add_key(key, u64(uintptr_t(container.overlay())));
+	add_key(key, u32(container.items().count()));
+	for (render_container::item const &curitem : container.items())
+	{
+		add_key(key, u32(curitem.type()));
+		add_key(key, curitem.flags());
+		add_key(key, curitem.bounds().x0);
+		add_key(key, curitem.bounds().y0);
+		add_key(key, curitem.bounds().x1);
+		add_key(key, curitem.bounds().y1);
+		add_key(key, curitem.color().a);
+		add_key(key, curitem.color().r);
+		add_key(key, curitem.color().g);
+		add_key(key, curitem.color().b);
+		add_key(key, curitem.width());
+		add_key(key, u64(uintptr_t(curitem.texture())));
+	}
+	return container.update_palette();
+}
+
 //-------------------------------------------------
 //  map_point_container - attempts to map a point
 //  on the specified render_target to the
@@ -1806,7 +2116,10 @@ void render_target::invalidate_all(void *refptr)
 		// if we have a reference to this object, release our list
 		list.acquire_lock();
 		if (list.has_reference(refptr))
+		{
 			list.release_all();
+			m_primcache_valid = false;
+		}
 		list.release_lock();
 	}
 }
@@ -2571,13 +2884,36 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
-					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
+					// characters are drawn once per size onto pages shared with
+					// other glyphs, so text doesn't need a texture per character
+					rectangle cell;
+					render_texture *const page = curitem.font() ? curitem.font()->get_atlas_char(curitem.character(), width, height, cell) : nullptr;
+
+					// renderers may bake the palette into what they upload, so a
+					// lookup change dirties the whole of a tracked texture
+					render_texture &texture = page ? *page : *curitem.texture();
+					if (texture.m_dirty_tracking && texture.m_lookup_serial != container.lookup_serial())
+					{
+						texture.m_lookup_serial = container.lookup_serial();
+						texture.mark_dirty(texture.m_sbounds);
+					}
+					texture.get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// set the palette
-					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
+					prim->texture.palette = texture.get_adjusted_palette(container, prim->texture.palette_length);
 
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
+					if (page)
+					{
+						float const u0(float(cell.left()) / float(prim->texture.width)), du(float(cell.width()) / float(prim->texture.width));
+						float const v0(float(cell.top()) / float(prim->texture.height)), dv(float(cell.height()) / float(prim->texture.height));
+						for (render_texuv *uv : { &prim->texcoords.tl, &prim->texcoords.tr, &prim->texcoords.bl, &prim->texcoords.br })
+						{
+							uv->u = u0 + uv->u * du;
+							uv->v = v0 + uv->v * dv;
+						}
+					}
 
 					// apply clipping
 					clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
@@ -2585,7 +2921,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					// apply the final orientation from the quad flags and then build up the final flags
 					prim->flags |= (curitem.flags() & ~(PRIMFLAG_TEXORIENT_MASK | PRIMFLAG_BLENDMODE_MASK | PRIMFLAG_TEXFORMAT_MASK))
 						| PRIMFLAG_TEXORIENT(finalorient)
-						| PRIMFLAG_TEXFORMAT(curitem.texture()->format());
+						| PRIMFLAG_TEXFORMAT(texture.format());
 					prim->flags |= blendmode != -1
 						? PRIMFLAG_BLENDMODE(blendmode)
 						: PRIMFLAG_BLENDMODE(PRIMFLAG_GET_BLENDMODE(curitem.flags()));
@@ -2724,6 +3060,10 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 				PRIMFLAG_BLENDMODE(blendmode) |
 				PRIMFLAG_TEXWRAP((item.scroll_wrap_x() || item.scroll_wrap_y()) ? 1 : 0);
 
+		// small elements that don't wrap can share the renderer's texture atlas
+		if (!item.scroll_wrap_x() && !item.scroll_wrap_y())
+			prim->flags |= PRIMFLAG_PACKABLE;
+
 		// compute the bounds
 		float const primwidth(render_round_nearest(xform.xscale));
 		float const primheight(render_round_nearest(xform.yscale));
@@ -2737,7 +3077,7 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		s32 texheight = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight) / ysize);
 		texwidth = (std::min)(texwidth, m_maxtexwidth);
 		texheight = (std::min)(texheight, m_maxtexheight);
-		texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
+		bool const ready = texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
 
 		// compute the clip rect
 		render_bounds cliprect = prim->bounds & m_bounds;
@@ -2783,6 +3123,10 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		// add to the list or free if we're clipped out
 		bool const clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
 		list.append_or_return(*prim, clipped);
+
+		// if it's being drawn in the background with no older size to show instead, pick it up once everything's queued
+		if (!ready && !clipped)
+			m_deferred_scales.push_back(deferred_scale{ prim, texture, texwidth, texheight });
 	}
 }
 
@@ -3316,6 +3660,9 @@ render_manager::render_manager(running_machine &machine)
 	, m_ui_target(nullptr)
 	, m_live_textures(0)
 	, m_texture_id(0)
+	, m_texture_changes(0)
+	, m_scaled_texture_bytes(0)
+	, m_scale_queue(nullptr)
 {
 	// register callbacks
 	machine.configuration().config_register(
@@ -3341,6 +3688,9 @@ render_manager::~render_manager()
 
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
+
+	if (m_scale_queue)
+		osd_work_queue_free(m_scale_queue);
 }
 
 
@@ -3528,6 +3878,20 @@ void render_manager::texture_free(render_texture *texture)
 }
 
 
+//-------------------------------------------------
+//  scale_queue - get the queue for drawing
+//  textures in the background, creating it on
+//  first use
+//-------------------------------------------------
+
+osd_work_queue *render_manager::scale_queue()
+{
+	if (!m_scale_queue)
+		m_scale_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_scale_queue;
+}
+
+
 //-------------------------------------------------
 //  font_alloc - allocate a new font instance
 //-------------------------------------------------
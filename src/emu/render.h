@@ -162,10 +162,13 @@ struct render_texinfo
 	u32                 width_margin;       // left margin of the scaled bounds, if applicable
 	u32                 height;             // height of the image
 	u32                 seqid;              // sequence ID
+	u32                 dirty_seqid;        // sequence ID the dirty area is relative to, or 0 if unknown
+	rectangle           dirty;              // area changed since dirty_seqid, relative to base
 	u64                 unique_id;          // unique identifier to pass to osd
 	u64                 old_id;             // previously allocated id, if applicable
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
 	u32                 palette_length;
+	bool                persistent;         // base stays valid and unmodified until the next frame's primitives are built
 };
 
 
@@ -334,12 +337,22 @@ public:
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
 
+	// promise that the bitmap is not written while the OSD may still be reading it
+	void set_persistent(bool persistent) { m_persistent = persistent; }
+
+	// report which parts of the bitmap change, so the OSD can upload only those
+	void set_dirty_tracking(bool tracking) { m_dirty_tracking = tracking; }
+	void mark_dirty(const rectangle &area);
+
+	// allow new sizes to be drawn on the work queue (scaler must be thread-safe and not need a source bitmap)
+	void set_background_scaling(bool enable) { m_background_scaling = enable; }
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
 private:
 	// internal helpers
-	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
+	bool get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0, bool block = false);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
 
 	static constexpr int MAX_TEXTURE_SCALES = 100;
@@ -349,8 +362,13 @@ private:
 	{
 		std::unique_ptr<bitmap_argb32>  bitmap;     // final bitmap
 		u32                             seqid;      // sequence number
+		osd_work_item *                 pending;    // work item still drawing the bitmap
+		render_texture *                owner;      // texture the work item is drawing for
 	};
 
+	static void *scale_callback(void *param, int threadid);
+	void finish_scaling(scaled_texture &scaled);
+
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -359,10 +377,19 @@ private:
 	texture_format      m_format;                   // format of the texture data
 	u64                 m_id;                       // unique id to pass to osd
 	u64                 m_old_id;                   // previous id, if applicable
+	bool                m_persistent;               // OSD may reference the bitmap rather than copy it
+
+	// dirty tracking state (unscaled only)
+	bool                m_dirty_tracking;           // set_bitmap no longer implies the whole bitmap changed
+	rectangle           m_dirty;                    // area changed since the last sequence number
+	rectangle           m_last_dirty;               // area changed between m_dirty_seqid and m_curseq
+	u32                 m_dirty_seqid;              // sequence number m_last_dirty is relative to
+	u32                 m_lookup_serial;            // container lookup serial the OSD last saw
 
 	// scaling state (ARGB32 only)
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
+	bool                m_background_scaling;       // new sizes are drawn on the work queue
 	u32                 m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
 };
@@ -438,7 +465,7 @@ private:
 		friend class simple_list<item>;
 
 	public:
-		item() : m_next(nullptr), m_type(0), m_flags(0), m_internal(0), m_width(0), m_texture(nullptr) { }
+		item() : m_next(nullptr), m_type(0), m_flags(0), m_internal(0), m_width(0), m_texture(nullptr), m_font(nullptr), m_char(0) { }
 
 		// getters
 		item *next() const { return m_next; }
@@ -449,6 +476,8 @@ private:
 		u32 internal() const { return m_internal; }
 		float width() const { return m_width; }
 		render_texture *texture() const { return m_texture; }
+		render_font *font() const { return m_font; }
+		char32_t character() const { return m_char; }
 
 	private:
 		// internal state
@@ -460,6 +489,8 @@ private:
 		u32                 m_internal;         // internal flags
 		float               m_width;            // width of the line (lines only)
 		render_texture *    m_texture;          // pointer to the source texture (quads only)
+		render_font *       m_font;             // font the character comes from (characters only)
+		char32_t            m_char;             // character code (characters only)
 	};
 
 	// generic screen overlay scaler
@@ -469,7 +500,8 @@ private:
 	const simple_list<item> &items() const { return m_itemlist; }
 	item &add_generic(u8 type, float x0, float y0, float x1, float y1, rgb_t argb);
 	void recompute_lookups();
-	void update_palette();
+	bool update_palette();
+	u32 lookup_serial() const { return m_lookup_serial; }
 
 	// internal state
 	render_manager &        m_manager;              // reference back to the owning manager
@@ -482,6 +514,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_lookup_serial;        // bumped whenever either lookup table changes
 };
 
 
@@ -579,9 +612,11 @@ private:
 	struct object_transform;
 	struct pointer_info;
 	struct hit_test;
+	struct deferred_scale;
 
 	using pointer_info_vector = std::vector<pointer_info>;
 	using hit_test_vector = std::vector<hit_test>;
+	using deferred_scale_vector = std::vector<deferred_scale>;
 
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
@@ -612,6 +647,10 @@ private:
 	void add_clear_extents(render_primitive_list &list);
 	void add_clear_and_optimize_primitive_list(render_primitive_list &list);
 
+	// primitive list caching
+	bool primitives_unchanged();
+	bool add_container_key(render_container &container);
+
 	// internal state
 	render_target *         m_next;                     // link to next target
 	render_manager &        m_manager;                  // reference to our owning manager
@@ -646,6 +685,11 @@ private:
 	bool                    m_transform_container;      // determines whether the screen container is transformed by the core renderer,
 														// otherwise the respective render API will handle the transformation (scale, offset)
 	bool                    m_external_artwork;         // external artwork was loaded (driver file or override)
+	bool                    m_primcache;                // redisplay the last primitive list while its inputs are unchanged
+	bool                    m_primcache_valid;          // the last primitive list hasn't been released since it was built
+	std::vector<u32>        m_primcache_key;            // inputs the last primitive list was built from
+	std::vector<u32>        m_primcache_newkey;         // inputs for the current frame
+	deferred_scale_vector   m_deferred_scales;          // element textures still being drawn with nothing to show meanwhile
 };
 
 
@@ -693,6 +737,11 @@ public:
 
 	// reference tracking
 	void invalidate_all(void *refptr);
+	void texture_changed() { m_texture_changes++; }
+	u32 texture_changes() const { return m_texture_changes; }
+	osd_work_queue *scale_queue();
+	void scaled_bytes_changed(s64 delta) { m_scaled_texture_bytes += delta; }
+	u64 scaled_texture_bytes() const { return m_scaled_texture_bytes; }
 
 	// resolve tag lookups
 	void resolve_tags();
@@ -712,7 +761,10 @@ private:
 	// texture lists
 	u32                             m_live_textures;            // number of live textures
 	u64                             m_texture_id;               // rolling texture ID counter
+	u32                             m_texture_changes;          // number of texture bitmap changes
+	u64                             m_scaled_texture_bytes;     // memory used by scaled texture bitmaps
 	fixed_allocator<render_texture> m_texture_allocator;        // texture allocator
+	osd_work_queue *                m_scale_queue;              // queue for drawing textures in the background
 
 	// containers for UI elements and for screens
 	std::list<render_container>     m_ui_containers;            // containers for drawing UI elements
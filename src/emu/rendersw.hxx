@@ -14,7 +14,11 @@
 #include "video/rgbutil.h"
 #include "render.h"
 
+#include "osdcore.h"
+
+#include <algorithm>
 #include <array>
+#include <iterator>
 
 template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB, bool NoDestRead = false, bool BilinearFilter = false>
 class software_renderer
@@ -29,6 +33,19 @@ private:
 		s32 endx, endy;
 	};
 
+	// one horizontal band of a parallel draw
+	struct draw_band
+	{
+		render_primitive_list const *primlist;
+		PixelType *dstdata;
+		s32 width, height;
+		u32 pitch;
+		s32 top, bottom;
+	};
+
+	// minimum number of rows worth handing to another thread
+	static constexpr s32 MIN_BAND_HEIGHT = 16;
+
 	// internal helpers
 	template <int... Values>
 	static auto make_cosine_table(std::integer_sequence<int, Values...>)
@@ -63,6 +80,18 @@ private:
 			return dest_assemble_rgb(source32_r(pixel), source32_g(pixel), source32_b(pixel));
 	}
 
+	// destinations in the standard format can be blended a whole pixel at a time
+	static constexpr bool VectorBlend = std::is_same_v<PixelType, u32> && SrcShiftR == 0 && SrcShiftG == 0 && SrcShiftB == 0 && DstShiftR == 16 && DstShiftG == 8 && DstShiftB == 0;
+
+	// (pix * scale + dpix * invscale) >> 8 for each colour channel; the scales
+	// must leave alpha at zero and be no larger than 256
+	static inline PixelType blend_rgbaint(u32 pix, u32 dpix, rgbaint_t const &scale, rgbaint_t const &invscale)
+	{
+		rgbaint_t result(pix);
+		result.scale2_add_and_clamp(scale, rgbaint_t(dpix), invscale);
+		return u32(result.to_rgba());
+	}
+
 
 	//-------------------------------------------------
 	//  ycc_to_rgb - convert YCC to RGB; the YCC pixel
@@ -427,10 +456,11 @@ private:
 
 
 	//-------------------------------------------------
-	//  draw_line - draw a line or point
+	//  draw_line - draw a line or point, clipped to
+	//  rows top to bottom - 1
 	//-------------------------------------------------
 
-	static void draw_line(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_line(render_primitive const &prim, PixelType *dstdata, s32 width, s32 top, s32 bottom, u32 pitch)
 	{
 		// internal cosine table generated at compile time
 		static auto const s_cosine_table = make_cosine_table(std::make_integer_sequence<int, 2049>());
@@ -470,7 +500,7 @@ private:
 					{
 						dx = bwidth;    // init diameter of beam
 						dy = y1 >> 16;
-						if (dy >= 0 && dy < height)
+						if (dy >= top && dy < bottom)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(0xff & (~y1 >> 8), col));
 						dy++;
 						dx -= 0x10000 - (0xffff & y1); // take off amount plotted
@@ -478,11 +508,11 @@ private:
 						dx >>= 16;                     // adjust to pixel (solid) count
 						while (dx--)                   // plot rest of pixels
 						{
-							if (dy >= 0 && dy < height)
+							if (dy >= top && dy < bottom)
 								draw_aa_pixel(dstdata, pitch, x1, dy, col);
 							dy++;
 						}
-						if (dy >= 0 && dy < height)
+						if (dy >= top && dy < bottom)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(a1,col));
 					}
 					if (x1 == xx) break;
@@ -502,7 +532,7 @@ private:
 				x1 -= bwidth >> 1; // start back half the width
 				for (;;)
 				{
-					if (y1 >= 0 && y1 < height)
+					if (y1 >= top && y1 < bottom)
 					{
 						dy = bwidth;    // calc diameter of beam
 						dx = x1 >> 16;
@@ -545,7 +575,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= top && y1 < bottom)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (x1 == x2) break;
 					x1 += sx;
@@ -561,7 +591,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= top && y1 < bottom)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (y1 == y2) break;
 					y1 += sy;
@@ -582,10 +612,11 @@ private:
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_rect - draw a solid rectangle
+	//  draw_rect - draw a solid rectangle, clipped
+	//  to rows top to bottom - 1
 	//-------------------------------------------------
 
-	static void draw_rect(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(render_primitive const &prim, PixelType *dstdata, s32 width, s32 top, s32 bottom, u32 pitch)
 	{
 		render_bounds const fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -593,9 +624,9 @@ private:
 
 		// clamp to integers and ensure we fit
 		s32 const startx = std::clamp<s32>(round_nearest(fpos.x0), 0, width);
-		s32 const starty = std::clamp<s32>(round_nearest(fpos.y0), 0, height);
+		s32 const starty = std::clamp<s32>(round_nearest(fpos.y0), top, bottom);
 		s32 const endx = std::clamp<s32>(round_nearest(fpos.x1), 0, width);
-		s32 const endy = std::clamp<s32>(round_nearest(fpos.y1), 0, height);
+		s32 const endy = std::clamp<s32>(round_nearest(fpos.y1), top, bottom);
 
 		// bail if nothing left
 		if ((startx > endx) || (starty > endy))
@@ -703,6 +734,7 @@ private:
 			u32 const sr = u32(std::clamp(256.0f * prim.color.r, 0.0f, 256.0f));
 			u32 const sg = u32(std::clamp(256.0f * prim.color.g, 0.0f, 256.0f));
 			u32 const sb = u32(std::clamp(256.0f * prim.color.b, 0.0f, 256.0f));
+			rgbaint_t const scale(0, sr, sg, sb), noscale(0, 0, 0, 0);
 
 			// loop over rows
 			for (s32 y = setup.starty; y < setup.endy; y++)
@@ -715,11 +747,16 @@ private:
 				for (s32 x = setup.startx; x < setup.endx; x++)
 				{
 					u32 const pix = gettexel(prim, curu, curv);
-					u32 const r = (source32_r(pix) * sr) >> 8;
-					u32 const g = (source32_g(pix) * sg) >> 8;
-					u32 const b = (source32_b(pix) * sb) >> 8;
+					if constexpr (VectorBlend)
+						*dest++ = blend_rgbaint(pix, 0, scale, noscale);
+					else
+					{
+						u32 const r = (source32_r(pix) * sr) >> 8;
+						u32 const g = (source32_g(pix) * sg) >> 8;
+						u32 const b = (source32_b(pix) * sb) >> 8;
 
-					*dest++ = dest_assemble_rgb(r, g, b);
+						*dest++ = dest_assemble_rgb(r, g, b);
+					}
 					curu += setup.dudx;
 					curv += setup.dvdx;
 				}
@@ -734,6 +771,7 @@ private:
 			u32 const sg = u32(std::clamp(256.0f * prim.color.g * prim.color.a, 0.0f, 256.0f));
 			u32 const sb = u32(std::clamp(256.0f * prim.color.b * prim.color.a, 0.0f, 256.0f));
 			u32 const invsa = u32(std::clamp(256.0f * (1.0f - prim.color.a), 0.0f, 256.0f));
+			rgbaint_t const scale(0, sr, sg, sb), invscale(0, invsa, invsa, invsa);
 
 			// loop over rows
 			for (s32 y = setup.starty; y < setup.endy; y++)
@@ -747,11 +785,16 @@ private:
 				{
 					u32 const pix = gettexel(prim, curu, curv);
 					u32 const dpix = NoDestRead ? 0 : *dest;
-					u32 const r = (source32_r(pix) * sr + dest_r(dpix) * invsa) >> 8;
-					u32 const g = (source32_g(pix) * sg + dest_g(dpix) * invsa) >> 8;
-					u32 const b = (source32_b(pix) * sb + dest_b(dpix) * invsa) >> 8;
+					if constexpr (VectorBlend)
+						*dest++ = blend_rgbaint(pix, dpix, scale, invscale);
+					else
+					{
+						u32 const r = (source32_r(pix) * sr + dest_r(dpix) * invsa) >> 8;
+						u32 const g = (source32_g(pix) * sg + dest_g(dpix) * invsa) >> 8;
+						u32 const b = (source32_b(pix) * sb + dest_b(dpix) * invsa) >> 8;
 
-					*dest++ = dest_assemble_rgb(r, g, b);
+						*dest++ = dest_assemble_rgb(r, g, b);
+					}
 					curu += setup.dudx;
 					curv += setup.dvdx;
 				}
@@ -887,6 +930,7 @@ private:
 			u32 const sr = u32(std::clamp(256.0f * prim.color.r, 0.0f, 256.0f));
 			u32 const sg = u32(std::clamp(256.0f * prim.color.g, 0.0f, 256.0f));
 			u32 const sb = u32(std::clamp(256.0f * prim.color.b, 0.0f, 256.0f));
+			rgbaint_t const scale(0, sr, sg, sb), noscale(0, 0, 0, 0);
 
 			// loop over rows
 			for (s32 y = setup.starty; y < setup.endy; y++)
@@ -903,11 +947,16 @@ private:
 					for (s32 x = setup.startx; x < setup.endx; x++)
 					{
 						u32 const pix = get_texel_rgb32<Wrap>(prim.texture, curu, curv);
-						u32 const r = (source32_r(pix) * sr) >> 8;
-						u32 const g = (source32_g(pix) * sg) >> 8;
-						u32 const b = (source32_b(pix) * sb) >> 8;
+						if constexpr (VectorBlend)
+							*dest++ = blend_rgbaint(pix, 0, scale, noscale);
+						else
+						{
+							u32 const r = (source32_r(pix) * sr) >> 8;
+							u32 const g = (source32_g(pix) * sg) >> 8;
+							u32 const b = (source32_b(pix) * sb) >> 8;
 
-						*dest++ = dest_assemble_rgb(r, g, b);
+							*dest++ = dest_assemble_rgb(r, g, b);
+						}
 						curu += setup.dudx;
 						curv += setup.dvdx;
 					}
@@ -940,6 +989,7 @@ private:
 			u32 const sg = u32(std::clamp(256.0f * prim.color.g * prim.color.a, 0.0f, 256.0f));
 			u32 const sb = u32(std::clamp(256.0f * prim.color.b * prim.color.a, 0.0f, 256.0f));
 			u32 const invsa = u32(std::clamp(256.0f * (1.0f - prim.color.a), 0.0f, 256.0f));
+			rgbaint_t const scale(0, sr, sg, sb), invscale(0, invsa, invsa, invsa);
 
 			// loop over rows
 			for (s32 y = setup.starty; y < setup.endy; y++)
@@ -957,11 +1007,16 @@ private:
 					{
 						u32 const pix = get_texel_rgb32<Wrap>(prim.texture, curu, curv);
 						u32 const dpix = NoDestRead ? 0 : *dest;
-						u32 const r = (source32_r(pix) * sr + dest_r(dpix) * invsa) >> 8;
-						u32 const g = (source32_g(pix) * sg + dest_g(dpix) * invsa) >> 8;
-						u32 const b = (source32_b(pix) * sb + dest_b(dpix) * invsa) >> 8;
+						if constexpr (VectorBlend)
+							*dest++ = blend_rgbaint(pix, dpix, scale, invscale);
+						else
+						{
+							u32 const r = (source32_r(pix) * sr + dest_r(dpix) * invsa) >> 8;
+							u32 const g = (source32_g(pix) * sg + dest_g(dpix) * invsa) >> 8;
+							u32 const b = (source32_b(pix) * sb + dest_b(dpix) * invsa) >> 8;
 
-						*dest++ = dest_assemble_rgb(r, g, b);
+							*dest++ = dest_assemble_rgb(r, g, b);
+						}
 						curu += setup.dudx;
 						curv += setup.dvdx;
 					}
@@ -1280,11 +1335,16 @@ private:
 						{
 							u32 const dpix = NoDestRead ? 0 : *dest;
 							u32 const invta = 0x100 - ta;
-							u32 const r = (source32_r(pix) * ta + dest_r(dpix) * invta) >> 8;
-							u32 const g = (source32_g(pix) * ta + dest_g(dpix) * invta) >> 8;
-							u32 const b = (source32_b(pix) * ta + dest_b(dpix) * invta) >> 8;
-
-							*dest = dest_assemble_rgb(r, g, b);
+							if constexpr (VectorBlend)
+								*dest = blend_rgbaint(pix, dpix, rgbaint_t(0, ta, ta, ta), rgbaint_t(0, invta, invta, invta));
+							else
+							{
+								u32 const r = (source32_r(pix) * ta + dest_r(dpix) * invta) >> 8;
+								u32 const g = (source32_g(pix) * ta + dest_g(dpix) * invta) >> 8;
+								u32 const b = (source32_b(pix) * ta + dest_b(dpix) * invta) >> 8;
+
+								*dest = dest_assemble_rgb(r, g, b);
+							}
 						}
 						dest++;
 						curu += setup.dudx;
@@ -1542,10 +1602,11 @@ private:
 	//-------------------------------------------------
 	//  setup_and_draw_textured_quad - perform setup
 	//  and then dispatch to a texture-mode-specific
-	//  drawing routine
+	//  drawing routine; only rows top to bottom - 1
+	//  are drawn
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, s32 top, s32 bottom, u32 pitch)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1592,6 +1653,16 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// clip to the band, stepping the texture coordinates to the first row drawn
+		if (setup.starty < top)
+		{
+			setup.startu += (top - setup.starty) * setup.dudy;
+			setup.startv += (top - setup.starty) * setup.dvdy;
+			setup.starty = top;
+		}
+		if (setup.endy > bottom)
+			setup.endy = bottom;
+
 		auto const gettexel_palette16 =
 				[] (render_primitive const &prim, s32 u, s32 v) -> u32
 				{
@@ -1739,30 +1810,89 @@ private:
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_primitives - draw a series of primitives
-	//  using a software rasterizer
+	//  draw_primitives_band - draw the parts of a
+	//  series of primitives that fall within rows
+	//  top to bottom - 1
 	//-------------------------------------------------
 
-public:
-	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	static void draw_primitives_band(render_primitive_list const &primlist, PixelType *dstdata, s32 width, s32 height, u32 pitch, s32 top, s32 bottom)
 	{
 		// loop over the list and render each element
 		for (render_primitive const *prim = primlist.first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+					draw_line(*prim, dstdata, width, top, bottom, pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, dstdata, width, top, bottom, pitch);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, dstdata, width, height, top, bottom, pitch);
 					break;
 
 				default:
 					throw emu_fatalerror("Unexpected render_primitive type");
 			}
 	}
+
+
+	//-------------------------------------------------
+	//  draw_band_callback - work item callback for a
+	//  band of a parallel draw
+	//-------------------------------------------------
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		draw_band const &band = *reinterpret_cast<draw_band const *>(param);
+		draw_primitives_band(*band.primlist, band.dstdata, band.width, band.height, band.pitch, band.top, band.bottom);
+		return nullptr;
+	}
+
+public:
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  using a software rasterizer
+	//-------------------------------------------------
+
+	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	{
+		draw_primitives_band(primlist, reinterpret_cast<PixelType *>(dstdata), width, height, pitch, 0, height);
+	}
+
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  in up to 'bands' horizontal bands on a work
+	//  queue; every pixel belongs to exactly one band
+	//  so the result matches a serial draw
+	//-------------------------------------------------
+
+	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue, int bands)
+	{
+		draw_band band[16];
+		int const count = std::min<int>({ bands, int(std::size(band)), int(height / MIN_BAND_HEIGHT) });
+		if (!queue || count < 2)
+		{
+			draw_primitives(primlist, dstdata, width, height, pitch);
+			return;
+		}
+
+		for (int index = 0; index < count; index++)
+		{
+			band[index].primlist = &primlist;
+			band[index].dstdata = reinterpret_cast<PixelType *>(dstdata);
+			band[index].width = width;
+			band[index].height = height;
+			band[index].pitch = pitch;
+			band[index].top = height * index / count;
+			band[index].bottom = height * (index + 1) / count;
+		}
+
+		// the calling thread draws the first band itself
+		osd_work_item_queue_multiple(queue, &draw_band_callback, count - 1, &band[1], sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		draw_band_callback(&band[0], 0);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
+	}
 };
@@ -570,6 +570,9 @@ render_font::~render_font()
 			}
 			delete[] elem;
 		}
+
+	for (auto const &page : m_atlas_pages)
+		m_manager.texture_free(page->texture);
 }
 
 
@@ -779,6 +782,66 @@ void render_font::get_scaled_bitmap_and_bounds(bitmap_argb32 &dest, float height
 }
 
 
+//-------------------------------------------------
+//  get_atlas_char - return the atlas page holding
+//  a character drawn at the given pixel size and
+//  the area it occupies, or nullptr if it should
+//  use its own texture
+//-------------------------------------------------
+
+render_texture *render_font::get_atlas_char(char32_t chnum, s32 width, s32 height, rectangle &bounds)
+{
+	// big glyphs wouldn't share a page with much, so they keep their own textures
+	if ((width <= 0) || (height <= 0) || ((width + 2) > ATLAS_PAGE_SIZE) || ((height + 2) > ATLAS_PAGE_SIZE))
+		return nullptr;
+
+	u64 const key((u64(chnum) << 32) | (u64(width) << 16) | u64(height));
+	auto found = m_atlas_cells.find(key);
+	if (found == m_atlas_cells.end())
+	{
+		glyph &gl = get_char(chnum);
+		if (!gl.texture)
+			return nullptr;
+
+		// take the next space on the last page, leaving a gutter so filtering doesn't pick up the neighbours
+		atlas_page *page = m_atlas_pages.empty() ? nullptr : m_atlas_pages.back().get();
+		if (page && ((page->x + width + 1) > ATLAS_PAGE_SIZE))
+		{
+			page->x = 1;
+			page->y += page->rowheight + 1;
+			page->rowheight = 0;
+		}
+		if (!page || ((page->y + height + 1) > ATLAS_PAGE_SIZE))
+		{
+			// stop growing if sizes keep changing; the glyphs' own textures still work
+			if (m_atlas_pages.size() >= ATLAS_MAX_PAGES)
+				return nullptr;
+
+			page = m_atlas_pages.emplace_back(std::make_unique<atlas_page>()).get();
+			page->bitmap.allocate(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+			page->bitmap.fill(0);
+			page->texture = m_manager.texture_alloc();
+			page->texture->set_dirty_tracking(true);
+			page->texture->set_bitmap(page->bitmap, page->bitmap.cliprect(), TEXFORMAT_ARGB32);
+			page->x = page->y = 1;
+			page->rowheight = 0;
+		}
+
+		// draw the glyph once at this size
+		atlas_cell const cell{ unsigned(m_atlas_pages.size() - 1), rectangle(page->x, page->x + width - 1, page->y, page->y + height - 1) };
+		bitmap_argb32 dest(page->bitmap, cell.bounds);
+		render_texture::hq_scale(dest, gl.bitmap, gl.bitmap.cliprect(), nullptr);
+		page->texture->mark_dirty(cell.bounds);
+		page->x += width + 1;
+		page->rowheight = (std::max)(page->rowheight, height);
+		found = m_atlas_cells.emplace(key, cell).first;
+	}
+
+	bounds = found->second.bounds;
+	return m_atlas_pages[found->second.page]->texture;
+}
+
+
 //-------------------------------------------------
 //  char_width - return the width of a character
 //  at the given height
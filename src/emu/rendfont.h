@@ -11,6 +11,10 @@
 #ifndef MAME_EMU_RENDFONT_H
 #define MAME_EMU_RENDFONT_H
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -41,6 +45,7 @@ public:
 	// texture/bitmap queries
 	render_texture *get_char_texture_and_bounds(float height, float aspect, char32_t ch, render_bounds &bounds);
 	void get_scaled_bitmap_and_bounds(bitmap_argb32 &dest, float height, float aspect, char32_t chnum, rectangle &bounds);
+	render_texture *get_atlas_char(char32_t chnum, s32 width, s32 height, rectangle &bounds);
 
 private:
 	// a glyph describes a single glyph
@@ -68,6 +73,22 @@ private:
 		rgb_t               color;
 	};
 
+	// a page of glyphs drawn at the sizes they're shown at
+	struct atlas_page
+	{
+		bitmap_argb32       bitmap;             // glyphs separated by a transparent gutter
+		render_texture *    texture;            // texture wrapping the whole page
+		s32                 x, y;               // where the next glyph goes
+		s32                 rowheight;          // height of the current shelf
+	};
+
+	// where a glyph drawn at a given size lives
+	struct atlas_cell
+	{
+		unsigned            page;               // index of the page holding it
+		rectangle           bounds;             // area of the page it occupies
+	};
+
 	// internal format
 	enum class format
 	{
@@ -104,8 +125,13 @@ private:
 	EQUIVALENT_ARRAY(m_glyphs, glyph *) m_glyphs_cmd; // array of glyph subtables
 	std::vector<char>   m_rawdata_cmd;      // pointer to the raw data for the font
 
+	std::vector<std::unique_ptr<atlas_page> > m_atlas_pages;    // pages of scaled glyphs
+	std::unordered_map<u64, atlas_cell> m_atlas_cells;          // glyph and size to page area
+
 	// constants
 	static const u64 CACHED_BDF_HASH_SIZE   = 1024;
+	static constexpr s32 ATLAS_PAGE_SIZE    = 128;
+	static constexpr unsigned ATLAS_MAX_PAGES = 32;
 };
 
 std::string convert_command_glyph(std::string_view str);
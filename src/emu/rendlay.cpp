@@ -1642,6 +1642,8 @@ render_texture *layout_element::state_texture(int state)
 		m_elemtex[state].m_element = this;
 		m_elemtex[state].m_state = state;
 		m_elemtex[state].m_texture = machine().render().texture_alloc(element_scale, &m_elemtex[state]);
+
+		m_elemtex[state].m_texture->set_background_scaling(can_draw_in_background());
 	}
 	return m_elemtex[state].m_texture;
 }
@@ -1655,6 +1657,30 @@ render_texture *layout_element::state_texture(int state)
 void layout_element::set_draw_callback(draw_delegate &&handler)
 {
 	m_draw = std::move(handler);
+	for (texture &tex : m_elemtex)
+	{
+		if (tex.m_texture)
+			tex.m_texture->set_background_scaling(can_draw_in_background());
+	}
+}
+
+
+//-------------------------------------------------
+//  can_draw_in_background - whether new sizes can
+//  be drawn on the work queue
+//-------------------------------------------------
+
+bool layout_element::can_draw_in_background() const
+{
+	// driver draw callbacks may look at emulated state
+	if (!m_draw.isnull())
+		return false;
+	for (component::ptr const &curcomp : m_complist)
+	{
+		if (curcomp->needs_main_thread())
+			return false;
+	}
+	return true;
 }
 
 
@@ -1665,6 +1691,7 @@ void layout_element::set_draw_callback(draw_delegate &&handler)
 
 void layout_element::preload()
 {
+	std::lock_guard<std::mutex> lock(m_draw_lock);
 	for (component::ptr const &curcomp : m_complist)
 		curcomp->preload(machine());
 }
@@ -1699,6 +1726,9 @@ void layout_element::element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, c
 {
 	texture const &elemtex(*reinterpret_cast<texture const *>(param));
 
+	// this may run on the work queue, and components load lazily
+	std::lock_guard<std::mutex> lock(elemtex.m_element->m_draw_lock);
+
 	// draw components that are visible in the current state
 	for (auto const &curcomp : elemtex.m_element->m_complist)
 	{
@@ -1772,13 +1802,18 @@ private:
 		float const yscale(bounds.height() / m_svg->height);
 		float const drawscale((std::max)(xscale, yscale));
 		bitmap_argb32 tempbitmap(int(m_svg->width * drawscale), int(m_svg->height * drawscale));
-		nsvgRasterize(
-				m_rasterizer.get(),
-				m_svg.get(),
-				0, 0, drawscale,
-				reinterpret_cast<unsigned char *>(&tempbitmap.pix(0)),
-				tempbitmap.width(), tempbitmap.height(),
-				tempbitmap.rowbytes());
+		{
+			// the rasteriser is shared by every image in a layout file
+			static std::mutex s_rasterizer_lock;
+			std::lock_guard<std::mutex> lock(s_rasterizer_lock);
+			nsvgRasterize(
+					m_rasterizer.get(),
+					m_svg.get(),
+					0, 0, drawscale,
+					reinterpret_cast<unsigned char *>(&tempbitmap.pix(0)),
+					tempbitmap.width(), tempbitmap.height(),
+					tempbitmap.rowbytes());
+		}
 
 		// correct colour format and multiply by state colour
 		bool havealpha(false);
@@ -2480,6 +2515,12 @@ public:
 
 protected:
 	// overrides
+	virtual bool needs_main_thread() const override
+	{
+		// OSD fonts can't be used from the work queue
+		return true;
+	}
+
 	virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		auto font = machine.render().font_alloc("default");
@@ -3064,6 +3105,12 @@ protected:
 	// overrides
 	virtual int maxstate() const override { return m_maxstate; }
 
+	virtual bool needs_main_thread() const override
+	{
+		// OSD fonts can't be used from the work queue
+		return true;
+	}
+
 	virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		auto font = machine.render().font_alloc("default");
@@ -3121,6 +3168,12 @@ public:
 	}
 
 	// overrides
+	virtual bool needs_main_thread() const override
+	{
+		// OSD fonts can't be used from the work queue
+		return true;
+	}
+
 	virtual void preload(running_machine &machine) override
 	{
 		for (int i = 0; i < m_numstops; i++)
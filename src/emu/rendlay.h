@@ -22,6 +22,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -124,6 +125,7 @@ private:
 		// operations
 		virtual void preload(running_machine &machine);
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, int state);
+		virtual bool needs_main_thread() const { return false; }
 
 	protected:
 		// helpers
@@ -188,6 +190,7 @@ private:
 	typedef std::map<std::string, make_component_func> make_component_map;
 
 	// internal helpers
+	bool can_draw_in_background() const;
 	static void element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 	template <typename T> static component::ptr make_component(environment &env, util::xml::data_node const &compnode);
 
@@ -202,6 +205,7 @@ private:
 	std::vector<texture>        m_elemtex;      // array of element textures used for managing the scaled bitmaps
 	draw_delegate               m_draw;         // draw delegate (called after components are drawn)
 	bool                        m_invalidated;  // force redrawing on next frame if set
+	std::mutex                  m_draw_lock;    // components load and draw one state at a time
 };
 
 
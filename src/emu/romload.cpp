@@ -11,9 +11,11 @@
 #include "emu.h"
 #include "romload.h"
 
+#include "benchlog.h"
 #include "drivenum.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "hashcache.h"
 #include "main.h"
 #include "softlist_dev.h"
 
@@ -24,6 +26,7 @@
 
 #include <algorithm>
 #include <cstdarg>
+#include <cstdio>
 #include <set>
 
 
@@ -37,6 +40,10 @@
 
 #define TEMPBUFFER_MAX_SIZE     (1024 * 1024 * 1024)
 
+// files waiting to be hashed are kept open, holding the data of archived
+// ones in memory, so wait for them once this much is outstanding
+#define PENDING_HASH_MAX_SIZE   (256 * 1024 * 1024)
+
 /***************************************************************************
     HELPERS
 ****************************************************************************/
@@ -630,6 +637,87 @@ void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view n
 }
 
 
+/*-------------------------------------------------
+    queue_verify - hand a file to a worker
+    thread to compute its hashes, verifying it
+    once they're done
+-------------------------------------------------*/
+
+void rom_load_manager::queue_verify(std::unique_ptr<emu_file> &&file, std::string_view name, u32 explength, const util::hash_collection &hashes)
+{
+	// files whose hashes are in the cache can be verified straight away
+	std::string cachekey;
+	if (m_hash_cache)
+	{
+		cachekey = hash_cache::key(*file);
+		if (m_hash_cache->find(cachekey, hashes.hash_types(), file->hashes("")))
+		{
+			verify_length_and_hash(file.get(), name, explength, hashes);
+			return;
+		}
+	}
+
+	// without a queue, just verify it now
+	if (!m_hash_queue)
+	{
+		verify_length_and_hash(file.get(), name, explength, hashes);
+		if (m_hash_cache)
+			m_hash_cache->add(std::move(cachekey), file->hashes(""));
+		return;
+	}
+
+	u64 const length = file->size();
+	std::unique_ptr<pending_hash> &pending = m_pending_hashes.emplace_back(new pending_hash{ std::move(file), std::string(name), explength, hashes, std::move(cachekey) });
+	osd_work_item_queue(m_hash_queue, &rom_load_manager::compute_hashes_callback, pending.get(), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	m_pending_hash_bytes += length;
+	if (m_pending_hash_bytes >= PENDING_HASH_MAX_SIZE)
+		finish_pending_verifies();
+}
+
+
+/*-------------------------------------------------
+    compute_hashes_callback - compute the hashes
+    verify_length_and_hash will need for a file
+-------------------------------------------------*/
+
+void *rom_load_manager::compute_hashes_callback(void *param, int threadid)
+{
+	// the data has already been read, so this only touches the file itself
+	pending_hash &pending = *reinterpret_cast<pending_hash *>(param);
+	if (!pending.expected.flag(util::hash_collection::FLAG_NO_DUMP))
+	{
+		if (pending.file->hashes(pending.expected.hash_types()) != pending.expected)
+			pending.file->hashes(util::hash_collection::HASH_TYPES_ALL);
+	}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    finish_pending_verifies - wait for the hashes
+    of all queued files and verify them in the
+    order they were loaded
+-------------------------------------------------*/
+
+void rom_load_manager::finish_pending_verifies()
+{
+	if (m_pending_hashes.empty())
+		return;
+
+	osd_work_queue_wait(m_hash_queue, osd_ticks_per_second() * 100);
+	for (std::unique_ptr<pending_hash> const &pending : m_pending_hashes)
+	{
+		LOG("Verifying length (%X) and checksums of %s\n", pending->explength, pending->name.c_str());
+		verify_length_and_hash(pending->file.get(), pending->name, pending->explength, pending->expected);
+		if (m_hash_cache)
+			m_hash_cache->add(std::move(pending->cachekey), pending->file->hashes(""));
+	}
+	m_pending_hashes.clear();
+	m_pending_hash_bytes = 0;
+}
+
+
 /*-------------------------------------------------
     display_loading_rom_message - display
     messages about ROM loading to the user
@@ -924,6 +1012,40 @@ int rom_load_manager::read_rom_data(
 }
 
 
+/*-------------------------------------------------
+    map_rom_file - map a loose file that makes up
+    a whole region on its own in place of reading
+    it
+-------------------------------------------------*/
+
+bool rom_load_manager::map_rom_file(emu_file &file, memory_region &region, const rom_entry *parent_region, const rom_entry *romp)
+{
+	if (!machine().options().map_roms())
+		return false;
+
+	// it has to be the only entry, loaded as-is over the whole region
+	if ((romp != parent_region + 1) || !ROMENTRY_ISREGIONEND(romp + 1))
+		return false;
+	if (ROM_GETOFFSET(romp) || (ROM_GETLENGTH(romp) != region.bytes()) || ROM_INHERITSFLAGS(romp))
+		return false;
+	if ((ROM_GETGROUPSIZE(romp) != 1) || ROM_GETSKIPCOUNT(romp) || ROM_ISREVERSED(romp) || (ROM_GETBITWIDTH(romp) != 8))
+		return false;
+
+	// inverting or byte swapping would write to every page anyway
+	if (ROMREGION_ISINVERTED(parent_region) || ((region.bytewidth() > 1) && (region.endianness() != ENDIANNESS_NATIVE)))
+		return false;
+
+	// archived files have already been decompressed into memory
+	if (file.is_archived() || (file.size() != region.bytes()))
+		return false;
+
+	if (!region.map_file(file.fullpath()))
+		return false;
+	LOG("Mapped %s over region \"%s\"\n", file.fullpath(), region.name().c_str());
+	return true;
+}
+
+
 /*-------------------------------------------------
     fill_rom_data - fill a region of ROM space
 -------------------------------------------------*/
@@ -1035,8 +1157,10 @@ void rom_load_manager::process_rom_entries(
 		{
 			// handle files
 			bool const irrelevantbios = (ROM_GETBIOSFLAGS(romp) != 0) && (ROM_GETBIOSFLAGS(romp) != bios);
+			rom_entry const *const fileromp = romp;
 			rom_entry const *baserom = romp;
 			int explength = 0;
+			int verifylength = 0;
 
 			// open the file if it is a non-BIOS or matches the current BIOS
 			LOG("Opening ROM file: %s\n", ROM_GETNAME(romp));
@@ -1047,6 +1171,7 @@ void rom_load_manager::process_rom_entries(
 				if (!file)
 					handle_missing_file(romp, tried_file_names, std::error_condition());
 			}
+			bool const mapped = file && map_rom_file(*file, region, parent_region, romp);
 
 			// loop until we run out of reloads
 			do
@@ -1066,18 +1191,15 @@ void rom_load_manager::process_rom_entries(
 					explength += ROM_GETLENGTH(&modified_romp);
 
 					// attempt to read using the modified entry
-					if (!ROMENTRY_ISIGNORE(&modified_romp) && !irrelevantbios)
+					if (!ROMENTRY_ISIGNORE(&modified_romp) && !irrelevantbios && !mapped)
 						/*readresult = */read_rom_data(file.get(), region, parent_region, &modified_romp);
 				}
 				while (ROMENTRY_ISCONTINUE(romp) || ROMENTRY_ISIGNORE(romp));
 
-				// if this was the first use of this file, verify the length and CRC
+				// if this was the first use of this file, remember the length to
+				// verify along with the CRC once it's been read completely
 				if (baserom)
-				{
-					LOG("Verifying length (%X) and checksums\n", explength);
-					verify_length_and_hash(file.get(), baserom->name(), explength, util::hash_collection(baserom->hashdata()));
-					LOG("Verify finished\n");
-				}
+					verifylength = explength;
 
 				// re-seek to the start and clear the baserom so we don't reverify
 				if (file)
@@ -1087,11 +1209,11 @@ void rom_load_manager::process_rom_entries(
 			}
 			while (ROMENTRY_ISRELOAD(romp));
 
-			// close the file
+			// hand the file off to be hashed; it's closed once it's been verified
 			if (file)
 			{
-				LOG("Closing ROM file\n");
-				file.reset();
+				LOG("Queueing ROM file for verification (length %X)\n", verifylength);
+				queue_verify(std::move(file), fileromp->name(), verifylength, util::hash_collection(fileromp->hashdata()));
 			}
 		}
 		else
@@ -1454,6 +1576,11 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 		}
 	}
 
+	// wait for the last files to be verified
+	finish_pending_verifies();
+	if (m_hash_cache)
+		m_hash_cache->save();
+
 	// now go back and post-process all the regions
 	for (const rom_entry *region = start_region; region != nullptr; region = rom_next_region(region))
 		region_post_process(device.memregion(region->name()), ROMREGION_ISINVERTED(region));
@@ -1532,6 +1659,11 @@ void rom_load_manager::process_region_list()
 		}
 	}
 
+	// wait for the last files to be verified
+	finish_pending_verifies();
+	if (m_hash_cache)
+		m_hash_cache->save();
+
 	// now go back and post-process all the regions
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
@@ -1549,6 +1681,79 @@ void rom_load_manager::process_region_list()
 }
 
 
+/*-------------------------------------------------
+    publish_region - write a region's contents to
+    the region cache under a private name, then
+    rename it, so other instances only ever see
+    complete files
+-------------------------------------------------*/
+
+bool rom_load_manager::publish_region(memory_region &region, const std::string &path)
+{
+	std::string const temp = util::string_format("%s.%d.tmp", path, osd_getpid());
+	util::core_file::ptr file;
+	if (util::core_file::open(temp, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file))
+		return false;
+
+	auto const [err, actual] = util::write(*file, region.base(), region.bytes());
+	file.reset();
+	if (err || (actual != region.bytes()) || std::rename(temp.c_str(), path.c_str()))
+	{
+		osd_file::remove(temp);
+		return false;
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    share_regions - swap the memory behind large
+    regions for files in the region cache holding
+    the same contents, publishing any that aren't
+    there yet; called once driver init and device
+    startup have finished changing them
+-------------------------------------------------*/
+
+void rom_load_manager::share_regions()
+{
+	const char *const directory = machine().options().region_cache();
+	if (!*directory)
+		return;
+
+	unsigned shared = 0, published = 0;
+	u64 bytes = 0;
+	for (auto &entry : machine().memory().regions())
+	{
+		memory_region &region = *entry.second;
+		if (!region.mapped())
+			continue;
+
+		// files are named by contents, and compared in full before they're used
+		std::string tag = region.name();
+		tag.erase(0, 1);
+		strreplacechr(tag, ':', '_');
+		u32 const crc = util::crc32_creator::simple(region.base(), region.bytes());
+		std::string const path = util::string_format("%s" PATH_SEPARATOR "%s" PATH_SEPARATOR "%s-%08x-%08x.bin", directory, machine().system().name, tag, region.bytes(), crc);
+
+		if (!osd_stat(path))
+		{
+			if (!publish_region(region, path))
+			{
+				osd_printf_verbose("Couldn't publish region %s to %s\n", region.name(), path);
+				continue;
+			}
+			published++;
+		}
+		if (region.share_file(path))
+		{
+			shared++;
+			bytes += region.bytes();
+		}
+	}
+	osd_printf_verbose("Region cache: %u regions (%u KiB) shared, %u published\n", shared, unsigned(bytes / 1024), published);
+}
+
+
 /*-------------------------------------------------
     rom_init - load the ROMs and open the disk
     images associated with the given machine
@@ -1564,6 +1769,9 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	, m_romsloadedsize(0)
 	, m_romstotalsize(0)
 	, m_chd_list()
+	, m_hash_cache(*machine.options().hash_cache() ? new hash_cache(machine.options().hash_cache()) : nullptr)
+	, m_hash_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI))
+	, m_pending_hash_bytes(0)
 	, m_errorstring()
 	, m_softwarningstring()
 {
@@ -1603,14 +1811,55 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	// count the total number of ROMs
 	count_roms();
 
-	// reset the disk list
+	// reset the disk list, and size the hunk cache of disks opened from here on
 	m_chd_list.clear();
+	chd_file::set_cache_size(std::size_t(machine.options().chd_cache()) << 20);
 
-	// process the ROM entries we were passed
-	process_region_list();
+	// process the ROM entries we were passed; the destructor won't run if
+	// this throws, so don't leave workers hashing files that are about to go
+	try
+	{
+		process_region_list();
+	}
+	catch (...)
+	{
+		if (m_hash_queue)
+		{
+			osd_work_queue_wait(m_hash_queue, osd_ticks_per_second() * 100);
+			osd_work_queue_free(m_hash_queue);
+			m_hash_queue = nullptr;
+		}
+		throw;
+	}
 
 	// display the results and exit
 	display_rom_load_results(false);
+
+	// count hunk cache hits and misses when benchmarking
+	if (bench_log_manager *const bench_log = machine.bench_log())
+	{
+		for (auto &entry : m_chd_list)
+		{
+			chd_file &chd = entry->orig_chd();
+			std::string const region(entry->region());
+			bench_log->add_counter(region + ":chd_cache_hits", [&chd] () -> u64 { return chd.cache_hits(); });
+			bench_log->add_counter(region + ":chd_cache_misses", [&chd] () -> u64 { return chd.cache_misses(); });
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    ~rom_load_manager - destructor
+-------------------------------------------------*/
+
+rom_load_manager::~rom_load_manager()
+{
+	if (m_hash_queue)
+	{
+		osd_work_queue_wait(m_hash_queue, osd_ticks_per_second() * 100);
+		osd_work_queue_free(m_hash_queue);
+	}
 }
 
 
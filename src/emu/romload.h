@@ -402,9 +402,20 @@ class rom_load_manager
 		chd_file    m_diffchd;  // handle to the diff CHD
 	};
 
+	// a ROM file whose hashes are being computed on a worker thread
+	struct pending_hash
+	{
+		std::unique_ptr<emu_file>   file;       // the file, kept open until it's verified
+		std::string                 name;       // name for messages
+		u32                         explength;  // expected length
+		util::hash_collection       expected;   // expected hashes
+		std::string                 cachekey;   // identity in the hash cache
+	};
+
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
+	~rom_load_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -427,6 +438,9 @@ public:
 
 	void load_software_part_region(device_t &device, software_list_device &swlist, std::string_view swname, const rom_entry *start_region);
 
+	/* share regions with other instances through the region cache once the system has started */
+	void share_regions();
+
 	/* get search path for a software item */
 	static std::vector<std::string> get_software_searchpath(software_list_device &swlist, const software_info &swinfo);
 
@@ -443,6 +457,10 @@ private:
 	void handle_missing_file(const rom_entry *romp, const std::vector<std::string> &tried_file_names, std::error_condition chderr);
 	void dump_wrong_and_correct_checksums(const util::hash_collection &hashes, const util::hash_collection &acthashes);
 	void verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes);
+	void queue_verify(std::unique_ptr<emu_file> &&file, std::string_view name, u32 explength, const util::hash_collection &hashes);
+	void finish_pending_verifies();
+	bool publish_region(memory_region &region, const std::string &path);
+	static void *compute_hashes_callback(void *param, int threadid);
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(memory_region *region, bool invert);
@@ -460,6 +478,7 @@ private:
 			std::error_condition &filerr);
 	int rom_fread(emu_file *file, u8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(emu_file *file, memory_region &region, const rom_entry *parent_region, const rom_entry *romp);
+	bool map_rom_file(emu_file &file, memory_region &region, const rom_entry *parent_region, const rom_entry *romp);
 	void fill_rom_data(memory_region &region, const rom_entry *romp);
 	void copy_rom_data(device_t &device, memory_region &region, const rom_entry *romp);
 	void process_rom_entries(
@@ -498,6 +517,11 @@ private:
 
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
 
+	std::unique_ptr<hash_cache> m_hash_cache; // persistent hashes of unchanged files
+	osd_work_queue *    m_hash_queue;         // work queue for ROM hashing
+	std::vector<std::unique_ptr<pending_hash>> m_pending_hashes; // files waiting to be verified, in load order
+	u64                 m_pending_hash_bytes; // total size of the files waiting
+
 	std::string         m_errorstring;        // error string
 	std::string         m_softwarningstring;  // software warning string
 };
@@ -12,10 +12,10 @@
 
     00..07  'MAMESAVE'
     08      Format version (this is format 2)
-    09      Flags
+    09      Flags (byte order and codec)
     0A..1B  Game name padded with \0
     1C..1F  Signature
-    20..end Save game data (compressed)
+    20..end Save game data (compressed with zlib, zstd or stored as-is)
 
     Data is always written as native-endian.
     Data is converted from the endiannness it was written upon load.
@@ -27,9 +27,15 @@
 
 #include "main.h"
 
+#include "../osd/modules/lib/osdlib.h"
+
 #include "util/ioprocs.h"
 #include "util/ioprocsfilter.h"
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -48,14 +54,218 @@
 const int SAVE_VERSION      = 2;
 const int HEADER_SIZE       = 32;
 
+// registered blocks at least this big are worth tracking dirty pages for
+const size_t DIRTY_MIN_SIZE = 0x10000;
+
+// states this big are copied to and from flat buffers on several threads,
+// in chunks of at least COPY_MIN_CHUNK
+const size_t COPY_PARALLEL_SIZE = 0x400000;
+const size_t COPY_MIN_CHUNK = 0x100000;
+const unsigned COPY_MAX_CHUNKS = 8;
+
 // Available flags
 enum
 {
-	SS_MSB_FIRST = 0x02
+	SS_MSB_FIRST    = 0x02,
+
+	// codec for the data following the header; zero is zlib so older files still load
+	SS_CODEC_MASK   = 0x0c,
+	SS_CODEC_ZLIB   = 0x00,
+	SS_CODEC_NONE   = 0x04,
+	SS_CODEC_ZSTD   = 0x08
 };
 
 #define STATE_MAGIC_NUM         "MAMESAVE"
 
+//**************************************************************************
+//  FILE CODECS
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  codec_flags - header flags for the codec
+//  named by the state_codec option
+//-------------------------------------------------
+
+u8 codec_flags(const char *name)
+{
+	if (!strcmp(name, "none"))
+		return SS_CODEC_NONE;
+	else if (!strcmp(name, "zstd"))
+		return SS_CODEC_ZSTD;
+	else
+		return SS_CODEC_ZLIB;
+}
+
+
+//-------------------------------------------------
+//  open_writer - wrap a file positioned after the
+//  header for writing with the given codec
+//-------------------------------------------------
+
+util::write_stream::ptr open_writer(util::core_file &file, u8 flags)
+{
+	switch (flags & SS_CODEC_MASK)
+	{
+	case SS_CODEC_NONE:
+	{
+		util::core_file::ptr proxy;
+		if (util::core_file::open_proxy(file, proxy))
+			return nullptr;
+		return proxy;
+	}
+
+	case SS_CODEC_ZSTD:
+		return util::zstd_write(file, 1, 16384);
+
+	default:
+		return util::zlib_write(file, 6, 16384);
+	}
+}
+
+
+//-------------------------------------------------
+//  open_reader - wrap a file positioned after the
+//  header for reading with the codec the header
+//  names
+//-------------------------------------------------
+
+util::read_stream::ptr open_reader(util::core_file &file, u8 flags)
+{
+	switch (flags & SS_CODEC_MASK)
+	{
+	case SS_CODEC_NONE:
+	{
+		util::core_file::ptr proxy;
+		if (util::core_file::open_proxy(file, proxy))
+			return nullptr;
+		return proxy;
+	}
+
+	case SS_CODEC_ZSTD:
+		return util::zstd_read(file, 16384);
+
+	case SS_CODEC_ZLIB:
+		return util::zlib_read(file, 16384);
+
+	default:
+		return nullptr;
+	}
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  DELTA COMPRESSION
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  delta_put - append a variable length count
+//-------------------------------------------------
+
+inline void delta_put(std::vector<u8> &dest, size_t value)
+{
+	while (value >= 0x80)
+	{
+		dest.push_back(u8(value | 0x80));
+		value >>= 7;
+	}
+	dest.push_back(u8(value));
+}
+
+
+//-------------------------------------------------
+//  delta_get - read a variable length count
+//-------------------------------------------------
+
+inline size_t delta_get(const u8 *&src)
+{
+	size_t value = 0;
+	for (int shift = 0; ; shift += 7)
+	{
+		const u8 byte = *src++;
+		value |= size_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return value;
+	}
+}
+
+
+//-------------------------------------------------
+//  delta_encode - store 'data' as a list of
+//  (matching bytes, differing bytes) pairs, the
+//  differing bytes XORed with 'base'
+//-------------------------------------------------
+
+void delta_encode(const std::vector<char> &data, const std::vector<char> &base, std::vector<u8> &dest)
+{
+	assert(data.size() == base.size());
+	const u8 *const src = reinterpret_cast<const u8 *>(data.data());
+	const u8 *const ref = reinterpret_cast<const u8 *>(base.data());
+	const size_t size = data.size();
+
+	dest.clear();
+	size_t pos = 0;
+	while (pos < size)
+	{
+		// skip over matching bytes, a word at a time where possible
+		const size_t skipstart = pos;
+		for (u64 a, b; pos + 8 <= size; pos += 8)
+		{
+			memcpy(&a, &src[pos], 8);
+			memcpy(&b, &ref[pos], 8);
+			if (a != b)
+				break;
+		}
+		while (pos < size && src[pos] == ref[pos])
+			pos++;
+		if (pos == size)
+			break;
+
+		// differing bytes run until we find eight matching ones in a row
+		const size_t litstart = pos;
+		u32 same = 0;
+		for ( ; pos < size && same < 8; pos++)
+			same = (src[pos] == ref[pos]) ? (same + 1) : 0;
+		if (same == 8)
+			pos -= 8;
+
+		delta_put(dest, litstart - skipstart);
+		delta_put(dest, pos - litstart);
+		for (size_t i = litstart; i < pos; i++)
+			dest.push_back(src[i] ^ ref[i]);
+	}
+	dest.shrink_to_fit();
+}
+
+
+//-------------------------------------------------
+//  delta_decode - apply a delta made by
+//  delta_encode to a copy of its base
+//-------------------------------------------------
+
+void delta_decode(const std::vector<u8> &delta, std::vector<char> &data)
+{
+	const u8 *src = delta.data();
+	const u8 *const end = src + delta.size();
+	size_t pos = 0;
+	while (src < end)
+	{
+		pos += delta_get(src);
+		for (size_t count = delta_get(src); count != 0; count--)
+			data[pos++] ^= char(*src++);
+	}
+}
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  INITIALIZATION
 //**************************************************************************
@@ -67,11 +277,25 @@ enum
 save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_reg_allowed(true)
+	, m_dirty_serial(1)
+	, m_state_size(0)
+	, m_copy_queue(nullptr)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
 
 
+//-------------------------------------------------
+//  ~save_manager - destructor
+//-------------------------------------------------
+
+save_manager::~save_manager()
+{
+	if (m_copy_queue)
+		osd_work_queue_free(m_copy_queue);
+}
+
+
 //-------------------------------------------------
 //  allow_registration - allow/disallow
 //  registrations to happen
@@ -102,7 +326,9 @@ void save_manager::allow_registration(bool allowed)
 
 		dump_registry();
 
-		// everything is registered by now, evaluate the savestate size
+		// everything is registered by now, work out how to copy it and
+		// evaluate the savestate size
+		copy_plan();
 		m_rewind->clamp_capacity();
 	}
 }
@@ -129,6 +355,28 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 }
 
 
+//-------------------------------------------------
+//  registered_bytes - total size of the state
+//  registered by each device, or by each module
+//  for state without a device
+//-------------------------------------------------
+
+std::vector<std::pair<std::string, u64> > save_manager::registered_bytes() const
+{
+	std::vector<std::pair<std::string, u64> > result;
+	std::unordered_map<std::string, size_t> index;
+	for (auto const &entry : m_entry_list)
+	{
+		std::string owner(entry->m_device ? entry->m_device->tag() : entry->m_module);
+		auto const found = index.emplace(owner, result.size());
+		if (found.second)
+			result.emplace_back(std::move(owner), 0);
+		result[found.first->second].second += u64(entry->m_typesize) * entry->m_typecount * entry->m_blockcount;
+	}
+	return result;
+}
+
+
 //-------------------------------------------------
 //  register_presave - register a pre-save
 //  function callback
@@ -197,10 +445,54 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 		totalname = string_format("%s/%X/%s", module, index, name);
 
 	// insert us into the list
+	m_copy_plan.clear();
 	m_entry_list.emplace_back(std::make_unique<state_entry>(val, std::move(totalname), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
 }
 
 
+//-------------------------------------------------
+//  track_dirty - start tracking writes to the
+//  registered block at 'base', returning nullptr
+//  if it isn't one or is too small to bother
+//-------------------------------------------------
+
+save_manager::dirty_block *save_manager::track_dirty(const void *base)
+{
+	// already tracked?
+	for (auto &block : m_dirty_list)
+		if (block->base() == base)
+			return block.get();
+
+	// only contiguous blocks are handled
+	for (auto &entry : m_entry_list)
+	{
+		if (entry->m_data == base && entry->m_blockcount == 1)
+		{
+			const size_t bytes = size_t(entry->m_typesize) * entry->m_typecount;
+			if (bytes < DIRTY_MIN_SIZE)
+				return nullptr;
+
+			// tracked blocks have to be runs of their own
+			m_copy_plan.clear();
+			return m_dirty_list.emplace_back(std::make_unique<dirty_block>(base, bytes, m_dirty_serial)).get();
+		}
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  use_snapshot - note that a registered block is
+//  in copy-on-write memory
+//-------------------------------------------------
+
+void save_manager::use_snapshot(const void *base, osd::snapshot_memory &memory)
+{
+	m_snapshot_list.emplace_back(base, &memory);
+	m_copy_plan.clear();
+}
+
+
 //-------------------------------------------------
 //  check_file - check if a file is a valid save
 //  state
@@ -258,6 +550,7 @@ void save_manager::dispatch_presave()
 
 save_error save_manager::write_file(util::core_file &file)
 {
+	const u8 flags = codec_flags(machine().options().state_codec());
 	util::write_stream::ptr writer;
 	save_error err = do_write(
 			[] (size_t total_size) { return true; },
@@ -275,11 +568,12 @@ save_error save_manager::write_file(util::core_file &file)
 				writer = std::move(proxy);
 				return !filerr && writer;
 			},
-			[&file, &writer] ()
+			[&file, &writer, flags] ()
 			{
-				writer = util::zlib_write(file, 6, 16384);
+				writer = open_writer(file, flags);
 				return bool(writer);
-			});
+			},
+			flags);
 	return (STATERR_NONE != err) ? err : writer->finalize() ? STATERR_WRITE_ERROR : STATERR_NONE;
 }
 
@@ -307,9 +601,9 @@ save_error save_manager::read_file(util::core_file &file)
 				reader = std::move(proxy);
 				return !filerr && reader;
 			},
-			[&file, &reader] ()
+			[&file, &reader] (const u8 *header)
 			{
-				reader = util::zlib_read(file, 16384);
+				reader = open_reader(file, header[9]);
 				return bool(reader);
 			});
 }
@@ -347,7 +641,7 @@ save_error save_manager::read_stream(std::istream &str)
 				return bool(str.read(reinterpret_cast<char *>(data), size));
 			},
 			[] () { return true; },
-			[] () { return true; });
+			[] (const u8 *header) { return true; });
 }
 
 
@@ -356,18 +650,21 @@ save_error save_manager::read_stream(std::istream &str)
 //  to an allocated buffer
 //-------------------------------------------------
 
-save_error save_manager::write_buffer(void *buf, size_t size)
+save_error save_manager::write_buffer(void *buf, size_t size, bool snapshot)
 {
 	return do_write(
 			[size] (size_t total_size) { return size == total_size; },
-			[ptr = reinterpret_cast<u8 *>(buf)] (const void *data, size_t size) mutable
+			[buf] (const void *data, size_t size)
 			{
-				memcpy(ptr, data, size);
-				ptr += size;
+				memcpy(buf, data, size);
 				return true;
 			},
 			[] () { return true; },
-			[] () { return true; });
+			[] () { return true; },
+			0,
+			reinterpret_cast<u8 *>(buf) + HEADER_SIZE,
+			0,
+			snapshot);
 }
 
 
@@ -376,22 +673,95 @@ save_error save_manager::write_buffer(void *buf, size_t size)
 //  buffer
 //-------------------------------------------------
 
-save_error save_manager::read_buffer(const void *buf, size_t size)
+save_error save_manager::read_buffer(const void *buf, size_t size, bool snapshot)
 {
-	const u8 *ptr = reinterpret_cast<const u8 *>(buf);
-	const u8 *const end = ptr + size;
 	return do_read(
 			[size] (size_t total_size) { return size == total_size; },
-			[&ptr, &end] (void *data, size_t size) -> bool
+			[buf] (void *data, size_t size)
 			{
-				if ((ptr + size) > end)
-					return false;
-				memcpy(data, ptr, size);
-				ptr += size;
+				memcpy(data, buf, size);
 				return true;
 			},
 			[] () { return true; },
-			[] () { return true; });
+			[] (const u8 *header) { return true; },
+			reinterpret_cast<const u8 *>(buf) + HEADER_SIZE,
+			snapshot);
+}
+
+
+//-------------------------------------------------
+//  snapshot_file - capture the current machine
+//  state uncompressed, with a header naming the
+//  codec write_snapshot should use
+//-------------------------------------------------
+
+save_error save_manager::snapshot_file(std::vector<u8> &data)
+{
+	copy_plan();
+	data.resize(HEADER_SIZE + m_state_size);
+	return do_write(
+			[&data] (size_t total_size) { return data.size() == total_size; },
+			[&data] (const void *header, size_t size)
+			{
+				memcpy(&data[0], header, size);
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; },
+			codec_flags(machine().options().state_codec()),
+			&data[HEADER_SIZE]);
+}
+
+
+//-------------------------------------------------
+//  write_snapshot - write a state captured by
+//  snapshot_file out to a file; touches nothing
+//  but its arguments, so it can run on another
+//  thread while emulation continues
+//-------------------------------------------------
+
+save_error save_manager::write_snapshot(util::core_file &file, const std::vector<u8> &data)
+{
+	if ((data.size() < HEADER_SIZE) || file.seek(0, SEEK_SET))
+		return STATERR_WRITE_ERROR;
+
+	// the header goes out as-is, the rest through the codec
+	auto const [headerr, headwritten] = write(file, data.data(), HEADER_SIZE);
+	if (headerr)
+		return STATERR_WRITE_ERROR;
+	util::write_stream::ptr const writer = open_writer(file, data[9]);
+	if (!writer)
+		return STATERR_WRITE_ERROR;
+	auto const [filerr, written] = write(*writer, data.data() + HEADER_SIZE, data.size() - HEADER_SIZE);
+	return (filerr || writer->finalize()) ? STATERR_WRITE_ERROR : STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  update_buffer - bring a buffer last written at
+//  'serial' up to date, copying only the pages of
+//  tracked blocks written since; pass a serial of
+//  zero to fill the buffer from scratch
+//-------------------------------------------------
+
+save_error save_manager::update_buffer(void *buf, size_t size, u32 &serial)
+{
+	const save_error err = do_write(
+			[size] (size_t total_size) { return size == total_size; },
+			[buf] (const void *data, size_t size)
+			{
+				memcpy(buf, data, size);
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; },
+			0,
+			reinterpret_cast<u8 *>(buf) + HEADER_SIZE,
+			serial);
+
+	// writes from here on are newer than this copy
+	serial = (err == STATERR_NONE) ? m_dirty_serial++ : 0;
+	return err;
 }
 
 
@@ -400,12 +770,11 @@ save_error save_manager::read_buffer(const void *buf, size_t size)
 //-------------------------------------------------
 
 template <typename T, typename U, typename V, typename W>
-inline save_error save_manager::do_write(T check_space, U write_block, V start_header, W start_data)
+inline save_error save_manager::do_write(T check_space, U write_block, V start_header, W start_data, u8 flags, u8 *flat, u32 since, bool snapshot)
 {
 	// check for sufficient space
-	size_t total_size = HEADER_SIZE;
-	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+	const std::vector<copy_run> &plan = copy_plan();
+	const size_t total_size = HEADER_SIZE + m_state_size;
 	if (!check_space(total_size))
 		return STATERR_WRITE_ERROR;
 
@@ -413,7 +782,7 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	u8 header[HEADER_SIZE];
 	memcpy(&header[0], STATE_MAGIC_NUM, 8);
 	header[8] = SAVE_VERSION;
-	header[9] = NATIVE_ENDIAN_VALUE_LE_BE(0, SS_MSB_FIRST);
+	header[9] = NATIVE_ENDIAN_VALUE_LE_BE(0, SS_MSB_FIRST) | flags;
 	strncpy((char *)&header[0x0a], machine().system().name, 0x1c - 0x0a);
 	u32 sig = signature();
 	*(u32 *)&header[0x1c] = little_endianize_int32(sig);
@@ -425,15 +794,12 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	// call the pre-save functions
 	dispatch_presave();
 
-	// then write all the data
-	for (auto &entry : m_entry_list)
-	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		const u8 *data = reinterpret_cast<const u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
-			if (!write_block(data, blocksize))
-				return STATERR_WRITE_ERROR;
-	}
+	// then write all the data, straight into the buffer if there is one
+	if (flat)
+		return copy_flat(flat, true, since, snapshot) ? STATERR_NONE : STATERR_WRITE_ERROR;
+	for (const copy_run &run : plan)
+		if (!write_block(run.m_data, run.m_size))
+			return STATERR_WRITE_ERROR;
 	return STATERR_NONE;
 }
 
@@ -443,18 +809,17 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 //-------------------------------------------------
 
 template <typename T, typename U, typename V, typename W>
-inline save_error save_manager::do_read(T check_length, U read_block, V start_header, W start_data)
+inline save_error save_manager::do_read(T check_length, U read_block, V start_header, W start_data, const u8 *flat, bool snapshot)
 {
 	// check for sufficient space
-	size_t total_size = HEADER_SIZE;
-	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+	const std::vector<copy_run> &plan = copy_plan();
+	const size_t total_size = HEADER_SIZE + m_state_size;
 	if (!check_length(total_size))
 		return STATERR_READ_ERROR;
 
 	// read the header and turn on compression for the rest of the file
 	u8 header[HEADER_SIZE];
-	if (!start_header() || !read_block(header, sizeof(header)) || !start_data())
+	if (!start_header() || !read_block(header, sizeof(header)) || !start_data(header))
 		return STATERR_READ_ERROR;
 
 	// verify the header and report an error if it doesn't match
@@ -465,17 +830,25 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// determine whether or not to flip the data when done
 	const bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
-	// read all the data, flipping if necessary
-	for (auto &entry : m_entry_list)
+	// loading bypasses the address spaces, so every tracked page changes
+	for (auto &block : m_dirty_list)
+		block->mark_all();
+
+	// read all the data, then flip it if necessary
+	if (flat)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
-			if (!read_block(data, blocksize))
+		if (!copy_flat(const_cast<u8 *>(flat), false, 0, snapshot))
+			return STATERR_READ_ERROR;
+	}
+	else
+	{
+		for (const copy_run &run : plan)
+			if (!read_block(run.m_data, run.m_size))
 				return STATERR_READ_ERROR;
-
-		// handle flipping
-		if (flip)
+	}
+	if (flip)
+	{
+		for (auto &entry : m_entry_list)
 			entry->flip_data();
 	}
 
@@ -486,6 +859,157 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 }
 
 
+//-------------------------------------------------
+//  copy_plan - merge the registered entries into
+//  as few contiguous runs as possible, keeping
+//  state order; members of a class registered one
+//  after another usually end up in a single run
+//-------------------------------------------------
+
+const std::vector<save_manager::copy_run> &save_manager::copy_plan()
+{
+	if (!m_copy_plan.empty() || m_entry_list.empty())
+		return m_copy_plan;
+
+	m_state_size = 0;
+	bool last_separate = false;
+	for (auto &entry : m_entry_list)
+	{
+		// blocks with dirty tracking or in copy-on-write memory must be runs
+		// of their own, so they can be handled differently
+		const dirty_block *tracked = nullptr;
+		for (auto &block : m_dirty_list)
+			if (block->base() == entry->m_data)
+				tracked = block.get();
+		bool snapshot = false;
+		for (auto &block : m_snapshot_list)
+			if (block.first == entry->m_data)
+				snapshot = true;
+		const bool separate = tracked || snapshot;
+
+		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
+		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
+		{
+			if (!blocksize)
+				continue;
+			if (!separate && !last_separate && !m_copy_plan.empty() && ((m_copy_plan.back().m_data + m_copy_plan.back().m_size) == data))
+				m_copy_plan.back().m_size += blocksize;
+			else
+				m_copy_plan.push_back(copy_run{ data, blocksize, m_state_size, tracked, snapshot });
+			m_state_size += blocksize;
+			last_separate = separate;
+		}
+	}
+	return m_copy_plan;
+}
+
+
+//-------------------------------------------------
+//  copy_flat - copy all the state data to or
+//  from a flat buffer, splitting big states
+//  between several threads; with a non-zero
+//  serial, tracked blocks only copy out pages
+//  written since
+//-------------------------------------------------
+
+bool save_manager::copy_flat(u8 *buffer, bool out, u32 since, bool snapshot)
+{
+	// copy-on-write blocks are taken care of without copying
+	if (snapshot)
+	{
+		for (auto &block : m_snapshot_list)
+			if (!(out ? block.second->snapshot() : block.second->restore()))
+				return false;
+	}
+
+	unsigned count = std::min<size_t>(COPY_MAX_CHUNKS, m_state_size / COPY_MIN_CHUNK);
+	if (m_state_size >= COPY_PARALLEL_SIZE)
+		count = std::min(count, std::max(std::thread::hardware_concurrency(), 1U));
+	else
+		count = 1;
+	if ((count > 1) && !m_copy_queue)
+		m_copy_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if ((count <= 1) || !m_copy_queue)
+	{
+		copy_range(buffer, out, snapshot, since, 0, m_state_size);
+		return true;
+	}
+
+	// the calling thread copies the first chunk itself
+	copy_chunk chunks[COPY_MAX_CHUNKS];
+	for (unsigned i = 0; i < count; i++)
+		chunks[i] = copy_chunk{ this, buffer, out, snapshot, since, m_state_size * i / count, m_state_size * (i + 1) / count };
+	osd_work_item_queue_multiple(m_copy_queue, &save_manager::copy_chunk_callback, count - 1, &chunks[1], sizeof(chunks[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	copy_range(buffer, out, snapshot, since, chunks[0].m_begin, chunks[0].m_end);
+	osd_work_queue_wait(m_copy_queue, osd_ticks_per_second() * 100);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  copy_range - copy part of the state data to or
+//  from a flat buffer
+//-------------------------------------------------
+
+void save_manager::copy_range(u8 *buffer, bool out, bool snapshot, u32 since, size_t begin, size_t end) const
+{
+	// find the run holding the start of the range
+	auto run = std::upper_bound(
+			m_copy_plan.begin(),
+			m_copy_plan.end(),
+			begin,
+			[] (size_t offset, const copy_run &r) { return offset < r.m_offset; });
+	if (run != m_copy_plan.begin())
+		--run;
+
+	for ( ; (m_copy_plan.end() != run) && (run->m_offset < end); ++run)
+	{
+		const size_t start = std::max(begin, run->m_offset) - run->m_offset;
+		const size_t stop = std::min(end, run->m_offset + run->m_size) - run->m_offset;
+		u8 *const flat = buffer + run->m_offset;
+		if (snapshot && run->m_snapshot)
+		{
+			// left to copy_flat
+		}
+		else if (!out)
+		{
+			memcpy(run->m_data + start, flat + start, stop - start);
+		}
+		else if (!run->m_dirty || !since)
+		{
+			memcpy(flat + start, run->m_data + start, stop - start);
+		}
+		else
+		{
+			// only the pages written through address spaces since the last copy
+			const size_t pagesize = size_t(1) << dirty_block::PAGE_SHIFT;
+			for (size_t offset = start; offset < stop; )
+			{
+				const size_t page = offset >> dirty_block::PAGE_SHIFT;
+				const size_t next = std::min((page + 1) * pagesize, stop);
+				if (run->m_dirty->dirty(page, since))
+					memcpy(flat + offset, run->m_data + offset, next - offset);
+				offset = next;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  copy_chunk_callback - work item callback for
+//  part of a flat copy
+//-------------------------------------------------
+
+void *save_manager::copy_chunk_callback(void *param, int threadid)
+{
+	const copy_chunk &chunk = *reinterpret_cast<const copy_chunk *>(param);
+	chunk.m_save->copy_range(chunk.m_buffer, chunk.m_out, chunk.m_snapshot, chunk.m_since, chunk.m_begin, chunk.m_end);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  signature - compute the signature, which
 //  is a CRC over the structure of the data
@@ -581,17 +1105,33 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 }
 
 
+//-------------------------------------------------
+//  dirty_block - constructor
+//-------------------------------------------------
+
+save_manager::dirty_block::dirty_block(const void *base, size_t bytes, const u32 &serial)
+	: m_base(base)
+	, m_bytes(bytes)
+	, m_serial(serial)
+	, m_pages((bytes + (1 << PAGE_SHIFT) - 1) >> PAGE_SHIFT, serial)
+{
+}
+
+
 //-------------------------------------------------
 //  ram_state - constructor
 //-------------------------------------------------
 
-ram_state::ram_state(save_manager &save)
+ram_state::ram_state(save_manager &save, bool snapshot)
 	: m_save(save)
 	, m_data()
+	, m_base()
+	, m_delta()
+	, m_packed(false)
+	, m_snapshot(snapshot)
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
-	m_data.reserve(get_size(save));
 	m_data.clear();
 	m_data.rdbuf()->clear();
 	m_data.seekp(0);
@@ -606,12 +1146,8 @@ ram_state::ram_state(save_manager &save)
 
 size_t ram_state::get_size(save_manager &save)
 {
-	size_t totalsize = 0;
-
-	for (auto &entry : save.m_entry_list)
-		totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
-
-	return totalsize + HEADER_SIZE;
+	save.copy_plan();
+	return save.m_state_size + HEADER_SIZE;
 }
 
 
@@ -622,14 +1158,22 @@ size_t ram_state::get_size(save_manager &save)
 
 save_error ram_state::save()
 {
-	// initialize
+	// initialize, going back to raw storage if we were compressed
 	m_valid = false;
-	m_data.seekp(0);
-
-	// get the save manager to write state
-	const save_error err = m_save.write_stream(m_data);
+	if (m_packed)
+	{
+		m_base.reset();
+		m_delta = std::vector<u8>();
+		m_packed = false;
+		m_data.clear();
+	}
+	// get the save manager to write state; a flat buffer lets big states be
+	// copied on several threads
+	std::vector<char> data(get_size(m_save));
+	const save_error err = m_save.write_buffer(data.data(), data.size(), m_snapshot);
 	if (err != STATERR_NONE)
 		return err;
+	m_data.vec(std::move(data));
 
 	// final confirmation
 	m_valid = true;
@@ -646,11 +1190,60 @@ save_error ram_state::save()
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
+	// rebuild the raw data from the keyframe and our delta
+	if (m_packed)
+	{
+		std::vector<char> data(*m_base);
+		delta_decode(m_delta, data);
+		return m_save.read_buffer(data.data(), data.size());
+	}
 
 	// get the save manager to load state
-	return m_save.read_stream(m_data);
+	const std::vector<char> &data = m_data.vec();
+	return m_save.read_buffer(data.data(), data.size(), m_snapshot);
+}
+
+
+//-------------------------------------------------
+//  store_keyframe - keep a copy of 'data' that
+//  later states can be stored against
+//-------------------------------------------------
+
+void ram_state::store_keyframe(const std::vector<char> &data)
+{
+	m_base = std::make_shared<const std::vector<char>>(data);
+	m_delta = std::vector<u8>();
+	m_packed = true;
+	m_data.vec(std::vector<char>());
+	m_valid = true;
+	m_time = m_save.machine().time();
+}
+
+
+//-------------------------------------------------
+//  store_delta - become a delta against 'base',
+//  to be filled in by pack
+//-------------------------------------------------
+
+void ram_state::store_delta(std::shared_ptr<const std::vector<char>> base)
+{
+	m_base = std::move(base);
+	m_delta.clear();
+	m_packed = true;
+	m_data.vec(std::vector<char>());
+	m_valid = true;
+	m_time = m_save.machine().time();
+}
+
+
+//-------------------------------------------------
+//  pack - encode 'data' against our base; safe
+//  to run on a worker thread
+//-------------------------------------------------
+
+void ram_state::pack(const std::vector<char> &data)
+{
+	delta_encode(data, *m_base, m_delta);
 }
 
 
@@ -666,7 +1259,27 @@ rewinder::rewinder(save_manager &save)
 	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_image()
+	, m_image_serial(0)
+	, m_keyframe()
+	, m_since_keyframe(0)
+	, m_delta_size(0)
+	, m_pack_queue(nullptr)
+	, m_pack_item(nullptr)
+	, m_pack_state(nullptr)
+{
+}
+
+
+//-------------------------------------------------
+//  ~rewinder - destructor
+//-------------------------------------------------
+
+rewinder::~rewinder()
 {
+	finish_pack();
+	if (m_pack_queue)
+		osd_work_queue_free(m_pack_queue);
 }
 
 
@@ -735,22 +1348,24 @@ bool rewinder::capture()
 		return false;
 	}
 
+	// the previous state's delta has to be complete before we touch the list
+	finish_pack();
+
+	// bring our copy of the machine state up to date
+	const save_error error = update_image();
+	if (error != STATERR_NONE)
+	{
+		// internal error, complain and evacuate
+		report_error(error, rewind_operation::SAVE);
+		return false;
+	}
+
 	if (current_index_is_last())
 	{
 		// we need to create a new state
 		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
-
-		// validate the state
-		if (error == STATERR_NONE)
-			// it's safe to append
-			m_state_list.push_back(std::move(state));
-		else
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+		compress(*state);
+		m_state_list.push_back(std::move(state));
 	}
 	else
 	{
@@ -758,22 +1373,12 @@ bool rewinder::capture()
 		invalidate();
 
 		// update the existing state
-		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
-
-		// validate the state
-		if (error != STATERR_NONE)
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+		compress(*m_state_list.at(m_current_index));
 	}
 
-	// make sure we will fit in
-	if (!check_size())
-		// the list keeps growing
-		m_current_index++;
+	// make sure we will fit in, then move on to the new state
+	check_size();
+	m_current_index++;
 
 	// update first invalid index
 	if (current_index_is_last())
@@ -813,6 +1418,7 @@ bool rewinder::step()
 		m_current_index = m_first_invalid_index;
 
 	// step back and obtain the state pointer
+	finish_pack();
 	ram_state *state = m_state_list.at(--m_current_index).get();
 
 	// try to load and report the result
@@ -827,64 +1433,161 @@ bool rewinder::step()
 
 
 //-------------------------------------------------
-//  check_size - shrink the state list if it is
-//  about to hit the capacity. returns true if
-//  the list got shrank
+//  check_size - drop the oldest states if the
+//  next capture would hit the capacity
 //-------------------------------------------------
 
-bool rewinder::check_size()
+void rewinder::check_size()
 {
 	if (!m_enabled)
-		return false;
+		return;
 
-	// state sizes in bytes
+	// state sizes in bytes; the next capture is a whole keyframe at worst
 	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	const size_t nextsize = (m_since_keyframe >= KEYFRAME_INTERVAL) ? singlesize : m_delta_size;
+	size_t totalsize = stored_size();
 
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
+	// check if capacity will be hit by the newly captured state
+	if (totalsize + nextsize < capsize)
+		return;
+
+	// check if we have spare states ahead
+	if (!current_index_is_last())
+		// they will be overwritten first
+		return;
+
+	// drop the oldest states until there's room; keyframe data is only
+	// freed with the last state stored against it
+	size_t count = 0;
+	while (totalsize + nextsize >= capsize && count + 1 < m_state_list.size() && m_state_list[count].get() != m_pack_state)
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
+		const ram_state &state = *m_state_list[count];
+		totalsize -= state.stored_size();
+		if (state.base() && state.base() != m_state_list[count + 1]->base())
+			totalsize -= state.base()->size();
+		count++;
+	}
+	m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+	m_current_index -= count;
 
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+	if (count && m_first_time_note)
+	{
+		m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
+		m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
+			totalsize, singlesize, m_state_list.size());
+		m_first_time_note = false;
 	}
+}
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
 
-	// check if capacity will be hit by the newly captured state
-	if (totalsize + singlesize >= capsize)
+//-------------------------------------------------
+//  stored_size - total memory held by the states,
+//  counting shared keyframe data once
+//-------------------------------------------------
+
+size_t rewinder::stored_size() const
+{
+	size_t totalsize = 0;
+	const std::vector<char> *prevbase = nullptr;
+	for (auto &state : m_state_list)
 	{
-		// check if we have spare states ahead
-		if (!current_index_is_last())
-			// no need to move states around
-			return false;
+		// the delta being encoded is assumed to come out like the last one
+		totalsize += (state.get() == m_pack_state) ? m_delta_size : state->stored_size();
 
-		// we can now get the first state and invalidate it
-		std::unique_ptr<ram_state> first(std::move(m_state_list.front()));
-		first->m_valid = false;
+		const std::vector<char> *const base = state->base().get();
+		if (base && base != prevbase)
+			totalsize += base->size();
+		prevbase = base;
+	}
+	return totalsize;
+}
 
-		// move it to the end for future use
-		m_state_list.push_back(std::move(first));
-		m_state_list.erase(m_state_list.begin());
 
-		if (m_first_time_note)
-		{
-			m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
-			m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
-				totalsize, singlesize, m_state_list.size());
-			m_first_time_note = false;
-		}
+//-------------------------------------------------
+//  update_image - refresh the working copy of the
+//  state, copying only dirty pages where tracked
+//-------------------------------------------------
 
-		return true;
+save_error rewinder::update_image()
+{
+	const size_t size = ram_state::get_size(m_save);
+	if (m_image.size() != size)
+	{
+		m_image.resize(size);
+		m_image_serial = 0;
 	}
+	return m_save.update_buffer(m_image.data(), size, m_image_serial);
+}
 
-	return false;
+
+//-------------------------------------------------
+//  compress - store a freshly saved state as a
+//  keyframe or as a delta against the current
+//  one, encoding deltas on a worker thread
+//-------------------------------------------------
+
+void rewinder::compress(ram_state &state)
+{
+	// start a new keyframe periodically, or once deltas stop paying off
+	const size_t size = m_image.size();
+	if (!m_keyframe || m_keyframe->size() != size || m_since_keyframe >= KEYFRAME_INTERVAL || m_delta_size > size / 2)
+	{
+		state.store_keyframe(m_image);
+		m_keyframe = state.base();
+		m_since_keyframe = 0;
+		m_delta_size = 0;
+		return;
+	}
+
+	state.store_delta(m_keyframe);
+	m_since_keyframe++;
+
+	// hand the encoding off so emulation can carry on
+	m_pack_state = &state;
+	if (!m_pack_queue)
+		m_pack_queue = osd_work_queue_alloc(0);
+	if (m_pack_queue)
+		m_pack_item = osd_work_item_queue(m_pack_queue, &rewinder::pack_callback, this, 0);
+	if (!m_pack_item)
+	{
+		state.pack(m_image);
+		finish_pack();
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_pack - wait for the pending delta
+//-------------------------------------------------
+
+void rewinder::finish_pack()
+{
+	if (m_pack_item)
+	{
+		osd_work_item_wait(m_pack_item, osd_ticks_per_second() * 100);
+		osd_work_item_release(m_pack_item);
+		m_pack_item = nullptr;
+	}
+	if (m_pack_state)
+	{
+		m_delta_size = m_pack_state->stored_size();
+		m_pack_state = nullptr;
+	}
+}
+
+
+//-------------------------------------------------
+//  pack_callback - encode a delta on a worker
+//-------------------------------------------------
+
+void *rewinder::pack_callback(void *param, int threadid)
+{
+	rewinder &rewind = *static_cast<rewinder *>(param);
+	rewind.m_pack_state->pack(rewind.m_image);
+	return nullptr;
 }
 
 
@@ -17,6 +17,7 @@
 #ifndef MAME_EMU_SAVE_H
 #define MAME_EMU_SAVE_H
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <memory>
@@ -89,6 +90,7 @@ typedef named_delegate<void ()> save_prepost_delegate;
 
 class ram_state;
 class rewinder;
+namespace osd { class snapshot_memory; }
 
 class save_manager
 {
@@ -145,6 +147,32 @@ class save_manager
 	friend class rewinder;
 
 public:
+	// per-page record of when a large block was last written through an
+	// address space, so in-memory states can skip the pages that weren't
+	class dirty_block
+	{
+	public:
+		static constexpr unsigned PAGE_SHIFT = 12;
+
+		// construction/destruction
+		dirty_block(const void *base, size_t bytes, const u32 &serial);
+
+		// getters
+		const void *base() const { return m_base; }
+		size_t bytes() const { return m_bytes; }
+		bool dirty(size_t page, u32 since) const { return m_pages[page] > since; }
+
+		// marking
+		void mark(size_t offset) { if (offset < m_bytes) m_pages[offset >> PAGE_SHIFT] = m_serial; }
+		void mark_all() { std::fill(m_pages.begin(), m_pages.end(), m_serial); }
+
+	private:
+		const void *        m_base;                 // start of the block
+		size_t              m_bytes;                // size of the block
+		const u32 &         m_serial;               // save manager's current serial
+		std::vector<u32>    m_pages;                // serial of the last write to each page
+	};
+
 	// stuff to allow STRUCT_MEMBER to work with pointers
 	template <typename T> struct pointer_unwrap { using underlying_type = typename array_unwrap<T>::underlying_type; };
 	template <typename T> struct pointer_unwrap<T &> { using underlying_type = typename pointer_unwrap<std::remove_cv_t<T> >::underlying_type; };
@@ -153,17 +181,26 @@ public:
 
 	// construction/destruction
 	save_manager(running_machine &machine);
+	~save_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
 	rewinder *rewind() { return m_rewind.get(); }
 	int registration_count() const { return m_entry_list.size(); }
 	bool registration_allowed() const { return m_reg_allowed; }
+	std::vector<std::pair<std::string, u64> > registered_bytes() const;
 
 	// registration control
 	void allow_registration(bool allowed = true);
 	const char *indexed_item(int index, void *&base, u32 &valsize, u32 &valcount, u32 &blockcount, u32 &stride) const;
 
+	// dirty page tracking
+	dirty_block *track_dirty(const void *base);
+
+	// the registered block at 'base' lives in copy-on-write memory, which
+	// snapshot buffer saves and loads leave to the OSD
+	void use_snapshot(const void *base, osd::snapshot_memory &memory);
+
 	// function registration
 	void register_presave(save_prepost_delegate func);
 	void register_postload(save_prepost_delegate func);
@@ -302,12 +339,17 @@ public:
 	static save_error check_file(running_machine &machine, util::core_file &file, const char *gamename, void (CLIB_DECL *errormsg)(const char *fmt, ...));
 	save_error write_file(util::core_file &file);
 	save_error read_file(util::core_file &file);
+	save_error snapshot_file(std::vector<u8> &data);
+	static save_error write_snapshot(util::core_file &file, const std::vector<u8> &data);
 
 	save_error write_stream(std::ostream &str);
 	save_error read_stream(std::istream &str);
 
-	save_error write_buffer(void *buf, size_t size);
-	save_error read_buffer(const void *buf, size_t size);
+	// with 'snapshot' set, blocks in copy-on-write memory aren't copied but
+	// snapshotted and restored in place, so only one such buffer is useful
+	save_error write_buffer(void *buf, size_t size, bool snapshot = false);
+	save_error read_buffer(const void *buf, size_t size, bool snapshot = false);
+	save_error update_buffer(void *buf, size_t size, u32 &serial);
 
 private:
 	// state callback item
@@ -320,11 +362,37 @@ private:
 		save_prepost_delegate m_func;                 // delegate
 	};
 
+	// a piece of state that's contiguous in memory, copied in one go
+	struct copy_run
+	{
+		u8 *                m_data;             // start of the run
+		size_t              m_size;             // length in bytes
+		size_t              m_offset;           // position in the state data
+		const dirty_block * m_dirty;            // page tracking, if the run is a tracked block
+		bool                m_snapshot;         // held in copy-on-write memory?
+	};
+
+	// part of a flat copy done by a worker thread
+	struct copy_chunk
+	{
+		save_manager *  m_save;
+		u8 *            m_buffer;               // flat state data, after the header
+		bool            m_out;                  // copying out of the machine?
+		bool            m_snapshot;             // skip runs in copy-on-write memory?
+		u32             m_since;                // only copy tracked pages written after this
+		size_t          m_begin;                // range of the state data to copy
+		size_t          m_end;
+	};
+
 	// internal helpers
 	template <typename T, typename U, typename V, typename W>
-	save_error do_write(T check_space, U write_block, V start_header, W start_data);
+	save_error do_write(T check_space, U write_block, V start_header, W start_data, u8 flags = 0, u8 *flat = nullptr, u32 since = 0, bool snapshot = false);
 	template <typename T, typename U, typename V, typename W>
-	save_error do_read(T check_length, U read_block, V start_header, W start_data);
+	save_error do_read(T check_length, U read_block, V start_header, W start_data, const u8 *flat = nullptr, bool snapshot = false);
+	const std::vector<copy_run> &copy_plan();
+	bool copy_flat(u8 *buffer, bool out, u32 since, bool snapshot);
+	void copy_range(u8 *buffer, bool out, bool snapshot, u32 since, size_t begin, size_t end) const;
+	static void *copy_chunk_callback(void *param, int threadid);
 	u32 signature() const;
 	void dump_registry() const;
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
@@ -338,25 +406,45 @@ private:
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
+	std::vector<std::unique_ptr<dirty_block>>    m_dirty_list;       // blocks with dirty page tracking
+	u32                       m_dirty_serial;         // incremented by every update_buffer
+	std::vector<copy_run>     m_copy_plan;            // entries merged into runs, built on first use
+	size_t                    m_state_size;           // total bytes in m_copy_plan
+	osd_work_queue *          m_copy_queue;           // worker queue for big flat copies
+	std::vector<std::pair<const void *, osd::snapshot_memory *>> m_snapshot_list; // blocks in copy-on-write memory
 };
 
 class ram_state
 {
 	save_manager &     m_save;                        // reference to save_manager
 	util::vectorstream m_data;                        // save data buffer
+	std::shared_ptr<const std::vector<char>> m_base;  // keyframe data this state is stored against
+	std::vector<u8>    m_delta;                       // XOR against m_base with matching runs skipped
+	bool               m_packed;                      // is the state held in m_base/m_delta?
+	bool               m_snapshot;                    // leave copy-on-write blocks to the OSD?
 
 public:
 	bool               m_valid;                       // can we load this state?
 	attotime           m_time;                        // machine timestamp
 
-	ram_state(save_manager &save);
+	ram_state(save_manager &save, bool snapshot = false);
 	static size_t get_size(save_manager &save);
 	save_error save();
 	save_error load();
+
+	// compressed storage for the rewinder
+	const std::shared_ptr<const std::vector<char>> &base() const { return m_base; }
+	size_t stored_size() const { return m_packed ? m_delta.size() : m_data.vec().size(); }
+	void store_keyframe(const std::vector<char> &data);
+	void store_delta(std::shared_ptr<const std::vector<char>> base);
+	void pack(const std::vector<char> &data);
 };
 
 class rewinder
 {
+	// a keyframe is forced after this many deltas
+	static constexpr u32 KEYFRAME_INTERVAL = 16;
+
 	save_manager & m_save;                            // reference to save_manager
 	bool           m_enabled;                         // enable rewind savestates
 	size_t         m_capacity;                        // total memory rewind states can occupy (MB, limited to 1-2048 in options)
@@ -365,6 +453,14 @@ class rewinder
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
 	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+	std::vector<char> m_image;                        // working copy of the machine state
+	u32            m_image_serial;                    // dirty serial m_image was last updated at
+	std::shared_ptr<const std::vector<char>> m_keyframe; // data new deltas are encoded against
+	u32            m_since_keyframe;                  // deltas encoded against m_keyframe so far
+	size_t         m_delta_size;                      // size of the last delta, to estimate the next one
+	osd_work_queue *m_pack_queue;                     // worker queue for the delta encoder
+	osd_work_item *m_pack_item;                       // delta being encoded, if any
+	ram_state *    m_pack_state;                      // state the pending delta belongs to
 
 	// load/save management
 	enum class rewind_operation
@@ -379,13 +475,19 @@ class rewinder
 		REWIND_INDEX_FIRST
 	};
 
-	bool check_size();
+	void check_size();
 	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
+	save_error update_image();
+	void compress(ram_state &state);
+	void finish_pack();
+	static void *pack_callback(void *param, int threadid);
 
 public:
 	rewinder(save_manager &save);
+	~rewinder();
 	bool enabled() { return m_enabled; }
+	size_t stored_size() const;
 	void clamp_capacity();
 	void invalidate();
 	bool capture();
@@ -10,6 +10,10 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 
 //**************************************************************************
 //  DEBUGGING
@@ -48,6 +52,8 @@ inline emu_timer::emu_timer() noexcept :
 	m_scheduler(nullptr),
 	m_next(nullptr),
 	m_prev(nullptr),
+	m_heap_index(NOT_QUEUED),
+	m_sequence(0),
 	m_param(0),
 	m_enabled(false),
 	m_temporary(false),
@@ -83,6 +89,7 @@ inline emu_timer &emu_timer::init(
 	m_scheduler = &machine.scheduler();
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heap_index = NOT_QUEUED;
 	m_callback = std::move(callback);
 	m_param = param;
 	m_temporary = temporary;
@@ -97,6 +104,7 @@ inline emu_timer &emu_timer::init(
 		register_save(machine.save());
 
 	// insert into the list
+	device_scheduler::parallel_guard guard(*m_scheduler);
 	m_scheduler->timer_list_insert(*this);
 	if (this == m_scheduler->first_timer())
 		m_scheduler->abort_timeslice();
@@ -118,6 +126,7 @@ bool emu_timer::enable(bool enable) noexcept
 	if (old != enable)
 	{
 		// set the enable flag
+		device_scheduler::parallel_guard guard(*m_scheduler);
 		m_enabled = enable;
 
 		// remove the timer and insert back into the list
@@ -137,6 +146,7 @@ bool emu_timer::enable(bool enable) noexcept
 void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period) noexcept
 {
 	assert(m_scheduler);
+	device_scheduler::parallel_guard guard(*m_scheduler);
 
 	// if this is the callback timer, mark it modified
 	if (m_scheduler->m_callback_timer == this)
@@ -204,16 +214,17 @@ void emu_timer::register_save(save_manager &manager)
 	// determine our instance number - timers are indexed based on the callback function name
 	int index = 0;
 	std::string name = m_callback.name() ? m_callback.name() : "unnamed";
-	for (const emu_timer *curtimer = m_scheduler->first_timer(); curtimer; curtimer = curtimer->m_next)
-	{
-		if (!curtimer->m_temporary)
-		{
-			if (curtimer->m_callback.name() && m_callback.name() && !strcmp(curtimer->m_callback.name(), m_callback.name()))
-				index++;
-			else if (!curtimer->m_callback.name() && !m_callback.name())
-				index++;
-		}
-	}
+	m_scheduler->for_each_active_timer(
+			[this, &index] (const emu_timer &curtimer)
+			{
+				if (!curtimer.m_temporary)
+				{
+					if (curtimer.m_callback.name() && m_callback.name() && !strcmp(curtimer.m_callback.name(), m_callback.name()))
+						index++;
+					else if (!curtimer.m_callback.name() && !m_callback.name())
+						index++;
+				}
+			});
 	for (const emu_timer *curtimer = m_scheduler->m_inactive_timers; curtimer; curtimer = curtimer->m_next)
 	{
 		assert(!curtimer->m_temporary);
@@ -274,6 +285,9 @@ void emu_timer::dump() const
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+thread_local device_execute_interface *device_scheduler::s_parallel_executing = nullptr;
+
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
@@ -282,18 +296,49 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_machine(machine),
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
+	m_execute_end(nullptr),
 	m_basetime(attotime::zero),
 	m_timer_list(nullptr),
 	m_inactive_timers(nullptr),
+	m_timer_heap_enabled(false),
+	m_timer_sequence(0),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_parallel_queue(nullptr),
+	m_parallel_active(false),
+	m_parallel_conflict(false),
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_quantum_boosts(0),
+	m_base_quantum(nullptr),
+	m_adaptive_quantum(false),
+	m_adaptive_min(0),
+	m_adaptive_max(0),
+	m_adaptive_epoch_end(attotime::zero),
+	m_sync_events(0),
+	m_collect_wall_time(*machine.options().exec_stats() != 0)
 {
+	// select the active timer queue implementation
+	const char *const queue = machine.options().timer_queue();
+	if (!strcmp(queue, "heap"))
+	{
+		m_timer_heap_enabled = true;
+		m_timer_heap.reserve(64);
+	}
+	else if (strcmp(queue, "list"))
+	{
+		osd_printf_warning("Unknown timer queue type '%s', using 'list'\n", queue);
+	}
+
 	// append a single never-expiring timer so there is always one in the list
 	// need to subvert it because it would naturally be inserted in the inactive list
 	m_timer_list = &timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	if (m_timer_heap_enabled)
+	{
+		m_timer_list->m_heap_index = 0;
+		m_timer_heap.push_back(m_timer_list);
+	}
 
 	assert(m_timer_list);
 	assert(!m_timer_list->m_prev);
@@ -313,6 +358,10 @@ device_scheduler::device_scheduler(running_machine &machine) :
 
 device_scheduler::~device_scheduler()
 {
+	// release the worker threads
+	if (m_parallel_queue)
+		osd_work_queue_free(m_parallel_queue);
+
 	// remove all timers
 	while (m_inactive_timers)
 		m_timer_allocator.reclaim(timer_list_remove(*m_inactive_timers));
@@ -333,7 +382,8 @@ attotime device_scheduler::time() const noexcept
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	device_execute_interface *const exec = currently_executing();
+	return (exec != nullptr) ? exec->local_time() : m_basetime;
 }
 
 
@@ -345,18 +395,39 @@ attotime device_scheduler::time() const noexcept
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	bool result = true;
+	for_each_active_timer(
+			[&result] (const emu_timer &timer)
+			{
+				if (timer.m_temporary && !timer.expire().is_never())
+					result = false;
+			});
+	if (!result)
 	{
-		if (timer->m_temporary && !timer->expire().is_never())
-		{
-			machine().logerror("Failed save state attempt due to anonymous timers:\n");
-			dump_timers();
-			return false;
-		}
+		machine().logerror("Failed save state attempt due to anonymous timers:\n");
+		dump_timers();
 	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  will_execute - return true if a device is
+//  certain to run again before the current
+//  timeslice ends: the executing device itself,
+//  or one that comes after it
+//-------------------------------------------------
 
-	// otherwise, we're good
-	return true;
+bool device_scheduler::will_execute(const device_execute_interface &exec) const noexcept
+{
+	// only when executing serially, outside of timer callbacks
+	if (m_parallel_active || m_callback_timer || (machine().debug_flags & DEBUG_FLAG_ENABLED))
+		return false;
+
+	for (device_execute_interface const *cur = m_executing_device; cur && (cur != m_execute_end); cur = cur->m_nextexec)
+		if (cur == &exec)
+			return true;
+	return false;
 }
 
 
@@ -367,23 +438,162 @@ bool device_scheduler::can_save() const
 
 inline void device_scheduler::apply_suspend_changes()
 {
-	u32 suspendchanged = 0;
+	bool runnablechanged = false;
 	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
 	{
-		suspendchanged |= exec->m_suspend ^ exec->m_nextsuspend;
+		bool const wasrunnable = exec->m_suspend == 0 || exec->m_eatcycles;
 		exec->m_suspend = exec->m_nextsuspend;
 		exec->m_nextsuspend &= ~SUSPEND_REASON_TIMESLICE;
 		exec->m_eatcycles = exec->m_nexteatcycles;
+		runnablechanged |= wasrunnable != (exec->m_suspend == 0 || exec->m_eatcycles);
 	}
 
-	// recompute the execute list if any CPUs changed their suspension state
-	if (suspendchanged != 0)
+	// recompute the execute list if any CPUs started or stopped running; a
+	// CPU picking up another reason to stay suspended doesn't need it
+	if (runnablechanged)
 		rebuild_execute_list();
 	else
 		m_suspend_changes_pending = false;
 }
 
 
+//-------------------------------------------------
+//  execute_device - execute a single device up
+//  to the target time, pulling the target in if
+//  the device stopped short
+//-------------------------------------------------
+
+template <bool Parallel>
+inline void device_scheduler::execute_device(device_execute_interface &exec, attotime &target, bool call_debugger)
+{
+	// only process if this CPU is executing or truly halted (not yielding)
+	// and if our target is later than the CPU's current time (coarse check)
+	if (EXPECTED((exec.m_suspend == 0 || exec.m_eatcycles) && target.seconds() >= exec.m_localtime.seconds()))
+	{
+		attotime stop = target;
+		for (;;)
+		{
+			// input line changes made by devices that were ahead of this one take effect when it gets there
+			if (UNEXPECTED(exec.m_deferred_inputs))
+			{
+				exec.deliver_deferred_inputs(exec.m_localtime + attotime(0, exec.m_attoseconds_per_cycle));
+				stop = exec.m_deferred_inputs ? std::min(target, exec.m_deferred_input[0].m_time) : target;
+			}
+
+			// compute how many attoseconds to execute this CPU
+			attoseconds_t delta = stop.attoseconds() - exec.m_localtime.attoseconds();
+			if (delta < 0 && stop.seconds() > exec.m_localtime.seconds())
+				delta += ATTOSECONDS_PER_SECOND;
+			assert(delta == (stop - exec.m_localtime).as_attoseconds());
+
+			if (exec.m_attoseconds_per_cycle == 0)
+			{
+				exec.m_localtime = stop;
+			}
+			// if we have enough for at least 1 cycle, do the math
+			else if (delta >= exec.m_attoseconds_per_cycle)
+			{
+				// compute how many cycles we want to execute
+				int ran = exec.m_cycles_running = divu_64x32(u64(delta) >> exec.m_divshift, exec.m_divisor);
+				LOG("  cpu '%s': %d (%d cycles)\n", exec.device().tag(), delta, exec.m_cycles_running);
+
+				// if we're not suspended, actually execute
+				if (exec.m_suspend == 0)
+				{
+					// note that this global variable cycles_stolen can be modified
+					// via the call to cpu_execute
+					exec.m_cycles_stolen = 0;
+					*exec.m_icountptr = exec.m_cycles_running;
+					osd_ticks_t const start = m_collect_wall_time ? osd_ticks() : 0;
+					if (Parallel)
+					{
+						// the profiler is not thread-safe, so only use it when executing serially
+						s_parallel_executing = &exec;
+						exec.run();
+					}
+					else
+					{
+						auto profile = g_profiler.start(exec.m_profiler);
+
+						m_executing_device = &exec;
+						if (!call_debugger)
+							exec.run();
+						else
+						{
+							exec.debugger_start_cpu_hook(target);
+							exec.run();
+							exec.debugger_stop_cpu_hook();
+						}
+					}
+
+					// adjust for any cycles we took back
+					assert(ran >= *exec.m_icountptr);
+					ran -= *exec.m_icountptr;
+					assert(ran >= exec.m_cycles_stolen);
+					ran -= exec.m_cycles_stolen;
+
+					// update statistics
+					if (m_collect_wall_time)
+						exec.m_stats.wall_ticks += osd_ticks() - start;
+					exec.m_stats.timeslices++;
+					exec.m_stats.cycles += ran;
+				}
+
+				// account for these cycles
+				exec.m_totalcycles += ran;
+
+				// update the local time for this CPU
+				attotime deltatime;
+				if (EXPECTED(ran < exec.m_cycles_per_second))
+					deltatime = attotime(0, exec.m_attoseconds_per_cycle * ran);
+				else
+				{
+					u32 remainder;
+					s32 secs = divu_64x32_rem(ran, exec.m_cycles_per_second, remainder);
+					deltatime = attotime(secs, u64(remainder) * exec.m_attoseconds_per_cycle);
+				}
+				assert(deltatime >= attotime::zero);
+				exec.m_localtime += deltatime;
+				LOG("         %d ran, %d total, time = %s\n", ran, s32(exec.m_totalcycles), exec.m_localtime.as_string(PRECISION));
+
+				// if the new local CPU time is less than our target, move the target up, but not before the base
+				// (stopping to take an input line change doesn't count)
+				if (exec.m_localtime < target && !resume_for_deferred_input(exec, target))
+				{
+					target = std::max(exec.m_localtime, m_basetime);
+					LOG("         (new target)\n");
+				}
+			}
+
+			if (!resume_for_deferred_input(exec, target))
+				break;
+		}
+	}
+	else if (UNEXPECTED(exec.m_deferred_inputs))
+	{
+		// it isn't going to get there this time, so don't keep it waiting any longer
+		exec.deliver_deferred_inputs(attotime::never);
+	}
+}
+
+
+//-------------------------------------------------
+//  resume_for_deferred_input - whether a device
+//  stopped to take an input line change and can
+//  carry on towards the target afterwards
+//-------------------------------------------------
+
+inline bool device_scheduler::resume_for_deferred_input(const device_execute_interface &exec, const attotime &target) const noexcept
+{
+	// not if a timer or a suspension change needs the timeslice to end here
+	return UNEXPECTED(exec.m_deferred_inputs)
+			&& (exec.m_localtime < target)
+			&& (m_timer_list->m_expire >= target)
+			&& (exec.m_nextsuspend == exec.m_suspend)
+			&& (exec.m_deferred_input[0].m_time <= (exec.m_localtime + attotime(0, exec.m_attoseconds_per_cycle)));
+}
+
+
 //-------------------------------------------------
 //  timeslice - execute all devices for a single
 //  timeslice
@@ -401,6 +611,13 @@ void device_scheduler::timeslice()
 	while (m_basetime >= m_quantum_list.first()->m_expire)
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
+	// respond to synchronisation pressure
+	if (m_adaptive_quantum)
+		update_adaptive_quantum();
+
+	// anything that forced serial execution has been resolved by the last set of timers
+	m_parallel_conflict = false;
+
 	// loop until we hit the next timer
 	while (m_basetime < m_timer_list->m_expire)
 	{
@@ -418,81 +635,16 @@ void device_scheduler::timeslice()
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		if (!m_parallel_groups.empty() && !call_debugger && !m_parallel_conflict)
 		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
-			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
-
-				if (exec->m_attoseconds_per_cycle == 0)
-				{
-					exec->m_localtime = target;
-				}
-				// if we have enough for at least 1 cycle, do the math
-				else if (delta >= exec->m_attoseconds_per_cycle)
-				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						auto profile = g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							exec->debugger_start_cpu_hook(target);
-							exec->run();
-							exec->debugger_stop_cpu_hook();
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime;
-					if (EXPECTED(ran < exec->m_cycles_per_second))
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
-					else
-					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
-					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
-					}
-				}
-			}
+			// run the execution groups side by side
+			target = execute_parallel(target);
+		}
+		else
+		{
+			// loop over the CPUs that can run; suspended ones are at the end of the list
+			for (device_execute_interface *exec = m_execute_list; exec != m_execute_end; exec = exec->m_nextexec)
+				execute_device<false>(*exec, target, call_debugger);
 		}
 		m_executing_device = nullptr;
 
@@ -505,6 +657,47 @@ void device_scheduler::timeslice()
 }
 
 
+//-------------------------------------------------
+//  execute_parallel - execute each group up to
+//  the target on its own thread, and return the
+//  earliest time any of them stopped at
+//-------------------------------------------------
+
+attotime device_scheduler::execute_parallel(const attotime &target)
+{
+	for (parallel_group &group : m_parallel_groups)
+		group.m_target = target;
+
+	// hand all but the first group to the workers; the first one runs here
+	m_parallel_active = true;
+	osd_work_item_queue_multiple(m_parallel_queue, &device_scheduler::execute_group, m_parallel_groups.size() - 1, &m_parallel_groups[1], sizeof(parallel_group), WORK_ITEM_FLAG_AUTO_RELEASE);
+	execute_group(&m_parallel_groups[0], 0);
+	osd_work_queue_wait(m_parallel_queue, osd_ticks_per_second() * 100);
+	m_parallel_active = false;
+
+	// rendezvous at the earliest time reached by any group
+	attotime result = target;
+	for (parallel_group const &group : m_parallel_groups)
+		result = std::min(result, group.m_target);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  execute_group - execute the devices in a
+//  single group serially
+//-------------------------------------------------
+
+void *device_scheduler::execute_group(void *param, int threadid)
+{
+	parallel_group &group = *reinterpret_cast<parallel_group *>(param);
+	for (device_execute_interface *exec : group.m_devices)
+		group.m_scheduler->execute_device<true>(*exec, group.m_target, false);
+	s_parallel_executing = nullptr;
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  abort_timeslice - abort execution for the
 //  current timeslice
@@ -512,8 +705,12 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice() noexcept
 {
-	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+	device_execute_interface *const exec = currently_executing();
+	if (exec != nullptr)
+	{
+		m_sync_events++;
+		exec->abort_timeslice();
+	}
 }
 
 
@@ -523,6 +720,8 @@ void device_scheduler::abort_timeslice() noexcept
 
 void device_scheduler::trigger(int trigid, const attotime &after)
 {
+	parallel_guard guard(*this);
+
 	// ensure we have a list of executing devices
 	if (m_execute_list == nullptr)
 		rebuild_execute_list();
@@ -549,6 +748,12 @@ void device_scheduler::trigger(int trigid, const attotime &after)
 void device_scheduler::add_quantum(const attotime &quantum, const attotime &duration)
 {
 	assert(quantum.seconds() == 0);
+	parallel_guard guard(*this);
+
+	// keep track of who is asking for more interleave
+	m_quantum_boosts++;
+	if (device_execute_interface *const exec = currently_executing())
+		exec->m_stats.quantum_boosts++;
 
 	attotime curtime = time();
 	attotime expire = curtime + duration;
@@ -570,7 +775,8 @@ void device_scheduler::add_quantum(const attotime &quantum, const attotime &dura
 	}
 
 	// if we found an exact match, just take the maximum expiry time
-	if (insert_after != nullptr && insert_after->m_requested == quantum_attos)
+	// (but don't fold temporary requests into a base quantum that may later be relaxed)
+	if (insert_after != nullptr && insert_after->m_requested == quantum_attos && (!m_adaptive_quantum || insert_after != m_base_quantum))
 		insert_after->m_expire = std::max(insert_after->m_expire, expire);
 
 	// otherwise, allocate a new quantum and insert it after the one we picked
@@ -603,6 +809,7 @@ void device_scheduler::perfect_quantum(const attotime &duration)
 
 emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback)
 {
+	parallel_guard guard(*this);
 	return &m_timer_allocator.alloc()->init(machine(), std::move(callback), attotime::never, 0, false);
 }
 
@@ -615,6 +822,7 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback)
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, s32 param)
 {
+	parallel_guard guard(*this);
 	[[maybe_unused]] emu_timer &timer = m_timer_allocator.alloc()->init(
 			machine(),
 			std::move(callback),
@@ -632,6 +840,9 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 void device_scheduler::synchronize(timer_expired_delegate callback, s32 param)
 {
+	parallel_guard guard(*this);
+	if (currently_executing())
+		m_sync_events++;
 	m_timer_allocator.alloc()->init(
 			machine(),
 			std::move(callback),
@@ -694,7 +905,7 @@ void device_scheduler::postload()
 		timer_list_remove(timer).m_next = private_list;
 		private_list = &timer;
 	}
-	while (m_timer_list->m_next)
+	while (!m_timer_list->m_expire.is_never())
 	{
 		emu_timer &timer = *m_timer_list;
 
@@ -781,10 +992,65 @@ void device_scheduler::compute_perfect_interleave()
 }
 
 
+//-------------------------------------------------
+//  set_base_quantum - change the duration of the
+//  never-expiring quantum, keeping the list of
+//  quanta sorted
+//-------------------------------------------------
+
+void device_scheduler::set_base_quantum(attoseconds_t quantum)
+{
+	m_quantum_list.detach(*m_base_quantum);
+	m_base_quantum->m_requested = quantum;
+	m_base_quantum->m_actual = std::max(quantum, m_quantum_minimum);
+
+	quantum_slot *insert_after = nullptr;
+	for (quantum_slot *quant = m_quantum_list.first(); quant != nullptr; quant = quant->next())
+	{
+		if (quant->m_requested <= quantum)
+			insert_after = quant;
+	}
+	m_quantum_list.insert_after(*m_base_quantum, insert_after);
+}
+
+
+//-------------------------------------------------
+//  update_adaptive_quantum - drop back to the
+//  configured perfect interleave as soon as
+//  devices synchronise, and double the quantum
+//  after every period with no synchronisation
+//-------------------------------------------------
+
+void device_scheduler::update_adaptive_quantum()
+{
+	attoseconds_t const current = m_base_quantum->m_requested;
+	if (m_sync_events != 0)
+	{
+		m_sync_events = 0;
+		if (current > m_adaptive_min)
+		{
+			LOG("adaptive quantum: synchronizing, back to %s\n", attotime(0, m_adaptive_min).as_string(PRECISION));
+			set_base_quantum(m_adaptive_min);
+		}
+		m_adaptive_epoch_end = m_basetime + attotime(0, m_adaptive_max);
+	}
+	else if (m_basetime >= m_adaptive_epoch_end)
+	{
+		if (current < m_adaptive_max)
+		{
+			attoseconds_t const relaxed = (current < (m_adaptive_max / 2)) ? std::max<attoseconds_t>(current * 2, 1) : m_adaptive_max;
+			LOG("adaptive quantum: quiet, relaxing to %s\n", attotime(0, relaxed).as_string(PRECISION));
+			set_base_quantum(relaxed);
+		}
+		m_adaptive_epoch_end = m_basetime + attotime(0, m_adaptive_max);
+	}
+}
+
+
 //-------------------------------------------------
 //  rebuild_execute_list - rebuild the list of
 //  executing CPUs, moving suspended CPUs to the
-//  end
+//  end where the timeslice loop doesn't see them
 //-------------------------------------------------
 
 void device_scheduler::rebuild_execute_list()
@@ -802,6 +1068,24 @@ void device_scheduler::rebuild_execute_list()
 
 		// inform the timer system of our decision
 		add_quantum(min_quantum, attotime::never);
+
+		// if requested, allow the perfect interleave to relax up to the maximum quantum while things are quiet
+		attoseconds_t const max_quantum = machine().config().maximum_quantum(attotime::from_hz(60)).attoseconds();
+		for (quantum_slot &quant : m_quantum_list)
+		{
+			if (quant.m_expire.is_never())
+				m_base_quantum = &quant;
+		}
+		if (m_base_quantum && machine().options().adaptive_quantum() && (m_base_quantum->m_requested < max_quantum))
+		{
+			m_adaptive_quantum = true;
+			m_adaptive_min = m_base_quantum->m_requested;
+			m_adaptive_max = max_quantum;
+			m_adaptive_epoch_end = m_basetime + attotime(0, m_adaptive_max);
+		}
+
+		// this is also the first chance to work out which devices can run in parallel
+		setup_parallel_groups();
 	}
 
 	// start with an empty list
@@ -817,7 +1101,7 @@ void device_scheduler::rebuild_execute_list()
 	{
 		// append to the appropriate list
 		exec.m_nextexec = nullptr;
-		if (exec.m_suspend == 0)
+		if (exec.m_suspend == 0 || exec.m_eatcycles)
 		{
 			*active_tailptr = &exec;
 			active_tailptr = &exec.m_nextexec;
@@ -831,6 +1115,56 @@ void device_scheduler::rebuild_execute_list()
 
 	// append the suspend list to the end of the active list
 	*active_tailptr = suspend_list;
+	m_execute_end = suspend_list;
+
+	// distribute the devices that can run into their execution groups, preserving order
+	if (!m_parallel_groups.empty())
+	{
+		for (parallel_group &group : m_parallel_groups)
+			group.m_devices.clear();
+		for (device_execute_interface *exec = m_execute_list; exec != m_execute_end; exec = exec->m_nextexec)
+		{
+			auto const group = std::find_if(
+					m_parallel_groups.begin(),
+					m_parallel_groups.end(),
+					[id = exec->execution_group()] (parallel_group const &g) { return g.m_id == id; });
+			assert(group != m_parallel_groups.end());
+			group->m_devices.push_back(exec);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  setup_parallel_groups - if enabled, collect
+//  the execution groups declared in the machine
+//  configuration and start worker threads
+//-------------------------------------------------
+
+void device_scheduler::setup_parallel_groups()
+{
+	// parallel execution is opt-in, and the debugger needs everything on one thread
+	if (!machine().options().parallel_exec() || (machine().debug_flags & DEBUG_FLAG_ENABLED))
+		return;
+
+	// group 0 always exists and always executes on the main thread
+	m_parallel_groups.emplace_back(*this, 0);
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	{
+		u32 const id = exec.execution_group();
+		if (std::none_of(m_parallel_groups.begin(), m_parallel_groups.end(), [id] (parallel_group const &g) { return g.m_id == id; }))
+			m_parallel_groups.emplace_back(*this, id);
+	}
+
+	// nothing to do unless there are at least two groups
+	if (m_parallel_groups.size() > 1)
+		m_parallel_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	if (!m_parallel_queue)
+	{
+		m_parallel_groups.clear();
+		return;
+	}
+	osd_printf_verbose("Scheduler: executing %d device groups in parallel\n", int(m_parallel_groups.size()));
 }
 
 
@@ -842,7 +1176,11 @@ void device_scheduler::rebuild_execute_list()
 inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 {
 	// disabled timers never expire
-	if (!timer.m_expire.is_never() && timer.m_enabled)
+	if (!timer.m_expire.is_never() && timer.m_enabled && m_timer_heap_enabled)
+	{
+		timer_heap_insert(timer);
+	}
+	else if (!timer.m_expire.is_never() && timer.m_enabled)
 	{
 		// loop over the timer list
 		emu_timer *prevtimer = nullptr;
@@ -896,6 +1234,13 @@ inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
+	// active timers may be in the heap rather than the list
+	if (timer.m_heap_index != emu_timer::NOT_QUEUED)
+	{
+		timer_heap_remove(timer);
+		return timer;
+	}
+
 	// remove it from the list
 	if (timer.m_prev)
 	{
@@ -918,6 +1263,131 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 }
 
 
+//-------------------------------------------------
+//  timer_heap_before - returns true if the first
+//  timer should fire before the second
+//-------------------------------------------------
+
+inline bool device_scheduler::timer_heap_before(const emu_timer &a, const emu_timer &b) noexcept
+{
+	// timers expiring at the same time fire in the order they were scheduled, as with the list
+	return (a.m_expire < b.m_expire) || ((a.m_expire == b.m_expire) && (a.m_sequence < b.m_sequence));
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move a timer towards the
+//  root until its parent fires before it
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_up(u32 index) noexcept
+{
+	emu_timer *const timer = m_timer_heap[index];
+	while (index > 0)
+	{
+		u32 const parent = (index - 1) >> 1;
+		if (!timer_heap_before(*timer, *m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index]->m_heap_index = index;
+		index = parent;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heap_index = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move a timer towards
+//  the leaves until it fires before its children
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_down(u32 index) noexcept
+{
+	u32 const count = m_timer_heap.size();
+	emu_timer *const timer = m_timer_heap[index];
+	while (true)
+	{
+		u32 child = (index << 1) + 1;
+		if (child >= count)
+			break;
+		if (((child + 1) < count) && timer_heap_before(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+		if (!timer_heap_before(*m_timer_heap[child], *timer))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index]->m_heap_index = index;
+		index = child;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heap_index = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_insert - add an active timer to
+//  the heap
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_insert(emu_timer &timer)
+{
+	timer.m_prev = nullptr;
+	timer.m_next = nullptr;
+	timer.m_sequence = ++m_timer_sequence;
+	m_timer_heap.push_back(&timer);
+	timer_heap_sift_up(m_timer_heap.size() - 1);
+	m_timer_list = m_timer_heap.front();
+}
+
+
+//-------------------------------------------------
+//  timer_heap_remove - remove an active timer
+//  from the heap
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_remove(emu_timer &timer)
+{
+	u32 const index = timer.m_heap_index;
+	assert(m_timer_heap[index] == &timer);
+	timer.m_heap_index = emu_timer::NOT_QUEUED;
+
+	// move the last timer into the hole and restore the heap property
+	emu_timer *const last = m_timer_heap.back();
+	m_timer_heap.pop_back();
+	if (last != &timer)
+	{
+		m_timer_heap[index] = last;
+		last->m_heap_index = index;
+		if ((index > 0) && timer_heap_before(*last, *m_timer_heap[(index - 1) >> 1]))
+			timer_heap_sift_up(index);
+		else
+			timer_heap_sift_down(index);
+	}
+	m_timer_list = m_timer_heap.empty() ? nullptr : m_timer_heap.front();
+}
+
+
+//-------------------------------------------------
+//  for_each_active_timer - call a function for
+//  every active timer, in no particular order
+//-------------------------------------------------
+
+template <typename T>
+inline void device_scheduler::for_each_active_timer(T &&action) const
+{
+	if (m_timer_heap_enabled)
+	{
+		for (emu_timer *timer : m_timer_heap)
+			action(std::as_const(*timer));
+	}
+	else
+	{
+		for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+			action(std::as_const(*timer));
+	}
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers that are due
 //-------------------------------------------------
@@ -982,9 +1452,63 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
-		timer->dump();
+	for_each_active_timer([] (const emu_timer &timer) { timer.dump(); });
 	for (emu_timer *timer = m_inactive_timers; timer; timer = timer->m_next)
 		timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  write_execution_stats - write per-device
+//  execution statistics to a JSON file
+//-------------------------------------------------
+
+void device_scheduler::write_execution_stats(const char *filename) const
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+	writer.StartObject();
+	writer.Key("system");
+	writer.String(machine().system().name);
+	writer.Key("emulated_seconds");
+	writer.Double(m_basetime.as_double());
+	writer.Key("quantum_boosts");
+	writer.Uint64(m_quantum_boosts);
+	writer.Key("wall_time_collected");
+	writer.Bool(m_collect_wall_time);
+
+	writer.Key("devices");
+	writer.StartArray();
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	{
+		device_execute_interface::execute_stats const &stats = exec.stats();
+		writer.StartObject();
+		writer.Key("tag");
+		writer.String(exec.device().tag());
+		writer.Key("cycles");
+		writer.Uint64(stats.cycles);
+		writer.Key("timeslices");
+		writer.Uint64(stats.timeslices);
+		writer.Key("aborted_timeslices");
+		writer.Uint64(stats.aborted);
+		writer.Key("wall_ns");
+		writer.Uint64(u64(double(stats.wall_ticks) * 1.0e9 / double(osd_ticks_per_second())));
+		writer.Key("quantum_boosts");
+		writer.Uint64(stats.quantum_boosts);
+		writer.Key("idle_skips");
+		writer.Uint64(stats.idle_skips);
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file);
+	if (filerr)
+	{
+		osd_printf_error("Error opening execution statistics file %s (%s)\n", filename, filerr.message());
+		return;
+	}
+	file->puts(buffer.GetString());
+}
@@ -17,6 +17,8 @@
 #ifndef MAME_EMU_SCHEDULE_H
 #define MAME_EMU_SCHEDULE_H
 
+#include <mutex>
+
 
 //**************************************************************************
 //  MACROS
@@ -69,6 +71,9 @@ private:
 			s32 param,
 			bool temporary);
 
+	// heap index for timers that aren't in the active heap
+	static constexpr u32 NOT_QUEUED = ~u32(0);
+
 	// internal helpers
 	void register_save(save_manager &manager) ATTR_COLD;
 	void schedule_next_period() noexcept;
@@ -78,6 +83,8 @@ private:
 	device_scheduler *  m_scheduler;    // reference to the owning machine
 	emu_timer *         m_next;         // next timer in order in the list
 	emu_timer *         m_prev;         // previous timer in order in the list
+	u32                 m_heap_index;   // index in the active heap when using the heap queue
+	u64                 m_sequence;     // insertion order, to keep timers with equal expiry in order
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	bool                m_enabled;      // is the timer enabled?
@@ -108,8 +115,10 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
 	emu_timer *first_timer() const noexcept { return m_timer_list; }
-	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
+	device_execute_interface *currently_executing() const noexcept { return EXPECTED(!m_parallel_active) ? m_executing_device : s_parallel_executing; }
+	bool parallel_active() const noexcept { return m_parallel_active; }
 	bool can_save() const;
+	bool will_execute(const device_execute_interface &exec) const noexcept;
 
 	// execution
 	void timeslice();
@@ -127,11 +136,44 @@ public:
 
 	// debugging
 	void dump_timers() const;
+	u64 quantum_boosts() const noexcept { return m_quantum_boosts; }
+	bool collecting_wall_time() const noexcept { return m_collect_wall_time; }
+	void write_execution_stats(const char *filename) const;
 
 	// for emergencies only!
 	void eat_all_cycles();
 
 private:
+	// devices that are executed together on a single thread
+	struct parallel_group
+	{
+		parallel_group(device_scheduler &scheduler, u32 id) : m_scheduler(&scheduler), m_id(id) { }
+
+		device_scheduler *      m_scheduler;                // owning scheduler
+		u32                     m_id;                       // configured execution group
+		attotime                m_target;                   // target time, possibly pulled in by the devices
+		std::vector<device_execute_interface *> m_devices;  // devices to execute, in order
+	};
+
+	// serialises changes to shared scheduler state made while groups are executing in parallel
+	class parallel_guard
+	{
+	public:
+		parallel_guard(device_scheduler &scheduler) : m_lock(nullptr)
+		{
+			if (UNEXPECTED(scheduler.m_parallel_active))
+			{
+				m_lock = &scheduler.m_parallel_lock;
+				m_lock->lock();
+				scheduler.m_parallel_conflict = true;
+			}
+		}
+		~parallel_guard() { if (m_lock) m_lock->unlock(); }
+
+	private:
+		std::recursive_mutex *m_lock;
+	};
+
 	// callbacks
 	void timed_trigger(s32 param);
 	void presave();
@@ -139,24 +181,41 @@ private:
 
 	// scheduling helpers
 	void compute_perfect_interleave();
+	void set_base_quantum(attoseconds_t quantum);
+	void update_adaptive_quantum();
 	void rebuild_execute_list();
 	void apply_suspend_changes();
+	template <bool Parallel> void execute_device(device_execute_interface &exec, attotime &target, bool call_debugger);
+	bool resume_for_deferred_input(const device_execute_interface &exec, const attotime &target) const noexcept;
+	void setup_parallel_groups();
+	attotime execute_parallel(const attotime &target);
+	static void *execute_group(void *param, int threadid);
 
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_heap_insert(emu_timer &timer);
+	void timer_heap_remove(emu_timer &timer);
+	void timer_heap_sift_up(u32 index) noexcept;
+	void timer_heap_sift_down(u32 index) noexcept;
+	static bool timer_heap_before(const emu_timer &a, const emu_timer &b) noexcept;
+	template <typename T> void for_each_active_timer(T &&action) const;
 	void execute_timers();
 
 	// internal state
 	running_machine &           m_machine;                  // reference to our machine
 	device_execute_interface *  m_executing_device;         // pointer to currently executing device
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
+	device_execute_interface *  m_execute_end;              // first device in the list that can't run until resumed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
 	// list of active timers
 	emu_timer *                 m_timer_list;               // head of the active list
 	emu_timer *                 m_inactive_timers;          // head of the inactive timer list
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
+	bool                        m_timer_heap_enabled;       // keep active timers in a heap rather than a sorted list
+	std::vector<emu_timer *>    m_timer_heap;               // binary min-heap of active timers
+	u64                         m_timer_sequence;           // next timer insertion sequence number
 
 	// other internal states
 	emu_timer *                 m_callback_timer;           // pointer to the current callback timer
@@ -164,6 +223,14 @@ private:
 	attotime                    m_callback_timer_expire_time; // the original expiration time
 	bool                        m_suspend_changes_pending;  // suspend/resume changes are pending
 
+	// parallel execution
+	std::vector<parallel_group> m_parallel_groups;          // execution groups (main thread first), empty if not parallel
+	osd_work_queue *            m_parallel_queue;           // work queue for executing groups
+	bool                        m_parallel_active;          // true while groups are executing in parallel
+	bool                        m_parallel_conflict;        // shared state was modified; execute serially until timers fire
+	std::recursive_mutex        m_parallel_lock;            // lock for shared state while executing in parallel
+	static thread_local device_execute_interface *s_parallel_executing; // device executing on this thread
+
 	// scheduling quanta
 	class quantum_slot
 	{
@@ -180,6 +247,18 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+	u64                         m_quantum_boosts;           // total number of add_quantum requests
+
+	// adaptive interleave
+	quantum_slot *              m_base_quantum;             // the never-expiring quantum from the configuration
+	bool                        m_adaptive_quantum;         // adjust the base quantum based on synchronisation pressure
+	attoseconds_t               m_adaptive_min;             // smallest base quantum (the configured perfect quantum)
+	attoseconds_t               m_adaptive_max;             // largest base quantum (the configured maximum quantum)
+	attotime                    m_adaptive_epoch_end;       // time after which a quiet machine gets a longer quantum
+	u32                         m_sync_events;              // synchronisation requests made while executing
+
+	// statistics
+	bool                        m_collect_wall_time;        // measure host time spent executing each device
 };
 
 
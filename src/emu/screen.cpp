@@ -61,12 +61,26 @@ private:
 		paired_entry(int k, int c) { key = k; cache_entry = c; }
 	};
 
+	// a horizontal run of opaque pixels in a cached bitmap
+	struct pixel_span {
+		int offset;   // index of the first pixel in image
+		int x, y;     // position relative to the bitmap
+		int length;
+	};
+
 	struct cached_bitmap {
 		int x, y, sx, sy;
 		std::vector<u32> image;
+		std::vector<pixel_span> spans;
 		std::vector<paired_entry> pairs;
 	};
 
+	// what was last composed into one of the screen's bitmaps
+	struct drawn_bitmap {
+		void const *base = nullptr;
+		std::vector<bool> state;
+	};
+
 	struct bbox {
 		int x0, y0, x1, y1;
 	};
@@ -83,6 +97,9 @@ private:
 	std::vector<u32> m_background;
 
 	std::vector<cached_bitmap> m_cache;
+	std::vector<int> m_to_draw;
+	drawn_bitmap m_drawn[2];
+	int m_drawn_next;
 
 	void output_change(const char *outname, s32 value);
 	void render_state(std::vector<u32> &dest, const std::vector<bool> &state);
@@ -91,6 +108,7 @@ private:
 	void compute_diff_image(const std::vector<u32> &rend, const bbox &bb, cached_bitmap &dest) const;
 	void compute_dual_diff_image(const std::vector<u32> &rend, const bbox &bb, const cached_bitmap &src1, const cached_bitmap &src2, cached_bitmap &dest) const;
 	void rebuild_cache();
+	static void compute_spans(cached_bitmap &dest);
 	void blit(bitmap_rgb32 &bitmap, const cached_bitmap &src) const;
 };
 
@@ -121,6 +139,7 @@ screen_device::svg_renderer::svg_renderer(memory_region *region)
 
 	m_sx = m_sy = 0;
 	m_scale = 1.0;
+	m_drawn_next = 0;
 
 	osd_printf_verbose("Parsed SVG '%s', aspect ratio %f\n", region->name(), (m_image->height == 0.0f) ? 0 : m_image->width / m_image->height);
 }
@@ -169,21 +188,31 @@ void screen_device::svg_renderer::render_state(std::vector<u32> &dest, const std
 	}
 }
 
-void screen_device::svg_renderer::blit(bitmap_rgb32 &bitmap, const cached_bitmap &src) const
+void screen_device::svg_renderer::compute_spans(cached_bitmap &dest)
 {
-	if(src.sy) {
-		const u32 *s = &src.image[0];
-		for(int y=0; y<src.sy; y++) {
-			u32 *d = &bitmap.pix(y + src.y, src.x);
-			for(int x=0; x<src.sx; x++, d++) {
-				const u32 c = *s++;
-				if(c)
-					*d = c;
-			}
+	// transparent pixels are zero, and everything rendered is opaque
+	dest.spans.clear();
+	for(int y = 0; y < dest.sy; y++) {
+		const u32 *const row = &dest.image[y * dest.sx];
+		int x = 0;
+		while(x < dest.sx) {
+			while(x < dest.sx && !row[x])
+				x++;
+			const int start = x;
+			while(x < dest.sx && row[x])
+				x++;
+			if(x != start)
+				dest.spans.push_back(pixel_span{ y * dest.sx + start, start, y, x - start });
 		}
 	}
 }
 
+void screen_device::svg_renderer::blit(bitmap_rgb32 &bitmap, const cached_bitmap &src) const
+{
+	for(const pixel_span &span : src.spans)
+		memcpy(&bitmap.pix(span.y + src.y, span.x + src.x), &src.image[span.offset], span.length * 4);
+}
+
 int screen_device::svg_renderer::render(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	int nsx = bitmap.width();
@@ -197,25 +226,43 @@ int screen_device::svg_renderer::render(screen_device &screen, bitmap_rgb32 &bit
 		m_scale = sx > sy ? sy : sx;
 		m_background.resize(m_sx * m_sy);
 		rebuild_cache();
+		for(drawn_bitmap &drawn : m_drawn)
+			drawn.base = nullptr;
 	}
 
+	// the screen alternates between two bitmaps; one that already shows
+	// this state doesn't need to be composed again
+	void const *const base = bitmap.raw_pixptr(0, 0);
+	drawn_bitmap *drawn = nullptr;
+	for(drawn_bitmap &d : m_drawn)
+		if(d.base == base)
+			drawn = &d;
+	if(drawn && drawn->state == m_key_state)
+		return 0;
+
 	for(unsigned int y = 0; y < m_sy; y++)
 		memcpy(bitmap.raw_pixptr(y, 0), &m_background[y * m_sx], m_sx * 4);
 
-	std::list<int> to_draw;
+	m_to_draw.clear();
 	for(int key = 0; key != m_key_count; key++)
 		if(m_key_state[key])
-			to_draw.push_back(key);
-	while(!to_draw.empty()) {
-		int key = to_draw.front();
-		to_draw.pop_front();
+			m_to_draw.push_back(key);
+	for(size_t next = 0; next != m_to_draw.size(); next++) {
+		const int key = m_to_draw[next];
 		blit(bitmap, m_cache[key]);
 		for(auto p : m_cache[key].pairs) {
 			if(m_key_state[p.key])
-				to_draw.push_back(p.cache_entry);
+				m_to_draw.push_back(p.cache_entry);
 		}
 	}
 
+	if(!drawn) {
+		drawn = &m_drawn[m_drawn_next];
+		m_drawn_next ^= 1;
+		drawn->base = base;
+	}
+	drawn->state = m_key_state;
+
 	return 0;
 }
 
@@ -517,6 +564,10 @@ void screen_device::svg_renderer::rebuild_cache()
 		spos = epos;
 		epos = ckey;
 	}
+
+	// drawing a frame copies runs of pixels rather than testing each one
+	for(cached_bitmap &entry : m_cache)
+		compute_spans(entry);
 }
 
 //**************************************************************************
@@ -541,6 +592,9 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_yscale(1.0f)
 	, m_screen_update_ind16(*this)
 	, m_screen_update_rgb32(*this)
+	, m_screen_update_batched_ind16(*this)
+	, m_screen_update_batched_rgb32(*this)
+	, m_screen_update_batched(false)
 	, m_screen_vblank(*this)
 	, m_scanline_cb(*this)
 	, m_palette(*this, finder_base::DUMMY_TAG)
@@ -554,6 +608,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_texformat()
 	, m_curbitmap(0)
 	, m_curtexture(0)
+	, m_direct_bitmap(nullptr)
+	, m_direct_texformat(TEXFORMAT_RGB32)
 	, m_changed(true)
 	, m_last_partial_reset(attotime::zero)
 	, m_last_partial_scan(0)
@@ -773,6 +829,8 @@ void screen_device::device_resolve_objects()
 	// bind our handlers
 	m_screen_update_ind16.resolve();
 	m_screen_update_rgb32.resolve();
+	m_screen_update_batched_ind16.resolve();
+	m_screen_update_batched_rgb32.resolve();
 
 	// assign our format to the palette before it starts
 	if (m_palette)
@@ -820,12 +878,28 @@ void screen_device::device_start()
 	}
 	register_screen_bitmap(m_priority);
 
+	// find every palette, so deferred changes can be applied before drawing
+	for (device_palette_interface &palette : palette_interface_enumerator(machine().root_device()))
+		m_palettes.push_back(&palette);
+
 	// allocate raw textures
 	m_texture[0] = machine().render().texture_alloc();
 	m_texture[0]->set_id(u64(m_unique_id) << 57);
 	m_texture[1] = machine().render().texture_alloc();
 	m_texture[1]->set_id((u64(m_unique_id) << 57) | 1);
 
+	// the bitmaps are double buffered, so the OSD can reference the one being displayed
+	m_texture[0]->set_persistent(true);
+	m_texture[1]->set_persistent(true);
+
+	// report the rows drawn by each update, except where the scanline bitmaps
+	// are composited into the whole of the texture
+	if (!(m_video_attributes & VIDEO_VARIABLE_WIDTH))
+	{
+		m_texture[0]->set_dirty_tracking(true);
+		m_texture[1]->set_dirty_tracking(true);
+	}
+
 	// configure the default cliparea
 	render_container::user_settings settings = m_container->get_user_settings();
 	settings.m_xoffset = m_xoffset;
@@ -1108,6 +1182,8 @@ void screen_device::realloc_screen_bitmaps()
 	}
 	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
 	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
+	m_texture[0]->mark_dirty(m_visarea);
+	m_texture[1]->mark_dirty(m_visarea);
 
 	allocate_scan_bitmaps();
 }
@@ -1124,6 +1200,23 @@ void screen_device::pre_update_scanline(int y)
 }
 
 
+//-------------------------------------------------
+//  bitmap_bytes - memory held for the bitmaps
+//  the screen is drawn into
+//-------------------------------------------------
+
+size_t screen_device::bitmap_bytes() const
+{
+	size_t result = 0;
+	for (screen_bitmap const &bitmap : m_bitmap)
+	{
+		if (bitmap.valid())
+			result += size_t(bitmap.rowbytes()) * bitmap.height();
+	}
+	return result;
+}
+
+
 //-------------------------------------------------
 //  set_visible_area - just set the visible area
 //-------------------------------------------------
@@ -1190,9 +1283,21 @@ bool screen_device::update_partial(int scanline)
 		return false;
 	}
 
+	// a direct bitmap is the picture already; video RAM may have changed anywhere
+	if (m_direct_bitmap)
+	{
+		m_changed = true;
+		m_last_partial_scan = scanline + 1;
+		m_partial_scan_hpos = 0;
+		return true;
+	}
+
 	// otherwise, render
 	LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.top(), clip.bottom()));
 
+	// drivers may hold on to pen pointers, so apply any deferred palette changes first
+	update_palettes();
+
 	u32 flags = 0;
 	{
 		auto profile = g_profiler.start(PROFILER_VIDEO);
@@ -1238,6 +1343,7 @@ bool screen_device::update_partial(int scanline)
 
 	// if we modified the bitmap, we have to commit
 	m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+	m_texture[m_curbitmap]->mark_dirty(clip);
 
 	// remember where we left off
 	m_last_partial_scan = scanline + 1;
@@ -1297,6 +1403,18 @@ void screen_device::update_now()
 		return;
 	}
 
+	// nothing to draw into a direct bitmap
+	if (m_direct_bitmap)
+	{
+		m_changed = true;
+		m_partial_scan_hpos = current_hpos;
+		m_last_partial_scan = current_vpos;
+		return;
+	}
+
+	// drivers may hold on to pen pointers, so apply any deferred palette changes first
+	update_palettes();
+
 	LOG_PARTIAL_UPDATES(("update_now(): Y=%d, X=%d, last partial %d, partial hpos %d  (vis %d %d)\n", current_vpos, current_hpos, m_last_partial_scan, m_partial_scan_hpos, m_visarea.right(), m_visarea.bottom()));
 
 	// start off by doing a partial update up to the line before us, in case that was necessary
@@ -1342,6 +1460,7 @@ void screen_device::update_now()
 
 				// if we modified the bitmap, we have to commit
 				m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+				m_texture[m_curbitmap]->mark_dirty(clip);
 			}
 
 			m_partial_scan_hpos = 0;
@@ -1396,6 +1515,7 @@ void screen_device::update_now()
 
 			// if we modified the bitmap, we have to commit
 			m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+			m_texture[m_curbitmap]->mark_dirty(clip);
 		}
 	}
 
@@ -1417,6 +1537,72 @@ void screen_device::reset_partial_updates()
 	m_partial_scan_hpos = 0;
 	m_partial_updates_this_frame = 0;
 	m_scanline0_timer->adjust(time_until_pos(0));
+
+	// anything recorded after the last update of the previous frame, or
+	// during a skipped frame, takes effect from the top of this one; only
+	// the last value of each register matters, which keeps the log from
+	// growing while the screen isn't being drawn
+	if (!m_raster_log.empty())
+	{
+		std::stable_sort(m_raster_log.begin(), m_raster_log.end(), [] (screen_raster_event const &a, screen_raster_event const &b) { return a.reg < b.reg; });
+		auto dest = m_raster_log.begin();
+		for (auto src = m_raster_log.begin(); src != m_raster_log.end(); ++src)
+			if ((src + 1) == m_raster_log.end() || (src + 1)->reg != src->reg)
+			{
+				*dest = *src;
+				dest->scanline = m_visarea.top();
+				++dest;
+			}
+		m_raster_log.erase(dest, m_raster_log.end());
+	}
+}
+
+
+//-------------------------------------------------
+//  record_raster_event - record a register change
+//  at the current beam position for a batched
+//  screen update; the change applies from the
+//  next scanline, as if update_partial(vpos())
+//  had been called before it
+//-------------------------------------------------
+
+void screen_device::record_raster_event(u32 reg, u32 data)
+{
+	assert(m_screen_update_batched);
+	m_raster_log.push_back(screen_raster_event{ vpos() + 1, reg, data });
+}
+
+
+//-------------------------------------------------
+//  take_raster_events - move the recorded events
+//  that apply up to the bottom of the given
+//  cliprect into the current batch
+//-------------------------------------------------
+
+void screen_device::take_raster_events(const rectangle &cliprect)
+{
+	// events are recorded in beam order, so the batch is a prefix of the log
+	auto const end = std::find_if(m_raster_log.begin(), m_raster_log.end(), [bottom = cliprect.bottom()] (screen_raster_event const &event) { return event.scanline > bottom; });
+	m_raster_batch.assign(m_raster_log.begin(), end);
+	m_raster_log.erase(m_raster_log.begin(), end);
+}
+
+
+//-------------------------------------------------
+//  batched_update_ind16/rgb32 - adapt a batched
+//  screen update to the regular callbacks
+//-------------------------------------------------
+
+u32 screen_device::batched_update_ind16(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
+{
+	take_raster_events(cliprect);
+	return m_screen_update_batched_ind16(screen, bitmap, cliprect, m_raster_batch);
+}
+
+u32 screen_device::batched_update_rgb32(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	take_raster_events(cliprect);
+	return m_screen_update_batched_rgb32(screen, bitmap, cliprect, m_raster_batch);
 }
 
 
@@ -1427,6 +1613,15 @@ void screen_device::reset_partial_updates()
 
 u32 screen_device::pixel(s32 x, s32 y)
 {
+	if (m_direct_bitmap)
+	{
+		if (!m_direct_bitmap->cliprect().contains(x, y))
+			return 0;
+		if (m_direct_texformat == TEXFORMAT_PALETTE16)
+			return (u32)m_palette->palette()->entry_list_adjusted()[static_cast<bitmap_ind16 *>(m_direct_bitmap)->pix(y, x)];
+		return static_cast<bitmap_rgb32 *>(m_direct_bitmap)->pix(y, x);
+	}
+
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return 0;
@@ -1474,6 +1669,15 @@ u32 screen_device::pixel(s32 x, s32 y)
 
 void screen_device::pixels(u32 *buffer)
 {
+	if (m_direct_bitmap)
+	{
+		const rectangle &visarea = visible_area();
+		for (int y = visarea.min_y; y <= visarea.max_y; y++)
+			for (int x = visarea.min_x; x <= visarea.max_x; x++)
+				*buffer++ = pixel(x, y);
+		return;
+	}
+
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return;
@@ -1648,6 +1852,27 @@ void screen_device::register_screen_bitmap(bitmap_t &bitmap)
 }
 
 
+//-------------------------------------------------
+//  set_direct_bitmap - show a bitmap that wraps
+//  video RAM (with its own row stride) instead
+//  of calling the screen update callback; raster
+//  effects and partial updates have no effect
+//  while it's set
+//-------------------------------------------------
+
+void screen_device::set_direct_bitmap(bitmap_t &bitmap, texture_format texformat)
+{
+	if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
+		throw emu_fatalerror("screen '%s': direct bitmaps can't be used with variable width screens\n", tag());
+	if ((texformat == TEXFORMAT_PALETTE16) && !m_palette)
+		throw emu_fatalerror("screen '%s': direct indexed bitmap needs a palette\n", tag());
+
+	m_direct_bitmap = &bitmap;
+	m_direct_texformat = texformat;
+	m_changed = true;
+}
+
+
 //-------------------------------------------------
 //  vblank_begin - call any external callbacks to
 //  signal the VBLANK period has begun
@@ -1768,11 +1993,26 @@ bool screen_device::update_quads()
 			// if we're not skipping the frame and if the screen actually changed, then update the texture
 			if (!machine().video().skip_this_frame() && m_changed)
 			{
-				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
+				// the renderer reads the palette directly
+				update_palettes();
+				if (m_direct_bitmap)
 				{
-					create_composited_bitmap();
+					// the texture reads video RAM as it is now
+					if ((m_direct_texformat == TEXFORMAT_PALETTE16) && !m_direct_bitmap->palette())
+						m_direct_bitmap->set_palette(m_palette->palette());
+					rectangle bounds(m_visarea);
+					bounds &= m_direct_bitmap->cliprect();
+					m_texture[m_curbitmap]->set_bitmap(*m_direct_bitmap, bounds, m_direct_texformat);
+					m_texture[m_curbitmap]->mark_dirty(bounds);
+				}
+				else
+				{
+					if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
+					{
+						create_composited_bitmap();
+					}
+					m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				}
-				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
 			}
@@ -17,6 +17,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -159,6 +160,24 @@ typedef device_delegate<u32 (screen_device &, bitmap_ind16 &, const rectangle &)
 typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
 
 
+// ======================> screen_raster_event
+
+// a register change recorded with record_raster_event() by a driver that
+// uses a batched screen update; the driver applies these itself while
+// rendering, so the registers it draws from lag the CPU-visible ones
+struct screen_raster_event
+{
+	int     scanline;                               // first scanline drawn with the new value
+	u32     reg;                                    // driver-defined register number
+	u32     data;                                   // new value
+};
+
+using screen_raster_log = std::vector<screen_raster_event>;
+
+typedef device_delegate<u32 (screen_device &, bitmap_ind16 &, const rectangle &, const screen_raster_log &)> screen_update_batched_ind16_delegate;
+typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &, const screen_raster_log &)> screen_update_batched_rgb32_delegate;
+
+
 // ======================> screen_device
 
 class screen_device : public device_t
@@ -190,6 +209,7 @@ public:
 	int height() const { return m_height; }
 	const rectangle &visible_area() const { return m_visarea; }
 	const rectangle &cliprect() const { return m_bitmap[0].cliprect(); }
+	size_t bitmap_bytes() const;
 	bool oldstyle_vblank_supplied() const { return m_oldstyle_vblank_supplied; }
 	attoseconds_t refresh_attoseconds() const { return m_refresh; }
 	attoseconds_t vblank_attoseconds() const { return m_vblank; }
@@ -341,24 +361,69 @@ public:
 	{
 		m_screen_update_ind16.set(std::forward<F>(callback), name);
 		m_screen_update_rgb32 = screen_update_rgb32_delegate(*this);
+		m_screen_update_batched = false;
 	}
 	template <typename F>
 	std::enable_if_t<screen_update_rgb32_delegate::supports_callback<F>::value> set_screen_update(F &&callback, const char *name)
 	{
 		m_screen_update_ind16 = screen_update_ind16_delegate(*this);
 		m_screen_update_rgb32.set(std::forward<F>(callback), name);
+		m_screen_update_batched = false;
 	}
 	template <typename T, typename F>
 	std::enable_if_t<screen_update_ind16_delegate::supports_callback<F>::value> set_screen_update(T &&target, F &&callback, const char *name)
 	{
 		m_screen_update_ind16.set(std::forward<T>(target), std::forward<F>(callback), name);
 		m_screen_update_rgb32 = screen_update_rgb32_delegate(*this);
+		m_screen_update_batched = false;
 	}
 	template <typename T, typename F>
 	std::enable_if_t<screen_update_rgb32_delegate::supports_callback<F>::value> set_screen_update(T &&target, F &&callback, const char *name)
 	{
 		m_screen_update_ind16 = screen_update_ind16_delegate(*this);
 		m_screen_update_rgb32.set(std::forward<T>(target), std::forward<F>(callback), name);
+		m_screen_update_batched = false;
+	}
+
+
+	// batched updates: the callback receives the raster events recorded
+	// up to the bottom of its cliprect, and write handlers call
+	// record_raster_event() instead of update_partial()
+	template <typename F>
+	std::enable_if_t<screen_update_batched_ind16_delegate::supports_callback<F>::value> set_screen_update(F &&callback, const char *name)
+	{
+		m_screen_update_batched_ind16.set(std::forward<F>(callback), name);
+		m_screen_update_batched_rgb32 = screen_update_batched_rgb32_delegate(*this);
+		m_screen_update_ind16 = screen_update_ind16_delegate(*this, FUNC(screen_device::batched_update_ind16));
+		m_screen_update_rgb32 = screen_update_rgb32_delegate(*this);
+		m_screen_update_batched = true;
+	}
+	template <typename F>
+	std::enable_if_t<screen_update_batched_rgb32_delegate::supports_callback<F>::value> set_screen_update(F &&callback, const char *name)
+	{
+		m_screen_update_batched_ind16 = screen_update_batched_ind16_delegate(*this);
+		m_screen_update_batched_rgb32.set(std::forward<F>(callback), name);
+		m_screen_update_ind16 = screen_update_ind16_delegate(*this);
+		m_screen_update_rgb32 = screen_update_rgb32_delegate(*this, FUNC(screen_device::batched_update_rgb32));
+		m_screen_update_batched = true;
+	}
+	template <typename T, typename F>
+	std::enable_if_t<screen_update_batched_ind16_delegate::supports_callback<F>::value> set_screen_update(T &&target, F &&callback, const char *name)
+	{
+		m_screen_update_batched_ind16.set(std::forward<T>(target), std::forward<F>(callback), name);
+		m_screen_update_batched_rgb32 = screen_update_batched_rgb32_delegate(*this);
+		m_screen_update_ind16 = screen_update_ind16_delegate(*this, FUNC(screen_device::batched_update_ind16));
+		m_screen_update_rgb32 = screen_update_rgb32_delegate(*this);
+		m_screen_update_batched = true;
+	}
+	template <typename T, typename F>
+	std::enable_if_t<screen_update_batched_rgb32_delegate::supports_callback<F>::value> set_screen_update(T &&target, F &&callback, const char *name)
+	{
+		m_screen_update_batched_ind16 = screen_update_batched_ind16_delegate(*this);
+		m_screen_update_batched_rgb32.set(std::forward<T>(target), std::forward<F>(callback), name);
+		m_screen_update_ind16 = screen_update_ind16_delegate(*this);
+		m_screen_update_rgb32 = screen_update_rgb32_delegate(*this, FUNC(screen_device::batched_update_rgb32));
+		m_screen_update_batched = true;
 	}
 
 	auto screen_vblank() { return m_screen_vblank.bind(); }
@@ -408,11 +473,17 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	void record_raster_event(u32 reg, u32 data);
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
 	void register_screen_bitmap(bitmap_t &bitmap);
 
+	// display a bitmap that wraps video RAM directly instead of calling the update callback
+	void set_direct_bitmap(bitmap_ind16 &bitmap) { set_direct_bitmap(bitmap, TEXFORMAT_PALETTE16); }
+	void set_direct_bitmap(bitmap_rgb32 &bitmap) { set_direct_bitmap(bitmap, TEXFORMAT_RGB32); }
+	void clear_direct_bitmap() { m_direct_bitmap = nullptr; m_changed = true; }
+
 	// internal to the video system
 	bool update_quads();
 	void update_burnin();
@@ -436,6 +507,7 @@ private:
 	// internal helpers
 	void set_container(render_container &container) { m_container = &container; }
 	void realloc_screen_bitmaps();
+	void set_direct_bitmap(bitmap_t &bitmap, texture_format texformat);
 	TIMER_CALLBACK_MEMBER(vblank_begin);
 	TIMER_CALLBACK_MEMBER(vblank_end);
 	TIMER_CALLBACK_MEMBER(first_scanline_tick);
@@ -445,8 +517,12 @@ private:
 	void update_scan_bitmap_size(int y);
 	void pre_update_scanline(int y);
 	void create_composited_bitmap();
+	void update_palettes() const { for (device_palette_interface *palette : m_palettes) palette->update_pending(); }
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
+	void take_raster_events(const rectangle &cliprect);
+	u32 batched_update_ind16(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
+	u32 batched_update_rgb32(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -459,9 +535,13 @@ private:
 	float               m_xscale, m_yscale;         // default X/Y scale factor
 	screen_update_ind16_delegate m_screen_update_ind16; // screen update callback (16-bit palette)
 	screen_update_rgb32_delegate m_screen_update_rgb32; // screen update callback (32-bit RGB)
+	screen_update_batched_ind16_delegate m_screen_update_batched_ind16; // batched screen update callback (16-bit palette)
+	screen_update_batched_rgb32_delegate m_screen_update_batched_rgb32; // batched screen update callback (32-bit RGB)
+	bool                m_screen_update_batched;    // screen update callback is batched
 	devcb_write_line    m_screen_vblank;            // screen vblank line callback
 	devcb_write32       m_scanline_cb;              // screen scanline callback
 	optional_device<device_palette_interface> m_palette; // our palette
+	std::vector<device_palette_interface *> m_palettes; // every palette in the system, for bringing them up to date before drawing
 	u32                 m_video_attributes;         // flags describing the video system
 	optional_memory_region m_svg_region;            // the region in which the svg data is in
 
@@ -484,10 +564,14 @@ private:
 	bitmap_ind64        m_burnin;                   // burn-in bitmap
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
+	bitmap_t *          m_direct_bitmap;            // bitmap over video RAM shown as is, or nullptr
+	texture_format      m_direct_texformat;         // texture format of the direct bitmap
 	bool                m_changed;                  // has this bitmap changed?
 	attotime            m_last_partial_reset;       // last time partial updates were reset
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
+	screen_raster_log   m_raster_log;               // raster events not yet drawn
+	screen_raster_log   m_raster_batch;             // raster events passed to the current batched update
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
 	u32                 m_unique_id;                // unique id for this screen_device
 	rgb_t               m_color;                    // render color
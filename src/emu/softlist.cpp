@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "softlist.h"
 
+#include "corestr.h"
 #include "hash.h"
 
 #include "expat.h"
@@ -192,7 +193,8 @@ public:
 			std::string &listname,
 			std::string &description,
 			std::list<software_info> &infolist,
-			std::ostream &errors);
+			std::ostream &errors,
+			std::string_view only);
 
 private:
 	enum parse_position
@@ -224,6 +226,8 @@ private:
 	static void start_handler(void *data, const char *tagname, const char **attributes);
 	static void data_handler(void *data, const char *s, int len);
 	static void end_handler(void *data, const char *name);
+	static void skip_start_handler(void *data, const char *tagname, const char **attributes);
+	static void skip_end_handler(void *data, const char *name);
 
 	// internal parsing
 	void parse_root_start(const char *tagname, const char **attributes);
@@ -247,6 +251,8 @@ private:
 	software_info *             m_current_info;
 	software_part *             m_current_part;
 	parse_position              m_pos;
+	std::string_view const      m_only;         // only item to keep, or empty for all
+	int                         m_skip_depth;   // depth of tags within an item being skipped
 };
 
 
@@ -260,7 +266,8 @@ softlist_parser::softlist_parser(
 		std::string &listname,
 		std::string &description,
 		std::list<software_info> &infolist,
-		std::ostream &errors) :
+		std::ostream &errors,
+		std::string_view only) :
 	m_filename(filename),
 	m_infolist(infolist),
 	m_errors(errors),
@@ -270,7 +277,9 @@ softlist_parser::softlist_parser(
 	m_ignore_cdata(false),
 	m_current_info(nullptr),
 	m_current_part(nullptr),
-	m_pos(POS_ROOT)
+	m_pos(POS_ROOT),
+	m_only(only),
+	m_skip_depth(0)
 {
 	// create the parser
 	m_parser = XML_ParserCreate_MM(nullptr, nullptr, nullptr);
@@ -291,7 +300,9 @@ softlist_parser::softlist_parser(
 			done = true;
 		if (XML_Parse(m_parser, buffer, length, done) == XML_STATUS_ERROR)
 		{
-			parse_error("%s", parser_error());
+			// stopping once the only item wanted is complete isn't an error
+			if (XML_GetErrorCode(m_parser) != XML_ERROR_ABORTED)
+				parse_error("%s", parser_error());
 			break;
 		}
 	}
@@ -469,6 +480,8 @@ void softlist_parser::end_handler(void *data, const char *name)
 
 		case POS_MAIN:
 			state->parse_main_end(name);
+			if (!state->m_only.empty() && state->m_current_info)
+				XML_StopParser(state->m_parser, XML_FALSE);
 			state->m_current_info = nullptr;
 			break;
 
@@ -491,6 +504,36 @@ void softlist_parser::end_handler(void *data, const char *name)
 }
 
 
+//-------------------------------------------------
+//  skip_start_handler - expat handler for tag
+//  start within an item that isn't wanted
+//-------------------------------------------------
+
+void softlist_parser::skip_start_handler(void *data, const char *tagname, const char **attributes)
+{
+	softlist_parser *state = reinterpret_cast<softlist_parser *>(data);
+	state->m_skip_depth++;
+}
+
+
+//-------------------------------------------------
+//  skip_end_handler - expat handler for tag end
+//  within an item that isn't wanted, going back
+//  to parsing at the end of the item
+//-------------------------------------------------
+
+void softlist_parser::skip_end_handler(void *data, const char *name)
+{
+	softlist_parser *state = reinterpret_cast<softlist_parser *>(data);
+	if (--state->m_skip_depth)
+		return;
+
+	XML_SetElementHandler(state->m_parser, &softlist_parser::start_handler, &softlist_parser::end_handler);
+	XML_SetCharacterDataHandler(state->m_parser, &softlist_parser::data_handler);
+	end_handler(data, name);
+}
+
+
 //-------------------------------------------------
 //  data_handler - expat data handler
 //-------------------------------------------------
@@ -557,7 +600,14 @@ void softlist_parser::parse_main_start(const char *tagname, const char **attribu
 		static char const *const attrnames[] = { "name", "cloneof", "supported" };
 		auto attrvalues = parse_attributes(attributes, attrnames);
 
-		if (!attrvalues[0].empty())
+		if (!m_only.empty() && !util::streqlower(m_only, attrvalues[0]))
+		{
+			// not the item we're after, so skip everything inside it
+			m_skip_depth = 1;
+			XML_SetElementHandler(m_parser, &softlist_parser::skip_start_handler, &softlist_parser::skip_end_handler);
+			XML_SetCharacterDataHandler(m_parser, nullptr);
+		}
+		else if (!attrvalues[0].empty())
 		{
 			m_infolist.emplace_back(std::string(attrvalues[0]), std::string(attrvalues[1]), attrvalues[2]);
 			m_current_info = &m_infolist.back();
@@ -913,9 +963,10 @@ void parse_software_list(
 		std::string &listname,
 		std::string &description,
 		std::list<software_info> &infolist,
-		std::ostream &errors)
+		std::ostream &errors,
+		std::string_view only)
 {
-	detail::softlist_parser(file, filename, listname, description, infolist, errors);
+	detail::softlist_parser(file, filename, listname, description, infolist, errors, only);
 }
 
 
@@ -159,14 +159,15 @@ private:
 
 // ----- Helpers -----
 
-// parses a software list
+// parses a software list, or just the item with the given name
 void parse_software_list(
 		util::read_stream &file,
 		std::string_view filename,
 		std::string &listname,
 		std::string &description,
 		std::list<software_info> &infolist,
-		std::ostream &errors);
+		std::ostream &errors,
+		std::string_view only = std::string_view());
 
 // parses a software identifier (e.g. - 'apple2e:agentusa:flop1') into its constituent parts (returns false if cannot parse)
 bool software_name_parse(std::string_view identifier, std::string *list_name = nullptr, std::string *software_name = nullptr, std::string *part_name = nullptr);
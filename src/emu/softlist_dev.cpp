@@ -183,6 +183,7 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_partial.clear();
 }
 
 
@@ -258,6 +259,16 @@ const software_info *software_list_device::find(std::string_view look_for)
 
 	const bool iswild = look_for.find_first_of("*?") != std::string::npos;
 
+	// until the whole list is needed, a single item can be parsed on its own
+	if (!m_parsed && !iswild)
+	{
+		auto const found = std::find_if(
+				m_partial.begin(),
+				m_partial.end(),
+				[&look_for] (const software_info &info) { return util::streqlower(look_for, info.shortname()); });
+		return (m_partial.end() != found) ? &*found : parse_one(look_for);
+	}
+
 	// find a match (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
 	auto iter = std::find_if(
@@ -298,6 +309,22 @@ void software_list_device::parse()
 		parse_software_list(file, m_filename, m_shortname, m_description, m_infolist, errs);
 		file.close();
 		m_errors = errs.str();
+
+		// swap in items already parsed on their own, so pointers to them stay valid
+		for (auto it = m_partial.begin(); m_partial.end() != it; )
+		{
+			auto const next = std::next(it);
+			auto const full = std::find_if(
+					m_infolist.begin(),
+					m_infolist.end(),
+					[&it] (const software_info &info) { return info.shortname() == it->shortname(); });
+			if (m_infolist.end() != full)
+			{
+				m_infolist.splice(full, m_partial, it);
+				m_infolist.erase(full);
+			}
+			it = next;
+		}
 	}
 	else if (std::errc::no_such_file_or_directory == filerr)
 	{
@@ -313,6 +340,31 @@ void software_list_device::parse()
 }
 
 
+//-------------------------------------------------
+//  parse_one - parse a single item from our
+//  softlist file, skipping over the others
+//-------------------------------------------------
+
+const software_info *software_list_device::parse_one(std::string_view name)
+{
+	emu_file file(mconfig().options().hash_path(), OPEN_FLAG_READ);
+	if (file.open(m_list_name + ".xml"))
+		return nullptr;
+
+	// errors are reported when the whole list is parsed
+	std::string listname, description;
+	std::list<software_info> found;
+	std::ostringstream errs;
+	parse_software_list(file, file.filename(), listname, description, found, errs, name);
+	file.close();
+	if (found.empty())
+		return nullptr;
+
+	m_partial.splice(m_partial.end(), found, found.begin());
+	return &m_partial.back();
+}
+
+
 //-------------------------------------------------
 //  is_compatible - determine if we are compatible
 //  with the given software_list_device
@@ -140,6 +140,7 @@ protected:
 private:
 	// internal helpers
 	void parse();
+	const software_info *parse_one(std::string_view name);
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
 
 	// configuration state
@@ -154,6 +155,7 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+	std::list<software_info>    m_partial;      // items parsed on their own before the whole list
 };
 
 
@@ -10,9 +10,11 @@
 
 #include "emu.h"
 
+#include "benchlog.h"
 #include "config.h"
 #include "emuopts.h"
 #include "main.h"
+#include "soundfir.h"
 #include "speaker.h"
 
 #include "wavwrite.h"
@@ -20,6 +22,9 @@
 
 #include "osdepend.h"
 
+#include <optional>
+#include <unordered_map>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -38,6 +43,7 @@
 //**************************************************************************
 
 const attotime sound_manager::STREAMS_UPDATE_ATTOTIME = attotime::from_hz(STREAMS_UPDATE_FREQUENCY);
+thread_local bool sound_manager::s_group_thread = false;
 
 
 //**************************************************************************
@@ -619,6 +625,12 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_callback_ex = std::move(callback);
 }
 
+sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output_base, u32 sample_rate, stream_update_span_delegate callback, sound_stream_flags flags) :
+	sound_stream(device, inputs, outputs, output_base, sample_rate, flags)
+{
+	m_callback_span = std::move(callback);
+}
+
 
 //-------------------------------------------------
 //  ~sound_stream - destructor
@@ -629,6 +641,22 @@ sound_stream::~sound_stream()
 }
 
 
+//-------------------------------------------------
+//  buffer_bytes - memory held for sample buffers,
+//  including those of our resamplers
+//-------------------------------------------------
+
+size_t sound_stream::buffer_bytes() const
+{
+	size_t result = 0;
+	for (sound_stream_output const &output : m_output)
+		result += output.m_buffer.m_buffer.capacity() * sizeof(stream_buffer::sample_t);
+	for (auto const &resampler : m_resampler_list)
+		result += resampler->buffer_bytes();
+	return result;
+}
+
+
 //-------------------------------------------------
 //  set_sample_rate - set the sample rate on a
 //  given stream
@@ -704,7 +732,10 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 	if (start > end)
 		start = end;
 
-	auto profile = g_profiler.start(PROFILER_SOUND);
+	// the profiler is not thread-safe, so leave it alone while updating a stream group
+	std::optional<decltype(g_profiler.start(PROFILER_SOUND))> profile;
+	if (!sound_manager::s_group_thread)
+		profile.emplace(g_profiler.start(PROFILER_SOUND));
 
 	// reposition our start to coincide with the current buffer end
 	attotime update_start = m_output[outputnum].end_time();
@@ -738,8 +769,11 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 				m_output_view[outindex].fill(NAN);
 #endif
 
-			// if we have an extended callback, that's all we need
-			m_callback_ex(*this, m_input_view, m_output_view);
+			// span-based callbacks see the same view arrays as extended ones
+			if (!m_callback_span.isnull())
+				m_callback_span(*this, stream_view_span<read_stream_view const>(m_input_view.data(), m_input_view.size()), stream_view_span<write_stream_view>(m_output_view.data(), m_output_view.size()));
+			else
+				m_callback_ex(*this, m_input_view, m_output_view);
 
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
@@ -930,13 +964,29 @@ read_stream_view sound_stream::empty_view(attotime start, attotime end)
 //-------------------------------------------------
 
 default_resampler_stream::default_resampler_stream(device_t &device) :
-	sound_stream(device, 1, 1, 0, SAMPLE_RATE_OUTPUT_ADAPTIVE, stream_update_delegate(&default_resampler_stream::resampler_sound_update, this), STREAM_DISABLE_INPUT_RESAMPLING),
+	sound_stream(device, 1, 1, 0, SAMPLE_RATE_OUTPUT_ADAPTIVE, stream_update_span_delegate(&default_resampler_stream::resampler_sound_update, this), STREAM_DISABLE_INPUT_RESAMPLING),
 	m_max_latency(0)
 {
 	// create a name
 	m_name = "Default Resampler '";
 	m_name += device.tag();
 	m_name += "'";
+
+	// select the resampling filter
+	const char *const resampler = device.machine().options().resampler();
+	if (!strcmp(resampler, "polyphase"))
+		m_filter = std::make_unique<sound_fir_filter>();
+	else if (strcmp(resampler, "simple"))
+		osd_printf_warning("Unknown resampler type '%s', using 'simple'\n", resampler);
+}
+
+
+//-------------------------------------------------
+//  ~default_resampler_stream - destructor
+//-------------------------------------------------
+
+default_resampler_stream::~default_resampler_stream()
+{
 }
 
 
@@ -946,7 +996,7 @@ default_resampler_stream::default_resampler_stream(device_t &device) :
 //  target sample rate of the output
 //-------------------------------------------------
 
-void default_resampler_stream::resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
+void default_resampler_stream::resampler_sound_update(sound_stream &stream, stream_view_span<read_stream_view const> inputs, stream_view_span<write_stream_view> outputs)
 {
 	sound_assert(inputs.size() == 1);
 	sound_assert(outputs.size() == 1);
@@ -964,6 +1014,13 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	// optimize_resampler ensures we should not have equal sample rates
 	sound_assert(input.sample_rate() != output.sample_rate());
 
+	// hand off to the polyphase filter if selected
+	if (m_filter)
+	{
+		polyphase_update(input, output);
+		return;
+	}
+
 	// compute the stepping value and the inverse
 	stream_buffer::sample_t step = stream_buffer::sample_t(input.sample_rate()) / stream_buffer::sample_t(output.sample_rate());
 	stream_buffer::sample_t stepinv = 1.0 / step;
@@ -1056,6 +1113,66 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 }
 
 
+//-------------------------------------------------
+//  polyphase_update - resample through a
+//  windowed-sinc polyphase filter, band-limiting
+//  the input to below the lower Nyquist frequency
+//-------------------------------------------------
+
+void default_resampler_stream::polyphase_update(read_stream_view const &input, write_stream_view &output)
+{
+	// rebuild the filter if the ratio changed
+	double const step = double(input.sample_rate()) / double(output.sample_rate());
+	m_filter->configure(step);
+
+	// the filter needs lookahead() input samples past each output position,
+	// and lookbehind() samples before it
+	s64 latency_samples = m_filter->lookahead() + 1;
+	if (latency_samples <= m_max_latency)
+		latency_samples = m_max_latency;
+	else
+		m_max_latency = latency_samples;
+	attotime const latency = latency_samples * input.sample_period();
+	attotime const lead = (m_filter->lookbehind() + 1) * input.sample_period();
+
+	// clamp the latency to the start (only relevant at the beginning)
+	s32 dstindex = 0;
+	attotime output_start = output.start_time();
+	auto numsamples = output.samples();
+	while (latency + lead > output_start && dstindex < numsamples)
+	{
+		output.put(dstindex++, 0);
+		output_start += output.sample_period();
+	}
+	if (dstindex >= numsamples)
+		return;
+
+	// create a rebased input buffer starting early enough for the first output's taps
+	read_stream_view rebased(input, output_start - latency - lead);
+	sound_assert(rebased.start_time() + latency + lead <= output_start);
+
+	// compute the fractional input position of the first output sample
+	attotime const delta = output_start - (rebased.start_time() + latency);
+	sound_assert(delta.seconds() == 0);
+	double const srcpos = double(delta.attoseconds()) / double(rebased.sample_period_attoseconds());
+	sound_assert(srcpos >= m_filter->lookbehind());
+
+	// copy the input samples we need into a contiguous buffer
+	u32 const needed = u32(srcpos + double(numsamples - dstindex - 1) * step) + m_filter->lookahead() + 1;
+	sound_assert(needed <= rebased.samples());
+	if (m_history.size() < needed)
+		m_history.resize(needed);
+	u32 const available = std::min(needed, rebased.samples());
+	for (u32 index = 0; index < available; index++)
+		m_history[index] = rebased.get(index);
+	std::fill(m_history.begin() + available, m_history.begin() + needed, 0.0f);
+
+	// filter each output position
+	for (s32 index = 0; dstindex < numsamples; dstindex++, index++)
+		output.put(dstindex, m_filter->filter(&m_history[0], srcpos + double(index) * step));
+}
+
+
 
 //**************************************************************************
 //  SOUND MANAGER
@@ -1083,7 +1200,14 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_attenuation(0),
 	m_unique_id(0),
 	m_wavfile(),
-	m_first_reset(true)
+	m_osd_buffer_fill(0),
+	m_osd_buffer_target(0),
+	m_suppress_output(false),
+	m_suppressed_leftover(0),
+	m_suppressed_scale(1.0),
+	m_suppressed_counter(0),
+	m_first_reset(true),
+	m_stream_queue(nullptr)
 {
 	// count the mixers
 #if VERBOSE
@@ -1110,6 +1234,10 @@ sound_manager::sound_manager(running_machine &machine) :
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
 	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+
+	// independent streams can be updated on worker threads
+	if (machine.options().parallel_sound())
+		m_stream_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 }
 
 
@@ -1119,6 +1247,8 @@ sound_manager::sound_manager(running_machine &machine) :
 
 sound_manager::~sound_manager()
 {
+	if (m_stream_queue)
+		osd_work_queue_free(m_stream_queue);
 }
 
 
@@ -1140,6 +1270,24 @@ sound_stream *sound_manager::stream_alloc(device_t &device, u32 inputs, u32 outp
 }
 
 
+//-------------------------------------------------
+//  stream_alloc - allocate a new stream with a
+//  span-based callback and flags
+//-------------------------------------------------
+
+sound_stream *sound_manager::stream_alloc(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_span_delegate callback, sound_stream_flags flags)
+{
+	// determine output base
+	u32 output_base = 0;
+	for (auto &stream : m_stream_list)
+		if (&stream->device() == &device)
+			output_base += stream->output_count();
+
+	m_stream_list.push_back(std::make_unique<sound_stream>(device, inputs, outputs, output_base, sample_rate, std::move(callback), flags));
+	return m_stream_list.back().get();
+}
+
+
 //-------------------------------------------------
 //  start_recording - begin audio recording
 //-------------------------------------------------
@@ -1240,6 +1388,34 @@ void sound_manager::mute(bool mute, u8 reason)
 }
 
 
+//-------------------------------------------------
+//  suppress_output - stop or resume passing the
+//  mix on; the mixer's own running state is put
+//  back on resuming, as the suppressed span is
+//  expected to be rolled back
+//-------------------------------------------------
+
+void sound_manager::suppress_output(bool suppress)
+{
+	if (suppress == m_suppress_output)
+		return;
+	m_suppress_output = suppress;
+
+	if (suppress)
+	{
+		m_suppressed_leftover = m_finalmix_leftover;
+		m_suppressed_scale = m_compressor_scale;
+		m_suppressed_counter = m_compressor_counter;
+	}
+	else
+	{
+		m_finalmix_leftover = m_suppressed_leftover;
+		m_compressor_scale = m_suppressed_scale;
+		m_compressor_counter = m_suppressed_counter;
+	}
+}
+
+
 //-------------------------------------------------
 //  recursive_remove_stream_from_orphan_list -
 //  remove the given stream from the orphan list
@@ -1258,6 +1434,84 @@ void sound_manager::recursive_remove_stream_from_orphan_list(sound_stream *which
 }
 
 
+//-------------------------------------------------
+//  build_stream_groups - partition the streams
+//  into groups that can be updated concurrently;
+//  streams connected to each other share buffers
+//  and resamplers, and streams of one device
+//  share its state, so each of those sets stays
+//  together, while the speakers that join
+//  everything up are mixed serially afterwards
+//-------------------------------------------------
+
+void sound_manager::build_stream_groups()
+{
+	auto const is_speaker = [] (sound_stream const &stream) { return dynamic_cast<speaker_device *>(&stream.device()) != nullptr; };
+
+	// union-find over the stream list
+	std::unordered_map<sound_stream *, size_t> index;
+	std::vector<size_t> parent(m_stream_list.size());
+	for (size_t i = 0; i < m_stream_list.size(); i++)
+	{
+		index.emplace(m_stream_list[i].get(), i);
+		parent[i] = i;
+	}
+	auto const find = [&parent] (size_t i) { while (parent[i] != i) i = parent[i] = parent[parent[i]]; return i; };
+
+	std::unordered_map<device_t *, size_t> device_stream;
+	for (size_t i = 0; i < m_stream_list.size(); i++)
+	{
+		sound_stream &stream = *m_stream_list[i];
+		if (is_speaker(stream))
+			continue;
+
+		auto const [owner, inserted] = device_stream.emplace(&stream.device(), i);
+		if (!inserted)
+			parent[find(i)] = find(owner->second);
+
+		for (int inputnum = 0; inputnum < stream.input_count(); inputnum++)
+		{
+			sound_stream_input &input = stream.input(inputnum);
+			auto const source = input.valid() ? index.find(&input.source().stream()) : index.end();
+			if (source != index.end() && !is_speaker(*m_stream_list[source->second]))
+				parent[find(i)] = find(source->second);
+		}
+	}
+
+	// collect the groups in stream order
+	std::unordered_map<size_t, size_t> group_index;
+	for (size_t i = 0; i < m_stream_list.size(); i++)
+	{
+		if (is_speaker(*m_stream_list[i]))
+			continue;
+		auto const [group, inserted] = group_index.emplace(find(i), m_stream_groups.size());
+		if (inserted)
+			m_stream_groups.push_back(stream_group{ this, { } });
+		m_stream_groups[group->second].streams.push_back(m_stream_list[i].get());
+	}
+	LOG("%d sound streams in %d independent groups\n", int(m_stream_list.size()), int(m_stream_groups.size()));
+}
+
+
+//-------------------------------------------------
+//  update_stream_group - bring every stream of a
+//  group up to the end of the current update
+//-------------------------------------------------
+
+void *sound_manager::update_stream_group(void *param, int threadid)
+{
+	stream_group const &group = *reinterpret_cast<stream_group const *>(param);
+	attotime const end = group.manager->m_group_end_time;
+
+	s_group_thread = true;
+	for (sound_stream *stream : group.streams)
+		if (stream->output_count() != 0 && stream->sample_time() < end)
+			stream->update_view(stream->sample_time(), end);
+	s_group_thread = false;
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  apply_sample_rate_changes - recursively
 //  update sample rates throughout the system
@@ -1314,6 +1568,10 @@ void sound_manager::reset()
 			m_speakers.emplace_back(speaker);
 		}
 
+		// the graph is complete now, so it can be split up
+		if (m_stream_queue)
+			build_stream_groups();
+
 #if (SOUND_DEBUG)
 		// dump the sound graph when we start up
 		for (speaker_device &speaker : speaker_device_enumerator(machine().root_device()))
@@ -1513,6 +1771,7 @@ void sound_manager::update(s32 param)
 	LOG("sound_update\n");
 
 	auto profile = g_profiler.start(PROFILER_SOUND);
+	bench_log_manager::scope timing(machine().bench_log(), bench_log_manager::PART_SOUND);
 
 	// determine the duration of this update
 	attotime update_period = machine().time() - m_last_update;
@@ -1529,10 +1788,52 @@ void sound_manager::update(s32 param)
 	std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
 	std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
 
-	// force all the speaker streams to generate the proper number of samples
+	// bring independent groups of streams up to date in parallel, leaving only the
+	// speakers' own streams and resamplers to run here
+	if (m_stream_groups.size() > 1)
+	{
+		m_group_end_time = endtime;
+		osd_work_item_queue_multiple(m_stream_queue, &sound_manager::update_stream_group, m_stream_groups.size() - 1, &m_stream_groups[1], sizeof(m_stream_groups[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		update_stream_group(&m_stream_groups[0], 0);
+		osd_work_queue_wait(m_stream_queue, osd_ticks_per_second() * 100);
+	}
+
+	// force all the speaker streams to generate the proper number of samples; in
+	// turbo mode they still run, since sound chips' state can depend on it, but
+	// aren't mixed
+	bool const turbo = machine().video().turbo();
 	for (speaker_device &speaker : m_speakers)
-		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
+		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM) || turbo);
+
+	// nothing is heard in turbo mode, so there's no final mix to make
+	if (!turbo)
+		final_mix();
+
+	// update any orphaned streams so they don't get too far behind
+	for (auto &stream : m_orphan_stream_list)
+		stream.first->update();
+
+	// remember the update time
+	m_last_update = endtime;
+	m_update_number++;
+
+	// apply sample rate changes
+	apply_sample_rate_changes();
+
+	// notify that new samples have been generated
+	if (!m_suppress_output && !turbo)
+		emulator_info::sound_hook();
+}
+
+
+//-------------------------------------------------
+//  final_mix - apply the compressor to the
+//  speakers' mix and send it on to the OSD,
+//  recordings and sound hook
+//-------------------------------------------------
 
+void sound_manager::final_mix()
+{
 	// determine the maximum in this section
 	stream_buffer::sample_t curmax = 0;
 	for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
@@ -1625,27 +1926,17 @@ void sound_manager::update(s32 param)
 	m_finalmix_leftover = sample - m_samples_this_update * 1000;
 
 	// play the result
-	if (finalmix_offset > 0)
+	if (finalmix_offset > 0 && !m_suppress_output)
 	{
 		if (!m_nosound_mode)
+		{
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
+			if (!machine().osd().sound_buffer_status(m_osd_buffer_fill, m_osd_buffer_target))
+				m_osd_buffer_fill = m_osd_buffer_target = 0;
+		}
 		machine().osd().add_audio_to_recording(finalmix, finalmix_offset / 2);
 		machine().video().add_sound_to_recording(finalmix, finalmix_offset / 2);
 		if (m_wavfile)
 			util::wav_add_data_16(*m_wavfile, finalmix, finalmix_offset);
 	}
-
-	// update any orphaned streams so they don't get too far behind
-	for (auto &stream : m_orphan_stream_list)
-		stream.first->update();
-
-	// remember the update time
-	m_last_update = endtime;
-	m_update_number++;
-
-	// apply sample rate changes
-	apply_sample_rate_changes();
-
-	// notify that new samples have been generated
-	emulator_info::sound_hook();
 }
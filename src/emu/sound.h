@@ -50,6 +50,11 @@
     By default, the inputs will have been resampled to match the output
     sample rate, unless otherwise specified.
 
+    Streams can instead be given a stream_update_span_delegate, whose
+    callbacks receive stream_view_span wrappers around the same arrays.
+    These are just a pointer and a count, so they can be passed by value
+    and indexed without going through the std::vector interface.
+
 ***************************************************************************/
 
 #pragma once
@@ -582,6 +587,33 @@ private:
 using stream_update_delegate = delegate<void (sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)>;
 
 
+// ======================> stream_view_span
+
+// non-owning view of a stream's array of input or output views
+template <typename T>
+class stream_view_span
+{
+public:
+	stream_view_span(T *data, std::size_t size) : m_data(data), m_size(size) { }
+
+	std::size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+	T &operator[](std::size_t index) const { sound_assert(index < m_size); return m_data[index]; }
+	T *begin() const { return m_data; }
+	T *end() const { return m_data + m_size; }
+
+private:
+	T *         m_data;                      // first view
+	std::size_t m_size;                      // number of views
+};
+
+
+// ======================> stream_update_span_delegate
+
+// span-based callback
+using stream_update_span_delegate = delegate<void (sound_stream &stream, stream_view_span<read_stream_view const> inputs, stream_view_span<write_stream_view> outputs)>;
+
+
 // ======================> sound_stream_flags
 
 enum sound_stream_flags : u32
@@ -612,6 +644,7 @@ class sound_stream
 public:
 	// construction/destruction
 	sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output_base, u32 sample_rate, stream_update_delegate callback, sound_stream_flags flags = STREAM_DEFAULT_FLAGS);
+	sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output_base, u32 sample_rate, stream_update_span_delegate callback, sound_stream_flags flags = STREAM_DEFAULT_FLAGS);
 	virtual ~sound_stream();
 
 	// simple getters
@@ -627,6 +660,7 @@ public:
 	u32 input_count() const { return m_input.size(); }
 	u32 output_count() const { return m_output.size(); }
 	u32 output_base() const { return m_output_base; }
+	size_t buffer_bytes() const;
 	sound_stream_input &input(int index) { sound_assert(index >= 0 && index < m_input.size()); return m_input[index]; }
 	sound_stream_output &output(int index) { sound_assert(index >= 0 && index < m_output.size()); return m_output[index]; }
 
@@ -711,23 +745,32 @@ private:
 
 	// callback information
 	stream_update_delegate m_callback_ex;          // extended callback function
+	stream_update_span_delegate m_callback_span;   // span-based callback function, used instead if set
 };
 
 
 // ======================> default_resampler_stream
 
+class sound_fir_filter;
+
 class default_resampler_stream : public sound_stream
 {
 public:
 	// construction/destruction
 	default_resampler_stream(device_t &device);
+	~default_resampler_stream();
 
 	// update handler
-	void resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs);
+	void resampler_sound_update(sound_stream &stream, stream_view_span<read_stream_view const> inputs, stream_view_span<write_stream_view> outputs);
 
 private:
+	// polyphase update helper
+	void polyphase_update(read_stream_view const &input, write_stream_view &output);
+
 	// internal state
 	u32 m_max_latency;
+	std::unique_ptr<sound_fir_filter> m_filter;    // polyphase filter, or nullptr for the simple resampler
+	std::vector<float> m_history;                  // contiguous copy of the input for the filter
 };
 
 
@@ -754,6 +797,13 @@ class sound_manager
 	// stream updates
 	static const attotime STREAMS_UPDATE_ATTOTIME;
 
+	// a set of streams that share buffers or device state, updated together on one thread
+	struct stream_group
+	{
+		sound_manager *manager;
+		std::vector<sound_stream *> streams;
+	};
+
 public:
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
@@ -770,9 +820,15 @@ public:
 	int unique_id() { return m_unique_id++; }
 	stream_buffer::sample_t compressor_scale() const { return m_compressor_scale; }
 
+	// OSD output buffer fill and target in frames as of the last update, if the module reports them
+	bool osd_buffer_status(int &fill, int &target) const { fill = m_osd_buffer_fill; target = m_osd_buffer_target; return m_osd_buffer_target > 0; }
+
 	// allocate a new stream with a new-style callback
 	sound_stream *stream_alloc(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_delegate callback, sound_stream_flags flags);
 
+	// allocate a new stream with a span-based callback
+	sound_stream *stream_alloc(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_span_delegate callback, sound_stream_flags flags);
+
 	// WAV recording
 	bool is_recording() const { return bool(m_wavfile); }
 	bool start_recording();
@@ -791,6 +847,10 @@ public:
 	void debugger_mute(bool turn_off) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off) { mute(turn_off, MUTE_REASON_SYSTEM); }
 
+	// keep mixing but drop the output, e.g. for frames that will be rolled back
+	bool output_suppressed() const { return m_suppress_output; }
+	void suppress_output(bool suppress);
+
 	// return information about the given mixer input, by index
 	bool indexed_mixer_input(int index, mixer_input &info) const;
 
@@ -804,6 +864,12 @@ private:
 	// helper to remove items from the orphan list
 	void recursive_remove_stream_from_orphan_list(sound_stream *stream);
 
+	// split the streams feeding the speakers into independent groups
+	void build_stream_groups();
+
+	// work item callback bringing a stream group up to the end of the update
+	static void *update_stream_group(void *param, int threadid);
+
 	// apply pending sample rate changes
 	void apply_sample_rate_changes();
 
@@ -823,6 +889,7 @@ private:
 
 	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
 	void update(s32 param = 0);
+	void final_mix();
 
 	// internal state
 	running_machine &m_machine;           // reference to the running machine
@@ -846,11 +913,23 @@ private:
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
 	util::wav_file_ptr m_wavfile;         // WAV file for streaming
+	int m_osd_buffer_fill;                // OSD output buffer fill after the last update, in frames
+	int m_osd_buffer_target;              // OSD output buffer target, or 0 if not reported
+	bool m_suppress_output;               // mix without playing or recording
+	u32 m_suppressed_leftover;            // final mix leftover when output was suppressed
+	stream_buffer::sample_t m_suppressed_scale; // compressor scale when output was suppressed
+	int m_suppressed_counter;             // compressor counter when output was suppressed
 
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
 	std::map<sound_stream *, u8> m_orphan_stream_list; // list of orphaned streams
 	bool m_first_reset;                   // is this our first reset?
+
+	// parallel stream updates
+	osd_work_queue *m_stream_queue;       // work queue for stream groups, if enabled
+	std::vector<stream_group> m_stream_groups; // independent groups of streams
+	attotime m_group_end_time;            // time the groups are being brought up to
+	static thread_local bool s_group_thread; // set while this thread updates a stream group
 };
 
 
@@ -0,0 +1,182 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/*********************************************************************
+
+    soundfir.h
+
+    Polyphase windowed-sinc FIR filter used by the default resampler
+    when -resampler polyphase is selected.  The inner product is
+    vectorized with SSE2 or NEON where available.
+
+*********************************************************************/
+
+#ifndef MAME_EMU_SOUNDFIR_H
+#define MAME_EMU_SOUNDFIR_H
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_SOUNDFIR_SSE2 1
+#include <emmintrin.h>
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__)
+#define MAME_SOUNDFIR_NEON 1
+#include <arm_neon.h>
+#endif
+
+
+/***************************************************************************
+    INNER PRODUCT
+***************************************************************************/
+
+/*-------------------------------------------------
+    sound_fir_dot - return the sum of the products
+    of 'count' coefficients and samples; 'count'
+    must be a multiple of 4
+-------------------------------------------------*/
+
+inline float sound_fir_dot(const float *coeffs, const float *samples, uint32_t count)
+{
+#if defined(MAME_SOUNDFIR_SSE2)
+	__m128 sum0 = _mm_setzero_ps();
+	__m128 sum1 = _mm_setzero_ps();
+	for ( ; count >= 8; count -= 8, coeffs += 8, samples += 8)
+	{
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(coeffs), _mm_loadu_ps(samples)));
+		sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(coeffs + 4), _mm_loadu_ps(samples + 4)));
+	}
+	if (count != 0)
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(coeffs), _mm_loadu_ps(samples)));
+	sum0 = _mm_add_ps(sum0, sum1);
+	sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+	sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, 1));
+	return _mm_cvtss_f32(sum0);
+#elif defined(MAME_SOUNDFIR_NEON)
+	float32x4_t sum0 = vdupq_n_f32(0.0f);
+	float32x4_t sum1 = vdupq_n_f32(0.0f);
+	for ( ; count >= 8; count -= 8, coeffs += 8, samples += 8)
+	{
+		sum0 = vfmaq_f32(sum0, vld1q_f32(coeffs), vld1q_f32(samples));
+		sum1 = vfmaq_f32(sum1, vld1q_f32(coeffs + 4), vld1q_f32(samples + 4));
+	}
+	if (count != 0)
+		sum0 = vfmaq_f32(sum0, vld1q_f32(coeffs), vld1q_f32(samples));
+	return vaddvq_f32(vaddq_f32(sum0, sum1));
+#else
+	float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	for ( ; count != 0; count -= 4, coeffs += 4, samples += 4)
+		for (int lane = 0; lane < 4; lane++)
+			sum[lane] += coeffs[lane] * samples[lane];
+	return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+#endif
+}
+
+
+
+/***************************************************************************
+    POLYPHASE FILTER
+***************************************************************************/
+
+// ======================> sound_fir_filter
+
+class sound_fir_filter
+{
+public:
+	// number of fractional positions between two input samples
+	static constexpr uint32_t PHASES = 64;
+
+	// zero crossings of the sinc on each side of the centre, at the output rate when decimating
+	static constexpr uint32_t ZERO_CROSSINGS = 8;
+
+	// passband edge as a fraction of the lower of the two Nyquist frequencies
+	static constexpr double ROLLOFF = 0.9;
+
+	// Kaiser window shape, roughly 60dB of stopband attenuation
+	static constexpr double KAISER_BETA = 6.0;
+
+	sound_fir_filter() : m_step(0.0), m_half(0), m_stride(0) { }
+
+	// input samples before and after the integer sample position the filter reads,
+	// including the padding taps and rounding up to the next sample's phase 0
+	uint32_t lookbehind() const { return m_half - 1; }
+	uint32_t lookahead() const { return m_stride - m_half + 1; }
+
+	// build the phase table for 'step' input samples per output sample
+	void configure(double step)
+	{
+		if (step == m_step)
+			return;
+		m_step = step;
+
+		// widen the filter in proportion when decimating so the cutoff tracks the output rate
+		double const scale = std::min(1.0, 1.0 / step);
+		double const cutoff = 0.5 * scale * ROLLOFF;
+		m_half = uint32_t(std::ceil(double(ZERO_CROSSINGS) / scale));
+		m_stride = (2 * m_half + 3) & ~3;
+		m_table.assign(PHASES * m_stride, 0.0f);
+
+		double const norm = 1.0 / bessel_i0(KAISER_BETA);
+		for (uint32_t phase = 0; phase < PHASES; phase++)
+		{
+			float *const row = &m_table[phase * m_stride];
+			double const frac = double(phase) / double(PHASES);
+			double sum = 0.0;
+			for (uint32_t tap = 0; tap < 2 * m_half; tap++)
+			{
+				// distance from the interpolated position to this tap, in input samples
+				double const x = double(tap) - double(m_half - 1) - frac;
+				double const w = x / double(m_half);
+				double const window = (std::abs(w) < 1.0) ? (bessel_i0(KAISER_BETA * std::sqrt(1.0 - w * w)) * norm) : 0.0;
+				double const arg = M_PI * 2.0 * cutoff * x;
+				double const sinc = (x == 0.0) ? 1.0 : (std::sin(arg) / arg);
+				double const value = 2.0 * cutoff * sinc * window;
+				row[tap] = float(value);
+				sum += value;
+			}
+
+			// normalize each phase to unity gain at DC
+			for (uint32_t tap = 0; tap < 2 * m_half; tap++)
+				row[tap] = float(row[tap] / sum);
+		}
+	}
+
+	// filter 'samples' at fractional position 'pos'; samples from
+	// floor(pos) - lookbehind() through floor(pos) + lookahead() must be valid
+	float filter(const float *samples, double pos) const
+	{
+		double const ipart = std::floor(pos);
+		int32_t index = int32_t(ipart);
+		uint32_t phase = uint32_t((pos - ipart) * double(PHASES) + 0.5);
+		if (phase >= PHASES)
+		{
+			phase -= PHASES;
+			index++;
+		}
+		return sound_fir_dot(&m_table[phase * m_stride], samples + index - lookbehind(), m_stride);
+	}
+
+private:
+	// modified Bessel function of the first kind, order 0
+	static double bessel_i0(double x)
+	{
+		double sum = 1.0, term = 1.0;
+		double const quarter = x * x * 0.25;
+		for (int k = 1; k < 32 && term > sum * 1e-12; k++)
+		{
+			term *= quarter / (double(k) * double(k));
+			sum += term;
+		}
+		return sum;
+	}
+
+	double              m_step;         // input samples per output sample
+	uint32_t            m_half;         // taps on each side of the centre
+	uint32_t            m_stride;       // taps per phase, padded to a multiple of 4
+	std::vector<float>  m_table;        // PHASES rows of m_stride coefficients
+};
+
+#endif // MAME_EMU_SOUNDFIR_H
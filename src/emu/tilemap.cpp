@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "tilemap.h"
 
+#include "emuopts.h"
 #include "screen.h"
 
 
@@ -94,6 +95,9 @@ inline bool tilemap_t::gfx_elements_changed()
 				isdirty = true;
 			}
 
+	// pixels decoded from the old graphics can't be reused
+	if (isdirty)
+		m_tilesigs_valid = false;
 	return isdirty;
 }
 
@@ -380,6 +384,7 @@ void tilemap_t::init_common(
 	m_attributes = 0;
 	m_all_tiles_dirty = true;
 	m_all_tiles_clean = false;
+	m_tilesigs_valid = false;
 	m_palette_offset = 0;
 	m_gfx_used = 0;
 	memset(m_gfx_dirtyseq, 0, sizeof(m_gfx_dirtyseq));
@@ -542,9 +547,12 @@ void tilemap_t::map_pens_to_layer(int group, pen_t pen, pen_t mask, u8 layermask
 			array[cur] = layermask;
 		}
 
-	// everything gets dirty if anything changed
+	// everything gets dirty if anything changed, and the old flags are stale
 	if (changed)
+	{
 		mark_all_dirty();
+		m_tilesigs_valid = false;
+	}
 }
 
 
@@ -701,6 +709,7 @@ void tilemap_t::mappings_create()
 	m_memory_to_logical.resize(max_memory_index);
 	m_logical_to_memory.resize(max_logical_index);
 	m_tileflags.resize(max_logical_index);
+	m_tilesigs.resize(max_logical_index);
 
 	// update the mappings
 	mappings_update();
@@ -736,8 +745,9 @@ void tilemap_t::mappings_update()
 		m_logical_to_memory[flipped_logindex] = memindex;
 	}
 
-	// mark the whole tilemap dirty
+	// mark the whole tilemap dirty; tiles have moved in the pixmap
 	mark_all_dirty();
+	m_tilesigs_valid = false;
 }
 
 
@@ -749,8 +759,10 @@ void tilemap_t::mappings_update()
 inline void tilemap_t::realize_all_dirty_tiles()
 {
 	// if all the tiles are marked dirty, or something in the gfx has changed,
-	// flush the dirty status to all tiles
-	if (m_all_tiles_dirty || gfx_elements_changed())
+	// flush the dirty status to all tiles; always check the gfx so that a
+	// change isn't lost when the used mask is reset below
+	bool const gfxchanged = gfx_elements_changed();
+	if (m_all_tiles_dirty || gfxchanged)
 	{
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
 		m_all_tiles_dirty = false;
@@ -784,8 +796,9 @@ void tilemap_t::pixmap_update()
 			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
 				tile_update(logindex, col, row);
 
-	// mark it all clean
+	// mark it all clean; every tile now matches its signature
 	m_all_tiles_clean = true;
+	m_tilesigs_valid = true;
 }
 
 
@@ -804,15 +817,40 @@ void tilemap_t::tile_update(logical_index logindex, u32 col, u32 row)
 	// apply the global tilemap flip to the returned flip flags
 	u32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
 
-	// draw the tile, using either direct or transparent
-	u32 x0 = m_tilewidth * col;
-	u32 y0 = m_tileheight * row;
-	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
-		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
-
-	// if mask data is specified, apply it
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
-		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+	// if the tile decodes exactly as it did last time, the pixmap already holds it;
+	// only tiles drawn from a tracked gfx element without external mask data qualify
+	tile_signature &sig = m_tilesigs[logindex];
+	if (m_tilesigs_valid && sig.gfxnum != 0xff && sig.gfxnum == m_tileinfo.gfxnum && m_tileinfo.mask_data == nullptr &&
+		sig.pen_data == m_tileinfo.pen_data && sig.palette_base == m_tileinfo.palette_base &&
+		sig.category == m_tileinfo.category && sig.group == m_tileinfo.group &&
+		sig.flags == u8(flags) && sig.pen_mask == m_tileinfo.pen_mask)
+	{
+		m_tileflags[logindex] = sig.tileflags;
+		g_profiler.count(PROFILER_COUNTER_TILES_REUSED);
+	}
+	else
+	{
+		// draw the tile, using either direct or transparent
+		u32 x0 = m_tilewidth * col;
+		u32 y0 = m_tileheight * row;
+		m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
+			m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
+
+		// if mask data is specified, apply it
+		if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
+			m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+
+		// remember what we drew
+		sig.pen_data = m_tileinfo.pen_data;
+		sig.palette_base = m_tileinfo.palette_base;
+		sig.category = m_tileinfo.category;
+		sig.group = m_tileinfo.group;
+		sig.flags = flags;
+		sig.pen_mask = m_tileinfo.pen_mask;
+		sig.gfxnum = (m_tileinfo.mask_data == nullptr) ? m_tileinfo.gfxnum : 0xff;
+		sig.tileflags = m_tileflags[logindex];
+		g_profiler.count(PROFILER_COUNTER_TILES_DECODED);
+	}
 
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
@@ -1009,6 +1047,31 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
 	u32 const yextent = visarea.bottom() + visarea.top() + 1; // y0 + y1 + 1 for calculating vertical centre as (y0 + y1 + 1) >> 1
 
+	// tall areas can be split into bands once every tile is up to date
+	if (m_manager->banded(blit.cliprect))
+	{
+		pixmap_update();
+		m_manager->draw_banded(blit.cliprect, [this, &screen, &dest, &blit, xextent, yextent] (const rectangle &band)
+				{
+					blit_parameters bandblit = blit;
+					bandblit.cliprect = band;
+					draw_scrolled(screen, dest, bandblit, xextent, yextent);
+				});
+	}
+	else
+		draw_scrolled(screen, dest, blit, xextent, yextent);
+}
+
+
+//-------------------------------------------------
+//  draw_scrolled - draw the instances of the
+//  tilemap covering the blit cliprect, applying
+//  row and column scrolling
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_scrolled(screen_device &screen, _BitmapClass &dest, blit_parameters &blit, u32 xextent, u32 yextent)
+{
 	// XY scrolling playfield
 	if (m_scrollrows == 1 && m_scrollcols == 1)
 	{
@@ -1142,7 +1205,17 @@ void tilemap_t::draw_roz_common(screen_device &screen, _BitmapClass &dest, const
 	pixmap();
 
 	// then do the roz copy
-	draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	if (m_manager->banded(blit.cliprect))
+	{
+		m_manager->draw_banded(blit.cliprect, [this, &screen, &dest, &blit, startx, starty, incxx, incxy, incyx, incyy, wraparound] (const rectangle &band)
+				{
+					blit_parameters bandblit = blit;
+					bandblit.cliprect = band;
+					draw_roz_core(screen, dest, bandblit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+				});
+	}
+	else
+		draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
 }
 
 void tilemap_t::draw_roz(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect,
@@ -1549,6 +1622,23 @@ void tilemap_t::draw_debug(screen_device &screen, bitmap_rgb32 &dest, u32 scroll
 }
 
 
+//-------------------------------------------------
+//  allocated_bytes - memory held for the pixmap,
+//  flags and mappings
+//-------------------------------------------------
+
+size_t tilemap_t::allocated_bytes() const
+{
+	return (size_t(m_pixmap.rowbytes()) * m_pixmap.height())
+			+ (size_t(m_flagsmap.rowbytes()) * m_flagsmap.height())
+			+ m_tileflags.size()
+			+ (m_tilesigs.size() * sizeof(tile_signature))
+			+ (m_memory_to_logical.size() * sizeof(logical_index))
+			+ (m_logical_to_memory.size() * sizeof(tilemap_memory_index))
+			+ ((m_rowscroll.size() + m_colscroll.size()) * sizeof(s32));
+}
+
+
 //-------------------------------------------------
 //  get_info_debug - extract info for one tile
 //-------------------------------------------------
@@ -1589,8 +1679,12 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_bands(machine.options().tilemap_bands()),
+		m_band_queue(nullptr)
 {
+	if (m_bands > 1)
+		m_band_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 }
 
 
@@ -1613,6 +1707,46 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_band_queue)
+		osd_work_queue_free(m_band_queue);
+}
+
+
+//-------------------------------------------------
+//  draw_banded - split a cliprect into horizontal
+//  bands and draw them in parallel; the calling
+//  thread draws the first band itself
+//-------------------------------------------------
+
+void tilemap_manager::draw_banded(const rectangle &cliprect, const std::function<void (const rectangle &)> &draw)
+{
+	int const count = std::min(m_bands, cliprect.height() / MIN_BAND_HEIGHT);
+	draw_band bands[16];
+	assert(count <= std::size(bands));
+	for (int band = 0; band < count; band++)
+	{
+		bands[band].draw = &draw;
+		bands[band].cliprect = cliprect;
+		bands[band].cliprect.sety(cliprect.top() + cliprect.height() * band / count, cliprect.top() + cliprect.height() * (band + 1) / count - 1);
+	}
+
+	osd_work_item_queue_multiple(m_band_queue, &tilemap_manager::draw_band_callback, count - 1, &bands[1], sizeof(bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	draw(bands[0].cliprect);
+	osd_work_queue_wait(m_band_queue, osd_ticks_per_second() * 100);
+}
+
+
+//-------------------------------------------------
+//  draw_band_callback - work item callback for a
+//  band of a parallel draw
+//-------------------------------------------------
+
+void *tilemap_manager::draw_band_callback(void *param, int threadid)
+{
+	draw_band const &band = *reinterpret_cast<draw_band const *>(param);
+	(*band.draw)(band.cliprect);
+	return nullptr;
 }
 
 
@@ -304,6 +304,7 @@
 #pragma once
 
 #include "memarray.h"
+#include <functional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -436,6 +437,7 @@ protected:
 public:
 	// getters
 	running_machine &machine() const;
+	device_t &device() const { return *m_device; }
 	device_palette_interface &palette() const { return *m_palette; }
 	device_gfx_interface &decoder() const { return *m_tileinfo.decoder; }
 
@@ -458,6 +460,7 @@ public:
 	u8 *tile_flags() { pixmap_update(); return &m_tileflags[0]; }
 	tilemap_memory_index memory_index(u32 col, u32 row) { return m_mapper(col, row, m_cols, m_rows); }
 	void get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &color);
+	size_t allocated_bytes() const;
 
 	// setters
 	void enable(bool enable = true) { m_enable = enable; }
@@ -526,6 +529,19 @@ private:
 		u8                  alpha;
 	};
 
+	// what a tile decoded to the last time it was drawn into the pixmap
+	struct tile_signature
+	{
+		const u8 *          pen_data;
+		pen_t               palette_base;
+		u8                  category;
+		u8                  group;
+		u8                  flags;
+		u8                  pen_mask;
+		u8                  gfxnum;                 // 0xff if the tile can't be reused
+		u8                  tileflags;              // resulting per-tile flags
+	};
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -554,6 +570,7 @@ private:
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template<class _BitmapClass> void draw_scrolled(screen_device &screen, _BitmapClass &dest, blit_parameters &blit, u32 xextent, u32 yextent);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -607,6 +624,8 @@ private:
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
+	std::vector<tile_signature> m_tilesigs;             // per-tile signature of the last decode
+	bool                        m_tilesigs_valid;       // false if the pixmap can't be reused
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
 };
 
@@ -635,6 +654,7 @@ public:
 	{ return create(decoder, std::forward<T>(tile_get_info), std::forward<U>(mapper), tilewidth, tileheight, cols, rows, &static_cast<tilemap_t &>(allocated)); }
 
 	// tilemap list information
+	tilemap_t *first() const { return m_tilemap_list.first(); }
 	tilemap_t *find(int index) { return m_tilemap_list.find(index); }
 	int count() const { return m_tilemap_list.count(); }
 
@@ -643,6 +663,20 @@ public:
 	void set_flip_all(u32 attributes);
 
 private:
+	// minimum number of scanlines in each band of a parallel draw
+	static constexpr int MIN_BAND_HEIGHT = 16;
+
+	struct draw_band
+	{
+		const std::function<void (const rectangle &)> *draw;
+		rectangle cliprect;
+	};
+
+	// parallel drawing
+	bool banded(const rectangle &cliprect) const { return m_band_queue && (cliprect.height() >= 2 * MIN_BAND_HEIGHT); }
+	void draw_banded(const rectangle &cliprect, const std::function<void (const rectangle &)> &draw);
+	static void *draw_band_callback(void *param, int threadid);
+
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_standard_mapper mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -654,6 +688,8 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	int                     m_bands;            // maximum number of bands for parallel draws
+	osd_work_queue *        m_band_queue;       // work queue for parallel draws
 };
 
 
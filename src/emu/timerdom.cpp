@@ -0,0 +1,137 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    timerdom.cpp
+
+    A set of events sharing one scheduler timer.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "timerdom.h"
+
+
+//**************************************************************************
+//  TIMER DOMAIN
+//**************************************************************************
+
+//-------------------------------------------------
+//  timer_domain - constructor
+//-------------------------------------------------
+
+timer_domain::timer_domain() noexcept
+	: m_owner(nullptr)
+	, m_timer(nullptr)
+	, m_count(0)
+	, m_armed(attotime::never)
+	, m_firing(false)
+{
+}
+
+
+//-------------------------------------------------
+//  start - allocate the timer and register state
+//-------------------------------------------------
+
+void timer_domain::start(device_t &owner, unsigned count, timer_expired_delegate &&callback)
+{
+	assert(!m_timer);
+	assert(count && (count <= MAX_EVENTS));
+
+	m_owner = &owner;
+	m_timer = owner.timer_alloc(FUNC(timer_domain::fire), this);
+	m_callback = std::move(callback);
+	m_count = count;
+	std::fill(m_expire.begin(), m_expire.end(), attotime::never);
+	m_armed = attotime::never;
+
+	owner.save_item(NAME(m_expire));
+	owner.save_item(NAME(m_armed));
+}
+
+
+//-------------------------------------------------
+//  adjust - set an event to fire after a delay,
+//  or disable it with attotime::never
+//-------------------------------------------------
+
+void timer_domain::adjust(unsigned event, const attotime &delay)
+{
+	assert(event < m_count);
+
+	attotime const previous = m_expire[event];
+	if (delay.is_never())
+		m_expire[event] = attotime::never;
+	else
+		m_expire[event] = m_owner->machine().time() + ((delay.seconds() < 0) ? attotime::zero : delay);
+
+	// the timer only needs to move if this was, or now is, the earliest event
+	if (!m_firing && ((previous == m_armed) || (m_expire[event] < m_armed)))
+		rearm();
+}
+
+
+//-------------------------------------------------
+//  remaining - time until an event fires
+//-------------------------------------------------
+
+attotime timer_domain::remaining(unsigned event) const noexcept
+{
+	assert(event < m_count);
+
+	attotime const curtime = m_owner->machine().time();
+	if (curtime >= m_expire[event])
+		return attotime::zero;
+	return m_expire[event] - curtime;
+}
+
+
+//-------------------------------------------------
+//  rearm - set the timer for the earliest event
+//-------------------------------------------------
+
+void timer_domain::rearm()
+{
+	attotime earliest = attotime::never;
+	for (unsigned event = 0; event < m_count; event++)
+		earliest = std::min(earliest, m_expire[event]);
+
+	if (earliest != m_armed)
+	{
+		m_armed = earliest;
+		if (earliest.is_never())
+			m_timer->adjust(attotime::never);
+		else
+			m_timer->adjust(earliest - m_owner->machine().time());
+	}
+}
+
+
+//-------------------------------------------------
+//  fire - run every event that's due, including
+//  ones the callbacks make due
+//-------------------------------------------------
+
+TIMER_CALLBACK_MEMBER(timer_domain::fire)
+{
+	attotime const curtime = m_owner->machine().time();
+	m_firing = true;
+	for (bool fired = true; fired; )
+	{
+		fired = false;
+		for (unsigned event = 0; event < m_count; event++)
+		{
+			if (m_expire[event] <= curtime)
+			{
+				m_expire[event] = attotime::never;
+				m_callback(event);
+				fired = true;
+			}
+		}
+	}
+	m_firing = false;
+
+	m_armed = attotime::never;
+	rearm();
+}
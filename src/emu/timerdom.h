@@ -0,0 +1,66 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    timerdom.h
+
+    A set of events sharing one scheduler timer.
+
+    Peripherals with several counters (timers, baud rate generators,
+    shift registers) tend to reschedule their events on every register
+    access.  With a timer per event, each of those goes through the
+    scheduler's timer queue and can abort the current timeslice.  A
+    domain keeps the expiry of each event itself and only moves the
+    underlying timer when the earliest event changes.
+
+    Events are numbered from 0 and the callback gets the event number
+    as its parameter.  Events due at the same time fire in numerical
+    order.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_TIMERDOM_H
+#define MAME_EMU_TIMERDOM_H
+
+#pragma once
+
+#include <array>
+
+
+// ======================> timer_domain
+
+class timer_domain
+{
+public:
+	static constexpr unsigned MAX_EVENTS = 8;
+
+	// construction/destruction
+	timer_domain() noexcept;
+
+	// allocate the timer and register state - call from device_start
+	void start(device_t &owner, unsigned count, timer_expired_delegate &&callback) ATTR_COLD;
+
+	// control
+	void adjust(unsigned event, const attotime &delay);
+	void disable(unsigned event) { adjust(event, attotime::never); }
+
+	// queries
+	bool enabled(unsigned event) const noexcept { assert(event < m_count); return !m_expire[event].is_never(); }
+	attotime expire(unsigned event) const noexcept { assert(event < m_count); return m_expire[event]; }
+	attotime remaining(unsigned event) const noexcept;
+
+private:
+	TIMER_CALLBACK_MEMBER(fire);
+	void rearm();
+
+	device_t *                  m_owner;
+	emu_timer *                 m_timer;
+	timer_expired_delegate      m_callback;
+	unsigned                    m_count;
+	std::array<attotime, MAX_EVENTS> m_expire; // expiry of each event, never when disabled
+	attotime                    m_armed;    // time the underlying timer is set for
+	bool                        m_firing;   // dispatching events, rearm when done
+};
+
+
+#endif // MAME_EMU_TIMERDOM_H
@@ -21,8 +21,12 @@
 #include "path.h"
 #include "unicode.h"
 
+#include <algorithm>
 #include <cctype>
+#include <future>
+#include <queue>
 #include <sstream>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 
@@ -1833,6 +1837,7 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	, m_current_ioport(nullptr)
 	, m_checking_card(false)
 	, m_quick(quick)
+	, m_parent(nullptr)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -1843,6 +1848,21 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	}
 }
 
+validity_checker::validity_checker(validity_checker &parent)
+	: m_drivlist(parent.m_drivlist.options())
+	, m_errors(0)
+	, m_warnings(0)
+	, m_print_verbose(parent.m_print_verbose)
+	, m_defstr_map(parent.m_defstr_map)
+	, m_current_driver(nullptr)
+	, m_current_device(nullptr)
+	, m_current_ioport(nullptr)
+	, m_checking_card(false)
+	, m_quick(parent.m_quick)
+	, m_parent(&parent)
+{
+}
+
 //-------------------------------------------------
 //  validity_checker - destructor
 //-------------------------------------------------
@@ -1852,6 +1872,14 @@ validity_checker::~validity_checker()
 	validate_end();
 }
 
+
+//-------------------------------------------------
+//  s_worker - the checker for drivers being
+//  checked on this thread, if any
+//-------------------------------------------------
+
+thread_local validity_checker *validity_checker::s_worker = nullptr;
+
 //-------------------------------------------------
 //  check_driver - check a single driver
 //-------------------------------------------------
@@ -1876,10 +1904,12 @@ void validity_checker::check_shared_source(const game_driver &driver)
 	validate_begin();
 
 	// then iterate over all drivers and check the ones that share the same source file
+	driver_vector drivers;
 	m_drivlist.reset();
 	while (m_drivlist.next())
 		if (strcmp(driver.type.source(), m_drivlist.driver().type.source()) == 0)
-			validate_one(m_drivlist.driver());
+			drivers.emplace_back(m_drivlist.driver());
+	validate_list(drivers);
 
 	// cleanup
 	validate_end();
@@ -1916,16 +1946,13 @@ bool validity_checker::check_all_matching(const char *string)
 	}
 
 	// then iterate over all drivers and check them
+	driver_vector drivers;
 	m_drivlist.reset();
-	bool validated_any = false;
 	while (m_drivlist.next())
-	{
 		if (driver_list::matches(string, m_drivlist.driver().name))
-		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
-		}
-	}
+			drivers.emplace_back(m_drivlist.driver());
+	bool const validated_any = !drivers.empty();
+	validate_list(drivers);
 
 	// validate devices
 	if (!string)
@@ -2046,26 +2073,95 @@ void validity_checker::validate_one(const game_driver &driver)
 
 
 //-------------------------------------------------
-//  validate_driver - validate basic driver
-//  information
+//  validate_list - check a list of drivers,
+//  splitting long lists between threads
 //-------------------------------------------------
 
-void validity_checker::validate_driver(device_t &root)
+void validity_checker::validate_list(driver_vector const &drivers)
 {
-	// check for duplicate names
-	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
+	// verbose output announces each driver before checking it to help find
+	// crashes, so that has to be done in order on this thread
+	if (m_print_verbose || (drivers.size() <= DRIVERS_PER_TASK))
 	{
-		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
-		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		for (game_driver const &driver : drivers)
+			validate_one(driver);
+		return;
 	}
 
-	// check for duplicate descriptions
-	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
+	// record names and descriptions in list order first, so duplicates are
+	// reported against the same drivers whatever order the tasks run in
+	for (game_driver const &driver : drivers)
 	{
-		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
-		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		m_names_map.emplace(driver.name, &driver);
+		m_descriptions_map.emplace(driver.type.fullname(), &driver);
 	}
 
+	// each task checks a fixed run of drivers with a checker of its own, and
+	// reports are merged in list order, so the output doesn't depend on the
+	// number of threads or how they're scheduled
+	std::queue<std::future<std::unique_ptr<validity_checker> > > tasks;
+	unsigned int const maximum_task_count = std::max(std::thread::hardware_concurrency(), 1U) + 2;
+	auto next = drivers.begin();
+	while ((drivers.end() != next) || !tasks.empty())
+	{
+		while ((drivers.end() != next) && (tasks.size() < maximum_task_count))
+		{
+			auto const end = next + std::min<std::ptrdiff_t>(DRIVERS_PER_TASK, drivers.end() - next);
+			auto task_proc = [this, next, end] ()
+					{
+						std::unique_ptr<validity_checker> worker(new validity_checker(*this));
+						s_worker = worker.get();
+						try
+						{
+							for (auto it = next; end != it; ++it)
+								worker->validate_one(*it);
+						}
+						catch (...)
+						{
+							s_worker = nullptr;
+							throw;
+						}
+						s_worker = nullptr;
+						return worker;
+					};
+			tasks.emplace(std::async(std::launch::async, std::move(task_proc)));
+			next = end;
+		}
+
+		// wait for the oldest task and pass on what it found
+		std::unique_ptr<validity_checker> const worker = tasks.front().get();
+		tasks.pop();
+		m_errors += worker->m_errors;
+		m_warnings += worker->m_warnings;
+		if (!worker->m_report.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", worker->m_report);
+	}
+}
+
+
+//-------------------------------------------------
+//  validate_driver - validate basic driver
+//  information
+//-------------------------------------------------
+
+void validity_checker::validate_driver(device_t &root)
+{
+	// check for duplicate names and descriptions - when checking in parallel,
+	// the parent has already recorded the first driver with each
+	game_driver_map &names_map = m_parent ? m_parent->m_names_map : m_names_map;
+	game_driver_map &descriptions_map = m_parent ? m_parent->m_descriptions_map : m_descriptions_map;
+	auto name = names_map.find(m_current_driver->name);
+	if (names_map.end() == name)
+		name = names_map.emplace(m_current_driver->name, m_current_driver).first;
+	if (name->second != m_current_driver)
+		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(name->second->type.source()), name->second->name);
+
+	auto description = descriptions_map.find(m_current_driver->type.fullname());
+	if (descriptions_map.end() == description)
+		description = descriptions_map.emplace(m_current_driver->type.fullname(), m_current_driver).first;
+	if (description->second != m_current_driver)
+		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(description->second->type.source()), description->second->name);
+
 	// determine if we are a clone
 	bool is_clone = (strcmp(m_current_driver->parent, "0") != 0);
 	int clone_of = driver_list::clone(*m_current_driver);
@@ -2897,6 +2993,13 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<char> &args)
 {
+	// messages raised while a worker is checking drivers belong to it
+	if (s_worker && (s_worker != this))
+	{
+		s_worker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2937,7 +3040,15 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 		break;
 
 	default:
-		chain_output(channel, args);
+		if (m_parent)
+		{
+			std::lock_guard<std::mutex> guard(m_parent->m_output_mutex);
+			m_parent->chain_output(channel, args);
+		}
+		else
+		{
+			chain_output(channel, args);
+		}
 		break;
 	}
 }
@@ -2951,8 +3062,11 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 template <typename Format, typename... Params>
 void validity_checker::output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args)
 {
-	// call through to the delegate with the proper parameters
-	chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	// workers hold their report until the parent merges it
+	if (m_parent)
+		m_report.append(util::string_format(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	else
+		chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
 }
 
 //-------------------------------------------------
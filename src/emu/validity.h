@@ -16,6 +16,13 @@
 #include "drivenum.h"
 #include "emuopts.h"
 
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -58,6 +65,13 @@ private:
 	using game_driver_map = std::unordered_map<std::string, game_driver const *>;
 	using int_map = std::unordered_map<std::string, uintptr_t>;
 	using string_set = std::unordered_set<std::string>;
+	using driver_vector = std::vector<std::reference_wrapper<game_driver const> >;
+
+	// drivers checked per task when checking in parallel
+	static constexpr std::size_t DRIVERS_PER_TASK = 64;
+
+	// checker for a run of drivers on another thread
+	validity_checker(validity_checker &parent);
 
 	// internal helpers
 	int get_defstr_index(const char *string, bool suppress_error = false);
@@ -66,6 +80,7 @@ private:
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	void validate_list(driver_vector const &drivers);
 
 	// internal sub-checks
 	void validate_driver(device_t &root);
@@ -112,6 +127,13 @@ private:
 	string_set              m_slotcard_set;
 	bool                    m_checking_card;
 	bool const              m_quick;
+
+	// parallel checking
+	validity_checker *const m_parent;       // checker that merges our report, if we're a worker
+	std::string             m_report;       // report text held until it's merged
+	std::mutex              m_output_mutex; // serialises output passed through from workers
+
+	static thread_local validity_checker *s_worker; // worker checker on this thread
 };
 
 #endif // MAME_EMU_VALIDITY_H
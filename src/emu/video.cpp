@@ -10,6 +10,7 @@
 
 #include "emu.h"
 
+#include "benchlog.h"
 #include "crsshair.h"
 #include "debugger.h"
 #include "emuopts.h"
@@ -38,6 +39,15 @@
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// frames presented per second of real time in turbo mode, to keep the UI alive
+constexpr int TURBO_PRESENT_RATE = 20;
+
+
+
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -81,6 +91,9 @@ video_manager::video_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_screenless_frame_timer(nullptr)
 	, m_output_changed(false)
+	, m_output_suppressed(false)
+	, m_rolling_back(false)
+	, m_frame_completed(false)
 	, m_throttle_last_ticks(0)
 	, m_throttle_realtime(attotime::zero)
 	, m_throttle_emutime(attotime::zero)
@@ -95,10 +108,19 @@ video_manager::video_manager(running_machine &machine)
 	, m_throttled(true)
 	, m_throttle_rate(1.0f)
 	, m_fastforward(false)
+	, m_turbo(false)
+	, m_turbo_until(attotime::never)
+	, m_turbo_last_present(0)
 	, m_seconds_to_run(machine.options().seconds_to_run())
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
 	, m_low_latency(machine.options().low_latency())
+	, m_audio_sync(machine.options().audio_sync())
+	, m_audio_sync_fill(-1.0)
+	, m_frame_delay(machine.options().frame_delay())
+	, m_auto_frame_delay(machine.options().auto_frame_delay())
+	, m_frame_delay_end(0)
+	, m_frame_work_ticks(0)
 	, m_empty_skip_count(0)
 	, m_frameskip_max(m_auto_frameskip ? machine.options().frameskip() : 0)
 	, m_frameskip_level(m_auto_frameskip ? 0 : machine.options().frameskip())
@@ -110,6 +132,8 @@ video_manager::video_manager(running_machine &machine)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
+	, m_snap_bands(machine.options().snap_bands())
+	, m_snap_queue(nullptr)
 {
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&video_manager::exit, this));
@@ -171,6 +195,10 @@ video_manager::video_manager(running_machine &machine)
 	if (sscanf(machine.options().snap_size(), "%dx%d", &m_snap_width, &m_snap_height) != 2)
 		m_snap_width = m_snap_height = 0;
 
+	// snapshots can be rendered in bands on worker threads
+	if (m_snap_bands > 1)
+		m_snap_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// if no screens, create a periodic timer to drive updates
 	if (no_screens)
 	{
@@ -178,6 +206,29 @@ video_manager::video_manager(running_machine &machine)
 		m_screenless_frame_timer->adjust(screen_device::DEFAULT_FRAME_PERIOD, 0, screen_device::DEFAULT_FRAME_PERIOD);
 		machine.output().set_global_notifier(video_notifier_callback, this);
 	}
+
+	// start in turbo mode if asked to
+	if (machine.options().turbo_seconds() > 0)
+	{
+		m_turbo_until = attotime::from_seconds(machine.options().turbo_seconds());
+		set_turbo(true);
+	}
+}
+
+
+//-------------------------------------------------
+//  set_turbo - enter or leave turbo mode, in
+//  which frames are emulated without updating
+//  the screens, composing the render targets or
+//  producing the final sound mix
+//-------------------------------------------------
+
+void video_manager::set_turbo(bool turbo)
+{
+	m_turbo = turbo;
+	if (!turbo)
+		m_turbo_until = attotime::never;
+	m_turbo_last_present = 0;
 }
 
 
@@ -216,7 +267,40 @@ void video_manager::frame_update(bool from_debugger)
 	machine_phase const phase = machine().phase();
 	bool skipped_it = m_skipping_this_frame;
 	bool const update_screens = (phase == machine_phase::RUNNING) && (!machine().paused() || machine().options().update_in_pause());
-	bool anything_changed = update_screens && finish_screen_updates();
+	m_frame_completed = true;
+
+	// outputs changed during the frame are notified together, before the screens are drawn
+	machine().output().flush();
+
+	// in turbo mode, frames between the occasional presented one do no more
+	// than their bookkeeping
+	if (m_turbo && m_skipping_this_frame && !from_debugger && (phase > machine_phase::INIT))
+	{
+		turbo_frame_update();
+		return;
+	}
+
+	// a frame that won't be shown only needs the screens to move on
+	if (m_output_suppressed && !from_debugger)
+	{
+		if (update_screens)
+		{
+			for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+			{
+				if (screen.partial_scan_hpos() > 0)
+					screen.update_now();
+				screen.update_partial(screen.visible_area().max_y);
+			}
+		}
+		return;
+	}
+	bench_log_manager *const bench_log = machine().bench_log();
+	bool anything_changed = false;
+	if (update_screens)
+	{
+		bench_log_manager::scope timing(bench_log, bench_log_manager::PART_SCREEN);
+		anything_changed = finish_screen_updates();
+	}
 
 	// update inputs and draw the user interface
 	machine().osd().input_update(true);
@@ -235,18 +319,33 @@ void video_manager::frame_update(bool from_debugger)
 
 	// if we're throttling, synchronize before rendering
 	attotime current_time = machine().time();
+	osd_ticks_t const work_end = (m_frame_delay || m_auto_frame_delay) ? osd_ticks() : 0;
 	if (!from_debugger && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	{
+		bench_log_manager::scope timing(bench_log, bench_log_manager::PART_THROTTLE);
 		update_throttle(current_time);
+	}
 
 	// ask the OSD to update
 	{
 		auto profile = g_profiler.start(PROFILER_BLIT);
+		bench_log_manager::scope timing(bench_log, bench_log_manager::PART_OSD);
 		machine().osd().update(!from_debugger && skipped_it);
 	}
 
 	// we synchronize after rendering instead of before, if low latency mode is enabled
 	if (!from_debugger && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	{
+		bench_log_manager::scope timing(bench_log, bench_log_manager::PART_THROTTLE);
 		update_throttle(current_time);
+	}
+
+	// hold back the start of the next frame so it reads input as late as it can
+	if (!from_debugger && phase > machine_phase::INIT && (m_frame_delay || m_auto_frame_delay) && effective_throttle())
+	{
+		bench_log_manager::scope timing(bench_log, bench_log_manager::PART_THROTTLE);
+		apply_frame_delay(work_end, skipped_it);
+	}
 
 	machine().osd().input_update(false);
 	emulator_info::periodic_check();
@@ -254,6 +353,7 @@ void video_manager::frame_update(bool from_debugger)
 	if (!from_debugger)
 	{
 		// perform tasks for this frame
+		g_profiler.count(PROFILER_COUNTER_FRAMES);
 		machine().call_notifiers(MACHINE_NOTIFY_FRAME);
 
 		// update frameskipping
@@ -261,8 +361,12 @@ void video_manager::frame_update(bool from_debugger)
 			update_frameskip();
 
 		// update speed computations
-		if (!skipped_it && phase > machine_phase::INIT)
+		if ((!skipped_it || m_turbo) && phase > machine_phase::INIT)
 			recompute_speed(current_time);
+
+		// log this frame's timings, skipped or not
+		if (bench_log && phase > machine_phase::INIT)
+			bench_log->frame(current_time);
 	}
 
 	// call the end-of-frame callback
@@ -278,6 +382,27 @@ void video_manager::frame_update(bool from_debugger)
 }
 
 
+//-------------------------------------------------
+//  turbo_frame_update - end a frame in turbo
+//  mode that won't be presented; the screens
+//  are left alone, as skip_this_frame() stops
+//  any partial updates
+//-------------------------------------------------
+
+void video_manager::turbo_frame_update()
+{
+	attotime const current_time = machine().time();
+	emulator_info::periodic_check();
+
+	g_profiler.count(PROFILER_COUNTER_FRAMES);
+	machine().call_notifiers(MACHINE_NOTIFY_FRAME);
+	update_frameskip();
+	recompute_speed(current_time);
+	if (bench_log_manager *const bench_log = machine().bench_log())
+		bench_log->frame(current_time);
+}
+
+
 //-------------------------------------------------
 //  speed_text - print the text to be displayed
 //  into a string buffer
@@ -296,6 +421,10 @@ std::string video_manager::speed_text()
 	else if (m_fastforward)
 		str << "fast ";
 
+	// likewise for turbo mode
+	else if (m_turbo)
+		str << "turbo";
+
 	// if we're auto frameskipping, display that plus the level
 	else if (effective_autoframeskip())
 		util::stream_format(str, "auto%2d/%d", effective_frameskip(), m_frameskip_max ? m_frameskip_max : MAX_FRAMESKIP);
@@ -336,6 +465,7 @@ void video_manager::save_snapshot(screen_device *screen, util::core_file &file)
 	std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
 	std::string text2 = std::string(machine().system().manufacturer).append(" ").append(machine().system().type.fullname());
 	util::png_info pnginfo;
+	pnginfo.compression_level = machine().options().snap_compression();
 	pnginfo.add_text("Software", text1);
 	pnginfo.add_text("System", text2);
 
@@ -501,6 +631,9 @@ void video_manager::exit()
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_queue)
+		osd_work_queue_free(m_snap_queue);
+	m_snap_queue = nullptr;
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
@@ -532,6 +665,10 @@ void video_manager::screenless_update_callback(s32 param)
 
 void video_manager::postload()
 {
+	// presented frames keep moving forward across a run-ahead rollback
+	if (m_rolling_back)
+		return;
+
 	attotime const emutime = machine().time();
 	for (const auto &x : m_movie_recordings)
 		x->set_next_frame_time(emutime);
@@ -551,7 +688,7 @@ void video_manager::postload()
 inline bool video_manager::effective_autoframeskip() const
 {
 	// if we're fast forwarding or paused, autoframeskip is disabled
-	if (m_fastforward || machine().paused())
+	if (m_fastforward || m_turbo || machine().paused())
 		return false;
 
 	// otherwise, it's up to the user
@@ -589,7 +726,7 @@ inline bool video_manager::effective_throttle() const
 		return true;
 
 	// if we're fast forwarding, we don't throttle
-	if (m_fastforward)
+	if (m_fastforward || m_turbo)
 		return false;
 
 	// otherwise, it's up to the user
@@ -697,6 +834,11 @@ void video_manager::update_throttle(attotime emutime)
 
 */
 
+	// with audiosync, real time is scaled by a fraction of a percent so that the
+	// sound buffer neither drains nor fills up; emulation then tracks the audio
+	// clock and the sound module can run with very little buffering
+	double const rate_scale = m_audio_sync ? audio_sync_scale() : 1.0;
+
 	// outer scope so we can break out in case of a resync
 	while (1)
 	{
@@ -709,7 +851,7 @@ void video_manager::update_throttle(attotime emutime)
 
 		// compute conversion factors up front
 		osd_ticks_t ticks_per_second = osd_ticks_per_second();
-		attoseconds_t attoseconds_per_tick = ATTOSECONDS_PER_SECOND / ticks_per_second * m_throttle_rate;
+		attoseconds_t attoseconds_per_tick = ATTOSECONDS_PER_SECOND / ticks_per_second * m_throttle_rate * rate_scale;
 
 		// if we're paused, emutime will not advance; instead, we subtract a fixed
 		// amount of time (1/60th of a second) from the emulated time that was passed in,
@@ -794,6 +936,70 @@ void video_manager::update_throttle(attotime emutime)
 }
 
 
+//-------------------------------------------------
+//  audio_sync_scale - return the factor applied
+//  to real time to steer the OSD sound buffer
+//  toward its target fill
+//-------------------------------------------------
+
+double video_manager::audio_sync_scale()
+{
+	int fill, target;
+	if (machine().paused() || !machine().sound().osd_buffer_status(fill, target))
+		return 1.0;
+
+	// smooth out the jitter between sound updates and callbacks
+	if (m_audio_sync_fill < 0)
+		m_audio_sync_fill = fill;
+	else
+		m_audio_sync_fill += (double(fill) - m_audio_sync_fill) * AUDIO_SYNC_SMOOTHING;
+
+	// a fuller buffer makes real time pass faster, so emulation slows down
+	double const error = std::clamp((m_audio_sync_fill - double(target)) / double(target), -1.0, 1.0);
+	return 1.0 + AUDIO_SYNC_MAX_DELTA * error;
+}
+
+
+//-------------------------------------------------
+//  apply_frame_delay - wait part of a frame
+//  after throttling, so the next frame is
+//  emulated and shown just before it's due
+//-------------------------------------------------
+
+void video_manager::apply_frame_delay(osd_ticks_t work_end, bool skipped)
+{
+	screen_device *const screen = screen_device_enumerator(machine().root_device()).first();
+	osd_ticks_t const now = osd_ticks();
+	if (!screen || machine().paused() || !m_frame_delay_end)
+	{
+		m_frame_delay_end = now;
+		return;
+	}
+
+	// the real time one frame takes at the current speed
+	osd_ticks_t const ticks_per_second = osd_ticks_per_second();
+	double const speed = ((m_speed != 0) ? (m_speed / 1000.0) : 1.0) * m_throttle_rate;
+	osd_ticks_t const period = osd_ticks_t(ATTOSECONDS_TO_DOUBLE(screen->frame_period().attoseconds()) * double(ticks_per_second) / speed);
+
+	osd_ticks_t delay = period * (m_frame_delay ? m_frame_delay : 9) / 10;
+	if (m_auto_frame_delay)
+	{
+		// keep the slowest recent frame's emulation time, forgetting it
+		// gradually, and leave a quarter of it plus a millisecond to spare
+		osd_ticks_t const work = work_end - m_frame_delay_end;
+		m_frame_work_ticks = std::max(work, m_frame_work_ticks - m_frame_work_ticks / 16);
+		osd_ticks_t const budget = m_frame_work_ticks + m_frame_work_ticks / 4 + ticks_per_second / 1000;
+		delay = std::min(delay, (budget < period) ? (period - budget) : 0);
+	}
+
+	// frames that weren't shown don't need their input any later
+	if (skipped || !delay)
+		m_frame_delay_end = now;
+	else
+		m_frame_delay_end = throttle_until_ticks(now + delay);
+}
+
+
 //-------------------------------------------------
 //  throttle_until_ticks - spin until the
 //  specified target time, calling the OSD code
@@ -894,6 +1100,20 @@ void video_manager::update_frameskip()
 	// increment the frameskip counter and determine if we will skip the next frame
 	m_frameskip_counter = (m_frameskip_counter + 1) % FRAMESKIP_LEVELS;
 	m_skipping_this_frame = s_skiptable[effective_frameskip()][m_frameskip_counter];
+
+	// turbo mode skips everything but a few frames a second of real time
+	if (m_turbo)
+	{
+		if (machine().time() >= m_turbo_until)
+			set_turbo(false);
+		else
+		{
+			osd_ticks_t const now = osd_ticks();
+			m_skipping_this_frame = (now - m_turbo_last_present) < (osd_ticks_per_second() / TURBO_PRESENT_RATE);
+			if (!m_skipping_this_frame)
+				m_turbo_last_present = now;
+		}
+	}
 }
 
 
@@ -1046,9 +1266,9 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue, m_snap_bands);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue, m_snap_bands);
 	primlist.release_lock();
 }
 
@@ -20,6 +20,7 @@
 #include "recording.h"
 
 #include <system_error>
+#include <utility>
 
 
 //**************************************************************************
@@ -53,14 +54,22 @@ public:
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	bool turbo() const { return m_turbo; }
 
 	// setters
 	void set_frameskip(int frameskip);
 	void set_throttled(bool throttled) { m_throttled = throttled; }
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd) { m_fastforward = ffwd; }
+	void set_turbo(bool turbo);
 	void set_output_changed() { m_output_changed = true; }
 
+	// run-ahead support: emulate frames without showing or pacing them, and
+	// roll back without disturbing the speed and recording timelines
+	void set_output_suppressed(bool suppressed) { m_output_suppressed = suppressed; }
+	void set_rolling_back(bool rolling_back) { m_rolling_back = rolling_back; }
+	bool frame_completed() { return std::exchange(m_frame_completed, false); }
+
 	// misc
 	void toggle_record_movie(movie_recording::format format);
 	std::error_condition open_next(emu_file &file, const char *extension, uint32_t index = 0);
@@ -92,6 +101,7 @@ private:
 	void exit();
 	void screenless_update_callback(s32 param);
 	void postload();
+	void turbo_frame_update();
 
 	// effective value helpers
 	bool effective_autoframeskip() const;
@@ -102,6 +112,8 @@ private:
 	bool finish_screen_updates();
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
+	void apply_frame_delay(osd_ticks_t work_end, bool skipped);
+	double audio_sync_scale();
 	void update_frameskip();
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
@@ -119,6 +131,9 @@ private:
 	// screenless systems
 	emu_timer *         m_screenless_frame_timer;   // timer to signal VBLANK start
 	bool                m_output_changed;           // did an output element change?
+	bool                m_output_suppressed;        // emulate frames without presenting them
+	bool                m_rolling_back;             // is the current load a run-ahead rollback?
+	bool                m_frame_completed;          // has a frame update happened since last asked?
 
 	// throttling calculations
 	osd_ticks_t         m_throttle_last_ticks;      // osd_ticks the last call to throttle
@@ -141,10 +156,19 @@ private:
 	bool                m_throttled;                // flag: true if we're currently throttled
 	float               m_throttle_rate;            // target rate for throttling
 	bool                m_fastforward;              // flag: true if we're currently fast-forwarding
+	bool                m_turbo;                    // flag: true if we're emulating without rendering or mixing
+	attotime            m_turbo_until;              // emulated time at which turbo mode ends, or never
+	osd_ticks_t         m_turbo_last_present;       // real time turbo mode last presented a frame
 	u32                 m_seconds_to_run;           // number of seconds to run before quitting
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
 	bool                m_low_latency;              // flag: true if we are throttling after blitting
+	bool                m_audio_sync;               // flag: true if the sound buffer fill steers the throttle
+	double              m_audio_sync_fill;          // smoothed sound buffer fill, in frames
+	u8                  m_frame_delay;              // tenths of a frame to hold back the start of each frame
+	bool                m_auto_frame_delay;         // flag: true if the frame delay follows measured emulation times
+	osd_ticks_t         m_frame_delay_end;          // real time the last frame delay ended
+	osd_ticks_t         m_frame_work_ticks;         // slowest recent emulation time per frame, decaying
 
 	// frameskipping
 	u8                  m_empty_skip_count;         // number of empty frames we have skipped
@@ -161,6 +185,8 @@ private:
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	s32                 m_snap_width;               // width of snapshots (0 == auto)
 	s32                 m_snap_height;              // height of snapshots (0 == auto)
+	int                 m_snap_bands;               // number of bands snapshots are rendered in
+	osd_work_queue *    m_snap_queue;               // work queue for banded snapshot rendering
 
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
@@ -169,6 +195,8 @@ private:
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
 	static const int PAUSED_REFRESH_RATE = 30;
+	static constexpr double AUDIO_SYNC_MAX_DELTA = 0.005;   // largest speed adjustment made by audiosync
+	static constexpr double AUDIO_SYNC_SMOOTHING = 0.05;    // weight of each new sound buffer fill reading
 };
 
 #endif // MAME_EMU_VIDEO_H
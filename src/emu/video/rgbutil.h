@@ -23,6 +23,11 @@
 #define MAME_RGB_HIGH_PRECISION
 #include "rgbvmx.h"
 
+#elif defined(__wasm_simd128__)
+
+#define MAME_RGB_HIGH_PRECISION
+#include "rgbwasm.h"
+
 #else
 
 #include "rgbgen.h"
@@ -0,0 +1,37 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbwasm.cpp
+
+    WebAssembly SIMD128 optimised RGB utilities.
+
+***************************************************************************/
+
+#include "emu.h"
+
+#if defined(__wasm_simd128__)
+
+#include "rgbwasm.h"
+
+
+/***************************************************************************
+    HIGHER LEVEL OPERATIONS
+***************************************************************************/
+
+void rgbaint_t::blend(const rgbaint_t& other, u8 factor)
+{
+	m_value = wasm_i32x4_add(
+			wasm_i32x4_mul(m_value, wasm_i32x4_splat(factor)),
+			wasm_i32x4_mul(other.m_value, wasm_i32x4_splat(0x100 - factor)));
+	sra_imm(8);
+}
+
+void rgbaint_t::scale_and_clamp(const rgbaint_t& scale)
+{
+	mul(scale);
+	sra_imm(8);
+	clamp_to_uint8();
+}
+
+#endif // defined(__wasm_simd128__)
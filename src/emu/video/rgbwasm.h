@@ -0,0 +1,352 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbwasm.h
+
+    WebAssembly SIMD128 optimised RGB utilities.
+
+    Elements are laid out as in the SSE version, with blue in the lowest
+    lane and alpha in the highest.  WebAssembly has full 32-bit lane
+    multiplies, so the scaling operations don't need the limited
+    precision tricks the SSE version uses.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBWASM_H
+#define MAME_EMU_VIDEO_RGBWASM_H
+
+#pragma once
+
+#include <wasm_simd128.h>
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+class rgbaint_t
+{
+public:
+	rgbaint_t() { }
+	explicit rgbaint_t(u32 rgba) { set(rgba); }
+	rgbaint_t(s32 a, s32 r, s32 g, s32 b) { set(a, r, g, b); }
+	explicit rgbaint_t(const rgb_t& rgb) { set(rgb); }
+	explicit rgbaint_t(v128_t rgba) { m_value = rgba; }
+
+	rgbaint_t(const rgbaint_t& other) = default;
+	rgbaint_t &operator=(const rgbaint_t& other) = default;
+
+	void set(const rgbaint_t& other) { m_value = other.m_value; }
+	void set(const u32& rgba) { m_value = expand(rgba); }
+	void set(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_i32x4_make(b, g, r, a); }
+	void set(const rgb_t& rgb) { set((const u32&) rgb); }
+	// This function sets all elements to the same val
+	void set_all(const s32& val) { m_value = wasm_i32x4_splat(val); }
+	// This function zeros all elements
+	void zero() { m_value = wasm_i32x4_splat(0); }
+	// This function zeros only the alpha element
+	void zero_alpha() { m_value = wasm_i32x4_replace_lane(m_value, 3, 0); }
+
+	inline rgb_t to_rgba() const
+	{
+		return u32(wasm_i32x4_extract_lane(pack(m_value), 0));
+	}
+
+	inline rgb_t to_rgba_clamp() const
+	{
+		return u32(wasm_i32x4_extract_lane(pack(m_value), 0));
+	}
+
+	void set_a16(const s32 value) { m_value = wasm_i16x8_replace_lane(m_value, 6, value); }
+	void set_a(const s32 value) { m_value = wasm_i32x4_replace_lane(m_value, 3, value); }
+	void set_r(const s32 value) { m_value = wasm_i32x4_replace_lane(m_value, 2, value); }
+	void set_g(const s32 value) { m_value = wasm_i32x4_replace_lane(m_value, 1, value); }
+	void set_b(const s32 value) { m_value = wasm_i32x4_replace_lane(m_value, 0, value); }
+
+	u8 get_a() const { return u8(u32(wasm_i32x4_extract_lane(m_value, 3))); }
+	u8 get_r() const { return u8(u32(wasm_i32x4_extract_lane(m_value, 2))); }
+	u8 get_g() const { return u8(u32(wasm_i32x4_extract_lane(m_value, 1))); }
+	u8 get_b() const { return u8(u32(wasm_i32x4_extract_lane(m_value, 0))); }
+
+	s32 get_a32() const { return wasm_i32x4_extract_lane(m_value, 3); }
+	s32 get_r32() const { return wasm_i32x4_extract_lane(m_value, 2); }
+	s32 get_g32() const { return wasm_i32x4_extract_lane(m_value, 1); }
+	s32 get_b32() const { return wasm_i32x4_extract_lane(m_value, 0); }
+
+	// These selects return an rgbaint_t with all fields set to the element choosen (a, r, g, or b)
+	rgbaint_t select_alpha32() const { return rgbaint_t(wasm_i32x4_shuffle(m_value, m_value, 3, 3, 3, 3)); }
+	rgbaint_t select_red32() const { return rgbaint_t(wasm_i32x4_shuffle(m_value, m_value, 2, 2, 2, 2)); }
+	rgbaint_t select_green32() const { return rgbaint_t(wasm_i32x4_shuffle(m_value, m_value, 1, 1, 1, 1)); }
+	rgbaint_t select_blue32() const { return rgbaint_t(wasm_i32x4_shuffle(m_value, m_value, 0, 0, 0, 0)); }
+
+	inline void add(const rgbaint_t& color2)
+	{
+		m_value = wasm_i32x4_add(m_value, color2.m_value);
+	}
+
+	inline void add_imm(const s32 imm)
+	{
+		m_value = wasm_i32x4_add(m_value, wasm_i32x4_splat(imm));
+	}
+
+	inline void add_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		m_value = wasm_i32x4_add(m_value, wasm_i32x4_make(b, g, r, a));
+	}
+
+	inline void sub(const rgbaint_t& color2)
+	{
+		m_value = wasm_i32x4_sub(m_value, color2.m_value);
+	}
+
+	inline void sub_imm(const s32 imm)
+	{
+		m_value = wasm_i32x4_sub(m_value, wasm_i32x4_splat(imm));
+	}
+
+	inline void sub_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		m_value = wasm_i32x4_sub(m_value, wasm_i32x4_make(b, g, r, a));
+	}
+
+	inline void subr(const rgbaint_t& color2)
+	{
+		m_value = wasm_i32x4_sub(color2.m_value, m_value);
+	}
+
+	inline void subr_imm(const s32 imm)
+	{
+		m_value = wasm_i32x4_sub(wasm_i32x4_splat(imm), m_value);
+	}
+
+	inline void subr_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		m_value = wasm_i32x4_sub(wasm_i32x4_make(b, g, r, a), m_value);
+	}
+
+	inline void mul(const rgbaint_t& color)
+	{
+		m_value = wasm_i32x4_mul(m_value, color.m_value);
+	}
+
+	inline void mul_imm(const s32 imm)
+	{
+		m_value = wasm_i32x4_mul(m_value, wasm_i32x4_splat(imm));
+	}
+
+	inline void mul_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		m_value = wasm_i32x4_mul(m_value, wasm_i32x4_make(b, g, r, a));
+	}
+
+	// WebAssembly only has uniform shifts, and takes the count modulo 32,
+	// so per-element and out-of-range shifts are done a bit at a time
+	inline void shl(const rgbaint_t& shift)
+	{
+		set(
+				(u32(shift.get_a32()) > 31) ? 0 : (get_a32() << shift.get_a32()),
+				(u32(shift.get_r32()) > 31) ? 0 : (get_r32() << shift.get_r32()),
+				(u32(shift.get_g32()) > 31) ? 0 : (get_g32() << shift.get_g32()),
+				(u32(shift.get_b32()) > 31) ? 0 : (get_b32() << shift.get_b32()));
+	}
+
+	inline void shl_imm(const u8 shift)
+	{
+		m_value = (shift > 31) ? wasm_i32x4_splat(0) : wasm_i32x4_shl(m_value, shift);
+	}
+
+	inline void shr(const rgbaint_t& shift)
+	{
+		set(
+				(u32(shift.get_a32()) > 31) ? 0 : s32(u32(get_a32()) >> shift.get_a32()),
+				(u32(shift.get_r32()) > 31) ? 0 : s32(u32(get_r32()) >> shift.get_r32()),
+				(u32(shift.get_g32()) > 31) ? 0 : s32(u32(get_g32()) >> shift.get_g32()),
+				(u32(shift.get_b32()) > 31) ? 0 : s32(u32(get_b32()) >> shift.get_b32()));
+	}
+
+	inline void shr_imm(const u8 shift)
+	{
+		m_value = (shift > 31) ? wasm_i32x4_splat(0) : wasm_u32x4_shr(m_value, shift);
+	}
+
+	inline void sra(const rgbaint_t& shift)
+	{
+		set(
+				get_a32() >> ((u32(shift.get_a32()) > 31) ? 31 : shift.get_a32()),
+				get_r32() >> ((u32(shift.get_r32()) > 31) ? 31 : shift.get_r32()),
+				get_g32() >> ((u32(shift.get_g32()) > 31) ? 31 : shift.get_g32()),
+				get_b32() >> ((u32(shift.get_b32()) > 31) ? 31 : shift.get_b32()));
+	}
+
+	inline void sra_imm(const u8 shift)
+	{
+		m_value = wasm_i32x4_shr(m_value, (shift > 31) ? 31 : shift);
+	}
+
+	void or_reg(const rgbaint_t& color2) { m_value = wasm_v128_or(m_value, color2.m_value); }
+	void and_reg(const rgbaint_t& color2) { m_value = wasm_v128_and(m_value, color2.m_value); }
+	void xor_reg(const rgbaint_t& color2) { m_value = wasm_v128_xor(m_value, color2.m_value); }
+
+	void andnot_reg(const rgbaint_t& color2) { m_value = wasm_v128_andnot(m_value, color2.m_value); }
+
+	void or_imm(s32 value) { m_value = wasm_v128_or(m_value, wasm_i32x4_splat(value)); }
+	void and_imm(s32 value) { m_value = wasm_v128_and(m_value, wasm_i32x4_splat(value)); }
+	void xor_imm(s32 value) { m_value = wasm_v128_xor(m_value, wasm_i32x4_splat(value)); }
+
+	void or_imm_rgba(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_v128_or(m_value, wasm_i32x4_make(b, g, r, a)); }
+	void and_imm_rgba(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_v128_and(m_value, wasm_i32x4_make(b, g, r, a)); }
+	void xor_imm_rgba(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_v128_xor(m_value, wasm_i32x4_make(b, g, r, a)); }
+
+	inline void clamp_and_clear(const u32 sign)
+	{
+		v128_t vsign = wasm_i32x4_splat(sign);
+		m_value = wasm_v128_and(m_value, wasm_i32x4_eq(wasm_v128_and(m_value, vsign), wasm_i32x4_splat(0)));
+		vsign = wasm_v128_not(wasm_i32x4_shr(vsign, 1));
+		m_value = wasm_v128_bitselect(vsign, m_value, wasm_i32x4_gt(m_value, vsign));
+	}
+
+	inline void clamp_to_uint8()
+	{
+		m_value = expand(u32(wasm_i32x4_extract_lane(pack(m_value), 0)));
+	}
+
+	inline void sign_extend(const u32 compare, const u32 sign)
+	{
+		v128_t const compare_vec = wasm_i32x4_splat(compare);
+		v128_t const compare_mask = wasm_i32x4_eq(wasm_v128_and(m_value, compare_vec), compare_vec);
+		m_value = wasm_v128_or(m_value, wasm_v128_and(wasm_i32x4_splat(sign), compare_mask));
+	}
+
+	inline void min(const s32 value)
+	{
+		m_value = wasm_i32x4_min(m_value, wasm_i32x4_splat(value));
+	}
+
+	inline void max(const s32 value)
+	{
+		m_value = wasm_i32x4_max(m_value, wasm_i32x4_splat(value));
+	}
+
+	void blend(const rgbaint_t& other, u8 factor);
+
+	void scale_and_clamp(const rgbaint_t& scale);
+
+	inline void scale_imm_and_clamp(const s32 scale)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other)
+	{
+		mul(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale2_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other, const rgbaint_t& scale2)
+	{
+		m_value = wasm_i32x4_add(wasm_i32x4_mul(m_value, scale.m_value), wasm_i32x4_mul(other.m_value, scale2.m_value));
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	void cmpeq(const rgbaint_t& value) { m_value = wasm_i32x4_eq(m_value, value.m_value); }
+	void cmpgt(const rgbaint_t& value) { m_value = wasm_i32x4_gt(m_value, value.m_value); }
+	void cmplt(const rgbaint_t& value) { m_value = wasm_i32x4_lt(m_value, value.m_value); }
+
+	void cmpeq_imm(s32 value) { m_value = wasm_i32x4_eq(m_value, wasm_i32x4_splat(value)); }
+	void cmpgt_imm(s32 value) { m_value = wasm_i32x4_gt(m_value, wasm_i32x4_splat(value)); }
+	void cmplt_imm(s32 value) { m_value = wasm_i32x4_lt(m_value, wasm_i32x4_splat(value)); }
+
+	void cmpeq_imm_rgba(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_i32x4_eq(m_value, wasm_i32x4_make(b, g, r, a)); }
+	void cmpgt_imm_rgba(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_i32x4_gt(m_value, wasm_i32x4_make(b, g, r, a)); }
+	void cmplt_imm_rgba(s32 a, s32 r, s32 g, s32 b) { m_value = wasm_i32x4_lt(m_value, wasm_i32x4_make(b, g, r, a)); }
+
+	inline rgbaint_t& operator+=(const rgbaint_t& other)
+	{
+		m_value = wasm_i32x4_add(m_value, other.m_value);
+		return *this;
+	}
+
+	inline rgbaint_t& operator+=(const s32 other)
+	{
+		m_value = wasm_i32x4_add(m_value, wasm_i32x4_splat(other));
+		return *this;
+	}
+
+	inline rgbaint_t& operator-=(const rgbaint_t& other)
+	{
+		m_value = wasm_i32x4_sub(m_value, other.m_value);
+		return *this;
+	}
+
+	inline rgbaint_t& operator*=(const rgbaint_t& other)
+	{
+		m_value = wasm_i32x4_mul(m_value, other.m_value);
+		return *this;
+	}
+
+	inline rgbaint_t& operator*=(const s32 other)
+	{
+		m_value = wasm_i32x4_mul(m_value, wasm_i32x4_splat(other));
+		return *this;
+	}
+
+	inline rgbaint_t& operator>>=(const s32 shift)
+	{
+		sra_imm(shift);
+		return *this;
+	}
+
+	inline void merge_alpha16(const rgbaint_t& alpha)
+	{
+		m_value = wasm_i16x8_replace_lane(m_value, 6, wasm_i16x8_extract_lane(alpha.m_value, 6));
+	}
+
+	inline void merge_alpha(const rgbaint_t& alpha)
+	{
+		m_value = wasm_i32x4_replace_lane(m_value, 3, wasm_i32x4_extract_lane(alpha.m_value, 3));
+	}
+
+	static u32 bilinear_filter(u32 rgb00, u32 rgb01, u32 rgb10, u32 rgb11, u8 u, u8 v)
+	{
+		return u32(wasm_i32x4_extract_lane(pack(bilinear(rgb00, rgb01, rgb10, rgb11, u, v)), 0));
+	}
+
+	void bilinear_filter_rgbaint(u32 rgb00, u32 rgb01, u32 rgb10, u32 rgb11, u8 u, u8 v)
+	{
+		m_value = bilinear(rgb00, rgb01, rgb10, rgb11, u, v);
+	}
+
+protected:
+	// unpack bytes to 32-bit elements
+	static v128_t expand(u32 rgba)
+	{
+		return wasm_u32x4_extend_low_u16x8(wasm_u16x8_extend_low_u8x16(wasm_i32x4_splat(rgba)));
+	}
+
+	// saturate elements to bytes, packed into the low 32 bits
+	static v128_t pack(v128_t value)
+	{
+		v128_t const zero = wasm_i32x4_splat(0);
+		return wasm_u8x16_narrow_i16x8(wasm_i16x8_narrow_i32x4(value, zero), zero);
+	}
+
+	// interpolate horizontally keeping 15 bits, then vertically
+	static v128_t bilinear(u32 rgb00, u32 rgb01, u32 rgb10, u32 rgb11, u8 u, u8 v)
+	{
+		v128_t const u1 = wasm_i32x4_splat(u);
+		v128_t const u0 = wasm_i32x4_splat(256 - u);
+		v128_t const top = wasm_u32x4_shr(wasm_i32x4_add(wasm_i32x4_mul(expand(rgb00), u0), wasm_i32x4_mul(expand(rgb01), u1)), 1);
+		v128_t const bottom = wasm_u32x4_shr(wasm_i32x4_add(wasm_i32x4_mul(expand(rgb10), u0), wasm_i32x4_mul(expand(rgb11), u1)), 1);
+		return wasm_u32x4_shr(wasm_i32x4_add(wasm_i32x4_mul(top, wasm_i32x4_splat(256 - v)), wasm_i32x4_mul(bottom, wasm_i32x4_splat(v))), 15);
+	}
+
+	v128_t m_value;
+};
+
+#endif // MAME_EMU_VIDEO_RGBWASM_H
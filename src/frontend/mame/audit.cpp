@@ -16,6 +16,7 @@
 #include "emuopts.h"
 #include "drivenum.h"
 #include "fileio.h"
+#include "hashcache.h"
 #include "romload.h"
 #include "softlist_dev.h"
 
@@ -200,9 +201,10 @@ public:
 //  media_auditor - constructor
 //-------------------------------------------------
 
-media_auditor::media_auditor(const driver_enumerator &enumerator)
+media_auditor::media_auditor(const driver_enumerator &enumerator, hash_cache *hashes)
 	: m_enumerator(enumerator)
 	, m_validation(AUDIT_VALIDATE_FULL)
+	, m_hash_cache(hashes)
 {
 }
 
@@ -634,7 +636,7 @@ media_auditor::audit_record &media_auditor::audit_one_rom(const std::vector<std:
 
 	// if it worked, get the actual length and hashes, then stop
 	if (!filerr)
-		record.set_actual(file.hashes(m_validation), file.size());
+		record.set_actual(m_hash_cache ? m_hash_cache->hashes(file, m_validation) : file.hashes(m_validation), file.size());
 
 	// compute the final status
 	compute_status(record, rom, record.actual_length() != 0);
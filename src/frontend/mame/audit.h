@@ -148,7 +148,7 @@ public:
 	using record_list = std::list<audit_record>;
 
 	// construction/destruction
-	media_auditor(const driver_enumerator &enumerator);
+	media_auditor(const driver_enumerator &enumerator, hash_cache *hashes = nullptr);
 
 	// getters
 	const record_list &records() const { return m_record_list; }
@@ -171,6 +171,7 @@ private:
 	record_list                 m_record_list;
 	const driver_enumerator &   m_enumerator;
 	const char *                m_validation;
+	hash_cache *                m_hash_cache;
 };
 
 
@@ -24,6 +24,7 @@
 
 #include "emuopts.h"
 #include "fileio.h"
+#include "hashcache.h"
 #include "romload.h"
 #include "softlist_dev.h"
 #include "validity.h"
@@ -31,6 +32,7 @@
 
 #include "chd.h"
 #include "corestr.h"
+#include "hash.h"
 #include "path.h"
 #include "unzip.h"
 #include "xmlfile.h"
@@ -38,10 +40,16 @@
 #include "osdepend.h"
 
 #include <algorithm>
+#include <atomic>
 #include <new>
 #include <set>
+#include <sstream>
+#include <thread>
 #include <tuple>
 #include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 
 
@@ -52,6 +60,7 @@
 // core commands
 #define CLICOMMAND_HELP                 "help"
 #define CLICOMMAND_VALIDATE             "validate"
+#define CLICOMMAND_BATCH                "batch"
 
 // configuration commands
 #define CLICOMMAND_CREATECONFIG         "createconfig"
@@ -82,10 +91,15 @@
 
 // command options
 #define CLIOPTION_DTD                   "dtd"
+#define CLIOPTION_XML_CACHE             "xmlcache"
 
 
 namespace {
 
+// options given on a batch job line override those on the command line,
+// and are reverted before the next job
+constexpr int OPTION_PRIORITY_BATCH_JOB = OPTION_PRIORITY_CMDLINE + 1;
+
 //**************************************************************************
 //  COMMAND-LINE OPTIONS
 //**************************************************************************
@@ -96,6 +110,7 @@ const options_entry cli_option_entries[] =
 	{ nullptr,                              nullptr,   core_options::option_type::HEADER,     "CORE COMMANDS" },
 	{ CLICOMMAND_HELP           ";h;?",     "0",       core_options::option_type::COMMAND,    "show help message" },
 	{ CLICOMMAND_VALIDATE       ";valid",   "0",       core_options::option_type::COMMAND,    "perform validation on system drivers and devices" },
+	{ CLICOMMAND_BATCH,                     "0",       core_options::option_type::COMMAND,    "run each line of a job list file as a separate emulation session" },
 
 	/* configuration commands */
 	{ nullptr,                              nullptr,   core_options::option_type::HEADER,     "CONFIGURATION COMMANDS" },
@@ -128,15 +143,17 @@ const options_entry cli_option_entries[] =
 
 	{ nullptr,                              nullptr,   core_options::option_type::HEADER,     "FRONTEND COMMAND OPTIONS" },
 	{ CLIOPTION_DTD,                        "1",       core_options::option_type::BOOLEAN,    "include DTD in XML output" },
+	{ CLIOPTION_XML_CACHE,                  "",        core_options::option_type::PATH,       "directory to keep the full -listxml output in, so it's only generated once for each build" },
 	{ nullptr }
 };
 
 
+// prints the result of auditing a set, given the report from
+// media_auditor::summarize, and counts it
 void print_summary(
-		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		std::string_view report, media_auditor::summary summary, bool record_none_needed,
 		const char *type, const char *name, const char *parent,
-		unsigned &correct, unsigned &incorrect, unsigned &notfound,
-		util::ovectorstream &buffer)
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
 {
 	if (summary == media_auditor::NOTFOUND)
 	{
@@ -146,11 +163,7 @@ void print_summary(
 	else if (record_none_needed || (summary != media_auditor::NONE_NEEDED))
 	{
 		// output the summary of the audit
-		buffer.clear();
-		buffer.seekp(0);
-		auditor.summarize(name, &buffer);
-		buffer.put('\0');
-		osd_printf_info("%s", &buffer.vec()[0]);
+		osd_printf_info("%s", report);
 
 		// output the name of the driver and its parent
 		osd_printf_info("%sset %s ", type, name);
@@ -185,6 +198,67 @@ void print_summary(
 	}
 }
 
+
+void print_summary(
+		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *type, const char *name, const char *parent,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound,
+		util::ovectorstream &buffer)
+{
+	std::string_view report;
+	if ((summary != media_auditor::NOTFOUND) && (record_none_needed || (summary != media_auditor::NONE_NEEDED)))
+	{
+		buffer.clear();
+		buffer.seekp(0);
+		auditor.summarize(name, &buffer);
+		buffer.put('\0');
+		report = &buffer.vec()[0];
+	}
+	print_summary(report, summary, record_none_needed, type, name, parent, correct, incorrect, notfound);
+}
+
+
+// the hash cache shared by every set audited by a command, if there is one
+std::unique_ptr<hash_cache> open_hash_cache(emu_options const &options)
+{
+	if (!*options.hash_cache())
+		return nullptr;
+	return std::make_unique<hash_cache>(options.hash_cache());
+}
+
+
+// splits a batch job line into arguments at whitespace, keeping anything
+// in double quotes together
+std::vector<std::string> split_job_line(std::string_view line)
+{
+	std::vector<std::string> result;
+	std::string current;
+	bool inarg = false, quoted = false;
+	for (char const ch : line)
+	{
+		if (ch == '"')
+		{
+			quoted = !quoted;
+			inarg = true;
+		}
+		else if (!quoted && std::isspace(u8(ch)))
+		{
+			if (inarg)
+				result.emplace_back(std::move(current));
+			current.clear();
+			inarg = false;
+		}
+		else
+		{
+			current.push_back(ch);
+			inarg = true;
+		}
+	}
+	if (inarg)
+		result.emplace_back(std::move(current));
+	return result;
+}
+
 } // anonymous namespace
 
 
@@ -244,8 +318,10 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 	// determine the base name of the EXE
 	std::string_view exename = core_filename_extract_base(args[0], true);
 
-	// if we have a command, execute that
-	if (!m_options.command().empty())
+	// if we have a command, execute that; batches run machines so they need
+	// the same setup as a single system
+	bool const batch = (m_options.command() == CLICOMMAND_BATCH);
+	if (!m_options.command().empty() && !batch)
 	{
 		execute_commands(exename);
 		return;
@@ -268,6 +344,12 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 	if (option_errors.tellp() > 0)
 		osd_printf_error("Error in command line:\n%s\n", strtrimspace(option_errors.str()));
 
+	if (batch)
+	{
+		run_batch(manager, args);
+		return;
+	}
+
 	// if we can't find it, give an appropriate error
 	const game_driver *system = mame_options::system(m_options);
 	if (system == nullptr && *(m_options.system_name()) != 0)
@@ -357,6 +439,97 @@ int cli_frontend::execute(std::vector<std::string> &args)
 }
 
 
+//-------------------------------------------------
+//  run_batch - run every job in a list one after
+//  another, sharing the process, the Lua engine
+//  and the open archive cache between them
+//-------------------------------------------------
+
+void cli_frontend::run_batch(mame_machine_manager *manager, const std::vector<std::string> &args)
+{
+	if (m_options.command_arguments().size() != 1)
+		throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "Error: -%s expects the name of a job list file\n", CLICOMMAND_BATCH);
+	std::string const listname = m_options.command_arguments()[0];
+
+	// read the whole list first so a missing file fails before anything runs;
+	// blank lines and lines starting with # are ignored
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(listname, OPEN_FLAG_READ, file);
+	if (filerr)
+		throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "Error opening job list file %s (%s)\n", listname, filerr.message());
+
+	std::vector<std::pair<unsigned, std::vector<std::string> > > jobs;
+	char buffer[4096];
+	for (unsigned linenum = 1; file->gets(buffer, std::size(buffer)); linenum++)
+	{
+		std::string_view const line = strtrimspace(std::string_view(buffer));
+		if (!line.empty() && (line[0] != '#'))
+			jobs.emplace_back(linenum, split_job_line(line));
+	}
+	file.reset();
+
+	unsigned failed = 0;
+	for (auto const &[linenum, jobargs] : jobs)
+	{
+		osd_printf_info("%s line %u:", listname, linenum);
+		for (std::string const &arg : jobargs)
+			osd_printf_info(" %s", arg);
+		osd_printf_info("\n");
+
+		// start from the options on the command line each time
+		m_options.revert(OPTION_PRIORITY_MAXIMUM, OPTION_PRIORITY_BATCH_JOB);
+		int error = EMU_ERR_NONE;
+		try
+		{
+			std::vector<std::string> cmdline;
+			cmdline.reserve(jobargs.size() + 1);
+			cmdline.emplace_back(args[0]);
+			cmdline.insert(cmdline.end(), jobargs.begin(), jobargs.end());
+			try
+			{
+				m_options.parse_command_line(cmdline, OPTION_PRIORITY_BATCH_JOB);
+			}
+			catch (options_warning_exception &ex)
+			{
+				osd_printf_error("%s", ex.message());
+			}
+
+			if (!m_options.command().empty())
+				throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "Commands can't be run as batch jobs (-%s)", m_options.command());
+			if (!mame_options::system(m_options))
+			{
+				if (*m_options.system_name())
+					throw emu_fatalerror(EMU_ERR_NO_SUCH_SYSTEM, "Unknown system '%s'", m_options.system_name());
+				else
+					throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "No system given");
+			}
+
+			error = manager->execute();
+		}
+		catch (options_exception &ex)
+		{
+			osd_printf_error("%s", ex.message());
+			error = EMU_ERR_INVALID_CONFIG;
+		}
+		catch (emu_fatalerror &fatal)
+		{
+			osd_printf_error("%s\n", strtrimspace(fatal.what()));
+			error = (fatal.exitcode() != 0) ? fatal.exitcode() : EMU_ERR_FATALERROR;
+		}
+
+		if (error != EMU_ERR_NONE)
+		{
+			osd_printf_error("%s line %u failed (error %d)\n", listname, linenum, error);
+			m_result = error;
+			++failed;
+		}
+	}
+	m_options.revert(OPTION_PRIORITY_MAXIMUM, OPTION_PRIORITY_BATCH_JOB);
+
+	osd_printf_info("%u batch jobs run, %u failed\n", unsigned(jobs.size()), failed);
+}
+
+
 //-------------------------------------------------
 //  listxml - output the XML data for one or more
 //  games
@@ -364,12 +537,70 @@ int cli_frontend::execute(std::vector<std::string> &args)
 
 void cli_frontend::listxml(const std::vector<std::string> &args)
 {
+	bool const dtd = m_options.bool_value(CLIOPTION_DTD);
+
+	// the full list only changes with the build, so it can be kept
+	char const *const cachedir = m_options.value(CLIOPTION_XML_CACHE);
+	if (args.empty() && *cachedir)
+	{
+		u32 const version = util::crc32_creator::simple(emulator_info::get_build_version(), std::strlen(emulator_info::get_build_version()));
+		std::string const path = util::string_format("%s" PATH_SEPARATOR "listxml-%08x%s.xml", cachedir, version, dtd ? "" : "-nodtd");
+		if (copy_cached_xml(path))
+			return;
+
+		// generate it under a private name and rename it once it's complete
+		std::string const temp = util::string_format("%s.%d.tmp", path, osd_getpid());
+		util::core_file::ptr file;
+		if (!util::core_file::open(temp, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file))
+		{
+			file.reset();
+			bool written;
+			{
+				std::ofstream out(temp, std::ios::out | std::ios::binary | std::ios::trunc);
+				info_xml_creator creator(m_options, dtd);
+				creator.output(out, args);
+				out.close();
+				written = bool(out);
+			}
+			if (written && !std::rename(temp.c_str(), path.c_str()) && copy_cached_xml(path))
+				return;
+			osd_file::remove(temp);
+		}
+		osd_printf_verbose("Couldn't keep XML output in %s\n", path);
+	}
+
 	// create the XML and print it to stdout
-	info_xml_creator creator(m_options, m_options.bool_value(CLIOPTION_DTD));
+	info_xml_creator creator(m_options, dtd);
 	creator.output(std::cout, args);
 }
 
 
+//-------------------------------------------------
+//  copy_cached_xml - copy XML output kept from an
+//  earlier run to stdout
+//-------------------------------------------------
+
+bool cli_frontend::copy_cached_xml(const std::string &path)
+{
+	util::core_file::ptr file;
+	if (util::core_file::open(path, OPEN_FLAG_READ, file))
+		return false;
+
+	char buffer[65536];
+	for (;;)
+	{
+		auto const [err, actual] = util::read(*file, buffer, sizeof(buffer));
+		if (err)
+			throw emu_fatalerror(EMU_ERR_FATALERROR, "Error reading cached XML output %s (%s)", path, err.message());
+		if (!actual)
+			break;
+		std::cout.write(buffer, actual);
+	}
+	std::cout.flush();
+	return true;
+}
+
+
 //-------------------------------------------------
 //  listfull - output the name and description of
 //  one or more games
@@ -991,23 +1222,14 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// find the systems to audit
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<int> systems;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			systems.push_back(drivlist.current());
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -1015,6 +1237,50 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// audit them on a thread per processor, each with its own enumerator and
+	// auditor; the archive and hash caches are shared
+	std::unique_ptr<hash_cache> const hashes(open_hash_cache(m_options));
+	std::vector<std::pair<media_auditor::summary, std::string> > results(systems.size());
+	std::atomic<std::size_t> next(0);
+	auto const audit_systems =
+		[this, &systems, &results, &next, &hashes] ()
+		{
+			driver_enumerator enumerator(m_options);
+			media_auditor auditor(enumerator, hashes.get());
+			for (std::size_t index = next++; systems.size() > index; index = next++)
+			{
+				enumerator.set_current(systems[index]);
+				media_auditor::summary const summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
+				results[index].first = summary;
+				if (summary != media_auditor::NOTFOUND)
+				{
+					std::ostringstream report;
+					auditor.summarize(enumerator.driver().name, &report);
+					results[index].second = std::move(report).str();
+				}
+			}
+		};
+	std::vector<std::thread> threads(std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), systems.size()) - (systems.empty() ? 0 : 1));
+	for (std::thread &thread : threads)
+		thread = std::thread(audit_systems);
+	audit_systems();
+	for (std::thread &thread : threads)
+		thread.join();
+
+	// report them in order
+	for (std::size_t index = 0; systems.size() > index; index++)
+	{
+		auto const clone_of = driver_list::clone(systems[index]);
+		print_summary(
+				results[index].second, results[index].first, true,
+				"rom", driver_list::driver(systems[index]).name, (clone_of >= 0) ? driver_list::driver(clone_of).name : nullptr,
+				correct, incorrect, notfound);
+	}
+	results.clear();
+
+	media_auditor auditor(drivlist, hashes.get());
+	util::ovectorstream summary_string;
+
 	if (iswild || !matchcount)
 	{
 		machine_config config(GAME_NAME(___empty), m_options);
@@ -1043,6 +1309,8 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 
 	// clear out any cached files
 	util::archive_file::cache_clear();
+	if (hashes)
+		hashes->save();
 
 	// return an error if none found
 	auto it = matched.begin();
@@ -1375,7 +1643,8 @@ void cli_frontend::verifysoftware(const std::vector<std::string> &args)
 	unsigned notfound = 0;
 	unsigned nrlists = 0;
 
-	media_auditor auditor(drivlist);
+	std::unique_ptr<hash_cache> const hashes(open_hash_cache(m_options));
+	media_auditor auditor(drivlist, hashes.get());
 	util::ovectorstream summary_string;
 	while (drivlist.next())
 	{
@@ -1406,6 +1675,8 @@ void cli_frontend::verifysoftware(const std::vector<std::string> &args)
 
 	// clear out any cached files
 	util::archive_file::cache_clear();
+	if (hashes)
+		hashes->save();
 
 	// return an error if none found
 	if (!nrlists)
@@ -1482,7 +1753,8 @@ void cli_frontend::verifysoftlist(const std::vector<std::string> &args)
 	unsigned matched = 0;
 
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
+	std::unique_ptr<hash_cache> const hashes(open_hash_cache(m_options));
+	media_auditor auditor(drivlist, hashes.get());
 	util::ovectorstream summary_string;
 
 	while (drivlist.next())
@@ -1513,6 +1785,8 @@ void cli_frontend::verifysoftlist(const std::vector<std::string> &args)
 
 	// clear out any cached files
 	util::archive_file::cache_clear();
+	if (hashes)
+		hashes->save();
 
 	// return an error if none found
 	if (matched == 0)
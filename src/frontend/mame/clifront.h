@@ -74,7 +74,9 @@ private:
 	void execute_commands(std::string_view exename);
 	void display_help(std::string_view exename);
 	void output_single_softlist(std::ostream &out, software_list_device &swlist);
+	bool copy_cached_xml(const std::string &path);
 	void start_execution(mame_machine_manager *manager, const std::vector<std::string> &args);
+	void run_batch(mame_machine_manager *manager, const std::vector<std::string> &args);
 	static const info_command_struct *find_command(const std::string &s);
 
 	// internal state
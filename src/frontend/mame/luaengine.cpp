@@ -18,10 +18,13 @@
 
 #include "imagedev/cassette.h"
 
+#include "benchlog.h"
+#include "coverage.h"
 #include "debugger.h"
 #include "drivenum.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "footprint.h"
 #include "inputdev.h"
 #include "natkeyboard.h"
 #include "screen.h"
@@ -477,6 +480,9 @@ lua_engine::lua_engine()
 	: m_lua_state(nullptr)
 	, m_machine(nullptr)
 	, m_timer(nullptr)
+	, m_frame_budget(0)
+	, m_budget_warned(0)
+	, m_timing_frames(0)
 {
 	m_lua_state = luaL_newstate();  // create state
 	m_sol_state = std::make_unique<sol::state_view>(m_lua_state); // create sol view
@@ -605,13 +611,22 @@ size_t lua_engine::enumerate_functions(const char *id, T &&callback)
 	return count;
 }
 
-bool lua_engine::execute_function(const char *id)
+bool lua_engine::execute_function(const char *id, bool timed)
 {
 	size_t count = enumerate_functions(
 			id,
-			[this] (const sol::protected_function &func)
+			[this, timed] (const sol::protected_function &func)
 			{
+				osd_ticks_t const start = timed ? osd_ticks() : 0;
 				auto ret = invoke(func);
+				if (timed)
+				{
+					callback_timing &timing = get_callback_timing(func);
+					osd_ticks_t const elapsed = osd_ticks() - start;
+					timing.total += elapsed;
+					timing.frame += elapsed;
+					timing.shown += elapsed;
+				}
 				if (!ret.valid())
 				{
 					sol::error err = ret;
@@ -622,6 +637,80 @@ bool lua_engine::execute_function(const char *id)
 	return count > 0;
 }
 
+lua_engine::callback_timing &lua_engine::get_callback_timing(const sol::protected_function &func)
+{
+	auto found = m_callback_timings.find(func.pointer());
+	if (m_callback_timings.end() != found)
+		return found->second;
+
+	// name it after where it was defined, as plugins don't name their callbacks
+	callback_timing &timing = m_callback_timings[func.pointer()];
+	lua_Debug ar;
+	func.push();
+	lua_getinfo(m_lua_state, ">S", &ar);
+	timing.name = util::string_format("%s:%d", ar.short_src, ar.linedefined);
+
+	// the log only takes counters before the first frame is complete
+	if (bench_log_manager *const bench_log = m_machine ? machine().bench_log() : nullptr)
+	{
+		osd_ticks_t const tps = osd_ticks_per_second();
+		bench_log->add_counter("lua:" + timing.name + ":us", [&timing, tps] () -> u64 { return timing.total * 1'000'000 / tps; });
+	}
+	return timing;
+}
+
+void lua_engine::end_timing_frame()
+{
+	// warn about frames over budget, but not more than once a second
+	osd_ticks_t used = 0;
+	callback_timing const *worst = nullptr;
+	for (auto &timing : m_callback_timings)
+	{
+		used += timing.second.frame;
+		if (!worst || (timing.second.frame > worst->frame))
+			worst = &timing.second;
+	}
+	if (m_frame_budget && (used > m_frame_budget))
+	{
+		osd_ticks_t const now = osd_ticks();
+		osd_ticks_t const tps = osd_ticks_per_second();
+		if (!m_budget_warned || ((now - m_budget_warned) >= tps))
+		{
+			osd_printf_warning(
+					"Lua frame callbacks took %.2f ms, over the %.2f ms budget (%.2f ms in %s)\n",
+					double(used) * 1000.0 / double(tps),
+					double(m_frame_budget) * 1000.0 / double(tps),
+					double(worst->frame) * 1000.0 / double(tps),
+					worst->name);
+			m_budget_warned = now;
+		}
+	}
+	for (auto &timing : m_callback_timings)
+		timing.second.frame = 0;
+
+	// refresh the text shown with the profiler a couple of times a second
+	if (++m_timing_frames >= 30)
+	{
+		std::vector<callback_timing const *> sorted;
+		sorted.reserve(m_callback_timings.size());
+		for (auto &timing : m_callback_timings)
+			sorted.emplace_back(&timing.second);
+		std::sort(
+				sorted.begin(),
+				sorted.end(),
+				[] (callback_timing const *a, callback_timing const *b) { return a->shown > b->shown; });
+
+		double const scale = 1000.0 / (double(osd_ticks_per_second()) * double(m_timing_frames));
+		m_timing_text.clear();
+		for (callback_timing const *timing : sorted)
+			m_timing_text.append(util::string_format("%.3f ms/frame Lua %s\n", double(timing->shown) * scale, timing->name));
+
+		for (auto &timing : m_callback_timings)
+			timing.second.shown = 0;
+		m_timing_frames = 0;
+	}
+}
+
 void lua_engine::register_function(sol::function func, const char *id)
 {
 	sol::object functable = sol().registry()[id];
@@ -683,7 +772,7 @@ void lua_engine::on_machine_frame()
 
 	m_notifiers->on_frame();
 
-	execute_function("LUA_ON_FRAME");
+	execute_function("LUA_ON_FRAME", true);
 }
 
 void lua_engine::on_machine_presave()
@@ -713,7 +802,7 @@ void lua_engine::on_sound_update()
 
 void lua_engine::on_periodic()
 {
-	execute_function("LUA_ON_PERIODIC");
+	execute_function("LUA_ON_PERIODIC", true);
 }
 
 bool lua_engine::on_missing_mandatory_image(const std::string &instance_name)
@@ -751,6 +840,13 @@ void lua_engine::attach_notifiers()
 	machine().save().register_postload(save_prepost_delegate(FUNC(lua_engine::on_machine_postload), this));
 
 	m_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(lua_engine::resume), this));
+
+	// counters registered with the previous machine's benchmark log are gone with it
+	m_callback_timings.clear();
+	m_frame_budget = osd_ticks_t(double(machine().options().lua_frame_budget()) * double(osd_ticks_per_second()) / 1000.0);
+	m_budget_warned = 0;
+	m_timing_frames = 0;
+	m_timing_text.clear();
 }
 
 //-------------------------------------------------
@@ -1382,6 +1478,39 @@ void lua_engine::initialize()
 	core_options_entry_type.set("has_range", &core_options::entry::has_range);
 
 
+	auto coverage_type = sol().registry().new_usertype<coverage_manager>("coverage", sol::no_constructor);
+	coverage_type.set_function("save", &coverage_manager::save);
+	coverage_type.set_function("clear", &coverage_manager::clear);
+	coverage_type.set_function("count",
+			[] (coverage_manager &cov, std::string const &tag) -> std::optional<u64>
+			{
+				device_t *const device = cov.machine().root_device().subdevice(tag);
+				device_execute_interface *exec;
+				if (!device || !device->interface(exec) || !exec->coverage())
+					return std::nullopt;
+				return exec->coverage()->count();
+			});
+	coverage_type.set_function("pcs",
+			[] (coverage_manager &cov, sol::this_state s, std::string const &tag) -> sol::object
+			{
+				device_t *const device = cov.machine().root_device().subdevice(tag);
+				device_execute_interface *exec;
+				if (!device || !device->interface(exec) || !exec->coverage())
+					return sol::lua_nil;
+				auto const &map = *exec->coverage();
+				sol::table result = sol::state_view(s).create_table();
+				int index = 1;
+				for (offs_t page = 0; page < map.page_count(); page++)
+				{
+					u64 const *const bits = map.page(page);
+					for (unsigned word = 0; bits && (word < map.PAGE_WORDS); word++)
+						for (unsigned bit = 0; (bit < 64) && (bits[word] >> bit); bit++)
+							if (BIT(bits[word], bit))
+								result[index++] = (page << map.PAGE_SHIFT) | (word << 6) | bit;
+				}
+				return result;
+			});
+
 	auto machine_type = sol().registry().new_usertype<running_machine>("machine", sol::no_constructor);
 	machine_type.set_function("exit", &running_machine::schedule_exit);
 	machine_type.set_function("hard_reset", &running_machine::schedule_hard_reset);
@@ -1451,6 +1580,23 @@ void lua_engine::initialize()
 				else
 					return sol::lua_nil;
 			});
+	machine_type["coverage"] = sol::property(&running_machine::coverage);
+	machine_type["memory_footprint"] = sol::property(
+			[this] (running_machine &m)
+			{
+				sol::table result = sol().create_table();
+				int index = 1;
+				for (footprint_manager::usage const &usage : m.footprint().collect())
+				{
+					sol::table entry = sol().create_table();
+					entry["owner"] = usage.owner;
+					entry["kind"] = usage.kind;
+					entry["bytes"] = usage.bytes;
+					entry["counted"] = usage.counted;
+					result[index++] = entry;
+				}
+				return result;
+			});
 	machine_type["options"] = sol::property(&running_machine::options);
 	machine_type["samplerate"] = sol::property(&running_machine::sample_rate);
 	machine_type["paused"] = sol::property(&running_machine::paused);
@@ -1561,6 +1707,22 @@ void lua_engine::initialize()
 				}
 				return sp_table;
 			});
+	device_type["execute_stats"] = sol::property(
+			[this] (device_t &dev) -> sol::object
+			{
+				device_execute_interface const *exec;
+				if (!dev.interface(exec))
+					return sol::lua_nil;
+				device_execute_interface::execute_stats const &stats = exec->stats();
+				sol::table result = sol().create_table();
+				result["cycles"] = stats.cycles;
+				result["timeslices"] = stats.timeslices;
+				result["aborted_timeslices"] = stats.aborted;
+				result["wall_ns"] = u64(double(stats.wall_ticks) * 1.0e9 / double(osd_ticks_per_second()));
+				result["quantum_boosts"] = stats.quantum_boosts;
+				result["idle_skips"] = stats.idle_skips;
+				return result;
+			});
 	device_type["state"] = sol::property(
 			[] (device_t &dev, sol::this_state s) -> sol::object
 			{
@@ -2053,6 +2215,7 @@ void lua_engine::initialize()
 	video_type["throttled"] = sol::property(&video_manager::throttled, &video_manager::set_throttled);
 	video_type["throttle_rate"] = sol::property(&video_manager::throttle_rate, &video_manager::set_throttle_rate);
 	video_type["frameskip"] = sol::property(&video_manager::frameskip, &video_manager::set_frameskip);
+	video_type["turbo"] = sol::property(&video_manager::turbo, &video_manager::set_turbo);
 	video_type["speed_percent"] = sol::property(&video_manager::speed_percent);
 	video_type["effective_frameskip"] = sol::property(&video_manager::effective_frameskip);
 	video_type["skip_this_frame"] = sol::property(&video_manager::skip_this_frame);
@@ -2185,7 +2348,9 @@ bool lua_engine::frame_hook()
 	m_update_tasks.clear();
 	resume_tasks(m_lua_state, tasks, true); // TODO: doesn't need to return anything
 
-	return execute_function("LUA_ON_FRAME_DONE");
+	bool const result = execute_function("LUA_ON_FRAME_DONE", true);
+	end_timing_frame();
+	return result;
 }
 
 //-------------------------------------------------
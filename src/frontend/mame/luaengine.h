@@ -20,6 +20,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #define SOL_USING_CXX_LUA 1
@@ -54,6 +55,7 @@ public:
 	sol::environment make_environment();
 
 	bool frame_hook();
+	std::string const &callback_timing_text() const { return m_timing_text; }
 
 	std::optional<long> menu_populate(const std::string &menu, std::vector<std::tuple<std::string, std::string, std::string> > &menu_list, std::string &flags);
 	std::pair<bool, std::optional<long> > menu_callback(const std::string &menu, int index, const std::string &event);
@@ -152,6 +154,15 @@ private:
 		util::notifier<> on_postload;
 	};
 
+	// time spent in a callback run every frame
+	struct callback_timing
+	{
+		std::string name;               // where the function was defined
+		osd_ticks_t total = 0;          // ticks spent since the machine started
+		osd_ticks_t frame = 0;          // ticks spent in the current frame
+		osd_ticks_t shown = 0;          // ticks spent since the overlay text was updated
+	};
+
 	template <typename T, size_t Size> class enum_parser;
 
 	class buffer_helper;
@@ -180,6 +191,13 @@ private:
 	std::vector<int> m_update_tasks;
 	std::vector<int> m_frame_tasks;
 
+	// per-frame callback cost accounting
+	std::unordered_map<void const *, callback_timing> m_callback_timings;
+	osd_ticks_t m_frame_budget;
+	osd_ticks_t m_budget_warned;
+	unsigned m_timing_frames;
+	std::string m_timing_text;
+
 	template <typename... T>
 	auto make_notifier_adder(util::notifier<T...> &notifier, const char *desc);
 	template <typename T, typename D, typename R, typename... A>
@@ -199,7 +217,9 @@ private:
 	void resume(s32 param);
 	void register_function(sol::function func, const char *id);
 	template <typename T> size_t enumerate_functions(const char *id, T &&callback);
-	bool execute_function(const char *id);
+	bool execute_function(const char *id, bool timed = false);
+	callback_timing &get_callback_timing(const sol::protected_function &func);
+	void end_timing_frame();
 	sol::object call_plugin(const std::string &name, sol::object in);
 
 	void close();
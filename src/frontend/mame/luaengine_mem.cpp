@@ -120,6 +120,74 @@ void share_write(memory_share &share, offs_t address, T val)
 	}
 }
 
+//-------------------------------------------------
+//  read_many - read values at each address in a
+//  table into a table, reusing the destination
+//  table if one is supplied so a plugin sampling
+//  every frame doesn't create garbage
+//-------------------------------------------------
+
+template <typename T, typename F>
+sol::table read_many(sol::this_state s, sol::table const &addresses, sol::object const &dest, F &&read)
+{
+	lua_State *const L(s);
+	size_t const count(addresses.size());
+	sol::table result(dest.is<sol::table>() ? dest.as<sol::table>() : sol::table(L, sol::new_table(int(count), 0)));
+
+	// go through the Lua API directly to avoid marshalling each element
+	addresses.push(L);
+	int const addrindex(lua_absindex(L, -1));
+	result.push(L);
+	int const resultindex(lua_absindex(L, -1));
+	for (size_t i = 1; count >= i; ++i)
+	{
+		lua_rawgeti(L, addrindex, lua_Integer(i));
+		offs_t const address(offs_t(lua_tointeger(L, -1)));
+		lua_pop(L, 1);
+		lua_pushinteger(L, lua_Integer(T(read(address))));
+		lua_rawseti(L, resultindex, lua_Integer(i));
+	}
+	lua_pop(L, 2);
+
+	return result;
+}
+
+//-------------------------------------------------
+//  space_read_many - templated bulk memory readers
+//  for <sign>,<size>
+//  -> manager:machine().devices[":maincpu"].spaces["program"]:read_many_u8({ 0xC000, 0xC010 }, results)
+//-------------------------------------------------
+
+template <typename T, typename S>
+sol::table space_read_many(S &sp, sol::this_state s, sol::table const &addresses, sol::object const &dest)
+{
+	return read_many<T>(s, addresses, dest, [&sp] (offs_t address) { return sp.template mem_read<T>(address); });
+}
+
+//-------------------------------------------------
+//  region_read_many - templated bulk region
+//  readers for <sign>,<size>
+//  -> manager:machine():memory().regions[":maincpu"]:read_many_u8({ 0xC000, 0xC010 }, results)
+//-------------------------------------------------
+
+template <typename T>
+sol::table region_read_many(memory_region &region, sol::this_state s, sol::table const &addresses, sol::object const &dest)
+{
+	return read_many<T>(s, addresses, dest, [&region] (offs_t address) { return region_read<T>(region, address); });
+}
+
+//-------------------------------------------------
+//  share_read_many - templated bulk share readers
+//  for <sign>,<size>
+//  -> manager:machine():memory().shares[":maincpu"]:read_many_u8({ 0xC000, 0xC010 }, results)
+//-------------------------------------------------
+
+template <typename T>
+sol::table share_read_many(memory_share &share, sol::this_state s, sol::table const &addresses, sol::object const &dest)
+{
+	return read_many<T>(s, addresses, dest, [&share] (offs_t address) { return share_read<T>(share, address); });
+}
+
 } // anonymous namespace
 
 
@@ -555,6 +623,14 @@ void lua_engine::initialize_memory(sol::table &emu)
 	addr_space_type.set_function("write_u32", &addr_space::mem_write<u32>);
 	addr_space_type.set_function("write_i64", &addr_space::mem_write<s64>);
 	addr_space_type.set_function("write_u64", &addr_space::mem_write<u64>);
+	addr_space_type.set_function("read_many_i8", &space_read_many<s8, addr_space>);
+	addr_space_type.set_function("read_many_u8", &space_read_many<u8, addr_space>);
+	addr_space_type.set_function("read_many_i16", &space_read_many<s16, addr_space>);
+	addr_space_type.set_function("read_many_u16", &space_read_many<u16, addr_space>);
+	addr_space_type.set_function("read_many_i32", &space_read_many<s32, addr_space>);
+	addr_space_type.set_function("read_many_u32", &space_read_many<u32, addr_space>);
+	addr_space_type.set_function("read_many_i64", &space_read_many<s64, addr_space>);
+	addr_space_type.set_function("read_many_u64", &space_read_many<u64, addr_space>);
 	addr_space_type.set_function("readv_i8", &addr_space::log_mem_read<s8>);
 	addr_space_type.set_function("readv_u8", &addr_space::log_mem_read<u8>);
 	addr_space_type.set_function("readv_i16", &addr_space::log_mem_read<s16>);
@@ -759,6 +835,14 @@ void lua_engine::initialize_memory(sol::table &emu)
 	region_type.set_function("read_u32", &region_read<u32>);
 	region_type.set_function("read_i64", &region_read<s64>);
 	region_type.set_function("read_u64", &region_read<u64>);
+	region_type.set_function("read_many_i8", &region_read_many<s8>);
+	region_type.set_function("read_many_u8", &region_read_many<u8>);
+	region_type.set_function("read_many_i16", &region_read_many<s16>);
+	region_type.set_function("read_many_u16", &region_read_many<u16>);
+	region_type.set_function("read_many_i32", &region_read_many<s32>);
+	region_type.set_function("read_many_u32", &region_read_many<u32>);
+	region_type.set_function("read_many_i64", &region_read_many<s64>);
+	region_type.set_function("read_many_u64", &region_read_many<u64>);
 	region_type.set_function("write_i8", &region_write<s8>);
 	region_type.set_function("write_u8", &region_write<u8>);
 	region_type.set_function("write_i16", &region_write<s16>);
@@ -776,6 +860,20 @@ void lua_engine::initialize_memory(sol::table &emu)
 
 
 	auto share_type = sol().registry().new_usertype<memory_share>("share", sol::no_constructor);
+	share_type.set_function(
+			"read",
+			[] (memory_share &share, sol::this_state s, offs_t offset, offs_t length)
+			{
+				buffer_helper buf(s);
+				const offs_t limit = std::min<offs_t>(share.bytes(), offset + length);
+				const offs_t copyable = (limit > offset) ? (limit - offset) : 0;
+				auto space = buf.prepare(copyable);
+				if (copyable)
+					std::memcpy(space.get(), reinterpret_cast<u8 const *>(share.ptr()) + offset, copyable);
+				space.add(copyable);
+				buf.push();
+				return sol::make_reference(s, sol::stack_reference(s, -1));
+			});
 	share_type.set_function("read_i8", &share_read<s8>);
 	share_type.set_function("read_u8", &share_read<u8>);
 	share_type.set_function("read_i16", &share_read<s16>);
@@ -784,6 +882,14 @@ void lua_engine::initialize_memory(sol::table &emu)
 	share_type.set_function("read_u32", &share_read<u32>);
 	share_type.set_function("read_i64", &share_read<s64>);
 	share_type.set_function("read_u64", &share_read<u64>);
+	share_type.set_function("read_many_i8", &share_read_many<s8>);
+	share_type.set_function("read_many_u8", &share_read_many<u8>);
+	share_type.set_function("read_many_i16", &share_read_many<s16>);
+	share_type.set_function("read_many_u16", &share_read_many<u16>);
+	share_type.set_function("read_many_i32", &share_read_many<s32>);
+	share_type.set_function("read_many_u32", &share_read_many<u32>);
+	share_type.set_function("read_many_i64", &share_read_many<s64>);
+	share_type.set_function("read_many_u64", &share_read_many<u64>);
 	share_type.set_function("write_i8", &share_write<s8>);
 	share_type.set_function("write_u8", &share_write<u8>);
 	share_type.set_function("write_i16", &share_write<s16>);
@@ -14,9 +14,13 @@
 #include "softlist_dev.h"
 
 #include "jedparse.h"
+#include "multibyte.h"
 #include "path.h"
 #include "unzip.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 
 //**************************************************************************
 //  MEDIA IDENTIFIER
@@ -335,8 +339,44 @@ void media_identifier::match_hashes(std::vector<file_info> &info)
 	if (info.empty())
 		return;
 
+	// index the files by hash so each known dump is only compared with files
+	// that might match it, rather than with every file being identified
+	std::unordered_multimap<std::uint32_t, file_info *> by_crc, by_sha1;
+	auto const sha1_key = [] (util::sha1_t const &sha1) { return get_u32be(sha1.m_raw); };
+	for (file_info &file : info)
+	{
+		std::uint32_t crc;
+		util::sha1_t sha1;
+		if (file.hashes().crc(crc))
+			by_crc.emplace(crc, &file);
+		if (file.hashes().sha1(sha1))
+			by_sha1.emplace(sha1_key(sha1), &file);
+	}
+	auto const candidates =
+			[&by_crc, &by_sha1, &sha1_key] (util::hash_collection const &hashes, auto &&action)
+			{
+				// hashes match if every kind both have is equal, so files without a
+				// CRC have to be found by SHA1 even when the dump has a CRC
+				std::uint32_t crc;
+				util::sha1_t sha1;
+				bool const has_crc = hashes.crc(crc);
+				if (has_crc)
+				{
+					auto const range = by_crc.equal_range(crc);
+					for (auto it = range.first; range.second != it; ++it)
+						action(*it->second);
+				}
+				if (hashes.sha1(sha1))
+				{
+					auto const range = by_sha1.equal_range(sha1_key(sha1));
+					for (auto it = range.first; range.second != it; ++it)
+						if (!has_crc || !it->second->hashes().crc(crc))
+							action(*it->second);
+				}
+			};
+
 	auto match_device =
-			[&info, listnames = std::unordered_set<std::string>()] (device_t &device) mutable
+			[&candidates, listnames = std::unordered_set<std::string>()] (device_t &device) mutable
 			{
 				// iterate over regions and files within the region
 				for (romload::region const &region : romload::entries(device.rom_region()).get_regions())
@@ -345,10 +385,7 @@ void media_identifier::match_hashes(std::vector<file_info> &info)
 					{
 						util::hash_collection const romhashes(rom.get_hashdata());
 						if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
-						{
-							for (file_info &file : info)
-								file.match(device, rom, romhashes);
-						}
+							candidates(romhashes, [&device, &rom, &romhashes] (file_info &file) { file.match(device, rom, romhashes); });
 					}
 				}
 
@@ -368,10 +405,7 @@ void media_identifier::match_hashes(std::vector<file_info> &info)
 								{
 									util::hash_collection romhashes(rom->hashdata());
 									if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
-									{
-										for (file_info &file : info)
-											file.match(swlistdev.list_name(), swinfo, *rom, romhashes);
-									}
+										candidates(romhashes, [&swlistdev, &swinfo, rom, &romhashes] (file_info &file) { file.match(swlistdev.list_name(), swinfo, *rom, romhashes); });
 								}
 							}
 						}
@@ -640,7 +640,7 @@ void menu::draw(uint32_t flags)
 	std::optional<text_layout> heading_layout;
 	if (m_heading)
 	{
-		heading_layout.emplace(create_layout(max_width - (gutter_width() * 2.0F), text_layout::text_justify::CENTER));
+		heading_layout.emplace(create_layout(max_width - (gutter_width() * 2.0F), text_layout::text_justify::CENTER, text_layout::word_wrapping::WORD, &ui().frame_arena()));
 		heading_layout->add_text(*m_heading, ui().colors().text_color());
 
 		// readjust visible width if heading width exceeds that of the menu
@@ -2110,9 +2110,9 @@ delegate<uint32_t (render_container &)> menu::get_ui_handler(mame_ui_manager &mu
 //  create_layout
 //-------------------------------------------------
 
-text_layout menu::create_layout(float width, text_layout::text_justify justify, text_layout::word_wrapping wrap)
+text_layout menu::create_layout(float width, text_layout::text_justify justify, text_layout::word_wrapping wrap, util::arena *arena)
 {
-	return text_layout(*ui().get_font(), line_height() * x_aspect(), line_height(), width, justify, wrap);
+	return text_layout(*ui().get_font(), line_height() * x_aspect(), line_height(), width, justify, wrap, arena);
 }
 
 
@@ -2144,7 +2144,7 @@ void menu::draw_arrow(float x0, float y0, float x1, float y1, rgb_t fgcolor, uin
 void menu::extra_text_draw_box(float origx1, float origx2, float origy, float yspan, std::string_view text, int direction)
 {
 	// get the size of the text
-	auto layout = create_layout();
+	auto layout = create_layout(1.0F, text_layout::text_justify::LEFT, text_layout::word_wrapping::WORD, &ui().frame_arena());
 	layout.add_text(text);
 
 	// position this extra text
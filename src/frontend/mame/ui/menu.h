@@ -214,7 +214,7 @@ protected:
 	float ud_arrow_width() const { return m_ud_arrow_width; }
 
 	float get_string_width(std::string_view s) { return ui().get_string_width(s, line_height()); }
-	text_layout create_layout(float width = 1.0, text_layout::text_justify justify = text_layout::text_justify::LEFT, text_layout::word_wrapping wrap = text_layout::word_wrapping::WORD);
+	text_layout create_layout(float width = 1.0, text_layout::text_justify justify = text_layout::text_justify::LEFT, text_layout::word_wrapping wrap = text_layout::word_wrapping::WORD, util::arena *arena = nullptr);
 
 	void draw_text_normal(
 			std::string_view text,
@@ -291,7 +291,7 @@ protected:
 			std::string_view const &line(*it);
 			if (!line.empty())
 			{
-				text_layout layout(*ui().get_font(), text_size * x_aspect(), text_size, 1.0, justify, wrap);
+				text_layout layout(*ui().get_font(), text_size * x_aspect(), text_size, 1.0, justify, wrap, &ui().frame_arena());
 				layout.add_text(line, rgb_t::white(), rgb_t::black());
 				maxwidth = (std::max)(layout.actual_width(), maxwidth);
 			}
@@ -58,6 +58,7 @@ menu_select_game::menu_select_game(mame_ui_manager &mui, render_container &conta
 	, m_icon_paths()
 	, m_displaylist()
 	, m_searchlist()
+	, m_searchlist_fields(system_list::AVAIL_NONE)
 	, m_searched_fields(system_list::AVAIL_NONE)
 	, m_populated_favorites(false)
 {
@@ -121,6 +122,8 @@ menu_select_game::menu_select_game(mame_ui_manager &mui, render_container &conta
 
 menu_select_game::~menu_select_game()
 {
+	cancel_search();
+
 	// TODO: reconsider when to do this
 	ui().save_ui_options();
 }
@@ -199,6 +202,14 @@ bool menu_select_game::handle(event const *ev)
 	if (!m_prev_selected && (item_count() > 0))
 		m_prev_selected = item(0).ref();
 
+	// show the results of a background search once it's finished
+	if (search_ready())
+	{
+		finish_search();
+		if (!m_search.empty())
+			reset(reset_options::SELECT_FIRST);
+	}
+
 	// if I have to select software, force software list submenu
 	if (reselect_last::get())
 	{
@@ -732,18 +743,6 @@ bool menu_select_game::isfavorite() const
 
 void menu_select_game::populate_search()
 {
-	// ensure search list is populated
-	if (m_searchlist.empty())
-	{
-		auto const &sorted(m_persistent_data.sorted_list());
-		m_searchlist.reserve(sorted.size());
-		for (ui_system_info const &info : sorted)
-			m_searchlist.emplace_back(1.0, std::ref(info));
-	}
-
-	// keep track of what we matched against
-	const std::u32string ucs_search(ustr_from_utf8(normalize_unicode(m_search, unicode_normalization_form::D, true)));
-
 	// check available search data
 	if (m_persistent_data.is_available(system_list::AVAIL_UCS_SHORTNAME))
 		m_searched_fields |= system_list::AVAIL_UCS_SHORTNAME;
@@ -756,13 +755,89 @@ void menu_select_game::populate_search()
 	if (m_persistent_data.is_available(system_list::AVAIL_UCS_MANUF_DFLT_DESC))
 		m_searched_fields |= system_list::AVAIL_UCS_MANUF_DFLT_DESC;
 
-	for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
+	// take the results of a search that's finished
+	if (search_ready())
+		finish_search();
+
+	// start a new search if the results are stale and there isn't one running
+	// for the current text - the previous results are shown until it's done
+	bool const current = (m_searchlist_text == m_search) && (m_searchlist_fields == m_searched_fields);
+	bool const running = m_search_state && (m_search_state->text == m_search) && (m_search_state->fields == m_searched_fields);
+	if (!current && !running)
 	{
+		cancel_search();
+		m_search_state = std::make_unique<search_state>(m_search, m_searched_fields);
+		auto const &sorted(m_persistent_data.sorted_list());
+		m_search_state->results.reserve(sorted.size());
+		for (ui_system_info const &info : sorted)
+			m_search_state->results.emplace_back(1.0, std::ref(info));
+		m_search_task = std::async(std::launch::async, &menu_select_game::search_systems, std::ref(*m_search_state));
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_search - take the results of a
+//  background search that's finished
+//-------------------------------------------------
+
+void menu_select_game::finish_search()
+{
+	m_search_task.get();
+	m_searchlist = std::move(m_search_state->results);
+	m_searchlist_text = m_search_state->text;
+	m_searchlist_fields = m_search_state->fields;
+	m_search_state.reset();
+}
+
+
+//-------------------------------------------------
+//  cancel_search - abandon a background search
+//-------------------------------------------------
+
+void menu_select_game::cancel_search()
+{
+	if (m_search_state)
+	{
+		m_search_state->cancel.store(true, std::memory_order_relaxed);
+		m_search_task.wait();
+		m_search_task = std::future<void>();
+		m_search_state.reset();
+	}
+}
+
+
+//-------------------------------------------------
+//  search_ready - true if a background search
+//  has finished
+//-------------------------------------------------
+
+bool menu_select_game::search_ready() const
+{
+	return m_search_task.valid() && (std::future_status::ready == m_search_task.wait_for(std::chrono::seconds(0)));
+}
+
+
+//-------------------------------------------------
+//  search_systems - score systems against the
+//  search text, on a worker thread
+//-------------------------------------------------
+
+void menu_select_game::search_systems(search_state &state)
+{
+	// keep track of what we matched against
+	const std::u32string ucs_search(ustr_from_utf8(normalize_unicode(state.text, unicode_normalization_form::D, true)));
+
+	for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : state.results)
+	{
+		if (state.cancel.load(std::memory_order_relaxed))
+			return;
+
 		info.first = 1.0;
 		ui_system_info const &sys(info.second);
 
 		// match shortnames
-		if (m_searched_fields & system_list::AVAIL_UCS_SHORTNAME)
+		if (state.fields & system_list::AVAIL_UCS_SHORTNAME)
 			info.first = util::edit_distance(ucs_search, sys.ucs_shortname);
 
 		// match reading
@@ -776,28 +851,28 @@ void menu_select_game::populate_search()
 		}
 
 		// match descriptions
-		if (info.first && (m_searched_fields & system_list::AVAIL_UCS_DESCRIPTION))
+		if (info.first && (state.fields & system_list::AVAIL_UCS_DESCRIPTION))
 			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_description), info.first);
 
 		// match "<manufacturer> <description>"
-		if (info.first && (m_searched_fields & system_list::AVAIL_UCS_MANUF_DESC))
+		if (info.first && (state.fields & system_list::AVAIL_UCS_MANUF_DESC))
 			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_description), info.first);
 
 		// match default description
-		if (info.first && (m_searched_fields & system_list::AVAIL_UCS_DFLT_DESC) && !sys.ucs_default_description.empty())
+		if (info.first && (state.fields & system_list::AVAIL_UCS_DFLT_DESC) && !sys.ucs_default_description.empty())
 		{
 			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_default_description), info.first);
 
 			// match "<manufacturer> <default description>"
-			if (info.first && (m_searched_fields & system_list::AVAIL_UCS_MANUF_DFLT_DESC))
+			if (info.first && (state.fields & system_list::AVAIL_UCS_MANUF_DFLT_DESC))
 				info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_default_description), info.first);
 		}
 	}
 
 	// sort according to edit distance
 	std::stable_sort(
-			m_searchlist.begin(),
-			m_searchlist.end(),
+			state.results.begin(),
+			state.results.end(),
 			[] (auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
 }
 
@@ -819,17 +894,6 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 		if (m_icon_paths.empty())
 			m_icon_paths = make_icon_paths(nullptr);
 
-		// allocate an entry or allocate a texture on forced redraw
-		if (m_icons.end() == icon)
-		{
-			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
-		}
-		else
-		{
-			assert(!icon->second.texture);
-			icon->second.texture.reset(machine().render().texture_alloc());
-		}
-
 		// set clone status
 		bool cloneof = strcmp(driver->parent, "0");
 		if (cloneof)
@@ -839,20 +903,39 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 				cloneof = false;
 		}
 
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(m_icon_paths), OPEN_FLAG_READ);
-		if (!snapfile.open(std::string(driver->name) + ".ico"))
+		// icons are loaded in the background - leave a gap until it's ready
+		std::string const paths(m_icon_paths);
+		image_ptr const image(icon_image(
+				util::string_format("%s\t%s", paths, driver->name),
+				[paths, driver, cloneof] (bitmap_argb32 &bitmap)
+				{
+					emu_file snapfile(std::string(paths), OPEN_FLAG_READ);
+					if (!snapfile.open(std::string(driver->name) + ".ico"))
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+					if (!bitmap.valid() && cloneof && !snapfile.open(std::string(driver->parent) + ".ico"))
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+				}));
+		if (!image)
+			return nullptr;
+
+		// allocate an entry or allocate a texture on forced redraw
+		if (m_icons.end() == icon)
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
 		}
-		if (!tmp.valid() && cloneof && !snapfile.open(std::string(driver->parent) + ".ico"))
+		else
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			assert(!icon->second.texture);
+			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
-		scale_icon(std::move(tmp), icon->second);
+		scale_icon(image->valid() ? bitmap_argb32(*image, image->cliprect()) : bitmap_argb32(), icon->second);
 	}
 
 	return icon->second.bitmap.valid() ? icon->second.texture.get() : nullptr;
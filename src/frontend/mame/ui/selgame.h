@@ -15,7 +15,12 @@
 #include "ui/selmenu.h"
 #include "ui/utils.h"
 
+#include <atomic>
 #include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
 
 
 namespace ui {
@@ -46,14 +51,30 @@ private:
 	};
 
 	using icon_cache = texture_lru<game_driver const *>;
+	using search_list = std::vector<std::pair<double, std::reference_wrapper<ui_system_info const> > >;
+
+	// a search running on a worker thread
+	struct search_state
+	{
+		search_state(std::string const &text, unsigned fields) : text(text), fields(fields), cancel(false) { }
+
+		std::string const   text;       // text being searched for
+		unsigned const      fields;     // fields being matched
+		std::atomic<bool>   cancel;     // set to abandon the search
+		search_list         results;    // systems sorted by match quality
+	};
 
 	system_list &m_persistent_data;
 	icon_cache m_icons;
 	std::string m_icon_paths;
 	std::vector<std::reference_wrapper<ui_system_info const> > m_displaylist;
 
-	std::vector<std::pair<double, std::reference_wrapper<ui_system_info const> > > m_searchlist;
+	search_list m_searchlist;
+	std::string m_searchlist_text;
+	unsigned m_searchlist_fields;
 	unsigned m_searched_fields;
+	std::unique_ptr<search_state> m_search_state;
+	std::future<void> m_search_task;
 	bool m_populated_favorites;
 
 	static bool s_first_start;
@@ -84,6 +105,10 @@ private:
 
 	bool isfavorite() const;
 	void populate_search();
+	void finish_search();
+	void cancel_search();
+	bool search_ready() const;
+	static void search_systems(search_state &state);
 	bool load_available_machines();
 	void load_custom_filters();
 
@@ -38,7 +38,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 
 // these hold static bitmap images
@@ -414,6 +418,85 @@ bool menu_select_launch::bios_selection::handle(event const *ev)
 }
 
 
+// loads and decodes images on a worker thread, keeping the most recently
+// used ones; the newest request is always loaded first, and requests that
+// have waited too long are dropped, since the user has moved on
+class menu_select_launch::cache::image_loader
+{
+public:
+	image_loader(std::size_t cache_size, std::size_t queue_size)
+		: m_images(cache_size)
+		, m_queue_size(queue_size)
+		, m_exit(false)
+		, m_thread([this] () { run(); })
+	{
+	}
+
+	~image_loader()
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_exit = true;
+		}
+		m_ready.notify_all();
+		m_thread.join();
+	}
+
+	image_ptr get(std::string const &key, image_load_function &&load)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto const found = m_images.find(key);
+		if (m_images.end() != found)
+			return found->second;
+		if (m_loading == key)
+			return nullptr;
+
+		// move it to the front of the queue, or add it there
+		auto const queued = std::find_if(m_queue.begin(), m_queue.end(), [&key] (auto const &request) { return request.first == key; });
+		if (m_queue.end() != queued)
+			m_queue.erase(queued);
+		m_queue.emplace_front(key, std::move(load));
+		if (m_queue.size() > m_queue_size)
+			m_queue.pop_back();
+		m_ready.notify_one();
+		return nullptr;
+	}
+
+private:
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;)
+		{
+			m_ready.wait(lock, [this] () { return m_exit || !m_queue.empty(); });
+			if (m_exit)
+				return;
+
+			std::pair<std::string, image_load_function> request(std::move(m_queue.front()));
+			m_queue.pop_front();
+			m_loading = request.first;
+			lock.unlock();
+
+			image_ptr const bitmap(std::make_shared<bitmap_argb32>());
+			request.second(*bitmap);
+
+			lock.lock();
+			m_images[request.first] = bitmap;
+			m_loading.clear();
+		}
+	}
+
+	std::mutex                                                  m_mutex;
+	std::condition_variable                                     m_ready;
+	util::lru_cache_map<std::string, image_ptr>                 m_images;
+	std::deque<std::pair<std::string, image_load_function> >    m_queue;
+	std::size_t const                                           m_queue_size;
+	std::string                                                 m_loading;
+	bool                                                        m_exit;
+	std::thread                                                 m_thread;
+};
+
+
 menu_select_launch::cache::cache(running_machine &machine)
 	: m_snapx_bitmap(std::make_unique<bitmap_argb32>(0, 0))
 	, m_snapx_texture(nullptr, machine.render())
@@ -422,6 +505,8 @@ menu_select_launch::cache::cache(running_machine &machine)
 	, m_no_avail_bitmap(256, 256)
 	, m_toolbar_bitmaps()
 	, m_toolbar_textures()
+	, m_art_loader(std::make_unique<image_loader>(16, 4))
+	, m_icon_loader(std::make_unique<image_loader>(128, 64))
 {
 	render_manager &render(machine.render());
 
@@ -440,6 +525,18 @@ menu_select_launch::cache::~cache()
 }
 
 
+menu_select_launch::image_ptr menu_select_launch::cache::art_image(std::string const &key, image_load_function &&load)
+{
+	return m_art_loader->get(key, std::move(load));
+}
+
+
+menu_select_launch::image_ptr menu_select_launch::cache::icon_image(std::string const &key, image_load_function &&load)
+{
+	return m_icon_loader->get(key, std::move(load));
+}
+
+
 void menu_select_launch::cache::cache_toolbar(running_machine &machine, float width, float height)
 {
 	// not bothering to transform for non-square pixels greatly simplifies this
@@ -1356,6 +1453,16 @@ std::string menu_select_launch::make_icon_paths(char const *listname) const
 	return result;
 }
 
+menu_select_launch::image_ptr menu_select_launch::art_image(std::string const &key, image_load_function &&load)
+{
+	return m_cache.art_image(key, std::move(load));
+}
+
+menu_select_launch::image_ptr menu_select_launch::icon_image(std::string const &key, image_load_function &&load)
+{
+	return m_cache.icon_image(key, std::move(load));
+}
+
 bool menu_select_launch::scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst) const
 {
 	assert(dst.texture);
@@ -3670,27 +3777,45 @@ void menu_select_launch::arts_render(u32 flags)
 		// loads the image if necessary
 		if (!m_cache.snapx_software_is(software) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(get_arts_searchpath(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-
+			std::string const searchpath(get_arts_searchpath());
+			game_driver const &driver(*software->driver);
+			image_ptr image;
 			if (software->startempty == 1)
 			{
 				// Load driver snapshot
-				load_driver_image(tmp_bitmap, snapfile, *software->driver);
+				image = art_image(
+						util::string_format("%s\t%s", searchpath, driver.name),
+						[searchpath, &driver] (bitmap_argb32 &bitmap)
+						{
+							emu_file snapfile(searchpath, OPEN_FLAG_READ);
+							load_driver_image(bitmap, snapfile, driver);
+						});
 			}
 			else
 			{
-				// First attempt from name list
-				load_image(tmp_bitmap, snapfile, util::path_concat(software->listname, software->shortname));
-
-				// Second attempt from driver name + part name
-				if (!tmp_bitmap.valid())
-					load_image(tmp_bitmap, snapfile, util::path_concat(software->driver->name + software->part, software->shortname));
+				std::string const listpath(util::path_concat(software->listname, software->shortname));
+				std::string const partpath(util::path_concat(driver.name + software->part, software->shortname));
+				image = art_image(
+						util::string_format("%s\t%s\t%s", searchpath, listpath, partpath),
+						[searchpath, listpath, partpath] (bitmap_argb32 &bitmap)
+						{
+							// First attempt from name list
+							emu_file snapfile(searchpath, OPEN_FLAG_READ);
+							load_image(bitmap, snapfile, listpath);
+
+							// Second attempt from driver name + part name
+							if (!bitmap.valid())
+								load_image(bitmap, snapfile, partpath);
+						});
 			}
 
+			// nothing is shown until it's been loaded
+			if (!image)
+				return;
+
 			m_cache.set_snapx_software(software);
 			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap));
+			arts_render_images(image->valid() ? bitmap_argb32(*image, image->cliprect()) : bitmap_argb32());
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -3703,13 +3828,23 @@ void menu_select_launch::arts_render(u32 flags)
 		// loads the image if necessary
 		if (!m_cache.snapx_driver_is(system->driver) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(get_arts_searchpath(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-			load_driver_image(tmp_bitmap, snapfile, *system->driver);
+			std::string const searchpath(get_arts_searchpath());
+			game_driver const &driver(*system->driver);
+			image_ptr const image(art_image(
+					util::string_format("%s\t%s", searchpath, driver.name),
+					[searchpath, &driver] (bitmap_argb32 &bitmap)
+					{
+						emu_file snapfile(searchpath, OPEN_FLAG_READ);
+						load_driver_image(bitmap, snapfile, driver);
+					}));
+
+			// nothing is shown until it's been loaded
+			if (!image)
+				return;
 
 			m_cache.set_snapx_driver(system->driver);
 			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap));
+			arts_render_images(image->valid() ? bitmap_argb32(*image, image->cliprect()) : bitmap_argb32());
 		}
 
 		// if the image is available, loaded and valid, display it
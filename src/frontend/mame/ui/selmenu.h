@@ -20,9 +20,11 @@
 #include "lrucache.h"
 
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
@@ -157,6 +159,13 @@ protected:
 	std::string make_icon_paths(char const *listname) const;
 	bool scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst) const;
 
+	// images decoded on a worker thread - these return the image if it's
+	// ready, and otherwise queue it to be loaded and return nullptr
+	using image_load_function = std::function<void (bitmap_argb32 &)>;
+	using image_ptr = std::shared_ptr<bitmap_argb32>;
+	image_ptr art_image(std::string const &key, image_load_function &&load);
+	image_ptr icon_image(std::string const &key, image_load_function &&load);
+
 	// forcing refresh
 	void set_switch_image() { m_switch_image = true; }
 
@@ -243,7 +252,12 @@ private:
 
 		void cache_toolbar(running_machine &machine, float width, float height);
 
+		image_ptr art_image(std::string const &key, image_load_function &&load);
+		image_ptr icon_image(std::string const &key, image_load_function &&load);
+
 	private:
+		class image_loader;
+
 		bitmap_ptr              m_snapx_bitmap;
 		texture_ptr             m_snapx_texture;
 		game_driver const       *m_snapx_driver;
@@ -253,6 +267,9 @@ private:
 
 		bitmap_vector           m_toolbar_bitmaps;
 		texture_ptr_vector      m_toolbar_textures;
+
+		std::unique_ptr<image_loader>   m_art_loader;
+		std::unique_ptr<image_loader>   m_icon_loader;
 	};
 
 	// this is to satisfy the std::any requirement that objects be copyable
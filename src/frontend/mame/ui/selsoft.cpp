@@ -670,6 +670,29 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 		if (m_icon_paths.end() == paths)
 			paths = m_icon_paths.emplace(swinfo->listname, make_icon_paths(swinfo->listname.c_str())).first;
 
+		// icons are loaded in the background - leave a gap until it's ready
+		std::string const searchpath(paths->second);
+		std::string const shortname(swinfo->shortname);
+		std::string const parentname(swinfo->parentname);
+		image_ptr const image(icon_image(
+				util::string_format("%s\t%s", searchpath, shortname),
+				[searchpath, shortname, parentname] (bitmap_argb32 &bitmap)
+				{
+					emu_file snapfile(std::string(searchpath), OPEN_FLAG_READ);
+					if (!snapfile.open(shortname + ".ico"))
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+					if (!bitmap.valid() && !parentname.empty() && !snapfile.open(parentname + ".ico"))
+					{
+						render_load_ico_highest_detail(snapfile, bitmap);
+						snapfile.close();
+					}
+				}));
+		if (!image)
+			return nullptr;
+
 		// allocate an entry or allocate a texture on forced redraw
 		if (m_data->icons().end() == icon)
 		{
@@ -681,20 +704,7 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(paths->second), OPEN_FLAG_READ);
-		if (!snapfile.open(std::string(swinfo->shortname) + ".ico"))
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-		if (!tmp.valid() && !swinfo->parentname.empty() && !snapfile.open(std::string(swinfo->parentname) + ".ico"))
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-
-		scale_icon(std::move(tmp), icon->second);
+		scale_icon(image->valid() ? bitmap_argb32(*image, image->cliprect()) : bitmap_argb32(), icon->second);
 	}
 
 	return icon->second.bitmap.valid() ? icon->second.texture.get() : nullptr;
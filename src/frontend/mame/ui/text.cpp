@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <new>
 #include <utility>
 
 
@@ -109,7 +110,7 @@ public:
 	using size_type = size_t;
 	static constexpr size_type npos = ~size_type(0);
 
-	line(float yoffset, float height) : m_yoffset(yoffset), m_height(height)
+	line(util::arena *arena, float yoffset, float height) : m_characters(util::arena_allocator<positioned_char>(arena)), m_yoffset(yoffset), m_height(height)
 	{
 	}
 
@@ -253,7 +254,7 @@ public:
 	positioned_char &character(size_t index) { return m_characters[index]; }
 
 private:
-	std::vector<positioned_char> m_characters;
+	std::vector<positioned_char, util::arena_allocator<positioned_char> > m_characters;
 	size_type m_center_justify_start = npos;
 	size_type m_right_justify_start = npos;
 	float m_yoffset;
@@ -273,11 +274,12 @@ CORE IMPLEMENTATION
 //  ctor
 //-------------------------------------------------
 
-text_layout::text_layout(render_font &font, float xscale, float yscale, float width, text_layout::text_justify justify, text_layout::word_wrapping wrap)
+text_layout::text_layout(render_font &font, float xscale, float yscale, float width, text_layout::text_justify justify, text_layout::word_wrapping wrap, util::arena *arena)
 	: m_font(font)
 	, m_xscale(xscale), m_yscale(yscale)
 	, m_width(width)
 	, m_justify(justify), m_wrap(wrap)
+	, m_lines(util::arena_allocator<line_ptr>(arena))
 	, m_current_line(nullptr), m_last_break(0), m_text_position(0), m_truncating(false)
 {
 	invalidate_calculated_actual_width();
@@ -308,6 +310,18 @@ text_layout::~text_layout()
 }
 
 
+//-------------------------------------------------
+//  line_deleter - destroy a line and give its
+//  memory back if it isn't in an arena
+//-------------------------------------------------
+
+void text_layout::line_deleter::operator()(line *l) const
+{
+	l->~line();
+	util::arena_allocator<line>(arena).deallocate(l, 1);
+}
+
+
 //-------------------------------------------------
 //  add_text
 //-------------------------------------------------
@@ -467,7 +481,10 @@ float text_layout::actual_height()
 void text_layout::start_new_line(float height)
 {
 	// update the current line
-	m_current_line = m_lines.emplace_back(std::make_unique<line>(actual_height(), height * yscale())).get();
+	util::arena *const arena(m_lines.get_allocator().get_arena());
+	util::arena_allocator<line> alloc(arena);
+	line *const l(new (alloc.allocate(1)) line(arena, actual_height(), height * yscale()));
+	m_current_line = m_lines.emplace_back(l, line_deleter{ arena }).get();
 	m_last_break = 0;
 	m_truncating = false;
 }
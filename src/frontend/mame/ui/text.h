@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include "util/arena.h"
+
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -46,8 +48,8 @@ public:
 		WORD
 	};
 
-	// ctor/dtor
-	text_layout(render_font &font, float xscale, float yscale, float width, text_justify justify, word_wrapping wrap);
+	// ctor/dtor - a layout built in an arena must be destroyed before the arena is reset
+	text_layout(render_font &font, float xscale, float yscale, float width, text_justify justify, word_wrapping wrap, util::arena *arena = nullptr);
 	text_layout(text_layout &&that);
 	~text_layout();
 
@@ -91,6 +93,12 @@ private:
 	struct source_info;
 	struct positioned_char;
 	class line;
+	struct line_deleter
+	{
+		util::arena *arena;
+		void operator()(line *l) const;
+	};
+	using line_ptr = std::unique_ptr<line, line_deleter>;
 
 	// instance variables
 	render_font &m_font;
@@ -100,7 +108,7 @@ private:
 	mutable float m_calculated_actual_width;
 	text_justify m_justify;
 	word_wrapping m_wrap;
-	std::vector<std::unique_ptr<line> > m_lines;
+	std::vector<line_ptr, util::arena_allocator<line_ptr> > m_lines;
 	line *m_current_line;
 	size_t m_last_break;
 	size_t m_text_position;
@@ -869,6 +869,7 @@ bool mame_ui_manager::update_and_render(render_container &container)
 		if (target.ui_container())
 			target.ui_container()->empty();
 	}
+	m_frame_arena.reset();
 
 	// if we're paused, dim the whole screen
 	if (machine().phase() >= machine_phase::RESET && (single_step() || machine().paused()))
@@ -1106,7 +1107,7 @@ void mame_ui_manager::draw_text_full(
 	// create the layout
 	ui::text_layout layout(
 			*get_font(), machine().render().ui_aspect(&container) * text_size, text_size,
-			origwrapwidth, justify, wrap);
+			origwrapwidth, justify, wrap, &m_frame_arena);
 
 	// append text to it
 	layout.add_text(
@@ -1137,7 +1138,7 @@ void mame_ui_manager::draw_text_box(render_container &container, std::string_vie
 	float maximum_width = 1.0f - (box_lr_border() * machine().render().ui_aspect(&container) * 2.0f);
 
 	// create a layout
-	ui::text_layout layout = create_layout(container, maximum_width, justify);
+	ui::text_layout layout = create_layout(container, maximum_width, justify, ui::text_layout::word_wrapping::WORD, &m_frame_arena);
 
 	// add text to it
 	layout.add_text(text);
@@ -1467,7 +1468,8 @@ void mame_ui_manager::draw_fps_counter(render_container &container)
 
 void mame_ui_manager::draw_profiler(render_container &container)
 {
-	std::string_view text = g_profiler.text(machine());
+	std::string text(g_profiler.text(machine()));
+	text.append(mame_machine_manager::instance()->lua()->callback_timing_text());
 	draw_text_full(
 			container,
 			text,
@@ -1747,6 +1749,13 @@ uint32_t mame_ui_manager::handler_ingame(render_container &container)
 			machine().sound().ui_mute(!new_throttle_state);
 	}
 
+	// toggle turbo mode?
+	if (machine().ui_input().pressed(IPT_UI_TURBO))
+	{
+		machine().video().set_turbo(!machine().video().turbo());
+		show_fps_temp(2.0);
+	}
+
 	// check for fast forward
 	if (machine().ioport().type_pressed(IPT_UI_FAST_FORWARD))
 	{
@@ -2507,14 +2516,14 @@ int32_t mame_ui_manager::slider_crossoffset(ioport_field &field, std::string *st
 //  create_layout
 //-------------------------------------------------
 
-ui::text_layout mame_ui_manager::create_layout(render_container &container, float width, ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap)
+ui::text_layout mame_ui_manager::create_layout(render_container &container, float width, ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap, util::arena *arena)
 {
 	// determine scale factors
 	float const yscale = get_line_height();
 	float const xscale = yscale * machine().render().ui_aspect(&container);
 
 	// create the layout
-	return ui::text_layout(*get_font(), xscale, yscale, width, justify, wrap);
+	return ui::text_layout(*get_font(), xscale, yscale, width, justify, wrap, arena);
 }
 
 
@@ -173,6 +173,9 @@ public:
 	float get_char_width(char32_t ch);
 	float get_string_width(std::string_view s);
 	float get_string_width(std::string_view s, float text_size);
+
+	// scratch memory for text laid out and drawn within a frame, reset by update_and_render
+	util::arena &frame_arena() { return m_frame_arena; }
 	float box_lr_border() const { return target_font_height() * 0.25f; }
 	float box_tb_border() const { return target_font_height() * 0.25f; }
 
@@ -256,7 +259,7 @@ public:
 
 	// other
 	void process_ui_events();
-	ui::text_layout create_layout(render_container &container, float width = 1.0, ui::text_layout::text_justify justify = ui::text_layout::text_justify::LEFT, ui::text_layout::word_wrapping wrap = ui::text_layout::word_wrapping::WORD);
+	ui::text_layout create_layout(render_container &container, float width = 1.0, ui::text_layout::text_justify justify = ui::text_layout::text_justify::LEFT, ui::text_layout::word_wrapping wrap = ui::text_layout::word_wrapping::WORD, util::arena *arena = nullptr);
 	void set_image_display_enabled(bool image_display_enabled) { m_image_display_enabled = image_display_enabled; }
 	bool image_display_enabled() const { return m_image_display_enabled; }
 	virtual void popup_time_string(int seconds, std::string message) override;
@@ -294,6 +297,7 @@ private:
 
 	// instance variables
 	std::unique_ptr<render_font> m_font;
+	util::arena             m_frame_arena;
 	handler_callback_func   m_handler_callback;
 	ui_callback_type        m_handler_callback_type;
 	bool                    m_ui_active;
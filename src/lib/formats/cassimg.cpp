@@ -548,6 +548,28 @@ cassette_image::error cassette_image::get_sample(int channel,
 
 
 
+// The value get_sample() gives with no sample period, for polling the
+// tape as it plays; parts of the waveform that were never written read
+// as silence without being allocated
+int32_t cassette_image::sample_at(int channel, double time_index) const noexcept
+{
+	size_t const sample = (time_index > 0) ? my_round(time_index * m_sample_frequency) : 0;
+	size_t const block = (sample / SAMPLES_PER_BLOCK) * m_channels;
+	size_t const index = sample % SAMPLES_PER_BLOCK;
+
+	int const channel_first = (channel < 0) ? 0 : channel;
+	int const channel_last = (channel < 0) ? (m_channels - 1) : channel;
+	int64_t sum = 0;
+	for (int ch = channel_first; ch <= channel_last; ch++)
+	{
+		if (((block + ch) < m_blocks.size()) && m_blocks[block + ch])
+			sum += m_blocks[block + ch][index];
+	}
+	return int32_t(sum / (channel_last + 1 - channel_first));
+}
+
+
+
 cassette_image::error cassette_image::put_sample(int channel,
 	double time_index, double sample_period, int32_t sample)
 {
@@ -146,6 +146,7 @@ public:
 		double time_index, double sample_period, size_t sample_count, size_t sample_spacing,
 		const void *samples, int waveform_flags);
 	error get_sample(int channel, double time_index, double sample_period, int32_t *sample);
+	int32_t sample_at(int channel, double time_index) const noexcept;
 	error put_sample(int channel, double time_index, double sample_period, int32_t sample);
 
 	// waveform accesses to/from the raw image - these are only used by lib\formats\wavfile.cpp
@@ -1,14 +1,21 @@
 #!/bin/sh
 
 GENERATED=src/lib/netlist/generated/static_solvers.cpp
-FILES=`find src/mame -name "nl_*.cpp" | grep -v pongdoubles`
+FILES=`find src/mame -name "nl_*.cpp" | grep -v pongdoubles | sort`
 
 OUTDIR=/tmp/static_syms
 
-if [ _$OS = "_Windows_NT" ]; then
-	NLTOOL=./nltool.exe
-else
-	NLTOOL=./nltool
+if [ -z "${NLTOOL}" ]; then
+	if [ _$OS = "_Windows_NT" ]; then
+		NLTOOL=./nltool.exe
+	else
+		NLTOOL=./nltool
+	fi
+fi
+
+if [ ! -x "${NLTOOL}" ]; then
+	echo "${NLTOOL} not found, build it with make TOOLS=1 or set NLTOOL"
+	exit 1
 fi
 
 rm -rf ${OUTDIR}
@@ -20,5 +27,7 @@ if ${NLTOOL} --cmd static --output=${GENERATED}.tmp --include=src/mame/shared ${
 	mv -f ${GENERATED}.tmp ${GENERATED}
 	echo Created ${GENERATED} file
 else
+	rm -f ${GENERATED}.tmp
 	echo Failed to create ${GENERATED}
+	exit 1
 fi
@@ -13,9 +13,12 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace plib {
 
@@ -83,6 +86,138 @@ namespace plib {
 		long m_count;
 	};
 
+	///
+	/// \brief persistent pool of worker threads
+	///
+	/// for_each() hands the indices [0, count) out to the workers and the
+	/// calling thread and returns once every index has been processed, so
+	/// each call acts as a barrier. Idle workers spin for a while before
+	/// blocking so that work dispatched at a high rate, e.g. once per
+	/// simulation time step, does not pay for a thread wakeup every time.
+	///
+	class pthread_pool
+	{
+	public:
+		/// \brief number of polls an idle worker makes before blocking
+		static constexpr unsigned SPIN_COUNT = 20000;
+
+		/// \brief create a pool
+		///
+		/// \param workers number of threads in addition to the caller
+		explicit pthread_pool(std::size_t workers)
+		{
+			for (std::size_t i = 0; i < workers; i++)
+				m_workers.emplace_back([this] { worker(); });
+		}
+
+		pthread_pool(const pthread_pool &) = delete;
+		pthread_pool &operator=(const pthread_pool &) = delete;
+		pthread_pool(pthread_pool &&) = delete;
+		pthread_pool &operator=(pthread_pool &&) = delete;
+
+		~pthread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+			m_cv.notify_all();
+			for (auto &t : m_workers)
+				t.join();
+		}
+
+		/// \brief number of threads taking part in for_each, including the caller
+		std::size_t threads() const noexcept { return m_workers.size() + 1; }
+
+		/// \brief call func(i) for every i in [0, count) and wait for completion
+		///
+		/// func must not throw and must be safe to call concurrently for
+		/// different indices.
+		template <typename F>
+		void for_each(std::size_t count, F &func)
+		{
+			if (m_workers.empty() || count < 2)
+			{
+				for (std::size_t i = 0; i < count; i++)
+					func(i);
+				return;
+			}
+			dispatch(count, &call<F>, &func);
+		}
+
+	private:
+		using call_t = void (*)(void *, std::size_t);
+
+		template <typename F>
+		static void call(void *func, std::size_t index) { (*static_cast<F *>(func))(index); }
+
+		void dispatch(std::size_t count, call_t func, void *param)
+		{
+			{
+				// workers still leaving the previous batch don't need the
+				// lock, and no worker can join a batch while we hold it
+				std::lock_guard<std::mutex> lock(m_mutex);
+				while (m_busy.load(std::memory_order_acquire) != 0) { }
+				m_func = func;
+				m_param = param;
+				m_count = count;
+				m_next.store(0, std::memory_order_relaxed);
+				m_done.store(0, std::memory_order_relaxed);
+				m_generation.store(m_generation.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+			}
+			m_cv.notify_all();
+			run(func, param, count);
+			while (m_done.load(std::memory_order_acquire) != count) { }
+		}
+
+		void run(call_t func, void *param, std::size_t count)
+		{
+			for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < count; i = m_next.fetch_add(1, std::memory_order_relaxed))
+			{
+				func(param, i);
+				m_done.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+		void worker()
+		{
+			std::uint64_t seen = 0;
+			for (;;)
+			{
+				for (unsigned spin = 0; spin < SPIN_COUNT && m_generation.load(std::memory_order_acquire) == seen; spin++) { }
+
+				call_t func;
+				void *param;
+				std::size_t count;
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_cv.wait(lock, [this, seen] { return m_stop || m_generation.load(std::memory_order_relaxed) != seen; });
+					if (m_stop)
+						return;
+					seen = m_generation.load(std::memory_order_relaxed);
+					func = m_func;
+					param = m_param;
+					count = m_count;
+					m_busy.fetch_add(1, std::memory_order_relaxed);
+				}
+				run(func, param, count);
+				m_busy.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		std::vector<std::thread>   m_workers;
+		std::mutex                 m_mutex;
+		std::condition_variable    m_cv;
+		bool                       m_stop = false;
+		call_t                     m_func = nullptr;
+		void *                     m_param = nullptr;
+		std::size_t                m_count = 0;
+		std::atomic<std::uint64_t> m_generation = 0;
+		std::atomic<std::size_t>   m_next = 0;
+		std::atomic<std::size_t>   m_done = 0;
+		std::atomic<std::size_t>   m_busy = 0;
+	};
+
 
 } // namespace plib
 
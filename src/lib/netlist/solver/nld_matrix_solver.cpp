@@ -756,6 +756,16 @@ namespace netlist::solver
 					/ static_cast<fptype>(this->m_stat_calculations),
 				static_cast<fptype>(this->m_iterative_total)
 					/ static_cast<fptype>(this->m_stat_calculations));
+			if (this->stats() != nullptr)
+			{
+				const auto &timer = this->stats()->m_stat_total_time;
+				log().verbose(
+					"       {1:10} solves in {2:10.6} s ({3:8.3} us per solve)",
+					timer.count(), timer.as_seconds<fptype>(),
+					timer.count() == 0 ? fptype(0)
+					: timer.as_seconds<fptype>() * fptype(1e6)
+						/ static_cast<fptype>(timer.count()));
+			}
 		}
 	}
 
@@ -376,6 +376,9 @@ namespace netlist::solver
 					plib::pfmt("// solver doesn't support static compile\n\n")};
 		}
 
+		// true if an ahead-of-time compiled solver for this matrix was found
+		virtual bool uses_static_solver() const noexcept { return false; }
+
 		// return number of floating point operations for solve
 		constexpr std::size_t ops() const { return m_ops; }
 
@@ -101,7 +101,7 @@ namespace netlist::solver
 				}
 				else
 				{
-					this->state().log().warning("External static solver {1} not found ...", symname);
+					this->state().log().warning("External static solver {1} not found, using the dynamic solver ...", symname);
 				}
 			}
 		}
@@ -110,6 +110,8 @@ namespace netlist::solver
 
 		std::pair<pstring, pstring> create_solver_code(static_compile_target target) override;
 
+		bool uses_static_solver() const noexcept override { return m_proc.resolved(); }
+
 	private:
 
 		using mat_index_type = typename plib::pmatrix_cr<arena_type, FT, SIZE>::index_type;
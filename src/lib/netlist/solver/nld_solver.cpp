@@ -26,6 +26,7 @@
 #include "plib/ptimed_queue.h"
 
 #include <algorithm>
+#include <thread>
 #include <type_traits>
 
 namespace netlist::devices
@@ -67,6 +68,7 @@ namespace netlist::devices
 	{
 		for (auto &s : m_mat_solvers)
 			s->log_stats();
+		m_pool.reset();
 	}
 
 #if 1
@@ -75,12 +77,7 @@ namespace netlist::devices
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t      nthreads = m_params.m_parallel() < 2
-											  ? 1
-											  : std::min(
-											 static_cast<std::size_t>(
-												 m_params.m_parallel()),
-											 plib::omp::get_max_threads());
+		const std::size_t      nthreads = m_pool ? m_pool->threads() : 1;
 		const netlist_time_ext sched(
 			now
 			+ (nthreads <= 1 ? netlist_time_ext::zero()
@@ -104,10 +101,11 @@ namespace netlist::devices
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease
-		// performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// Solvers only share state through their inputs, which are updated
+		// once all of them have been solved, so the solves may run
+		// concurrently. Dispatching costs more than a small solve, hence
+		// this is only done if PARALLEL asks for it.
+		if (nthreads < 2 || p < 2)
 		{
 			if (!KEEP_STATS)
 			{
@@ -125,27 +123,36 @@ namespace netlist::devices
 				}
 				stats()->m_stat_total_time.start();
 			}
-
-			for (std::size_t i = 0; i < p; i++)
-			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
-			}
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p,
-								  [&tmp, &nt, now](std::size_t i)
-								  { nt[i] = tmp[i]->solve(now, "parallel"); });
-			for (std::size_t i = 0; i < p; i++)
+			if (!KEEP_STATS)
 			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
+				auto solve = [&tmp, &nt, now](std::size_t i)
+				{ nt[i] = tmp[i]->solve(now, "parallel"); };
+				m_pool->for_each(p, solve);
+			}
+			else
+			{
+				// each solver is timed on the thread that solves it
+				stats()->m_stat_total_time.stop();
+				auto solve = [&tmp, &nt, now](std::size_t i)
+				{
+					tmp[i]->stats()->m_stat_call_count.inc();
+					auto g(tmp[i]->stats()->m_stat_total_time.guard());
+					nt[i] = tmp[i]->solve(now, "parallel");
+				};
+				m_pool->for_each(p, solve);
+				stats()->m_stat_total_time.start();
 			}
 		}
+
+		for (std::size_t i = 0; i < p; i++)
+		{
+			if (nt[i] != netlist_time::zero())
+				m_queue.push<false>({now + nt[i], tmp[i]});
+			tmp[i]->update_inputs();
+		}
 		if (!m_queue.empty())
 			m_Q_step.net().toggle_and_push_to_queue(
 				static_cast<netlist_time>(m_queue.top().exec_time() - now));
@@ -573,6 +580,26 @@ namespace netlist::devices
 			m_mat_params.push_back(std::move(params));
 			m_mat_solvers.push_back(std::move(ms));
 		}
+
+		// report how much of the netlist runs ahead-of-time compiled code;
+		// static_solvers.cpp is regenerated with "make nlsolvers"
+		const auto static_count = std::count_if(m_mat_solvers.begin(),
+			m_mat_solvers.end(),
+			[](const solver_ptr &s) { return s->uses_static_solver(); });
+		log().verbose("{1} of {2} solvers use static compiled code",
+			static_count, m_mat_solvers.size());
+
+		// start the worker threads if independent groups may be solved in
+		// parallel
+		const auto threads = std::min(
+			static_cast<std::size_t>(std::max(m_params.m_parallel(), 1)),
+			static_cast<std::size_t>(
+				std::max(std::thread::hardware_concurrency(), 1U)));
+		if (threads > 1 && m_mat_solvers.size() > 1)
+		{
+			m_pool = std::make_unique<plib::pthread_pool>(threads - 1);
+			log().verbose("Solving net groups on up to {1} threads", threads);
+		}
 	}
 
 	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(
@@ -14,6 +14,7 @@
 #include "core/logic.h"
 #include "core/state_var.h"
 
+#include "../plib/pmulti_threading.h"
 #include "../plib/pstream.h"
 
 #include <map>
@@ -72,6 +73,9 @@ namespace netlist::devices
 		solver::solver_parameters_t m_params;
 		queue_type                  m_queue;
 
+		// workers for solving groups in parallel, only if PARALLEL > 1
+		std::unique_ptr<plib::pthread_pool> m_pool;
+
 		template <typename FT, int SIZE>
 		solver_ptr create_solver(std::size_t size, const pstring &solver_name,
 								 const solver::solver_parameters_t *params,
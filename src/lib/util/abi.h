@@ -77,6 +77,8 @@
 /// should be used.
 #if defined(__GNUC__) && defined(__MINGW32__) && !defined(__x86_64__) && defined(__i386__)
 	#define MAME_ABI_CXX_MEMBER_CALL __thiscall
+#elif defined(_MSC_VER) && defined(_M_IX86)
+	#define MAME_ABI_CXX_MEMBER_CALL __thiscall
 #else
 	#define MAME_ABI_CXX_MEMBER_CALL
 #endif
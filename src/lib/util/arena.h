@@ -0,0 +1,148 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    arena.h
+
+    Bump allocator for short-lived objects.
+
+    An arena hands out memory from large chunks and never frees
+    individual allocations; everything is given back at once by reset().
+    After a reset, the memory is reused, so a caller that allocates
+    roughly the same amount between resets (e.g. once per frame) stops
+    touching the heap once the arena has grown to fit.
+
+    Nothing allocated from an arena may be used after it's reset.
+
+***************************************************************************/
+#ifndef MAME_UTIL_ARENA_H
+#define MAME_UTIL_ARENA_H
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace util {
+
+// ======================> arena
+
+class arena
+{
+public:
+	arena(std::size_t chunk_size = 0x10000) : m_chunk_size(chunk_size) { }
+	arena(arena const &) = delete;
+	arena &operator=(arena const &) = delete;
+
+	// allocate uninitialised memory
+	void *allocate(std::size_t size, std::size_t align = alignof(std::max_align_t))
+	{
+		assert(align && !(align & (align - 1)));
+		if (!m_chunks.empty())
+		{
+			chunk &current = m_chunks[m_current];
+			std::uintptr_t const base = reinterpret_cast<std::uintptr_t>(current.data.get());
+			std::size_t const offset = ((base + m_offset + align - 1) & ~std::uintptr_t(align - 1)) - base;
+			if ((offset + size) <= current.size)
+			{
+				m_offset = offset + size;
+				return &current.data[offset];
+			}
+		}
+		return allocate_slow(size, align);
+	}
+
+	// release everything allocated since the last reset
+	void reset()
+	{
+		// coalesce if the last round needed more than one chunk
+		if (m_chunks.size() > 1)
+		{
+			std::size_t total = 0;
+			for (chunk const &c : m_chunks)
+				total += c.size;
+			m_chunks.clear();
+			m_chunks.emplace_back(total);
+		}
+		m_current = 0;
+		m_offset = 0;
+	}
+
+private:
+	struct chunk
+	{
+		chunk(std::size_t s) : data(new std::uint8_t[s]), size(s) { }
+
+		std::unique_ptr<std::uint8_t []> data;
+		std::size_t size;
+	};
+
+	void *allocate_slow(std::size_t size, std::size_t align)
+	{
+		// leave room to align the start of the block
+		std::size_t const needed = size + align - 1;
+		if ((m_chunks.size() > (m_current + 1)) && (m_chunks[m_current + 1].size >= needed))
+		{
+			++m_current;
+		}
+		else
+		{
+			std::size_t const grow = m_chunks.empty() ? m_chunk_size : (m_chunks.back().size * 2);
+			m_chunks.emplace_back(std::max(grow, needed));
+			m_current = m_chunks.size() - 1;
+		}
+		m_offset = 0;
+		return allocate(size, align);
+	}
+
+	std::vector<chunk> m_chunks;
+	std::size_t m_current = 0;
+	std::size_t m_offset = 0;
+	std::size_t const m_chunk_size;
+};
+
+
+// ======================> arena_allocator
+
+// allocator for standard containers that uses an arena if supplied, or
+// the heap otherwise
+template <typename T>
+class arena_allocator
+{
+public:
+	using value_type = T;
+
+	arena_allocator(arena *a = nullptr) noexcept : m_arena(a) { }
+	template <typename U> arena_allocator(arena_allocator<U> const &that) noexcept : m_arena(that.get_arena()) { }
+
+	T *allocate(std::size_t n)
+	{
+		if (m_arena)
+			return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T)));
+		else
+			return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T *p, std::size_t n) noexcept
+	{
+		if (!m_arena)
+			std::allocator<T>().deallocate(p, n);
+	}
+
+	arena *get_arena() const noexcept { return m_arena; }
+
+	template <typename U> bool operator==(arena_allocator<U> const &that) const noexcept { return m_arena == that.get_arena(); }
+	template <typename U> bool operator!=(arena_allocator<U> const &that) const noexcept { return m_arena != that.get_arena(); }
+
+private:
+	arena *m_arena;
+};
+
+} // namespace util
+
+#endif // MAME_UTIL_ARENA_H
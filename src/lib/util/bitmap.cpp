@@ -10,8 +10,10 @@
 
 #include "bitmap.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <iterator>
 #include <new>
 
 
@@ -19,6 +21,36 @@
 //  INLINE HELPERS
 //**************************************************************************
 
+//-------------------------------------------------
+//  fill_rows - fill a rectangle of pixels, using
+//  memset when every byte of the colour is the
+//  same (e.g. clearing to zero)
+//-------------------------------------------------
+
+template <typename PixelType>
+inline void fill_rows(PixelType *dest, int32_t rowpixels, int32_t width, int32_t height, PixelType color) noexcept
+{
+	uint8_t bytes[sizeof(PixelType)];
+	std::memcpy(bytes, &color, sizeof(PixelType));
+	bool const uniform = std::all_of(std::begin(bytes), std::end(bytes), [&bytes] (uint8_t b) { return b == bytes[0]; });
+
+	// a rectangle spanning whole rows is one contiguous block
+	if (rowpixels == width)
+	{
+		width *= height;
+		height = 1;
+	}
+
+	for ( ; height > 0; height--, dest += rowpixels)
+	{
+		if (uniform)
+			std::memset(dest, bytes[0], width * sizeof(PixelType));
+		else
+			std::fill_n(dest, width, color);
+	}
+}
+
+
 //-------------------------------------------------
 //  compute_rowpixels - compute a rowpixels value
 //-------------------------------------------------
@@ -437,23 +469,19 @@ void bitmap_t::fill(uint64_t color, const rectangle &bounds) noexcept
 		switch (m_bpp)
 		{
 		case 8:
-			for (int32_t y = fill.top(); y <= fill.bottom(); y++)
-				std::fill_n(&pixt<uint8_t>(y, fill.left()), fill.width(), uint8_t(color));
+			fill_rows(&pixt<uint8_t>(fill.top(), fill.left()), m_rowpixels, fill.width(), fill.height(), uint8_t(color));
 			break;
 
 		case 16:
-			for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
-				std::fill_n(&pixt<uint16_t>(y, fill.left()), fill.width(), uint16_t(color));
+			fill_rows(&pixt<uint16_t>(fill.top(), fill.left()), m_rowpixels, fill.width(), fill.height(), uint16_t(color));
 			break;
 
 		case 32:
-			for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
-				std::fill_n(&pixt<uint32_t>(y, fill.left()), fill.width(), uint32_t(color));
+			fill_rows(&pixt<uint32_t>(fill.top(), fill.left()), m_rowpixels, fill.width(), fill.height(), uint32_t(color));
 			break;
 
 		case 64:
-			for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
-				std::fill_n(&pixt<uint64_t>(y, fill.left()), fill.width(), uint64_t(color));
+			fill_rows(&pixt<uint64_t>(fill.top(), fill.left()), m_rowpixels, fill.width(), fill.height(), uint64_t(color));
 			break;
 		}
 	}
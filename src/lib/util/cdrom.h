@@ -267,8 +267,6 @@ private:
 	// ECC tables
 	static const uint8_t ecclow[256];
 	static const uint8_t ecchigh[256];
-	static const uint16_t poffsets[ECC_P_NUM_BYTES][ECC_P_COMP];
-	static const uint16_t qoffsets[ECC_Q_NUM_BYTES][ECC_Q_COMP];
 
 	/** @brief  The chd. */
 	chd_file *           chd;                /* CHD file */
@@ -283,8 +281,7 @@ private:
 	inline uint32_t logical_to_chd_lba(uint32_t physlba, uint32_t &tracknum) const;
 
 	static void get_info_from_type_string(const char *typestring, uint32_t *trktype, uint32_t *datasize);
-	static uint8_t ecc_source_byte(const uint8_t *sector, uint32_t offset);
-	static void ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2);
+	static void ecc_compute(const uint8_t *sector, uint8_t *codes);
 	std::error_condition read_partial_sector(void *dest, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t startoffs, uint32_t length, bool phys);
 
 	static std::string get_file_path(std::string &path);
@@ -14,6 +14,7 @@
 #include "coretmpl.h"
 #include "flac.h"
 #include "hashing.h"
+#include "lrucache.h"
 #include "multibyte.h"
 
 #include "eminline.h"
@@ -25,7 +26,9 @@
 #include <cstddef>
 #include <cstdlib>
 #include <ctime>
+#include <limits>
 #include <new>
+#include <thread>
 #include <tuple>
 
 
@@ -124,6 +127,73 @@ struct chd_file::metadata_hash
 };
 
 
+// ======================> hunk_cache
+
+// keeps recently decompressed hunks, and decompresses the hunks following
+// a run of sequential reads on another thread so they're ready by the
+// time they're asked for
+class chd_file::hunk_cache
+{
+public:
+	hunk_cache(chd_file &chd, uint32_t hunks) : m_chd(chd), m_cache(std::max(hunks, READ_AHEAD_HUNKS * 2)) { }
+	~hunk_cache();
+
+	bool lookup(uint32_t hunknum, uint8_t *dest);
+	void store(uint32_t hunknum, uint8_t const *source);
+	std::error_condition read_batch(uint32_t hunknum, uint32_t count, uint8_t *dest);
+	std::error_condition prefetch(uint32_t hunknum, uint32_t count);
+	uint64_t hits() const noexcept { return m_hits; }
+	uint64_t misses() const noexcept { return m_misses; }
+
+private:
+	static constexpr uint32_t SEQUENTIAL_READS = 2;     // consecutive hunks read before reading ahead
+	static constexpr uint32_t READ_AHEAD_HUNKS = 8;     // how far ahead of the reader to stay
+	static constexpr uint32_t BATCH_ITEM_HUNKS = 4;     // fewest hunks worth giving a thread of a batch
+
+	// codecs and buffer for one thread of a batch
+	struct batch_decoder
+	{
+		chd_decompressor::ptr   decompressor[4];
+		std::vector<uint8_t>    compressed;
+	};
+
+	// a run of hunks one thread of a batch decompresses
+	struct batch_item
+	{
+		hunk_cache *            cache;
+		batch_decoder *         decoder;
+		uint32_t                hunknum;
+		uint32_t                count;
+		uint8_t *               dest;
+		std::vector<uint32_t>   deferred;   // hunks from the parent, left for the reader
+		std::error_condition    err;
+	};
+
+	bool start();
+	void create_codecs(chd_decompressor::ptr (&decompressor)[4], std::vector<uint8_t> &compressed);
+	static void *work_static(void *param, int threadid);
+	void work();
+	static void *batch_static(void *param, int threadid);
+
+	chd_file &              m_chd;              // file we're caching hunks of
+	osd_work_queue *        m_queue = nullptr;  // queue the reading ahead is done on
+	chd_decompressor::ptr   m_decompressor[4];  // our own codecs, as they keep state
+	std::vector<uint8_t>    m_compressed;       // our own compressed data buffer
+	std::mutex              m_mutex;            // guards everything below
+	util::lru_cache_map<uint32_t, std::vector<uint8_t> > m_cache; // decompressed hunks
+	uint32_t                m_last = ~uint32_t(0); // last hunk asked for
+	uint32_t                m_run = 0;          // consecutive hunks asked for
+	uint32_t                m_next = 0;         // next hunk to read ahead
+	uint32_t                m_end = 0;          // hunk to stop reading ahead at
+	bool                    m_running = false;  // is a work item queued?
+	std::atomic<uint64_t>   m_hits = 0;         // hunks found in the cache
+	std::atomic<uint64_t>   m_misses = 0;       // hunks we had to decompress ourselves
+
+	osd_work_queue *        m_batch_queue = nullptr; // queue batches are decompressed on
+	std::vector<std::unique_ptr<batch_decoder> > m_batch_decoders; // one per thread of a batch
+};
+
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -164,7 +234,16 @@ inline std::error_condition chd_file::file_read(uint64_t offset, void *dest, uin
 	if (UNEXPECTED(!m_file))
 		return std::error_condition(error::NOT_OPEN);
 
+	// copy straight out of the file if it's mapped; that doesn't need the lock
+	const uint8_t *const view = file_view(offset, length);
+	if (view)
+	{
+		memcpy(dest, view, length);
+		return std::error_condition();
+	}
+
 	// seek and read
+	std::lock_guard<std::mutex> guard(m_file_mutex);
 	std::error_condition err;
 	err = m_file->seek(offset, SEEK_SET);
 	if (UNEXPECTED(err))
@@ -177,6 +256,20 @@ inline std::error_condition chd_file::file_read(uint64_t offset, void *dest, uin
 }
 
 
+//-------------------------------------------------
+//  file_view - get direct access to data in the
+//  file, or nullptr if it has to be read
+//-------------------------------------------------
+
+inline const uint8_t *chd_file::file_view(uint64_t offset, uint32_t length) const noexcept
+{
+	if (m_fileview && (offset <= m_fileviewbytes) && (length <= (m_fileviewbytes - offset)))
+		return m_fileview + offset;
+	else
+		return nullptr;
+}
+
+
 //-------------------------------------------------
 //  file_write - write to the file at the given
 //  offset.
@@ -269,6 +362,272 @@ inline uint8_t chd_file::bits_for_value(uint64_t value) noexcept
 
 
 
+//**************************************************************************
+//  HUNK CACHE
+//**************************************************************************
+
+namespace {
+
+// bytes of decompressed hunks to keep for each compressed file
+std::atomic<std::size_t> s_cache_bytes = 0;
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  ~hunk_cache - stop reading ahead and wait for
+//  the work item to finish
+//-------------------------------------------------
+
+chd_file::hunk_cache::~hunk_cache()
+{
+	if (m_queue)
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_end = m_next;
+		}
+		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 10);
+		osd_work_queue_free(m_queue);
+	}
+	if (m_batch_queue)
+		osd_work_queue_free(m_batch_queue);
+}
+
+
+//-------------------------------------------------
+//  lookup - note a read of the given hunk, start
+//  reading ahead if it continues a run, and copy
+//  it out if it's in the cache
+//-------------------------------------------------
+
+bool chd_file::hunk_cache::lookup(uint32_t hunknum, uint8_t *dest)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+
+	// partial reads of the same hunk don't break a run
+	if (hunknum == m_last + 1)
+		m_run++;
+	else if (hunknum != m_last)
+		m_run = 0;
+	m_last = hunknum;
+
+	if (m_run < SEQUENTIAL_READS)
+	{
+		// stop reading ahead of a run that's ended
+		m_end = m_next;
+	}
+	else
+	{
+		// keep a window of hunks ahead of the reader
+		if ((m_next <= hunknum) || (m_next > hunknum + READ_AHEAD_HUNKS))
+			m_next = hunknum + 1;
+		m_end = std::min(hunknum + 1 + READ_AHEAD_HUNKS, m_chd.m_hunkcount);
+		if (!m_running && (m_next < m_end) && start())
+		{
+			m_running = true;
+			osd_work_item_queue(m_queue, &hunk_cache::work_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+	}
+
+	auto const found = m_cache.find(hunknum);
+	if (found == m_cache.end())
+	{
+		m_misses++;
+		return false;
+	}
+	memcpy(dest, &found->second[0], m_chd.m_hunkbytes);
+	m_hits++;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  store - keep a hunk the reader decompressed
+//  itself
+//-------------------------------------------------
+
+void chd_file::hunk_cache::store(uint32_t hunknum, uint8_t const *source)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+	std::vector<uint8_t> &entry = m_cache[hunknum];
+	entry.assign(source, source + m_chd.m_hunkbytes);
+}
+
+
+//-------------------------------------------------
+//  start - set up codecs and a queue the first
+//  time there's something to read ahead
+//-------------------------------------------------
+
+bool chd_file::hunk_cache::start()
+{
+	if (m_queue)
+		return true;
+
+	create_codecs(m_decompressor, m_compressed);
+	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	return m_queue != nullptr;
+}
+
+
+//-------------------------------------------------
+//  create_codecs - make a set of codecs and a
+//  buffer for another thread to decompress with
+//-------------------------------------------------
+
+void chd_file::hunk_cache::create_codecs(chd_decompressor::ptr (&decompressor)[4], std::vector<uint8_t> &compressed)
+{
+	for (int decompnum = 0; decompnum < std::size(decompressor); decompnum++)
+		decompressor[decompnum] = chd_codec_list::new_decompressor(m_chd.m_compression[decompnum], m_chd);
+	compressed.resize(m_chd.m_hunkbytes);
+}
+
+
+//-------------------------------------------------
+//  read_batch - decompress a run of hunks split
+//  between several threads, each with its own
+//  codecs; hunks that come from the parent are
+//  read afterwards on the calling thread
+//-------------------------------------------------
+
+std::error_condition chd_file::hunk_cache::read_batch(uint32_t hunknum, uint32_t count, uint8_t *dest)
+{
+	uint32_t const threads = std::min<uint32_t>(std::max(std::thread::hardware_concurrency(), 1U), count / BATCH_ITEM_HUNKS);
+	if (!m_batch_queue && (threads > 1))
+		m_batch_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (!m_batch_queue || (threads <= 1))
+	{
+		for (uint32_t index = 0; index < count; index++)
+		{
+			std::error_condition const err = m_chd.read_hunk(hunknum + index, dest + index * m_chd.m_hunkbytes);
+			if (UNEXPECTED(err))
+				return err;
+		}
+		return std::error_condition();
+	}
+
+	// split the run into contiguous pieces, one per thread
+	while (m_batch_decoders.size() < threads)
+	{
+		auto &decoder = *m_batch_decoders.emplace_back(std::make_unique<batch_decoder>());
+		create_codecs(decoder.decompressor, decoder.compressed);
+	}
+	std::vector<batch_item> items(threads);
+	for (uint32_t index = 0, first = 0; index < threads; index++)
+	{
+		uint32_t const last = uint64_t(count) * (index + 1) / threads;
+		items[index].cache = this;
+		items[index].decoder = m_batch_decoders[index].get();
+		items[index].hunknum = hunknum + first;
+		items[index].count = last - first;
+		items[index].dest = dest + uint64_t(first) * m_chd.m_hunkbytes;
+		first = last;
+	}
+	for (batch_item &item : items)
+		osd_work_item_queue(m_batch_queue, &hunk_cache::batch_static, &item, WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_batch_queue, osd_ticks_per_second() * 100);
+
+	// report the first error in the run, after picking up anything left over
+	for (batch_item &item : items)
+	{
+		if (UNEXPECTED(item.err))
+			return item.err;
+		for (uint32_t const deferred : item.deferred)
+		{
+			std::error_condition const err = m_chd.read_hunk_data(deferred, dest + uint64_t(deferred - hunknum) * m_chd.m_hunkbytes, m_chd.m_decompressor, m_chd.m_compressed, false);
+			if (UNEXPECTED(err))
+				return err;
+		}
+	}
+	return std::error_condition();
+}
+
+//-------------------------------------------------
+//  prefetch - decompress a run of hunks as a
+//  batch and keep them, for a reader that will
+//  ask for them a piece at a time
+//-------------------------------------------------
+
+std::error_condition chd_file::hunk_cache::prefetch(uint32_t hunknum, uint32_t count)
+{
+	// leave room for reading ahead, so the start of the run isn't pushed out before it's used
+	if (m_cache.max_size() <= READ_AHEAD_HUNKS)
+		return std::error_condition();
+	count = std::min<uint32_t>(count, m_cache.max_size() - READ_AHEAD_HUNKS);
+
+	// skip what's already there
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		while (count && (m_cache.find(hunknum) != m_cache.end()))
+		{
+			hunknum++;
+			count--;
+		}
+	}
+	if (count < (BATCH_ITEM_HUNKS * 2))
+		return std::error_condition();
+
+	std::vector<uint8_t> batch(uint64_t(count) * m_chd.m_hunkbytes);
+	std::error_condition const err = read_batch(hunknum, count, &batch[0]);
+	if (UNEXPECTED(err))
+		return err;
+	for (uint32_t index = 0; index < count; index++)
+		store(hunknum + index, &batch[uint64_t(index) * m_chd.m_hunkbytes]);
+	return std::error_condition();
+}
+
+void *chd_file::hunk_cache::batch_static(void *param, int threadid)
+{
+	batch_item &item = *reinterpret_cast<batch_item *>(param);
+	chd_file &chd = item.cache->m_chd;
+	for (uint32_t index = 0; (index < item.count) && !item.err; index++)
+	{
+		uint32_t const hunknum = item.hunknum + index;
+		std::error_condition const err = chd.read_hunk_data(hunknum, item.dest + uint64_t(index) * chd.m_hunkbytes, item.decoder->decompressor, item.decoder->compressed, true);
+		if (err == error::OPERATION_PENDING)
+			item.deferred.push_back(hunknum);
+		else
+			item.err = err;
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  work - read hunks until we catch up with the
+//  end of the window
+//-------------------------------------------------
+
+void *chd_file::hunk_cache::work_static(void *param, int threadid)
+{
+	reinterpret_cast<hunk_cache *>(param)->work();
+	return nullptr;
+}
+
+void chd_file::hunk_cache::work()
+{
+	std::vector<uint8_t> buffer;
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_next < m_end)
+	{
+		uint32_t const hunknum = m_next++;
+		if (m_cache.find(hunknum) != m_cache.end())
+			continue;
+
+		// errors are left for the reader to find when it gets there
+		lock.unlock();
+		buffer.resize(m_chd.m_hunkbytes);
+		bool const good = !m_chd.read_hunk_data(hunknum, &buffer[0], m_decompressor, m_compressed, true);
+		lock.lock();
+		if (good)
+			m_cache[hunknum] = std::move(buffer);
+	}
+	m_running = false;
+}
+
+
+
 //**************************************************************************
 //  CHD FILE MANAGEMENT
 //**************************************************************************
@@ -533,6 +892,56 @@ std::error_condition chd_file::hunk_info(uint32_t hunknum, chd_codec_type &compr
 	return std::error_condition();
 }
 
+/**
+ * @fn  uint64_t chd_file::cache_hits() const
+ *
+ * @brief   -------------------------------------------------
+ *            cache_hits - return the number of hunks read
+ *            from the decompressed hunk cache
+ *          -------------------------------------------------.
+ *
+ * @return  A count of hunks.
+ */
+
+uint64_t chd_file::cache_hits() const noexcept
+{
+	return m_hunk_cache ? m_hunk_cache->hits() : 0;
+}
+
+/**
+ * @fn  uint64_t chd_file::cache_misses() const
+ *
+ * @brief   -------------------------------------------------
+ *            cache_misses - return the number of hunks
+ *            that had to be decompressed when read
+ *          -------------------------------------------------.
+ *
+ * @return  A count of hunks.
+ */
+
+uint64_t chd_file::cache_misses() const noexcept
+{
+	return m_hunk_cache ? m_hunk_cache->misses() : 0;
+}
+
+/**
+ * @fn  void chd_file::set_cache_size(std::size_t bytes)
+ *
+ * @brief   -------------------------------------------------
+ *            set_cache_size - set how many bytes of
+ *            decompressed hunks to keep for each
+ *            compressed file opened from now on; hunks
+ *            read ahead are cached regardless
+ *          -------------------------------------------------.
+ *
+ * @param   bytes   The cache size in bytes.
+ */
+
+void chd_file::set_cache_size(std::size_t bytes) noexcept
+{
+	s_cache_bytes = bytes;
+}
+
 /**
  * @fn  void chd_file::set_raw_sha1(sha1_t rawdata)
  *
@@ -853,7 +1262,12 @@ std::error_condition chd_file::open(
 
 void chd_file::close()
 {
+	// stop reading ahead before the file goes away
+	m_hunk_cache.reset();
+
 	// reset file characteristics
+	m_fileview = nullptr;
+	m_fileviewbytes = 0;
 	m_file.reset();
 	m_allow_reads = false;
 	m_allow_writes = false;
@@ -1026,6 +1440,111 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 
 	auto *const dest = reinterpret_cast<uint8_t *>(buffer);
 
+	// recently read hunks, and ones the read-ahead thread got to first, are cached
+	if (!m_hunk_cache)
+		return read_hunk_data(hunknum, dest, m_decompressor, m_compressed, false);
+	if (m_hunk_cache->lookup(hunknum, dest))
+		return std::error_condition();
+
+	std::error_condition const err = read_hunk_data(hunknum, dest, m_decompressor, m_compressed, false);
+	if (!err)
+		m_hunk_cache->store(hunknum, dest);
+	return err;
+}
+
+/**
+ * @fn  std::error_condition chd_file::read_hunks(uint32_t hunknum, uint32_t count, void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunks - read a run of consecutive hunks
+ *            into one buffer; runs of compressed hunks
+ *            are decompressed on several threads
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The first hunk.
+ * @param   count           The number of hunks.
+ * @param [in,out]  buffer  Buffer for count hunks.
+ *
+ * @return  An error condition.
+ */
+
+std::error_condition chd_file::read_hunks(uint32_t hunknum, uint32_t count, void *buffer)
+{
+	// punt if no file
+	if (UNEXPECTED(!m_file))
+		return std::error_condition(error::NOT_OPEN);
+
+	// return an error if out of range
+	if (UNEXPECTED((hunknum >= m_hunkcount) || (count > m_hunkcount - hunknum)))
+		return std::error_condition(error::HUNK_OUT_OF_RANGE);
+
+	auto *const dest = reinterpret_cast<uint8_t *>(buffer);
+	if (m_hunk_cache)
+		return m_hunk_cache->read_batch(hunknum, count, dest);
+
+	for (uint32_t index = 0; index < count; index++)
+	{
+		std::error_condition const err = read_hunk(hunknum + index, dest + uint64_t(index) * m_hunkbytes);
+		if (UNEXPECTED(err))
+			return err;
+	}
+	return std::error_condition();
+}
+
+/**
+ * @fn  std::error_condition chd_file::prefetch_hunks(uint32_t hunknum, uint32_t count)
+ *
+ * @brief   -------------------------------------------------
+ *            prefetch_hunks - decompress a run of hunks on
+ *            several threads into the hunk cache, ahead of
+ *            reads that will cover it in small pieces; only
+ *            as much as the cache holds is fetched, and
+ *            uncompressed files aren't cached so there's
+ *            nothing to do
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The first hunk.
+ * @param   count           The number of hunks.
+ *
+ * @return  An error condition.
+ */
+
+std::error_condition chd_file::prefetch_hunks(uint32_t hunknum, uint32_t count)
+{
+	// punt if no file
+	if (UNEXPECTED(!m_file))
+		return std::error_condition(error::NOT_OPEN);
+
+	// clip to the end of the file
+	if (hunknum >= m_hunkcount)
+		return std::error_condition();
+	count = std::min(count, m_hunkcount - hunknum);
+
+	return m_hunk_cache ? m_hunk_cache->prefetch(hunknum, count) : std::error_condition();
+}
+
+/**
+ * @fn  std::error_condition chd_file::read_hunk_data(uint32_t hunknum, uint8_t *dest, chd_decompressor::ptr const (&decompressor)[4], std::vector<uint8_t> &compbuf, bool worker)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunk_data - read and decompress a hunk
+ *            with the given codecs and buffer; from the
+ *            read-ahead thread, hunks that come from the
+ *            parent are refused, as the parent isn't ours
+ *            to use from another thread
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum             The hunknum.
+ * @param [in,out]  dest        The destination buffer.
+ * @param   decompressor        The codecs to decompress with.
+ * @param [in,out]  compbuf     Buffer for compressed data.
+ * @param   worker              true if called from the read-ahead thread.
+ *
+ * @return  An error condition.
+ */
+
+std::error_condition chd_file::read_hunk_data(uint32_t hunknum, uint8_t *dest, chd_decompressor::ptr const (&decompressor)[4], std::vector<uint8_t> &compbuf, bool worker)
+{
 	// wrap this for clean reporting
 	try
 	{
@@ -1045,10 +1564,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 				case V34_MAP_ENTRY_TYPE_COMPRESSED:
 					{
 						uint32_t const blocklen = get_u16be(&rawmap[12]) | (uint32_t(rawmap[14]) << 16);
-						std::error_condition err = file_read(blockoffs, &m_compressed[0], blocklen);
-						if (UNEXPECTED(err))
-							return err;
-						m_decompressor[0]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
+						const uint8_t *src = file_view(blockoffs, blocklen);
+						if (!src)
+						{
+							std::error_condition err = file_read(blockoffs, &compbuf[0], blocklen);
+							if (UNEXPECTED(err))
+								return err;
+							src = &compbuf[0];
+						}
+						decompressor[0]->decompress(src, blocklen, dest, m_hunkbytes);
 						if (UNEXPECTED(!nocrc && (util::crc32_creator::simple(dest, m_hunkbytes) != blockcrc)))
 							return std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
@@ -1073,11 +1597,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					return std::error_condition();
 
 				case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-					return read_hunk(blockoffs, dest);
+					if (UNEXPECTED(blockoffs >= m_hunkcount))
+						return std::error_condition(error::HUNK_OUT_OF_RANGE);
+					return read_hunk_data(blockoffs, dest, decompressor, compbuf, worker);
 
 				case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 					if (UNEXPECTED(m_parent_missing))
 						return std::error_condition(error::REQUIRES_PARENT);
+					if (worker)
+						return std::error_condition(error::OPERATION_PENDING);
 					return m_parent->read_hunk(blockoffs, dest);
 				}
 			}
@@ -1097,7 +1625,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					else if (UNEXPECTED(m_parent_missing))
 						return std::error_condition(error::REQUIRES_PARENT);
 					else if (m_parent)
-						return m_parent->read_hunk(hunknum, dest);
+						return worker ? std::error_condition(error::OPERATION_PENDING) : m_parent->read_hunk(hunknum, dest);
 					else
 						memset(dest, 0, m_hunkbytes);
 					return std::error_condition();
@@ -1115,14 +1643,19 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					case COMPRESSION_TYPE_2:
 					case COMPRESSION_TYPE_3:
 						{
-							std::error_condition err = file_read(blockoffs, &m_compressed[0], blocklen);
-							if (UNEXPECTED(err))
-								return err;
-							auto &decompressor = *m_decompressor[rawmap[0]];
-							decompressor.decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
-							util::crc16_t const calculated = !decompressor.lossy()
+							const uint8_t *src = file_view(blockoffs, blocklen);
+							if (!src)
+							{
+								std::error_condition err = file_read(blockoffs, &compbuf[0], blocklen);
+								if (UNEXPECTED(err))
+									return err;
+								src = &compbuf[0];
+							}
+							auto &codec = *decompressor[rawmap[0]];
+							codec.decompress(src, blocklen, dest, m_hunkbytes);
+							util::crc16_t const calculated = !codec.lossy()
 									? util::crc16_creator::simple(dest, m_hunkbytes)
-									: util::crc16_creator::simple(&m_compressed[0], blocklen);
+									: util::crc16_creator::simple(src, blocklen);
 							if (UNEXPECTED(calculated != blockcrc))
 								return std::error_condition(error::DECOMPRESSION_ERROR);
 							return std::error_condition();
@@ -1139,11 +1672,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						}
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						if (UNEXPECTED(blockoffs >= m_hunkcount))
+							return std::error_condition(error::HUNK_OUT_OF_RANGE);
+						return read_hunk_data(blockoffs, dest, decompressor, compbuf, worker);
 
 					case COMPRESSION_PARENT:
 						if (UNEXPECTED(m_parent_missing))
 							return std::error_condition(error::REQUIRES_PARENT);
+						if (worker)
+							return std::error_condition(error::OPERATION_PENDING);
 						return m_parent->read_bytes(blockoffs * m_parent->unit_bytes(), dest, m_hunkbytes);
 					}
 				}
@@ -1319,10 +1856,17 @@ std::error_condition chd_file::read_bytes(uint64_t offset, void *buffer, uint32_
 
 		if ((startoffs == 0) && (endoffs == m_hunkbytes - 1) && (curhunk != m_cachehunk))
 		{
-			// if it's a full block, just read directly from disk unless it's the cached hunk
-			std::error_condition err = read_hunk(curhunk, dest);
+			// if it's a full block, just read directly from disk unless it's the cached hunk;
+			// a run of them is read in one go
+			uint32_t const last_full = ((offset + bytes) % m_hunkbytes) ? (last_hunk - 1) : last_hunk;
+			uint32_t count = 1;
+			while (((curhunk + count) <= last_full) && ((curhunk + count) != m_cachehunk))
+				count++;
+			std::error_condition err = (count > 1) ? read_hunks(curhunk, count, dest) : read_hunk(curhunk, dest);
 			if (UNEXPECTED(err))
 				return err;
+			curhunk += count - 1;
+			dest += uint64_t(count - 1) * m_hunkbytes;
 		}
 		else
 		{
@@ -1773,6 +2317,9 @@ std::error_condition chd_file::codec_configure(chd_codec_type codec, int param,
 		for (int codecnum = 0; codecnum < std::size(m_compression); codecnum++)
 			if (m_compression[codecnum] == codec)
 			{
+				// the cache would hold output the codec no longer gives, and the
+				// read-ahead thread's codecs wouldn't be configured the same way
+				m_hunk_cache.reset();
 				m_decompressor[codecnum]->configure(param, config);
 				return std::error_condition();
 			}
@@ -2586,6 +3133,16 @@ std::error_condition chd_file::open_common(bool writeable, const open_parent_fun
 		if (UNEXPECTED(writeable && !m_allow_writes))
 			throw std::error_condition(error::FILE_NOT_WRITEABLE);
 
+		// if the file is on disk and read-only, or already in memory,
+		// decompress straight from it rather than copying hunks out first
+		auto *const corefile = !writeable ? dynamic_cast<util::core_file *>(m_file.get()) : nullptr;
+		uint64_t filebytes;
+		if (corefile && !corefile->length(filebytes) && (std::numeric_limits<size_t>::max() >= filebytes))
+		{
+			m_fileview = reinterpret_cast<const uint8_t *>(corefile->view(0, size_t(filebytes)));
+			m_fileviewbytes = m_fileview ? filebytes : 0;
+		}
+
 		// make sure we have a parent if we need one (and don't if we don't)
 		if (parentsha1 != util::sha1_t::null)
 		{
@@ -2604,6 +3161,11 @@ std::error_condition chd_file::open_common(bool writeable, const open_parent_fun
 
 		// finish opening the file
 		create_open_common();
+
+		// compressed files can't be written to, so their hunks are safe to
+		// cache and read ahead; uncompressed ones get nothing from it
+		if (!m_allow_writes && compressed())
+			m_hunk_cache = std::make_unique<hunk_cache>(*this, uint32_t(std::min<uint64_t>(s_cache_bytes / m_hunkbytes, m_hunkcount)));
 		return std::error_condition();
 	}
 	catch (std::error_condition const &err)
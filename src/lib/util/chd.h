@@ -19,6 +19,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -315,8 +316,11 @@ public:
 	util::sha1_t raw_sha1() const noexcept;
 	util::sha1_t parent_sha1() const noexcept;
 	std::error_condition hunk_info(uint32_t hunknum, chd_codec_type &compressor, uint32_t &compbytes);
+	uint64_t cache_hits() const noexcept;
+	uint64_t cache_misses() const noexcept;
 
 	// setters
+	static void set_cache_size(std::size_t bytes) noexcept;
 	std::error_condition set_raw_sha1(util::sha1_t rawdata) noexcept;
 	std::error_condition set_parent_sha1(util::sha1_t parent) noexcept;
 
@@ -336,6 +340,8 @@ public:
 	// read/write
 	std::error_condition codec_process_hunk(uint32_t hunknum);
 	std::error_condition read_hunk(uint32_t hunknum, void *buffer);
+	std::error_condition read_hunks(uint32_t hunknum, uint32_t count, void *buffer);
+	std::error_condition prefetch_hunks(uint32_t hunknum, uint32_t count);
 	std::error_condition write_hunk(uint32_t hunknum, const void *buffer);
 	std::error_condition read_units(uint64_t unitnum, void *buffer, uint32_t count = 1);
 	std::error_condition write_units(uint64_t unitnum, const void *buffer, uint32_t count = 1);
@@ -369,11 +375,13 @@ public:
 private:
 	struct metadata_entry;
 	struct metadata_hash;
+	class hunk_cache;
 
 	// inline helpers
 	util::sha1_t be_read_sha1(const uint8_t *base) const noexcept;
 	void be_write_sha1(uint8_t *base, util::sha1_t value) noexcept;
 	std::error_condition file_read(uint64_t offset, void *dest, uint32_t length) const noexcept;
+	const uint8_t *file_view(uint64_t offset, uint32_t length) const noexcept;
 	std::error_condition file_write(uint64_t offset, const void *source, uint32_t length) noexcept;
 	uint64_t file_append(const void *source, uint32_t length, uint32_t alignment = 0);
 	static uint8_t bits_for_value(uint64_t value) noexcept;
@@ -389,6 +397,7 @@ private:
 	std::error_condition open_common(bool writeable, const open_parent_func &open_parent);
 	void create_open_common();
 	std::error_condition verify_proper_compression_append(uint32_t hunknum) const noexcept;
+	std::error_condition read_hunk_data(uint32_t hunknum, uint8_t *dest, chd_decompressor::ptr const (&decompressor)[4], std::vector<uint8_t> &compbuf, bool worker);
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
 	void hunk_copy_from_self(uint32_t hunknum, uint32_t otherhunk);
 	void hunk_copy_from_parent(uint32_t hunknum, uint64_t parentunit);
@@ -399,6 +408,8 @@ private:
 
 	// file characteristics
 	util::random_read_write::ptr m_file;        // handle to the open core file
+	const uint8_t *         m_fileview;         // file contents, if directly accessible
+	uint64_t                m_fileviewbytes;    // size of directly accessible contents
 	bool                    m_allow_reads;      // permit reads from this CHD?
 	bool                    m_allow_writes;     // permit writes to this CHD?
 
@@ -433,6 +444,8 @@ private:
 	// caching
 	std::vector<uint8_t>    m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                m_cachehunk;        // which hunk is in the cache?
+	std::unique_ptr<hunk_cache> m_hunk_cache;   // recently decompressed hunks, and ones read ahead
+	mutable std::mutex      m_file_mutex;       // keeps the read-ahead thread's file access apart from ours
 };
 
 
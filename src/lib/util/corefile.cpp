@@ -61,6 +61,7 @@ public:
 	virtual int getc() override { return m_file.getc(); }
 	virtual int ungetc(int c) override { return m_file.ungetc(c); }
 	virtual char *gets(char *s, int n) override { return m_file.gets(s, n); }
+	virtual void const *view(std::uint64_t offset, std::size_t length) noexcept override { return m_file.view(offset, length); }
 
 	virtual int puts(std::string_view s) override { return m_file.puts(s); }
 	virtual int vprintf(util::format_argument_pack<char> const &args) override { return m_file.vprintf(args); }
@@ -176,6 +177,7 @@ public:
 	virtual std::error_condition write_some_at(std::uint64_t offset, void const *buffer, std::size_t length, std::size_t &actual) noexcept override { actual = 0; return std::errc::bad_file_descriptor; }
 
 	void const *buffer() const { return m_data; }
+	virtual void const *view(std::uint64_t offset, std::size_t length) noexcept override;
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
 
@@ -227,6 +229,8 @@ public:
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
 
+	virtual void const *view(std::uint64_t offset, std::size_t length) noexcept override;
+
 protected:
 	bool is_buffered(std::uint64_t offset) const noexcept { return (offset >= m_bufferbase) && (offset < (m_bufferbase + m_bufferbytes)); }
 
@@ -234,6 +238,8 @@ private:
 	static constexpr std::size_t FILE_BUFFER_SIZE = 512;
 
 	osd_file::ptr   m_file;                     // OSD file handle
+	void const *    m_mapped = nullptr;         // file contents, if mapped
+	bool            m_map_failed = false;       // don't try to map again
 	std::uint64_t   m_bufferbase = 0U;          // base offset of internal buffer
 	std::uint32_t   m_bufferbytes = 0U;         // bytes currently loaded into buffer
 	std::uint8_t    m_buffer[FILE_BUFFER_SIZE]; // buffer data
@@ -663,6 +669,18 @@ std::error_condition core_in_memory_file::read_some_at(std::uint64_t offset, voi
 }
 
 
+//-------------------------------------------------
+//  view - get direct access to file data
+//-------------------------------------------------
+
+void const *core_in_memory_file::view(std::uint64_t offset, std::size_t length) noexcept
+{
+	if (!m_data || (offset > size()) || (length > (size() - offset)))
+		return nullptr;
+	return reinterpret_cast<std::uint8_t const *>(m_data) + offset;
+}
+
+
 //-------------------------------------------------
 //  truncate - truncate a file
 //-------------------------------------------------
@@ -717,6 +735,13 @@ std::error_condition core_osd_file::read_some_at(std::uint64_t offset, void *buf
 	// flush any buffered char
 	clear_putback();
 
+	// if the file's mapped, there's no need to go through the OSD layer
+	if (m_mapped)
+	{
+		actual = (offset < size()) ? safe_buffer_copy(m_mapped, std::size_t(offset), std::size_t(size()), buffer, 0, length) : 0U;
+		return std::error_condition();
+	}
+
 	actual = 0U;
 	std::error_condition err;
 
@@ -797,6 +822,30 @@ std::error_condition core_osd_file::write_some_at(std::uint64_t offset, void con
 }
 
 
+//-------------------------------------------------
+//  view - get direct access to file data
+//-------------------------------------------------
+
+void const *core_osd_file::view(std::uint64_t offset, std::size_t length) noexcept
+{
+	// writing or truncating would change the data under the caller, so only map read-only files
+	if (!m_file || write_access() || (offset > size()) || (length > (size() - offset)))
+		return nullptr;
+
+	// map the whole file the first time it's needed
+	if (!m_mapped && !m_map_failed)
+	{
+		if (!size() || m_file->map(size(), m_mapped))
+		{
+			m_mapped = nullptr;
+			m_map_failed = true;
+		}
+	}
+
+	return m_mapped ? (reinterpret_cast<std::uint8_t const *>(m_mapped) + offset) : nullptr;
+}
+
+
 //-------------------------------------------------
 //  truncate - truncate a file
 //-------------------------------------------------
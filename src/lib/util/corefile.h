@@ -80,6 +80,11 @@ public:
 	static std::error_condition load(std::string_view filename, void **data, std::size_t &length) noexcept;
 	static std::error_condition load(std::string_view filename, std::vector<uint8_t> &data) noexcept;
 
+	// get direct read-only access to part of the file without copying, or nullptr if it isn't available
+	// (files held in memory always allow this, files on disk only if opened read-only and the OS can map them)
+	// the pointer remains valid until the file is closed; callers must fall back to reading if it's nullptr
+	virtual void const *view(std::uint64_t offset, std::size_t length) noexcept = 0;
+
 
 	// ----- file write -----
 
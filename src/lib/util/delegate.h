@@ -141,11 +141,10 @@
 #if defined(MAME_DELEGATE_FORCE_COMPATIBLE)
 	#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_COMPATIBLE
 #elif defined(__GNUC__)
-	// 32bit MINGW asks for different convention
+	// 32bit MINGW uses a different convention for member functions
 	#if defined(__MINGW32__) && !defined(__x86_64__) && defined(__i386__)
-		#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_COMPATIBLE
-		//#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_ITANIUM
-		//#define MAME_DELEGATE_DIFFERENT_MEMBER_ABI 1
+		#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_ITANIUM
+		#define MAME_DELEGATE_DIFFERENT_MEMBER_ABI 1
 	#elif defined(__clang__) && defined(__i386__) && defined(_WIN32)
 		#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_COMPATIBLE
 	#else
@@ -155,6 +154,9 @@
 #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
 	#define MAME_DELEGATE_DIFFERENT_MEMBER_ABI 0
 	#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_MSVC
+#elif defined(_MSC_VER) && defined(_M_IX86)
+	#define MAME_DELEGATE_DIFFERENT_MEMBER_ABI 1
+	#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_MSVC
 #else
 	#define MAME_DELEGATE_USE_TYPE MAME_DELEGATE_TYPE_COMPATIBLE
 #endif
@@ -552,12 +554,12 @@ private:
 template <typename ReturnType>
 struct delegate_mfp { using type = delegate_mfp_compatible; };
 
-#elif MAME_DELEGATE_USE_TYPE == MAME_DELEGATE_TYPE_ITANIUM
+#elif (MAME_DELEGATE_USE_TYPE == MAME_DELEGATE_TYPE_ITANIUM) && !MAME_DELEGATE_DIFFERENT_MEMBER_ABI
 
 template <typename ReturnType>
 struct delegate_mfp { using type = delegate_mfp_itanium; };
 
-#elif MAME_DELEGATE_USE_TYPE == MAME_DELEGATE_TYPE_MSVC
+#else
 
 /// \brief Determine whether a type is returned conventionally
 ///
@@ -591,6 +593,12 @@ struct delegate_mfp { using type = delegate_mfp_itanium; };
 /// functions even when they're too large to return in registers (e.g. a
 /// pointer to a function member of a class with unknown inheritance).
 ///
+/// On 32-bit x86 Windows, member functions use the thiscall convention
+/// with the "this" pointer in ECX.  When a structure or union is
+/// returned, the pointer to the area for the return value is passed on
+/// the stack, where a free function with the same qualifier would take
+/// it in ECX instead.
+///
 /// Because of this, we may need to use the #delegate_mfp_compatible
 /// class to generate adaptor thunks depending on the return type.  This
 /// trait doesn't need to reliably be true for types that are returned
@@ -607,8 +615,14 @@ using delegate_mfp_conventional_return = std::bool_constant<
 template <typename ReturnType, typename Enable = void>
 struct delegate_mfp;
 
+#if MAME_DELEGATE_USE_TYPE == MAME_DELEGATE_TYPE_ITANIUM
+using delegate_mfp_native = delegate_mfp_itanium;
+#else
+using delegate_mfp_native = delegate_mfp_msvc;
+#endif
+
 template <typename ReturnType>
-struct delegate_mfp<ReturnType, std::enable_if_t<delegate_mfp_conventional_return<ReturnType>::value> > { using type = delegate_mfp_msvc; };
+struct delegate_mfp<ReturnType, std::enable_if_t<delegate_mfp_conventional_return<ReturnType>::value> > { using type = delegate_mfp_native; };
 
 template <typename ReturnType>
 struct delegate_mfp<ReturnType, std::enable_if_t<!delegate_mfp_conventional_return<ReturnType>::value> > { using type = delegate_mfp_compatible; };
@@ -759,7 +773,8 @@ public:
 	// call the function
 	ReturnType operator()(Params... args) const
 	{
-		if ((MAME_DELEGATE_DIFFERENT_MEMBER_ABI) && is_mfp())
+		// member functions resolved at bind time need the member calling convention
+		if (member_abi() && is_mfp())
 			return (*reinterpret_cast<generic_member_func>(m_function))(m_object, std::forward<Params>(args)...);
 		else
 			return (*m_function)(m_object, std::forward<Params>(args)...);
@@ -778,6 +793,12 @@ public:
 	}
 
 protected:
+	// true if resolved member functions need to be called with a different calling convention
+	static constexpr bool member_abi() noexcept
+	{
+		return MAME_DELEGATE_DIFFERENT_MEMBER_ABI && !std::is_same_v<delegate_mfp_t<ReturnType>, delegate_mfp_compatible>;
+	}
+
 	// return the actual object (not the one we use for calling)
 	delegate_generic_class *object() const noexcept { return is_mfp() ? m_raw_mfp.real_object(m_object) : m_object; }
 
@@ -12,10 +12,12 @@
 
 #include "hash.h"
 
+#include "corefile.h"
 #include "ioprocs.h"
 
 #include <cassert>
 #include <cctype>
+#include <limits>
 #include <optional>
 
 
@@ -399,6 +401,17 @@ std::error_condition hash_collection::compute(random_read &stream, uint64_t offs
 	// begin
 	std::unique_ptr<hash_creator> creator = create(types);
 
+	// hash directly from memory if the file allows it
+	core_file *const file = dynamic_cast<core_file *>(&stream);
+	void const *const direct = (file && (std::numeric_limits<uint32_t>::max() >= length)) ? file->view(offset, length) : nullptr;
+	if (direct)
+	{
+		creator->append(direct, length);
+		actual = length;
+		creator->finish(*this);
+		return std::error_condition();
+	}
+
 	// local buffer of arbitrary size
 	uint8_t buffer[2048];
 
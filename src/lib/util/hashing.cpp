@@ -17,8 +17,31 @@
 #include <zlib.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
+#include <utility>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MAME_HASHING_X86 1
+#define MAME_HASHING_TARGET(features) __attribute__((target(features)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define MAME_HASHING_X86 1
+#define MAME_HASHING_TARGET(features)
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(LSB_FIRST)
+#if defined(__ARM_FEATURE_CRC32)
+#define MAME_HASHING_ARM_CRC32 1
+#include <arm_acle.h>
+#endif
+#if defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+#define MAME_HASHING_ARM_SHA1 1
+#include <arm_neon.h>
+#endif
+#endif
 
 
 namespace util {
@@ -103,6 +126,296 @@ inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
 		st[i] += d[i];
 }
 
+
+#if defined(MAME_HASHING_X86)
+
+//-------------------------------------------------
+//  host_features - instruction set extensions
+//  the hashes can use, zero until detected so
+//  anything hashed during static initialisation
+//  takes the portable path
+//-------------------------------------------------
+
+struct host_features
+{
+	host_features() noexcept
+	{
+		unsigned leaf1[4] = { 0, 0, 0, 0 }, leaf7[4] = { 0, 0, 0, 0 };
+#if defined(_MSC_VER) && !defined(__clang__)
+		int regs[4];
+		__cpuid(regs, 0);
+		unsigned const maxleaf = unsigned(regs[0]);
+		if (maxleaf >= 1)
+		{
+			__cpuidex(regs, 1, 0);
+			std::copy(std::begin(regs), std::end(regs), std::begin(leaf1));
+		}
+		if (maxleaf >= 7)
+		{
+			__cpuidex(regs, 7, 0);
+			std::copy(std::begin(regs), std::end(regs), std::begin(leaf7));
+		}
+#else
+		__get_cpuid_count(1, 0, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3]);
+		__get_cpuid_count(7, 0, &leaf7[0], &leaf7[1], &leaf7[2], &leaf7[3]);
+#endif
+		bool const ssse3 = bool(leaf1[2] & (1U << 9));
+		bool const sse41 = bool(leaf1[2] & (1U << 19));
+		bool const pclmul = bool(leaf1[2] & (1U << 1));
+		sha1 = ssse3 && sse41 && bool(leaf7[1] & (1U << 29));
+		crc32 = sse41 && pclmul;
+	}
+
+	bool sha1;
+	bool crc32;
+};
+
+host_features const f_host;
+
+
+//-------------------------------------------------
+//  sha1_ni_rounds - four SHA-1 rounds using the
+//  SHA extensions, scheduling the message words
+//  for the rounds to come
+//-------------------------------------------------
+
+template <unsigned G>
+MAME_HASHING_TARGET("sha,ssse3,sse4.1")
+inline void sha1_ni_rounds(__m128i &abcd, __m128i &e0, __m128i &e1, __m128i (&msg)[4]) noexcept
+{
+	__m128i &e = (G & 1) ? e1 : e0;
+	__m128i &next = (G & 1) ? e0 : e1;
+	if constexpr (G == 0)
+		e = _mm_add_epi32(e, msg[0]);
+	else
+		e = _mm_sha1nexte_epu32(e, msg[G % 4]);
+	next = abcd;
+	if constexpr ((G >= 3) && (G <= 18))
+		msg[(G + 1) % 4] = _mm_sha1msg2_epu32(msg[(G + 1) % 4], msg[G % 4]);
+	abcd = _mm_sha1rnds4_epu32(abcd, e, G / 5);
+	if constexpr ((G >= 1) && (G <= 16))
+		msg[(G + 3) % 4] = _mm_sha1msg1_epu32(msg[(G + 3) % 4], msg[G % 4]);
+	if constexpr ((G >= 2) && (G <= 17))
+		msg[(G + 2) % 4] = _mm_xor_si128(msg[(G + 2) % 4], msg[G % 4]);
+}
+
+template <unsigned... G>
+MAME_HASHING_TARGET("sha,ssse3,sse4.1")
+inline void sha1_ni_block(__m128i &abcd, __m128i &e0, __m128i (&msg)[4], std::integer_sequence<unsigned, G...>) noexcept
+{
+	__m128i e1;
+	(sha1_ni_rounds<G>(abcd, e0, e1, msg), ...);
+}
+
+
+//-------------------------------------------------
+//  sha1_process_ni - digest whole blocks using
+//  the SHA extensions; Bytes is true for message
+//  bytes, false for words already in host order
+//-------------------------------------------------
+
+template <bool Bytes>
+MAME_HASHING_TARGET("sha,ssse3,sse4.1")
+void sha1_process_ni(std::array<uint32_t, 5> &st, const void *data, uint32_t blocks) noexcept
+{
+	// the state is stored E, D, C, B, A, so D to A are already in the order the instructions want
+	__m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&st[1]));
+	__m128i e0 = _mm_set_epi32(int(st[0]), 0, 0, 0);
+	__m128i const reverse = _mm_set_epi64x(0x0001020304050607LL, 0x08090a0b0c0d0e0fLL);
+	const __m128i *src = reinterpret_cast<const __m128i *>(data);
+	for ( ; blocks; blocks--, src += 4)
+	{
+		__m128i const abcd_save = abcd;
+		__m128i const e0_save = e0;
+		__m128i msg[4];
+		for (unsigned i = 0U; i < 4U; i++)
+			msg[i] = Bytes ? _mm_shuffle_epi8(_mm_loadu_si128(&src[i]), reverse) : _mm_shuffle_epi32(_mm_loadu_si128(&src[i]), 0x1b);
+		sha1_ni_block(abcd, e0, msg, std::make_integer_sequence<unsigned, 20>());
+		e0 = _mm_sha1nexte_epu32(e0, e0_save);
+		abcd = _mm_add_epi32(abcd, abcd_save);
+	}
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(&st[1]), abcd);
+	st[0] = uint32_t(_mm_extract_epi32(e0, 3));
+}
+
+
+//-------------------------------------------------
+//  crc32_clmul - fold a multiple of 16 bytes, at
+//  least 64, into a CRC-32 using carry-less
+//  multiplication; the CRC passed in and returned
+//  is not inverted
+//-------------------------------------------------
+
+MAME_HASHING_TARGET("pclmul,sse4.1")
+uint32_t crc32_clmul(uint32_t crc, const uint8_t *buf, uint32_t len) noexcept
+{
+	// constants for the bit-reflected polynomial from "Fast CRC Computation for
+	// Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009)
+	__m128i const k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+	__m128i const k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+	__m128i const k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+	__m128i const poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+	__m128i const mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	const __m128i *src = reinterpret_cast<const __m128i *>(buf);
+
+	// fold four lanes of 128 bits in parallel
+	__m128i x1 = _mm_xor_si128(_mm_loadu_si128(&src[0]), _mm_cvtsi32_si128(int(crc)));
+	__m128i x2 = _mm_loadu_si128(&src[1]);
+	__m128i x3 = _mm_loadu_si128(&src[2]);
+	__m128i x4 = _mm_loadu_si128(&src[3]);
+	for (src += 4, len -= 64U; len >= 64U; src += 4, len -= 64U)
+	{
+		x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), _mm_clmulepi64_si128(x1, k1k2, 0x00)), _mm_loadu_si128(&src[0]));
+		x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), _mm_clmulepi64_si128(x2, k1k2, 0x00)), _mm_loadu_si128(&src[1]));
+		x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), _mm_clmulepi64_si128(x3, k1k2, 0x00)), _mm_loadu_si128(&src[2]));
+		x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), _mm_clmulepi64_si128(x4, k1k2, 0x00)), _mm_loadu_si128(&src[3]));
+	}
+
+	// fold the lanes together, then any remaining 16-byte blocks
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), x2);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), x3);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), x4);
+	for ( ; len >= 16U; src++, len -= 16U)
+		x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), _mm_loadu_si128(src));
+
+	// fold 128 bits to 64
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k3k4, 0x10));
+	x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00), _mm_srli_si128(x1, 4));
+
+	// Barrett reduction to 32 bits
+	__m128i x2b = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+	x2b = _mm_clmulepi64_si128(_mm_and_si128(x2b, mask32), poly, 0x00);
+	return uint32_t(_mm_extract_epi32(_mm_xor_si128(x1, x2b), 1));
+}
+
+#endif // MAME_HASHING_X86
+
+
+#if defined(MAME_HASHING_ARM_SHA1)
+
+//-------------------------------------------------
+//  sha1_process_arm - digest whole blocks using
+//  the Armv8 cryptography extension; Bytes is
+//  true for message bytes, false for words
+//  already in host order
+//-------------------------------------------------
+
+template <bool Bytes>
+void sha1_process_arm(std::array<uint32_t, 5> &st, const void *data, uint32_t blocks) noexcept
+{
+	static uint32_t const k[4] = { 0x5a827999U, 0x6ed9eba1U, 0x8f1bbcdcU, 0xca62c1d6U };
+
+	// the state is stored E, D, C, B, A, the instructions want A in the first lane
+	uint32x4_t abcd = vld1q_u32(&st[1]);
+	abcd = vrev64q_u32(abcd);
+	abcd = vextq_u32(abcd, abcd, 2);
+	uint32_t e = st[0];
+	const uint8_t *src = reinterpret_cast<const uint8_t *>(data);
+	for ( ; blocks; blocks--, src += 64)
+	{
+		uint32x4_t const abcd_save = abcd;
+		uint32_t const e_save = e;
+		uint32x4_t msg[4];
+		for (unsigned i = 0U; i < 4U; i++)
+			msg[i] = vreinterpretq_u32_u8(Bytes ? vrev32q_u8(vld1q_u8(src + (i * 16))) : vld1q_u8(src + (i * 16)));
+		for (unsigned g = 0U; g < 20U; g++)
+		{
+			uint32x4_t const w = vaddq_u32(msg[g % 4], vdupq_n_u32(k[g / 5]));
+			uint32_t const next = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			switch (g / 5)
+			{
+			case 0:
+				abcd = vsha1cq_u32(abcd, e, w);
+				break;
+			case 2:
+				abcd = vsha1mq_u32(abcd, e, w);
+				break;
+			default:
+				abcd = vsha1pq_u32(abcd, e, w);
+				break;
+			}
+			e = next;
+			if (g < 16U)
+				msg[g % 4] = vsha1su1q_u32(vsha1su0q_u32(msg[g % 4], msg[(g + 1) % 4], msg[(g + 2) % 4]), msg[(g + 3) % 4]);
+		}
+		abcd = vaddq_u32(abcd, abcd_save);
+		e += e_save;
+	}
+	abcd = vextq_u32(abcd, abcd, 2);
+	vst1q_u32(&st[1], vrev64q_u32(abcd));
+	st[0] = e;
+}
+
+#endif // MAME_HASHING_ARM_SHA1
+
+
+#if defined(MAME_HASHING_ARM_CRC32)
+
+//-------------------------------------------------
+//  crc32_arm - CRC-32 using the Armv8 CRC32
+//  instructions; the CRC passed in and returned
+//  is not inverted
+//-------------------------------------------------
+
+inline uint32_t crc32_arm(uint32_t crc, const uint8_t *buf, uint32_t len) noexcept
+{
+	for ( ; len && (uintptr_t(buf) & 7); buf++, len--)
+		crc = __crc32b(crc, *buf);
+	for ( ; len >= 8U; buf += 8, len -= 8U)
+	{
+		uint64_t value;
+		std::memcpy(&value, buf, sizeof(value));
+		crc = __crc32d(crc, value);
+	}
+	for ( ; len; buf++, len--)
+		crc = __crc32b(crc, *buf);
+	return crc;
+}
+
+#endif // MAME_HASHING_ARM_CRC32
+
+
+//-------------------------------------------------
+//  sha1_process_buffer - digest a block of words
+//  in host order
+//-------------------------------------------------
+
+inline void sha1_process_buffer(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
+{
+#if defined(MAME_HASHING_X86)
+	if (f_host.sha1)
+		sha1_process_ni<false>(st, data, 1);
+	else
+		sha1_process(st, data);
+#elif defined(MAME_HASHING_ARM_SHA1)
+	sha1_process_arm<false>(st, data, 1);
+#else
+	sha1_process(st, data);
+#endif
+}
+
+
+//-------------------------------------------------
+//  sha1_process_bytes - digest whole blocks of
+//  message bytes in place if the host has
+//  instructions for it
+//-------------------------------------------------
+
+inline bool sha1_process_bytes(std::array<uint32_t, 5> &st, const uint8_t *data, uint32_t blocks) noexcept
+{
+#if defined(MAME_HASHING_X86)
+	if (!f_host.sha1)
+		return false;
+	sha1_process_ni<true>(st, data, blocks);
+	return true;
+#elif defined(MAME_HASHING_ARM_SHA1)
+	sha1_process_arm<true>(st, data, blocks);
+	return true;
+#else
+	return false;
+#endif
+}
+
 } // anonymous namespace
 
 
@@ -202,8 +515,11 @@ void sha1_creator::append(const void *data, uint32_t length) noexcept
 		{
 			for (offset = 0U; (offset + residual) < 64U; offset++)
 				reinterpret_cast<uint8_t *>(m_buf)[(offset + residual) ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
-			sha1_process(m_st, m_buf);
+			sha1_process_buffer(m_st, m_buf);
 		}
+		uint32_t const blocks = (length - offset) >> 6;
+		if (blocks && sha1_process_bytes(m_st, reinterpret_cast<const uint8_t *>(data) + offset, blocks))
+			offset += blocks << 6;
 		while ((length - offset) >= 64U)
 		{
 			for (residual = 0U; residual < 64U; residual++, offset++)
@@ -336,7 +652,21 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length) noexcept
 {
-	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+#if defined(MAME_HASHING_X86)
+	if (f_host.crc32 && (length >= 64U))
+	{
+		uint32_t const folded = length & ~uint32_t(15);
+		m_accum.m_raw = ~crc32_clmul(~m_accum.m_raw, ptr, folded);
+		ptr += folded;
+		length -= folded;
+	}
+#elif defined(MAME_HASHING_ARM_CRC32)
+	m_accum.m_raw = ~crc32_arm(~m_accum.m_raw, ptr, length);
+	length = 0U;
+#endif
+	if (length)
+		m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(ptr), length);
 }
 
 
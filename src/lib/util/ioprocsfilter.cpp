@@ -14,6 +14,7 @@
 #include "ioprocsfill.h"
 
 #include <zlib.h>
+#include <zstd.h>
 
 #include <algorithm>
 #include <cassert>
@@ -657,6 +658,213 @@ private:
 	}
 };
 
+
+// filter for decompressing zstd frames
+
+template <typename Stream>
+class zstd_read_filter : public read_stream, protected filter_base<Stream>
+{
+public:
+	zstd_read_filter(std::unique_ptr<Stream> &&stream, std::size_t read_chunk) noexcept :
+		filter_base<Stream>(std::move(stream)),
+		m_buffer_size(read_chunk)
+	{
+		assert(read_chunk);
+	}
+
+	zstd_read_filter(Stream &stream, std::size_t read_chunk) noexcept :
+		filter_base<Stream>(stream),
+		m_buffer_size(read_chunk)
+	{
+		assert(read_chunk);
+	}
+
+	~zstd_read_filter()
+	{
+		if (m_stream)
+			ZSTD_freeDStream(m_stream);
+	}
+
+	virtual std::error_condition read_some(void *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		actual = 0U;
+
+		if (!m_stream)
+		{
+			m_buffer.reset(new (std::nothrow) std::uint8_t [m_buffer_size]);
+			if (m_buffer)
+				m_stream = ZSTD_createDStream();
+			if (!m_stream)
+				return std::errc::not_enough_memory;
+			m_input = ZSTD_inBuffer{ m_buffer.get(), 0U, 0U };
+			m_frame_ended = true;
+		}
+
+		if (m_frame_ended)
+		{
+			if (ZSTD_isError(ZSTD_DCtx_reset(m_stream, ZSTD_reset_session_only)))
+				return std::errc::io_error;
+			m_frame_ended = false;
+		}
+
+		ZSTD_outBuffer output{ buffer, length, 0U };
+		bool short_input = false;
+		while (length > output.pos)
+		{
+			if (m_input.pos == m_input.size)
+			{
+				if (short_input)
+					break;
+				std::error_condition err;
+				std::size_t filled;
+				std::tie(err, filled) = read(this->object(), m_buffer.get(), m_buffer_size);
+				m_input = ZSTD_inBuffer{ m_buffer.get(), filled, 0U };
+				short_input = m_buffer_size > filled;
+				if (err)
+				{
+					actual = output.pos;
+					return err;
+				}
+			}
+
+			std::size_t const previous = output.pos;
+			std::size_t const result = ZSTD_decompressStream(m_stream, &output, &m_input);
+			actual = output.pos;
+			if (ZSTD_isError(result))
+				return std::errc::invalid_argument;
+
+			if (!result)
+			{
+				m_frame_ended = true;
+				if constexpr (std::is_base_of_v<random_read, Stream>)
+				{
+					if (m_input.size > m_input.pos)
+					{
+						std::int64_t const overshoot = std::uint64_t(m_input.size - m_input.pos);
+						m_input.pos = m_input.size = 0U;
+						return this->object().seek(-overshoot, SEEK_CUR);
+					}
+				}
+				return std::error_condition();
+			}
+
+			// at the end of the input with nothing more to show for it
+			if (short_input && (m_input.pos == m_input.size) && (output.pos == previous))
+				break;
+		}
+
+		return std::error_condition();
+	}
+
+private:
+	ZSTD_DStream *m_stream = nullptr;
+	std::unique_ptr<std::uint8_t []> m_buffer;
+	std::size_t const m_buffer_size;
+	ZSTD_inBuffer m_input{ nullptr, 0U, 0U };
+	bool m_frame_ended = false;
+};
+
+
+// filter for compressing data into zstd frames
+
+class zstd_write_filter : public write_stream, protected filter_base<write_stream>
+{
+public:
+	zstd_write_filter(write_stream::ptr &&stream, int level, std::size_t buffer_size) noexcept :
+		filter_base<write_stream>(std::move(stream)),
+		m_level(level),
+		m_buffer_size(buffer_size)
+	{
+		assert(buffer_size);
+	}
+
+	zstd_write_filter(write_stream &stream, int level, std::size_t buffer_size) noexcept :
+		filter_base<write_stream>(stream),
+		m_level(level),
+		m_buffer_size(buffer_size)
+	{
+		assert(buffer_size);
+	}
+
+	~zstd_write_filter()
+	{
+		finalize();
+		if (m_stream)
+			ZSTD_freeCStream(m_stream);
+	}
+
+	virtual std::error_condition finalize() noexcept override
+	{
+		if (!m_started)
+			return std::error_condition();
+
+		ZSTD_inBuffer input{ nullptr, 0U, 0U };
+		std::size_t remaining;
+		do
+		{
+			std::error_condition const err = compress(input, ZSTD_e_end, remaining);
+			if (err)
+				return err;
+		}
+		while (remaining);
+
+		m_started = false;
+		return std::error_condition();
+	}
+
+	virtual std::error_condition flush() noexcept override
+	{
+		return object().flush();
+	}
+
+	virtual std::error_condition write_some(void const *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		actual = 0U;
+
+		if (!m_stream)
+		{
+			m_buffer.reset(new (std::nothrow) std::uint8_t [m_buffer_size]);
+			if (m_buffer)
+				m_stream = ZSTD_createCStream();
+			if (!m_stream)
+				return std::errc::not_enough_memory;
+			if (ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, m_level)))
+				return std::errc::invalid_argument;
+		}
+		m_started = true;
+
+		ZSTD_inBuffer input{ buffer, length, 0U };
+		std::error_condition err;
+		while (!err && (input.size > input.pos))
+		{
+			std::size_t remaining;
+			err = compress(input, ZSTD_e_continue, remaining);
+			actual = input.pos;
+		}
+		return err;
+	}
+
+private:
+	// run the compressor over the input and write whatever it produces
+	std::error_condition compress(ZSTD_inBuffer &input, ZSTD_EndDirective mode, std::size_t &remaining) noexcept
+	{
+		ZSTD_outBuffer output{ m_buffer.get(), m_buffer_size, 0U };
+		remaining = ZSTD_compressStream2(m_stream, &output, &input, mode);
+		if (ZSTD_isError(remaining))
+			return std::errc::io_error;
+		if (!output.pos)
+			return std::error_condition();
+		auto const [err, written] = write(object(), output.dst, output.pos);
+		return err;
+	}
+
+	ZSTD_CStream *m_stream = nullptr;
+	std::unique_ptr<std::uint8_t []> m_buffer;
+	int const m_level;
+	std::size_t const m_buffer_size;
+	bool m_started = false;
+};
+
 } // anonymous namespace
 
 
@@ -789,4 +997,49 @@ write_stream::ptr zlib_write(write_stream &stream, int level, std::size_t buffer
 	return write_stream::ptr(new (std::nothrow) zlib_write_filter(stream, level, buffer_size));
 }
 
+
+// creating zstd decompressing filters
+
+read_stream::ptr zstd_read(read_stream::ptr &&stream, std::size_t read_chunk) noexcept
+{
+	read_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) zstd_read_filter<read_stream>(std::move(stream), read_chunk));
+	return result;
+}
+
+read_stream::ptr zstd_read(random_read::ptr &&stream, std::size_t read_chunk) noexcept
+{
+	read_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) zstd_read_filter<random_read>(std::move(stream), read_chunk));
+	return result;
+}
+
+read_stream::ptr zstd_read(read_stream &stream, std::size_t read_chunk) noexcept
+{
+	return read_stream::ptr(new (std::nothrow) zstd_read_filter<read_stream>(stream, read_chunk));
+}
+
+read_stream::ptr zstd_read(random_read &stream, std::size_t read_chunk) noexcept
+{
+	return read_stream::ptr(new (std::nothrow) zstd_read_filter<random_read>(stream, read_chunk));
+}
+
+
+// creating zstd compressing filters
+
+write_stream::ptr zstd_write(write_stream::ptr &&stream, int level, std::size_t buffer_size) noexcept
+{
+	write_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) zstd_write_filter(std::move(stream), level, buffer_size));
+	return result;
+}
+
+write_stream::ptr zstd_write(write_stream &stream, int level, std::size_t buffer_size) noexcept
+{
+	return write_stream::ptr(new (std::nothrow) zstd_write_filter(stream, level, buffer_size));
+}
+
 } // namespace util
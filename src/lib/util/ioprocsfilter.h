@@ -223,6 +223,77 @@ std::unique_ptr<read_stream> zlib_read(read_stream &stream, std::size_t read_chu
 /// \sa read_stream random_read
 std::unique_ptr<read_stream> zlib_read(random_read &stream, std::size_t read_chunk) noexcept;
 
+/// \brief Create an input stream filter that decompresses
+///   zstd-compressed data
+///
+/// Creates a read stream that decompresses Zstandard-compressed data
+/// read from the underlying input stream.  A read operation will always
+/// stop on reaching the end of a compressed frame.  A subsequent read
+/// operation will expect to find the beginning of another frame.  May
+/// read past the end of the compressed data in the underlying input
+/// stream.  Takes ownership of the underlying input stream.
+/// \param [in] stream Underlying input stream to read from.
+/// \param [in] read_chunk Size of buffer for reading compressed data in
+///   bytes.
+/// \return A pointer to an input stream, or nullptr on error.
+/// \sa read_stream
+std::unique_ptr<read_stream> zstd_read(std::unique_ptr<read_stream> &&stream, std::size_t read_chunk) noexcept;
+
+/// \brief Create an input stream filter that decompresses
+///   zstd-compressed data
+///
+/// Creates a read stream that decompresses Zstandard-compressed data
+/// read from the underlying input sequence.  A read operation will
+/// always stop on reaching the end of a compressed frame.  A subsequent
+/// read operation will expect to find the beginning of another frame.
+/// If a read operation reads past the end of a frame, it will seek back
+/// so the position for the next read from the underlying input sequence
+/// immediately follows the frame.  Takes ownership of
+/// the underlying input sequence.
+/// \param [in] stream Underlying input sequence to read from.  Must
+///   support seeking relative to the current position.
+/// \param [in] read_chunk Size of buffer for reading compressed data in
+///   bytes.
+/// \return A pointer to an input stream, or nullptr on error.
+/// \sa read_stream random_read
+std::unique_ptr<read_stream> zstd_read(std::unique_ptr<random_read> &&stream, std::size_t read_chunk) noexcept;
+
+/// \brief Create an input stream filter that decompresses
+///   zstd-compressed data
+///
+/// Creates a read stream that decompresses Zstandard-compressed data
+/// read from the underlying input stream.  A read operation will always
+/// stop on reaching the end of a compressed frame.  A subsequent read
+/// operation will expect to find the beginning of another frame.  May
+/// read past the end of the compressed data in the underlying input
+/// stream.  Does not take
+/// ownership of the underlying input stream.
+/// \param [in] stream Underlying input stream to read from.
+/// \param [in] read_chunk Size of buffer for reading compressed data in
+///   bytes.
+/// \return A pointer to an input stream, or nullptr on error.
+/// \sa read_stream
+std::unique_ptr<read_stream> zstd_read(read_stream &stream, std::size_t read_chunk) noexcept;
+
+/// \brief Create an input stream filter that decompresses
+///   zstd-compressed data
+///
+/// Creates a read stream that decompresses Zstandard-compressed data
+/// read from the underlying input sequence.  A read operation will
+/// always stop on reaching the end of a compressed frame.  A subsequent
+/// read operation will expect to find the beginning of another frame.
+/// If a read operation reads past the end of a frame, it will seek back
+/// so the position for the next read from the underlying input sequence
+/// immediately follows the frame.  Does not take
+/// ownership of the underlying input sequence.
+/// \param [in] stream Underlying input sequence to read from.  Must
+///   support seeking relative to the current position.
+/// \param [in] read_chunk Size of buffer for reading compressed data in
+///   bytes.
+/// \return A pointer to an input stream, or nullptr on error.
+/// \sa read_stream random_read
+std::unique_ptr<read_stream> zstd_read(random_read &stream, std::size_t read_chunk) noexcept;
+
 
 /// \brief Create an output stream filter that writes zlib-compressed
 ///   data
@@ -276,6 +347,58 @@ std::unique_ptr<write_stream> zlib_write(std::unique_ptr<write_stream> &&stream,
 /// \sa write_stream
 std::unique_ptr<write_stream> zlib_write(write_stream &stream, int level, std::size_t buffer_size) noexcept;
 
+/// \brief Create an output stream filter that writes zstd-compressed
+///   data
+///
+/// Creates an output stream that compresses data using the Zstandard
+/// algorithm and writes it to the underlying output stream.  Compressed
+/// data is written to the underlying output stream as it is produced.
+/// Calling the \c finalize member function compresses any buffered
+/// input, ends the compressed frame, and writes the remaining
+/// compressed data to the underlying output stream.  A subsequent write
+/// operation will start a new frame.  Calling the \c flush member
+/// function calls the \c flush member function of the underlying
+/// output stream; it does not ensure all buffered input data is
+/// compressed or end the frame.  Takes
+/// ownership of the underlying output stream.
+/// \param [in] stream Underlying output stream for writing compressed
+///   data.
+/// \param [in] level Compression level.  Use 1 for fastest compression,
+///   or up to the value returned by \c ZSTD_maxCLevel for maximum
+///   compression.  Zero selects the default level as defined by the
+///   zstd library, and negative values trade compression for even more
+///   speed.
+/// \param [in] buffer_size Size of buffer for compressed data in bytes.
+/// \return A pointer to an output stream, or nullptr on error.
+/// \sa write_stream
+std::unique_ptr<write_stream> zstd_write(std::unique_ptr<write_stream> &&stream, int level, std::size_t buffer_size) noexcept;
+
+/// \brief Create an output stream filter that writes zstd-compressed
+///   data
+///
+/// Creates an output stream that compresses data using the Zstandard
+/// algorithm and writes it to the underlying output stream.  Compressed
+/// data is written to the underlying output stream as it is produced.
+/// Calling the \c finalize member function compresses any buffered
+/// input, ends the compressed frame, and writes the remaining
+/// compressed data to the underlying output stream.  A subsequent write
+/// operation will start a new frame.  Calling the \c flush member
+/// function calls the \c flush member function of the underlying
+/// output stream; it does not ensure all buffered input data is
+/// compressed or end the frame.  Does
+/// not take ownership of the underlying output stream.
+/// \param [in] stream Underlying output stream for writing compressed
+///   data.
+/// \param [in] level Compression level.  Use 1 for fastest compression,
+///   or up to the value returned by \c ZSTD_maxCLevel for maximum
+///   compression.  Zero selects the default level as defined by the
+///   zstd library, and negative values trade compression for even more
+///   speed.
+/// \param [in] buffer_size Size of buffer for compressed data in bytes.
+/// \return A pointer to an output stream, or nullptr on error.
+/// \sa write_stream
+std::unique_ptr<write_stream> zstd_write(write_stream &stream, int level, std::size_t buffer_size) noexcept;
+
 /// \}
 
 } // namespace util
@@ -14,6 +14,7 @@
 #include "unicode.h"
 
 #include "osdcomm.h"
+#include "osdcore.h"
 
 #include <zlib.h>
 
@@ -24,7 +25,14 @@
 #include <cstdlib>
 #include <cstring>
 #include <new>
+#include <thread>
 #include <tuple>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MAME_PNG_SSE2 1
+#include <emmintrin.h>
+#endif
 
 
 namespace util {
@@ -106,6 +114,80 @@ inline void put_16bit(uint8_t *v, uint16_t data) noexcept { *reinterpret_cast<ui
 inline void put_32bit(uint8_t *v, uint32_t data) noexcept { *reinterpret_cast<uint32_t *>(v) = big_endianize_int32(data); }
 
 
+#if defined(MAME_PNG_SSE2)
+
+/*-------------------------------------------------
+    SSE2 unfiltering for 24- and 32-bit pixels,
+    one pixel at a time as each depends on the
+    one to its left; pixels are loaded whole
+    before anything is stored, so the
+    destination may trail the source
+-------------------------------------------------*/
+
+template <unsigned Bpp>
+inline __m128i load_pixel(uint8_t const *p) noexcept
+{
+	uint32_t value = 0;
+	std::memcpy(&value, p, Bpp);
+	return _mm_cvtsi32_si128(int(value));
+}
+
+template <unsigned Bpp>
+inline void store_pixel(uint8_t *p, __m128i v) noexcept
+{
+	uint32_t const value = uint32_t(_mm_cvtsi128_si32(v));
+	std::memcpy(p, &value, Bpp);
+}
+
+template <unsigned Bpp>
+void unfilter_average_sse2(uint8_t const *src, uint8_t *dst, uint8_t const *dstprev, std::uint32_t rowbytes) noexcept
+{
+	// PNG wants a truncating average, so correct the rounding of pavgb
+	__m128i const one = _mm_set1_epi8(1);
+	__m128i a = _mm_setzero_si128();
+	for (std::uint32_t x = 0; rowbytes > x; x += Bpp)
+	{
+		__m128i const b = load_pixel<Bpp>(dstprev + x);
+		__m128i const avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+		a = _mm_add_epi8(load_pixel<Bpp>(src + x), avg);
+		store_pixel<Bpp>(dst + x, a);
+	}
+}
+
+template <unsigned Bpp>
+void unfilter_paeth_sse2(uint8_t const *src, uint8_t *dst, uint8_t const *dstprev, std::uint32_t rowbytes) noexcept
+{
+	// a is to the left, b is above, c is above and to the left
+	__m128i const zero = _mm_setzero_si128();
+	__m128i a = zero, b = zero;
+	for (std::uint32_t x = 0; rowbytes > x; x += Bpp)
+	{
+		__m128i const c = b;
+		b = _mm_unpacklo_epi8(load_pixel<Bpp>(dstprev + x), zero);
+
+		// distances from the prediction a + b - c, favouring a over b over c on ties
+		__m128i pa = _mm_sub_epi16(b, c);
+		__m128i pb = _mm_sub_epi16(a, c);
+		__m128i pc = _mm_add_epi16(pa, pb);
+		pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+		pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+		pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+		__m128i const smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+		__m128i const usea = _mm_cmpeq_epi16(smallest, pa);
+		__m128i const useb = _mm_andnot_si128(usea, _mm_cmpeq_epi16(smallest, pb));
+		__m128i const nearest = _mm_or_si128(
+				_mm_or_si128(_mm_and_si128(usea, a), _mm_and_si128(useb, b)),
+				_mm_andnot_si128(_mm_or_si128(usea, useb), c));
+
+		// adding bytes wraps modulo 256 and leaves the zero high bytes alone
+		a = _mm_add_epi8(_mm_unpacklo_epi8(load_pixel<Bpp>(src + x), zero), nearest);
+		store_pixel<Bpp>(dst + x, _mm_packus_epi16(a, a));
+	}
+}
+
+#endif // MAME_PNG_SSE2
+
+
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
@@ -286,6 +368,17 @@ private:
 			return std::error_condition();
 
 		case PNG_PF_Average: // AVERAGE = average of pixel above and previous pixel
+#if defined(MAME_PNG_SSE2)
+			if (dstprev && (4 == bpp))
+			{
+				unfilter_average_sse2<4>(src, dst, dstprev, rowbytes);
+			}
+			else if (dstprev && (3 == bpp))
+			{
+				unfilter_average_sse2<3>(src, dst, dstprev, rowbytes);
+			}
+			else
+#endif
 			if (dstprev)
 			{
 				for (std::uint32_t x = 0; bpp > x; ++x, ++src, ++dst, ++dstprev)
@@ -303,16 +396,39 @@ private:
 			return std::error_condition();
 
 		case PNG_PF_Paeth: // PAETH = special filter
-			for (std::uint32_t x = 0; rowbytes > x; ++x, ++src, ++dst)
+			if (!dstprev)
+			{
+				// with nothing above, the pixel to the left is always nearest
+				dst = std::copy_n(src, bpp, dst);
+				src += bpp;
+				for (std::uint32_t x = bpp; rowbytes > x; ++x, ++src, ++dst)
+					*dst = *src + dst[-bpp];
+			}
+#if defined(MAME_PNG_SSE2)
+			else if (4 == bpp)
+			{
+				unfilter_paeth_sse2<4>(src, dst, dstprev, rowbytes);
+			}
+			else if (3 == bpp)
 			{
-				int32_t const pa((x < bpp) ? 0 : dst[-bpp]);
-				int32_t const pc(((x < bpp) || !dstprev) ? 0 : dstprev[-bpp]);
-				int32_t const pb(!dstprev ? 0 : *dstprev++);
-				int32_t const prediction(pa + pb - pc);
-				int32_t const da(std::abs(prediction - pa));
-				int32_t const db(std::abs(prediction - pb));
-				int32_t const dc(std::abs(prediction - pc));
-				*dst = ((da <= db) && (da <= dc)) ? (*src + pa) : (db <= dc) ? (*src + pb) : (*src + pc);
+				unfilter_paeth_sse2<3>(src, dst, dstprev, rowbytes);
+			}
+#endif
+			else
+			{
+				// with nothing to the left, the pixel above is always nearest
+				for (std::uint32_t x = 0; bpp > x; ++x, ++src, ++dst, ++dstprev)
+					*dst = *src + *dstprev;
+				for (std::uint32_t x = bpp; rowbytes > x; ++x, ++src, ++dst, ++dstprev)
+				{
+					int32_t const pa(dst[-bpp]);
+					int32_t const pb(*dstprev);
+					int32_t const pc(dstprev[-bpp]);
+					int32_t const da(std::abs(pb - pc));
+					int32_t const db(std::abs(pa - pc));
+					int32_t const dc(std::abs(pa + pb - pc - pc));
+					*dst = *src + (((da <= db) && (da <= dc)) ? pa : (db <= dc) ? pb : pc);
+				}
 			}
 			return std::error_condition();
 
@@ -968,14 +1084,153 @@ static std::error_condition write_chunk(write_stream &fp, const uint8_t *data, u
 }
 
 
+/*-------------------------------------------------
+    deflate_piece - one piece of a chunk being
+    deflated in parallel; each piece is primed
+    with the data before it and ends on a byte
+    boundary, so the raw streams can be joined
+-------------------------------------------------*/
+
+namespace {
+
+constexpr std::uint32_t PARALLEL_DEFLATE_PIECE = 256 * 1024;
+constexpr std::uint32_t PARALLEL_DEFLATE_MINIMUM = 1024 * 1024;
+
+struct deflate_piece
+{
+	const uint8_t *             data;
+	std::uint32_t               length;
+	std::uint32_t               dictlength;
+	int                         level;
+	bool                        last;
+	int                         zerr;
+	uLong                       adler;
+	std::vector<std::uint8_t>   output;
+};
+
+void *deflate_piece_static(void *param, int threadid)
+{
+	deflate_piece &piece = *reinterpret_cast<deflate_piece *>(param);
+	piece.adler = adler32(adler32(0, nullptr, 0), piece.data, piece.length);
+
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	piece.zerr = deflateInit2(&stream, piece.level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+	if (Z_OK != piece.zerr)
+		return nullptr;
+	if (piece.dictlength)
+		deflateSetDictionary(&stream, piece.data - piece.dictlength, piece.dictlength);
+
+	// a sync flush can add an empty stored block to the bound
+	try { piece.output.resize(deflateBound(&stream, piece.length) + 16); }
+	catch (std::bad_alloc const &) { deflateEnd(&stream); piece.zerr = Z_MEM_ERROR; return nullptr; }
+	stream.next_in = const_cast<Bytef *>(piece.data);
+	stream.avail_in = piece.length;
+	stream.next_out = piece.output.data();
+	stream.avail_out = piece.output.size();
+	piece.zerr = deflate(&stream, piece.last ? Z_FINISH : Z_SYNC_FLUSH);
+	if (piece.last ? (Z_STREAM_END == piece.zerr) : ((Z_OK == piece.zerr) && !stream.avail_in && stream.avail_out))
+		piece.zerr = Z_OK;
+	else if (Z_OK == piece.zerr)
+		piece.zerr = Z_BUF_ERROR;
+	piece.output.resize(piece.output.size() - stream.avail_out);
+	deflateEnd(&stream);
+	return nullptr;
+}
+
+std::error_condition zlib_error(int zerr) noexcept
+{
+	if (Z_ERRNO == zerr)
+		return std::error_condition(errno, std::generic_category());
+	else if (Z_MEM_ERROR == zerr)
+		return std::errc::not_enough_memory;
+	else
+		return png_error::COMPRESS_ERROR;
+}
+
+} // anonymous namespace
+
+
+/*-------------------------------------------------
+    write_deflated_chunk_parallel - write a large
+    in-memory chunk by deflating pieces of it on
+    several threads; returns false without
+    writing anything if it can't get the threads
+-------------------------------------------------*/
+
+static bool write_deflated_chunk_parallel(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, int level, std::error_condition &err) noexcept
+{
+	std::uint32_t const pieces = std::min<std::uint32_t>(std::thread::hardware_concurrency(), length / PARALLEL_DEFLATE_PIECE);
+	if ((length < PARALLEL_DEFLATE_MINIMUM) || (pieces <= 1))
+		return false;
+
+	std::vector<deflate_piece> items;
+	try { items.resize(pieces); }
+	catch (std::bad_alloc const &) { return false; }
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (!queue)
+		return false;
+
+	// split the data evenly, priming each piece with up to a window of what came before
+	for (std::uint32_t index = 0, first = 0; index < pieces; index++)
+	{
+		std::uint32_t const last = std::uint64_t(length) * (index + 1) / pieces;
+		items[index].data = data + first;
+		items[index].length = last - first;
+		items[index].dictlength = std::min<std::uint32_t>(first, 1U << MAX_WBITS);
+		items[index].level = level;
+		items[index].last = (pieces - 1) == index;
+		first = last;
+	}
+	osd_work_item_queue_multiple(queue, &deflate_piece_static, pieces, &items[0], sizeof(items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
+	osd_work_queue_free(queue);
+
+	// wrap the joined pieces in a zlib header and checksum
+	std::vector<std::uint8_t> stream;
+	try
+	{
+		std::uint32_t const flevel = ((0 <= level) && (level < 2)) ? 0 : ((0 <= level) && (level < 6)) ? 1 : ((level < 0) || (6 == level)) ? 2 : 3;
+		std::uint32_t header = (0x78 << 8) | (flevel << 6);
+		header += 31 - (header % 31);
+		stream.push_back(std::uint8_t(header >> 8));
+		stream.push_back(std::uint8_t(header));
+		uLong adler = adler32(0, nullptr, 0);
+		for (deflate_piece const &piece : items)
+		{
+			if (Z_OK != piece.zerr)
+			{
+				err = zlib_error(piece.zerr);
+				return true;
+			}
+			stream.insert(stream.end(), piece.output.begin(), piece.output.end());
+			adler = adler32_combine(adler, piece.adler, piece.length);
+		}
+		std::uint8_t trailer[4];
+		put_32bit(trailer, std::uint32_t(adler));
+		stream.insert(stream.end(), std::begin(trailer), std::end(trailer));
+	}
+	catch (std::bad_alloc const &)
+	{
+		err = std::errc::not_enough_memory;
+		return true;
+	}
+	err = write_chunk(fp, stream.data(), type, stream.size());
+	return true;
+}
+
+
 /*-------------------------------------------------
     write_deflated_chunk - write an in-memory
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length) noexcept
+static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, int level) noexcept
 {
 	std::error_condition err;
+	if (write_deflated_chunk_parallel(fp, data, type, length, level, err))
+		return err;
+
 	std::uint64_t lengthpos;
 	err = fp.tell(lengthpos);
 	if (err)
@@ -1001,7 +1256,7 @@ static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, level);
 	if (Z_ERRNO == zerr)
 		return std::error_condition(errno, std::generic_category());
 	else if (Z_MEM_ERROR == zerr)
@@ -1247,7 +1502,7 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 		return error;
 
 	// write a single IDAT chunk
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), pnginfo.compression_level);
 	if (error)
 		return error;
 
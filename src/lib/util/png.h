@@ -83,6 +83,7 @@ public:
 	std::uint8_t                        compression_method = 0;
 	std::uint8_t                        filter_method = 0;
 	std::uint8_t                        interlace_method = 0;
+	int                                 compression_level = -1; // zlib level used when writing, -1 for the default
 
 	std::unique_ptr<std::uint8_t []>    palette = 0;
 	std::uint32_t                       num_palette = 0;
@@ -343,7 +343,7 @@ public:
 			percent                     // %
 		};
 
-	format_flags()
+	constexpr format_flags()
 		: m_alternate_format(false)
 		, m_zero_pad(false)
 		, m_left_align(false)
@@ -417,24 +417,24 @@ public:
 		}
 	}
 
-	bool            get_alternate_format() const    { return m_alternate_format; }
-	bool            get_zero_pad() const            { return m_zero_pad; }
-	bool            get_left_align() const          { return m_left_align; }
-	positive_sign   get_positive_sign() const       { return m_positive_sign; }
-	bool            get_digit_grouping() const      { return m_digit_grouping; }
-	bool            get_alternate_digits() const    { return m_alternate_digits; }
-	unsigned        get_field_width() const         { return m_field_width; }
-	int             get_precision() const           { return m_precision; }
-	length          get_length() const              { return m_length; }
-	bool            get_uppercase() const           { return m_uppercase; }
-	conversion      get_conversion() const          { return m_conversion; }
-
-	void set_alternate_format()
+	constexpr bool            get_alternate_format() const    { return m_alternate_format; }
+	constexpr bool            get_zero_pad() const            { return m_zero_pad; }
+	constexpr bool            get_left_align() const          { return m_left_align; }
+	constexpr positive_sign   get_positive_sign() const       { return m_positive_sign; }
+	constexpr bool            get_digit_grouping() const      { return m_digit_grouping; }
+	constexpr bool            get_alternate_digits() const    { return m_alternate_digits; }
+	constexpr unsigned        get_field_width() const         { return m_field_width; }
+	constexpr int             get_precision() const           { return m_precision; }
+	constexpr length          get_length() const              { return m_length; }
+	constexpr bool            get_uppercase() const           { return m_uppercase; }
+	constexpr conversion      get_conversion() const          { return m_conversion; }
+
+	constexpr void set_alternate_format()
 	{
 		m_alternate_format = true;
 	}
 
-	void set_zero_pad()
+	constexpr void set_zero_pad()
 	{
 		if (!m_left_align)
 		{
@@ -452,13 +452,13 @@ public:
 		}
 	}
 
-	void set_left_align()
+	constexpr void set_left_align()
 	{
 		m_zero_pad = false;
 		m_left_align = true;
 	}
 
-	void set_positive_sign_space()
+	constexpr void set_positive_sign_space()
 	{
 		switch (m_conversion)
 		{
@@ -472,7 +472,7 @@ public:
 		}
 	}
 
-	void set_positive_sign_plus()
+	constexpr void set_positive_sign_plus()
 	{
 		switch (m_conversion)
 		{
@@ -485,17 +485,17 @@ public:
 		}
 	}
 
-	void set_digit_grouping()
+	constexpr void set_digit_grouping()
 	{
 		m_digit_grouping = true;
 	}
 
-	void set_alternate_digits()
+	constexpr void set_alternate_digits()
 	{
 		m_alternate_digits = true;
 	}
 
-	void set_field_width(int value)
+	constexpr void set_field_width(int value)
 	{
 		if (0 > value)
 		{
@@ -508,7 +508,7 @@ public:
 		}
 	}
 
-	void set_precision(int value)
+	constexpr void set_precision(int value)
 	{
 		m_precision = value;
 		if (0 <= value)
@@ -527,17 +527,17 @@ public:
 		}
 	}
 
-	void set_length(length value)
+	constexpr void set_length(length value)
 	{
 		m_length = value;
 	}
 
-	void set_uppercase()
+	constexpr void set_uppercase()
 	{
 		m_uppercase = true;
 	}
 
-	void set_conversion(conversion value)
+	constexpr void set_conversion(conversion value)
 	{
 		m_conversion = value;
 		switch (value)
@@ -1213,7 +1213,7 @@ template <typename Format>
 class format_helper : public format_chars<typename Format::char_type>
 {
 public:
-	static bool parse_format(
+	static constexpr bool parse_format(
 			Format const &fmt,
 			typename Format::iterator &it,
 			format_flags &flags,
@@ -1226,7 +1226,7 @@ public:
 		assert(!fmt.format_at_end(it));
 		assert(format_helper::percent == *it);
 
-		int num;
+		int num(0);
 		int nxt(next_position);
 		++it;
 		flags = format_flags();
@@ -1509,33 +1509,33 @@ public:
 	}
 
 private:
-	static bool have_dollar(Format const &fmt, typename Format::iterator const &it)
+	static constexpr bool have_dollar(Format const &fmt, typename Format::iterator const &it)
 	{
 		return !fmt.format_at_end(it) && (*it == format_helper::dollar);
 	}
 
-	static bool have_digit(Format const &fmt, typename Format::iterator const &it)
+	static constexpr bool have_digit(Format const &fmt, typename Format::iterator const &it)
 	{
 		return !fmt.format_at_end(it) && is_digit(*it);
 	}
 
-	static bool is_digit(typename format_helper::char_type value)
+	static constexpr bool is_digit(typename format_helper::char_type value)
 	{
 		return (format_helper::zero <= value) && (format_helper::nine >= value);
 	}
 
-	static int digit_value(typename format_helper::char_type value)
+	static constexpr int digit_value(typename format_helper::char_type value)
 	{
 		assert(is_digit(value));
 		return int(std::make_signed_t<decltype(value)>(value - format_helper::zero));
 	}
 
-	static void add_digit(int &num, typename format_helper::char_type digit)
+	static constexpr void add_digit(int &num, typename format_helper::char_type digit)
 	{
 		num = (num * 10) + digit_value(digit);
 	}
 
-	static int read_number(Format const &fmt, typename Format::iterator &it)
+	static constexpr int read_number(Format const &fmt, typename Format::iterator &it)
 	{
 		assert(have_digit(fmt, it));
 		int value = 0;
@@ -1545,6 +1545,67 @@ private:
 };
 
 
+//**************************************************************************
+//  COMPILE-TIME FORMAT STRING CHECKING
+//**************************************************************************
+
+template <typename Character>
+class constant_format
+{
+public:
+	using char_type = Character;
+	typedef char_type const *iterator;
+
+	constexpr constant_format(char_type const *fmt) : m_begin(fmt) { }
+
+	constexpr iterator format_begin() const { return m_begin; }
+	constexpr bool format_at_end(iterator it) const { return format_chars<char_type>::nul == *it; }
+
+private:
+	char_type const *m_begin;
+};
+
+template <typename Character>
+constexpr int format_argument_count(Character const *fmt)
+{
+	using format = constant_format<Character>;
+	using helper = format_helper<format>;
+
+	// walk the format string the same way stream_format does
+	format const f(fmt);
+	int next_pos(1), result(0);
+	for (typename format::iterator it = f.format_begin(); !f.format_at_end(it); )
+	{
+		if (helper::percent != *it)
+		{
+			++it;
+			continue;
+		}
+
+		format_flags flags;
+		int arg_pos(-1), width_pos(-1), prec_pos(-1);
+		if (!helper::parse_format(f, it, flags, next_pos, arg_pos, width_pos, prec_pos))
+			return -1;
+		if (result < width_pos)
+			result = width_pos;
+		if (result < prec_pos)
+			result = prec_pos;
+		switch (flags.get_conversion())
+		{
+		case format_flags::conversion::strerror:
+		case format_flags::conversion::percent:
+			break;
+		default:
+			if (0 >= arg_pos)
+				return -1;
+			if (result < arg_pos)
+				result = arg_pos;
+		}
+	}
+	return result;
+}
+
+
 //**************************************************************************
 //  CORE FORMATTING FUNCTION
 //**************************************************************************
@@ -1688,6 +1749,27 @@ typename std::basic_ostream<Character, Traits>::off_type stream_format(std::basi
 } // namespace detail
 
 
+//**************************************************************************
+//  FORMAT STRING CHECKING FUNCTIONS
+//**************************************************************************
+
+// number of arguments a format string uses, or -1 if it's malformed
+// (usable in constant expressions, so format strings can be checked at compile time)
+template <typename Character>
+constexpr int format_argument_count(Character const *fmt)
+{
+	return detail::format_argument_count(fmt);
+}
+
+// whether a format string is well-formed and has enough arguments
+template <typename Character>
+constexpr bool format_valid(Character const *fmt, std::size_t argument_count)
+{
+	int const needed(detail::format_argument_count(fmt));
+	return (0 <= needed) && (argument_count >= unsigned(needed));
+}
+
+
 //**************************************************************************
 //  FORMAT TO STREAM FUNCTIONS
 //**************************************************************************
@@ -144,20 +144,34 @@ public:
 
 	static ptr find_cached(std::string_view filename) noexcept
 	{
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
+		ptr result;
 		{
-			// if we have a valid entry and it matches our filename, use it and remove from the cache
-			if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
 			{
-				using std::swap;
-				ptr result;
-				swap(s_cache[cachenum], result);
-				osd_printf_verbose("un7z: found %s in cache\n", filename);
-				return result;
+				// if we have a valid entry and it matches our filename, use it and remove from the cache
+				if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
+				{
+					using std::swap;
+					swap(s_cache[cachenum], result);
+					break;
+				}
 			}
 		}
-		return ptr();
+		if (!result)
+			return ptr();
+
+		// the directory is only valid while the file is unchanged
+		std::unique_ptr<osd::directory::entry> stat;
+		try { stat = osd_stat(result->m_filename); }
+		catch (...) { }
+		if (!stat || (stat->size != result->m_archive_stream.length) || (stat->last_modified != result->m_modified))
+		{
+			osd_printf_verbose("un7z: %s changed since it was cached\n", filename);
+			return ptr();
+		}
+		osd_printf_verbose("un7z: found %s in cache\n", filename);
+		return result;
 	}
 
 	static void close(ptr &&archive) noexcept;
@@ -226,6 +240,7 @@ private:
 	static std::mutex                       s_cache_mutex;
 
 	const std::string                       m_filename;             // copy of _7Z filename (for caching)
+	std::chrono::system_clock::time_point   m_modified;             // modification time of _7Z file
 
 	int                                     m_curr_file_idx;        // current file index
 	bool                                    m_curr_is_dir;          // current file is directory
@@ -355,6 +370,17 @@ std::error_condition m7z_file_impl::initialize() noexcept
 			return err;
 		m_archive_stream.file = osd_file_read(std::move(file));
 		osd_printf_verbose("un7z: opened archive file %s\n", m_filename);
+
+		// remember when it was modified, to tell whether it's changed once cached
+		try
+		{
+			std::unique_ptr<osd::directory::entry> const stat(osd_stat(m_filename));
+			if (stat)
+				m_modified = stat->last_modified;
+		}
+		catch (...)
+		{
+		}
 	}
 	else if (!m_archive_stream.length)
 	{
@@ -13,6 +13,7 @@
 #include "corestr.h"
 #include "hashing.h"
 #include "ioprocs.h"
+#include "lrucache.h"
 #include "multibyte.h"
 #include "timeconv.h"
 
@@ -88,22 +89,42 @@ public:
 		m_file = std::move(file);
 	}
 
+	~zip_file_impl()
+	{
+		if (m_inflate_ready)
+			inflateEnd(&m_inflate);
+	}
+
 	static ptr find_cached(std::string_view filename) noexcept
 	{
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
+		ptr result;
+		try
 		{
-			// if we have a valid entry and it matches our filename, use it and remove from the cache
-			if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
-			{
-				using std::swap;
-				ptr result;
-				swap(s_cache[cachenum], result);
-				osd_printf_verbose("unzip: found %s in cache\n", filename);
-				return result;
-			}
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			auto const found(s_cache.find(std::string(filename)));
+			if (s_cache.end() == found)
+				return ptr();
+
+			// take it out of the cache while it's in use
+			result = std::move(found->second);
+			s_cache.erase(found);
+		}
+		catch (...)
+		{
+			return ptr();
+		}
+
+		// the directory is only valid while the file is unchanged
+		std::unique_ptr<osd::directory::entry> stat;
+		try { stat = osd_stat(result->m_filename); }
+		catch (...) { }
+		if (!stat || (stat->size != result->m_length) || (stat->last_modified != result->m_modified))
+		{
+			osd_printf_verbose("unzip: %s changed since it was cached\n", filename);
+			return ptr();
 		}
-		return ptr();
+		osd_printf_verbose("unzip: found %s in cache\n", filename);
+		return result;
 	}
 
 	static void close(ptr &&zip) noexcept;
@@ -112,12 +133,25 @@ public:
 	{
 		// clear call cache entries
 		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (auto &cached : s_cache)
-			cached.reset();
+		s_cache.clear();
 	}
 
 	std::error_condition initialize() noexcept
 	{
+		// remember when the file was modified, to tell whether the cached directory is still good
+		if (!m_filename.empty())
+		{
+			try
+			{
+				std::unique_ptr<osd::directory::entry> const stat(osd_stat(m_filename));
+				if (stat)
+					m_modified = stat->last_modified;
+			}
+			catch (...)
+			{
+			}
+		}
+
 		// read ecd data
 		auto const ziperr = read_ecd();
 		if (ziperr)
@@ -330,13 +364,14 @@ private:
 	};
 
 	static constexpr std::size_t        DECOMPRESS_BUFSIZE = 16384;
-	static constexpr std::size_t        CACHE_SIZE = 8; // number of open files to cache
-	static std::array<ptr, CACHE_SIZE>  s_cache;
+	static constexpr std::size_t        CACHE_SIZE = 64; // number of open files to cache
+	static util::lru_cache_map<std::string, ptr> s_cache;
 	static std::mutex                   s_cache_mutex;
 
 	const std::string           m_filename;                 // copy of ZIP filename (for caching)
 	random_read::ptr            m_file;                     // file handle
 	std::uint64_t               m_length = 0;               // length of zip file
+	std::chrono::system_clock::time_point m_modified;       // modification time of zip file
 
 	ecd                         m_ecd;                      // end of central directory
 
@@ -346,6 +381,8 @@ private:
 	bool                        m_curr_is_dir = false;      // current file is directory
 
 	std::array<std::uint8_t, DECOMPRESS_BUFSIZE> m_buffer;  // buffer for decompression
+	z_stream                    m_inflate;                  // inflate state, reset for each file
+	bool                        m_inflate_ready = false;    // has the inflate state been initialized?
 };
 
 
@@ -705,7 +742,7 @@ private:
 
 archive_category_impl const f_archive_category_instance;
 
-std::array<zip_file_impl::ptr, zip_file_impl::CACHE_SIZE> zip_file_impl::s_cache;
+util::lru_cache_map<std::string, zip_file_impl::ptr> zip_file_impl::s_cache(zip_file_impl::CACHE_SIZE);
 std::mutex zip_file_impl::s_cache_mutex;
 
 
@@ -724,25 +761,16 @@ void zip_file_impl::close(ptr &&zip) noexcept
 		osd_printf_verbose("unzip: closing archive file %s and sending to cache\n", zip->m_filename);
 		zip->m_file.reset();
 
-		// find the first nullptr entry in the cache
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		std::size_t cachenum;
-		for (cachenum = 0; cachenum < s_cache.size(); cachenum++)
-			if (!s_cache[cachenum])
-				break;
-
-		// if no room left in the cache, free the bottommost entry
-		if (cachenum == s_cache.size())
+		// the least recently used entry makes way if the cache is full, and
+		// an entry left by another user of the same file is replaced
+		try
+		{
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			s_cache[zip->m_filename] = std::move(zip);
+		}
+		catch (...)
 		{
-			cachenum--;
-			osd_printf_verbose("unzip: removing %s from cache to make space\n", s_cache[cachenum]->m_filename);
-			s_cache[cachenum].reset();
 		}
-
-		// move everyone else down and place us at the top
-		for ( ; cachenum > 0; cachenum--)
-			s_cache[cachenum] = std::move(s_cache[cachenum - 1]);
-		s_cache[0] = std::move(zip);
 	}
 
 	// make sure it's cleaned up
@@ -1250,26 +1278,36 @@ std::error_condition zip_file_impl::decompress_data_type_8(std::uint64_t offset,
 	std::uint64_t input_remaining(m_header.compressed_length);
 	int zerr;
 
-	// reset the stream
-	z_stream stream;
-	stream.zalloc = Z_NULL;
-	stream.zfree = Z_NULL;
-	stream.opaque = Z_NULL;
+	// initialize the decompressor the first time, and reuse it after that
+	z_stream &stream(m_inflate);
+	if (!m_inflate_ready)
+	{
+		stream.zalloc = Z_NULL;
+		stream.zfree = Z_NULL;
+		stream.opaque = Z_NULL;
+		stream.avail_in = 0;
+		stream.next_in = Z_NULL;
+		zerr = inflateInit2(&stream, -MAX_WBITS);
+		if (zerr != Z_OK)
+		{
+			auto result = convert_zerr(zerr);
+			osd_printf_error(
+					"unzip: error allocating zlib stream to inflate %s from %s (%d)\n",
+					m_header.file_name, m_filename, zerr);
+			return result;
+		}
+		m_inflate_ready = true;
+	}
+	else
+	{
+		zerr = inflateReset(&stream);
+		if (zerr != Z_OK)
+			return convert_zerr(zerr);
+	}
 	stream.avail_in = 0;
 	stream.next_out = reinterpret_cast<Bytef *>(buffer);
 	stream.avail_out = length;
 
-	// initialize the decompressor
-	zerr = inflateInit2(&stream, -MAX_WBITS);
-	if (zerr != Z_OK)
-	{
-		auto result = convert_zerr(zerr);
-		osd_printf_error(
-				"unzip: error allocating zlib stream to inflate %s from %s (%d)\n",
-				m_header.file_name, m_filename, zerr);
-		return result;
-	}
-
 	// loop until we're done
 	while (true)
 	{
@@ -1284,7 +1322,6 @@ std::error_condition zip_file_impl::decompress_data_type_8(std::uint64_t offset,
 			osd_printf_error(
 					"unzip: error reading compressed data for %s in %s (%s:%d %s)\n",
 					m_header.file_name, m_filename, filerr.category().name(), filerr.value(), filerr.message());
-			inflateEnd(&stream);
 			return filerr;
 		}
 		offset += read_length;
@@ -1295,7 +1332,6 @@ std::error_condition zip_file_impl::decompress_data_type_8(std::uint64_t offset,
 			osd_printf_error(
 					"unzip: unexpectedly reached end-of-file while reading compressed data for %s in %s\n",
 					m_header.file_name, m_filename);
-			inflateEnd(&stream);
 			return archive_file::error::FILE_TRUNCATED;
 		}
 
@@ -1320,22 +1356,10 @@ std::error_condition zip_file_impl::decompress_data_type_8(std::uint64_t offset,
 			osd_printf_error(
 					"unzip: error inflating %s from %s (%d)\n",
 					m_header.file_name, m_filename, zerr);
-			inflateEnd(&stream);
 			return result;
 		}
 	}
 
-	// finish decompression
-	zerr = inflateEnd(&stream);
-	if (zerr != Z_OK)
-	{
-		auto result = convert_zerr(zerr);
-		osd_printf_error(
-				"unzip: error finishing inflation of %s from %s (%d)\n",
-				m_header.file_name, m_filename, zerr);
-		return result;
-	}
-
 	// if anything looks funny, report an error
 	if (stream.avail_out || input_remaining)
 	{
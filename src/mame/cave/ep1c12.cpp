@@ -33,12 +33,12 @@ static constexpr int EP1C_CLIP_MARGIN = 32;
 ep1c12_device::ep1c12_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock)
 	: device_t(mconfig, EP1C12, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
+	, device_blitter_offload_interface(mconfig, *this)
 	, m_ram16(nullptr), m_gfx_size(0), m_bitmaps(nullptr), m_use_ram(nullptr)
-	, m_main_ramsize(0), m_main_rammask(0), m_ram16_copy(nullptr), m_work_queue(nullptr)
+	, m_main_ramsize(0), m_main_rammask(0), m_ram16_copy(nullptr)
 	, m_maincpu(*this, finder_base::DUMMY_TAG)
 	, m_port_r_cb(*this, 0)
 {
-	m_blitter_request = nullptr;
 	m_blitter_delay_timer = nullptr;
 	m_blitter_busy = 0;
 	m_gfx_addr = 0;
@@ -105,7 +105,6 @@ void ep1c12_device::device_start()
 void ep1c12_device::device_reset()
 {
 	m_use_ram = m_ram16_copy.get();
-	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
 
 	// cache table to avoid divides in blit code, also pre-clamped
 	for (int y = 0; y < 0x40; y++)
@@ -771,14 +770,6 @@ void ep1c12_device::gfx_exec()
 	}
 }
 
-void *ep1c12_device::blit_request_callback(void *param, int threadid)
-{
-	ep1c12_device *object = reinterpret_cast<ep1c12_device *>(param);
-	object->gfx_exec();
-	return nullptr;
-}
-
-
 u32 ep1c12_device::gfx_ready_r()
 {
 	return m_blitter_busy ? 0x00000000 : 0x00000010;
@@ -791,15 +782,7 @@ void ep1c12_device::gfx_exec_w(address_space &space, offs_t offset, u32 data, u3
 		if (data & 1)
 		{
 			// make sure we've not already got a request running
-			if (m_blitter_request)
-			{
-				int result;
-				do
-				{
-					result = osd_work_item_wait(m_blitter_request, 1000);
-				} while (result == 0);
-				osd_work_item_release(m_blitter_request);
-			}
+			blitter_sync();
 
 			m_gfx_clip_x_shadowcopy = m_gfx_clip_x;
 			m_gfx_clip_y_shadowcopy = m_gfx_clip_y;
@@ -823,22 +806,14 @@ void ep1c12_device::gfx_exec_w(address_space &space, offs_t offset, u32 data, u3
 			m_blitter_delay_timer->adjust(attotime::from_nsec(m_blit_delay_ns));
 
 			m_gfx_addr_shadowcopy = m_gfx_addr;
-			m_blitter_request = osd_work_item_queue(m_work_queue, blit_request_callback, (void*)this, 0);
+			blitter_submit([this] () { gfx_exec(); });
 		}
 	}
 }
 
 void ep1c12_device::draw_screen(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
-	if (m_blitter_request)
-	{
-		int result;
-		do
-		{
-			result = osd_work_item_wait(m_blitter_request, 1000);
-		} while (result == 0);
-		osd_work_item_release(m_blitter_request);
-	}
+	blitter_sync();
 
 	bitmap.fill(0, cliprect);
 
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include "diblit.h"
+
 #define DEBUG_VRAM_VIEWER 0 // VRAM viewer for debug
 
-class ep1c12_device : public device_t, public device_video_interface
+class ep1c12_device : public device_t, public device_video_interface, public device_blitter_offload_interface
 {
 public:
 	ep1c12_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock);
@@ -25,8 +27,6 @@ public:
 		m_main_rammask = ramsize - 1;
 	}
 
-	static void *blit_request_callback(void *param, int threadid);
-
 	u64 fpga_r();
 	void fpga_w(offs_t offset, u64 data, u64 mem_mask = ~0);
 
@@ -843,9 +843,6 @@ protected:
 
 	TIMER_CALLBACK_MEMBER(blitter_delay_callback);
 
-	osd_work_queue *m_work_queue;
-	osd_work_item *m_blitter_request;
-
 	// blit timing
 	emu_timer *m_blitter_delay_timer;
 	int m_blitter_busy;
@@ -146,7 +146,7 @@ struct namcos22_object_data
 };
 
 
-class namcos22_renderer : public poly_manager<poly3d_t, namcos22_object_data, 4>
+class namcos22_renderer : public poly_manager<poly3d_t, namcos22_object_data, 4, POLY_FLAG_BINNED>
 {
 public:
 	namcos22_renderer(namcos22_state &state);
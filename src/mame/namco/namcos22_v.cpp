@@ -13,7 +13,7 @@
 // poly constructor
 
 namcos22_renderer::namcos22_renderer(namcos22_state &state) :
-	poly_manager<poly3d_t, namcos22_object_data, 4>(state.machine()),
+	poly_manager<poly3d_t, namcos22_object_data, 4, POLY_FLAG_BINNED>(state.machine()),
 	m_state(state)
 	{
 		init();
@@ -94,7 +94,8 @@ private:
 	bool m_flipscreen = false;
 	bool m_blitter_direction_x = false;
 	bool m_blitter_direction_y = false;
-	std::unique_ptr<uint8_t[]> m_videoram;
+	std::unique_ptr<uint16_t[]> m_videoram;
+	bitmap_ind16 m_videobitmap;
 	bool m_flipscreen_old = false;
 	emu_timer *m_blitter_timer = nullptr;
 
@@ -102,6 +103,7 @@ private:
 
 	void vramflip();
 	void gfxdraw();
+	void update_display();
 };
 
 class pastelg_state : public pastelg_common_state
@@ -244,6 +246,7 @@ void pastelg_common_state::blitter_w(offs_t offset, uint8_t data)
 				m_blitter_direction_y = (data & 0x02) ? 1 : 0;
 				m_flipscreen = (data & 0x04) ? 0 : 1;
 				m_dispflag = (data & 0x08) ? 0 : 1;
+				update_display();
 				vramflip();
 				break;
 	}
@@ -397,7 +400,9 @@ void pastelg_common_state::video_start()
 	int width = m_screen->width();
 	int height = m_screen->height();
 
-	m_videoram = make_unique_clear<uint8_t[]>(width * height);
+	// the frame buffer is shown as is while the display is on
+	m_videoram = make_unique_clear<uint16_t[]>(width * height);
+	m_videobitmap.wrap(m_videoram.get(), width, height, width);
 
 	m_blitter_timer = timer_alloc(FUNC(pastelg_state::blitter_timer_callback), this);
 
@@ -413,10 +418,19 @@ void pastelg_common_state::video_start()
 	save_item(NAME(m_palbank));
 	save_pointer(NAME(m_videoram), width*height);
 	save_item(NAME(m_flipscreen_old));
+	machine().save().register_postload(save_prepost_delegate(FUNC(pastelg_common_state::update_display), this));
 
 	m_palbank = 0;
 }
 
+void pastelg_common_state::update_display()
+{
+	if (m_dispflag)
+		m_screen->set_direct_bitmap(m_videobitmap);
+	else
+		m_screen->clear_direct_bitmap();
+}
+
 /******************************************************************************
 
 
@@ -163,6 +163,7 @@ uint32_t n64_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, c
 	}
 	*/
 
+	m_rdp->wait_for_render("VI");
 	m_rdp->mark_frame();
 
 	if (m_rcp_periphs->vi_blank)
@@ -1891,6 +1892,10 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 
 	const int32_t ycur = yh & ~3;
 	const int32_t ylfar = yl | 3;
+
+	// spans of earlier primitives may still be rendering, so only recycle the aux buffer once they're done
+	if ((m_aux_buf_ptr + sizeof(rdp_span_aux) * std::min(((ylfar - ycur) >> 2) + 1, 4096)) > EXTENT_AUX_COUNT)
+		wait_for_render("span aux buffer");
 	const int32_t ldflag = (sign_dxhdy ^ flip) ? 0 : 3;
 	int32_t majorx[4];
 	int32_t minorx[4];
@@ -2064,7 +2069,6 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
 	//wait("draw_triangle");
 }
 
@@ -2077,7 +2081,6 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 void n64_rdp::triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zbuffer)
 {
 	draw_triangle(cmd_buf, shade, texture, zbuffer, false);
-	m_pipe_clean = false;
 }
 
 void n64_rdp::cmd_tex_rect(uint64_t *cmd_buf)
@@ -2182,7 +2185,7 @@ void n64_rdp::cmd_sync_tile(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_sync_full(uint64_t *cmd_buf)
 {
-	//wait("SyncFull");
+	wait_for_render("SyncFull");
 	m_n64_periphs->dp_full_sync();
 }
 
@@ -2207,7 +2210,7 @@ void n64_rdp::cmd_set_convert(uint64_t *cmd_buf)
 {
 	const uint64_t w1 = cmd_buf[0];
 
-	if(!m_pipe_clean) { m_pipe_clean = true; wait("SetConvert"); }
+	if(!m_pipe_clean) { wait_for_render("SetConvert"); }
 	int32_t k0 = int32_t(w1 >> 45) & 0x1ff;
 	int32_t k1 = int32_t(w1 >> 36) & 0x1ff;
 	int32_t k2 = int32_t(w1 >> 27) & 0x1ff;
@@ -2289,6 +2292,7 @@ void n64_rdp::cmd_set_other_modes(uint64_t *cmd_buf)
 void n64_rdp::cmd_load_tlut(uint64_t *cmd_buf)
 {
 	//wait("LoadTLUT");
+	if(texture_source_pending()) { wait_for_render("LoadTLUT"); }
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
 
@@ -2361,6 +2365,7 @@ void n64_rdp::cmd_set_tile_size(uint64_t *cmd_buf)
 void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 {
 	//wait("LoadBlock");
+	if(texture_source_pending()) { wait_for_render("LoadBlock"); }
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
 
@@ -2574,6 +2579,7 @@ void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 void n64_rdp::cmd_load_tile(uint64_t *cmd_buf)
 {
 	//wait("LoadTile");
+	if(texture_source_pending()) { wait_for_render("LoadTile"); }
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
 	const int32_t tilenum = int32_t(w1 >> 24) & 0x7;
@@ -2999,6 +3005,8 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_aux_buf_ptr = 0;
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
+	m_pending_fb_start = ~0U;
+	m_pending_fb_end = 0;
 
 	m_pending_mode_block = false;
 
@@ -3143,7 +3151,24 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 			render_extents<8>(clip, render_delegate(&n64_rdp::span_draw_fill, this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
+
+	// the spans are left to render while the command list carries on; note what they may write so that
+	// texture loads from a frame rendered to earlier can wait for it
+	const uint32_t line_bytes = (uint32_t(m_misc_state.m_fb_width) << m_misc_state.m_fb_size) >> 1;
+	m_pending_fb_start = std::min(m_pending_fb_start, m_misc_state.m_fb_address);
+	m_pending_fb_end = std::max(m_pending_fb_end, m_misc_state.m_fb_address + (end + 1) * line_bytes);
+	m_pipe_clean = false;
+}
+
+// rendering is only waited for when something needs its results: a full sync, a change to the
+// state the span renderers read directly, a texture load from the color image, or the VI
+void n64_rdp::wait_for_render(const char *reason)
+{
+	wait(reason);
+	m_pipe_clean = true;
+	m_aux_buf_ptr = 0;
+	m_pending_fb_start = ~0U;
+	m_pending_fb_end = 0;
 }
 
 void n64_rdp::rgbaz_clip(int32_t sr, int32_t sg, int32_t sb, int32_t sa, int32_t* sz, rdp_span_aux* userdata)
@@ -266,6 +266,7 @@ public:
 	void lookup_cvmask_derivatives(uint32_t mask, uint8_t* offx, uint8_t* offy, rdp_span_aux* userdata);
 
 	void        mark_frame() { m_capture.mark_frame(*m_machine); }
+	void        wait_for_render(const char *reason);
 
 	misc_state_t m_misc_state;
 
@@ -355,6 +356,10 @@ private:
 	combine_modes_t m_combine;
 	bool            m_pending_mode_block;
 	bool            m_pipe_clean;
+	uint32_t        m_pending_fb_start;   // span of RDRAM that queued rendering may still be writing
+	uint32_t        m_pending_fb_end;
+
+	bool            texture_source_pending() const { return m_misc_state.m_ti_address >= m_pending_fb_start && m_misc_state.m_ti_address < m_pending_fb_end; }
 
 	cv_mask_derivative_t cvarray[(1 << 8)];
 
@@ -22,6 +22,11 @@
 #include "screen.h"
 #include "tilemap.h"
 
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 typedef float MATRIX[4][4];
 typedef float VECTOR[4];
 typedef float VECTOR3[3];
@@ -306,6 +311,42 @@ private:
 	int m_viewport_tri_index[4]{};
 	int m_viewport_tri_alpha_index[4]{};
 
+	// triangles built for each model drawn in the last display list, keyed on the model address and
+	// everything its transform, clipping and lighting depend on
+	struct model_cache_key
+	{
+		uint32_t addr;
+		MATRIX transform;
+		MATRIX coordinate_system;
+		MATRIX projection;
+		VECTOR3 parallel_light;
+		float parallel_light_intensity;
+		float ambient_light_intensity;
+		float viewport[6];
+
+		bool operator==(const model_cache_key &that) const { return !std::memcmp(this, &that, sizeof(*this)); }
+	};
+	struct model_cache_hash
+	{
+		size_t operator()(const model_cache_key &key) const { return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char *>(&key), sizeof(key))); }
+	};
+	struct cached_model
+	{
+		uint32_t serial = 0;            // display list the triangles were built in
+		uint32_t used = 0;              // last display list that drew them
+		uint32_t first_page = 0;        // polygon RAM pages the model was read from
+		uint32_t last_page = 0;
+		bool in_polygon_ram = false;
+		bool color_table = false;       // colors were read from polygon RAM's color table
+		std::vector<m3_triangle> opaque;
+		std::vector<m3_triangle> alpha;
+	};
+	std::unordered_map<model_cache_key, cached_model, model_cache_hash> m_model_cache;
+	static constexpr int POLYGON_RAM_PAGE_SHIFT = 8;
+	std::unique_ptr<uint32_t[]> m_polygon_ram_serial;   // display list serial when each page of polygon RAM was last written
+	uint32_t m_display_list_serial = 0;
+	bool m_model_color_table = false;
+
 	uint32_t rtc72421_r(offs_t offset);
 	void rtc72421_w(offs_t offset, uint32_t data);
 	uint64_t model3_char_r(offs_t offset);
@@ -404,6 +445,9 @@ private:
 	void multiply_matrix_stack(MATRIX matrix);
 	void translate_matrix_stack(float x, float y, float z);
 	void draw_model(uint32_t addr);
+	void transform_model(uint32_t addr, int &index);
+	bool polygon_ram_written_since(uint32_t first_page, uint32_t last_page, uint32_t serial) const;
+	void mark_polygon_ram_written(uint32_t offset) { m_polygon_ram_serial[(offset & (0x400000/4 - 1)) >> POLYGON_RAM_PAGE_SHIFT] = m_display_list_serial; }
 	uint32_t *get_memory_pointer(uint32_t address);
 	void set_projection(float left, float right, float top, float bottom, float near, float far);
 	void load_matrix(int matrix_num, MATRIX *out);
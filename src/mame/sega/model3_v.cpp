@@ -155,6 +155,7 @@ void model3_state::video_start()
 	m_culling_ram = make_unique_clear<uint32_t[]>(0x400000/4);
 	/* 4MB Polygon RAM */
 	m_polygon_ram = make_unique_clear<uint32_t[]>(0x400000/4);
+	m_polygon_ram_serial = make_unique_clear<uint32_t[]>((0x400000/4) >> POLYGON_RAM_PAGE_SHIFT);
 
 	m_vid_reg0 = 0;
 
@@ -515,6 +516,9 @@ void model3_state::invalidate_texture(int page, int texx, int texy, int texwidth
 				cached_texture *freeme = m_texcache[page][texy + y][texx + x];
 				m_texcache[page][texy + y][texx + x] = freeme->next;
 				delete freeme;
+
+				// cached triangles may point at it
+				m_model_cache.clear();
 			}
 }
 
@@ -962,6 +966,7 @@ void model3_state::real3d_polygon_ram_w(offs_t offset, uint64_t data, uint64_t m
 	{
 		m_polygon_ram[(offset*2)+1] = BYTE_REVERSE32((uint32_t)(data));
 	}
+	mark_polygon_ram_written(offset*2);
 }
 
 static const uint8_t texture_decode16[64] =
@@ -1204,8 +1209,18 @@ void model3_state::real3d_display_list_end()
 	m_renderer->clear_fb();
 
 	reset_triangle_buffers();
+	m_display_list_serial++;
 	real3d_traverse_display_list();
 
+	// only keep the models this display list drew
+	for (auto it = m_model_cache.begin(); it != m_model_cache.end(); )
+	{
+		if (it->second.used != m_display_list_serial)
+			it = m_model_cache.erase(it);
+		else
+			++it;
+	}
+
 	for (int i=0; i < 4; i++)
 	{
 		int ticount, tiacount;
@@ -1312,6 +1327,7 @@ void model3_state::real3d_polygon_ram_dma(uint32_t src, uint32_t dst, int length
 		if (byteswap)
 			w = BYTE_REVERSE32(w);
 
+		mark_polygon_ram_written(d);
 		m_polygon_ram[d++] = w;
 		src += 4;
 	}
@@ -1482,13 +1498,93 @@ m3_triangle *model3_state::push_triangle(bool alpha)
 	}
 }
 
+bool model3_state::polygon_ram_written_since(uint32_t first_page, uint32_t last_page, uint32_t serial) const
+{
+	for (uint32_t page = first_page; page <= last_page; page++)
+		if (m_polygon_ram_serial[page] >= serial)
+			return true;
+	return false;
+}
+
 void model3_state::draw_model(uint32_t addr)
+{
+	// static geometry is often drawn with the same matrices frame after frame,
+	// so reuse the triangles built last time if nothing they depend on changed
+	model_cache_key key;
+	memset(&key, 0, sizeof(key));
+	key.addr = addr;
+	get_top_matrix(&key.transform);
+	memcpy(key.coordinate_system, m_coordinate_system, sizeof(key.coordinate_system));
+	memcpy(key.projection, m_projection_matrix, sizeof(key.projection));
+	memcpy(key.parallel_light, m_parallel_light, sizeof(key.parallel_light));
+	key.parallel_light_intensity = m_parallel_light_intensity;
+	key.ambient_light_intensity = m_ambient_light_intensity;
+	key.viewport[0] = m_viewport_x;
+	key.viewport[1] = m_viewport_y;
+	key.viewport[2] = m_viewport_width;
+	key.viewport[3] = m_viewport_height;
+	key.viewport[4] = m_viewport_near;
+	key.viewport[5] = m_viewport_far;
+
+	auto found = m_model_cache.find(key);
+	if (found != m_model_cache.end())
+	{
+		cached_model &cached = found->second;
+		bool const stale =
+				(cached.in_polygon_ram && polygon_ram_written_since(cached.first_page, cached.last_page, cached.serial)) ||
+				(cached.color_table && polygon_ram_written_since(0x400 >> POLYGON_RAM_PAGE_SHIFT, 0xbff >> POLYGON_RAM_PAGE_SHIFT, cached.serial));
+		if (!stale)
+		{
+			cached.used = m_display_list_serial;
+			for (const m3_triangle &src : cached.opaque)
+			{
+				m3_triangle *tri = push_triangle(false);
+				if (!tri)
+					break;
+				*tri = src;
+			}
+			for (const m3_triangle &src : cached.alpha)
+			{
+				m3_triangle *tri = push_triangle(true);
+				if (!tri)
+					break;
+				*tri = src;
+			}
+			return;
+		}
+	}
+
+	int const tri_start = m_tri_buffer_ptr;
+	int const tri_alpha_start = m_tri_alpha_buffer_ptr;
+	int length = 0;
+	m_model_color_table = false;
+	transform_model(addr, length);
+
+	// a model cut short by a full triangle buffer can't be reused
+	if (m_tri_buffer_ptr >= TRI_BUFFER_SIZE || m_tri_alpha_buffer_ptr >= TRI_ALPHA_BUFFER_SIZE)
+	{
+		if (found != m_model_cache.end())
+			m_model_cache.erase(found);
+		return;
+	}
+
+	cached_model &cached = (found != m_model_cache.end()) ? found->second : m_model_cache[key];
+	cached.serial = m_display_list_serial;
+	cached.used = m_display_list_serial;
+	cached.in_polygon_ram = addr < 0x100000;
+	cached.first_page = addr >> POLYGON_RAM_PAGE_SHIFT;
+	cached.last_page = std::min<uint32_t>(addr + std::max(length, 1) - 1, 0x100000 - 1) >> POLYGON_RAM_PAGE_SHIFT;
+	cached.color_table = m_model_color_table;
+	cached.opaque.assign(&m_tri_buffer[tri_start], &m_tri_buffer[m_tri_buffer_ptr]);
+	cached.alpha.assign(&m_tri_alpha_buffer[tri_alpha_start], &m_tri_alpha_buffer[m_tri_alpha_buffer_ptr]);
+}
+
+void model3_state::transform_model(uint32_t addr, int &index)
 {
 	// Polygon RAM is mapped to the low 4MB of VROM
 	uint32_t *model = (addr >= 0x100000) ? &m_vrom[addr] :  &m_polygon_ram[addr];
 
 	uint32_t header[7];
-	int index = 0;
 	bool last_polygon = false, first_polygon = true, back_face = false;
 	int num_vertices;
 	int i, v, vi;
@@ -1593,6 +1689,7 @@ void model3_state::draw_model(uint32_t addr)
 		{
 			int ci = (header[4] >> 8) & 0x7ff;
 			color = m_polygon_ram[0x400 + ci];
+			m_model_color_table = true;
 		}
 
 		polygon_transparency =  (header[6] & 0x800000) ? 32 : ((header[6] >> 18) & 0x1f);
@@ -59,6 +59,16 @@ public:
 	//  our implementation is not currently tile based, and thus the accumulation buffer is screen sized
 	std::unique_ptr<bitmap_rgb32> fake_accumulationbuffer_bitmap;
 
+	// each row of 32x32 tiles of the accumulation buffer is rendered as a separate work item
+	struct tile_row
+	{
+		powervr2_device *device;
+		bitmap_rgb32 *bitmap;
+		rectangle cliprect;
+	};
+	osd_work_queue *m_tile_queue;
+	tile_row m_tile_rows[480 / 32];
+
 	/*
 	 * Per-polygon base and offset colors.  These are scaled by per-vertex
 	 * weights.
@@ -339,6 +349,7 @@ public:
 
 protected:
 	virtual void device_start() override ATTR_COLD;
+	virtual void device_stop() override ATTR_COLD;
 	virtual void device_reset() override ATTR_COLD;
 	ioport_constructor device_input_ports() const override;
 
@@ -512,7 +523,7 @@ private:
 									float const offl[4], float const offr[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_span(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 								float y0, float y1,
 								float xl, float xr,
 								float ul, float ur,
@@ -528,18 +539,23 @@ private:
 								float const doldy[4], float const dordy[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 										const vert *v0,
 										const vert *v1, const vert *v2);
 
 	template <int group_no>
-		void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+		void render_tri(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v);
 
 	template <int group_no>
 		void render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
+	template <int group_no>
+		void scale_group_texcoords();
+
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void render_tile_row(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	static void *render_tile_row_callback(void *param, int threadid);
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
 	void pvr_drawframebuffer(bitmap_rgb32 &bitmap,const rectangle &cliprect);
 	static uint32_t dilate0(uint32_t value,int bits);
@@ -101,8 +101,12 @@ protected:
 
 		int         local_x = 0;
 		int         local_y = 0;
+		int         draw_local_x = 0;
+		int         draw_local_y = 0;
 
 		emu_timer * draw_end_timer = nullptr;
+		osd_work_queue *draw_queue = nullptr;
+		bool        draw_pending = false;
 	}m_vdp1;
 
 	struct {
@@ -171,6 +175,11 @@ protected:
 	void stv_vdp1_change_framebuffers();
 	void video_update_vdp1();
 	void stv_vdp1_process_list();
+	bool stv_vdp1_next_command(uint16_t ctrl, uint16_t link, int &position, int &nest, int &draw_this_sprite);
+	bool stv_vdp1_scan_list(int &spritecount);
+	void stv_vdp1_draw_list();
+	static void *stv_vdp1_draw_list_callback(void *param, int threadid);
+	void stv_vdp1_wait_for_draw();
 	void stv_vdp1_set_drawpixel();
 
 	void stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sprite_type);
@@ -209,6 +218,7 @@ protected:
 
 	void stv_clear_framebuffer(int which_framebuffer);
 	void stv_vdp1_state_save_postload();
+	void stv_vdp1_exit();
 	int stv_vdp1_start();
 
 	struct stv_vdp1_poly_scanline
@@ -356,6 +356,7 @@ void saturn_state::system_reset_w(int state)
 	memset(m_vdp2_regs.get(),0x00,0x040000);
 	memset(m_vdp2_vram.get(),0x00,0x100000);
 	memset(m_vdp2_cram.get(),0x00,0x080000);
+	stv_vdp1_wait_for_draw();
 	memset(m_vdp1_vram.get(),0x00,0x100000);
 	//A-Bus
 }
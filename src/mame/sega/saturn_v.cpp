@@ -170,6 +170,8 @@ uint16_t saturn_state::saturn_vdp1_regs_r(offs_t offset)
 {
 	//logerror ("%s VDP1: Read from Registers, Offset %04x\n", machine().describe_context(), offset);
 
+	stv_vdp1_wait_for_draw();
+
 	switch(offset)
 	{
 		case 0x02/2:
@@ -309,6 +311,8 @@ void saturn_state::stv_set_framebuffer_config()
 
 void saturn_state::saturn_vdp1_regs_w(offs_t offset, uint16_t data, uint16_t mem_mask)
 {
+	stv_vdp1_wait_for_draw();
+
 	COMBINE_DATA(&m_vdp1_regs[offset]);
 
 	switch(offset)
@@ -361,6 +365,8 @@ void saturn_state::saturn_vdp1_vram_w(offs_t offset, uint32_t data, uint32_t mem
 {
 	uint8_t *vdp1 = m_vdp1.gfx_decode.get();
 
+	stv_vdp1_wait_for_draw();
+
 	COMBINE_DATA (&m_vdp1_vram[offset]);
 
 //  if (((offset * 4) > 0xdf) && ((offset * 4) < 0x140))
@@ -379,6 +385,7 @@ void saturn_state::saturn_vdp1_vram_w(offs_t offset, uint32_t data, uint32_t mem
 void saturn_state::saturn_vdp1_framebuffer0_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
 	//popmessage ("STV VDP1 Framebuffer 0 WRITE offset %08x data %08x",offset, data);
+	stv_vdp1_wait_for_draw();
 	if ( STV_VDP1_TVM & 1 )
 	{
 		/* 8-bit mode */
@@ -422,6 +429,7 @@ uint32_t saturn_state::saturn_vdp1_framebuffer0_r(offs_t offset, uint32_t mem_ma
 {
 	uint32_t result = 0;
 	//popmessage ("STV VDP1 Framebuffer 0 READ offset %08x",offset);
+	stv_vdp1_wait_for_draw();
 	if ( STV_VDP1_TVM & 1 )
 	{
 		/* 8-bit mode */
@@ -1422,12 +1430,12 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 
 int saturn_state::x2s(int v)
 {
-	return (int32_t)(int16_t)v + m_vdp1.local_x;
+	return (int32_t)(int16_t)v + m_vdp1.draw_local_x;
 }
 
 int saturn_state::y2s(int v)
 {
-	return (int32_t)(int16_t)v + m_vdp1.local_y;
+	return (int32_t)(int16_t)v + m_vdp1.draw_local_y;
 }
 
 void saturn_state::stv_vdp1_draw_line(const rectangle &cliprect)
@@ -1802,6 +1810,8 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 
 TIMER_CALLBACK_MEMBER(saturn_state::vdp1_draw_end )
 {
+	stv_vdp1_wait_for_draw();
+
 	/* set CEF to 1*/
 	CEF_1;
 
@@ -1818,7 +1828,93 @@ TIMER_CALLBACK_MEMBER(saturn_state::vdp1_draw_end )
 }
 
 
-void saturn_state::stv_vdp1_process_list()
+/* proecess jump / skip commands, set position for next sprite; returns false if the list ends here */
+bool saturn_state::stv_vdp1_next_command(uint16_t ctrl, uint16_t link, int &position, int &vdp1_nest, int &draw_this_sprite)
+{
+	switch (ctrl & 0x7000)
+	{
+		case 0x0000: // jump next
+			if (VDP1_LOG) logerror ("Sprite List Process + Next (Normal)\n");
+			position++;
+			break;
+		case 0x1000: // jump assign
+			if (VDP1_LOG) logerror ("Sprite List Process + Jump Old %06x New %06x\n", position, (link>>2));
+			position= (link>>2);
+			break;
+		case 0x2000: // jump call
+			if (vdp1_nest == -1)
+			{
+				if (VDP1_LOG) logerror ("Sprite List Process + Call Old %06x New %06x\n",position, (link>>2));
+				vdp1_nest = position+1;
+				position = (link>>2);
+			}
+			else
+			{
+				if (VDP1_LOG) logerror ("Sprite List Nested Call, ignoring\n");
+				position++;
+			}
+			break;
+		case 0x3000:
+			if (vdp1_nest != -1)
+			{
+				if (VDP1_LOG) logerror ("Sprite List Process + Return\n");
+				position = vdp1_nest;
+				vdp1_nest = -1;
+			}
+			else
+			{
+				if (VDP1_LOG) logerror ("Attempted return from no subroutine, aborting\n");
+				position++;
+				return false; // end of list
+			}
+			break;
+		case 0x4000:
+			draw_this_sprite = 0;
+			position++;
+			break;
+		case 0x5000:
+			if (VDP1_LOG) logerror ("Sprite List Skip + Jump Old %06x New %06x\n", position, (link>>2));
+			draw_this_sprite = 0;
+			position= (link>>2);
+
+			break;
+		case 0x6000:
+			draw_this_sprite = 0;
+			if (vdp1_nest == -1)
+			{
+				if (VDP1_LOG) logerror ("Sprite List Skip + Call To Subroutine Old %06x New %06x\n",position, (link>>2));
+
+				vdp1_nest = position+1;
+				position = (link>>2);
+			}
+			else
+			{
+				if (VDP1_LOG) logerror ("Sprite List Nested Call, ignoring\n");
+				position++;
+			}
+			break;
+		case 0x7000:
+			draw_this_sprite = 0;
+			if (vdp1_nest != -1)
+			{
+				if (VDP1_LOG) logerror ("Sprite List Skip + Return from Subroutine\n");
+
+				position = vdp1_nest;
+				vdp1_nest = -1;
+			}
+			else
+			{
+				if (VDP1_LOG) logerror ("Attempted return from no subroutine, aborting\n");
+				position++;
+				return false; // end of list
+			}
+			break;
+	}
+
+	return true;
+}
+
+void saturn_state::stv_vdp1_draw_list()
 {
 	int position;
 	int spritecount;
@@ -1834,9 +1930,6 @@ void saturn_state::stv_vdp1_process_list()
 
 	stv_clear_gouraud_shading();
 
-	/*Set CEF bit to 0*/
-	CEF_0;
-
 	// TODO: is there an actual limit for this?
 	while (spritecount<16383) // max 16383 with texture or max 16384 without texture - vitrually unlimited
 	{
@@ -1877,85 +1970,8 @@ void saturn_state::stv_vdp1_process_list()
 //      stv2_current_sprite.UNUSED  = (m_vdp1_vram[position * (0x20/4)+7] & 0x0000ffff) >> 0;
 
 		/* proecess jump / skip commands, set position for next sprite */
-		switch (stv2_current_sprite.CMDCTRL & 0x7000)
-		{
-			case 0x0000: // jump next
-				if (VDP1_LOG) logerror ("Sprite List Process + Next (Normal)\n");
-				position++;
-				break;
-			case 0x1000: // jump assign
-				if (VDP1_LOG) logerror ("Sprite List Process + Jump Old %06x New %06x\n", position, (stv2_current_sprite.CMDLINK>>2));
-				position= (stv2_current_sprite.CMDLINK>>2);
-				break;
-			case 0x2000: // jump call
-				if (vdp1_nest == -1)
-				{
-					if (VDP1_LOG) logerror ("Sprite List Process + Call Old %06x New %06x\n",position, (stv2_current_sprite.CMDLINK>>2));
-					vdp1_nest = position+1;
-					position = (stv2_current_sprite.CMDLINK>>2);
-				}
-				else
-				{
-					if (VDP1_LOG) logerror ("Sprite List Nested Call, ignoring\n");
-					position++;
-				}
-				break;
-			case 0x3000:
-				if (vdp1_nest != -1)
-				{
-					if (VDP1_LOG) logerror ("Sprite List Process + Return\n");
-					position = vdp1_nest;
-					vdp1_nest = -1;
-				}
-				else
-				{
-					if (VDP1_LOG) logerror ("Attempted return from no subroutine, aborting\n");
-					position++;
-					goto end; // end of list
-				}
-				break;
-			case 0x4000:
-				draw_this_sprite = 0;
-				position++;
-				break;
-			case 0x5000:
-				if (VDP1_LOG) logerror ("Sprite List Skip + Jump Old %06x New %06x\n", position, (stv2_current_sprite.CMDLINK>>2));
-				draw_this_sprite = 0;
-				position= (stv2_current_sprite.CMDLINK>>2);
-
-				break;
-			case 0x6000:
-				draw_this_sprite = 0;
-				if (vdp1_nest == -1)
-				{
-					if (VDP1_LOG) logerror ("Sprite List Skip + Call To Subroutine Old %06x New %06x\n",position, (stv2_current_sprite.CMDLINK>>2));
-
-					vdp1_nest = position+1;
-					position = (stv2_current_sprite.CMDLINK>>2);
-				}
-				else
-				{
-					if (VDP1_LOG) logerror ("Sprite List Nested Call, ignoring\n");
-					position++;
-				}
-				break;
-			case 0x7000:
-				draw_this_sprite = 0;
-				if (vdp1_nest != -1)
-				{
-					if (VDP1_LOG) logerror ("Sprite List Skip + Return from Subroutine\n");
-
-					position = vdp1_nest;
-					vdp1_nest = -1;
-				}
-				else
-				{
-					if (VDP1_LOG) logerror ("Attempted return from no subroutine, aborting\n");
-					position++;
-					goto end; // end of list
-				}
-				break;
-		}
+		if (!stv_vdp1_next_command(stv2_current_sprite.CMDCTRL, stv2_current_sprite.CMDLINK, position, vdp1_nest, draw_this_sprite))
+			goto end; // end of list
 
 		/* continue to draw this sprite only if the command wasn't to skip it */
 		if (draw_this_sprite ==1)
@@ -2033,8 +2049,8 @@ void saturn_state::stv_vdp1_process_list()
 
 				case 0x000a:
 					if (VDP1_LOG) logerror ("Sprite List Local Co-Ordinate Set (%d %d)\n",(int16_t)stv2_current_sprite.CMDXA,(int16_t)stv2_current_sprite.CMDYA);
-					m_vdp1.local_x = (int16_t)stv2_current_sprite.CMDXA;
-					m_vdp1.local_y = (int16_t)stv2_current_sprite.CMDYA;
+					m_vdp1.draw_local_x = (int16_t)stv2_current_sprite.CMDXA;
+					m_vdp1.draw_local_y = (int16_t)stv2_current_sprite.CMDYA;
 					break;
 
 				default:
@@ -2053,13 +2069,108 @@ void saturn_state::stv_vdp1_process_list()
 	end:
 	m_vdp1.copr = (position * 0x20) >> 3;
 
+	if (VDP1_LOG) logerror ("End of list processing!\n");
+}
+
+/* walks the list without drawing, to count the commands fetched for the draw end timing; returns false
+   if drawing it has side effects (illegal commands and colour modes, logging) and can't be left to a worker */
+bool saturn_state::stv_vdp1_scan_list(int &spritecount)
+{
+	int position = 0;
+	int vdp1_nest = -1;
+	bool threadable = !VDP1_LOG;
+
+	spritecount = 0;
+	while (spritecount<16383)
+	{
+		int draw_this_sprite = 1;
+
+		spritecount++;
+
+		uint16_t const ctrl = (m_vdp1_vram[position * (0x20/4)+0] & 0xffff0000) >> 16;
+		if (ctrl == 0x8000)
+			break;
+
+		uint16_t const link = (m_vdp1_vram[position * (0x20/4)+0] & 0x0000ffff) >> 0;
+		uint16_t const pmod = (m_vdp1_vram[position * (0x20/4)+1] & 0xffff0000) >> 16;
+		uint32_t const xya = m_vdp1_vram[position * (0x20/4)+3];
+		if (!stv_vdp1_next_command(ctrl, link, position, vdp1_nest, draw_this_sprite))
+			break;
+
+		if (draw_this_sprite == 1)
+		{
+			switch (ctrl & 0x000f)
+			{
+				case 0x0000:
+				case 0x0001:
+				case 0x0002:
+				case 0x0003:
+					/* the invalid colour mode draws random pixels */
+					if ((pmod & 0x0038) == 0x0030)
+						threadable = false;
+					break;
+
+				case 0x0004:
+				case 0x0005:
+				case 0x0006:
+				case 0x0008:
+				case 0x0009:
+					break;
+
+				/* the drawing works on its own copy, so the saved coordinates are final once the list is scanned */
+				case 0x000a:
+					m_vdp1.local_x = (int16_t)((xya & 0xffff0000) >> 16);
+					m_vdp1.local_y = (int16_t)((xya & 0x0000ffff) >> 0);
+					break;
+
+				default:
+					return false;
+			}
+		}
+	}
+
+	return threadable;
+}
+
+void *saturn_state::stv_vdp1_draw_list_callback(void *param, int threadid)
+{
+	static_cast<saturn_state *>(param)->stv_vdp1_draw_list();
+	return nullptr;
+}
+
+/* anything that touches the draw framebuffer, VRAM or the VDP1 registers has to wait for the list to be drawn first */
+void saturn_state::stv_vdp1_wait_for_draw()
+{
+	if (m_vdp1.draw_pending)
+	{
+		osd_work_queue_wait(m_vdp1.draw_queue, osd_ticks_per_second() * 100);
+		m_vdp1.draw_pending = false;
+	}
+}
+
+void saturn_state::stv_vdp1_process_list()
+{
+	int spritecount;
+
+	stv_vdp1_wait_for_draw();
+
+	/*Set CEF bit to 0*/
+	CEF_0;
+
+	m_vdp1.draw_local_x = m_vdp1.local_x;
+	m_vdp1.draw_local_y = m_vdp1.local_y;
+
+	/* the list is drawn in one go, so the commands it would fetch are counted up front and the drawing itself
+	   can be left to a worker while the CPUs carry on until the draw end */
+	if (stv_vdp1_scan_list(spritecount) && m_vdp1.draw_queue && osd_work_item_queue(m_vdp1.draw_queue, stv_vdp1_draw_list_callback, this, WORK_ITEM_FLAG_AUTO_RELEASE))
+		m_vdp1.draw_pending = true;
+	else
+		stv_vdp1_draw_list();
 
 	/* TODO: what's the exact formula? Guess it should be a mix between number of pixels written and actual command data fetched. */
 	// if spritecount = 10000 don't send a vdp1 draw end
 //  if(spritecount < 10000)
 	m_vdp1.draw_end_timer->adjust(m_maincpu->cycles_to_attotime(spritecount*16));
-
-	if (VDP1_LOG) logerror ("End of list processing!\n");
 }
 
 void saturn_state::video_update_vdp1()
@@ -2081,6 +2192,8 @@ void saturn_state::video_update_vdp1()
 //          fclose(fp);
 //      }
 //  }
+	stv_vdp1_wait_for_draw();
+
 	if (VDP1_LOG) logerror("video_update_vdp1 called\n");
 	if (VDP1_LOG) logerror( "FBCR = %0x, accessed = %d\n", STV_VDP1_FBCR, m_vdp1.fbcr_accessed );
 
@@ -2163,6 +2276,8 @@ void saturn_state::stv_vdp1_state_save_postload()
 	int offset;
 	uint32_t data;
 
+	stv_vdp1_wait_for_draw();
+
 	m_vdp1.framebuffer_mode = -1;
 	m_vdp1.framebuffer_double_interlace = -1;
 
@@ -2179,8 +2294,18 @@ void saturn_state::stv_vdp1_state_save_postload()
 	}
 }
 
+void saturn_state::stv_vdp1_exit()
+{
+	stv_vdp1_wait_for_draw();
+	if (m_vdp1.draw_queue)
+		osd_work_queue_free(m_vdp1.draw_queue);
+	m_vdp1.draw_queue = nullptr;
+}
+
 int saturn_state::stv_vdp1_start()
 {
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&saturn_state::stv_vdp1_exit, this));
+
 	m_vdp1_regs = make_unique_clear<uint16_t[]>(0x020/2 );
 	m_vdp1_vram = make_unique_clear<uint32_t[]>(0x100000/4 );
 	m_vdp1.gfx_decode = std::make_unique<uint8_t[]>(0x100000 );
@@ -2207,6 +2332,8 @@ int saturn_state::stv_vdp1_start()
 	m_vdp1.user_cliprect.set(0, 512, 0, 256);
 
 	m_vdp1.draw_end_timer = timer_alloc(FUNC(saturn_state::vdp1_draw_end), this);
+	m_vdp1.draw_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+	m_vdp1.draw_pending = false;
 	// save state
 	save_pointer(NAME(m_vdp1_regs), 0x020/2);
 	save_pointer(NAME(m_vdp1_vram), 0x100000/4);
@@ -2216,6 +2343,7 @@ int saturn_state::stv_vdp1_start()
 	save_item(NAME(m_vdp1.framebuffer_clear_on_next_frame));
 	save_item(NAME(m_vdp1.local_x));
 	save_item(NAME(m_vdp1.local_y));
+	machine().save().register_presave(save_prepost_delegate(FUNC(saturn_state::stv_vdp1_wait_for_draw), this));
 	machine().save().register_postload(save_prepost_delegate(FUNC(saturn_state::stv_vdp1_state_save_postload), this));
 	return 0;
 }
@@ -92,6 +92,41 @@ protected:
 		uint8_t                   bank = 0;
 	};
 
+	struct mixer_layer_info
+	{
+		uint16_t                  palbase;            // palette base from control reg
+		uint16_t                  sprblendmask;       // mask of sprite priorities this layer blends with
+		uint8_t                   blendmask;          // mask of layers this layer blends with
+		uint8_t                   index;              // index of this layer (MIXER_LAYER_XXX)
+		uint8_t                   effpri;             // effective priority = (priority << 3) | layer_priority
+		uint8_t                   mixshift;           // shift from control reg
+		uint8_t                   coloroffs;          // color offset index
+	};
+
+	// everything the per-pixel mixing needs, worked out once per update
+	struct mixer_state
+	{
+		mixer_layer_info          layerorder[16][8];
+		int                       rgboffs[3][3];
+		int                       blendfactor;
+		uint8_t                   sprgroup_shift, sprgroup_mask, sprgroup_or;
+		int                       sprshadowmask, sprpixmask, sprshadow;
+		int                       sprx_start, sprdx;
+		int                       spry_origin, sprdy;   // sprite row for screen row y is spry_origin + y * sprdy
+	};
+
+	// bands of rows are mixed as separate work items
+	static constexpr int MIXER_BANDS = 8;
+	struct mixer_band
+	{
+		segas32_state *           state;
+		mixer_state const *       mixer;
+		bitmap_rgb32 *            bitmap;
+		rectangle                 cliprect;
+		int                       which;
+		int                       xoffs;
+	};
+
 	void sonic_level_load_protection(offs_t offset, uint16_t data, uint16_t mem_mask = ~0);
 	uint16_t brival_protection_r(offs_t offset, uint16_t mem_mask = ~0);
 	void brival_protection_w(offs_t offset, uint16_t data);
@@ -149,6 +184,8 @@ protected:
 	inline uint16_t compute_sprite_blend(uint8_t encoding);
 	inline uint16_t *get_layer_scanline(int layer, int scanline);
 	void mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t enablemask);
+	void mix_layer_rows(const mixer_state &mixer, int which, int xoffs, bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	static void *mix_band_callback(void *param, int threadid);
 	void print_mixer_data(int which);
 	uint32_t multi32_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int index);
 	void update_irq_state();
@@ -203,6 +240,7 @@ protected:
 
 	virtual void device_add_mconfig(machine_config &config) override ATTR_COLD;
 	virtual void device_start() override ATTR_COLD;
+	virtual void device_stop() override ATTR_COLD;
 	virtual void device_reset() override ATTR_COLD;
 
 	required_shared_ptr<uint8_t> m_z80_shared_ram;
@@ -267,6 +305,8 @@ protected:
 	int m_print_count = 0;
 	emu_timer *m_vblank_end_int_timer = nullptr;
 	emu_timer *m_update_sprites_timer = nullptr;
+	osd_work_queue *m_mixer_queue = nullptr;
+	mixer_band m_mixer_bands[MIXER_BANDS]{};
 };
 
 class segas32_regular_state : public segas32_state
@@ -273,6 +273,9 @@ void segas32_state::device_start()
 	m_solid_ffff = std::make_unique<uint16_t[]>(512);
 	std::fill_n(m_solid_ffff.get(), 512, ~uint16_t(0));
 
+	/* the mixer splits each update into bands of rows */
+	m_mixer_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	/* allocate background color per line*/
 	m_prev_bgstartx = std::make_unique<int32_t[]>(512);
 	m_prev_bgendx = std::make_unique<int32_t[]>(512);
@@ -311,6 +314,13 @@ void segas32_state::device_start()
 }
 
 
+void segas32_state::device_stop()
+{
+	if (m_mixer_queue)
+		osd_work_queue_free(m_mixer_queue);
+}
+
+
 /*************************************
  *
  *  Sprite management
@@ -1775,18 +1785,12 @@ inline uint16_t *segas32_state::get_layer_scanline(int layer, int scanline)
 
 void segas32_state::mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t enablemask)
 {
+	mixer_state mixer;
+	auto &layerorder = mixer.layerorder;
+	mixer_layer_info layersort[8];
+
 	int blendenable = m_mixer_control[which][0x4e/2] & 0x0800;
-	int blendfactor = (m_mixer_control[which][0x4e/2] >> 8) & 7;
-	struct mixer_layer_info
-	{
-		uint16_t      palbase;            /* palette base from control reg */
-		uint16_t      sprblendmask;       /* mask of sprite priorities this layer blends with */
-		uint8_t       blendmask;          /* mask of layers this layer blends with */
-		uint8_t       index;              /* index of this layer (MIXER_LAYER_XXX) */
-		uint8_t       effpri;             /* effective priority = (priority << 3) | layer_priority */
-		uint8_t       mixshift;           /* shift from control reg */
-		uint8_t       coloroffs;          /* color offset index */
-	} layerorder[16][8], layersort[8];
+	mixer.blendfactor = (m_mixer_control[which][0x4e/2] >> 8) & 7;
 
 	/* if we are the second monitor on multi32, swap in the proper sprite bank */
 	if (which == 1)
@@ -1797,7 +1801,7 @@ void segas32_state::mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, c
 	}
 
 	/* extract the RGB offsets */
-	int rgboffs[3][3];
+	auto &rgboffs = mixer.rgboffs;
 	rgboffs[0][0] = util::sext(m_mixer_control[which][0x40/2], 6);
 	rgboffs[0][1] = util::sext(m_mixer_control[which][0x42/2], 6);
 	rgboffs[0][2] = util::sext(m_mixer_control[which][0x44/2], 6);
@@ -1809,7 +1813,9 @@ void segas32_state::mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, c
 	rgboffs[2][2] = 0;
 
 	/* determine the sprite grouping parameters first */
-	uint8_t sprgroup_shift, sprgroup_mask, sprgroup_or;
+	uint8_t &sprgroup_shift = mixer.sprgroup_shift;
+	uint8_t &sprgroup_mask = mixer.sprgroup_mask;
+	uint8_t &sprgroup_or = mixer.sprgroup_or;
 	switch (m_mixer_control[which][0x4c/2] & 0x0f)
 	{
 		default:
@@ -1833,9 +1839,9 @@ void segas32_state::mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, c
 		case 0xe:   sprgroup_shift = 11;    sprgroup_mask = 0x07;   sprgroup_or = 0x00; break;
 		case 0xf:   sprgroup_shift = 10;    sprgroup_mask = 0x0f;   sprgroup_or = 0x00; break;
 	}
-	int sprshadowmask = (m_mixer_control[which][0x4c/2] & 0x04) ? 0x8000 : 0x0000;
-	int sprpixmask = ((1 << sprgroup_shift) - 1) & 0x3fff;
-	int sprshadow = 0x7ffe & sprpixmask;
+	mixer.sprshadowmask = (m_mixer_control[which][0x4c/2] & 0x04) ? 0x8000 : 0x0000;
+	mixer.sprpixmask = ((1 << sprgroup_shift) - 1) & 0x3fff;
+	mixer.sprshadow = 0x7ffe & mixer.sprpixmask;
 
 	/* extract info about TEXT, NBG0-3, and BITMAP layers, which all follow the same pattern */
 	int numlayers = 0;
@@ -1918,31 +1924,80 @@ void segas32_state::mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, c
 
 	/* based on the sprite controller flip bits, the data is scanned to us in different */
 	/* directions; account for this */
-	int sprx_start, sprdx;
 	if (m_sprite_control_latched[0x04/2] & 1)
 	{
-		sprx_start = cliprect.max_x;
-		sprdx = -1;
+		mixer.sprx_start = cliprect.max_x;
+		mixer.sprdx = -1;
 	}
 	else
 	{
-		sprx_start = cliprect.min_x;
-		sprdx = 1;
+		mixer.sprx_start = cliprect.min_x;
+		mixer.sprdx = 1;
 	}
 
-	int spry, sprdy;
 	if (m_sprite_control_latched[0x04/2] & 2)
 	{
-		spry = cliprect.max_y;
-		sprdy = -1;
+		mixer.spry_origin = cliprect.max_y + cliprect.min_y;
+		mixer.sprdy = -1;
 	}
 	else
 	{
-		spry = cliprect.min_y;
-		sprdy = 1;
+		mixer.spry_origin = 0;
+		mixer.sprdy = 1;
+	}
+
+	/* rows don't depend on each other, so mix bands of them in parallel; this thread */
+	/* does the first band itself */
+	int const bands = std::clamp(cliprect.height() / 16, 1, MIXER_BANDS);
+	for (int band = 0; band < bands; band++)
+	{
+		mixer_band &info = m_mixer_bands[band];
+		info.state = this;
+		info.mixer = &mixer;
+		info.bitmap = &bitmap;
+		info.cliprect = cliprect;
+		info.cliprect.sety(cliprect.min_y + cliprect.height() * band / bands, cliprect.min_y + cliprect.height() * (band + 1) / bands - 1);
+		info.which = which;
+		info.xoffs = xoffs;
+	}
+	if (bands > 1)
+		osd_work_item_queue_multiple(m_mixer_queue, mix_band_callback, bands - 1, &m_mixer_bands[1], sizeof(m_mixer_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	mix_layer_rows(mixer, which, xoffs, bitmap, m_mixer_bands[0].cliprect);
+	if (bands > 1)
+		osd_work_queue_wait(m_mixer_queue, osd_ticks_per_second() * 100);
+
+	/* if we are the second monitor on multi32, swap back the sprite layer */
+	if (which == 1)
+	{
+		std::swap(m_layer_data[MIXER_LAYER_SPRITES].bitmap, m_layer_data[MIXER_LAYER_MULTISPR].bitmap);
+		std::swap(m_layer_data[MIXER_LAYER_SPRITES].transparent, m_layer_data[MIXER_LAYER_MULTISPR].transparent);
+		std::swap(m_layer_data[MIXER_LAYER_SPRITES].num, m_layer_data[MIXER_LAYER_MULTISPR].num);
 	}
+}
+
+void *segas32_state::mix_band_callback(void *param, int threadid)
+{
+	mixer_band const &band = *reinterpret_cast<mixer_band const *>(param);
+	band.state->mix_layer_rows(*band.mixer, band.which, band.xoffs, *band.bitmap, band.cliprect);
+	return nullptr;
+}
+
+void segas32_state::mix_layer_rows(const mixer_state &mixer, int which, int xoffs, bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	auto const &layerorder = mixer.layerorder;
+	auto const &rgboffs = mixer.rgboffs;
+	int const blendfactor = mixer.blendfactor;
+	int const sprgroup_shift = mixer.sprgroup_shift;
+	int const sprgroup_mask = mixer.sprgroup_mask;
+	int const sprshadowmask = mixer.sprshadowmask;
+	int const sprpixmask = mixer.sprpixmask;
+	int const sprshadow = mixer.sprshadow;
+	int const sprx_start = mixer.sprx_start;
+	int const sprdx = mixer.sprdx;
+	int const sprdy = mixer.sprdy;
 
 	/* loop over rows */
+	int spry = mixer.spry_origin + cliprect.min_y * sprdy;
 	for (int y = cliprect.min_y; y <= cliprect.max_y; y++, spry += sprdy)
 	{
 		uint32_t *const dest = &bitmap.pix(y, xoffs);
@@ -2093,14 +2148,6 @@ void segas32_state::mix_all_layers(int which, int xoffs, bitmap_rgb32 &bitmap, c
 			dest[x] = firstpix;
 		}
 	}
-
-	/* if we are the second monitor on multi32, swap back the sprite layer */
-	if (which == 1)
-	{
-		std::swap(m_layer_data[MIXER_LAYER_SPRITES].bitmap, m_layer_data[MIXER_LAYER_MULTISPR].bitmap);
-		std::swap(m_layer_data[MIXER_LAYER_SPRITES].transparent, m_layer_data[MIXER_LAYER_MULTISPR].transparent);
-		std::swap(m_layer_data[MIXER_LAYER_SPRITES].num, m_layer_data[MIXER_LAYER_MULTISPR].num);
-	}
 }
 
 
@@ -59,6 +59,13 @@ public:
 
 	// set additional default assignments suitable for device
 	virtual void set_default_assignments(assignment_vector &&assignments) = 0;
+
+	// promise to call set_changed whenever an item may have changed state;
+	// until then, the device is assumed to change on every poll
+	virtual void set_reports_changes() = 0;
+
+	// note that items on a device that reports changes may have changed state
+	virtual void set_changed() = 0;
 };
 
 } // namespace osd
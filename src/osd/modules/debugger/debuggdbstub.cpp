@@ -705,6 +705,7 @@ public:
 		m_extended_mode(false),
 		m_send_stop_packet(false),
 		m_target_xml_sent(false),
+		m_no_ack(false),
 		m_triggered_breakpoint(nullptr),
 		m_triggered_watchpoint(nullptr),
 		m_readbuf_len(0),
@@ -733,6 +734,9 @@ public:
 
 	bool is_thread_id_ok(const char *buf);
 
+	bool read_memory(uint64_t address, uint64_t length, std::vector<uint8_t> &data);
+	bool write_memory(uint64_t address, const std::vector<uint8_t> &data);
+
 	void handle_character(char ch);
 	void send_nack();
 	void send_ack();
@@ -761,8 +765,11 @@ public:
 	cmd_reply handle_p(const char *buf);
 	cmd_reply handle_P(const char *buf);
 	cmd_reply handle_q(const char *buf);
+	cmd_reply handle_Q(const char *buf);
 	cmd_reply handle_s(const char *buf);
 	cmd_reply handle_T(const char *buf);
+	cmd_reply handle_x(const char *buf);
+	cmd_reply handle_X(const char *buf);
 	cmd_reply handle_z(const char *buf);
 	cmd_reply handle_Z(const char *buf);
 
@@ -777,6 +784,8 @@ public:
 	readbuf_state m_readbuf_state;
 
 	void generate_target_xml();
+	void generate_memory_map();
+	void send_xfer(std::string_view document, int offset, int length);
 
 	int readchar();
 
@@ -800,6 +809,7 @@ private:
 	bool m_extended_mode;
 	bool m_send_stop_packet;
 	bool m_target_xml_sent;     // the 'g', 'G', 'p', and 'P' commands only work once target.xml has been sent
+	bool m_no_ack;              // QStartNoAckMode: packets are no longer acknowledged
 
 	struct gdb_register
 	{
@@ -820,6 +830,7 @@ private:
 	debug_watchpoint *m_triggered_watchpoint;
 
 	std::string m_target_xml;
+	std::string m_memory_map;
 
 	uint8_t  m_readbuf[512];
 	uint32_t m_readbuf_len;
@@ -877,7 +888,7 @@ static std::string escape_packet(std::string_view src)
 	result.reserve(src.length());
 	for ( char ch : src )
 	{
-		if ( ch == '#' || ch == '$' || ch == '}' )
+		if ( ch == '#' || ch == '$' || ch == '}' || ch == '*' )
 		{
 			result += '}';
 			ch ^= 0x20;
@@ -887,6 +898,18 @@ static std::string escape_packet(std::string_view src)
 	return result;
 }
 
+//-------------------------------------------------------------------------
+static void hex_encode(std::string &dest, const uint8_t *data, size_t length)
+{
+	static const char digits[] = "0123456789abcdef";
+	dest.reserve(dest.length() + length * 2);
+	for ( size_t i = 0; i < length; i++ )
+	{
+		dest += digits[data[i] >> 4];
+		dest += digits[data[i] & 0x0f];
+	}
+}
+
 //-------------------------------------------------------------------------
 void debug_gdbstub::generate_target_xml()
 {
@@ -917,6 +940,63 @@ void debug_gdbstub::generate_target_xml()
 	m_target_xml = escape_packet(target_xml);
 }
 
+//-------------------------------------------------------------------------
+void debug_gdbstub::generate_memory_map()
+{
+	std::vector<memory_entry> read_map, write_map;
+	m_address_space->dump_maps(read_map, write_map);
+	std::sort(read_map.begin(), read_map.end(), [] (const memory_entry &a, const memory_entry &b) { return a.start < b.start; });
+
+	// anything readable is listed, as GDB refuses to access the rest;
+	// views can map the same range more than once, so only the first
+	// entry covering an address is used
+	std::vector<std::tuple<offs_t, offs_t, bool>> regions;
+	bool first = true;
+	offs_t covered = 0;
+	for ( const auto &entry: read_map )
+	{
+		if ( entry.entry->name() == "unmapped" || (!first && entry.start <= covered) )
+			continue;
+		bool writable = false;
+		for ( const auto &wentry: write_map )
+			if ( wentry.start <= entry.start && wentry.end >= entry.start )
+			{
+				std::string const name = wentry.entry->name();
+				writable = (name != "unmapped") && (name != "nop");
+				break;
+			}
+		if ( !regions.empty() && std::get<2>(regions.back()) == writable && std::get<1>(regions.back()) + 1 == entry.start )
+			std::get<1>(regions.back()) = entry.end;
+		else
+			regions.emplace_back(entry.start, entry.end, writable);
+		first = false;
+		covered = entry.end;
+	}
+
+	std::string memory_map;
+	memory_map += "<?xml version=\"1.0\"?>\n";
+	memory_map += "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" \"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n";
+	memory_map += "<memory-map>\n";
+	for ( const auto &[start, end, writable]: regions )
+		memory_map += string_format("  <memory type=\"%s\" start=\"0x%x\" length=\"0x%x\"/>\n", writable ? "ram" : "rom", start, uint64_t(end) - start + 1);
+	memory_map += "</memory-map>\n";
+	m_memory_map = escape_packet(memory_map);
+}
+
+//-------------------------------------------------------------------------
+void debug_gdbstub::send_xfer(std::string_view document, int offset, int length)
+{
+	offset = std::min(offset, (int) document.length());
+	length = std::min(length, (int) document.length()-offset);
+	std::string reply;
+	if ( offset + length < document.length() )
+		reply += 'm';
+	else
+		reply += 'l';
+	reply += document.substr(offset, length);
+	send_reply(reply);
+}
+
 //-------------------------------------------------------------------------
 void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 {
@@ -1165,6 +1245,58 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_k(const char *buf)
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+// Read memory a bus-width unit at a time where the alignment allows it,
+// rather than dispatching every byte separately.
+bool debug_gdbstub::read_memory(uint64_t address, uint64_t length, std::vector<uint8_t> &data)
+{
+	offs_t offset = address;
+	address_space *tspace;
+	if ( !m_memory->translate(m_address_space->spacenum(), device_memory_interface::TR_READ, offset, tspace) )
+		return false;
+
+	// Disable side effects while reading memory.
+	auto dis = m_machine->disable_side_effects();
+
+	data.resize(length);
+	const int bytes = tspace->data_width() / 8;
+	const bool be = tspace->endianness() == ENDIANNESS_BIG;
+	uint64_t i = 0;
+	if ( tspace->addr_shift() == 0 && bytes > 1 )
+	{
+		for ( ; i < length && ((offset + i) & (bytes - 1)) != 0; i++ )
+			data[i] = tspace->read_byte(offset + i);
+		for ( ; i + bytes <= length; i += bytes )
+		{
+			uint64_t unit;
+			switch ( bytes )
+			{
+				case 2:  unit = tspace->read_word(offset + i);  break;
+				case 4:  unit = tspace->read_dword(offset + i); break;
+				default: unit = tspace->read_qword(offset + i); break;
+			}
+			for ( int b = 0; b < bytes; b++ )
+				data[i + b] = uint8_t(unit >> (8 * (be ? (bytes - 1 - b) : b)));
+		}
+	}
+	for ( ; i < length; i++ )
+		data[i] = tspace->read_byte(offset + i);
+	return true;
+}
+
+//-------------------------------------------------------------------------
+bool debug_gdbstub::write_memory(uint64_t address, const std::vector<uint8_t> &data)
+{
+	offs_t offset = address;
+	address_space *tspace;
+	if ( !m_memory->translate(m_address_space->spacenum(), device_memory_interface::TR_READ, offset, tspace) )
+		return false;
+
+	for ( int i = 0; i < data.size(); i++ )
+		tspace->write_byte(offset + i, data[i]);
+	return true;
+}
+
 //-------------------------------------------------------------------------
 // Read memory.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
@@ -1174,21 +1306,12 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
 	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64, &address, &length) != 2 )
 		return REPLY_ENN;
 
-	offs_t offset = address;
-	address_space *tspace;
-	if ( !m_memory->translate(m_address_space->spacenum(), device_memory_interface::TR_READ, offset, tspace) )
+	std::vector<uint8_t> data;
+	if ( !read_memory(address, length, data) )
 		return REPLY_ENN;
 
-	// Disable side effects while reading memory.
-	auto dis = m_machine->disable_side_effects();
-
 	std::string reply;
-	reply.reserve(length * 2);
-	for ( int i = 0; i < length; i++ )
-	{
-		uint8_t value = tspace->read_byte(offset + i);
-		reply += string_format("%02x", value);
-	}
+	hex_encode(reply, data.data(), data.size());
 	send_reply(reply);
 
 	return REPLY_NONE;
@@ -1220,19 +1343,11 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_M(const char *buf)
 	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64 ":%n", &address, &length, &buf_offset) != 2 )
 		return REPLY_ENN;
 
-	offs_t offset = address;
-	address_space *tspace;
-	if ( !m_memory->translate(m_address_space->spacenum(), device_memory_interface::TR_READ, offset, tspace) )
-		return REPLY_ENN;
-
 	std::vector<uint8_t> data;
 	if ( !hex_decode(&data, buf + buf_offset, length) )
 		return REPLY_ENN;
 
-	for ( int i = 0; i < length; i++ )
-		tspace->write_byte(offset + i, data[i]);
-
-	return REPLY_OK;
+	return write_memory(address, data) ? REPLY_OK : REPLY_ENN;
 }
 
 //-------------------------------------------------------------------------
@@ -1328,33 +1443,41 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	if ( name == "Supported" )
 	{
 		std::string reply = string_format("PacketSize=%x", MAX_PACKET_SIZE);
-		reply += ";qXfer:features:read+";
+		reply += ";qXfer:features:read+;qXfer:memory-map:read+;QStartNoAckMode+";
+		if ( params.find("binary-upload+") != std::string::npos )
+			reply += ";binary-upload+";
 		send_reply(reply);
 		return REPLY_NONE;
 	}
 	else if ( name == "Xfer" )
 	{
+		int offset = 0;
+		int length = 0;
 		// "features:read:target.xml:0,3fff"
 		if ( strncmp(params.c_str(), "features:read:", 14) == 0 )
 		{
-			int offset = 0;
-			int length = 0;
 			if ( sscanf(params.c_str() + 14, "target.xml:%x,%x", &offset, &length) == 2 )
 			{
 				if ( m_target_xml.empty() )
 					generate_target_xml();
-				length = std::min(length, (int) m_target_xml.length()-offset);
-				std::string reply;
-				if ( offset + length < m_target_xml.length() )
-					reply += 'm';
-				else
-					reply += 'l';
-				reply += m_target_xml.substr(offset, length);
-				send_reply(reply);
+				send_xfer(m_target_xml, offset, length);
 				m_target_xml_sent = true;
 				return REPLY_NONE;
 			}
 		}
+		// "memory-map:read::0,3fff"
+		else if ( strncmp(params.c_str(), "memory-map:read::", 17) == 0 )
+		{
+			if ( sscanf(params.c_str() + 17, "%x,%x", &offset, &length) == 2 )
+			{
+				// memory can be remapped while running, so build it afresh
+				// whenever GDB starts reading it
+				if ( m_memory_map.empty() || offset == 0 )
+					generate_memory_map();
+				send_xfer(m_memory_map, offset, length);
+				return REPLY_NONE;
+			}
+		}
 	}
 	else if ( name == "fThreadInfo" )
 	{
@@ -1370,6 +1493,20 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	return REPLY_UNSUPPORTED;
 }
 
+//-------------------------------------------------------------------------
+// General set.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_Q(const char *buf)
+{
+	if ( strcmp(buf, "StartNoAckMode") == 0 )
+	{
+		// this packet is still acknowledged, later ones aren't
+		m_no_ack = true;
+		return REPLY_OK;
+	}
+
+	return REPLY_UNSUPPORTED;
+}
+
 //-------------------------------------------------------------------------
 // Single step, resuming at addr.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_s(const char *buf)
@@ -1394,6 +1531,59 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_T(const char *buf)
 	return REPLY_ENN;
 }
 
+//-------------------------------------------------------------------------
+// Read memory, binary reply.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_x(const char *buf)
+{
+	uint64_t address;
+	uint64_t length;
+	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64, &address, &length) != 2 )
+		return REPLY_ENN;
+
+	std::vector<uint8_t> data;
+	if ( !read_memory(address, length, data) )
+		return REPLY_ENN;
+
+	std::string reply = "b";
+	reply += escape_packet(std::string_view((const char *) data.data(), data.size()));
+	send_reply(reply);
+
+	return REPLY_NONE;
+}
+
+//-------------------------------------------------------------------------
+// Write memory, binary data.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_X(const char *buf)
+{
+	uint64_t address;
+	uint64_t length;
+	int buf_offset;
+	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64 ":%n", &address, &length, &buf_offset) != 2 )
+		return REPLY_ENN;
+
+	// the data may contain NULs, so go by the packet length
+	const uint8_t *ptr = (const uint8_t *) buf + buf_offset;
+	const uint8_t *end = m_packet_buf + m_packet_len;
+	std::vector<uint8_t> data;
+	data.reserve(length);
+	while ( ptr < end )
+	{
+		uint8_t ch = *ptr++;
+		if ( ch == '}' )
+		{
+			if ( ptr == end )
+				return REPLY_ENN;
+			ch = *ptr++ ^ 0x20;
+		}
+		data.push_back(ch);
+	}
+	if ( data.size() != length )
+		return REPLY_ENN;
+
+	// a zero-length write is GDB checking for support
+	return (data.empty() || write_memory(address, data)) ? REPLY_OK : REPLY_ENN;
+}
+
 //-------------------------------------------------------------------------
 static bool remove_breakpoint(device_debug *debug, uint64_t address, int /*kind*/)
 {
@@ -1565,8 +1755,11 @@ void debug_gdbstub::handle_packet()
 		case 'p': reply = handle_p(buf); break;
 		case 'P': reply = handle_P(buf); break;
 		case 'q': reply = handle_q(buf); break;
+		case 'Q': reply = handle_Q(buf); break;
 		case 's': reply = handle_s(buf); break;
 		case 'T': reply = handle_T(buf); break;
+		case 'x': reply = handle_x(buf); break;
+		case 'X': reply = handle_X(buf); break;
 		case 'z': reply = handle_z(buf); break;
 		case 'Z': reply = handle_Z(buf); break;
 	}
@@ -1699,12 +1892,14 @@ void debug_gdbstub::handle_character(char ch)
 			if ( m_recv_checksum != m_packet_checksum )
 			{
 				osd_printf_info("gdbstub: bad checksum!\n");
-				send_nack();
+				if ( !m_no_ack )
+					send_nack();
 				m_readbuf_state = PACKET_START;
 				break;
 			}
 			m_packet_buf[m_packet_len] = '\0';
-			send_ack();
+			if ( !m_no_ack )
+				send_ack();
 			handle_packet();
 			m_readbuf_state = PACKET_START;
 			break;
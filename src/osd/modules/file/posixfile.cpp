@@ -51,6 +51,7 @@
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -61,6 +62,10 @@
 #include <cstdlib>
 #include <unistd.h>
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
 
 
 namespace {
@@ -93,6 +98,10 @@ public:
 
 	virtual ~posix_osd_file() override
 	{
+#if !defined(_WIN32)
+		if (m_map)
+			::munmap(m_map, m_maplength);
+#endif
 		::close(m_fd);
 	}
 
@@ -160,8 +169,35 @@ public:
 		return std::error_condition();
 	}
 
+#if !defined(_WIN32)
+	virtual std::error_condition map(std::uint64_t length, void const *&data) noexcept override
+	{
+		if (m_map)
+		{
+			if (length > m_maplength)
+				return std::errc::not_supported;
+			data = m_map;
+			return std::error_condition();
+		}
+
+		if (!length || (std::numeric_limits<std::size_t>::max() < length))
+			return std::errc::invalid_argument;
+
+		void *const result = ::mmap(nullptr, std::size_t(length), PROT_READ, MAP_SHARED, m_fd, 0);
+		if (MAP_FAILED == result)
+			return std::error_condition(errno, std::generic_category());
+
+		m_map = result;
+		m_maplength = std::size_t(length);
+		data = m_map;
+		return std::error_condition();
+	}
+#endif
+
 private:
 	int m_fd;
+	void *m_map = nullptr;
+	std::size_t m_maplength = 0;
 };
 
 
@@ -231,6 +267,8 @@ std::error_condition osd_file::open(std::string const &path, std::uint32_t openf
 		return posix_open_ptty(openflags, file, filesize, dst);
 	else if (posix_check_domain_path(path))
 		return posix_open_domain(path, openflags, file, filesize);
+	else if (posix_check_shm_path(path))
+		return posix_open_shm(path, openflags, file, filesize);
 
 	// select the file open modes
 	int access;
@@ -0,0 +1,227 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+//============================================================
+//
+//  posixshm.cpp - shared memory links between instances
+//
+//  A path of the form "shm." name opens one end of a duplex
+//  byte link through a POSIX shared memory object.  The first
+//  instance to open a name gets one end and the second gets
+//  the other; a third is refused while both are attached.
+//  Data already in flight survives either end reconnecting.
+//  An instance that crashes leaves its end claimed; the
+//  object then has to be removed by hand (/dev/shm/mame.name
+//  on Linux).
+//  Each direction is a single-producer, single-consumer ring,
+//  so neither side ever blocks or makes a system call to move
+//  data, unlike a socket.
+//
+//============================================================
+
+#include "posixfile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace {
+
+char const *const posixfile_shm_identifier  = "shm.";
+
+
+// layout of the shared object, valid when zero-filled
+struct shm_link
+{
+	static constexpr std::uint32_t RING_SIZE = 0x10000;
+
+	struct ring
+	{
+		std::atomic<std::uint32_t> head; // written by the producer
+		std::atomic<std::uint32_t> tail; // written by the consumer
+		std::uint8_t data[RING_SIZE];
+	};
+
+	std::atomic<std::uint32_t> attached; // one bit for each end
+	ring rings[2];
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared memory links need lock-free atomics");
+
+
+class posix_osd_shm : public osd_file
+{
+public:
+	posix_osd_shm(posix_osd_shm const &) = delete;
+	posix_osd_shm(posix_osd_shm &&) = delete;
+	posix_osd_shm& operator=(posix_osd_shm const &) = delete;
+	posix_osd_shm& operator=(posix_osd_shm &&) = delete;
+
+	posix_osd_shm(std::string &&name, shm_link *link, unsigned side) noexcept
+		: m_name(std::move(name))
+		, m_link(link)
+		, m_side(side)
+		, m_send(link->rings[side])
+		, m_recv(link->rings[side ^ 1])
+	{
+		assert(side < 2);
+	}
+
+	virtual ~posix_osd_shm()
+	{
+		// the last one out removes the name, so the next pair starts clean
+		if (m_link->attached.fetch_and(~(1U << m_side), std::memory_order_acq_rel) == (1U << m_side))
+			::shm_unlink(m_name.c_str());
+		::munmap(m_link, sizeof(shm_link));
+	}
+
+	virtual std::error_condition read(void *buffer, std::uint64_t offset, std::uint32_t count, std::uint32_t &actual) noexcept override
+	{
+		std::uint32_t const tail = m_recv.tail.load(std::memory_order_relaxed);
+		std::uint32_t const avail = m_recv.head.load(std::memory_order_acquire) - tail;
+		actual = (std::min)(count, avail);
+		if (!actual)
+			return std::errc::operation_would_block;
+
+		copy_out(static_cast<std::uint8_t *>(buffer), tail, actual);
+		m_recv.tail.store(tail + actual, std::memory_order_release);
+		return std::error_condition();
+	}
+
+	virtual std::error_condition write(void const *buffer, std::uint64_t offset, std::uint32_t count, std::uint32_t &actual) noexcept override
+	{
+		std::uint32_t const head = m_send.head.load(std::memory_order_relaxed);
+		std::uint32_t const space = shm_link::RING_SIZE - (head - m_send.tail.load(std::memory_order_acquire));
+		actual = (std::min)(count, space);
+		if (!actual && count)
+			return std::errc::operation_would_block;
+
+		copy_in(static_cast<std::uint8_t const *>(buffer), head, actual);
+		m_send.head.store(head + actual, std::memory_order_release);
+		return std::error_condition();
+	}
+
+	virtual std::error_condition truncate(std::uint64_t offset) noexcept override
+	{
+		// doesn't make sense on a link
+		return std::errc::bad_file_descriptor;
+	}
+
+	virtual std::error_condition flush() noexcept override
+	{
+		// written data is visible to the other side immediately
+		return std::error_condition();
+	}
+
+private:
+	// the positions run freely and are wrapped into the ring here
+	void copy_out(std::uint8_t *dst, std::uint32_t pos, std::uint32_t count) noexcept
+	{
+		std::uint32_t const start = pos % shm_link::RING_SIZE;
+		std::uint32_t const first = (std::min)(count, shm_link::RING_SIZE - start);
+		std::memcpy(dst, &m_recv.data[start], first);
+		std::memcpy(dst + first, &m_recv.data[0], count - first);
+	}
+
+	void copy_in(std::uint8_t const *src, std::uint32_t pos, std::uint32_t count) noexcept
+	{
+		std::uint32_t const start = pos % shm_link::RING_SIZE;
+		std::uint32_t const first = (std::min)(count, shm_link::RING_SIZE - start);
+		std::memcpy(&m_send.data[start], src, first);
+		std::memcpy(&m_send.data[0], src + first, count - first);
+	}
+
+	std::string m_name;
+	shm_link *m_link;
+	unsigned m_side;
+	shm_link::ring &m_send;
+	shm_link::ring &m_recv;
+};
+
+} // anonymous namespace
+
+
+/*
+    Checks whether the path is a shared memory link specification, of the
+    form "shm." name.  The name may not contain slashes.
+*/
+bool posix_check_shm_path(std::string const &path) noexcept
+{
+	std::size_t const prefix = strlen(posixfile_shm_identifier);
+	if (strncmp(path.c_str(), posixfile_shm_identifier, prefix) != 0)
+		return false;
+	return (path.length() > prefix) && (path.find('/', prefix) == std::string::npos);
+}
+
+
+std::error_condition posix_open_shm(std::string const &path, std::uint32_t openflags, osd_file::ptr &file, std::uint64_t &filesize) noexcept
+{
+	if ((openflags & (OPEN_FLAG_READ | OPEN_FLAG_WRITE)) != (OPEN_FLAG_READ | OPEN_FLAG_WRITE))
+		return std::errc::invalid_argument;
+
+	std::string name;
+	try
+	{
+		name = "/mame." + path.substr(strlen(posixfile_shm_identifier));
+	}
+	catch (...)
+	{
+		return std::errc::not_enough_memory;
+	}
+
+	// whoever gets here first creates the object; it's zero-filled, which is a valid empty link
+	int const fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+	if (fd < 0)
+		return std::error_condition(errno, std::generic_category());
+
+	struct stat st;
+	if ((::fstat(fd, &st) < 0) || ((st.st_size < off_t(sizeof(shm_link))) && (::ftruncate(fd, sizeof(shm_link)) < 0)))
+	{
+		std::error_condition err(errno, std::generic_category());
+		::close(fd);
+		return err;
+	}
+
+	void *const mem = ::mmap(nullptr, sizeof(shm_link), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (mem == MAP_FAILED)
+	{
+		std::error_condition err(errno, std::generic_category());
+		::close(fd);
+		return err;
+	}
+	::close(fd);
+
+	// claim whichever end is free, so an instance that reconnects gets back the end it had
+	shm_link *const link = static_cast<shm_link *>(mem);
+	std::uint32_t attached = link->attached.load(std::memory_order_relaxed);
+	unsigned side;
+	do
+	{
+		side = !(attached & 1) ? 0 : !(attached & 2) ? 1 : 2;
+		if (side >= 2)
+		{
+			::munmap(mem, sizeof(shm_link));
+			return std::errc::device_or_resource_busy;
+		}
+	}
+	while (!link->attached.compare_exchange_weak(attached, attached | (1U << side), std::memory_order_acq_rel));
+
+	osd_file::ptr result(new (std::nothrow) posix_osd_shm(std::move(name), link, side));
+	if (!result)
+	{
+		link->attached.fetch_and(~(1U << side), std::memory_order_acq_rel);
+		::munmap(mem, sizeof(shm_link));
+		return std::errc::not_enough_memory;
+	}
+	file = std::move(result);
+	filesize = 0;
+	return std::error_condition();
+}
@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <limits>
 #include <memory>
 
 // standard windows headers
@@ -52,6 +53,11 @@ public:
 
 	virtual ~win_osd_file() override
 	{
+		if (m_map)
+		{
+			UnmapViewOfFile(m_map);
+			CloseHandle(m_mapping);
+		}
 		FlushFileBuffers(m_handle);
 		CloseHandle(m_handle);
 	}
@@ -111,8 +117,43 @@ public:
 		return std::error_condition();
 	}
 
+	virtual std::error_condition map(std::uint64_t length, void const *&data) noexcept override
+	{
+		if (m_map)
+		{
+			if (length > m_maplength)
+				return std::errc::not_supported;
+			data = m_map;
+			return std::error_condition();
+		}
+
+		if (!length || (std::numeric_limits<SIZE_T>::max() < length))
+			return std::errc::invalid_argument;
+
+		// mapping object covers the whole file, the view only what was asked for
+		HANDLE const mapping = CreateFileMapping(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+			return win_error_to_error_condition(GetLastError());
+		void const *const result = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, SIZE_T(length));
+		if (!result)
+		{
+			DWORD const err = GetLastError();
+			CloseHandle(mapping);
+			return win_error_to_error_condition(err);
+		}
+
+		m_mapping = mapping;
+		m_map = result;
+		m_maplength = length;
+		data = m_map;
+		return std::error_condition();
+	}
+
 private:
 	HANDLE m_handle;
+	HANDLE m_mapping = nullptr;
+	void const *m_map = nullptr;
+	std::uint64_t m_maplength = 0;
 };
 
 
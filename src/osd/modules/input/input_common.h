@@ -94,12 +94,26 @@ private:
 	static inline constexpr unsigned DEFAULT_EVENT_QUEUE_SIZE = 64;
 
 	std::queue<TEvent> m_event_queue;
+	osd::input_device *m_change_target = nullptr;
 
 protected:
 	std::mutex           m_device_lock;
 
 	virtual void process_event(TEvent const &ev) = 0;
 
+	// for devices whose items only change state in process_event and reset
+	void report_changes(osd::input_device &device)
+	{
+		device.set_reports_changes();
+		m_change_target = &device;
+	}
+
+	void set_changed()
+	{
+		if (m_change_target)
+			m_change_target->set_changed();
+	}
+
 public:
 	event_based_device(std::string &&name, std::string &&id, input_module &module) :
 		device_info(std::move(name), std::move(id), module)
@@ -121,6 +135,9 @@ public:
 	{
 		std::lock_guard<std::mutex> scope_lock(m_device_lock);
 
+		if (!m_event_queue.empty())
+			set_changed();
+
 		// Process each event until the queue is empty
 		while (!m_event_queue.empty())
 		{
@@ -133,6 +150,7 @@ public:
 	{
 		std::lock_guard<std::mutex> scope_lock(m_device_lock);
 		std::queue<TEvent>().swap(m_event_queue);
+		set_changed();
 	}
 };
 
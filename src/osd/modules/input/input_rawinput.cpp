@@ -327,7 +327,10 @@ public:
 	{
 		rawinput_device::poll(relative_reset);
 		if (m_keyboard.state[0x80 | 0x45] && (std::chrono::steady_clock::now() > (m_pause_pressed + std::chrono::milliseconds(30))))
+		{
 			m_keyboard.state[0x80 | 0x45] = 0x00;
+			set_changed();
+		}
 	}
 
 	virtual void process_event(RAWINPUT const &rawinput) override
@@ -385,6 +388,9 @@ public:
 
 	virtual void configure(input_device &device) override
 	{
+		// keys only change state on events
+		report_changes(device);
+
 		keyboard_trans_table const &table = keyboard_trans_table::instance();
 
 		// FIXME: GetKeyNameTextW is for scan codes from WM_KEYDOWN, which aren't quite the same as DIK_* keycodes
@@ -580,7 +580,10 @@ public:
 
 #ifdef __APPLE__
 		if (m_keyboard.state[SDL_SCANCODE_CAPSLOCK] && (std::chrono::steady_clock::now() > (m_capslock_pressed + std::chrono::milliseconds(30))))
+		{
 			m_keyboard.state[SDL_SCANCODE_CAPSLOCK] = 0x00;
+			set_changed();
+		}
 #endif
 	}
 
@@ -615,6 +618,9 @@ public:
 
 	virtual void configure(input_device &device) override
 	{
+		// keys only change state on events
+		report_changes(device);
+
 		// populate it
 		for (int keynum = 0; m_trans_table[keynum].mame_key != ITEM_ID_INVALID; keynum++)
 		{
@@ -1049,6 +1055,9 @@ public:
 
 	virtual void configure(input_device &device) override
 	{
+		// state only changes on events, including disconnection
+		report_changes(device);
+
 		input_device::assignment_vector assignments;
 		char tempname[32];
 
@@ -1495,6 +1504,9 @@ public:
 
 	virtual void configure(input_device &device) override
 	{
+		// state only changes on events, including disconnection
+		report_changes(device);
+
 		input_device::assignment_vector assignments;
 		char const *const *axisnames = CONTROLLER_AXIS_XBOX;
 		char const *const *buttonnames = CONTROLLER_BUTTON_XBOX360;
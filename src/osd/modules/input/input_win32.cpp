@@ -52,6 +52,9 @@ public:
 
 	virtual void configure(input_device &device) override
 	{
+		// keys only change state on events
+		report_changes(device);
+
 		keyboard_trans_table const &table = keyboard_trans_table::instance();
 
 		for (int keynum = 0; keynum < MAX_KEYS; keynum++)
@@ -93,7 +93,11 @@ public:
 		EXECUTE = 0x04,
 		READ_WRITE = READ | WRITE,
 		READ_EXECUTE = READ | EXECUTE,
-		READ_WRITE_EXECUTE = READ | WRITE | EXECUTE
+		READ_WRITE_EXECUTE = READ | WRITE | EXECUTE,
+
+		// request huge/large pages to cut TLB misses - quietly falls back
+		// to normal pages, and page_size() reports what was used
+		LARGE_PAGES = 0x100
 	};
 
 	virtual_memory_allocation(virtual_memory_allocation const &) = delete;
@@ -162,6 +166,134 @@ private:
 };
 
 
+/// \brief Copy-on-write mapping of a file
+///
+/// Maps the start of a file into memory.  The mapping is readable and
+/// writable, but writes are private to the process and never reach the
+/// file.  Pages that haven't been written are shared with the page
+/// cache, and so with other processes mapping the same file.  A mapping
+/// constructed without a file is anonymous private memory, which can
+/// later be replaced in place by a file with the same contents.
+class file_mapping
+{
+public:
+	file_mapping(file_mapping const &) = delete;
+	file_mapping &operator=(file_mapping const &) = delete;
+
+	file_mapping() noexcept { }
+	explicit file_mapping(std::size_t length) noexcept
+	{
+		m_memory = do_map(std::string(), length, m_size);
+	}
+	file_mapping(std::string const &path, std::size_t length) noexcept
+	{
+		m_memory = do_map(path, length, m_size);
+	}
+	file_mapping(file_mapping &&that) noexcept : m_memory(that.m_memory), m_size(that.m_size)
+	{
+		that.m_memory = nullptr;
+		that.m_size = 0U;
+	}
+	~file_mapping()
+	{
+		if (m_memory)
+			do_unmap(m_memory, m_size);
+	}
+
+	explicit operator bool() const noexcept { return bool(m_memory); }
+	void *get() noexcept { return m_memory; }
+	void const *get() const noexcept { return m_memory; }
+	std::size_t size() const noexcept { return m_size; }
+
+	/// \brief Replace the pages with a file
+	///
+	/// Maps the start of a file copy-on-write over the whole mapping,
+	/// keeping its address, so pointers into it stay valid.  Whatever
+	/// was in the mapping is discarded.  Not every platform can do this
+	/// without a window where the address range is free.
+	/// \param [in] path Path to a file at least as long as the mapping.
+	/// \return True if the file replaced the pages, or false if the
+	///   existing contents were left in place.
+	bool remap(std::string const &path) noexcept
+	{
+		return m_memory && do_remap(m_memory, m_size, path);
+	}
+
+	file_mapping &operator=(file_mapping &&that) noexcept
+	{
+		if (&that != this)
+		{
+			if (m_memory)
+				do_unmap(m_memory, m_size);
+			m_memory = that.m_memory;
+			m_size = that.m_size;
+			that.m_memory = nullptr;
+			that.m_size = 0U;
+		}
+		return *this;
+	}
+
+private:
+	static void *do_map(std::string const &path, std::size_t length, std::size_t &size) noexcept;
+	static bool do_remap(void *start, std::size_t size, std::string const &path) noexcept;
+	static void do_unmap(void *start, std::size_t size) noexcept;
+
+	void *m_memory = nullptr;
+	std::size_t m_size = 0U;
+};
+
+
+/// \brief Memory with a snapshot that can be restored in place
+///
+/// Zero-filled read-write memory that keeps one snapshot of its
+/// contents.  Taking a snapshot copies only the pages written since
+/// the previous one, and restoring it just discards those pages, so
+/// neither costs anything like a copy of the whole block.  The address
+/// never changes.  This needs the platform to say which pages have
+/// been written, so it's only available on Linux; elsewhere the object
+/// is empty and the caller should fall back to ordinary memory.
+class snapshot_memory
+{
+public:
+	snapshot_memory(snapshot_memory const &) = delete;
+	snapshot_memory &operator=(snapshot_memory const &) = delete;
+
+	explicit snapshot_memory(std::size_t length) noexcept
+	{
+		m_memory = do_create(length, m_size, m_page_size, m_shadow, m_handle, m_pagemap);
+	}
+	~snapshot_memory()
+	{
+		if (m_memory)
+			do_destroy(m_memory, m_shadow, m_size, m_handle, m_pagemap);
+	}
+
+	explicit operator bool() const noexcept { return bool(m_memory); }
+	void *get() noexcept { return m_memory; }
+	std::size_t size() const noexcept { return m_size; }
+
+	/// \brief Make the current contents the snapshot
+	/// \return True on success.  On failure the snapshot is left partly
+	///   updated and shouldn't be restored.
+	bool snapshot() noexcept { return m_memory && do_snapshot(m_memory, m_shadow, m_size, m_page_size, m_pagemap); }
+
+	/// \brief Put the contents back as they were at the last snapshot
+	/// \return True on success.
+	bool restore() noexcept { return m_memory && do_restore(m_memory, m_size); }
+
+private:
+	static void *do_create(std::size_t length, std::size_t &size, std::size_t &page_size, void *&shadow, int &handle, int &pagemap) noexcept;
+	static void do_destroy(void *start, void *shadow, std::size_t size, int handle, int pagemap) noexcept;
+	static bool do_snapshot(void *start, void *shadow, std::size_t size, std::size_t page_size, int pagemap) noexcept;
+	static bool do_restore(void *start, std::size_t size) noexcept;
+
+	void *m_memory = nullptr;       // live contents
+	void *m_shadow = nullptr;       // view of the snapshot
+	std::size_t m_size = 0U, m_page_size = 0U;
+	int m_handle = -1, m_pagemap = -1;
+};
+
+
 /*-----------------------------------------------------------------------------
     dynamic_module: load functions from optional shared libraries
 
@@ -19,7 +19,9 @@
 #include <memory>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/sysctl.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -345,6 +347,80 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 }
 
 
+void *file_mapping::do_map(std::string const &path, std::size_t length, std::size_t &size) noexcept
+{
+	if (!length)
+		return nullptr;
+	if (path.empty())
+	{
+		void *const result(mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0));
+		if (result == (void *)-1)
+			return nullptr;
+		size = length;
+		return result;
+	}
+	int const fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (0 > fd)
+		return nullptr;
+	void *result(nullptr);
+	struct stat st;
+	if (!::fstat(fd, &st) && (std::uint64_t(st.st_size) >= length))
+	{
+		result = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if (result == (void *)-1)
+			result = nullptr;
+		else
+			size = length;
+	}
+	::close(fd);
+	return result;
+}
+
+bool file_mapping::do_remap(void *start, std::size_t size, std::string const &path) noexcept
+{
+	int const fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (0 > fd)
+		return false;
+	bool result(false);
+	struct stat st;
+	if (!::fstat(fd, &st) && (std::uint64_t(st.st_size) >= size))
+	{
+		// a fixed mapping replaces the old pages atomically
+		void *const mapped(mmap(start, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0));
+		result = (mapped == start);
+	}
+	::close(fd);
+	return result;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size) noexcept
+{
+	munmap(start, size);
+}
+
+
+// there's no cheap way to find the written pages here, so it's unsupported
+
+void *snapshot_memory::do_create(std::size_t length, std::size_t &size, std::size_t &page_size, void *&shadow, int &handle, int &pagemap) noexcept
+{
+	return nullptr;
+}
+
+void snapshot_memory::do_destroy(void *start, void *shadow, std::size_t size, int handle, int pagemap) noexcept
+{
+}
+
+bool snapshot_memory::do_snapshot(void *start, void *shadow, std::size_t size, std::size_t page_size, int pagemap) noexcept
+{
+	return false;
+}
+
+bool snapshot_memory::do_restore(void *start, std::size_t size) noexcept
+{
+	return false;
+}
+
+
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
 	return std::make_unique<dynamic_module_posix_impl>(std::move(names));
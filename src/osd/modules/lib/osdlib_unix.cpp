@@ -14,14 +14,21 @@
 
 #include <SDL2/SDL.h>
 
+#include <algorithm>
 #include <csignal>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
+#include <iterator>
 #include <memory>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -247,6 +254,36 @@ void *virtual_memory_allocation::do_alloc(std::initializer_list<std::size_t> blo
 	s *= p;
 	if (!s)
 		return nullptr;
+#if defined(SDLMAME_LINUX)
+	if (intent & LARGE_PAGES)
+	{
+		// explicit huge pages need to be reserved by the administrator, so
+		// fall back to asking for transparent huge pages
+		std::size_t h(2 * 1024 * 1024);
+		if (FILE *const f = std::fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r"))
+		{
+			unsigned long v;
+			if ((std::fscanf(f, "%lu", &v) == 1) && v && !(v % p))
+				h = v;
+			std::fclose(f);
+		}
+		std::size_t const hs(((s + h - 1) / h) * h);
+		void *result(mmap(nullptr, hs, PROT_NONE, MAP_ANON | MAP_PRIVATE | MAP_HUGETLB, -1, 0));
+		if (result != (void *)-1)
+		{
+			size = hs;
+			page_size = h;
+			return result;
+		}
+		result = mmap(nullptr, s, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+		if (result == (void *)-1)
+			return nullptr;
+		madvise(result, s, MADV_HUGEPAGE);
+		size = s;
+		page_size = p;
+		return result;
+	}
+#endif
 #if defined __NetBSD__
 	int req((NONE == intent) ? PROT_NONE : 0);
 	if (intent & READ)
@@ -291,6 +328,162 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 }
 
 
+void *file_mapping::do_map(std::string const &path, std::size_t length, std::size_t &size) noexcept
+{
+	if (!length)
+		return nullptr;
+	if (path.empty())
+	{
+		void *const result(mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0));
+		if (result == (void *)-1)
+			return nullptr;
+		size = length;
+		return result;
+	}
+	int const fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (0 > fd)
+		return nullptr;
+	void *result(nullptr);
+	struct stat st;
+	if (!::fstat(fd, &st) && (std::uint64_t(st.st_size) >= length))
+	{
+		result = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if (result == (void *)-1)
+			result = nullptr;
+		else
+			size = length;
+	}
+	::close(fd);
+	return result;
+}
+
+bool file_mapping::do_remap(void *start, std::size_t size, std::string const &path) noexcept
+{
+	int const fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (0 > fd)
+		return false;
+	bool result(false);
+	struct stat st;
+	if (!::fstat(fd, &st) && (std::uint64_t(st.st_size) >= size))
+	{
+		// a fixed mapping replaces the old pages atomically
+		void *const mapped(mmap(start, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0));
+		result = (mapped == start);
+	}
+	::close(fd);
+	return result;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size) noexcept
+{
+	munmap(reinterpret_cast<char *>(start), size);
+}
+
+
+// The snapshot lives in a memory file, and the live contents are a private
+// mapping of it: pages that haven't been written since the last snapshot
+// still read from the file, and written ones have private copies, which
+// /proc/self/pagemap reports as not being file pages.  Taking a snapshot
+// copies the private pages into the file and drops them; restoring drops
+// them without copying.
+
+void *snapshot_memory::do_create(std::size_t length, std::size_t &size, std::size_t &page_size, void *&shadow, int &handle, int &pagemap) noexcept
+{
+#if defined(__linux__) && defined(SYS_memfd_create)
+	long const p(sysconf(_SC_PAGE_SIZE));
+	if ((0 >= p) || !length)
+		return nullptr;
+	std::size_t const s(((length + p - 1) / p) * p);
+
+	int const map(::open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC));
+	if (0 > map)
+		return nullptr;
+	int const fd(int(::syscall(SYS_memfd_create, "mame_snapshot", 1U))); // MFD_CLOEXEC
+	if ((0 > fd) || ::ftruncate(fd, off_t(s)))
+	{
+		if (0 <= fd)
+			::close(fd);
+		::close(map);
+		return nullptr;
+	}
+
+	void *const view(mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+	void *const live((view != (void *)-1) ? mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : (void *)-1);
+	if (live == (void *)-1)
+	{
+		if (view != (void *)-1)
+			munmap(view, s);
+		::close(fd);
+		::close(map);
+		return nullptr;
+	}
+
+	size = s;
+	page_size = p;
+	shadow = view;
+	handle = fd;
+	pagemap = map;
+	return live;
+#else
+	return nullptr;
+#endif
+}
+
+void snapshot_memory::do_destroy(void *start, void *shadow, std::size_t size, int handle, int pagemap) noexcept
+{
+	munmap(start, size);
+	munmap(shadow, size);
+	::close(handle);
+	::close(pagemap);
+}
+
+bool snapshot_memory::do_snapshot(void *start, void *shadow, std::size_t size, std::size_t page_size, int pagemap) noexcept
+{
+	constexpr std::uint64_t PM_PRESENT = std::uint64_t(1) << 63;
+	constexpr std::uint64_t PM_SWAPPED = std::uint64_t(1) << 62;
+	constexpr std::uint64_t PM_FILE = std::uint64_t(1) << 61;
+
+	std::uint8_t *const live(reinterpret_cast<std::uint8_t *>(start));
+	std::uint8_t *const file(reinterpret_cast<std::uint8_t *>(shadow));
+	std::size_t const pages(size / page_size);
+	std::uint64_t entries[512];
+	for (std::size_t first = 0; first < pages; first += std::size(entries))
+	{
+		std::size_t const count((std::min)(std::size(entries), pages - first));
+		off_t const where(off_t((reinterpret_cast<std::uintptr_t>(live) / page_size + first) * sizeof(entries[0])));
+		if (::pread(pagemap, entries, count * sizeof(entries[0]), where) != ssize_t(count * sizeof(entries[0])))
+			return false;
+
+		// copy and drop each run of private pages
+		for (std::size_t i = 0; i < count; )
+		{
+			auto const written = [&entries] (std::size_t n) { return (entries[n] & (PM_PRESENT | PM_SWAPPED)) && !(entries[n] & PM_FILE); };
+			if (!written(i))
+			{
+				++i;
+				continue;
+			}
+			std::size_t end(i + 1);
+			while ((end < count) && written(end))
+				++end;
+			std::size_t const offset((first + i) * page_size);
+			std::size_t const bytes((end - i) * page_size);
+			std::memcpy(file + offset, live + offset, bytes);
+			if (madvise(live + offset, bytes, MADV_DONTNEED))
+				return false;
+			i = end;
+		}
+	}
+	return true;
+}
+
+bool snapshot_memory::do_restore(void *start, std::size_t size) noexcept
+{
+	// dropping the private pages leaves the file's contents showing through
+	return madvise(start, size, MADV_DONTNEED) == 0;
+}
+
+
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
 	return std::make_unique<dynamic_module_posix_impl>(std::move(names));
@@ -376,6 +376,37 @@ void *virtual_memory_allocation::do_alloc(std::initializer_list<std::size_t> blo
 	s *= info.dwPageSize;
 	if (!s)
 		return nullptr;
+
+	// large pages are always read/write, so they can't be used for code
+	if ((intent & LARGE_PAGES) && !(intent & EXECUTE))
+	{
+		static SIZE_T const large(
+				[] () -> SIZE_T
+				{
+					// the user needs the "lock pages in memory" right, and it has to be enabled
+					HANDLE token;
+					if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+						return 0;
+					TOKEN_PRIVILEGES tp;
+					tp.PrivilegeCount = 1;
+					tp.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+					bool const ok(LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &tp.Privileges[0].Luid) && AdjustTokenPrivileges(token, FALSE, &tp, 0, nullptr, nullptr) && (GetLastError() == ERROR_SUCCESS));
+					CloseHandle(token);
+					return ok ? GetLargePageMinimum() : 0;
+				}());
+		if (large)
+		{
+			SIZE_T const ls(((s + large - 1) / large) * large);
+			LPVOID const result(VirtualAlloc(nullptr, ls, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE));
+			if (result)
+			{
+				size = ls;
+				page_size = large;
+				return result;
+			}
+		}
+	}
+
 	LPVOID const result(VirtualAlloc(nullptr, s, MEM_COMMIT, PAGE_NOACCESS));
 	if (result)
 	{
@@ -397,7 +428,84 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 		p = (access & WRITE) ? PAGE_EXECUTE_READWRITE : (access & READ) ? PAGE_EXECUTE_READ : PAGE_EXECUTE;
 	else
 		p = (access & WRITE) ? PAGE_READWRITE : (access & READ) ? PAGE_READONLY : PAGE_NOACCESS;
-	return VirtualAlloc(start, size, MEM_COMMIT, p) != nullptr;
+	if (VirtualAlloc(start, size, MEM_COMMIT, p))
+		return true;
+
+	// large pages are already committed
+	DWORD old;
+	return VirtualProtect(start, size, p, &old);
+}
+
+
+void *file_mapping::do_map(std::string const &path, std::size_t length, std::size_t &size) noexcept
+{
+	if (!length)
+		return nullptr;
+	if (path.empty())
+	{
+		// a view of pagefile-backed memory, so it's released the same way as a file view
+		HANDLE const mapping(CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(std::uint64_t(length) >> 32), DWORD(length), nullptr));
+		if (!mapping)
+			return nullptr;
+		void *const result(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, length));
+		if (result)
+			size = length;
+		CloseHandle(mapping);
+		return result;
+	}
+	HANDLE const file(CreateFileW(osd::text::to_wstring(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+	if (INVALID_HANDLE_VALUE == file)
+		return nullptr;
+	void *result(nullptr);
+	LARGE_INTEGER filesize;
+	if (GetFileSizeEx(file, &filesize) && (std::uint64_t(filesize.QuadPart) >= length))
+	{
+		// the view keeps the mapping object alive
+		HANDLE const mapping(CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+		if (mapping)
+		{
+			result = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, length);
+			if (result)
+				size = length;
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(file);
+	return result;
+}
+
+bool file_mapping::do_remap(void *start, std::size_t size, std::string const &path) noexcept
+{
+	// a view can't be replaced without unmapping it first, leaving the
+	// range free for another thread to take, so leave the contents alone
+	return false;
+}
+
+void file_mapping::do_unmap(void *start, std::size_t size) noexcept
+{
+	UnmapViewOfFile(start);
+}
+
+
+// there's no cheap way to find the written pages here, so it's unsupported
+
+void *snapshot_memory::do_create(std::size_t length, std::size_t &size, std::size_t &page_size, void *&shadow, int &handle, int &pagemap) noexcept
+{
+	return nullptr;
+}
+
+void snapshot_memory::do_destroy(void *start, void *shadow, std::size_t size, int handle, int pagemap) noexcept
+{
+}
+
+bool snapshot_memory::do_snapshot(void *start, void *shadow, std::size_t size, std::size_t page_size, int pagemap) noexcept
+{
+	return false;
+}
+
+bool snapshot_memory::do_restore(void *start, std::size_t size) noexcept
+{
+	return false;
 }
 
 
@@ -21,6 +21,7 @@
 #include "modules/sound/sound_module.h"
 
 #include "osdnet.h"
+#include "osdsync.h"
 #include "watchdog.h"
 
 #include "emu.h"
@@ -66,6 +67,8 @@ const options_entry osd_options::s_option_entries[] =
 
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "OSD PERFORMANCE OPTIONS" },
 	{ OSDOPTION_NUMPROCESSORS ";np",             OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "number of processors; this overrides the number the system reports" },
+	{ OSDOPTION_CPU_AFFINITY,                    OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "processors the emulation thread may run on, e.g. 0-3,8 or node0; auto leaves it to the system" },
+	{ OSDOPTION_WORKER_AFFINITY,                 OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "processors worker threads may run on, in the same form; auto uses " OSDOPTION_CPU_AFFINITY },
 	{ OSDOPTION_BENCH,                           "0",              core_options::option_type::INTEGER,   "benchmark for the given number of emulated seconds; implies -video none -sound none -nothrottle" },
 
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "OSD VIDEO OPTIONS" },
@@ -145,6 +148,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "OSD SOUND OPTIONS" },
 	{ OSDOPTION_SOUND,                           OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "sound output method: " },
 	{ OSDOPTION_AUDIO_LATENCY "(0-5)",           "2",              core_options::option_type::INTEGER,   "set audio latency (increase to reduce glitches, decrease for responsiveness)" },
+	{ OSDOPTION_AUDIO_TARGET "(0-200)",          "0",              core_options::option_type::FLOAT,     "target audio buffering in milliseconds for modules that support it, 0 to follow audio_latency" },
 
 #ifndef NO_USE_PORTAUDIO
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "PORTAUDIO OPTIONS" },
@@ -445,6 +449,26 @@ void osd_common_t::init(running_machine &machine)
 		m_watchdog = std::make_unique<osd_watchdog>();
 		m_watchdog->setTimeout(watchdog_timeout);
 	}
+
+	// pin threads to processors, keeping memory they first touch on the same node
+	std::vector<unsigned> cpus;
+	if (strcmp(options.cpu_affinity(), OSDOPTVAL_AUTO))
+	{
+		if (!osd_parse_cpu_list(options.cpu_affinity(), cpus))
+		{
+			osd_printf_warning("Invalid processor list: %s\n", options.cpu_affinity());
+			cpus.clear();
+		}
+		else if (!osd_set_thread_affinity(cpus))
+			osd_printf_warning("Unable to set emulation thread processor affinity\n");
+	}
+	if (strcmp(options.worker_affinity(), OSDOPTVAL_AUTO) && !osd_parse_cpu_list(options.worker_affinity(), cpus))
+	{
+		osd_printf_warning("Invalid processor list: %s\n", options.worker_affinity());
+		cpus.clear();
+	}
+	if (!cpus.empty() && !osd_set_worker_affinity(cpus))
+		osd_printf_warning("Unable to set worker thread processor affinity\n");
 }
 
 
@@ -539,6 +563,17 @@ void osd_common_t::set_mastervolume(int attenuation)
 }
 
 
+//-------------------------------------------------
+//  sound_buffer_status - report how full the
+//  sound module's output buffer is, in frames
+//-------------------------------------------------
+
+bool osd_common_t::sound_buffer_status(int &fill, int &target)
+{
+	return (m_sound != nullptr) && m_sound->buffer_status(fill, target);
+}
+
+
 //-------------------------------------------------
 //  customize_input_type_list - provide OSD
 //  additions/modifications to the input list
@@ -671,6 +706,11 @@ static void output_notifier_callback(const char *outname, int32_t value, void *p
 	static_cast<osd_common_t*>(param)->notify(outname, value);
 }
 
+static void output_batch_notifier_callback(void *param)
+{
+	static_cast<osd_common_t*>(param)->notify_batch();
+}
+
 void osd_common_t::init_subsystems()
 {
 	// monitors have to be initialized before video init
@@ -703,6 +743,7 @@ void osd_common_t::init_subsystems()
 
 	m_output = &select_module_options<output_module>(OSD_OUTPUT_PROVIDER);
 	machine().output().set_global_notifier(output_notifier_callback, this);
+	machine().output().set_batch_notifier(output_batch_notifier_callback, this);
 
 	input_init();
 }
@@ -50,6 +50,8 @@
 #define OSDOPTION_WATCHDOG              "watchdog"
 
 #define OSDOPTION_NUMPROCESSORS         "numprocessors"
+#define OSDOPTION_CPU_AFFINITY          "cpuaffinity"
+#define OSDOPTION_WORKER_AFFINITY       "workeraffinity"
 #define OSDOPTION_BENCH                 "bench"
 
 #define OSDOPTION_VIDEO                 "video"
@@ -80,6 +82,7 @@
 
 #define OSDOPTION_SOUND                 "sound"
 #define OSDOPTION_AUDIO_LATENCY         "audio_latency"
+#define OSDOPTION_AUDIO_TARGET          "audio_target"
 
 #define OSDOPTION_PA_API                "pa_api"
 #define OSDOPTION_PA_DEVICE             "pa_device"
@@ -128,6 +131,8 @@ public:
 
 	// performance options
 	const char *numprocessors() const { return value(OSDOPTION_NUMPROCESSORS); }
+	const char *cpu_affinity() const { return value(OSDOPTION_CPU_AFFINITY); }
+	const char *worker_affinity() const { return value(OSDOPTION_WORKER_AFFINITY); }
 	int bench() const { return int_value(OSDOPTION_BENCH); }
 
 	// video options
@@ -168,6 +173,7 @@ public:
 	// sound options
 	const char *sound() const { return value(OSDOPTION_SOUND); }
 	int audio_latency() const { return int_value(OSDOPTION_AUDIO_LATENCY); }
+	float audio_target() const { return float_value(OSDOPTION_AUDIO_TARGET); }
 
 	// CoreAudio specific options
 	const char *audio_output() const { return value(OSDOPTION_AUDIO_OUTPUT); }
@@ -225,6 +231,7 @@ public:
 	// audio overridables
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool sound_buffer_status(int &fill, int &target) override;
 	virtual bool no_sound() override;
 
 	// input overridables
@@ -271,6 +278,7 @@ public:
 	virtual void set_verbose(bool print_verbose) override { m_print_verbose = print_verbose; }
 
 	void notify(const char *outname, int32_t value) const { m_output->notify(outname, value); }
+	void notify_batch() const { m_output->notify_batch(); }
 
 	virtual void process_events() = 0;
 	virtual bool has_focus() const = 0;
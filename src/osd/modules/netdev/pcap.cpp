@@ -29,6 +29,8 @@
 
 #include <pcap.h>
 
+#include <mutex>
+
 namespace osd {
 
 namespace {
@@ -128,9 +130,11 @@ protected:
 
 private:
 	pcap_t *m_p;
+	std::mutex m_lock; // the filter is changed while the receive thread is reading
 #ifdef SDLMAME_MACOSX
 	struct netdev_pcap_context m_ctx;
 	pthread_t m_thread;
+	uint8_t m_pktbuf[1600];
 #endif
 };
 
@@ -196,6 +200,7 @@ void netdev_pcap::set_mac(const uint8_t *mac)
 {
 	struct bpf_program fp;
 	if(!m_p) return;
+	std::lock_guard<std::mutex> lock(m_lock);
 #ifdef SDLMAME_MACOSX
 	auto filter = util::string_format("not ether src %02X:%02X:%02X:%02X:%02X:%02X and (ether dst %02X:%02X:%02X:%02X:%02X:%02X or ether multicast or ether broadcast or ether dst 09:00:07:ff:ff:ff)", (unsigned char)mac[0], (unsigned char)mac[1], (unsigned char)mac[2],(unsigned char)mac[3], (unsigned char)mac[4], (unsigned char)mac[5], (unsigned char)mac[0], (unsigned char)mac[1], (unsigned char)mac[2],(unsigned char)mac[3], (unsigned char)mac[4], (unsigned char)mac[5]);
 #else
@@ -225,7 +230,7 @@ int netdev_pcap::send(uint8_t *buf, int len)
 int netdev_pcap::recv_dev(uint8_t **buf)
 {
 #ifdef SDLMAME_MACOSX
-	uint8_t pktbuf[2048];
+	uint8_t *const pktbuf = m_pktbuf;
 	int ret;
 
 	// no device open?
@@ -244,12 +249,14 @@ int netdev_pcap::recv_dev(uint8_t **buf)
 #else
 	struct pcap_pkthdr *header;
 	if(!m_p) return 0;
+	std::lock_guard<std::mutex> lock(m_lock);
 	return ((*module->pcap_next_ex_dl)(m_p, &header, (const u_char **)buf) == 1)?header->len:0;
 #endif
 }
 
 netdev_pcap::~netdev_pcap()
 {
+	stop_receiver();
 #ifdef SDLMAME_MACOSX
 	m_ctx.p = nullptr;
 	pthread_cancel(m_thread);
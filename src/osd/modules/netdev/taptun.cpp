@@ -14,6 +14,7 @@
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <net/if.h>
+#include <poll.h>
 #include <cerrno>
 #endif
 
@@ -71,6 +72,7 @@ public:
 
 protected:
 	int recv_dev(uint8_t **buf) override;
+	void wait_dev() override;
 
 private:
 #if defined(_WIN32)
@@ -131,6 +133,8 @@ netdev_tap::netdev_tap(const char *name, network_handler &ifdev)
 
 netdev_tap::~netdev_tap()
 {
+	stop_receiver();
+
 #if defined(_WIN32)
 	if (m_handle != INVALID_HANDLE_VALUE)
 	{
@@ -235,6 +239,15 @@ int netdev_tap::recv_dev(uint8_t **buf)
 	return 0;
 }
 
+void netdev_tap::wait_dev()
+{
+	// a read is left pending when there's nothing to receive
+	if (m_receive_pending)
+		WaitForSingleObject(m_handle, 10);
+	else
+		osd_network_device::wait_dev();
+}
+
 static std::wstring safe_string(WCHAR value[], int length)
 {
 	if (value[length] != L'\0')
@@ -349,6 +362,22 @@ int netdev_tap::recv_dev(uint8_t **buf)
 	*buf = m_buf;
 	return (len == -1)?0:len;
 }
+
+void netdev_tap::wait_dev()
+{
+	if(m_fd == -1)
+	{
+		osd_network_device::wait_dev();
+		return;
+	}
+
+	// sleep until a frame arrives, waking now and then to see if the receiver is being stopped
+	struct pollfd pfd;
+	pfd.fd = m_fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	::poll(&pfd, 1, 10);
+}
 #endif
 
 static CREATE_NETDEV(create_tap)
@@ -48,6 +48,7 @@
 		virtual explicit operator bool() const = 0;
 
 		virtual void make_current() = 0;
+		virtual void release_current() = 0;
 		virtual const char *last_error_message() = 0;
 		virtual void *get_proc_address(const char *proc) = 0;
 
@@ -15,6 +15,7 @@
 #include "osdhelper.h"
 #include "../frontend/mame/ui/menuitem.h"
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <memory>
@@ -356,9 +357,9 @@ public:
 
 	osd_window &window() const { return m_window; }
 
-	bool has_flags(const int flag) const { return ((m_flags & flag)) == flag; }
-	void set_flags(int aflag) { m_flags |= aflag; }
-	void clear_flags(int aflag) { m_flags &= ~aflag; }
+	bool has_flags(const int flag) const { return ((m_flags.load(std::memory_order_relaxed) & flag)) == flag; }
+	void set_flags(int aflag) { m_flags.fetch_or(aflag, std::memory_order_relaxed); }
+	void clear_flags(int aflag) { m_flags.fetch_and(~aflag, std::memory_order_relaxed); }
 
 	void notify_changed() { set_flags(FI_CHANGED); }
 
@@ -376,6 +377,12 @@ public:
 	virtual void toggle_fsfx() { }
 	virtual bool sliders_dirty() { return m_sliders_dirty; }
 
+	// draw() may be called from a thread other than the one that created the
+	// renderer, one thread at a time, if release_thread() is called on the
+	// thread giving it up
+	virtual bool can_draw_on_thread() const { return false; }
+	virtual void release_thread() { }
+
 protected:
 	virtual void build_slider_list() { }
 
@@ -386,7 +393,7 @@ protected:
 
 private:
 	osd_window &m_window;
-	int         m_flags;
+	std::atomic<int> m_flags;
 };
 
 
@@ -425,6 +432,7 @@ struct osd_video_config
 	//============================================================
 	int                 centerh;
 	int                 centerv;
+	int                 renderthread;   // draw and present on a separate thread
 
 	// vector options
 	float               beamwidth;      // beam width
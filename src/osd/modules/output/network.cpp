@@ -22,6 +22,7 @@
 
 #include "asio.h"
 
+#include <deque>
 #include <memory>
 #include <set>
 #include <thread>
@@ -35,7 +36,7 @@ class output_client
 {
 public:
 	virtual ~output_client() { }
-	virtual void deliver(std::string &msg) = 0;
+	virtual void deliver(std::string const &msg) = 0;
 };
 
 using output_client_ptr = std::shared_ptr<output_client>;
@@ -56,16 +57,18 @@ public:
 		m_machine = &machine;
 		m_clients->insert(shared_from_this());
 		// now send "mame_start = rom" to the newly connected client
-		std::snprintf(m_data, max_length, "mame_start = %s\r", machine.system().name);
-		do_write(std::strlen(m_data));
+		deliver(util::string_format("mame_start = %s\r", machine.system().name));
 		do_read();
 	}
 
 private:
-	void deliver(std::string &msg)
+	// messages are written one at a time, in order
+	void deliver(std::string const &msg) override
 	{
-		std::strncpy(m_data, msg.c_str(), max_length);
-		do_write(msg.size());
+		bool const idle = m_queue.empty();
+		m_queue.push_back(msg);
+		if (idle)
+			do_write();
 	}
 
 	void handle_message(char *msg)
@@ -125,18 +128,24 @@ private:
 				});
 	}
 
-	void do_write(std::size_t length)
+	void do_write()
 	{
 		auto self(shared_from_this());
 		asio::async_write(
 				m_socket,
-				asio::buffer(m_data, length),
+				asio::buffer(m_queue.front()),
 				[this, self] (std::error_code ec, std::size_t /*length*/)
 				{
 					if (ec)
 					{
 						m_clients->erase(shared_from_this());
 					}
+					else
+					{
+						m_queue.pop_front();
+						if (!m_queue.empty())
+							do_write();
+					}
 				});
 	}
 
@@ -144,7 +153,7 @@ private:
 
 	asio::ip::tcp::socket m_socket;
 	enum { max_length = 1024 };
-	char m_data[max_length];
+	std::deque<std::string> m_queue;
 	char m_input_m_data[max_length];
 	client_set *m_clients;
 	running_machine *m_machine;
@@ -160,7 +169,7 @@ public:
 		do_accept();
 	}
 
-	void deliver_to_all(std::string msg)
+	void deliver_to_all(std::string const &msg)
 	{
 		for (const auto &client: m_clients)
 			client->deliver(msg);
@@ -206,6 +215,8 @@ public:
 	virtual int init(osd_interface &osd, const osd_options &options) override
 	{
 		m_machine = &downcast<osd_common_t &>(osd).machine();
+		m_io_context.reset(new asio::io_context);
+		m_server.reset(new output_network_server(*m_io_context, 8000, machine()));
 		m_working_thread = std::thread([] (output_network* self) { self->process_output(); }, this);
 		return 0;
 	}
@@ -214,6 +225,7 @@ public:
 	{
 		// tell clients MAME is shutting down
 		notify("mame_stop", 1);
+		notify_batch();
 		m_io_context->stop();
 		m_working_thread.join();
 		m_server.reset();
@@ -225,15 +237,23 @@ public:
 
 	virtual void notify(const char *outname, int32_t value) override
 	{
-		auto msg = util::string_format("%s = %d\r", ((outname==nullptr) ? "none" : outname), value);
-		m_server->deliver_to_all(msg);
+		// collected until the end of the frame and sent as one message
+		m_pending.append(util::string_format("%s = %d\r", ((outname==nullptr) ? "none" : outname), value));
+	}
+
+	virtual void notify_batch() override
+	{
+		if (m_pending.empty())
+			return;
+
+		// the sessions belong to the network thread
+		asio::post(*m_io_context, [this, msg = std::move(m_pending)] () { m_server->deliver_to_all(msg); });
+		m_pending.clear();
 	}
 
 	// implementation
 	void process_output()
 	{
-		m_io_context.reset(new asio::io_context);
-		m_server.reset(new output_network_server(*m_io_context, 8000, machine()));
 		m_io_context->run();
 	}
 
@@ -244,6 +264,7 @@ private:
 	std::unique_ptr<asio::io_context> m_io_context;
 	std::unique_ptr<output_network_server> m_server;
 	running_machine *m_machine;
+	std::string m_pending;
 };
 
 } // anonymous namespace
@@ -29,6 +29,9 @@ public:
 	virtual ~output_module() = default;
 
 	virtual void notify(const char *outname, int32_t value) = 0;
+
+	// called once the outputs changed during a frame have all been notified
+	virtual void notify_batch() { }
 };
 
 #endif // MAME_OSD_OUTPUT_OUTPUT_MODULE_H
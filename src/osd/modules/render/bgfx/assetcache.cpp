@@ -0,0 +1,168 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+//============================================================
+//
+//  assetcache.cpp - BGFX chain, effect and shader file cache
+//
+//============================================================
+
+#include "assetcache.h"
+
+#include "osdfile.h"
+
+#include <rapidjson/error/en.h>
+
+#include <bx/file.h>
+#include <bx/readerwriter.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+
+namespace {
+
+struct file_stamp
+{
+	uint64_t size = 0;
+	std::chrono::system_clock::time_point modified;
+
+	bool operator==(const file_stamp &that) const { return (size == that.size) && (modified == that.modified); }
+};
+
+
+file_stamp get_stamp(const std::string &path)
+{
+	// a missing file gets the empty stamp, so it's noticed when it appears
+	file_stamp result;
+	std::unique_ptr<osd::directory::entry> const entry = osd_stat(path);
+	if (entry)
+	{
+		result.size = entry->size;
+		result.modified = entry->last_modified;
+	}
+	return result;
+}
+
+
+bool read_file(const std::string &path, std::vector<uint8_t> &data, size_t extra)
+{
+	bx::FileReader reader;
+	if (!bx::open(&reader, path.c_str()))
+		return false;
+
+	bx::ErrorAssert err;
+	const int64_t size = bx::getSize(&reader);
+	data.resize(size_t(size) + extra);
+	const int32_t read = bx::read(&reader, data.data(), int32_t(size), &err);
+	bx::close(&reader);
+	return read == size;
+}
+
+
+template <typename T>
+class file_cache
+{
+public:
+	using value_ptr = std::shared_ptr<const T>;
+
+	template <typename Load>
+	value_ptr get(const std::string &path, Load &&load)
+	{
+		file_stamp const stamp = get_stamp(path);
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto const found = m_entries.find(path);
+		if ((found != m_entries.end()) && (found->second.stamp == stamp))
+		{
+			std::shared_future<value_ptr> value = found->second.value;
+			lock.unlock();
+			return value.get();
+		}
+
+		// anyone else asking for it now waits for this thread to load it
+		std::promise<value_ptr> promise;
+		m_entries[path] = entry{ stamp, promise.get_future().share() };
+		lock.unlock();
+
+		value_ptr result;
+		try
+		{
+			result = load(path);
+		}
+		catch (...)
+		{
+		}
+		promise.set_value(result);
+		return result;
+	}
+
+private:
+	struct entry
+	{
+		file_stamp                      stamp;
+		std::shared_future<value_ptr>   value;
+	};
+
+	std::mutex                                  m_mutex;
+	std::unordered_map<std::string, entry>      m_entries;
+};
+
+
+file_cache<asset_cache::document> &document_cache()
+{
+	static file_cache<asset_cache::document> cache;
+	return cache;
+}
+
+
+file_cache<std::vector<uint8_t> > &binary_cache()
+{
+	static file_cache<std::vector<uint8_t> > cache;
+	return cache;
+}
+
+} // anonymous namespace
+
+
+asset_cache::document_ptr asset_cache::get_document(const std::string &path)
+{
+	return document_cache().get(
+			path,
+			[] (const std::string &path) -> document_ptr
+			{
+				auto result = std::make_shared<document>();
+				std::vector<uint8_t> data;
+				if (!read_file(path, data, 1))
+				{
+					result->result = status::OPEN_FAILED;
+					return result;
+				}
+				data.back() = 0;
+
+				result->json.Parse<rapidjson::kParseCommentsFlag>(reinterpret_cast<const char *>(data.data()));
+				if (result->json.HasParseError())
+				{
+					result->result = status::PARSE_FAILED;
+					result->error = rapidjson::GetParseError_En(result->json.GetParseError());
+				}
+				return result;
+			});
+}
+
+
+asset_cache::binary_ptr asset_cache::get_binary(const std::string &path)
+{
+	return binary_cache().get(
+			path,
+			[] (const std::string &path) -> binary_ptr
+			{
+				auto result = std::make_shared<std::vector<uint8_t> >();
+				if (!read_file(path, *result, 0))
+					return nullptr;
+				return result;
+			});
+}
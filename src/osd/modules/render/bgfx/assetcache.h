@@ -0,0 +1,56 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+//============================================================
+//
+//  assetcache.h - BGFX chain, effect and shader file cache
+//
+//  Keeps parsed JSON documents and shader binaries for the
+//  life of the process, so switching chains or starting the
+//  next system doesn't read and parse them again.  Entries
+//  are checked against the file's size and modification
+//  time on every lookup.  Safe to use from any thread; a
+//  lookup for a file another thread is loading waits for it.
+//
+//============================================================
+
+#ifndef MAME_RENDER_BGFX_ASSETCACHE_H
+#define MAME_RENDER_BGFX_ASSETCACHE_H
+
+#pragma once
+
+#include <rapidjson/document.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+class asset_cache
+{
+public:
+	enum class status
+	{
+		OK,
+		OPEN_FAILED,
+		PARSE_FAILED
+	};
+
+	struct document
+	{
+		status              result = status::OK;
+		std::string         error;      // parser message if parsing failed
+		rapidjson::Document json;
+	};
+
+	using document_ptr = std::shared_ptr<const document>;
+	using binary_ptr = std::shared_ptr<const std::vector<uint8_t> >;
+
+	// returns nullptr only if memory ran out
+	static document_ptr get_document(const std::string &path);
+
+	// returns nullptr if the file can't be read
+	static binary_ptr get_binary(const std::string &path);
+};
+
+#endif // MAME_RENDER_BGFX_ASSETCACHE_H
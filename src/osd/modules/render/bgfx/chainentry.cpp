@@ -41,6 +41,8 @@ bgfx_chain_entry::bgfx_chain_entry(std::string name, bgfx_effect* effect, clear_
 	, m_targets(targets)
 	, m_output(output)
 	, m_apply_tint(apply_tint)
+	, m_last_output(nullptr)
+	, m_last_output_version(0)
 {
 }
 
@@ -102,12 +104,51 @@ void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, textur
 		}
 	}
 
+	// A single-buffered target still holds the output of the last draw if
+	// nothing else has rendered into it since, so skip the draw entirely when
+	// none of its inputs, uniforms or dimensions have changed either.  The
+	// view isn't cleared without a draw, and the pending texture and vertex
+	// bindings are dropped.
+	bgfx_target* output = m_targets.target(screen, m_output);
+	build_state(textures, output, view_width, view_height, tint, screen);
+	if (output != nullptr && !output->double_buffered() && output == m_last_output && output->version() == m_last_output_version && m_state == m_last_state)
+	{
+		bgfx::discard();
+		return;
+	}
+
 	m_effect->submit(view);
 
-	if (m_targets.target(screen, m_output) != nullptr)
+	if (output != nullptr)
+	{
+		output->page_flip();
+	}
+
+	m_state.swap(m_last_state);
+	m_last_output = output;
+	m_last_output_version = (output != nullptr) ? output->version() : 0;
+}
+
+void bgfx_chain_entry::build_state(texture_manager& textures, bgfx_target* output, uint16_t view_width, uint16_t view_height, uint32_t tint, int32_t screen)
+{
+	const auto append = [this] (const auto &value)
+	{
+		const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+		m_state.insert(m_state.end(), bytes, bytes + sizeof(value));
+	};
+
+	m_state.clear();
+	append(view_width);
+	append(view_height);
+	append(tint);
+	for (bgfx_input_pair* input : m_inputs)
 	{
-		m_targets.target(screen, m_output)->page_flip();
+		bgfx_texture_handle_provider* provider = textures.provider(input->texture() + std::to_string(screen));
+		append(provider);
+		append((provider != nullptr) ? provider->version() : uint64_t(0));
 	}
+	append(output);
+	m_effect->append_uniform_data(m_state);
 }
 
 void bgfx_chain_entry::setup_auto_uniforms(chain_manager::screen_prim &prim, texture_manager& textures, uint16_t screen_count, uint16_t view_width, uint16_t view_height,
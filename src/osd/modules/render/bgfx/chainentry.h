@@ -66,6 +66,7 @@ private:
 	bool setup_view(texture_manager& textures, int view, uint16_t screen_width, uint16_t screen_height, int32_t screen,
 		uint16_t &out_view_width, uint16_t &out_view_height) const;
 	void put_screen_buffer(uint16_t screen_width, uint16_t screen_height, uint32_t screen_tint, bgfx::TransientVertexBuffer* buffer) const;
+	void build_state(texture_manager& textures, bgfx_target* output, uint16_t view_width, uint16_t view_height, uint32_t tint, int32_t screen);
 
 	std::string                         m_name;
 	bgfx_effect*                        m_effect;
@@ -76,6 +77,12 @@ private:
 	target_manager&                     m_targets;
 	std::string                         m_output;
 	bool                                m_apply_tint;
+
+	// Everything the last submitted draw depended on, to reuse its output
+	std::vector<uint8_t>                m_state;
+	std::vector<uint8_t>                m_last_state;
+	bgfx_target*                        m_last_output;
+	uint64_t                            m_last_output_version;
 };
 
 #endif // __DRAWBGFX_CHAIN_ENTRY__
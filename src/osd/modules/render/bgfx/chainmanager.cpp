@@ -11,9 +11,6 @@
 
 #include "chainmanager.h"
 
-#include <bx/readerwriter.h>
-#include <bx/file.h>
-
 #include "emucore.h"
 #include "render.h"
 #include "../frontend/mame/ui/slider.h"
@@ -22,12 +19,13 @@
 #include "modules/osdwindow.h"
 
 #include <rapidjson/document.h>
-#include <rapidjson/error/en.h>
 
+#include "assetcache.h"
 #include "bgfxutil.h"
 
 #include "chain.h"
 #include "chainreader.h"
+#include "shadermanager.h"
 #include "slider.h"
 #include "target.h"
 #include "texture.h"
@@ -82,18 +80,122 @@ chain_manager::chain_manager(
 	, m_slider_notifier(slider_notifier)
 	, m_screen_count(0)
 	, m_default_chain_index(-1)
+	, m_preload_queue(nullptr)
+	, m_preload_item(nullptr)
 {
 	m_converters.clear();
 	refresh_available_chains();
 	parse_chain_selections(options.bgfx_screen_chains());
 	init_texture_converters();
+	start_preload();
 }
 
 chain_manager::~chain_manager()
 {
+	if (m_preload_item)
+	{
+		while (!osd_work_item_wait(m_preload_item, osd_ticks_per_second() * 100)) { }
+		osd_work_item_release(m_preload_item);
+	}
+	if (m_preload_queue)
+		osd_work_queue_free(m_preload_queue);
+
 	destroy_chains();
 }
 
+std::string chain_manager::chain_file_path(const std::string &bgfx_path, std::string name)
+{
+	if (name.length() < 5 || (name.compare(name.length() - 5, 5, ".json") != 0))
+	{
+		name += ".json";
+	}
+	return util::path_concat(bgfx_path, "chains", name);
+}
+
+void chain_manager::start_preload()
+{
+	// the selected chains go first, then everything else the user might switch to
+	std::vector<int32_t> order;
+	for (int32_t index : m_current_chain)
+	{
+		if (index != CHAIN_NONE && std::find(order.begin(), order.end(), index) == order.end())
+			order.push_back(index);
+	}
+	for (int32_t index = 0; index < int32_t(m_available_chains.size()); index++)
+	{
+		if (index != CHAIN_NONE && std::find(order.begin(), order.end(), index) == order.end())
+			order.push_back(index);
+	}
+
+	m_preload_chains.clear();
+	for (int32_t index : order)
+	{
+		const chain_desc &desc = m_available_chains[index];
+		m_preload_chains.emplace_back(chain_file_path(m_options.bgfx_path(), util::path_concat(desc.m_path, desc.m_name)));
+	}
+	if (m_preload_chains.empty())
+		return;
+
+	// the work item only touches these copies, never the options or the chain list
+	m_preload_bgfx_path = m_options.bgfx_path();
+	m_preload_shader_directory = shader_manager::shader_directory(m_options);
+	m_preload_queue = osd_work_queue_alloc(0);
+	if (m_preload_queue)
+		m_preload_item = osd_work_item_queue(m_preload_queue, &chain_manager::preload_callback, this, 0);
+}
+
+void *chain_manager::preload_callback(void *param, int threadid)
+{
+	chain_manager &chains = *reinterpret_cast<chain_manager *>(param);
+
+	// parse the chains and pull in the effects and shaders they use
+	std::vector<std::string> effects;
+	for (const std::string &path : chains.m_preload_chains)
+	{
+		asset_cache::document_ptr document = asset_cache::get_document(path);
+		if (!document || (document->result != asset_cache::status::OK) || !document->json.IsObject())
+			continue;
+		if (!document->json.HasMember("passes") || !document->json["passes"].IsArray())
+			continue;
+
+		for (const Value &pass : document->json["passes"].GetArray())
+		{
+			if (!pass.IsObject() || !pass.HasMember("effect") || !pass["effect"].IsString())
+				continue;
+
+			std::string name(pass["effect"].GetString());
+			if (std::find(effects.begin(), effects.end(), name) == effects.end())
+			{
+				effect_manager::preload_effect(chains.m_preload_bgfx_path, chains.m_preload_shader_directory, name);
+				effects.emplace_back(std::move(name));
+			}
+		}
+	}
+
+	// warm_up_effects takes them from the back
+	std::reverse(effects.begin(), effects.end());
+	chains.m_warm_effects = std::move(effects);
+	return nullptr;
+}
+
+void chain_manager::warm_up_effects()
+{
+	if (m_preload_item)
+	{
+		if (!osd_work_item_wait(m_preload_item, 0))
+			return;
+		osd_work_item_release(m_preload_item);
+		m_preload_item = nullptr;
+	}
+
+	// create programs a couple at a time so they don't all land on one frame
+	for (int count = 0; (count < 2) && !m_warm_effects.empty(); count++)
+	{
+		m_effects.get_or_load_effect(m_options, m_warm_effects.back());
+		m_warm_effects.pop_back();
+	}
+}
+
 void chain_manager::init_texture_converters()
 {
 	m_converters.push_back(nullptr);
@@ -225,42 +327,27 @@ std::unique_ptr<bgfx_chain> chain_manager::load_chain(std::string name, uint32_t
 	{
 		name += ".json";
 	}
-	const std::string path = util::path_concat(m_options.bgfx_path(), "chains", name);
+	const std::string path = chain_file_path(m_options.bgfx_path(), name);
 
-	bx::FileReader reader;
-	if (!bx::open(&reader, path.c_str()))
+	// usually parsed already, by the preload or an earlier system
+	asset_cache::document_ptr document = asset_cache::get_document(path);
+	if (!document)
 	{
-		osd_printf_warning("Unable to open chain file %s, falling back to no post processing\n", path);
+		osd_printf_error("Out of memory reading chain file %s\n", path);
 		return nullptr;
 	}
-
-	const int32_t size(bx::getSize(&reader));
-
-	bx::ErrorAssert err;
-	std::unique_ptr<char []> data(new (std::nothrow) char [size + 1]);
-	if (!data)
+	else if (document->result == asset_cache::status::OPEN_FAILED)
 	{
-		osd_printf_error("Out of memory reading chain file %s\n", path);
-		bx::close(&reader);
+		osd_printf_warning("Unable to open chain file %s, falling back to no post processing\n", path);
 		return nullptr;
 	}
-
-	bx::read(&reader, reinterpret_cast<void*>(data.get()), size, &err);
-	bx::close(&reader);
-	data[size] = 0;
-
-	Document document;
-	document.Parse<kParseCommentsFlag>(data.get());
-	data.reset();
-
-	if (document.HasParseError())
+	else if (document->result == asset_cache::status::PARSE_FAILED)
 	{
-		std::string error(GetParseError_En(document.GetParseError()));
-		osd_printf_warning("Unable to parse chain %s. Errors returned:\n%s\n", path, error);
+		osd_printf_warning("Unable to parse chain %s. Errors returned:\n%s\n", path, document->error);
 		return nullptr;
 	}
 
-	std::unique_ptr<bgfx_chain> chain = chain_reader::read_from_value(document, name + ": ", *this, screen_index, m_user_prescale, m_max_prescale_size);
+	std::unique_ptr<bgfx_chain> chain = chain_reader::read_from_value(document->json, name + ": ", *this, screen_index, m_user_prescale, m_max_prescale_size);
 
 	if (!chain)
 	{
@@ -525,6 +612,8 @@ void chain_manager::create_selection_slider(uint32_t screen_index)
 
 uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *starting_prim, osd_window& window)
 {
+	warm_up_effects();
+
 	if (!count_screens(starting_prim))
 		return 0;
 
@@ -553,15 +642,30 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 			palette = nullptr;
 		}
 
+		// The core only bumps the sequence of a dirty-tracked screen texture when something was drawn, and says which
+		// rows changed since the sequence before; the texture is shared by both of the screen's pages, so that only
+		// helps when the same page is shown again.
+		const render_texinfo &texinfo = prim.m_prim->texture;
+		const bool same_page = texture && screen < m_screen_ids.size() && m_screen_ids[screen] == texinfo.unique_id;
+		const bool unchanged = same_page && m_screen_seqids[screen] == texinfo.seqid;
+		const bool rows_only = same_page && texinfo.dirty_seqid != 0 && m_screen_seqids[screen] == texinfo.dirty_seqid;
+		while (screen >= m_screen_ids.size())
+		{
+			m_screen_ids.emplace_back(~0ULL);
+			m_screen_seqids.emplace_back(0);
+		}
+		m_screen_ids[screen] = texinfo.unique_id;
+		m_screen_seqids[screen] = texinfo.seqid;
+
 		bgfx::TextureFormat::Enum dst_format = bgfx::TextureFormat::BGRA8;
 		uint16_t pitch = prim.m_rowpixels;
 		int width_div_factor = 1;
 		int width_mul_factor = 1;
-		const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
-			prim.m_rowpixels, prim.m_prim->texture.width_margin, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, pitch, width_div_factor, width_mul_factor);
 
 		if (!texture)
 		{
+			const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+				prim.m_rowpixels, texinfo.width_margin, tex_height, texinfo.palette, texinfo.base, texinfo.persistent, pitch, width_div_factor, width_mul_factor);
 			uint32_t flags = BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT;
 			if (!PRIMFLAG_GET_TEXWRAP(prim.m_flags))
 				flags |= BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
@@ -596,9 +700,24 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 				m_screen_palettes[screen] = palette;
 			}
 		}
-		else
+		else if (!unchanged)
 		{
-			texture->update(mem, pitch, prim.m_prim->texture.width_margin);
+			if (!rows_only)
+			{
+				const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+					prim.m_rowpixels, texinfo.width_margin, tex_height, texinfo.palette, texinfo.base, texinfo.persistent, pitch, width_div_factor, width_mul_factor);
+				texture->update(mem, pitch, texinfo.width_margin);
+			}
+			else if (!texinfo.dirty.empty())
+			{
+				const int bytes_per_pixel = (src_format == TEXFORMAT_PALETTE16 || src_format == TEXFORMAT_YUY16) ? 2 : 4;
+				const uint16_t top = uint16_t(texinfo.dirty.top());
+				const uint16_t rows = uint16_t(texinfo.dirty.height());
+				uint8_t *const base = reinterpret_cast<uint8_t *>(texinfo.base) + top * prim.m_rowpixels * bytes_per_pixel;
+				const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+					prim.m_rowpixels, texinfo.width_margin, rows, texinfo.palette, base, texinfo.persistent, pitch, width_div_factor, width_mul_factor);
+				texture->update_rows(mem, pitch, texinfo.width_margin, top, rows);
+			}
 
 			if (prim.m_prim->texture.palette)
 			{
@@ -31,6 +31,8 @@ class running_machine;
 class osd_window;
 struct slider_state;
 class slider_dirty_notifier;
+struct osd_work_queue;
+struct osd_work_item;
 class render_primitive;
 
 namespace ui { class menu_item; }
@@ -126,6 +128,11 @@ private:
 	void create_selection_slider(uint32_t screen_index);
 	bool needs_sliders();
 
+	static std::string chain_file_path(const std::string &bgfx_path, std::string name);
+	void start_preload();
+	static void *preload_callback(void *param, int threadid);
+	void warm_up_effects();
+
 	uint32_t count_screens(render_primitive* prim);
 	void process_screen_quad(uint32_t view, uint32_t screen, screen_prim &prim, osd_window& window);
 
@@ -148,11 +155,20 @@ private:
 	std::vector<int32_t>        m_current_chain;
 	std::vector<bgfx_texture*>  m_screen_textures;
 	std::vector<bgfx_texture*>  m_screen_palettes;
+	std::vector<uint64_t>       m_screen_ids;
+	std::vector<uint32_t>       m_screen_seqids;
 	std::vector<bgfx_effect*>   m_converters;
 	bgfx_effect *               m_adjuster;
 	std::vector<screen_prim>    m_screen_prims;
 	std::vector<uint8_t>        m_palette_temp;
 
+	osd_work_queue *            m_preload_queue;
+	osd_work_item *             m_preload_item;
+	std::string                 m_preload_bgfx_path;
+	std::string                 m_preload_shader_directory;
+	std::vector<std::string>    m_preload_chains;   // chain files, selected ones first
+	std::vector<std::string>    m_warm_effects;     // effects still to be created, set by the preload
+
 	static inline constexpr uint32_t CHAIN_NONE = 0;
 };
 
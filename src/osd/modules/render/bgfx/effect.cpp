@@ -55,6 +55,14 @@ void bgfx_effect::submit(int view, uint64_t blend)
 	bgfx::submit(view, m_program_handle);
 }
 
+void bgfx_effect::append_uniform_data(std::vector<uint8_t> &data) const
+{
+	for (auto &[name, uniform] : m_uniforms)
+	{
+		data.insert(data.end(), uniform->data(), uniform->data() + uniform->data_size());
+	}
+}
+
 bgfx_uniform* bgfx_effect::uniform(const std::string &name)
 {
 	const auto iter = m_uniforms.find(name);
@@ -29,6 +29,7 @@ public:
 
 	void submit(int view, uint64_t blend = ~0ULL);
 	bgfx_uniform *uniform(const std::string &name);
+	void append_uniform_data(std::vector<uint8_t> &data) const;
 	bool is_valid() const { return m_program_handle.idx != bgfx::kInvalidHandle; }
 
 private:
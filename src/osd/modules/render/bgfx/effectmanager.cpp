@@ -11,6 +11,7 @@
 
 #include "effectmanager.h"
 
+#include "assetcache.h"
 #include "effect.h"
 #include "effectreader.h"
 #include "shadermanager.h"
@@ -21,17 +22,13 @@
 #include "modules/lib/osdobj_common.h"
 
 #include <rapidjson/document.h>
-#include <rapidjson/error/en.h>
-
-#include <bx/readerwriter.h>
-#include <bx/file.h>
 
 #include <bgfx/bgfx.h>
 
 #include <utility>
 
 
-static bool prepare_effect_document(const std::string &name, const osd_options &options, rapidjson::Document &document)
+static std::string effect_path(const std::string &bgfx_path, const std::string &name)
 {
 	std::string full_name = name;
 	if (full_name.length() < 5 || (full_name.compare(full_name.length() - 5, 5, ".json") != 0))
@@ -39,40 +36,33 @@ static bool prepare_effect_document(const std::string &name, const osd_options &
 		full_name += ".json";
 	}
 
-	const std::string path = util::path_concat(options.bgfx_path(), "effects", full_name);
+	return util::path_concat(bgfx_path, "effects", full_name);
+}
 
-	bx::FileReader reader;
-	if (!bx::open(&reader, path.c_str()))
-	{
-		osd_printf_error("Unable to open effect file %s\n", path);
-		return false;
-	}
+static asset_cache::document_ptr prepare_effect_document(const std::string &name, const osd_options &options)
+{
+	const std::string path = effect_path(options.bgfx_path(), name);
 
-	const int32_t size = bx::getSize(&reader);
-	std::unique_ptr<char []> data(new (std::nothrow) char [size + 1]);
-	if (!data)
+	asset_cache::document_ptr document = asset_cache::get_document(path);
+	if (!document)
 	{
 		osd_printf_error("Out of memory reading effect file %s\n", path);
-		bx::close(&reader);
-		return false;
+		return nullptr;
 	}
 
-	bx::ErrorAssert err;
-	bx::read(&reader, reinterpret_cast<void*>(data.get()), size, &err);
-	bx::close(&reader);
-	data[size] = 0;
-
-	document.Parse<rapidjson::kParseCommentsFlag>(data.get());
-	data.reset();
-
-	if (document.HasParseError())
+	switch (document->result)
 	{
-		std::string error(rapidjson::GetParseError_En(document.GetParseError()));
-		osd_printf_error("Unable to parse effect %s. Errors returned:\n%s\n", path, error);
-		return false;
+	case asset_cache::status::OK:
+		return document;
+	case asset_cache::status::OPEN_FAILED:
+		osd_printf_error("Unable to open effect file %s\n", path);
+		return nullptr;
+	case asset_cache::status::PARSE_FAILED:
+		osd_printf_error("Unable to parse effect %s. Errors returned:\n%s\n", path, document->error);
+		return nullptr;
 	}
 
-	return true;
+	return nullptr;
 }
 
 
@@ -98,13 +88,13 @@ bgfx_effect* effect_manager::get_or_load_effect(const osd_options &options, cons
 
 bgfx_effect* effect_manager::load_effect(const osd_options &options, const std::string &name)
 {
-	rapidjson::Document document;
-	if (!prepare_effect_document(name, options, document))
+	asset_cache::document_ptr document = prepare_effect_document(name, options);
+	if (!document)
 	{
 		return nullptr;
 	}
 
-	std::unique_ptr<bgfx_effect> effect = effect_reader::read_from_value(name, document, "Effect '" + name + "': ", options, m_shaders);
+	std::unique_ptr<bgfx_effect> effect = effect_reader::read_from_value(name, document->json, "Effect '" + name + "': ", options, m_shaders);
 
 	if (!effect)
 	{
@@ -117,11 +107,29 @@ bgfx_effect* effect_manager::load_effect(const osd_options &options, const std::
 
 bool effect_manager::validate_effect(const osd_options &options, const std::string &name)
 {
-	rapidjson::Document document;
-	if (!prepare_effect_document(name, options, document))
+	asset_cache::document_ptr document = prepare_effect_document(name, options);
+	if (!document)
 	{
 		return false;
 	}
 
-	return effect_reader::validate_value(document, "Effect '" + name + "': ", options);
+	return effect_reader::validate_value(document->json, "Effect '" + name + "': ", options);
+}
+
+void effect_manager::preload_effect(const std::string &bgfx_path, const std::string &shader_directory, const std::string &name)
+{
+	// quietly, since errors are reported when the effect is really loaded
+	asset_cache::document_ptr document = asset_cache::get_document(effect_path(bgfx_path, name));
+	if (!document || (document->result != asset_cache::status::OK) || !document->json.IsObject())
+	{
+		return;
+	}
+
+	for (const char *shader : { "vertex", "fragment", "pixel" })
+	{
+		if (document->json.HasMember(shader) && document->json[shader].IsString())
+		{
+			shader_manager::preload_shader(shader_directory, document->json[shader].GetString());
+		}
+	}
 }
@@ -33,6 +33,9 @@ public:
 	bgfx_effect* get_or_load_effect(const osd_options &options, const std::string &name);
 	static bool validate_effect(const osd_options &options, const std::string &name);
 
+	// read an effect and its shaders into the asset cache ahead of use (any thread)
+	static void preload_effect(const std::string &bgfx_path, const std::string &shader_directory, const std::string &name);
+
 private:
 	bgfx_effect* load_effect(const osd_options &options, const std::string &name);
 
@@ -11,14 +11,14 @@
 
 #include "shadermanager.h"
 
+#include "assetcache.h"
+
 #include "emucore.h"
 
 #include "osdfile.h"
 #include "modules/lib/osdobj_common.h"
 
-#include <bx/file.h>
-#include <bx/math.h>
-#include <bx/readerwriter.h>
+#include <cstring>
 
 
 shader_manager::~shader_manager()
@@ -62,21 +62,12 @@ bgfx::ShaderHandle shader_manager::load_shader(const osd_options &options, const
 bool shader_manager::is_shader_present(const osd_options &options, const std::string &name)
 {
 	std::string shader_path = make_path_string(options, name);
-	std::string file_name = shader_path + name + ".bin";
-	bx::FileReader reader;
-	bx::ErrorAssert err;
-	if (bx::open(&reader, file_name.c_str()))
-	{
-		uint32_t expected_size(bx::getSize(&reader));
-		uint8_t *data = new uint8_t[expected_size];
-		uint32_t read_size = (uint32_t)bx::read(&reader, data, expected_size, &err);
-		delete [] data;
-		bx::close(&reader);
-
-		return expected_size == read_size;
-	}
+	return bool(asset_cache::get_binary(shader_path + name + ".bin"));
+}
 
-	return false;
+void shader_manager::preload_shader(const std::string &directory, const std::string &name)
+{
+	asset_cache::get_binary(directory + name + ".bin");
 }
 
 std::string shader_manager::make_path_string(const osd_options &options, const std::string &name)
@@ -133,14 +124,12 @@ std::string shader_manager::make_path_string(const osd_options &options, const s
 
 const bgfx::Memory* shader_manager::load_mem(const std::string &name)
 {
-	bx::FileReader reader;
-	if (bx::open(&reader, name.c_str()))
+	asset_cache::binary_ptr const data = asset_cache::get_binary(name);
+	if (data)
 	{
-		bx::ErrorAssert err;
-		uint32_t size(bx::getSize(&reader));
-		const bgfx::Memory* mem = bgfx::alloc(size + 1);
-		bx::read(&reader, mem->data, size, &err);
-		bx::close(&reader);
+		const bgfx::Memory* mem = bgfx::alloc(data->size() + 1);
+		if (!data->empty())
+			std::memcpy(mem->data, data->data(), data->size());
 
 		mem->data[mem->size - 1] = '\0';
 		return mem;
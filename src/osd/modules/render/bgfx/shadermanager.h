@@ -34,6 +34,10 @@ public:
 	static bgfx::ShaderHandle load_shader(const osd_options &options, const std::string &name);
 	static bool is_shader_present(const osd_options &options, const std::string &name);
 
+	// read a shader binary into the asset cache ahead of use (any thread)
+	static std::string shader_directory(const osd_options &options) { return make_path_string(options, std::string()); }
+	static void preload_shader(const std::string &directory, const std::string &name);
+
 private:
 	static std::string make_path_string(const osd_options &options, const std::string &name);
 	static const bgfx::Memory* load_mem(const std::string &name);
@@ -26,6 +26,7 @@ bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uin
 	, m_scale(scale)
 	, m_screen(screen)
 	, m_current_page(0)
+	, m_version(next_version())
 	, m_initialized(false)
 	, m_page_count(double_buffer ? 2 : 1)
 {
@@ -73,6 +74,7 @@ bgfx_target::bgfx_target(void *handle, uint16_t width, uint16_t height)
 	, m_scale(0)
 	, m_screen(-1)
 	, m_current_page(0)
+	, m_version(next_version())
 	, m_initialized(true)
 	, m_page_count(0)
 {
@@ -111,6 +113,9 @@ void bgfx_target::page_flip()
 {
 	if (!m_initialized) return;
 
+	// called after each pass that renders into the target
+	m_version = next_version();
+
 	if (m_double_buffer)
 	{
 		m_current_page = 1 - m_current_page;
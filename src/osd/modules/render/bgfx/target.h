@@ -55,6 +55,7 @@ public:
 	virtual uint16_t rowpixels() const override { return m_width * m_xprescale; }
 	virtual int width_div_factor() const override { return 1; }
 	virtual int width_mul_factor() const override { return 1; }
+	virtual uint64_t version() const override { return m_version; }
 
 private:
 	std::string                 m_name;
@@ -77,6 +78,7 @@ private:
 	int32_t                     m_screen;
 
 	uint32_t                    m_current_page;
+	uint64_t                    m_version;
 
 	bool                        m_initialized;
 
@@ -19,6 +19,7 @@ bgfx_texture::bgfx_texture(std::string name, bgfx::TextureFormat::Enum format, u
 	, m_rowpixels(width)
 	, m_width_div_factor(1)
 	, m_width_mul_factor(1)
+	, m_version(next_version())
 {
 	bgfx::TextureInfo info;
 	bgfx::calcTextureSize(info, width, height, 1, false, false, 1, format);
@@ -45,6 +46,7 @@ bgfx_texture::bgfx_texture(std::string name, bgfx::TextureFormat::Enum format, u
 	, m_rowpixels(rowpixels ? rowpixels : width)
 	, m_width_div_factor(width_div_factor)
 	, m_width_mul_factor(width_mul_factor)
+	, m_version(next_version())
 {
 	int adjusted_width = (m_rowpixels * m_width_mul_factor) / m_width_div_factor;
 	bgfx::TextureInfo info;
@@ -61,5 +63,13 @@ bgfx_texture::~bgfx_texture()
 void bgfx_texture::update(const bgfx::Memory *data, uint16_t pitch, uint16_t width_margin)
 {
 	m_width_margin = width_margin;
+	m_version = next_version();
 	bgfx::updateTexture2D(m_texture, 0, 0, 0, 0, (m_rowpixels * m_width_mul_factor) / m_width_div_factor, m_height, data, pitch);
 }
+
+void bgfx_texture::update_rows(const bgfx::Memory *data, uint16_t pitch, uint16_t width_margin, uint16_t top, uint16_t rows)
+{
+	m_width_margin = width_margin;
+	m_version = next_version();
+	bgfx::updateTexture2D(m_texture, 0, 0, 0, top, (m_rowpixels * m_width_mul_factor) / m_width_div_factor, rows, data, pitch);
+}
@@ -37,8 +37,10 @@ public:
 	virtual uint16_t rowpixels() const override { return m_rowpixels; }
 	virtual int width_div_factor() const override { return m_width_div_factor; }
 	virtual int width_mul_factor() const override { return m_width_mul_factor; }
+	virtual uint64_t version() const override { return m_version; }
 
 	void update(const bgfx::Memory *data, uint16_t pitch = UINT16_MAX, uint16_t width_margin = 0);
+	void update_rows(const bgfx::Memory *data, uint16_t pitch, uint16_t width_margin, uint16_t top, uint16_t rows);
 
 protected:
 	std::string                 m_name;
@@ -50,6 +52,7 @@ protected:
 	int                         m_width_div_factor;
 	int                         m_width_mul_factor;
 	bgfx::TextureHandle         m_texture;
+	uint64_t                    m_version;
 };
 
 #endif // __DRAWBGFX_TEXTURE__
@@ -28,6 +28,13 @@ public:
 	virtual uint16_t rowpixels() const = 0;
 	virtual int width_div_factor() const = 0;
 	virtual int width_mul_factor() const = 0;
+
+	// Changes whenever the contents of the texture may have changed; never
+	// repeats, even across different providers
+	virtual uint64_t version() const = 0;
+
+protected:
+	static uint64_t next_version() { static uint64_t s_version = 0; return ++s_version; }
 };
 
 #endif // MAME_RENDER_BGFX_TEXTUREHANDLEPROVIDER_H
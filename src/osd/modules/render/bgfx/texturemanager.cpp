@@ -150,7 +150,7 @@ bgfx::TextureHandle texture_manager::create_or_update_mame_texture(
 					uint16_t pitch = width;
 					int width_div_factor = 1;
 					int width_mul_factor = 1;
-					const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, format, rowpixels, width_margin, height, palette, base, pitch, width_div_factor, width_mul_factor);
+					const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, format, rowpixels, width_margin, height, palette, base, false, pitch, width_div_factor, width_mul_factor);
 					bgfx::updateTexture2D(handle, 0, 0, 0, 0, uint16_t((rowpixels * width_mul_factor) / width_div_factor), uint16_t(height), mem, pitch);
 					return handle;
 				}
@@ -180,7 +180,7 @@ bgfx::TextureHandle texture_manager::create_or_update_mame_texture(
 					uint16_t pitch = width;
 					int width_div_factor = 1;
 					int width_mul_factor = 1;
-					const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, format, rowpixels, width_margin, height, palette, base, pitch, width_div_factor, width_mul_factor);
+					const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, format, rowpixels, width_margin, height, palette, base, false, pitch, width_div_factor, width_mul_factor);
 					bgfx::updateTexture2D(handle, 0, 0, 0, 0, uint16_t((rowpixels * width_mul_factor) / width_div_factor), uint16_t(height), mem, pitch);
 					return handle;
 				}
@@ -193,7 +193,7 @@ bgfx::TextureHandle texture_manager::create_or_update_mame_texture(
 	uint16_t pitch = width;
 	int width_div_factor = 1;
 	int width_mul_factor = 1;
-	const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, format, rowpixels, width_margin, height, palette, base, pitch, width_div_factor, width_mul_factor);
+	const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, format, rowpixels, width_margin, height, palette, base, false, pitch, width_div_factor, width_mul_factor);
 	const uint16_t adjusted_width = uint16_t((rowpixels * width_mul_factor) / width_div_factor);
 	handle = bgfx::createTexture2D(adjusted_width, height, false, 1, dst_format, flags, nullptr);
 	bgfx::updateTexture2D(handle, 0, 0, 0, 0, adjusted_width, uint16_t(height), mem, pitch);
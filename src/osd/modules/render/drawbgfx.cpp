@@ -748,38 +748,20 @@ void renderer_bgfx::put_packed_quad(render_primitive *prim, uint32_t hash, Scree
 {
 	rectangle_packer::packed_rectangle& rect = m_hash_to_entry[hash];
 	auto size = float(CACHE_SIZE);
-	float u0 = (float(rect.x()) + 0.5f) / size;
-	float v0 = (float(rect.y()) + 0.5f) / size;
-	float u1 = u0 + (float(rect.width()) - 1.0f) / size;
-	float v1 = v0 + (float(rect.height()) - 1.0f) / size;
 	uint32_t rgba = u32Color(prim->color.r * 255, prim->color.g * 255, prim->color.b * 255, prim->color.a * 255);
 
+	// map the primitive's texture coordinates into its cell, which already
+	// accounts for orientation, clipping and scroll position
+	float ubase = (float(rect.x()) + 0.5f) / size;
+	float vbase = (float(rect.y()) + 0.5f) / size;
+	float uscale = (float(rect.width()) - 1.0f) / size;
+	float vscale = (float(rect.height()) - 1.0f) / size;
+	render_quad_texuv const &tc = prim->texcoords;
+
 	float x[4] = { prim->bounds.x0, prim->bounds.x1, prim->bounds.x0, prim->bounds.x1 };
 	float y[4] = { prim->bounds.y0, prim->bounds.y0, prim->bounds.y1, prim->bounds.y1 };
-	float u[4] = { u0, u1, u0, u1 };
-	float v[4] = { v0, v0, v1, v1 };
-
-	if (PRIMFLAG_GET_TEXORIENT(prim->flags) & ORIENTATION_SWAP_XY)
-	{
-		std::swap(u[1], u[2]);
-		std::swap(v[1], v[2]);
-	}
-
-	if (PRIMFLAG_GET_TEXORIENT(prim->flags) & ORIENTATION_FLIP_X)
-	{
-		std::swap(u[0], u[1]);
-		std::swap(v[0], v[1]);
-		std::swap(u[2], u[3]);
-		std::swap(v[2], v[3]);
-	}
-
-	if (PRIMFLAG_GET_TEXORIENT(prim->flags) & ORIENTATION_FLIP_Y)
-	{
-		std::swap(u[0], u[2]);
-		std::swap(v[0], v[2]);
-		std::swap(u[1], u[3]);
-		std::swap(v[1], v[3]);
-	}
+	float u[4] = { ubase + tc.tl.u * uscale, ubase + tc.tr.u * uscale, ubase + tc.bl.u * uscale, ubase + tc.br.u * uscale };
+	float v[4] = { vbase + tc.tl.v * vscale, vbase + tc.tr.v * vscale, vbase + tc.bl.v * vscale, vbase + tc.br.v * vscale };
 
 	vertex(&vertices[0], x[0], y[0], 0, rgba, u[0], v[0]);
 	vertex(&vertices[1], x[1], y[1], 0, rgba, u[1], v[1]);
@@ -1518,7 +1500,7 @@ void renderer_bgfx::process_atlas_packs(std::vector<std::vector<rectangle_packer
 			uint16_t pitch = rect.width();
 			int width_div_factor = 1;
 			int width_mul_factor = 1;
-			const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, rect.format(), rect.rowpixels(), 0, rect.height(), rect.palette(), rect.base(), pitch, width_div_factor, width_mul_factor);
+			const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, rect.format(), rect.rowpixels(), 0, rect.height(), rect.palette(), rect.base(), false, pitch, width_div_factor, width_mul_factor);
 			bgfx::updateTexture2D(m_texture_cache->texture(), 0, 0, rect.x(), rect.y(), (rect.width() * width_mul_factor) / width_div_factor, rect.height(), mem, pitch);
 		}
 	}
@@ -1548,7 +1530,8 @@ uint32_t renderer_bgfx::get_texture_hash(render_primitive *prim)
 	return hash;
 #else
 	//return (reinterpret_cast<size_t>(prim->texture.base)) & 0xffffffff;
-	return (reinterpret_cast<size_t>(prim->texture.base) ^ reinterpret_cast<size_t>(prim->texture.palette)) & 0xffffffff;
+	// the sequence number changes when a shared page (e.g. glyphs) gets new content
+	return (reinterpret_cast<size_t>(prim->texture.base) ^ reinterpret_cast<size_t>(prim->texture.palette) ^ (size_t(prim->texture.seqid) * 0x9e3779b9U)) & 0xffffffff;
 #endif
 }
 
@@ -292,6 +292,10 @@ public:
 	virtual int create() override;
 	virtual int draw(const int update) override;
 
+	// every use of the context makes it current first
+	virtual bool can_draw_on_thread() const override { return true; }
+	virtual void release_thread() override { if (m_gl_context) m_gl_context->release_current(); }
+
 #ifndef OSD_WINDOWS
 	virtual int xy_to_render_target(const int x, const int y, int *xt, int *yt) override;
 #endif
@@ -343,7 +347,7 @@ private:
 
 	int gl_checkFramebufferStatus() const;
 	int texture_fbo_create(uint32_t text_unit, uint32_t text_name, uint32_t fbo_name, int width, int height) const;
-	void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags) const;
+	void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, bool rows_only = false) const;
 
 	int gl_check_error(bool log, const char *file, int line) const
 	{
@@ -2447,8 +2451,21 @@ static inline void copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *src, in
 //  texture_set_data
 //============================================================
 
-void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags) const
+void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, bool rows_only) const
 {
+	// if the core says which rows changed since the copy we hold, only convert
+	// and upload those (a mapped PBO has to be refilled in full)
+	const bool partial = rows_only && texture->type != TEXTURE_TYPE_DYNAMIC;
+	int ystart = 0;
+	int yend = texsource->height;
+	if (partial)
+	{
+		if (texsource->dirty.empty())
+			return;
+		ystart = texsource->dirty.top();
+		yend = texsource->dirty.bottom() + 1;
+	}
+
 	if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
 		assert(texture->pbo);
@@ -2466,7 +2483,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the top
-	if (texture->borderpix)
+	if (texture->borderpix && !partial)
 	{
 		memset(texture->data, 0,
 				(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
@@ -2478,7 +2495,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 		int y, y2;
 		uint8_t *dst;
 
-		for (y = 0; y < texsource->height; y++)
+		for (y = ystart; y < yend; y++)
 		{
 			for (y2 = 0; y2 < texture->yprescale; y2++)
 			{
@@ -2511,7 +2528,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the bottom
-	if (texture->borderpix)
+	if (texture->borderpix && !partial)
 	{
 		memset((uint8_t *)texture->data +
 				(texsource->height + 1) * texture->rawwidth * sizeof(uint32_t),
@@ -2519,6 +2536,10 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
 	}
 
+	const int firstrow = partial ? (ystart * texture->yprescale + texture->borderpix) : 0;
+	const int rowcount = partial ? ((yend - ystart) * texture->yprescale) : texture->rawheight;
+	uint32_t *const rowdata = texture->data + firstrow * (texture->nocopy ? texture->texinfo.rowpixels : texture->rawwidth);
+
 	if ( texture->type == TEXTURE_TYPE_SHADER )
 	{
 		m_glActiveTexture(GL_TEXTURE0);
@@ -2530,8 +2551,8 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		glTexSubImage2D(texture->texTarget, 0, 0, firstrow, texture->rawwidth, rowcount,
+				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, rowdata);
 	}
 	else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
@@ -2557,8 +2578,8 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		glTexSubImage2D(texture->texTarget, 0, 0, firstrow, texture->rawwidth, rowcount,
+						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, rowdata);
 	}
 }
 
@@ -2820,10 +2841,11 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		{
 			if (prim->texture.base != nullptr && texture->texinfo.seqid != prim->texture.seqid)
 			{
+				const bool rows_only = prim->texture.dirty_seqid != 0 && texture->texinfo.seqid == prim->texture.dirty_seqid;
 				texture->texinfo.seqid = prim->texture.seqid;
 
 				// if we found it, but with a different seqid, copy the data
-				texture_set_data(texture, &prim->texture, prim->flags);
+				texture_set_data(texture, &prim->texture, prim->flags, rows_only);
 				texBound=1;
 			}
 		}
@@ -51,6 +51,11 @@ public:
 		SDL_GL_MakeCurrent(m_window, m_context);
 	}
 
+	virtual void release_current() override
+	{
+		SDL_GL_MakeCurrent(m_window, nullptr);
+	}
+
 	virtual bool set_swap_interval(const int swap) override
 	{
 		return 0 == SDL_GL_SetSwapInterval(swap);
@@ -6,6 +6,12 @@
 
     Shim for native JavaScript sound interface implementations (Emscripten only).
 
+    With WebAssembly threads the heap is a SharedArrayBuffer, so samples
+    go into a ring buffer on the heap that an AudioWorklet reads directly,
+    with no call into JavaScript per frame.  The read and write positions
+    are atomics shared with the worklet.
+
+
 ****************************************************************************/
 
 #include "sound_module.h"
@@ -15,22 +21,75 @@
 
 #include "emscripten.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
 class sound_js : public osd_module, public sound_module
 {
 public:
 
-	sound_js() : osd_module(OSD_SOUND_PROVIDER, "js"), sound_module()
+	sound_js() : osd_module(OSD_SOUND_PROVIDER, "js"), sound_module(), m_ring_frames(0), m_read(0), m_write(0)
 	{
 	}
 	virtual ~sound_js() { }
 
-	virtual int init(osd_interface &osd, const osd_options &options) { return 0; }
-	virtual void exit() { }
+	virtual int init(osd_interface &osd, const osd_options &options)
+	{
+#if defined(__EMSCRIPTEN_PTHREADS__)
+		m_ring = std::make_unique<int16_t []>(RING_FRAMES * 2);
+		int const attached = EM_ASM_INT(
+				{
+					// Fall back to per-frame updates if the JS backend can't use an AudioWorklet.
+					return jsmame_attach_audio_ring($0, $1, $2, $3);
+				},
+				(unsigned int)m_ring.get(),
+				RING_FRAMES,
+				(unsigned int)&m_read,
+				(unsigned int)&m_write);
+		if (attached)
+			m_ring_frames = RING_FRAMES;
+		else
+			m_ring.reset();
+#endif
+		return 0;
+	}
+
+	virtual void exit()
+	{
+		if (m_ring_frames)
+		{
+			EM_ASM(
+					{
+						jsmame_detach_audio_ring();
+					});
+			m_ring_frames = 0;
+			m_ring.reset();
+		}
+	}
 
 	// sound_module
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame)
 	{
+		if (m_ring_frames)
+		{
+			// only the worklet moves the read position, so drop what doesn't fit
+			uint32_t const read = m_read.load(std::memory_order_acquire);
+			uint32_t write = m_write.load(std::memory_order_relaxed);
+			uint32_t remaining = std::min<uint32_t>(samples_this_frame, (read + m_ring_frames - write - 1) % m_ring_frames);
+			while (remaining)
+			{
+				uint32_t const chunk = std::min(remaining, m_ring_frames - write);
+				std::copy_n(buffer, chunk * 2, &m_ring[write * 2]);
+				buffer += chunk * 2;
+				remaining -= chunk;
+				write = (write + chunk) % m_ring_frames;
+			}
+			m_write.store(write, std::memory_order_release);
+			return;
+		}
+
 		EM_ASM_ARGS(
 				{
 					// Forward audio stream update on to JS backend implementation.
@@ -49,6 +108,14 @@ public:
 				},
 				attenuation);
 	}
+
+private:
+	static constexpr uint32_t RING_FRAMES = 8192;
+
+	std::unique_ptr<int16_t []> m_ring;         // interleaved stereo samples
+	uint32_t                    m_ring_frames;  // ring size, or zero when not using the worklet
+	std::atomic<uint32_t>       m_read;         // next frame the worklet will play
+	std::atomic<uint32_t>       m_write;        // next frame we'll fill
 };
 
 #else // SDLMAME_EMSCRIPTEN
@@ -21,6 +21,8 @@ var start = 0;
 var rear = 0;
 var watchDogDateLast = null;
 var watchDogTimerEvent = null;
+var ring = null;
+var workletNode = null;
 
 function lazy_init () {
 	//Make
@@ -46,8 +48,86 @@ function lazy_init () {
 	gain_node.gain.value = 1.0;
 	//Connect volume node to output:
 	gain_node.connect(context.destination);
-	//Initialize the streaming event:
-	init_event();
+	//Initialize the streaming event, reading the emulator's ring buffer directly if we can:
+	if (ring && context.audioWorklet) {
+		init_worklet();
+	}
+	else {
+		ring = null;
+		init_event();
+	}
+};
+
+//Runs in the AudioWorkletGlobalScope, so it can't see anything else in here:
+function worklet_main() {
+	class JSMAMERingProcessor extends AudioWorkletProcessor {
+		constructor(options) {
+			super();
+			var o = options.processorOptions;
+			this.samples = new Int16Array(o.buffer, o.ring, o.frames * 2);
+			this.readIndex = new Uint32Array(o.buffer, o.read, 1);
+			this.writeIndex = new Uint32Array(o.buffer, o.write, 1);
+			this.frames = o.frames;
+			this.lastLeft = 0;
+			this.lastRight = 0;
+			this.running = true;
+			var self = this;
+			this.port.onmessage = function (event) {
+				if (event.data == "stop") {
+					self.running = false;
+				}
+			};
+		}
+
+		process(inputs, outputs) {
+			var left = outputs[0][0];
+			var right = outputs[0][1];
+			var read = Atomics.load(this.readIndex, 0);
+			var write = Atomics.load(this.writeIndex, 0);
+			var index = 0;
+			for (; index < left.length && read != write; ++index) {
+				this.lastLeft = left[index] = this.samples[read * 2] / 32766;
+				this.lastRight = right[index] = this.samples[(read * 2) + 1] / 32766;
+				if (++read == this.frames) {
+					read = 0;
+				}
+			}
+			Atomics.store(this.readIndex, 0, read);
+			//Pad with latest if we're underrunning:
+			for (; index < left.length; ++index) {
+				left[index] = this.lastLeft;
+				right[index] = this.lastRight;
+			}
+			return this.running;
+		}
+	}
+	registerProcessor("jsmame-ring", JSMAMERingProcessor);
+};
+
+function init_worklet() {
+	var source = "(" + worklet_main.toString() + ")();";
+	var url = URL.createObjectURL(new Blob([source], { type: "application/javascript" }));
+	context.audioWorklet.addModule(url).then(function () {
+		//The emulator may have gone away while the module was loading:
+		if (!ring) {
+			return;
+		}
+		workletNode = new AudioWorkletNode(context, "jsmame-ring", {
+			numberOfInputs: 0,
+			numberOfOutputs: 1,
+			outputChannelCount: [2],
+			processorOptions: ring
+		});
+		workletNode.connect(gain_node);
+	});
+	//The worklet doesn't need the Firefox watchdog, but still has to get past autoplay restrictions:
+	if (watchDogTimerEvent === null) {
+		watchDogTimerEvent = setInterval(function () {
+			if (context.state == "suspended") {
+				context.resume();
+			}
+		}, 500);
+	}
 };
 
 function init_event() {
@@ -187,6 +267,37 @@ function tick (event) {
 	watchDogDateLast = (new Date()).getTime();
 }
 
+function attach_audio_ring (
+	pRing,   // pointer into emscripten heap. interleaved int16 samples
+	frames,  // int. number of stereo frames in the ring
+	pRead,   // pointer to uint32 index of the next frame to play
+	pWrite   // pointer to uint32 index of the next frame the emulator fills
+) {
+	//The worklet can only share the heap if it's a SharedArrayBuffer, and
+	//we can't switch over once the script processor is running:
+	if (context || (typeof AudioWorkletNode == "undefined") ||
+			(typeof SharedArrayBuffer == "undefined") || !(HEAP16.buffer instanceof SharedArrayBuffer)) {
+		return 0;
+	}
+	//The heap can be replaced by a bigger buffer when memory grows, but the
+	//old one stays valid for everything that was in it, including the ring:
+	ring = { buffer: HEAP16.buffer, ring: pRing, frames: frames, read: pRead, write: pWrite };
+	lazy_init();
+	if (!context) {
+		ring = null;
+	}
+	return ring ? 1 : 0;
+};
+
+function detach_audio_ring() {
+	ring = null;
+	if (workletNode) {
+		workletNode.port.postMessage("stop");
+		workletNode.disconnect();
+		workletNode = null;
+	}
+};
+
 function get_context() {
 	return context;
 };
@@ -209,6 +320,8 @@ function sample_count() {
 return {
 	set_mastervolume: set_mastervolume,
 	update_audio_stream: update_audio_stream,
+	attach_audio_ring: attach_audio_ring,
+	detach_audio_ring: detach_audio_ring,
 	get_context: get_context,
 	sample_count: sample_count
 };
@@ -217,4 +330,6 @@ return {
 
 window.jsmame_set_mastervolume = jsmame_web_audio.set_mastervolume;
 window.jsmame_update_audio_stream = jsmame_web_audio.update_audio_stream;
+window.jsmame_attach_audio_ring = jsmame_web_audio.attach_audio_ring;
+window.jsmame_detach_audio_ring = jsmame_web_audio.detach_audio_ring;
 window.jsmame_sample_count = jsmame_web_audio.sample_count;
@@ -9,6 +9,7 @@
 //============================================================
 
 #include "sound_module.h"
+#include "sound_ring.h"
 
 #include "modules/osdmodule.h"
 
@@ -21,6 +22,7 @@
 #include <SDL2/SDL.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <fstream>
 #include <memory>
@@ -56,9 +58,10 @@ public:
 		sdl_xfer_samples(SDL_XFER_SAMPLES),
 		stream_in_initialized(0),
 		attenuation(0),
-		buf_locked(0),
+		gain(1.0f),
 		stream_buffer(nullptr),
-		stream_buffer_size(0),
+		stream_buffer_target(0),
+		stream_buffer_limit(0),
 		buffer_underflows(0),
 		buffer_overflows(0)
 	{
@@ -72,30 +75,11 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool buffer_status(int &fill, int &target) override;
 
 private:
-	class ring_buffer
-	{
-	public:
-		ring_buffer(size_t size);
-
-		size_t data_size() const { return (tail - head + buffer_size) % buffer_size; }
-		size_t free_size() const { return (head - tail - 1 + buffer_size) % buffer_size; }
-		int append(const void *data, size_t size);
-		int pop(void *data, size_t size);
-
-	private:
-		std::unique_ptr<int8_t []> const buffer;
-		size_t const buffer_size;
-		int head = 0, tail = 0;
-	};
-
 	static void sdl_callback(void *userdata, Uint8 *stream, int len);
 
-	void lock_buffer();
-	void unlock_buffer();
-	void attenuate(int16_t *data, int bytes);
-	void copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy);
 	int sdl_create_buffers();
 	void sdl_destroy_buffers();
 
@@ -103,14 +87,16 @@ private:
 	int sdl_xfer_samples;
 	int stream_in_initialized;
 	int attenuation;
+	std::atomic<float> gain;
 
-	int              buf_locked;
-	std::unique_ptr<ring_buffer> stream_buffer;
-	uint32_t         stream_buffer_size;
+	// frames written by update_audio_stream and played by the callback
+	std::unique_ptr<sound_ring> stream_buffer;
+	uint32_t         stream_buffer_target;
+	uint32_t         stream_buffer_limit;
 
 
 	// diagnostics
-	int              buffer_underflows;
+	std::atomic<int> buffer_underflows;
 	int              buffer_overflows;
 	std::unique_ptr<std::ofstream> sound_log;
 };
@@ -123,129 +109,6 @@ private:
 // maximum audio latency
 #define MAX_AUDIO_LATENCY       5
 
-//============================================================
-//  ring_buffer - constructor
-//============================================================
-
-sound_sdl::ring_buffer::ring_buffer(size_t size)
-	: buffer(std::make_unique<int8_t []>(size + 1)), buffer_size(size + 1)
-{
-	// A size+1 bytes buffer is allocated because it can never be full.
-	// Otherwise the case head == tail couldn't be distinguished between a
-	// full buffer and an empty buffer.
-	std::fill_n(buffer.get(), size + 1, 0);
-}
-
-//============================================================
-//  ring_buffer::append
-//============================================================
-
-int sound_sdl::ring_buffer::append(const void *data, size_t size)
-{
-	if (free_size() < size)
-		return -1;
-
-	int8_t const *const data8 = reinterpret_cast<int8_t const *>(data);
-	size_t sz = buffer_size - tail;
-	if (size <= sz)
-		sz = size;
-	else
-		std::copy_n(&data8[sz], size - sz, &buffer[0]);
-
-	std::copy_n(data8, sz, &buffer[tail]);
-	tail = (tail + size) % buffer_size;
-
-	return 0;
-}
-
-//============================================================
-//  ring_buffer::pop
-//============================================================
-
-int sound_sdl::ring_buffer::pop(void *data, size_t size)
-{
-	if (data_size() < size)
-		return -1;
-
-	int8_t *const data8 = reinterpret_cast<int8_t *>(data);
-	size_t sz = buffer_size - head;
-	if (size <= sz)
-		sz = size;
-	else
-	{
-		std::copy_n(&buffer[0], size - sz, &data8[sz]);
-		std::fill_n(&buffer[0], size - sz, 0);
-	}
-
-	std::copy_n(&buffer[head], sz, data8);
-	std::fill_n(&buffer[head], sz, 0);
-	head = (head + size) % buffer_size;
-
-	return 0;
-}
-
-//============================================================
-//  sound_sdl - destructor
-//============================================================
-
-//============================================================
-//  lock_buffer
-//============================================================
-void sound_sdl::lock_buffer()
-{
-	if (!buf_locked)
-		SDL_LockAudio();
-	buf_locked++;
-
-	if (LOG_SOUND)
-		*sound_log << "locking\n";
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer()
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
-
-	if (LOG_SOUND)
-		*sound_log << "unlocking\n";
-
-}
-
-//============================================================
-//  Apply attenuation
-//============================================================
-
-void sound_sdl::attenuate(int16_t *data, int bytes_to_copy)
-{
-	int level = (int) (pow(10.0, (double) attenuation / 20.0) * 128.0);
-	int count = bytes_to_copy / sizeof(*data);
-	while (count > 0)
-	{
-		*data = (*data * level) >> 7; /* / 128 */
-		data++;
-		count--;
-	}
-}
-
-//============================================================
-//  copy_sample_data
-//============================================================
-
-void sound_sdl::copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy)
-{
-	lock_buffer();
-	int const err = stream_buffer->append(data, bytes_to_copy);
-	unlock_buffer();
-
-	if (LOG_SOUND && err)
-		*sound_log << "Late detection of overflow. This shouldn't happen.\n";
-}
-
-
 //============================================================
 //  update_audio_stream
 //============================================================
@@ -258,34 +121,28 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 
 	if (!stream_in_initialized)
 	{
-		// Fill in some zeros to prevent an initial buffer underflow
-		int8_t zero = 0;
-		size_t zsize = stream_buffer->free_size() / 2;
-		while (zsize--)
-			stream_buffer->append(&zero, 1);
+		// fill in silence up to the target to prevent an initial buffer underflow
+		stream_buffer->write_silence(stream_buffer_target);
 
 		// start playing
 		SDL_PauseAudio(0);
 		stream_in_initialized = 1;
 	}
 
-	size_t bytes_this_frame = samples_this_frame * sizeof(*buffer) * 2;
-	size_t free_size = stream_buffer->free_size();
-	size_t data_size = stream_buffer->data_size();
-
-	if (stream_buffer->free_size() < bytes_this_frame) {
+	// never queue more than the limit, so latency can't build up
+	uint32_t const fill = stream_buffer->fill();
+	if (fill + samples_this_frame > stream_buffer_limit)
+	{
 		if (LOG_SOUND)
-			util::stream_format(*sound_log, "Overflow: DS=%u FS=%u BTF=%u\n", data_size, free_size, bytes_this_frame);
+			util::stream_format(*sound_log, "Overflow: fill=%u limit=%u frames=%d\n", fill, stream_buffer_limit, samples_this_frame);
 		buffer_overflows++;
 		return;
 	}
 
-	copy_sample_data(is_throttled, buffer, bytes_this_frame);
+	stream_buffer->write(buffer, samples_this_frame);
 
-	size_t nfree_size = stream_buffer->free_size();
-	size_t ndata_size = stream_buffer->data_size();
 	if (LOG_SOUND)
-		util::stream_format(*sound_log, "Appended data: DS=%u(%u) FS=%u(%u) BTF=%u\n", data_size, ndata_size, free_size, nfree_size, bytes_this_frame);
+		util::stream_format(*sound_log, "Appended data: fill=%u(%u) frames=%d\n", fill, stream_buffer->fill(), samples_this_frame);
 }
 
 
@@ -298,6 +155,7 @@ void sound_sdl::set_mastervolume(int _attenuation)
 {
 	// clamp the attenuation to 0-32 range
 	attenuation = std::clamp(_attenuation, -32, 0);
+	gain.store(float(pow(10.0, double(attenuation) / 20.0)), std::memory_order_relaxed);
 
 	if (stream_in_initialized)
 	{
@@ -314,28 +172,33 @@ void sound_sdl::set_mastervolume(int _attenuation)
 void sound_sdl::sdl_callback(void *userdata, Uint8 *stream, int len)
 {
 	sound_sdl *thiz = reinterpret_cast<sound_sdl *>(userdata);
-	size_t const free_size = thiz->stream_buffer->free_size();
-	size_t const data_size = thiz->stream_buffer->data_size();
+	float *const data = reinterpret_cast<float *>(stream);
+	uint32_t const frames = len / (sizeof(float) * 2);
 
-	if (data_size < len)
+	// play whatever is there and pad with silence
+	uint32_t const played = thiz->stream_buffer->read(data, frames, thiz->gain.load(std::memory_order_relaxed));
+	if (played < frames)
 	{
 		thiz->buffer_underflows++;
-		if (LOG_SOUND)
-			util::stream_format(*thiz->sound_log, "Underflow at sdl_callback: DS=%u FS=%u Len=%d\n", data_size, free_size, len);
-
-		// Maybe read whatever is left in the stream_buffer anyway?
-		memset(stream, 0, len);
-		return;
+		std::fill(data + played * 2, data + frames * 2, 0.0f);
 	}
 
-	int err = thiz->stream_buffer->pop((void *)stream, len);
-	if (LOG_SOUND && err)
-		*thiz->sound_log << "Late detection of underflow. This shouldn't happen.\n";
+	if (LOG_SOUND)
+		util::stream_format(*thiz->sound_log, "callback: xfer played=%u frames=%u\n", played, frames);
+}
 
-	thiz->attenuate((int16_t *)stream, len);
 
-	if (LOG_SOUND)
-		util::stream_format(*thiz->sound_log, "callback: xfer DS=%u FS=%u Len=%d\n", data_size, free_size, len);
+//============================================================
+//  buffer_status
+//============================================================
+
+bool sound_sdl::buffer_status(int &fill, int &target)
+{
+	if (!stream_buffer)
+		return false;
+	fill = stream_buffer->fill();
+	target = stream_buffer_target;
+	return true;
 }
 
 
@@ -347,6 +210,7 @@ int sound_sdl::init(osd_interface &osd, const osd_options &options)
 {
 	int         n_channels = 2;
 	int         audio_latency;
+	float       audio_target;
 	SDL_AudioSpec   aspec, obtained;
 
 	if (LOG_SOUND)
@@ -366,12 +230,17 @@ int sound_sdl::init(osd_interface &osd, const osd_options &options)
 		char const *const audio_driver = SDL_GetCurrentAudioDriver();
 		osd_printf_verbose("Audio: Driver is %s\n", audio_driver ? audio_driver : "not initialized");
 
+		// a low latency target needs callbacks small enough to keep up with it
+		audio_target = std::clamp(options.audio_target(), 0.0f, 200.0f);
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
+		if (audio_target > 0.0f)
+			while (sdl_xfer_samples > 64 && sdl_xfer_samples * 2 > int(sample_rate * audio_target / 1000.0f))
+				sdl_xfer_samples >>= 1;
 		stream_in_initialized = 0;
 
 		// set up the audio specs
 		aspec.freq = sample_rate;
-		aspec.format = AUDIO_S16SYS;    // keep endian independent
+		aspec.format = AUDIO_F32SYS;    // keep endian independent
 		aspec.channels = n_channels;
 		aspec.samples = sdl_xfer_samples;
 		aspec.callback = sdl_callback;
@@ -383,16 +252,29 @@ int sound_sdl::init(osd_interface &osd, const osd_options &options)
 		osd_printf_verbose("Audio: frequency: %d, channels: %d, samples: %d\n",
 							obtained.freq, obtained.channels, obtained.samples);
 
-		sdl_xfer_samples = obtained.samples;
+		// the ring holds interleaved stereo float frames
+		if (obtained.format != AUDIO_F32SYS || obtained.channels != n_channels)
+		{
+			SDL_CloseAudio();
+			goto cant_start_audio;
+		}
 
-		// pin audio latency
-		audio_latency = std::clamp(options.audio_latency(), 1, MAX_AUDIO_LATENCY);
+		sdl_xfer_samples = obtained.samples;
 
-		// compute the buffer sizes
-		stream_buffer_size = (sample_rate * 2 * sizeof(int16_t) * (2 + audio_latency)) / 30;
-		stream_buffer_size = (stream_buffer_size / 1024) * 1024;
-		if (stream_buffer_size < 1024)
-			stream_buffer_size = 1024;
+		// compute the buffer sizes in frames: aim for the target and allow up
+		// to one more target plus a callback's worth before dropping frames
+		if (audio_target > 0.0f)
+		{
+			stream_buffer_target = std::max(uint32_t(sample_rate * audio_target / 1000.0f), uint32_t(sdl_xfer_samples));
+			stream_buffer_limit = 2 * stream_buffer_target + sdl_xfer_samples;
+		}
+		else
+		{
+			// pin audio latency
+			audio_latency = std::clamp(options.audio_latency(), 1, MAX_AUDIO_LATENCY);
+			stream_buffer_limit = std::max((sample_rate * (2 + audio_latency)) / 30, 256);
+			stream_buffer_target = stream_buffer_limit / 2;
+		}
 
 		// create the buffers
 		if (sdl_create_buffers())
@@ -436,11 +318,11 @@ void sound_sdl::exit()
 
 	// print out over/underflow stats
 	if (buffer_overflows || buffer_underflows)
-		osd_printf_verbose("Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows);
+		osd_printf_verbose("Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows.load());
 
 	if (LOG_SOUND)
 	{
-		util::stream_format(*sound_log, "Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows);
+		util::stream_format(*sound_log, "Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows.load());
 		sound_log.reset();
 	}
 }
@@ -453,10 +335,9 @@ void sound_sdl::exit()
 
 int sound_sdl::sdl_create_buffers()
 {
-	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
+	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u frames, target %u\n", stream_buffer_limit, stream_buffer_target);
 
-	stream_buffer = std::make_unique<ring_buffer>(stream_buffer_size);
-	buf_locked = 0;
+	stream_buffer = std::make_unique<sound_ring>(stream_buffer_limit, 2);
 	return 0;
 }
 
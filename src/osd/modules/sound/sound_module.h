@@ -24,6 +24,10 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
+
+	// report how many sample frames are queued for output and how many the
+	// module aims to keep queued; modules that can't tell return false
+	virtual bool buffer_status(int &fill, int &target) { return false; }
 };
 
 #endif // MAME_OSD_SOUND_SOUND_MODULE_H
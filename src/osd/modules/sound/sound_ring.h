@@ -0,0 +1,112 @@
+// license:BSD-3-Clause
+// copyright-holders:Olivier Galibert, R. Belmont
+//============================================================
+//
+//  sound_ring.h - lock-free ring of float samples shared by
+//  the emulation thread and a sound module's output callback
+//
+//============================================================
+#ifndef MAME_OSD_SOUND_SOUND_RING_H
+#define MAME_OSD_SOUND_SOUND_RING_H
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+
+namespace osd {
+
+//============================================================
+//  sound_ring
+//============================================================
+
+// single producer (update_audio_stream), single consumer (the
+// backend's callback); both positions count frames and only
+// ever increase, so neither side takes a lock
+class sound_ring
+{
+public:
+	sound_ring(uint32_t frames, uint32_t channels) :
+		m_mask(round_up(std::max<uint32_t>(frames, 2)) - 1),
+		m_channels(channels),
+		m_buffer(std::make_unique<float []>((m_mask + 1) * channels)),
+		m_write(0),
+		m_read(0)
+	{
+		std::fill_n(m_buffer.get(), (m_mask + 1) * channels, 0.0f);
+	}
+
+	uint32_t capacity() const { return m_mask + 1; }
+	uint32_t channels() const { return m_channels; }
+
+	// frames waiting to be played; safe to call from either side
+	uint32_t fill() const { return m_write.load(std::memory_order_acquire) - m_read.load(std::memory_order_acquire); }
+
+	// producer: append up to 'frames' 16-bit frames, returning how many fit
+	uint32_t write(const int16_t *data, uint32_t frames)
+	{
+		uint32_t const write = m_write.load(std::memory_order_relaxed);
+		uint32_t const space = capacity() - (write - m_read.load(std::memory_order_acquire));
+		frames = std::min(frames, space);
+		for (uint32_t frame = 0; frame < frames; frame++)
+		{
+			float *const dest = &m_buffer[((write + frame) & m_mask) * m_channels];
+			for (uint32_t chan = 0; chan < m_channels; chan++)
+				dest[chan] = float(*data++) * (1.0f / 32768.0f);
+		}
+		m_write.store(write + frames, std::memory_order_release);
+		return frames;
+	}
+
+	// producer: append 'frames' frames of silence, returning how many fit
+	uint32_t write_silence(uint32_t frames)
+	{
+		uint32_t const write = m_write.load(std::memory_order_relaxed);
+		uint32_t const space = capacity() - (write - m_read.load(std::memory_order_acquire));
+		frames = std::min(frames, space);
+		for (uint32_t frame = 0; frame < frames; frame++)
+			std::fill_n(&m_buffer[((write + frame) & m_mask) * m_channels], m_channels, 0.0f);
+		m_write.store(write + frames, std::memory_order_release);
+		return frames;
+	}
+
+	// consumer: take up to 'frames' frames scaled by 'gain', returning how
+	// many were available; the rest of 'data' is left untouched
+	uint32_t read(float *data, uint32_t frames, float gain)
+	{
+		uint32_t const read = m_read.load(std::memory_order_relaxed);
+		frames = std::min(frames, m_write.load(std::memory_order_acquire) - read);
+		for (uint32_t frame = 0; frame < frames; frame++)
+		{
+			float const *const src = &m_buffer[((read + frame) & m_mask) * m_channels];
+			for (uint32_t chan = 0; chan < m_channels; chan++)
+				*data++ = src[chan] * gain;
+		}
+		m_read.store(read + frames, std::memory_order_release);
+		return frames;
+	}
+
+private:
+	static uint32_t round_up(uint32_t value)
+	{
+		uint32_t result = 1;
+		while (result < value)
+			result <<= 1;
+		return result;
+	}
+
+	uint32_t const              m_mask;         // capacity in frames minus one
+	uint32_t const              m_channels;     // samples per frame
+	std::unique_ptr<float []>   m_buffer;       // interleaved samples
+
+	// kept on separate cache lines so the two sides don't contend
+	alignas(64) std::atomic<uint32_t> m_write;  // frames written by the producer
+	alignas(64) std::atomic<uint32_t> m_read;   // frames taken by the consumer
+};
+
+} // namespace osd
+
+#endif // MAME_OSD_SOUND_SOUND_RING_H
@@ -79,6 +79,7 @@ public:
 	// audio overridables
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
+	virtual bool sound_buffer_status(int &fill, int &target) = 0;
 	virtual bool no_sound() = 0;
 
 	// input overridables
@@ -151,6 +151,24 @@ public:
 	/// \return Result of the operation.
 	virtual std::error_condition flush() noexcept = 0;
 
+	/// \brief Map a file into memory for reading
+	///
+	/// Makes the start of the file directly accessible in memory
+	/// without copying.  The mapping remains valid until the file is
+	/// closed.  Only files opened read-only should be mapped, as the
+	/// contents of the mapping aren't defined if the file is written or
+	/// truncated.  Calling this again returns the existing mapping if
+	/// it covers the requested length.  Files that can't be mapped
+	/// return an error, and the caller should fall back to reading.
+	/// \param [in] length Number of bytes to map from the start of the
+	///   file.  Must not be zero.
+	/// \param [out] data Receives a pointer to the mapped data.
+	/// \return Result of the operation.
+	virtual std::error_condition map(std::uint64_t length, void const *&data) noexcept
+	{
+		return std::errc::not_supported;
+	}
+
 	/// \brief Delete a file
 	///
 	/// \param [in] filename Path to the file to delete.
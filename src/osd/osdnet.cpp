@@ -5,6 +5,10 @@
 
 #include "interface/nethandler.h"
 
+#include "osdcore.h" // osd_printf_verbose
+
+#include <chrono>
+
 
 static std::vector<std::unique_ptr<osd_network_device::entry_t>> netdev_list;
 
@@ -41,16 +45,59 @@ osd_network_device *open_netdev(int id, osd::network_handler &ifdev)
 osd_network_device::osd_network_device(osd::network_handler &ifdev)
 	: m_dev(ifdev)
 	, m_stopped(true)
+	, m_recv_head(0)
+	, m_recv_tail(0)
+	, m_receiving(false)
 {
 }
 
 osd_network_device::~osd_network_device()
 {
+	stop_receiver();
 }
 
 void osd_network_device::start()
 {
 	m_stopped = false;
+
+	// frames are read from the host as they arrive and queued for poll()
+	if (!m_recv_thread.joinable())
+	{
+		m_receiving = true;
+		m_recv_thread = std::thread([this] () { receive_thread(); });
+	}
+}
+
+void osd_network_device::stop_receiver()
+{
+	m_receiving = false;
+	if (m_recv_thread.joinable())
+		m_recv_thread.join();
+}
+
+void osd_network_device::receive_thread()
+{
+	while (m_receiving.load(std::memory_order_relaxed))
+	{
+		uint8_t *buf;
+		int const len = recv_dev(&buf);
+		if (len <= 0)
+		{
+			wait_dev();
+			continue;
+		}
+
+		// frames are kept while the emulated device isn't receiving, and dropped once the queue fills up, as the host would
+		unsigned const head = m_recv_head.load(std::memory_order_relaxed);
+		unsigned const next = (head + 1) % RECV_QUEUE_SIZE;
+		if (next == m_recv_tail.load(std::memory_order_acquire))
+		{
+			osd_printf_verbose("netdev: receive queue full, dropping frame\n");
+			continue;
+		}
+		m_recv_queue[head].assign(buf, buf + len);
+		m_recv_head.store(next, std::memory_order_release);
+	}
 }
 
 void osd_network_device::stop()
@@ -60,11 +107,15 @@ void osd_network_device::stop()
 
 void osd_network_device::poll()
 {
-	uint8_t *buf;
-	int len;
 	//const char atalkmac[] = { 0x09, 0x00, 0x07, 0xff, 0xff, 0xff };
-	while(!m_stopped && (len = recv_dev(&buf)))
+	// the slot is only given back once the callback is done with it
+	unsigned tail = m_recv_tail.load(std::memory_order_relaxed);
+	for( ; !m_stopped && (tail != m_recv_head.load(std::memory_order_acquire)); m_recv_tail.store(tail = (tail + 1) % RECV_QUEUE_SIZE, std::memory_order_release))
 	{
+		std::vector<uint8_t> &frame = m_recv_queue[tail];
+		uint8_t *const buf = frame.data();
+		int const len = frame.size();
+
 #if 0
 		if(buf[0] & 1)
 		{
@@ -91,6 +142,11 @@ int osd_network_device::recv_dev(uint8_t **buf)
 	return 0;
 }
 
+void osd_network_device::wait_dev()
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
 void osd_network_device::set_mac(const uint8_t *mac)
 {
 }
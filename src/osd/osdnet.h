@@ -9,7 +9,9 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <vector>
 
 
@@ -51,11 +53,28 @@ public:
 	bool get_promisc();
 
 protected:
+	// called on the receive thread: return one frame if there is one, and
+	// block for a short while when there isn't
 	virtual int recv_dev(uint8_t **buf);
+	virtual void wait_dev();
+
+	// must be called by derived destructors before the device is closed
+	void stop_receiver();
 
 private:
+	static constexpr unsigned RECV_QUEUE_SIZE = 64;
+
+	void receive_thread();
+
 	osd::network_handler &m_dev;
 	bool m_stopped;
+
+	// frames received ahead of the emulation, single producer and consumer
+	std::vector<uint8_t> m_recv_queue[RECV_QUEUE_SIZE];
+	std::atomic<unsigned> m_recv_head;
+	std::atomic<unsigned> m_recv_tail;
+	std::atomic<bool> m_receiving;
+	std::thread m_recv_thread;
 };
 
 osd_network_device *open_netdev(int id, osd::network_handler &ifdev);
@@ -4,6 +4,22 @@
 //
 //  osdsync.c - OSD core work item functions
 //
+//  All work queues share one pool of threads for the whole
+//  process, rather than each starting its own set.  Compute
+//  workers each have a deque of tasks and steal from the
+//  others when theirs is empty.  I/O queues have a separate,
+//  small set of threads at raised priority, so items that
+//  block on I/O don't hold up computation.
+//
+//  A task asks for work from one queue.  Items on queues
+//  without WORK_QUEUE_FLAG_MULTI still run one at a time in
+//  the order they were queued, as they did with a thread of
+//  their own.  Tasks for WORK_QUEUE_FLAG_HIGH_FREQ queues go
+//  to the front of the deques, and workers spin for a while
+//  after running one.  A thread waiting on a queue or item
+//  runs items that haven't started yet itself, so waiting
+//  from inside a work item can't run out of threads.
+//
 //============================================================
 #if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
 // standard windows headers
@@ -18,6 +34,12 @@
 #endif
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
 #include <thread>
 #include <vector>
 #include <algorithm>
@@ -46,18 +68,17 @@
 
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
 
+// threads shared by all I/O queues
+#define IO_THREADS              (2)
+
 //============================================================
 //  MACROS
 //============================================================
 
 #if KEEP_STATISTICS
 #define add_to_stat(v,x)        do { (v) += (x); } while (0)
-#define begin_timing(v)         do { (v) -= get_profile_ticks(); } while (0)
-#define end_timing(v)           do { (v) += get_profile_ticks(); } while (0)
 #else
 #define add_to_stat(v,x)        do { } while (0)
-#define begin_timing(v)         do { } while (0)
-#define end_timing(v)           do { } while (0)
 #endif
 
 template<typename _AtomType, typename _MainType>
@@ -87,8 +108,8 @@ static void spin_while_not(const volatile _AtomType * volatile atom, const _Main
 
 int osd_get_num_processors(bool heavy_mt)
 {
-#if defined(SDLMAME_EMSCRIPTEN)
-	// multithreading is not supported at this time
+#if defined(SDLMAME_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+	// multithreading needs a build with WebAssembly threads
 	return 1;
 #else
 	unsigned int threads = std::thread::hardware_concurrency();
@@ -101,78 +122,96 @@ int osd_get_num_processors(bool heavy_mt)
 //  TYPE DEFINITIONS
 //============================================================
 
-struct work_thread_info
+namespace {
+
+// the compute and I/O sets of threads
+enum
 {
-	work_thread_info(uint32_t aid, osd_work_queue &aqueue)
-		: queue(aqueue)
-		, handle(nullptr)
-		, wakeevent(true, false)  // manual reset, not signalled
-		, id(aid)
-#if KEEP_STATISTICS
-		, itemsdone(0)
-		, actruntime(0)
-		, runtime(0)
-		, spintime(0)
-		, waittime(0)
-#endif
-	{
-	}
+	LANE_COMPUTE = 0,
+	LANE_IO,
+	LANE_COUNT
+};
 
-	osd_work_queue &    queue;          // pointer back to the queue
-	std::thread *       handle;         // handle to the thread
-	osd_event           wakeevent;      // wake event for the thread
-	uint32_t            id;
+// states of a queue that runs one item at a time
+enum
+{
+	STRAND_IDLE = 0,    // nothing queued
+	STRAND_SCHEDULED,   // a task for it is in the pool
+	STRAND_RUNNING      // a thread is running its items
+};
 
-#if KEEP_STATISTICS
-	int32_t             itemsdone;
-	osd_ticks_t         actruntime;
-	osd_ticks_t         runtime;
-	osd_ticks_t         spintime;
-	osd_ticks_t         waittime;
-#endif
+struct work_deque
+{
+	std::mutex                      lock;
+	std::deque<osd_work_queue *>    tasks;  // each task runs work from the queue it points to
+};
+
+class work_pool
+{
+public:
+	work_pool(int compute, int io);
+	~work_pool();
+
+	int threads(int lane) const { return m_threads[lane]; }
+	int external_threadid() const { return m_threads[LANE_COMPUTE] + m_threads[LANE_IO]; }
+
+	void submit(osd_work_queue &queue, int count);
+	void purge(osd_work_queue &queue);
+	bool set_affinity(const std::vector<unsigned> &cpus);
+
+private:
+	void worker(int lane, int index);
+	osd_work_queue *take(int lane, int index);
+
+	int                             m_threads[LANE_COUNT];
+	std::vector<std::thread *>      m_handles;
+	std::unique_ptr<work_deque []>  m_deques;       // one per compute thread, then one shared by the I/O threads
+	std::atomic<unsigned>           m_next;         // deque for the next submission from outside the pool
+	std::atomic<int32_t>            m_pending[LANE_COUNT];  // tasks in the deques
+	std::atomic<int32_t>            m_sleeping[LANE_COUNT]; // threads blocked waiting for tasks
+	std::mutex                      m_sleep_lock;
+	std::condition_variable         m_wake[LANE_COUNT];
+	std::atomic<bool>               m_exiting;
 };
 
+} // anonymous namespace
+
 
 struct osd_work_queue
 {
 	osd_work_queue()
 		: list(nullptr)
-		, tailptr(nullptr)
+		, tailptr(&list)
 		, free(nullptr)
+		, state(STRAND_IDLE)
 		, items(0)
-		, livethreads(0)
+		, busy(0)
 		, waiting(0)
-		, exiting(0)
-		, threads(0)
 		, flags(0)
+		, lane(LANE_COMPUTE)
 		, doneevent(true, true)     // manual reset, signalled
 #if KEEP_STATISTICS
 		, itemsqueued(0)
 		, setevents(0)
-		, extraitems(0)
-		, spinloops(0)
 #endif
 	{
 	}
 
-	std::mutex          lock;           // lock for protecting the queue
-	std::atomic<osd_work_item *> list;  // list of items in the queue
-	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
-	std::atomic<osd_work_item *> free;  // free list of work items
-	std::atomic<int32_t>  items;          // items in the queue
-	std::atomic<int32_t>  livethreads;    // number of live threads
+	std::mutex          lock;           // lock for protecting the lists and state
+	osd_work_item *     list;           // list of items that haven't started
+	osd_work_item **    tailptr;        // pointer to the tail pointer of work items in the queue
+	osd_work_item *     free;           // free list of work items
+	int                 state;          // strand state for queues without WORK_QUEUE_FLAG_MULTI
+	std::atomic<int32_t>  items;          // items queued or running
+	std::atomic<int32_t>  busy;           // pool threads holding a task for this queue
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
-	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
-	uint32_t              threads;        // number of threads in this queue
 	uint32_t              flags;          // creation flags
-	std::vector<work_thread_info *>  thread;         // array of thread information
+	int                   lane;           // set of pool threads that run our items
 	osd_event           doneevent;      // event signalled when work is complete
 
 #if KEEP_STATISTICS
 	std::atomic<int32_t>  itemsqueued;    // total items queued
 	std::atomic<int32_t>  setevents;      // number of times we called SetEvent
-	std::atomic<int32_t>  extraitems;     // how many extra items we got after the first in the queue loop
-	std::atomic<int32_t>  spinloops;      // how many times spinning bought us more items
 #endif
 };
 
@@ -207,14 +246,29 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+namespace {
+
+// the pool lives as long as any queue does
+std::mutex      s_pool_lock;
+work_pool *     s_pool = nullptr;
+int             s_pool_users = 0;
+
+// index of the calling thread within the pool, or -1 if it isn't a pool thread
+thread_local int s_threadid = -1;
+
+// processors for pool threads, empty if unrestricted (protected by s_pool_lock)
+std::vector<unsigned> s_worker_cpus;
+
+} // anonymous namespace
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
 
 static int effective_num_processors(bool heavy_mt);
-static void *worker_thread_entry(void *param);
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
-static bool queue_has_list_items(osd_work_queue *queue);
+static bool thread_set_affinity(std::thread *thread, const std::vector<unsigned> &cpus);
+static void help_queue(osd_work_queue &queue, int threadid);
+static void run_task(osd_work_queue &queue, int threadid);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -245,85 +299,272 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 }
 
 //============================================================
-//  osd_work_queue_alloc
+//  thread_set_affinity - restrict a thread, or the
+//  calling thread if null, to a set of processors
 //============================================================
 
-osd_work_queue *osd_work_queue_alloc(int flags)
+static bool thread_set_affinity(std::thread *thread, const std::vector<unsigned> &cpus)
 {
-	int threadnum;
-	int numprocs = effective_num_processors(!(flags & WORK_QUEUE_FLAG_HIGH_FREQ));
-	osd_work_queue *queue;
-	int osdthreadnum = 0;
-	int allocthreadnum;
-	const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	// only the first processor group is supported
+	DWORD_PTR mask = 0;
+	for (unsigned cpu : cpus)
+		if (cpu < (sizeof(mask) * 8))
+			mask |= DWORD_PTR(1) << cpu;
+	if (!mask)
+		return false;
+	return SetThreadAffinityMask(thread ? (HANDLE)thread->native_handle() : GetCurrentThread(), mask) != 0;
+#elif defined(SDLMAME_LINUX)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (unsigned cpu : cpus)
+		if (cpu < CPU_SETSIZE)
+			CPU_SET(cpu, &set);
+	if (!CPU_COUNT(&set))
+		return false;
+	return pthread_setaffinity_np(thread ? thread->native_handle() : pthread_self(), sizeof(set), &set) == 0;
+#else
+	return false;
+#endif
+}
 
-	// allocate a new queue
-	queue = new osd_work_queue();
+//============================================================
+//  work_pool
+//============================================================
 
-	// initialize basic queue members
-	queue->tailptr = (osd_work_item **)&queue->list;
-	queue->flags = flags;
+work_pool::work_pool(int compute, int io)
+	: m_threads{ compute, io }
+	, m_deques(new work_deque[compute + 1])
+	, m_next(0)
+	, m_pending{ 0, 0 }
+	, m_sleeping{ 0, 0 }
+	, m_exiting(false)
+{
+	for (int lane = 0; lane < LANE_COUNT; lane++)
+	{
+		for (int index = 0; index < m_threads[lane]; index++)
+		{
+			std::thread *handle = new std::thread([this, lane, index] () { worker(lane, index); });
+
+			// I/O threads get high priority because they are assumed to be blocked most
+			// of the time; other threads just match the creator's priority
+			thread_adjust_priority(handle, (lane == LANE_IO) ? 1 : 0);
+			if (!s_worker_cpus.empty())
+				thread_set_affinity(handle, s_worker_cpus);
+			m_handles.push_back(handle);
+		}
+	}
+}
 
-	// determine how many threads to create...
-	// on a single-CPU system, create 1 thread for I/O queues, and 0 threads for everything else
-	if (numprocs == 1)
-		threadnum = (flags & WORK_QUEUE_FLAG_IO) ? 1 : 0;
-	// on an n-CPU system, create n-1 threads for multi queues, and 1 thread for everything else
-	else
-		threadnum = (flags & WORK_QUEUE_FLAG_MULTI) ? (numprocs - 1) : 1;
 
-	if (osdworkqueuemaxthreads != nullptr && sscanf(osdworkqueuemaxthreads, "%d", &osdthreadnum) == 1 && threadnum > osdthreadnum)
-		threadnum = osdthreadnum;
+work_pool::~work_pool()
+{
+	// signal all the threads to exit
+	{
+		std::lock_guard<std::mutex> lock(m_sleep_lock);
+		m_exiting = true;
+		for (auto &wake : m_wake)
+			wake.notify_all();
+	}
+
+	// wait for all the threads to go away
+	for (std::thread *handle : m_handles)
+	{
+		handle->join();
+		delete handle;
+	}
+}
 
-#if defined(SDLMAME_EMSCRIPTEN)
-	// threads are not supported at all
-	threadnum = 0;
-#endif
 
-	// clamp to the maximum
-	queue->threads = std::min(threadnum, WORK_MAX_THREADS);
+//-------------------------------------------------
+//  submit - add tasks for a queue to the pool
+//-------------------------------------------------
 
-	// allocate memory for thread array (+1 to count the calling thread if WORK_QUEUE_FLAG_MULTI)
-	if (flags & WORK_QUEUE_FLAG_MULTI)
-		allocthreadnum = queue->threads + 1;
+void work_pool::submit(osd_work_queue &queue, int count)
+{
+	int const lane = queue.lane;
+
+	// pool threads keep work they generate; everything else is spread around
+	int index;
+	if (lane == LANE_IO)
+		index = m_threads[LANE_COMPUTE];
+	else if ((s_threadid >= 0) && (s_threadid < m_threads[LANE_COMPUTE]))
+		index = s_threadid;
 	else
-		allocthreadnum = std::max(queue->threads, 1u);
+		index = m_next++ % m_threads[LANE_COMPUTE];
 
-#if KEEP_STATISTICS
-	printf("osdprocs: %d effecprocs: %d threads: %d allocthreads: %d osdthreads: %d maxthreads: %d queuethreads: %d\n", osd_num_processors, numprocs, threadnum, allocthreadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads);
-#endif
+	{
+		work_deque &deque = m_deques[index];
+		std::lock_guard<std::mutex> lock(deque.lock);
+		if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ)
+			deque.tasks.insert(deque.tasks.begin(), count, &queue);
+		else
+			deque.tasks.insert(deque.tasks.end(), count, &queue);
+	}
+	m_pending[lane] += count;
+
+	// wake as many sleeping threads as there's work for
+	if (m_sleeping[lane])
+	{
+		std::lock_guard<std::mutex> lock(m_sleep_lock);
+		if (count == 1)
+			m_wake[lane].notify_one();
+		else
+			m_wake[lane].notify_all();
+		add_to_stat(queue.setevents, 1);
+	}
+}
+
+
+//-------------------------------------------------
+//  set_affinity - restrict every thread to a set
+//  of processors
+//-------------------------------------------------
+
+bool work_pool::set_affinity(const std::vector<unsigned> &cpus)
+{
+	bool result = true;
+	for (std::thread *handle : m_handles)
+		result = thread_set_affinity(handle, cpus) && result;
+	return result;
+}
 
-	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
-		queue->thread.push_back(new work_thread_info(threadnum, *queue));
 
-	// iterate over threads
-	for (threadnum = 0; threadnum < queue->threads; threadnum++)
+//-------------------------------------------------
+//  purge - remove all tasks for a queue and wait
+//  for threads running its work to finish
+//-------------------------------------------------
+
+void work_pool::purge(osd_work_queue &queue)
+{
+	for (int index = 0; index <= m_threads[LANE_COMPUTE]; index++)
 	{
-		work_thread_info *thread = queue->thread[threadnum];
+		work_deque &deque = m_deques[index];
+		std::lock_guard<std::mutex> lock(deque.lock);
+		auto const found = std::remove(deque.tasks.begin(), deque.tasks.end(), &queue);
+		m_pending[queue.lane] -= std::distance(found, deque.tasks.end());
+		deque.tasks.erase(found, deque.tasks.end());
+	}
+
+	while (queue.busy)
+		std::this_thread::yield();
+}
+
+
+//-------------------------------------------------
+//  take - get a task from our own deque, or steal
+//  one from another thread's
+//-------------------------------------------------
+
+osd_work_queue *work_pool::take(int lane, int index)
+{
+	if (!m_pending[lane])
+		return nullptr;
+
+	// I/O threads share the last deque; compute threads start with their own and then go round the others
+	int const count = (lane == LANE_IO) ? 1 : m_threads[LANE_COMPUTE];
+	for (int offset = 0; offset < count; offset++)
+	{
+		work_deque &deque = m_deques[(lane == LANE_IO) ? m_threads[LANE_COMPUTE] : ((index + offset) % count)];
+		std::lock_guard<std::mutex> lock(deque.lock);
+		if (!deque.tasks.empty())
+		{
+			// mark the queue busy while the deque is locked, so it can't be freed under us
+			osd_work_queue *const queue = deque.tasks.front();
+			deque.tasks.pop_front();
+			--m_pending[lane];
+			++queue->busy;
+			return queue;
+		}
+	}
+	return nullptr;
+}
+
 
-		// create the thread
-		thread->handle = new std::thread(worker_thread_entry, thread);
-		if (thread->handle == nullptr)
-			goto error;
+//-------------------------------------------------
+//  worker - main loop of a pool thread
+//-------------------------------------------------
 
-		// set its priority: I/O threads get high priority because they are assumed to be
-		// blocked most of the time; other threads just match the creator's priority
-		if (flags & WORK_QUEUE_FLAG_IO)
-			thread_adjust_priority(thread->handle, 1);
+void work_pool::worker(int lane, int index)
+{
+	s_threadid = (lane == LANE_IO) ? (m_threads[LANE_COMPUTE] + index) : index;
+	osd_ticks_t stopspin = 0;
+
+	while (!m_exiting)
+	{
+		osd_work_queue *const queue = take(lane, index);
+		if (queue)
+		{
+			// after high frequency work, spin for a while before giving up
+			if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ)
+				stopspin = osd_ticks() + SPIN_LOOP_TIME;
+			run_task(*queue, s_threadid);
+			--queue->busy;
+		}
+		else if (osd_ticks() < stopspin)
+		{
+			spin_while<std::atomic<int32_t>, int32_t>(&m_pending[lane], 0, stopspin - osd_ticks());
+			stopspin = 0;
+		}
 		else
-			thread_adjust_priority(thread->handle, 0);
+		{
+			// block waiting for work or exit
+			std::unique_lock<std::mutex> lock(m_sleep_lock);
+			++m_sleeping[lane];
+			while (!m_pending[lane] && !m_exiting)
+				m_wake[lane].wait(lock);
+			--m_sleeping[lane];
+		}
 	}
+}
+
+//============================================================
+//  osd_work_queue_alloc
+//============================================================
 
-	// start a timer going for "waittime" on the main thread
-	if (flags & WORK_QUEUE_FLAG_MULTI)
+osd_work_queue *osd_work_queue_alloc(int flags)
+{
+	// start the pool with the first queue
 	{
-		begin_timing(queue->thread[queue->threads]->waittime);
+		std::lock_guard<std::mutex> lock(s_pool_lock);
+		if (!s_pool)
+		{
+			int const numprocs = effective_num_processors(true);
+			int osdthreadnum = 0;
+			const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+
+			// the thread that queues work helps out, so leave a processor for it;
+			// on a single-CPU system, there are only threads for I/O
+			int compute = numprocs - 1;
+			int io = IO_THREADS;
+			if (osdworkqueuemaxthreads != nullptr && sscanf(osdworkqueuemaxthreads, "%d", &osdthreadnum) == 1)
+			{
+				compute = std::min(compute, osdthreadnum);
+				io = std::min(io, osdthreadnum);
+			}
+
+#if defined(SDLMAME_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+			// threads are not supported at all
+			compute = io = 0;
+#endif
+
+			// leave a thread ID for threads outside the pool
+			compute = std::max(std::min(compute, WORK_MAX_THREADS - 1 - io), 0);
+			io = std::max(io, 0);
+
+#if KEEP_STATISTICS
+			printf("osdprocs: %d effecprocs: %d compute threads: %d I/O threads: %d osdthreads: %d maxthreads: %d\n", osd_num_processors, numprocs, compute, io, osdthreadnum, WORK_MAX_THREADS);
+#endif
+			s_pool = new work_pool(compute, io);
+		}
+		s_pool_users++;
 	}
-	return queue;
 
-error:
-	osd_work_queue_free(queue);
-	return nullptr;
+	// allocate a new queue
+	osd_work_queue *queue = new osd_work_queue();
+	queue->flags = flags;
+	queue->lane = (flags & WORK_QUEUE_FLAG_IO) ? LANE_IO : LANE_COMPUTE;
+	return queue;
 }
 
 
@@ -344,36 +585,20 @@ int osd_work_queue_items(osd_work_queue *queue)
 
 bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 {
-	// if no threads, no waiting
-	if (queue->threads == 0)
+	// if no items, we're done
+	if (queue->items == 0)
 		return true;
 
-	// if no items, we're done
+	// help out rather than doing nothing
+	help_queue(*queue, (s_threadid >= 0) ? s_threadid : s_pool->external_threadid());
 	if (queue->items == 0)
 		return true;
 
-	// if this is a multi queue, help out rather than doing nothing
-	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
+	// if we're a high frequency queue, spin until done
+	if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ)
 	{
-		work_thread_info *thread = queue->thread[queue->threads];
-
-		end_timing(thread->waittime);
-
-		// process what we can as a worker thread
-		worker_thread_process(queue, thread);
-
-		// if we're a high frequency queue, spin until done
-		if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue->items != 0)
-		{
-			// spin until we're done
-			begin_timing(thread->spintime);
-			spin_while_not<std::atomic<int>,int>(&queue->items, 0, timeout);
-			end_timing(thread->spintime);
-
-			begin_timing(thread->waittime);
-			return (queue->items == 0);
-		}
-		begin_timing(thread->waittime);
+		spin_while_not<std::atomic<int32_t>, int32_t>(&queue->items, 0, timeout);
+		return (queue->items == 0);
 	}
 
 	// reset our done event and double-check the items before waiting
@@ -394,81 +619,42 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 
 void osd_work_queue_free(osd_work_queue *queue)
 {
-	// stop the timer for "waittime" on the main thread
-	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
-	{
-		end_timing(queue->thread[queue->threads]->waittime);
-	}
-
-	// signal all the threads to exit
-	queue->exiting = true;
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
-		thread->wakeevent.set();
-	}
-
-	// wait for all the threads to go away
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
-
-		// block on the thread going away, then close the handle
-		if (thread->handle != nullptr)
-		{
-			thread->handle->join();
-			delete thread->handle;
-		}
-
-	}
+	// drop work that hasn't started and wait for what has
+	s_pool->purge(*queue);
 
 #if KEEP_STATISTICS
-	// output per-thread statistics
-	for (work_thread_info *thread : queue->thread)
-	{
-		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
-		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
-				thread->id, thread->itemsdone,
-				(double)thread->runtime * 100.0 / (double)total,
-				(double)thread->actruntime * 100.0 / (double)total,
-				(double)thread->spintime * 100.0 / (double)total,
-				(double)thread->waittime * 100.0 / (double)total,
-				(uint32_t) total);
-	}
+	printf("Items queued   = %9d\n", queue->itemsqueued.load());
+	printf("SetEvent calls = %9d\n", queue->setevents.load());
 #endif
 
-	// free the list
-	for (auto & th : queue->thread)
-		delete th;
-	queue->thread.clear();
-
 	// free all items in the free list
-	while (queue->free.load() != nullptr)
+	while (queue->free != nullptr)
 	{
-		auto *item = (osd_work_item *)queue->free;
+		osd_work_item *item = queue->free;
 		queue->free = item->next;
 		delete item->event;
 		delete item;
 	}
 
 	// free all items in the active list
-	while (queue->list.load() != nullptr)
+	while (queue->list != nullptr)
 	{
-		auto *item = (osd_work_item *)queue->list;
+		osd_work_item *item = queue->list;
 		queue->list = item->next;
 		delete item->event;
 		delete item;
 	}
 
-#if KEEP_STATISTICS
-	printf("Items queued   = %9d\n", queue->itemsqueued.load());
-	printf("SetEvent calls = %9d\n", queue->setevents.load());
-	printf("Extra items    = %9d\n", queue->extraitems.load());
-	printf("Spin loops     = %9d\n", queue->spinloops.load());
-#endif
-
 	// free the queue itself
 	delete queue;
+
+	// stop the pool with the last queue
+	std::lock_guard<std::mutex> lock(s_pool_lock);
+	if (!--s_pool_users)
+	{
+		delete s_pool;
+		s_pool = nullptr;
+	}
 }
 
 
@@ -490,10 +676,9 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		// first allocate a new work item; try the free list first
 		{
 			std::lock_guard<std::mutex> lock(queue->lock);
-			do
-			{
-				item = (osd_work_item *)queue->free;
-			} while (item != nullptr && !queue->free.compare_exchange_weak(item, item->next, std::memory_order_release, std::memory_order_relaxed));
+			item = queue->free;
+			if (item != nullptr)
+				queue->free = item->next;
 		}
 
 		// if nothing, allocate something new
@@ -523,46 +708,35 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		parambase = (uint8_t *)parambase + paramstep;
 	}
 
-	// enqueue the whole thing within the critical section
-	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
-	}
-
-	// increment the number of items in the queue
+	// count the items before anything can finish them
 	queue->items += numitems;
 	add_to_stat(queue->itemsqueued, numitems);
 
-	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
+	// enqueue the whole thing within the critical section, and work out how many tasks the pool
+	// needs: one per item if they can run side by side, otherwise one to start the strand
+	int tasks;
 	{
-		int threadnum;
+		std::lock_guard<std::mutex> lock(queue->lock);
+		*queue->tailptr = itemlist;
+		queue->tailptr = item_tailptr;
 
-		// iterate over all the threads
-		for (threadnum = 0; threadnum < queue->threads; threadnum++)
+		if (queue->flags & WORK_QUEUE_FLAG_MULTI)
+			tasks = numitems;
+		else if (queue->state == STRAND_IDLE)
 		{
-			work_thread_info *thread = queue->thread[threadnum];
-
-			// Attempt to wake the thread
-			if (thread->wakeevent.set())
-			{
-				add_to_stat(queue->setevents, 1);
-
-				// for non-shared, the first one we find is good enough
-				if (--numitems == 0)
-					break;
-			}
+			queue->state = STRAND_SCHEDULED;
+			tasks = 1;
 		}
+		else
+			tasks = 0;
 	}
 
 	// if no threads, run the queue now on this thread
-	if (queue->threads == 0)
-	{
-		end_timing(queue->thread[0]->waittime);
-		worker_thread_process(queue, queue->thread[0]);
-		begin_timing(queue->thread[0]->waittime);
-	}
+	if (!s_pool->threads(queue->lane))
+		help_queue(*queue, (s_threadid >= 0) ? s_threadid : s_pool->external_threadid());
+	else if (tasks)
+		s_pool->submit(*queue, tasks);
+
 	// only return the item if it won't get released automatically
 	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : lastitem;
 }
@@ -578,24 +752,22 @@ bool osd_work_item_wait(osd_work_item *item, osd_ticks_t timeout)
 	if (item->done)
 		return true;
 
+	// if it hasn't started yet, help get it done
+	help_queue(item->queue, (s_threadid >= 0) ? s_threadid : s_pool->external_threadid());
+	if (item->done)
+		return true;
+
 	// if we don't have an event, create one
-	if (item->event == nullptr)
 	{
 		std::lock_guard<std::mutex> lock(item->queue.lock);
-		item->event = new osd_event(true, false);     // manual reset, not signalled
-	}
-	else
-		item->event->reset();
-
-	// if we don't have an event, we need to spin (shouldn't ever really happen)
-	if (item->event == nullptr)
-	{
-		// TODO: do we need to measure the spin time here as well? and how can we do it?
-		spin_while<std::atomic<int>,int>(&item->done, 0, timeout);
+		if (item->event == nullptr)
+			item->event = new osd_event(true, false);     // manual reset, not signalled
+		else
+			item->event->reset();
 	}
 
-	// otherwise, block on the event until done
-	else if (!item->done)
+	// block on the event until done
+	if (!item->done)
 		item->event->wait(timeout);
 
 	// return true if the refcount actually hit 0
@@ -619,18 +791,105 @@ void *osd_work_item_result(osd_work_item *item)
 
 void osd_work_item_release(osd_work_item *item)
 {
-	osd_work_item *next;
-
 	// make sure we're done first
 	osd_work_item_wait(item, 100 * osd_ticks_per_second());
 
 	// add us to the free list on our queue
 	std::lock_guard<std::mutex> lock(item->queue.lock);
-	do
+	item->next = item->queue.free;
+	item->queue.free = item;
+}
+
+
+//============================================================
+//  osd_parse_cpu_list
+//============================================================
+
+bool osd_parse_cpu_list(const char *spec, std::vector<unsigned> &cpus)
+{
+	cpus.clear();
+	while (*spec)
 	{
-		next = (osd_work_item *) item->queue.free;
-		item->next = next;
-	} while (!item->queue.free.compare_exchange_weak(next, item, std::memory_order_release, std::memory_order_relaxed));
+		unsigned first, last;
+		int length;
+		if (sscanf(spec, "node%u%n", &first, &length) == 1)
+		{
+			// expand a NUMA node into its processors
+			std::vector<unsigned> node;
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+			ULONGLONG mask;
+			if ((first > 0xff) || !GetNumaNodeProcessorMask(UCHAR(first), &mask))
+				return false;
+			for (unsigned cpu = 0; mask; cpu++, mask >>= 1)
+				if (mask & 1)
+					node.push_back(cpu);
+#elif defined(SDLMAME_LINUX)
+			char path[64], list[256];
+			snprintf(path, std::size(path), "/sys/devices/system/node/node%u/cpulist", first);
+			FILE *const file = fopen(path, "r");
+			if (!file)
+				return false;
+			bool const read = fgets(list, std::size(list), file) != nullptr;
+			fclose(file);
+			if (!read)
+				return false;
+			list[strcspn(list, "\n")] = '\0';
+			if ((list[0] == 'n') || !osd_parse_cpu_list(list, node))
+				return false;
+#else
+			return false;
+#endif
+			cpus.insert(cpus.end(), node.begin(), node.end());
+		}
+		else if (sscanf(spec, "%u-%u%n", &first, &last, &length) == 2)
+		{
+			if (last < first)
+				return false;
+			for (unsigned cpu = first; cpu <= last; cpu++)
+				cpus.push_back(cpu);
+		}
+		else if (sscanf(spec, "%u%n", &first, &length) == 1)
+		{
+			cpus.push_back(first);
+		}
+		else
+		{
+			return false;
+		}
+
+		spec += length;
+		if (*spec == ',')
+			spec++;
+		else if (*spec)
+			return false;
+	}
+
+	std::sort(cpus.begin(), cpus.end());
+	cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+	return !cpus.empty();
+}
+
+
+//============================================================
+//  osd_set_thread_affinity
+//============================================================
+
+bool osd_set_thread_affinity(const std::vector<unsigned> &cpus)
+{
+	return thread_set_affinity(nullptr, cpus);
+}
+
+
+//============================================================
+//  osd_set_worker_affinity
+//============================================================
+
+bool osd_set_worker_affinity(const std::vector<unsigned> &cpus)
+{
+	// threads started from now on pick it up when they're created
+	std::lock_guard<std::mutex> lock(s_pool_lock);
+	s_worker_cpus = cpus;
+	return !s_pool || s_pool->set_affinity(cpus);
 }
 
 
@@ -664,154 +923,132 @@ static int effective_num_processors(bool heavy_mt)
 
 
 //============================================================
-//  worker_thread_entry
+//  run_item
 //============================================================
 
-static void *worker_thread_entry(void *param)
+static void run_item(osd_work_item *item, int threadid)
 {
-	auto *thread = (work_thread_info *)param;
-	osd_work_queue &queue = thread->queue;
+	osd_work_queue &queue = item->queue;
 
-	// loop until we exit
-	for ( ;; )
+	// call the callback and stash the result
+	item->result = (*item->callback)(item->param, threadid);
+
+	// if it's an auto-release item, release it
+	item->done = true;
+	if (item->flags & WORK_ITEM_FLAG_AUTO_RELEASE)
+	{
+		std::lock_guard<std::mutex> lock(queue.lock);
+		item->next = queue.free;
+		queue.free = item;
+	}
+
+	// set the result and signal the event
+	else
 	{
-		// block waiting for work or exit
-		// bail on exit, and only wait if there are no pending items in queue
-		if (queue.exiting)
-			break;
+		std::lock_guard<std::mutex> lock(queue.lock);
 
-		if (!queue_has_list_items(&queue))
+		if (item->event != nullptr)
 		{
-			begin_timing(thread->waittime);
-			thread->wakeevent.wait( OSD_EVENT_WAIT_INFINITE);
-			end_timing(thread->waittime);
+			item->event->set();
+			add_to_stat(queue.setevents, 1);
 		}
+	}
 
-		if (queue.exiting)
-			break;
+	// decrement the item count after we are done
+	if ((--queue.items == 0) && queue.waiting)
+	{
+		queue.doneevent.set();
+		add_to_stat(queue.setevents, 1);
+	}
+}
 
-		// indicate that we are live
-		++queue.livethreads;
 
-		// process work items
-		for ( ;; )
-		{
-			// process as much as we can
-			worker_thread_process(&queue, thread);
+//============================================================
+//  run_strand - run items one at a time until the
+//  queue is empty, if nobody else is
+//============================================================
 
-			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
-			{
-				// spin for a while looking for more work
-				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
-				end_timing(thread->spintime);
-			}
+static void run_strand(osd_work_queue &queue, int threadid)
+{
+	std::unique_lock<std::mutex> lock(queue.lock);
+	if (queue.state != STRAND_SCHEDULED)
+		return;
+	queue.state = STRAND_RUNNING;
 
-			// if nothing more, release the processor
-			if (!queue_has_list_items(&queue))
-				break;
-			add_to_stat(queue.spinloops, 1);
-		}
+	while (queue.list != nullptr)
+	{
+		osd_work_item *item = queue.list;
+		queue.list = item->next;
+		if (queue.list == nullptr)
+			queue.tailptr = &queue.list;
+		lock.unlock();
 
-		// decrement the live thread count
-		thread->wakeevent.reset();
-		--queue.livethreads;
-	}
+		run_item(item, threadid);
 
-	return nullptr;
+		lock.lock();
+	}
+	queue.state = STRAND_IDLE;
 }
 
 
 //============================================================
-//  worker_thread_process
+//  run_task - do the work a pool task asks for
 //============================================================
 
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread)
+static void run_task(osd_work_queue &queue, int threadid)
 {
-	int threadid = thread->id;
-
-	begin_timing(thread->runtime);
-
-	// loop until everything is processed
-	while (true)
+	if (queue.flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		osd_work_item *item = nullptr;
-
-		bool end_loop = false;
-
-		// use a critical section to synchronize the removal of items
+		// a task per item, so take one if another thread hasn't already
+		osd_work_item *item;
 		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-
-			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
+			std::lock_guard<std::mutex> lock(queue.lock);
+			item = queue.list;
+			if (item != nullptr)
 			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
+				queue.list = item->next;
+				if (queue.list == nullptr)
+					queue.tailptr = &queue.list;
 			}
 		}
+		if (item != nullptr)
+			run_item(item, threadid);
+	}
+	else
+	{
+		run_strand(queue, threadid);
+	}
+}
 
-		if (end_loop)
-			break;
 
-		// process non-NULL items
-		if (item != nullptr)
+//============================================================
+//  help_queue - run whatever hasn't started yet on
+//  the calling thread
+//============================================================
+
+static void help_queue(osd_work_queue &queue, int threadid)
+{
+	if (queue.flags & WORK_QUEUE_FLAG_MULTI)
+	{
+		// leftover tasks in the pool will find the list empty
+		for (;;)
 		{
-			// call the callback and stash the result
-			begin_timing(thread->actruntime);
-			item->result = (*item->callback)(item->param, threadid);
-			end_timing(thread->actruntime);
-
-			// decrement the item count after we are done
-			--queue->items;
-			item->done = true;
-			add_to_stat(thread->itemsdone, 1);
-
-			// if it's an auto-release item, release it
-			if (item->flags & WORK_ITEM_FLAG_AUTO_RELEASE)
-				osd_work_item_release(item);
-
-			// set the result and signal the event
-			else
+			osd_work_item *item;
 			{
-				std::lock_guard<std::mutex> lock(queue->lock);
-
-				if (item->event != nullptr)
-				{
-					item->event->set();
-					add_to_stat(item->queue.setevents, 1);
-				}
+				std::lock_guard<std::mutex> lock(queue.lock);
+				item = queue.list;
+				if (item == nullptr)
+					break;
+				queue.list = item->next;
+				if (queue.list == nullptr)
+					queue.tailptr = &queue.list;
 			}
-
-			// if we removed an item and there's still work to do, bump the stats
-			if (queue_has_list_items(queue))
-				add_to_stat(queue->extraitems, 1);
+			run_item(item, threadid);
 		}
 	}
-
-	// we don't need to set the doneevent for multi queues because they spin
-	if (queue->waiting)
+	else
 	{
-		queue->doneevent.set();
-		add_to_stat(queue->setevents, 1);
+		// this only does anything if the strand's task hasn't been picked up yet
+		run_strand(queue, threadid);
 	}
-
-	end_timing(thread->runtime);
-}
-
-bool queue_has_list_items(osd_work_queue *queue)
-{
-	std::lock_guard<std::mutex> lock(queue->lock);
-	bool has_list_items = (queue->list.load() != nullptr);
-	return has_list_items;
 }
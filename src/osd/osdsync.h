@@ -14,6 +14,7 @@
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
+#include <vector>
 
 #include "osdcore.h"
 
@@ -166,4 +167,46 @@ private:
 
 };
 
+
+/***************************************************************************
+    SYNCHRONIZATION INTERFACES - Processor affinity
+***************************************************************************/
+
+/*-----------------------------------------------------------------------------
+    osd_parse_cpu_list: parse a list of processors
+
+    Parameters:
+
+        spec - comma-separated processor numbers, ranges like 4-7, and
+               NUMA nodes like node1 (where the system can report them)
+        cpus - receives the sorted processor numbers
+
+    Return value:
+
+        false if the list is malformed or names a node that can't be found
+-----------------------------------------------------------------------------*/
+bool osd_parse_cpu_list(const char *spec, std::vector<unsigned> &cpus);
+
+
+/*-----------------------------------------------------------------------------
+    osd_set_thread_affinity: restrict the calling thread to a set of
+    processors
+
+    Return value:
+
+        false if the system doesn't support it or refused
+-----------------------------------------------------------------------------*/
+bool osd_set_thread_affinity(const std::vector<unsigned> &cpus);
+
+
+/*-----------------------------------------------------------------------------
+    osd_set_worker_affinity: restrict the threads that run work queue items
+    to a set of processors, including threads started later
+
+    Return value:
+
+        false if the system doesn't support it or refused
+-----------------------------------------------------------------------------*/
+bool osd_set_worker_affinity(const std::vector<unsigned> &cpus);
+
 #endif // MAME_OSD_OSDSYNC_H
@@ -14,6 +14,7 @@
 
 #define SDLOPTION_INIPATH               "inipath"
 #define SDLOPTION_SDLVIDEOFPS           "sdlvideofps"
+#define SDLOPTION_RENDERTHREAD          "renderthread"
 #define SDLOPTION_USEALLHEADS           "useallheads"
 #define SDLOPTION_ATTACH_WINDOW         "attach_window"
 #define SDLOPTION_CENTERH               "centerh"
@@ -68,6 +69,7 @@ public:
 
 	// performance options
 	bool video_fps() const { return bool_value(SDLOPTION_SDLVIDEOFPS); }
+	bool render_thread() const { return bool_value(SDLOPTION_RENDERTHREAD); }
 
 	// video options
 	bool centerh() const { return bool_value(SDLOPTION_CENTERH); }
@@ -133,6 +133,7 @@ void sdl_osd_interface::extract_video_config()
 	video_config.switchres     = options().switch_res();
 	video_config.centerh       = options().centerh();
 	video_config.centerv       = options().centerv();
+	video_config.renderthread  = options().render_thread();
 	video_config.waitvsync     = options().wait_vsync();
 	video_config.syncrefresh   = options().sync_refresh();
 	if (!video_config.waitvsync && video_config.syncrefresh)
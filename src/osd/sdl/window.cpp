@@ -214,6 +214,7 @@ void sdl_window_info::toggle_full_screen()
 	}
 
 	// kill off the drawers
+	stop_render_thread();
 	renderer_reset();
 	bool is_osx = false;
 #ifdef SDLMAME_MACOSX
@@ -637,6 +638,7 @@ void sdl_window_info::complete_destroy()
 		SDL_SetWindowFullscreen(platform_window(), SDL_WINDOW_FULLSCREEN);
 	}
 
+	stop_render_thread();
 	renderer_reset();
 	SDL_DestroyWindow(platform_window());
 	set_platform_window(nullptr);
@@ -786,9 +788,19 @@ void sdl_window_info::update()
 			{
 				// otherwise, render with our drawing system
 				if (video_config.perftest)
+				{
 					measure_fps(update);
+				}
+				else if (m_render_thread.joinable())
+				{
+					// the render thread says when it's done
+					m_draw_event.set();
+					return;
+				}
 				else
+				{
 					renderer().draw(update);
+				}
 			}
 
 			// all done, ready for next
@@ -983,6 +995,7 @@ int sdl_window_info::complete_create()
 	// initialize the drawing backend
 	if (renderer().create())
 		return 1;
+	start_render_thread();
 
 	// Make sure we have a consistent state
 	SDL_ShowCursor(SDL_DISABLE);
@@ -992,6 +1005,65 @@ int sdl_window_info::complete_create()
 }
 
 
+//============================================================
+//  start_render_thread
+//  (main thread)
+//============================================================
+
+void sdl_window_info::start_render_thread()
+{
+	if (!video_config.renderthread || video_config.perftest || !renderer().can_draw_on_thread())
+		return;
+
+	// the renderer is created on this thread, so let go of it first
+	renderer().release_thread();
+	m_render_thread_exit = false;
+	m_render_thread = std::thread([this] () { render_thread_main(); });
+}
+
+
+//============================================================
+//  stop_render_thread
+//  (main thread)
+//============================================================
+
+void sdl_window_info::stop_render_thread()
+{
+	if (!m_render_thread.joinable())
+		return;
+
+	// let the frame in flight finish, and leave the event set for the
+	// next update drawing on this thread
+	m_rendered_event.wait(OSD_EVENT_WAIT_INFINITE);
+	m_render_thread_exit = true;
+	m_draw_event.set();
+	m_render_thread.join();
+	m_rendered_event.set();
+}
+
+
+//============================================================
+//  render_thread_main
+//  (render thread)
+//============================================================
+
+void sdl_window_info::render_thread_main()
+{
+	while (true)
+	{
+		m_draw_event.wait(OSD_EVENT_WAIT_INFINITE);
+		if (m_render_thread_exit)
+			break;
+
+		// the main thread won't touch the primitive list or the renderer
+		// until this is signalled
+		renderer().draw(1);
+		m_rendered_event.set();
+	}
+	renderer().release_thread();
+}
+
+
 //============================================================
 //  draw_video_contents
 //  (window thread)
@@ -1342,6 +1414,8 @@ sdl_window_info::sdl_window_info(
 	, m_minimum_dim(0, 0)
 	, m_windowed_dim(0, 0)
 	, m_rendered_event(0, 1)
+	, m_draw_event(0, 0)
+	, m_render_thread_exit(false)
 	, m_extra_flags(0)
 	, m_mouse_captured(false)
 	, m_mouse_hidden(false)
@@ -1361,6 +1435,7 @@ sdl_window_info::sdl_window_info(
 
 sdl_window_info::~sdl_window_info()
 {
+	stop_render_thread();
 }
 
 
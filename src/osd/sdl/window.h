@@ -19,6 +19,7 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <thread>
 #include <vector>
 
 
@@ -102,6 +103,10 @@ private:
 
 	void measure_fps(int update);
 
+	void start_render_thread();
+	void stop_render_thread();
+	void render_thread_main();
+
 	std::vector<sdl_pointer_info>::iterator map_pointer(SDL_FingerID finger, unsigned device);
 
 	// window handle and info
@@ -114,6 +119,11 @@ private:
 	// rendering info
 	osd_event           m_rendered_event;
 
+	// render thread, when drawing is done off the main thread
+	std::thread         m_render_thread;
+	osd_event           m_draw_event;
+	bool                m_render_thread_exit;
+
 	// Original display_mode
 	SDL_DisplayMode     m_original_mode;
 
@@ -13,6 +13,7 @@
 #include "bitmap.h"
 #include "cdrom.h"
 #include "corefile.h"
+#include "corestr.h"
 #include "coretmpl.h"
 #include "hashing.h"
 #include "md5.h"
@@ -35,6 +36,7 @@
 #include <new>
 #include <optional>
 #include <regex>
+#include <sstream>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
@@ -67,6 +69,9 @@ constexpr uint32_t IDE_SECTOR_SIZE = 512;
 // temporary input buffer size
 constexpr uint32_t TEMP_BUFFER_SIZE = 32 * 1024 * 1024;
 
+// files verified at once in batch mode; each is decompressed on several threads already
+constexpr uint32_t VERIFY_BATCH_FILES = 4;
+
 // modes
 constexpr int MODE_NORMAL = 0;
 constexpr int MODE_CUEBIN = 1;
@@ -100,6 +105,7 @@ constexpr bool OSD_PRINTF_VERBOSE = false;
 
 // option strings
 #define OPTION_INPUT "input"
+#define OPTION_INPUT_LIST "inputlist"
 #define OPTION_OUTPUT "output"
 #define OPTION_OUTPUT_BIN "outputbin"
 #define OPTION_OUTPUT_SPLITBIN "splitbin"
@@ -672,6 +678,7 @@ static const std::array<chd_codec_type, 4> s_default_ld_compression = { CHD_CODE
 static const option_description s_options[] =
 {
 	{ OPTION_INPUT,                 "i",    true, " <filename>: input file name" },
+	{ OPTION_INPUT_LIST,            "il",   true, " <filename>: file listing input CHDs to process, one per line" },
 	{ OPTION_INPUT_PARENT,          "ip",   true, " <filename>: parent file name for input CHD" },
 	{ OPTION_OUTPUT,                "o",    true, " <filename>: output file name" },
 	{ OPTION_OUTPUT_BIN,            "ob",   true, " <filename>: output file name for binary data" },
@@ -713,11 +720,13 @@ static const command_description s_commands[] =
 		}
 	},
 
-	{ COMMAND_VERIFY, do_verify, ": verifies a CHD's integrity",
+	{ COMMAND_VERIFY, do_verify, ": verifies a CHD's integrity, or those of a list of CHDs",
 		{
-			REQUIRED OPTION_INPUT,
+			OPTION_INPUT,
+			OPTION_INPUT_LIST,
 			OPTION_INPUT_PARENT,
-			OPTION_FIX
+			OPTION_FIX,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -1766,8 +1775,215 @@ static void do_info(parameters_map &params)
 //  do_verify - validate the SHA-1 on a CHD
 //-------------------------------------------------
 
+//-------------------------------------------------
+//  compute_raw_sha1 - read all the data in a CHD
+//  and hash it, hashing each block on a work
+//  item while the next is read
+//-------------------------------------------------
+
+struct sha1_block
+{
+	util::sha1_creator *sha1;
+	const uint8_t *data;
+	uint32_t length;
+};
+
+static void *sha1_block_static(void *param, int threadid)
+{
+	sha1_block &block = *reinterpret_cast<sha1_block *>(param);
+	block.sha1->append(block.data, block.length);
+	return nullptr;
+}
+
+static std::error_condition compute_raw_sha1(chd_file &input_chd, util::sha1_t &result, bool show_progress)
+{
+	// create a pair of arrays to read into
+	std::vector<uint8_t> buffer[2];
+	for (std::vector<uint8_t> &b : buffer)
+		b.resize((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
+	osd_work_queue *const queue = osd_work_queue_alloc(0);
+
+	// read all the data and build up an SHA-1
+	util::sha1_creator rawsha1;
+	sha1_block block;
+	osd_work_item *pending = nullptr;
+	std::error_condition err;
+	int current = 0;
+	for (uint64_t offset = 0; offset < input_chd.logical_bytes(); )
+	{
+		if (show_progress)
+			progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(input_chd.logical_bytes()));
+
+		// determine how much to read
+		uint32_t bytes_to_read = (std::min<uint64_t>)(buffer[current].size(), input_chd.logical_bytes() - offset);
+		err = input_chd.read_bytes(offset, &buffer[current][0], bytes_to_read);
+		if (err)
+			break;
+
+		// wait for the last block to be hashed, then hash this one
+		if (pending)
+		{
+			osd_work_item_wait(pending, osd_ticks_per_second() * 100);
+			osd_work_item_release(pending);
+			pending = nullptr;
+		}
+		block.sha1 = &rawsha1;
+		block.data = &buffer[current][0];
+		block.length = bytes_to_read;
+		pending = queue ? osd_work_item_queue(queue, sha1_block_static, &block, 0) : nullptr;
+		if (!pending)
+			sha1_block_static(&block, 0);
+
+		offset += bytes_to_read;
+		current ^= 1;
+	}
+	if (pending)
+	{
+		osd_work_item_wait(pending, osd_ticks_per_second() * 100);
+		osd_work_item_release(pending);
+	}
+	if (queue)
+		osd_work_queue_free(queue);
+
+	if (!err)
+		result = rawsha1.finish();
+	return err;
+}
+
+
+//-------------------------------------------------
+//  verify_batch - verify the CHDs in a list file,
+//  several at a time, printing each one's result
+//  in the order they're listed
+//-------------------------------------------------
+
+struct verify_job
+{
+	std::string filename;
+	bool fix;
+	std::ostringstream output;
+	bool failed;
+};
+
+static void *verify_job_static(void *param, int threadid)
+{
+	verify_job &job = *reinterpret_cast<verify_job *>(param);
+	job.failed = true;
+
+	chd_file input_chd;
+	std::error_condition err = input_chd.open(job.filename, job.fix);
+	if (err)
+	{
+		util::stream_format(job.output, "%s: error opening CHD file: %s\n", job.filename, err.message());
+		return nullptr;
+	}
+
+	// only makes sense for compressed CHDs with valid SHA-1's
+	util::sha1_t const raw_sha1 = (input_chd.version() <= 3) ? input_chd.sha1() : input_chd.raw_sha1();
+	if (!input_chd.compressed() || (raw_sha1 == util::sha1_t::null))
+	{
+		util::stream_format(job.output, "%s: no verification to be done; CHD is %s\n", job.filename, input_chd.compressed() ? "missing a checksum" : "uncompressed");
+		job.failed = false;
+		return nullptr;
+	}
+
+	util::sha1_t computed_sha1;
+	err = compute_raw_sha1(input_chd, computed_sha1, false);
+	if (err)
+	{
+		util::stream_format(job.output, "%s: error reading CHD file: %s\n", job.filename, err.message());
+		return nullptr;
+	}
+
+	bool const raw_ok = raw_sha1 == computed_sha1;
+	bool const overall_ok = !raw_ok || (input_chd.version() < 4) || (input_chd.sha1() == input_chd.compute_overall_sha1(computed_sha1));
+	if (raw_ok && overall_ok)
+	{
+		util::stream_format(job.output, "%s: verification successful\n", job.filename);
+		job.failed = false;
+		return nullptr;
+	}
+
+	util::stream_format(job.output, "%s: %s SHA1 mismatch, actual data SHA1 = %s\n", job.filename, raw_ok ? "overall" : "raw", computed_sha1.as_string());
+	if (job.fix)
+	{
+		err = input_chd.set_raw_sha1(computed_sha1);
+		if (err)
+			util::stream_format(job.output, "%s: error updating SHA1: %s\n", job.filename, err.message());
+		else
+			util::stream_format(job.output, "%s: SHA1 updated to correct value\n", job.filename);
+	}
+	return nullptr;
+}
+
+static void verify_batch(const parameters_map &params)
+{
+	// read the list, skipping blank lines and comments
+	std::string const &listname = *params.find(OPTION_INPUT_LIST)->second;
+	util::core_file::ptr listfile;
+	std::error_condition filerr = util::core_file::open(listname, OPEN_FLAG_READ, listfile);
+	if (filerr)
+		report_error(1, "Unable to open file (%s): %s", listname, filerr.message());
+	std::vector<std::unique_ptr<verify_job> > jobs;
+	char line[1024];
+	while (listfile->gets(line, std::size(line)))
+	{
+		std::string_view name = strtrimspace(line);
+		if (name.empty() || (name[0] == '#'))
+			continue;
+		auto &job = *jobs.emplace_back(std::make_unique<verify_job>());
+		job.filename = name;
+		job.fix = params.find(OPTION_FIX) != params.end();
+	}
+	listfile.reset();
+	if (jobs.empty())
+		report_error(1, "No input files listed in %s", listname);
+
+	// keep a few files going at once, reporting each as it finishes in turn
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	std::vector<osd_work_item *> items(jobs.size(), nullptr);
+	uint32_t failures = 0;
+	for (size_t next = 0, done = 0; done < jobs.size(); done++)
+	{
+		for ( ; (next < jobs.size()) && (next < done + VERIFY_BATCH_FILES); next++)
+		{
+			items[next] = queue ? osd_work_item_queue(queue, verify_job_static, jobs[next].get(), 0) : nullptr;
+			if (!items[next])
+				verify_job_static(jobs[next].get(), 0);
+		}
+
+		if (items[done])
+		{
+			while (!osd_work_item_wait(items[done], osd_ticks_per_second()))
+				progress(false, "Verifying %s, %u of %u... \r", jobs[done]->filename, unsigned(done + 1), unsigned(jobs.size()));
+			osd_work_item_release(items[done]);
+		}
+		util::stream_format(jobs[done]->failed ? std::cerr : std::cout, "%s", jobs[done]->output.str());
+		if (jobs[done]->failed)
+			failures++;
+	}
+	if (queue)
+		osd_work_queue_free(queue);
+
+	util::stream_format(std::cout, "%u of %u CHDs verified successfully\n", unsigned(jobs.size() - failures), unsigned(jobs.size()));
+	if (failures)
+		throw fatal_error(1);
+}
+
+
 static void do_verify(parameters_map &params)
 {
+	parse_numprocessors(params);
+	if (params.find(OPTION_INPUT_LIST) != params.end())
+	{
+		if ((params.find(OPTION_INPUT) != params.end()) || (params.find(OPTION_INPUT_PARENT) != params.end()))
+			report_error(1, "--%s can't be used with --%s or --%s", OPTION_INPUT_LIST, OPTION_INPUT, OPTION_INPUT_PARENT);
+		verify_batch(params);
+		return;
+	}
+	if (params.find(OPTION_INPUT) == params.end())
+		report_error(1, "Either --%s or --%s is required", OPTION_INPUT, OPTION_INPUT_LIST);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
@@ -1780,26 +1996,11 @@ static void do_verify(parameters_map &params)
 	if (raw_sha1 == util::sha1_t::null)
 		report_error(0, "No verification to be done; CHD has no checksum");
 
-	// create an array to read into
-	std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
-
 	// read all the data and build up an SHA-1
-	util::sha1_creator rawsha1;
-	for (uint64_t offset = 0; offset < input_chd.logical_bytes(); )
-	{
-		progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(input_chd.logical_bytes()));
-
-		// determine how much to read
-		uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_chd.logical_bytes() - offset);
-		std::error_condition err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
-		if (err)
-			report_error(1, "Error reading CHD file (%s): %s", *params.find(OPTION_INPUT)->second, err.message());
-
-		// add to the checksum
-		rawsha1.append(&buffer[0], bytes_to_read);
-		offset += bytes_to_read;
-	}
-	util::sha1_t computed_sha1 = rawsha1.finish();
+	util::sha1_t computed_sha1;
+	std::error_condition err = compute_raw_sha1(input_chd, computed_sha1, true);
+	if (err)
+		report_error(1, "Error reading CHD file (%s): %s", *params.find(OPTION_INPUT)->second, err.message());
 
 	// finish up
 	if (raw_sha1 != computed_sha1)
@@ -2613,6 +2814,9 @@ static void do_extract_raw(parameters_map &params)
 
 static void do_extract_cd(parameters_map &params)
 {
+	// frames are read one at a time, so keep enough decompressed hunks for a buffer's worth
+	chd_file::set_cache_size(TEMP_BUFFER_SIZE * 2);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
@@ -2959,6 +3163,16 @@ static void do_extract_cd(parameters_map &params)
 					frameofs = frame - trackinfo.splitframes;
 				}
 
+				// decompress the hunks for the next buffer's worth of frames on several threads
+				if (bufferoffs == 0)
+				{
+					uint32_t const chdframe = toc.tracks[trk].chdframeofs + frameofs;
+					uint32_t const frames = (std::min<uint32_t>)(buffer.size() / output_frame_size, actualframes - frame);
+					uint64_t const firsthunk = uint64_t(chdframe) * cdrom_file::FRAME_SIZE / input_chd.hunk_bytes();
+					uint64_t const lasthunk = (uint64_t(chdframe + frames) * cdrom_file::FRAME_SIZE - 1) / input_chd.hunk_bytes();
+					input_chd.prefetch_hunks(firsthunk, lasthunk + 1 - firsthunk);
+				}
+
 				// read the data
 				cdrom->read_data(cdrom->get_track_start_phys(trk) + frameofs, &buffer[bufferoffs], toc.tracks[trk].trktype, true);
 
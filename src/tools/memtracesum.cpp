@@ -0,0 +1,236 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    memtracesum.cpp
+
+    Summarizer for memory access traces written with -memtrace.
+
+****************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+/***************************************************************************
+    CONSTANTS & TYPES
+***************************************************************************/
+
+// record layout and flags, see src/emu/memtrace.h
+struct trace_record
+{
+	uint64_t data;
+	uint32_t address;
+	uint16_t space;
+	uint8_t flags;
+	uint8_t lanes;
+};
+
+static_assert(sizeof(trace_record) == 16, "trace records are 16 bytes");
+
+#define RECORD_WRITE            0x01
+#define RECORD_FRAME            0x40
+#define RECORD_OVERFLOW         0x80
+
+#define DEFAULT_PAGE_BITS       8
+#define DEFAULT_TOP_COUNT       20
+
+struct access_count
+{
+	uint64_t reads = 0;
+	uint64_t writes = 0;
+
+	uint64_t total() const { return reads + writes; }
+};
+
+struct trace_space
+{
+	std::string name;
+	int data_width = 0;
+	int addr_width = 0;
+	access_count total;
+	std::unordered_map<uint32_t, access_count> pages;
+	std::unordered_map<uint32_t, access_count> addresses;
+};
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    read_header - read the file header and the
+    address space descriptors
+-------------------------------------------------*/
+
+static bool read_header(FILE *file, std::vector<trace_space> &spaces)
+{
+	char magic[8];
+	uint32_t version, count;
+	if (fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, "MAMEMTR", 8) != 0)
+		return false;
+	if (fread(&version, sizeof(version), 1, file) != 1 || version != 1)
+		return false;
+	if (fread(&count, sizeof(count), 1, file) != 1)
+		return false;
+
+	spaces.resize(count);
+	for (trace_space &space : spaces)
+	{
+		uint8_t desc[4];
+		uint16_t length;
+		if (fread(desc, sizeof(desc), 1, file) != 1 || fread(&length, sizeof(length), 1, file) != 1)
+			return false;
+		space.data_width = desc[0];
+		space.addr_width = desc[1];
+		space.name.resize(length);
+		if (length != 0 && fread(&space.name[0], length, 1, file) != 1)
+			return false;
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    print_top - print the busiest entries of a
+    histogram
+-------------------------------------------------*/
+
+static void print_top(const char *title, const std::unordered_map<uint32_t, access_count> &histogram, uint32_t span, int digits, size_t top, uint64_t frames)
+{
+	std::vector<std::pair<uint32_t, access_count>> sorted(histogram.begin(), histogram.end());
+	std::sort(sorted.begin(), sorted.end(), [] (auto const &a, auto const &b) { return (a.second.total() > b.second.total()) || ((a.second.total() == b.second.total()) && (a.first < b.first)); });
+	if (sorted.size() > top)
+		sorted.resize(top);
+
+	printf("  %s:\n", title);
+	for (auto const &entry : sorted)
+	{
+		if (span > 1)
+			printf("    %0*X-%0*X", digits, entry.first, digits, entry.first + span - 1);
+		else
+			printf("    %0*X", digits, entry.first);
+		printf("  %12llu reads  %12llu writes", (unsigned long long)entry.second.reads, (unsigned long long)entry.second.writes);
+		if (frames != 0)
+			printf("  %10.1f/frame", double(entry.second.total()) / double(frames));
+		printf("\n");
+	}
+}
+
+
+/*-------------------------------------------------
+    summarize - read a trace and print the
+    per-space histograms
+-------------------------------------------------*/
+
+static int summarize(const char *filename, int page_bits, size_t top)
+{
+	FILE *file = fopen(filename, "rb");
+	if (file == nullptr)
+	{
+		fprintf(stderr, "Error opening file '%s'\n", filename);
+		return 1;
+	}
+
+	std::vector<trace_space> spaces;
+	if (!read_header(file, spaces))
+	{
+		fprintf(stderr, "'%s' is not a memory trace file\n", filename);
+		fclose(file);
+		return 1;
+	}
+
+	// accumulate the records
+	uint64_t frames = 0, lost = 0, bad = 0;
+	std::vector<trace_record> buffer(65536);
+	size_t count;
+	while ((count = fread(buffer.data(), sizeof(trace_record), buffer.size(), file)) != 0)
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			trace_record const &rec = buffer[index];
+			if (rec.flags & RECORD_FRAME)
+				frames++;
+			else if (rec.flags & RECORD_OVERFLOW)
+				lost += rec.data;
+			else if (rec.space >= spaces.size())
+				bad++;
+			else
+			{
+				trace_space &space = spaces[rec.space];
+				uint64_t access_count::*const field = (rec.flags & RECORD_WRITE) ? &access_count::writes : &access_count::reads;
+				space.total.*field += 1;
+				space.pages[rec.address >> page_bits << page_bits].*field += 1;
+				space.addresses[rec.address].*field += 1;
+			}
+		}
+	}
+	fclose(file);
+
+	// print the summary
+	printf("%s: %llu frames", filename, (unsigned long long)frames);
+	if (lost != 0)
+		printf(", %llu records lost to ring overflow", (unsigned long long)lost);
+	if (bad != 0)
+		printf(", %llu invalid records", (unsigned long long)bad);
+	printf("\n");
+	for (trace_space const &space : spaces)
+	{
+		if (space.total.total() == 0)
+			continue;
+		int const digits = (space.addr_width + 3) / 4;
+		printf("\n%s (%d-bit data, %d-bit address): %llu reads, %llu writes\n", space.name.c_str(), space.data_width, space.addr_width,
+				(unsigned long long)space.total.reads, (unsigned long long)space.total.writes);
+		print_top("busiest pages", space.pages, uint32_t(1) << page_bits, digits, top, frames);
+		print_top("busiest addresses", space.addresses, 1, digits, top, frames);
+	}
+	return 0;
+}
+
+
+
+/***************************************************************************
+    MAIN
+***************************************************************************/
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	int page_bits = DEFAULT_PAGE_BITS;
+	size_t top = DEFAULT_TOP_COUNT;
+	const char *filename = nullptr;
+	bool usage = false;
+
+	for (int arg = 1; arg < argc && !usage; arg++)
+	{
+		if (!strcmp(argv[arg], "-pagebits") && (arg + 1) < argc)
+			page_bits = atoi(argv[++arg]);
+		else if (!strcmp(argv[arg], "-top") && (arg + 1) < argc)
+			top = atoi(argv[++arg]);
+		else if (argv[arg][0] != '-' && filename == nullptr)
+			filename = argv[arg];
+		else
+			usage = true;
+	}
+
+	if (usage || filename == nullptr || page_bits < 0 || page_bits > 31)
+	{
+		fprintf(stderr, "Usage:\nmemtracesum [-pagebits <n>] [-top <n>] <tracefile>\n");
+		fprintf(stderr, "  -pagebits <n>   size of the histogram pages as a power of 2 (default %d)\n", DEFAULT_PAGE_BITS);
+		fprintf(stderr, "  -top <n>        number of pages and addresses listed per space (default %d)\n", DEFAULT_TOP_COUNT);
+		return 1;
+	}
+
+	return summarize(filename, page_bits, top);
+}
@@ -227,6 +227,7 @@ using util::BIT;
 #include "eminline.h"
 #include "endianness.h"
 #include "ioprocs.h"
+#include "ioprocsfilter.h"
 #include "osdfile.h"
 #include "strformat.h"
 
@@ -237,9 +238,13 @@ using util::BIT;
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -389,6 +394,11 @@ struct options
 	uint32_t                skip;
 	uint32_t                count;
 	bool                    octal;
+	bool                    trace;
+	bool                    json;
+	offs_t                  minpc;
+	offs_t                  maxpc;
+	uint32_t                jobs;
 };
 
 static const dasm_table_entry dasm_table[] =
@@ -794,6 +804,23 @@ struct dasm_line
 	std::string dasm;
 };
 
+// a stretch of a file disassembled on its own thread, starting a little
+// early so it's back on instruction boundaries by the time it gets to
+// the part it's responsible for
+struct dasm_chunk
+{
+	offs_t start;       // pc units from the base pc
+	offs_t end;
+	offs_t reached;     // where the last instruction ended
+	std::vector<dasm_line> lines;
+};
+
+// pc units each chunk starts before its own stretch
+static constexpr offs_t CHUNK_OVERLAP = 256;
+
+// smallest stretch worth giving a thread
+static constexpr offs_t CHUNK_MIN_SIZE = 0x4000;
+
 unidasm_data_buffer::unidasm_data_buffer(util::disasm_interface *_disasm, const dasm_table_entry *_entry) : disasm(_disasm), entry(_entry)
 {
 	u32 flags = disasm->interface_flags();
@@ -1193,8 +1220,11 @@ static int parse_options(int argc, char *argv[], options *opts)
 	bool pending_arch = false;
 	bool pending_skip = false;
 	bool pending_count = false;
+	bool pending_range = false;
+	bool pending_jobs = false;
 
 	memset(opts, 0, sizeof(*opts));
+	opts->maxpc = ~offs_t(0);
 
 	// loop through arguments
 	for(unsigned arg = 1; arg < argc; arg++) {
@@ -1202,10 +1232,12 @@ static int parse_options(int argc, char *argv[], options *opts)
 
 		// is it a switch?
 		if(curarg[0] == '-' && curarg[1] != '\0') {
-			if(pending_base || pending_arch || pending_skip || pending_count)
+			if(pending_base || pending_arch || pending_skip || pending_count || pending_range || pending_jobs)
 				goto usage;
 
-			if(tolower((uint8_t)curarg[1]) == 'a')
+			if(!core_stricmp(&curarg[1], "json"))
+				opts->json = true;
+			else if(tolower((uint8_t)curarg[1]) == 'a')
 				pending_arch = true;
 			else if(tolower((uint8_t)curarg[1]) == 'b')
 				pending_base = true;
@@ -1225,6 +1257,12 @@ static int parse_options(int argc, char *argv[], options *opts)
 				opts->xchbytes = true;
 			else if(tolower((uint8_t)curarg[1]) == 'o')
 				opts->octal = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
+			else if(tolower((uint8_t)curarg[1]) == 'r')
+				pending_range = true;
+			else if(tolower((uint8_t)curarg[1]) == 'j')
+				pending_jobs = true;
 			else
 				goto usage;
 
@@ -1257,6 +1295,24 @@ static int parse_options(int argc, char *argv[], options *opts)
 				goto usage;
 			pending_count = false;
 
+		} else if(pending_range) {
+			// range of PCs shown from a trace
+			char *const comma = strchr(curarg, ',');
+			if(!comma)
+				goto usage;
+			*comma = '\0';
+			if(parse_number(curarg, "%x", &opts->minpc) != 1 || parse_number(comma + 1, "%x", &opts->maxpc) != 1)
+				goto usage;
+			pending_range = false;
+
+		} else if(pending_jobs) {
+			// worker threads, 0 for one per processor
+			if(parse_number(curarg, "%d", &opts->jobs) != 1)
+				goto usage;
+			if(!opts->jobs)
+				opts->jobs = std::max(std::thread::hardware_concurrency(), 1U);
+			pending_jobs = false;
+
 		} else if(opts->filename == nullptr) {
 			// filename
 			opts->filename = curarg;
@@ -1268,7 +1324,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	}
 
 	// if we have a dangling option, error
-	if(pending_base || pending_arch || pending_skip || pending_count)
+	if(pending_base || pending_arch || pending_skip || pending_count || pending_range || pending_jobs)
 		goto usage;
 
 	// if no file or no architecture, fail
@@ -1280,7 +1336,8 @@ static int parse_options(int argc, char *argv[], options *opts)
 usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
-	printf("   [-skip <n>] [-count <n>] [-octal]\n");
+	printf("   [-skip <n>] [-count <n>] [-octal] [-trace] [-range <start>,<end>]\n");
+	printf("   [-jobs <n>] [-json]\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1299,6 +1356,43 @@ usage:
 };
 
 
+// disassemble from start until reaching end, in pc units from the base pc,
+// returning where the last instruction ended
+static offs_t disasm_range(util::disasm_interface &disasm, const unidasm_data_buffer &opcodes, const unidasm_data_buffer &params, offs_t basepc, offs_t start, offs_t end, std::vector<dasm_line> &lines)
+{
+	// reuse one stream, resetting anything a disassembler might have left set
+	std::ostringstream stream;
+	std::ios_base::fmtflags const flags = stream.flags();
+	while(start < end) {
+		stream.str(std::string());
+		stream.flags(flags);
+		stream.fill(' ');
+		offs_t const len = disasm.disassemble(stream, basepc + start, opcodes, params) & util::disasm_interface::LENGTHMASK;
+		lines.emplace_back(dasm_line{ basepc + start, len, stream.str() });
+		start += len;
+	}
+	return start;
+}
+
+
+// append a string to a JSON document, quoted and escaped
+static void json_string(std::string &out, std::string_view str)
+{
+	out += '"';
+	for(char c : str) {
+		if(c == '"' || c == '\\') {
+			out += '\\';
+			out += c;
+		} else if(u8(c) < 0x20) {
+			out += util::string_format("\\u%04x", u8(c));
+		} else {
+			out += c;
+		}
+	}
+	out += '"';
+}
+
+
 int disasm_file(util::random_read &file, u64 length, options &opts)
 {
 	if(opts.skip >= length) {
@@ -1498,14 +1592,63 @@ int disasm_file(util::random_read &file, u64 length, options &opts)
 
 	// Do the disassembly
 	std::vector<dasm_line> dasm_lines;
-	offs_t curpc = opts.basepc;
-	for(u32 i=0; i < count;) {
+	u32 const chunk_count = std::min<u32>(opts.jobs, count / CHUNK_MIN_SIZE);
+	if((chunk_count > 1) && !(flags & (util::disasm_interface::NONLINEAR_PC | util::disasm_interface::PAGED))) {
+		// Linear pcs: split the range between threads, each with its own
+		// disassembler, then stitch the chunks together where they agree
+		// on an instruction boundary
+		offs_t const alignment = disasm->opcode_alignment();
+		offs_t const chunk_size = ((count / chunk_count) + (alignment - 1)) & ~(alignment - 1);
+		std::vector<dasm_chunk> chunks(chunk_count);
+		std::vector<std::thread> threads;
+		threads.reserve(chunk_count);
+		for(u32 i = 0; i < chunk_count; i++) {
+			dasm_chunk &chunk = chunks[i];
+			offs_t const begin = i * chunk_size;
+			chunk.start = (begin > CHUNK_OVERLAP) ? (begin - CHUNK_OVERLAP) : 0;
+			chunk.end = (i == (chunk_count - 1)) ? count : std::min<offs_t>(begin + chunk_size, count);
+			chunk.lines.reserve((chunk.end - chunk.start) / alignment);
+			threads.emplace_back(
+					[&chunk, &opts, popcodes, pparams] () {
+						std::unique_ptr<util::disasm_interface> dis(opts.dasm->alloc());
+						chunk.reached = disasm_range(*dis, *popcodes, *pparams, opts.basepc, chunk.start, chunk.end, chunk.lines);
+					});
+		}
+		for(std::thread &thread : threads)
+			thread.join();
+
+		offs_t cur = 0;
+		for(dasm_chunk &chunk : chunks) {
+			if(cur >= chunk.end)
+				continue;
+			auto const found = std::lower_bound(
+					chunk.lines.begin(),
+					chunk.lines.end(),
+					opts.basepc + cur,
+					[] (dasm_line const &l, offs_t pc) { return l.pc < pc; });
+			if((found != chunk.lines.end()) && (found->pc == (opts.basepc + cur))) {
+				dasm_lines.insert(dasm_lines.end(), std::make_move_iterator(found), std::make_move_iterator(chunk.lines.end()));
+				cur = chunk.reached;
+			} else {
+				// never fell into step, so carry on from where the last chunk left off
+				cur = disasm_range(*disasm, *popcodes, *pparams, opts.basepc, cur, chunk.end, dasm_lines);
+			}
+			std::vector<dasm_line>().swap(chunk.lines);
+		}
+	} else {
 		std::ostringstream stream;
-		offs_t result = disasm->disassemble(stream, curpc, *popcodes, *pparams);
-		offs_t len = result & util::disasm_interface::LENGTHMASK;
-		dasm_lines.emplace_back(dasm_line{ curpc, len, stream.str() });
-		curpc = next_pc(curpc, len);
-		i += len;
+		std::ios_base::fmtflags const streamflags = stream.flags();
+		offs_t curpc = opts.basepc;
+		for(u32 i=0; i < count;) {
+			stream.str(std::string());
+			stream.flags(streamflags);
+			stream.fill(' ');
+			offs_t result = disasm->disassemble(stream, curpc, *popcodes, *pparams);
+			offs_t len = result & util::disasm_interface::LENGTHMASK;
+			dasm_lines.emplace_back(dasm_line{ curpc, len, stream.str() });
+			curpc = next_pc(curpc, len);
+			i += len;
+		}
 	}
 
 	// Compute the extrema
@@ -1641,20 +1784,162 @@ int disasm_file(util::random_read &file, u64 length, options &opts)
 		}
 	}
 
-	if(opts.flipped) {
+	// Build the whole listing in one buffer and write it out at once
+	std::string out;
+	out.reserve(dasm_lines.size() * (max_len + max_text + aw + 8));
+	if(opts.json) {
+		out += "[\n";
+		for(auto it = dasm_lines.begin(); it != dasm_lines.end(); ++it) {
+			out += "\t{ \"pc\": ";
+			json_string(out, tf(pc_to_string(it->pc)));
+			out += util::string_format(", \"size\": %u", it->size >> granularity_shift);
+			if(!opts.norawbytes) {
+				out += ", \"bytes\": ";
+				json_string(out, tf(dump_raw_bytes(it->pc, it->size >> granularity_shift)));
+			}
+			out += ", \"text\": ";
+			json_string(out, tf(it->dasm));
+			out += ((it + 1) != dasm_lines.end()) ? " },\n" : " }\n";
+		}
+		out += "]\n";
+	} else if(opts.flipped) {
 		if(opts.norawbytes)
 			for(const auto &l : dasm_lines)
-				util::stream_format(std::cout, "%-*s ; %s\n", max_text, tf(l.dasm), tf(pc_to_string(l.pc)));
+				out += util::string_format("%-*s ; %s\n", max_text, tf(l.dasm), tf(pc_to_string(l.pc)));
 		else
 			for(const auto &l : dasm_lines)
-				util::stream_format(std::cout, "%-*s ; %s: %s\n", max_text, tf(l.dasm), tf(pc_to_string(l.pc)), tf(dump_raw_bytes(l.pc, l.size >> granularity_shift)));
+				out += util::string_format("%-*s ; %s: %s\n", max_text, tf(l.dasm), tf(pc_to_string(l.pc)), tf(dump_raw_bytes(l.pc, l.size >> granularity_shift)));
 	} else {
 		if(opts.norawbytes)
 			for(const auto &l : dasm_lines)
-				util::stream_format(std::cout, "%s: %s\n", tf(pc_to_string(l.pc)), tf(l.dasm));
+				out += util::string_format("%s: %s\n", tf(pc_to_string(l.pc)), tf(l.dasm));
 		else
 			for(const auto &l : dasm_lines)
-				util::stream_format(std::cout, "%s: %-*s  %s\n", tf(pc_to_string(l.pc)), max_len, tf(dump_raw_bytes(l.pc, l.size >> granularity_shift)), tf(l.dasm));
+				out += util::string_format("%s: %-*s  %s\n", tf(pc_to_string(l.pc)), max_len, tf(dump_raw_bytes(l.pc, l.size >> granularity_shift)), tf(l.dasm));
+	}
+	std::cout.write(out.data(), out.size());
+
+	return 0;
+}
+
+
+// read exactly the requested length from a trace, the decompressor
+// returns short at the end of each frame
+static bool read_trace(util::read_stream &stream, void *buffer, std::size_t length)
+{
+	u8 *dest = reinterpret_cast<u8 *>(buffer);
+	int empty = 0;
+	while(length) {
+		std::size_t actual;
+		if(stream.read_some(dest, length, actual))
+			return false;
+		if(!actual) {
+			if(++empty == 2)
+				return false;
+			continue;
+		}
+		empty = 0;
+		dest += actual;
+		length -= actual;
+	}
+	return true;
+}
+
+// disassemble a binary trace written by the debugger trace command, see
+// src/emu/debug/debugcpu.cpp for the format
+int disasm_trace(util::random_read &file, options &opts)
+{
+	enum : u8 { RECORD_INSN = 1, RECORD_IRQ, RECORD_LOOP, RECORD_TEXT, RECORD_REG };
+
+	util::read_stream::ptr const stream = util::zstd_read(file, 65536);
+	char magic[8];
+	u32 version;
+	u8 desc[4];
+	u16 length;
+	if(!stream || !read_trace(*stream, magic, sizeof(magic)) || memcmp(magic, "MAMEITR", 8) || !read_trace(*stream, &version, sizeof(version)) || version != 1) {
+		std::fprintf(stderr, "File '%s' is not an instruction trace\n", opts.filename);
+		return 1;
+	}
+	std::string cpu;
+	std::vector<std::string> registers;
+	bool valid = read_trace(*stream, desc, sizeof(desc)) && read_trace(*stream, &length, sizeof(length));
+	if(valid) {
+		cpu.resize(length);
+		valid = read_trace(*stream, cpu.data(), length);
+	}
+	for(int i = 0; valid && i != desc[3]; i++) {
+		valid = read_trace(*stream, &length, sizeof(length));
+		if(valid) {
+			registers.emplace_back(length, '\0');
+			valid = read_trace(*stream, registers.back().data(), length);
+		}
+	}
+	if(!valid) {
+		std::fprintf(stderr, "Error reading the header of trace '%s'\n", opts.filename);
+		return 1;
+	}
+	if(int8_t(desc[1]) != opts.dasm->pcshift)
+		std::fprintf(stderr, "Warning: trace of '%s' has address shift %d, architecture %s expects %d\n", cpu.c_str(), int8_t(desc[1]), opts.dasm->name, opts.dasm->pcshift);
+
+	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
+	unidasm_data_buffer buffer(disasm.get(), opts.dasm);
+	buffer.data.resize(256 + 8, 0x00);
+	int const unit = opts.dasm->pcshift < 0 ? 1 << -opts.dasm->pcshift : 1;
+	int const pcchars = (desc[0] + 3) / 4;
+
+	std::string regs;
+	u8 header[8], data[256];
+	while(read_trace(*stream, header, sizeof(header))) {
+		u16 extra;
+		u32 value;
+		memcpy(&extra, &header[2], sizeof(extra));
+		memcpy(&value, &header[4], sizeof(value));
+		if(header[1] && !read_trace(*stream, data, header[1])) {
+			std::fprintf(stderr, "Trace '%s' is truncated\n", opts.filename);
+			return 1;
+		}
+
+		switch(header[0]) {
+		case RECORD_INSN:
+			if(value >= opts.minpc && value <= opts.maxpc) {
+				// the units were logged least significant byte first
+				std::fill(buffer.data.begin(), buffer.data.end(), 0x00);
+				for(int i = 0; i < header[1]; i++)
+					buffer.data[(opts.dasm->endian == be) ? ((i & ~(unit - 1)) | (unit - 1 - (i & (unit - 1)))) : i] = data[i];
+				buffer.base_pc = value;
+				buffer.size = header[1];
+
+				std::ostringstream dasm;
+				disasm->disassemble(dasm, value, buffer, buffer);
+				std::string raw;
+				if(!opts.norawbytes)
+					for(int i = 0; i < header[1]; i++)
+						raw += util::string_format("%02x", buffer.data[i]);
+				util::stream_format(std::cout, "%0*X: %-16s %s%s%s\n", pcchars, value, raw, dasm.str(), regs.empty() ? "" : "  ;", regs);
+			}
+			regs.clear();
+			break;
+
+		case RECORD_IRQ:
+			util::stream_format(std::cout, "\n   (interrupted at %0*X, IRQ %d)\n\n", pcchars, value, extra);
+			break;
+
+		case RECORD_LOOP:
+			util::stream_format(std::cout, "\n   (loops for %d instructions)\n\n", value);
+			break;
+
+		case RECORD_TEXT:
+			std::cout.write(reinterpret_cast<char const *>(data), header[1]);
+			break;
+
+		case RECORD_REG:
+			if(extra < registers.size() && header[1] == sizeof(u64)) {
+				u64 reg;
+				memcpy(&reg, data, sizeof(reg));
+				regs += util::string_format(" %s=%X", registers[extra], reg);
+			}
+			break;
+		}
 	}
 
 	return 0;
@@ -1722,7 +2007,7 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	int result = disasm_file(*file, length, opts);
+	int result = opts.trace ? disasm_trace(*file, opts) : disasm_file(*file, length, opts);
 
 	file.reset();
 	std::free(data);
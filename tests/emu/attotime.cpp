@@ -4,8 +4,111 @@
 #include "eminline.h"
 #include "attotime.h"
 
+#include <vector>
+
+namespace {
+
+// straightforward implementations that the optimised operators must match exactly
+
+attotime reference_multiply(attotime const &value, u32 factor)
+{
+	if (value.m_seconds >= ATTOTIME_MAX_SECONDS)
+		return attotime::never;
+	if (factor == 0)
+		return attotime::zero;
+
+	u32 attolo;
+	u32 const attohi = divu_64x32_rem(value.m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
+	u64 temp = mulu_32x32(attolo, factor);
+	u32 reslo;
+	temp = divu_64x32_rem(temp, ATTOSECONDS_PER_SECOND_SQRT, reslo);
+	temp += mulu_32x32(attohi, factor);
+	u32 reshi;
+	temp = divu_64x32_rem(temp, ATTOSECONDS_PER_SECOND_SQRT, reshi);
+	temp += mulu_32x32(value.m_seconds, factor);
+	if (temp >= ATTOTIME_MAX_SECONDS)
+		return attotime::never;
+	return attotime(seconds_t(temp), attoseconds_t(reslo) + mul_32x32(reshi, ATTOSECONDS_PER_SECOND_SQRT));
+}
+
+attotime reference_divide(attotime const &value, u32 factor)
+{
+	if (value.m_seconds >= ATTOTIME_MAX_SECONDS)
+		return attotime::never;
+	if (factor == 0)
+		return value;
+
+	u32 attolo;
+	u32 const attohi = divu_64x32_rem(value.m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
+	u32 remainder;
+	seconds_t seconds = divu_64x32_rem(value.m_seconds, factor, remainder);
+	u64 temp = s64(attohi) + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
+	u32 const reshi = divu_64x32_rem(temp, factor, remainder);
+	temp = attolo + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
+	u32 const reslo = divu_64x32_rem(temp, factor, remainder);
+	attoseconds_t attoseconds = attoseconds_t(reslo) + mulu_32x32(reshi, ATTOSECONDS_PER_SECOND_SQRT);
+	if (remainder >= factor / 2)
+		if (++attoseconds >= ATTOSECONDS_PER_SECOND)
+		{
+			attoseconds = 0;
+			seconds++;
+		}
+	return attotime(seconds, attoseconds);
+}
+
+u64 reference_ticks(attotime const &value, u32 frequency)
+{
+	return mulu_32x32(value.m_seconds, frequency) + reference_multiply(attotime(0, value.m_attoseconds), frequency).m_seconds;
+}
+
+std::vector<attotime> sample_times()
+{
+	std::vector<attotime> result;
+	for (seconds_t seconds : { 0, 1, 2, 17, 18, 19, 1000, 999'999'999 })
+		for (attoseconds_t attos : { attoseconds_t(0), attoseconds_t(1), ATTOSECONDS_PER_NANOSECOND, ATTOSECONDS_PER_SECOND / 3, ATTOSECONDS_PER_SECOND / 2, ATTOSECONDS_PER_SECOND - 1 })
+			result.emplace_back(seconds, attos);
+
+	u64 state = 1;
+	for (int i = 0; i < 2000; i++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		seconds_t const seconds = (i & 1) ? seconds_t((state >> 33) % 20) : seconds_t((state >> 33) % ATTOTIME_MAX_SECONDS);
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		result.emplace_back(seconds, attoseconds_t((state >> 4) % ATTOSECONDS_PER_SECOND));
+	}
+	return result;
+}
+
+std::vector<u32> sample_factors()
+{
+	return std::vector<u32>{ 0, 1, 2, 3, 7, 60, 1000, 44'100, 48'000, 3'579'545, 14'318'181, 50'000'000, 1'000'000'000, 0x7fff'ffff, 0xffff'ffff };
+}
+
+} // anonymous namespace
+
 TEST_CASE("convert 1 sec to attotime", "[emu]")
 {
    attotime value = attotime::from_seconds(1);
    REQUIRE(value.as_attoseconds() == 1000000000000000000);
 }
+
+TEST_CASE("attotime multiplication matches reference", "[emu]")
+{
+	for (attotime const &value : sample_times())
+		for (u32 factor : sample_factors())
+			REQUIRE((value * factor) == reference_multiply(value, factor));
+}
+
+TEST_CASE("attotime division matches reference", "[emu]")
+{
+	for (attotime const &value : sample_times())
+		for (u32 factor : sample_factors())
+			REQUIRE((value / factor) == reference_divide(value, factor));
+}
+
+TEST_CASE("attotime tick conversion matches reference", "[emu]")
+{
+	for (attotime const &value : sample_times())
+		for (u32 factor : sample_factors())
+			REQUIRE(value.as_ticks(factor) == reference_ticks(value, factor));
+}
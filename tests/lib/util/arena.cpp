@@ -0,0 +1,60 @@
+#include "catch.hpp"
+
+#include "arena.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+TEST_CASE("Arena allocations are aligned and don't overlap", "[util]")
+{
+	util::arena arena(256);
+	std::vector<std::pair<uint8_t *, size_t> > blocks;
+	for (size_t i = 0; i < 200; i++)
+	{
+		size_t const size = (i * 37) % 300 + 1;
+		size_t const align = size_t(1) << (i % 7);
+		uint8_t *const p = static_cast<uint8_t *>(arena.allocate(size, align));
+		REQUIRE((reinterpret_cast<uintptr_t>(p) & (align - 1)) == 0);
+		std::memset(p, int(i), size);
+		blocks.emplace_back(p, size);
+	}
+	for (size_t i = 0; i < blocks.size(); i++)
+		for (size_t j = 0; j < blocks[i].second; j++)
+			REQUIRE(blocks[i].first[j] == uint8_t(i));
+}
+
+TEST_CASE("Arena reuses its memory after a reset", "[util]")
+{
+	util::arena arena(64);
+	arena.allocate(16);
+	for (int i = 0; i < 100; i++)
+		arena.allocate(48);
+	arena.reset();
+
+	// everything fits in the coalesced chunk now
+	void *const again = arena.allocate(16);
+	for (int i = 0; i < 100; i++)
+		arena.allocate(48);
+	arena.reset();
+	REQUIRE(arena.allocate(16) == again);
+}
+
+TEST_CASE("Arena allocator works with standard containers", "[util]")
+{
+	util::arena arena;
+	std::vector<int, util::arena_allocator<int> > in_arena{ util::arena_allocator<int>(&arena) };
+	std::vector<int, util::arena_allocator<int> > on_heap;
+	for (int i = 0; i < 1000; i++)
+	{
+		in_arena.push_back(i);
+		on_heap.push_back(i);
+	}
+	REQUIRE(in_arena.get_allocator().get_arena() == &arena);
+	REQUIRE(on_heap.get_allocator().get_arena() == nullptr);
+	for (int i = 0; i < 1000; i++)
+	{
+		REQUIRE(in_arena[i] == i);
+		REQUIRE(on_heap[i] == i);
+	}
+}
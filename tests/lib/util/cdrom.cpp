@@ -0,0 +1,86 @@
+#include "catch.hpp"
+
+#include "cdrom.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// the P and Q codes worked out a byte at a time, straight from the layout
+void reference_ecc(const uint8_t *sector, uint8_t *p, uint8_t *q)
+{
+	auto const source = [sector, p] (unsigned offset) -> uint8_t
+	{
+		if (offset >= 2064)
+			return p[offset - 2064];
+		return ((sector[15] == 2) && (offset < 4)) ? 0 : sector[12 + offset];
+	};
+	auto const mul2 = [] (uint8_t v) { return uint8_t((v << 1) ^ ((v & 0x80) ? 0x1d : 0)); };
+	auto const compute = [&source, &mul2] (unsigned major, unsigned minor_count, unsigned major_mult, unsigned minor_inc, unsigned size, uint8_t &val1, uint8_t &val2)
+	{
+		unsigned index = (major >> 1) * major_mult + (major & 1);
+		uint8_t a = 0, b = 0;
+		for (unsigned minor = 0; minor < minor_count; minor++)
+		{
+			uint8_t const t = source(index);
+			index += minor_inc;
+			if (index >= size)
+				index -= size;
+			a = mul2(a ^ t);
+			b ^= t;
+		}
+		// divide by 3 in GF(2^8)
+		a = mul2(a) ^ b;
+		for (unsigned x = 0; x < 256; x++)
+			if (uint8_t(x ^ mul2(uint8_t(x))) == a)
+			{
+				val1 = uint8_t(x);
+				break;
+			}
+		val2 = val1 ^ b;
+	};
+	for (unsigned major = 0; major < 86; major++)
+		compute(major, 24, 2, 86, 2064, p[major], p[86 + major]);
+	for (unsigned major = 0; major < 52; major++)
+		compute(major, 43, 86, 88, 2236, q[major], q[52 + major]);
+}
+
+std::vector<uint8_t> make_sector(uint32_t seed, uint8_t mode)
+{
+	std::vector<uint8_t> sector(2352);
+	uint32_t state = seed;
+	for (uint8_t &b : sector)
+	{
+		state = state * 1103515245 + 12345;
+		b = uint8_t(state >> 24);
+	}
+	static uint8_t const sync[12] = { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+	std::memcpy(&sector[0], sync, sizeof(sync));
+	sector[15] = mode;
+	return sector;
+}
+
+} // anonymous namespace
+
+TEST_CASE("CD-ROM ECC matches a bytewise implementation", "[util]")
+{
+	for (uint32_t seed = 1; seed <= 64; seed++)
+	{
+		for (uint8_t mode : { 1, 2 })
+		{
+			std::vector<uint8_t> sector = make_sector(seed, mode);
+			uint8_t p[172], q[104];
+			reference_ecc(&sector[0], p, q);
+
+			cdrom_file::ecc_generate(&sector[0]);
+			REQUIRE(std::memcmp(&sector[0x81c], p, sizeof(p)) == 0);
+			REQUIRE(std::memcmp(&sector[0x81c + sizeof(p)], q, sizeof(q)) == 0);
+			REQUIRE(cdrom_file::ecc_verify(&sector[0]));
+
+			sector[100] ^= 0x40;
+			REQUIRE(!cdrom_file::ecc_verify(&sector[0]));
+		}
+	}
+}
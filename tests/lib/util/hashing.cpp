@@ -0,0 +1,78 @@
+#include "catch.hpp"
+
+#include "hashing.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> make_data(size_t length)
+{
+	std::vector<uint8_t> result(length);
+	uint32_t state = 1;
+	for (uint8_t &b : result)
+	{
+		state = state * 1103515245 + 12345;
+		b = uint8_t(state >> 24);
+	}
+	return result;
+}
+
+// bit at a time, as the CRC-32 is defined
+uint32_t reference_crc32(const uint8_t *data, size_t length)
+{
+	uint32_t crc = ~uint32_t(0);
+	for (size_t i = 0; i < length; i++)
+	{
+		crc ^= data[i];
+		for (int bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320U : 0);
+	}
+	return ~crc;
+}
+
+} // anonymous namespace
+
+TEST_CASE("SHA-1 of standard test vectors", "[util]")
+{
+	REQUIRE(util::sha1_creator::simple("", 0).as_string() == "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+	REQUIRE(util::sha1_creator::simple("abc", 3).as_string() == "a9993e364706816aba3e25717850c26c9cd0d89d");
+
+	char const *const message = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	REQUIRE(util::sha1_creator::simple(message, std::strlen(message)).as_string() == "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+
+	std::vector<uint8_t> const million(1000000, 'a');
+	REQUIRE(util::sha1_creator::simple(million.data(), million.size()).as_string() == "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+}
+
+TEST_CASE("SHA-1 doesn't depend on how the data is split", "[util]")
+{
+	std::vector<uint8_t> const data = make_data(70000);
+	for (size_t length : { 0, 1, 55, 56, 63, 64, 65, 127, 128, 129, 1000, 4096, 70000 })
+	{
+		util::sha1_creator creator;
+		size_t step = 1;
+		for (size_t offset = 0; offset < length; offset += step, step = step * 3 + 7)
+			creator.append(&data[offset], uint32_t(std::min(step, length - offset)));
+		REQUIRE(creator.finish() == util::sha1_creator::simple(data.data(), length));
+	}
+}
+
+TEST_CASE("CRC-32 matches a bitwise implementation", "[util]")
+{
+	REQUIRE(util::crc32_creator::simple("123456789", 9).as_string() == "cbf43926");
+
+	std::vector<uint8_t> const data = make_data(70000);
+	for (size_t length : { 0, 1, 15, 16, 63, 64, 65, 79, 80, 127, 128, 1000, 4096, 70000 })
+	{
+		util::crc32_creator creator;
+		size_t step = 1;
+		for (size_t offset = 0; offset < length; offset += step, step = step * 3 + 7)
+			creator.append(&data[offset], uint32_t(std::min(step, length - offset)));
+		uint32_t const expected = reference_crc32(data.data(), length);
+		REQUIRE(creator.finish() == util::crc32_t(expected));
+		REQUIRE(util::crc32_creator::simple(data.data(), length) == util::crc32_t(expected));
+	}
+}
@@ -0,0 +1,24 @@
+#include "catch.hpp"
+
+#include "strformat.h"
+
+#include <string>
+
+// format strings are checked at compile time
+static_assert(util::format_argument_count("no conversions") == 0);
+static_assert(util::format_argument_count("%d %s %%") == 2);
+static_assert(util::format_argument_count("%*.*f") == 3);
+static_assert(util::format_argument_count("%3$d %1$s") == 3);
+static_assert(util::format_argument_count("%2$*1$d") == 2);
+static_assert(util::format_argument_count("%m") == 0);
+static_assert(util::format_argument_count(L"%04X") == 1);
+static_assert(util::format_valid("%d %d", 2));
+static_assert(util::format_valid("%d", 3));
+static_assert(!util::format_valid("%d %d", 1));
+
+TEST_CASE("Format argument count matches what's consumed", "[util]")
+{
+	REQUIRE(util::format_argument_count("%0$d") == -1);
+	REQUIRE(util::string_format("%2$*1$d|%3$s", 4, 7, "x") == "   7|x");
+	REQUIRE(util::string_format("%-5s|%05.1f|%%", "ab", 2.25) == "ab   |002.2|%");
+}